@@ -1,4 +1,5 @@
 import os
+import sys
 import shutil
 import subprocess
 from pathlib import Path
@@ -40,6 +41,11 @@ def build():
     # Ensure release folder exists
     OUTPUT_DIR.mkdir(exist_ok=True)
 
+    # Bake scene.json -> scene.bin (and regenerate its loader) so the release build loads the binary scene
+    result = subprocess.run([sys.executable, "meta_scene_bin.py"])
+    if result.returncode != 0:
+        print("⚠ scene.bin bake failed - release will fall back to scene.json")
+
     # Run cl.exe
     cmd = ["cl.exe"] + CL_FLAGS + [SOURCE_FILE]
     print("Running:", " ".join(cmd))
@@ -217,6 +217,17 @@ def parse_com_pointers(content: str, struct_names: List[str]) -> List[Dict]:
                 })
     return resources
 
+# ----------------------------------------------------------------------
+# String table parser: static const char* g_names[N] = { "a", "b" };
+# ----------------------------------------------------------------------
+def parse_string_array(path: Union[str, Path], array_name: str) -> List[str]:
+    text = Path(path).read_text(encoding='utf-8')
+    m = re.search(array_name + r'\s*\[[^\]]*\]\s*=\s*\{(.*?)\}', text, re.DOTALL)
+    if not m:
+        log_error(f"Could not find {array_name} in {path}")
+        return []
+    return re.findall(r'"([^"]*)"', m.group(1))
+
 # ----------------------------------------------------------------------
 # Argument parser helper
 # ----------------------------------------------------------------------
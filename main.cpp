@@ -49,11 +49,39 @@
 #include "renderer_dx12.cpp"
 #include "scene_data.h"
 #include "generated/scene_json.cpp"
+#include "generated/scene_json_stream.cpp"
+#include "generated/scene_bin.cpp"
+#include "generated/scene_fields.h"
+#include "scene_undo.h"
+#include "transform_cache.h"
 #include "ray_intersections.h"
 #include "cylinder_overlap.h"
+#include "bvh.h"
+#include "draw_sort.h"
+#include "draw_instancing.h"
+#include "render_commands.h"
+#include "render_graph.h"
+#include "scene_commands.h"
 #include "descriptor_layout.h"
+#include "upload_ring.h"
+#include "occlusion_raster.h"
+#include "draw_lod.h"
 
 static bool g_show_player_wireframe = false;
+
+// cpu cost of the per-frame scans over g_scene, shown in Debug Controls
+static struct
+{
+    double fillDrawListMs = 0.0;
+    double collisionMs = 0.0; // wall resolution + ground probe
+    double sceneLoadMs = 0.0;
+    const char *sceneLoadedFrom = "";
+} g_scene_timings;
+
+inline double CountsToMs(Uint64 counts)
+{
+    return (double)counts * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
 static struct
 {
     bool valid = false;
@@ -66,6 +94,58 @@ static struct
 static ConfigData g_liveConfigData = {};
 static Scene g_scene; // TODO: this is called scene but in practice it is only the static geometry, perhaps we should extend when we add enemies, or we should rename to static environment geometry only? TODO decide
 
+// the static part of the draw list is persistent, FillDrawList only rewrites the entries of objects flagged here
+static struct
+{
+    // all arrays below are indexed by dense scene index and resized on a structure rebuild
+    bool structureDirty = true;                 // objects added/removed or a type changed: rebuild the whole static segment
+    std::vector<bool> objectDirty;              // transform/pipeline/mesh edit: rewrite just this object's entry
+    std::vector<int> dirtyList;
+    std::vector<int> drawSlot;                  // draw list slot of each scene object, -1 if it is not drawn
+    int staticCount = 0;                        // the bot segment starts after this
+
+    // frustum culling: everything but heightfields and skies goes in the BVH, those two are always submitted
+    BVH bvh;                                    // rebuilt with the static segment, refit on per-object edits
+    std::vector<AABB> worldBounds;
+    std::vector<uint32_t> visibleIds;           // cull output (also the build input scratch)
+    std::vector<int> groundSlots;               // heightfields, submitted first
+    std::vector<int> skySlots;                  // sky spheres, submitted last for the alpha blend
+    int cullableCount = 0;
+
+    // stats (shown in Debug Controls)
+    int staticRewrittenLastFrame = 0;
+    int botRewrittenLastFrame = 0;
+    int fullRebuilds = 0;
+    int culledLastFrame = 0;
+    int submittedLastFrame = 0;
+    int nodesVisitedLastFrame = 0;
+} g_static_draw;
+
+// world / inverse world matrix of every scene object by dense index, read by the draw list, the ground probe and the
+// gizmo. flagged by the same two functions as the draw list, brought up to date by SyncSceneTransforms
+static TransformCache g_scene_transforms;
+
+void SyncSceneTransforms()
+{
+    TransformCacheSync(g_scene_transforms, g_scene.objectCount, g_scene.pos.data(), g_scene.rot.data(), g_scene.scale.data());
+}
+
+void MarkSceneObjectDirty(int i)
+{
+    TransformCacheMarkDirty(g_scene_transforms, i);
+    // objects past the end were added since the last rebuild, which already flagged a structure change
+    if (i < 0 || i >= (int)g_static_draw.objectDirty.size() || g_static_draw.objectDirty[i])
+        return;
+    g_static_draw.objectDirty[i] = true;
+    g_static_draw.dirtyList.push_back(i);
+}
+
+void MarkSceneStructureDirty()
+{
+    g_static_draw.structureDirty = true;
+    TransformCacheMarkAllDirty(g_scene_transforms);
+}
+
 enum PatrolMode
 {
     PATROL_WRAP,              // wraps around to index 0, so a bot with 3 patrol points will travel in a triangle pattern
@@ -125,7 +205,7 @@ struct HeightmapDataCPU
 
 static HeightmapDataCPU g_heightmapDataCPU = {};
 
-float SampleHeightmapWorldY(const SceneObject &obj, const DirectX::XMFLOAT3 &worldPos)
+float SampleHeightmapWorldY(const ObjectTransform &obj, const DirectX::XMFLOAT3 &worldPos)
 {
     HeightmapDataCPU cpu = g_heightmapDataCPU;
     if (!cpu.data)
@@ -181,7 +261,7 @@ float SampleHeightmapWorldY(const SceneObject &obj, const DirectX::XMFLOAT3 &wor
 #define MAX_BOT_OBJECTS 1024
 static BotObject g_bot_objects[MAX_BOT_OBJECTS] = {}; // TODO: This structure is runtime only, this data is store on file, perhaps the scene.json
 
-static UINT g_heightfieldIndex = 0; // the heightfield index into the objects in the scene
+static SceneHandle g_heightfield = SCENE_HANDLE_NULL; // the (first) heightfield in the scene, found on load
 
 void UpdateBots(float deltaTime)
 {
@@ -218,7 +298,8 @@ void UpdateBots(float deltaTime)
 
             // todo: separate out heightmaps from rest of environment
             const float GRAVITY = 15.0f;                                                                // units per second squared
-            const float GROUND_Y = SampleHeightmapWorldY(g_scene.objects[g_heightfieldIndex], bot.pos); // hardcoded object index 0 is the heightmap
+            int heightfieldIndex = SceneResolve(g_scene, g_heightfield);
+            const float GROUND_Y = heightfieldIndex >= 0 ? SampleHeightmapWorldY(SceneGetTransform(g_scene, heightfieldIndex), bot.pos) : 0.0f;
 
             // Apply gravity to vertical velocity
             bot.velocity.y -= GRAVITY * deltaTime;
@@ -352,31 +433,258 @@ static struct
     float radius = 0.15f;
 } g_player_bounds;
 
-void write_scene()
+// editor saves. the main thread only copies the scene into a snapshot, a worker thread serialises it, writes
+// scene.json.tmp and renames it over scene.json (so a crash mid write never leaves a half written scene).
+// edits are coalesced until the editor has been quiet for EditorSettings.autosave_delay_ms, a long gizmo drag
+// still gets saved every SCENE_SAVE_MAX_WAIT_FACTOR delays
+#define SCENE_SAVE_PATH "scene.json"
+#define SCENE_SAVE_TEMP_PATH "scene.json.tmp"
+#define SCENE_SAVE_MAX_WAIT_FACTOR 8
+
+static struct
 {
-    char *json = scene_to_json(&g_scene);
+    SDL_Thread *thread = nullptr;
+    SDL_Mutex *mutex = nullptr;
+    SDL_Condition *wake = nullptr;
+
+    // main thread only
+    bool dirty = false;
+    Uint64 firstEditCounter = 0; // oldest edit not handed to the worker yet
+    Uint64 lastEditCounter = 0;
+    int requests = 0;
+    double snapshotMs = 0.0;
+
+    // guarded by mutex
+    bool quit = false;
+    Scene snapshot;
+    bool snapshotReady = false;
+    Uint64 snapshotEditCounter = 0;
+    double lastLatencyMs = 0.0; // first coalesced edit -> rename done
+    double lastWriteMs = 0.0;   // serialise + write + rename on the worker
+    size_t lastBytes = 0;
+    size_t totalBytes = 0;
+    int saves = 0;
+    int failedSaves = 0;
+} g_scene_save;
+
+static bool WriteSceneFile(const Scene &scene, size_t *bytesWritten)
+{
+    *bytesWritten = 0;
+    char *json = scene_to_json(&scene);
     if (!json)
-        return;
+        return false;
 
-    SDL_IOStream *file = SDL_IOFromFile("scene.json", "wb");
+    size_t len = SDL_strlen(json);
+    bool ok = false;
+    SDL_IOStream *file = SDL_IOFromFile(SCENE_SAVE_TEMP_PATH, "wb");
     if (file)
     {
-        SDL_WriteIO(file, json, SDL_strlen(json));
-        SDL_CloseIO(file);
+        ok = SDL_WriteIO(file, json, len) == len;
+        ok = SDL_CloseIO(file) && ok; // close flushes, a failed flush is a failed save
     }
-
     cJSON_free(json); // cJSON provides its own free function
+
+    if (ok)
+        ok = SDL_RenamePath(SCENE_SAVE_TEMP_PATH, SCENE_SAVE_PATH);
+    if (!ok)
+        SDL_Log("Failed to save %s: %s", SCENE_SAVE_PATH, SDL_GetError());
+    else
+        *bytesWritten = len;
+    return ok;
 }
 
-void read_scene()
+static int SDLCALL SceneSaveThread(void *)
+{
+    Scene scene; // swapped with the snapshot, so after the first save neither side reallocates
+    SDL_LockMutex(g_scene_save.mutex);
+    for (;;)
+    {
+        while (!g_scene_save.snapshotReady && !g_scene_save.quit)
+            SDL_WaitCondition(g_scene_save.wake, g_scene_save.mutex);
+        if (!g_scene_save.snapshotReady)
+            break; // quit, nothing left to write
+
+        std::swap(scene, g_scene_save.snapshot);
+        Uint64 editCounter = g_scene_save.snapshotEditCounter;
+        g_scene_save.snapshotReady = false;
+        SDL_UnlockMutex(g_scene_save.mutex);
+
+        Uint64 writeStart = SDL_GetPerformanceCounter();
+        size_t bytes = 0;
+        bool ok = WriteSceneFile(scene, &bytes);
+        Uint64 writeEnd = SDL_GetPerformanceCounter();
+
+        SDL_LockMutex(g_scene_save.mutex);
+        if (ok)
+        {
+            g_scene_save.lastLatencyMs = CountsToMs(writeEnd - editCounter);
+            g_scene_save.lastWriteMs = CountsToMs(writeEnd - writeStart);
+            g_scene_save.lastBytes = bytes;
+            g_scene_save.totalBytes += bytes;
+            g_scene_save.saves++;
+        }
+        else
+            g_scene_save.failedSaves++;
+    }
+    SDL_UnlockMutex(g_scene_save.mutex);
+    return 0;
+}
+
+void StartSceneSaveService()
+{
+    g_scene_save.mutex = SDL_CreateMutex();
+    g_scene_save.wake = SDL_CreateCondition();
+    if (g_scene_save.mutex && g_scene_save.wake)
+        g_scene_save.thread = SDL_CreateThread(SceneSaveThread, "scene save", nullptr);
+    if (!g_scene_save.thread)
+        log_sdl_error("Couldn't start the scene save thread, saving on the main thread");
+}
+
+// hands the current scene to the worker, any snapshot it has not picked up yet is replaced
+static void SubmitSceneSnapshot()
+{
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (!g_scene_save.thread)
+    {
+        size_t bytes = 0;
+        if (WriteSceneFile(g_scene, &bytes))
+        {
+            g_scene_save.lastLatencyMs = CountsToMs(SDL_GetPerformanceCounter() - g_scene_save.firstEditCounter);
+            g_scene_save.lastBytes = bytes;
+            g_scene_save.totalBytes += bytes;
+            g_scene_save.saves++;
+        }
+        else
+            g_scene_save.failedSaves++;
+    }
+    else
+    {
+        SDL_LockMutex(g_scene_save.mutex); // the worker only holds it for a swap, never while writing
+        g_scene_save.snapshot = g_scene;
+        g_scene_save.snapshotReady = true;
+        g_scene_save.snapshotEditCounter = g_scene_save.firstEditCounter;
+        SDL_SignalCondition(g_scene_save.wake);
+        SDL_UnlockMutex(g_scene_save.mutex);
+    }
+    g_scene_save.snapshotMs = CountsToMs(SDL_GetPerformanceCounter() - start);
+    g_scene_save.dirty = false;
+}
+
+// call whenever the editor changed something that goes into scene.json, it is cheap
+void RequestSceneSave()
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (!g_scene_save.dirty)
+        g_scene_save.firstEditCounter = now;
+    g_scene_save.dirty = true;
+    g_scene_save.lastEditCounter = now;
+    g_scene_save.requests++;
+}
+
+static UndoJournal g_undo;
+
+static void OnUndoTouched(int i, SceneField field)
+{
+    // prefab edits (i < 0) reach every instance, objects coming and going (i < 0 too) and switching an object's prefab
+    // can change what is drawn and so move things between draw list segments
+    if (i < 0 || field == SCENE_FIELD_PREFAB)
+        MarkSceneStructureDirty();
+    else
+        MarkSceneObjectDirty(i);
+}
+
+void EditorUndo(bool redo)
+{
+    if (UndoStep(g_undo, g_scene, redo, OnUndoTouched))
+        RequestSceneSave();
+}
+
+// once a frame
+void UpdateSceneSave()
+{
+    if (!g_scene_save.dirty)
+        return;
+    Uint64 now = SDL_GetPerformanceCounter();
+    double delayMs = (double)SDL_max(g_liveConfigData.EditorSettings.autosave_delay_ms, 0);
+    bool quiet = CountsToMs(now - g_scene_save.lastEditCounter) >= delayMs;
+    bool waitedTooLong = CountsToMs(now - g_scene_save.firstEditCounter) >= delayMs * SCENE_SAVE_MAX_WAIT_FACTOR;
+    if (quiet || waitedTooLong)
+        SubmitSceneSnapshot();
+}
+
+// writes whatever is still pending and joins the worker
+void StopSceneSaveService()
+{
+    if (g_scene_save.dirty)
+        SubmitSceneSnapshot();
+    if (g_scene_save.thread)
+    {
+        SDL_LockMutex(g_scene_save.mutex);
+        g_scene_save.quit = true;
+        SDL_SignalCondition(g_scene_save.wake);
+        SDL_UnlockMutex(g_scene_save.mutex);
+        SDL_WaitThread(g_scene_save.thread, nullptr);
+        g_scene_save.thread = nullptr;
+    }
+    SDL_DestroyCondition(g_scene_save.wake);
+    SDL_DestroyMutex(g_scene_save.mutex);
+}
+
+// .bin files go through the baked loader (meta_scene_bin.py), anything else through the streaming json reader.
+// scene_from_json (cJSON) reads the same files into the same Scene, it is kept for the load benchmark
+bool LoadSceneFile(const char *path, Scene *scene)
 {
     size_t size;
-    void *data = SDL_LoadFile("scene.json", &size);
+    void *data = SDL_LoadFile(path, &size);
     if (!data)
-        return;
+        return false;
 
-    scene_from_json((const char *)data, &g_scene);
+    size_t len = strlen(path);
+    bool isBin = len > 4 && strcmp(path + len - 4, ".bin") == 0;
+    int ok = isBin ? scene_from_bin(data, size, scene) : scene_from_json_stream((const char *)data, scene);
     SDL_free(data);
+    if (!ok)
+        SDL_Log("Failed to load scene from %s", path);
+    return ok != 0;
+}
+
+// scene.bin is baked from scene.json (build.py does it for release), it is only used while it is at least as new as
+// the json because editor saves only ever write the json
+bool SceneBinIsFresh()
+{
+    SDL_PathInfo binInfo, jsonInfo;
+    if (!SDL_GetPathInfo("scene.bin", &binInfo))
+        return false;
+    if (!SDL_GetPathInfo("scene.json", &jsonInfo))
+        return true;
+    return binInfo.modify_time >= jsonInfo.modify_time;
+}
+
+void read_scene()
+{
+    Uint64 loadStart = SDL_GetPerformanceCounter();
+    const char *loadedFrom = nullptr;
+    if (SceneBinIsFresh() && LoadSceneFile("scene.bin", &g_scene))
+        loadedFrom = "scene.bin";
+    else if (LoadSceneFile("scene.json", &g_scene))
+        loadedFrom = "scene.json";
+    if (!loadedFrom)
+        return;
+
+    g_scene_timings.sceneLoadMs = CountsToMs(SDL_GetPerformanceCounter() - loadStart);
+    g_scene_timings.sceneLoadedFrom = loadedFrom;
+    SDL_Log("Loaded %s: %d objects in %.2f ms", loadedFrom, g_scene.objectCount, g_scene_timings.sceneLoadMs);
+    MarkSceneStructureDirty();
+
+    g_heightfield = SCENE_HANDLE_NULL;
+    for (int i = 0; i < g_scene.objectCount; ++i)
+    {
+        if (SceneObjectPrefab(g_scene, i).objectType == OBJECT_HEIGHTFIELD)
+        {
+            g_heightfield = SceneHandleAt(g_scene, i);
+            break;
+        }
+    }
 }
 
 static struct
@@ -731,24 +1039,248 @@ struct FlyCamera
 // example for next pattern
 
 #define MAX_SKY_LAYER_OBJECTS 8
-const int g_draw_list_element_total = MAX_SCENE_OBJECTS + MAX_BOT_OBJECTS + MAX_SKY_LAYER_OBJECTS;
 
+// sized for the scene on every structure rebuild (static objects + bots + sky layers)
 static struct
 {
-    int drawAmount = g_draw_list_element_total; // this should not be greater than g_draw_list_element_total
-    ObjectType objectTypes[g_draw_list_element_total] = {};
-    PrimitiveType primitiveTypes[g_draw_list_element_total] = {};
-    UINT loadedModelIndex[g_draw_list_element_total] = {};
-    RenderPipeline pipelines[g_draw_list_element_total] = {};
-    UINT textureArrayIndices[g_draw_list_element_total] = {};
-    struct
-    {
-        DirectX::XMFLOAT3 pos[g_draw_list_element_total];
-        DirectX::XMFLOAT4 rot[g_draw_list_element_total];
-        DirectX::XMFLOAT3 scale[g_draw_list_element_total];
-    } transforms;
+    int capacity = 0;
+    int drawAmount = 0;                          // this should not be greater than capacity
+    std::vector<uint32_t> submitSlots;           // entries that survived culling, in submission order (sorted, see draw_sort.h)
+    int submitCount = 0;
+    std::vector<ObjectType> objectTypes;
+    std::vector<PrimitiveType> primitiveTypes;
+    std::vector<UINT> loadedModelIndex;
+    std::vector<RenderPipeline> pipelines;
+    std::vector<UINT> textureArrayIndices;
+    std::vector<DirectX::XMFLOAT4X4> world; // already transposed for the shader, copied straight into the root constants
+    std::vector<UINT> instanceCount;        // 0: a plain draw using world. otherwise an instanced one, see g_draw_instances
+    std::vector<UINT> instanceFirst;
+    std::vector<uint8_t> lods;              // level of detail, picked per frame for static and bot entries (see g_draw_lod)
+    // derived by FinishDrawEntry
+    std::vector<uint32_t> meshIds;          // what gets bound, see DRAW_MESH_*
+    std::vector<BlendMode> blendModes;
+    std::vector<uint32_t> pipelineIds;      // pipelines * BLEND_COUNT + blendModes, what the recording binds
+    std::vector<uint64_t> sortKeys;         // state part of the sort key, the depth is added per frame
 } g_draw_list;
 
+// world matrices of the instanced draw list entries, packed per batch and copied into the frame's instance buffer by
+// PopulateCommandList. the bots first (one instanced draw per bot model), then the visible static batches
+static struct
+{
+    std::vector<DirectX::XMFLOAT4X4> world; // transposed like g_draw_list.world, grows with the frame's draws
+    int count = 0;      // instanced, from FillDrawList
+    int frameCount = 0; // + the plain draws' matrices RecordSceneCommands appends, what gets uploaded
+
+    // bot segment scratch, batched by model and level of detail (model * DRAW_LOD_MAX_LEVELS + lod)
+    std::vector<DirectX::XMFLOAT4X4> botWorld;
+    std::vector<uint32_t> botModel;
+    std::vector<uint32_t> modelCounts; // by key, sized to the loaded models
+    std::vector<InstanceBatch> batches;
+    int batchCount = 0;
+} g_draw_instances;
+
+// static entries with the same state key (mesh, pipeline, blend, texture) grouped into batches. the grouping is kept
+// until a structure rebuild or an edit that changes an entry's state, every frame the visible members of each batch
+// get their matrices gathered into g_draw_instances and one instanced draw list entry
+static struct
+{
+    bool enabled = true;
+    bool dirty = true;
+    std::vector<uint32_t> batchOf;   // by static draw slot, only valid for cullable entries
+    int batchCount = 0;
+    int sharedCount = 0;             // batches with more than one member
+
+    // rebuild scratch
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> slots;
+    std::vector<uint64_t> tmpKeys;
+    std::vector<uint32_t> tmpSlots;
+
+    // per frame, by batch id * DRAW_LOD_MAX_LEVELS + lod (members at different levels are drawn separately).
+    // visibleCount is back to 0 after every gather
+    std::vector<uint32_t> visibleCount;
+    std::vector<uint32_t> firstSlot; // some visible member, the batch entry copies its state
+    std::vector<uint32_t> cursor;    // into g_draw_instances.world, UINT32_MAX when drawn one by one
+    std::vector<uint32_t> touched;
+
+    // stats (shown in Debug Controls)
+    int rebuilds = 0;
+    int instancedDraws = 0;
+    int instances = 0;
+    int singleDraws = 0;
+    double gatherMs = 0.0;
+} g_static_batches;
+
+// mesh ids of draw list entries (the mesh field of the sort key): the primitives, the heightfield, then loaded models,
+// all at LOD 0. the coarser levels repeat that DRAW_MESH_LOD_STRIDE further up per level. the model slots grow with the
+// models loaded (DrawMeshFitModels), up to what the 16 bit mesh field holds
+#define DRAW_MESH_HEIGHTFIELD PRIMITIVE_COUNT
+#define DRAW_MESH_FIRST_MODEL (PRIMITIVE_COUNT + 1)
+#define DRAW_MESH_MAX_MODELS (0xFFFF / DRAW_LOD_MAX_LEVELS - DRAW_MESH_FIRST_MODEL)
+#define DRAW_MESH_LOD_STRIDE (DRAW_MESH_FIRST_MODEL + g_drawMeshModelSlots)
+static uint32_t g_drawMeshModelSlots = 64;
+static_assert(RENDER_COUNT <= 16 && BLEND_COUNT <= 4, "widen the pipeline/blend fields in draw_sort.h");
+static_assert(DRAW_MESH_MAX_MODELS >= 64, "widen the mesh field in draw_sort.h");
+static_assert(PRIMITIVE_MAX_LODS <= DRAW_LOD_MAX_LEVELS && MODEL_MAX_LODS <= DRAW_LOD_MAX_LEVELS, "raise DRAW_LOD_MAX_LEVELS");
+
+// room in the mesh ids for every loaded model, doubling so the ids only move when the loads cross a power of two. the
+// draw list's mesh ids are stale after they move, callers follow with MarkSceneStructureDirty
+static void DrawMeshFitModels()
+{
+    while (g_drawMeshModelSlots < g_engine.graphics_resources.m_models.size() && g_drawMeshModelSlots < (uint32_t)DRAW_MESH_MAX_MODELS)
+        g_drawMeshModelSlots *= 2;
+    if (g_drawMeshModelSlots > (uint32_t)DRAW_MESH_MAX_MODELS)
+        g_drawMeshModelSlots = DRAW_MESH_MAX_MODELS;
+}
+
+// level of detail selection (see draw_lod.h), stats shown in Debug Controls
+static struct
+{
+    bool enabled = true;
+    float thresholds[DRAW_LOD_MAX_LEVELS - 1] = {0.15f, 0.05f, 0.02f};
+    float hysteresis = 0.15f;
+    std::vector<uint8_t> botLods; // MAX_BOT_OBJECTS, last frame's
+
+    // last frame
+    int changes = 0;
+    int perLevel[DRAW_LOD_MAX_LEVELS] = {}; // visible static objects and bots
+    uint64_t triangles = 0;                 // submitted by the scene pass
+    uint64_t fullTriangles = 0;             // the same draws all at LOD 0
+    double selectMs = 0.0;
+} g_draw_lod;
+
+// draw order and redundant state filtering, stats shown in Debug Controls
+static struct
+{
+    bool sortEnabled = true; // off: heightfields, visible static, bots, skies (the old order), still filtered
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> tmpKeys;
+    std::vector<uint32_t> tmpSlots;
+    double sortMs = 0.0;
+
+    // last frame. naiveCalls is what binding everything for every draw took (models set their constants twice)
+    int draws = 0;
+    int apiCalls = 0;
+    int naiveCalls = 0;
+    int pipelineBinds = 0;
+    int meshBinds = 0;
+
+    // indirect submission: the draws compacted into ExecuteIndirect records, one ExecuteIndirect per pipeline run
+    bool indirect = false;
+    std::vector<IndirectDrawInput> indirectInputs;
+    std::vector<IndirectMeshViews> indirectMeshes; // by draw mesh id
+    int indirectRecords = 0;
+    int indirectBuckets = 0;
+} g_draw_submit;
+
+void ReserveDrawList(int capacity)
+{
+    if (capacity <= g_draw_list.capacity)
+        return;
+    g_draw_list.capacity = capacity;
+    g_draw_list.submitSlots.resize(capacity);
+    g_draw_list.objectTypes.resize(capacity);
+    g_draw_list.primitiveTypes.resize(capacity);
+    g_draw_list.loadedModelIndex.resize(capacity);
+    g_draw_list.pipelines.resize(capacity);
+    g_draw_list.textureArrayIndices.resize(capacity);
+    g_draw_list.world.resize(capacity);
+    g_draw_list.instanceCount.resize(capacity);
+    g_draw_list.instanceFirst.resize(capacity);
+    g_draw_list.lods.resize(capacity);
+    g_draw_list.meshIds.resize(capacity);
+    g_draw_list.blendModes.resize(capacity);
+    g_draw_list.pipelineIds.resize(capacity);
+    g_draw_list.sortKeys.resize(capacity);
+    g_draw_submit.keys.resize(capacity);
+    g_draw_submit.tmpKeys.resize(capacity);
+    g_draw_submit.tmpSlots.resize(capacity);
+}
+
+// levels of detail a LOD 0 mesh id has, 0 for a model slot nothing was loaded into
+UINT DrawMeshLodCount(uint32_t mesh)
+{
+    if (mesh == DRAW_MESH_HEIGHTFIELD)
+        return 1;
+    if (mesh >= DRAW_MESH_FIRST_MODEL)
+    {
+        const std::vector<ModelResources> &models = g_engine.graphics_resources.m_models;
+        return mesh - DRAW_MESH_FIRST_MODEL < models.size() ? models[mesh - DRAW_MESH_FIRST_MODEL].lodCount : 0;
+    }
+    return kPrimitiveLodCount[mesh];
+}
+
+// derives the bound mesh, blend mode and sort key state of a draw list entry from its other fields
+void FinishDrawEntry(int slot)
+{
+    ObjectType objectType = g_draw_list.objectTypes[slot];
+    uint32_t mesh = g_draw_list.primitiveTypes[slot];
+    if (objectType == OBJECT_HEIGHTFIELD)
+        mesh = DRAW_MESH_HEIGHTFIELD;
+    else if (objectType == OBJECT_LOADED_MODEL)
+        mesh = DRAW_MESH_FIRST_MODEL + g_draw_list.loadedModelIndex[slot];
+    UINT lod = g_draw_list.lods[slot];
+    UINT lodCount = SDL_max(DrawMeshLodCount(mesh), 1u); // a model that didn't load stays on level 0, drawn as nothing
+    mesh += (lod < lodCount ? lod : lodCount - 1) * DRAW_MESH_LOD_STRIDE;
+
+    bool enableAlphaForSky = true; // TODO: make this per object
+    BlendMode blend = (objectType == ObjectType::OBJECT_SKY_SPHERE && enableAlphaForSky) ? BLEND_ALPHA : BLEND_OPAQUE;
+
+    g_draw_list.meshIds[slot] = mesh;
+    g_draw_list.blendModes[slot] = blend;
+    g_draw_list.pipelineIds[slot] = g_draw_list.pipelines[slot] * BLEND_COUNT + blend;
+    g_draw_list.sortKeys[slot] = DrawKeyState(blend == BLEND_ALPHA ? DRAW_PASS_ALPHA : DRAW_PASS_OPAQUE,
+                                              g_draw_list.pipelines[slot], blend, mesh, g_draw_list.textureArrayIndices[slot]);
+}
+
+struct DrawMesh
+{
+    const D3D12_VERTEX_BUFFER_VIEW *vertexView;
+    const D3D12_INDEX_BUFFER_VIEW *indexView;
+    UINT indexCount;
+};
+
+DrawMesh GetDrawMesh(uint32_t mesh)
+{
+    GraphicsResources &res = g_engine.graphics_resources;
+    uint32_t lod = mesh / DRAW_MESH_LOD_STRIDE;
+    mesh %= DRAW_MESH_LOD_STRIDE;
+    if (lod >= DrawMeshLodCount(mesh))
+        return {nullptr, nullptr, 0}; // a level the mesh doesn't have, past the end of its views
+    if (mesh == DRAW_MESH_HEIGHTFIELD)
+        return {&res.m_heightfieldVertexView, &res.m_heightfieldIndexView, res.m_heightfieldIndexCount};
+    if (mesh >= DRAW_MESH_FIRST_MODEL)
+    {
+        const ModelResources &model = res.m_models[mesh - DRAW_MESH_FIRST_MODEL];
+        return {&model.vertexView, &model.indexViews[lod], model.indexCounts[lod]};
+    }
+    uint32_t slot = PRIMITIVE_LOD_SLOT(mesh, lod);
+    return {&res.m_vertexBufferView[slot], &res.m_indexBufferView[slot], res.m_indexCount[slot]};
+}
+
+// the buffers and index counts of every draw mesh id, what the recording reads (and the indirect records carry),
+// refreshed per recording since models load at runtime. ids without a mesh (levels a model doesn't have) get an index
+// count of 0
+void FillIndirectMeshTable()
+{
+    static_assert(sizeof(IndirectVertexBufferView) == sizeof(D3D12_VERTEX_BUFFER_VIEW) &&
+                      sizeof(IndirectIndexBufferView) == sizeof(D3D12_INDEX_BUFFER_VIEW),
+                  "indirect_draws.h views don't match the D3D12 ones");
+    g_draw_submit.indirectMeshes.resize(DRAW_MESH_LOD_STRIDE * DRAW_LOD_MAX_LEVELS);
+    for (uint32_t mesh = 0; mesh < (uint32_t)g_draw_submit.indirectMeshes.size(); ++mesh)
+    {
+        DrawMesh drawMesh = GetDrawMesh(mesh);
+        IndirectMeshViews &views = g_draw_submit.indirectMeshes[mesh];
+        views = {};
+        if (drawMesh.vertexView)
+        {
+            memcpy(&views.vertexView, drawMesh.vertexView, sizeof(views.vertexView));
+            memcpy(&views.indexView, drawMesh.indexView, sizeof(views.indexView));
+        }
+        views.indexCount = drawMesh.indexCount;
+    }
+}
+
 static struct
 {
     timing_state timing;
@@ -757,17 +1289,285 @@ static struct
     bool isRunning = true;
 } program_state;
 
-bool PopulateCommandList()
+// RCMD_SET_PIPELINE id of the wireframe debug pipeline, after the RenderPipeline ones
+#define DRAW_PIPELINE_WIREFRAME RENDER_COUNT
+
+// the scene pass of the last frame, see render_commands.h
+static struct
 {
-    g_engine.pipeline_dx12.ResetCommandObjects(g_engine.sync_state, g_engine.msaa_state);
+    RenderCommandStream stream;
+    double recordMs = 0.0;
+    double executeMs = 0.0;
+
+    // null backend benchmark: bots + draw list + recording, nothing submitted (Debug Controls)
+    int benchFrames = 100;
+    double benchUpdateMs = 0.0;
+    double benchFillMs = 0.0;
+    double benchRecordMs = 0.0;
+    uint32_t benchHash = 0;
+} g_frame_commands;
+
+static struct
+{
+    RenderGraph graph; // the last recorded frame's
+    double compileMs = 0.0;
+} g_scene_graph;
+
+// records the frame for the current draw list, see scene_commands.h. no D3D12 calls in here
+void RecordSceneCommands(RenderCommandStream &stream, bool msaa, bool indirect)
+{
+    static_assert(sizeof(SceneDrawConstants) == sizeof(PerDrawRootConstants), "scene_commands.h constants don't match the root constants");
+
+    Uint64 compileStart = SDL_GetPerformanceCounter();
+    RenderGraph &graph = g_scene_graph.graph;
+    SceneBuildGraph(graph, msaa);
+    if (!RenderGraphCompile(graph))
+        log_error("The scene graph doesn't compile");
+    g_scene_graph.compileMs = CountsToMs(SDL_GetPerformanceCounter() - compileStart);
+
+    FillIndirectMeshTable();
+    SceneDrawList list = {};
+    list.submitSlots = g_draw_list.submitSlots.data();
+    list.submitCount = g_draw_list.submitCount;
+    list.pipelineIds = g_draw_list.pipelineIds.data();
+    list.meshIds = g_draw_list.meshIds.data();
+    list.textureArrayIndices = g_draw_list.textureArrayIndices.data();
+    list.instanceCount = g_draw_list.instanceCount.data();
+    list.instanceFirst = g_draw_list.instanceFirst.data();
+    list.world = g_draw_list.world.data();
+    list.objectTypes = (const uint8_t *)g_draw_list.objectTypes.data(); // ObjectType is a uint8_t
+    list.loadedModelType = OBJECT_LOADED_MODEL;
+    list.blendCount = BLEND_COUNT;
+    list.meshes = g_draw_submit.indirectMeshes.data();
+    list.meshCount = (uint32_t)g_draw_submit.indirectMeshes.size();
+    list.meshLodStride = DRAW_MESH_LOD_STRIDE;
+
+    // Debug: draw player collision cylinder (wireframe)
+    DirectX::XMFLOAT4X4 cylinderWorld;
+    if (g_show_player_wireframe)
+    {
+        // Compute cylinder centre from current camera position
+        float yCentre = g_camera.position.y - g_player_bounds.eyeHeight + g_player_bounds.height * 0.5f;
+
+        // Unit cylinder (radius 0.5, height 1) → scale to match player
+        float scaleX = g_player_bounds.radius / 0.5f;
+        float scaleY = g_player_bounds.height / 1.0f;
+        float scaleZ = g_player_bounds.radius / 0.5f;
+
+        DirectX::XMMATRIX world = DirectX::XMMatrixScaling(scaleX, scaleY, scaleZ) *
+                                  DirectX::XMMatrixTranslation(g_camera.position.x, yCentre, g_camera.position.z);
+        DirectX::XMStoreFloat4x4(&cylinderWorld, DirectX::XMMatrixTranspose(world));
+        list.debugWorld = &cylinderWorld;
+        list.debugPipelineId = DRAW_PIPELINE_WIREFRAME * BLEND_COUNT + BLEND_OPAQUE;
+        list.debugMesh = PRIMITIVE_CYLINDER; // Use the existing cylinder mesh
+    }
 
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetGraphicsRootSignature(g_engine.pipeline_dx12.m_rootSignature);
+    // the instance buffer grows with the plain draws appended to it, the upload ring follows (see ReserveUploadRing)
+    SceneDrawFrame frame = {};
+    frame.worlds = &g_draw_instances.world;
+    frame.worldCount = g_draw_instances.count;
+    frame.indirectInputs = &g_draw_submit.indirectInputs;
+    SceneRecordCommands(stream, graph, msaa, list, indirect, frame);
+
+    g_draw_instances.frameCount = frame.worldCount;
+    g_draw_submit.draws = frame.draws;
+    g_draw_submit.apiCalls = frame.apiCalls;
+    g_draw_submit.naiveCalls = frame.naiveCalls;
+    g_draw_submit.pipelineBinds = frame.pipelineBinds;
+    g_draw_submit.meshBinds = frame.meshBinds;
+    g_draw_submit.indirectRecords = (int)stream.indirect.records.size();
+    g_draw_submit.indirectBuckets = (int)stream.indirect.buckets.size();
+    g_draw_lod.triangles = frame.triangles;
+    g_draw_lod.fullTriangles = frame.fullTriangles;
+}
+
+// imgui in the editor, the reticle otherwise. the one part of the frame recorded straight onto the command list
+void RecordOverlay(ID3D12GraphicsCommandList *cmdList)
+{
+    if (g_view_editor)
+    {
+        ImGui::Render();
+        ID3D12DescriptorHeap *imguiHeaps[] = {g_imguiHeap.Heap};
+        cmdList->SetDescriptorHeaps(_countof(imguiHeaps), imguiHeaps);
+        ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), cmdList);
+    }
+    else if (g_reticlePSO && g_reticleRootSig)
+    {
+        cmdList->SetPipelineState(g_reticlePSO);
+        cmdList->SetGraphicsRootSignature(g_reticleRootSig);
+        cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        cmdList->DrawInstanced(3, 1, 0, 0);
+    }
+}
+
+// per frame data goes through one ring in an upload heap (see upload_ring.h) instead of a fixed buffer per frame
+// index: it is retired by the fence value in SyncState::m_fenceValues of the frame that used it
+static UploadRing g_upload_ring;
+static struct
+{
+    uint64_t worldOffset = 0;    // this frame's world matrices in m_uploadRingBuffer
+    uint64_t indirectOffset = 0; // and its ExecuteIndirect records
+
+    // stats (shown in Debug Controls)
+    int stalls = 0; // allocations that had to wait for the GPU
+    double stallMs = 0.0;
+    int grows = 0; // times a frame outgrew the ring
+} g_upload_frame;
+
+// the D3D12 backend: plays a chunk of a recorded stream back onto cmdList for the current frame index and msaa state.
+// called from the recording workers too, it only reads the stream and g_engine
+void ExecuteRenderCommands(const RenderCommandStream &stream, const RenderCommandChunk &chunk, ID3D12GraphicsCommandList *cmdList)
+{
+    static const D3D12_RESOURCE_STATES states[RENDER_STATE_COUNT] = {
+        D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_RESOLVE_SOURCE, D3D12_RESOURCE_STATE_RESOLVE_DEST};
+
+    UINT frameIndex = g_engine.sync_state.m_frameIndex;
+    UINT psoIndex = g_engine.msaa_state.m_enabled ? g_engine.msaa_state.m_currentSampleIndex : 0;
+    ID3D12Resource *targets[RENDER_TARGET_COUNT] = {g_engine.pipeline_dx12.m_renderTargets[frameIndex], g_engine.pipeline_dx12.m_msaaRenderTargets[frameIndex]};
+    CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandles[RENDER_TARGET_COUNT] = {
+        CD3DX12_CPU_DESCRIPTOR_HANDLE(g_engine.pipeline_dx12.m_rtvHeap->GetCPUDescriptorHandleForHeapStart(), (INT)frameIndex, g_engine.pipeline_dx12.m_rtvDescriptorSize),
+        {}};
+    if (g_engine.msaa_state.m_enabled)
+        rtvHandles[RENDER_TARGET_MSAA] = CD3DX12_CPU_DESCRIPTOR_HANDLE(g_engine.pipeline_dx12.m_msaaRtvHeap->GetCPUDescriptorHandleForHeapStart(), (INT)frameIndex, g_engine.pipeline_dx12.m_rtvDescriptorSize);
+    CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle(g_engine.pipeline_dx12.m_dsvHeap->GetCPUDescriptorHandleForHeapStart());
+    if (g_engine.msaa_state.m_enabled)
+        dsvHandle.Offset(1, g_engine.pipeline_dx12.m_dsvDescriptorSize); // MSAA depth at index 1
+
+    bool depthBound = false;
+    bool pipelineValid = true; // draws are dropped while a missing pipeline is bound
+    D3D12_RESOURCE_BARRIER barriers[RENDER_TARGET_COUNT * 2];
+    UINT barrierCount = 0;
+    for (int r = -chunk.restoreCount; r < (int)(chunk.end - chunk.begin); ++r) // the chunk's restore commands, then its range
+    {
+        const RenderCommand &command = stream.commands[RenderCommandChunkAt(chunk, r)];
+        switch (command.type)
+        {
+        case RCMD_SET_PIPELINE:
+        {
+            ID3D12PipelineState *pso = command.a == DRAW_PIPELINE_WIREFRAME
+                                           ? g_engine.pipeline_dx12.m_wireframePSO[psoIndex]
+                                           : g_engine.pipeline_dx12.m_pipelineStates[command.a][command.b][psoIndex];
+            pipelineValid = pso != nullptr;
+            if (pipelineValid)
+                cmdList->SetPipelineState(pso);
+            else if (command.a != DRAW_PIPELINE_WIREFRAME)
+                SDL_Log("ERROR: PSO null for pipeline %u, msaa %u", command.a, psoIndex);
+            break;
+        }
+        case RCMD_SET_MESH:
+        {
+            DrawMesh drawMesh = GetDrawMesh(command.a);
+            cmdList->IASetVertexBuffers(0, 1, drawMesh.vertexView);
+            cmdList->IASetIndexBuffer(drawMesh.indexView);
+            break;
+        }
+        case RCMD_SET_CONSTANTS:
+            cmdList->SetGraphicsRoot32BitConstants(RootParameters::PER_DRAW_CONSTANTS, command.b, &stream.constants[command.a], 0);
+            break;
+        case RCMD_DRAW_INDEXED:
+            if (pipelineValid)
+                cmdList->DrawIndexedInstanced(command.a, command.b, 0, 0, 0);
+            break;
+        case RCMD_BARRIER:
+        {
+            // a run of barriers (a render graph batch) goes out with one call
+            barriers[barrierCount++] = CD3DX12_RESOURCE_BARRIER::Transition(targets[command.a], states[command.b], states[command.c]);
+            if (barrierCount == _countof(barriers) || RenderCommandsRunEnds(stream, chunk, r, RCMD_BARRIER))
+            {
+                cmdList->ResourceBarrier(barrierCount, barriers);
+                barrierCount = 0;
+            }
+            break;
+        }
+        case RCMD_SET_TARGET:
+            depthBound = command.b != 0;
+            cmdList->OMSetRenderTargets(1, &rtvHandles[command.a], FALSE, depthBound ? &dsvHandle : nullptr);
+            break;
+        case RCMD_CLEAR:
+            cmdList->ClearRenderTargetView(rtvHandles[command.a], g_rtClearValue.Color, 0, nullptr);
+            if (depthBound)
+                cmdList->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 0.0f, 0, 0, nullptr);
+            break;
+        case RCMD_RESOLVE:
+            cmdList->ResolveSubresource(targets[command.a], 0, targets[command.b], 0, DXGI_FORMAT_R8G8B8A8_UNORM);
+            break;
+        case RCMD_OVERLAY:
+            RecordOverlay(cmdList);
+            break;
+        case RCMD_EXECUTE_INDIRECT:
+            if (pipelineValid)
+                cmdList->ExecuteIndirect(g_engine.pipeline_dx12.m_drawCommandSignature, command.b, g_engine.graphics_resources.m_uploadRingBuffer,
+                                         g_upload_frame.indirectOffset + command.a * sizeof(IndirectDrawRecord), nullptr, 0);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// makes the ring big enough for g_FrameCount frames of frameBytes each (plus their alignment padding), so a frame with
+// more draws than ever before still gets all its data in. growing waits for the GPU to finish with the old buffer and
+// starts the ring over in a new one twice the size, so it has to happen before the frame's first UploadFrameData
+bool ReserveUploadRing(uint64_t frameBytes)
+{
+    uint64_t needed = g_FrameCount * (frameBytes + 2 * UPLOAD_RING_ALIGNMENT);
+    if (needed <= g_upload_ring.capacity)
+        return true;
+    uint64_t capacity = g_upload_ring.capacity;
+    while (capacity < needed)
+        capacity *= 2;
+
+    Uint64 stallStart = SDL_GetPerformanceCounter();
+    WaitForAllFrames();
+    if (!CreateUploadRingBuffer(capacity))
+    {
+        log_error("Couldn't grow the upload ring to fit the frame");
+        return false;
+    }
+    UploadRingInit(g_upload_ring, capacity);
+    g_upload_frame.grows++;
+    g_upload_frame.stallMs += CountsToMs(SDL_GetPerformanceCounter() - stallStart);
+    return true;
+}
+
+// copies bytes into the ring and returns their offset. when the GPU still holds too much of the ring, waits for the
+// oldest pending frame. false only when the data can never fit
+bool UploadFrameData(const void *data, uint64_t bytes, uint64_t &offset)
+{
+    UploadRingRetire(g_upload_ring, g_engine.sync_state.m_fence->GetCompletedValue());
+    offset = UploadRingAlloc(g_upload_ring, bytes);
+    while (offset == UPLOAD_RING_FULL && UploadRingOldestFence(g_upload_ring) != 0)
+    {
+        Uint64 stallStart = SDL_GetPerformanceCounter();
+        WaitForFenceValue(UploadRingOldestFence(g_upload_ring));
+        g_upload_frame.stalls++;
+        g_upload_frame.stallMs += CountsToMs(SDL_GetPerformanceCounter() - stallStart);
+        UploadRingRetire(g_upload_ring, g_engine.sync_state.m_fence->GetCompletedValue());
+        offset = UploadRingAlloc(g_upload_ring, bytes);
+    }
+    if (offset == UPLOAD_RING_FULL)
+    {
+        log_error("Frame data doesn't fit the upload ring");
+        offset = 0;
+        return false;
+    }
+    memcpy(g_engine.graphics_resources.m_pUploadRingBegin + offset, data, bytes);
+    return true;
+}
+
+// root signature, heaps, root arguments, viewport and topology. every command list of the frame starts with these
+void BindFrameState(ID3D12GraphicsCommandList *cmdList)
+{
+    cmdList->SetGraphicsRootSignature(g_engine.pipeline_dx12.m_rootSignature);
 
     ID3D12DescriptorHeap *ppHeaps[] = {g_engine.pipeline_dx12.m_mainHeap};
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
+    cmdList->SetDescriptorHeaps(_countof(ppHeaps), ppHeaps);
 
     D3D12_GPU_VIRTUAL_ADDRESS cbvAddress = g_engine.graphics_resources.m_PerFrameConstantBuffer[g_engine.sync_state.m_frameIndex]->GetGPUVirtualAddress();
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetGraphicsRootConstantBufferView(RootParameters::PER_FRAME_CBV, cbvAddress);
+    cmdList->SetGraphicsRootConstantBufferView(RootParameters::PER_FRAME_CBV, cbvAddress);
+
+    D3D12_GPU_VIRTUAL_ADDRESS worldAddress = g_engine.graphics_resources.m_uploadRingBuffer->GetGPUVirtualAddress() + g_upload_frame.worldOffset;
+    cmdList->SetGraphicsRootShaderResourceView(RootParameters::INSTANCE_SRV, worldAddress);
 
     // Set per - scene CBV(root parameter 2 - descriptor table)
     UINT descriptorSize = g_engine.pipeline_dx12.m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
@@ -776,286 +1576,801 @@ bool PopulateCommandList()
         g_engine.pipeline_dx12.m_mainHeap->GetGPUDescriptorHandleForHeapStart(),
         DescriptorIndices::PER_SCENE_CBV, // Per-scene CBV is after all per-frame CBVs
         descriptorSize);
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetGraphicsRootDescriptorTable(RootParameters::PER_SCENE_DESC_TABLE, perSceneCbvHandle);
+    cmdList->SetGraphicsRootDescriptorTable(RootParameters::PER_SCENE_DESC_TABLE, perSceneCbvHandle);
 
     // texture handle
     CD3DX12_GPU_DESCRIPTOR_HANDLE srvHandle(
         g_engine.pipeline_dx12.m_mainHeap->GetGPUDescriptorHandleForHeapStart(),
         DescriptorIndices::TEXTURE_SRV, // SRV is after all CBVs
         descriptorSize);
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetGraphicsRootDescriptorTable(RootParameters::SRV_DESC_TABLE, srvHandle);
+    cmdList->SetGraphicsRootDescriptorTable(RootParameters::SRV_DESC_TABLE, srvHandle);
 
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->RSSetViewports(1, &g_engine.pipeline_dx12.m_viewport);
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->RSSetScissorRects(1, &g_engine.pipeline_dx12.m_scissorRect);
+    cmdList->RSSetViewports(1, &g_engine.pipeline_dx12.m_viewport);
+    cmdList->RSSetScissorRects(1, &g_engine.pipeline_dx12.m_scissorRect);
+    cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
 
-    // Choose RTV and DSV based on MSAA state
-    CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHandle;
-    CD3DX12_CPU_DESCRIPTOR_HANDLE dsvHandle;
-    ID3D12Resource *renderTarget = nullptr;
+// parallel playback of the scene pass: the stream is cut into chunks (RenderCommandsPlanChunks) and each chunk is
+// played back into its own command list, chunk 0 into the frame's main list. workers take every chunk but the last,
+// the main thread takes the last one since it holds the overlay (imgui isn't thread safe). submitted in chunk order
+static struct
+{
+    bool enabled = true;
+    int minDrawsPerChunk = 512; // below this a chunk costs more in list setup than it saves
+
+    int workerCount = 0;
+    SDL_Thread *threads[MAX_RECORD_CHUNKS - 1] = {};
+    SDL_Semaphore *start[MAX_RECORD_CHUNKS - 1] = {};
+    SDL_Semaphore *done = nullptr;
+    bool quit = false; // set before the starts are signalled
+
+    // this frame's job, written by the main thread before the starts are signalled
+    const RenderCommandStream *stream = nullptr;
+    RenderCommandChunk chunks[MAX_RECORD_CHUNKS];
+    ID3D12GraphicsCommandList *lists[MAX_RECORD_CHUNKS] = {};
+    bool closed[MAX_RECORD_CHUNKS] = {};
+    int chunkCount = 1;
+
+    // stats (shown in Debug Controls)
+    double chunkMs[MAX_RECORD_CHUNKS] = {};
+    double playbackMs = 0.0; // wall time, first chunk started to last chunk closed
+} g_record_workers;
+
+void RecordChunk(int c)
+{
+    Uint64 chunkStart = SDL_GetPerformanceCounter();
+    ID3D12GraphicsCommandList *cmdList = g_record_workers.lists[c];
+    BindFrameState(cmdList);
+    ExecuteRenderCommands(*g_record_workers.stream, g_record_workers.chunks[c], cmdList);
+    g_record_workers.closed[c] = HRAssert(cmdList->Close());
+    g_record_workers.chunkMs[c] = CountsToMs(SDL_GetPerformanceCounter() - chunkStart);
+}
 
-    if (g_engine.msaa_state.m_enabled)
+static int RecordWorkerThread(void *data)
+{
+    int worker = (int)(intptr_t)data;
+    for (;;)
     {
-        // MSAA path
-        rtvHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
-            g_engine.pipeline_dx12.m_msaaRtvHeap->GetCPUDescriptorHandleForHeapStart(),
-            (INT)g_engine.sync_state.m_frameIndex,
-            g_engine.pipeline_dx12.m_rtvDescriptorSize);
-        dsvHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
-            g_engine.pipeline_dx12.m_dsvHeap->GetCPUDescriptorHandleForHeapStart());
-        dsvHandle.Offset(1, g_engine.pipeline_dx12.m_dsvDescriptorSize); // MSAA depth at index 1
-        renderTarget = g_engine.pipeline_dx12.m_msaaRenderTargets[g_engine.sync_state.m_frameIndex];
+        SDL_WaitSemaphore(g_record_workers.start[worker]);
+        if (g_record_workers.quit)
+            return 0;
+        RecordChunk(worker);
+        SDL_SignalSemaphore(g_record_workers.done);
+    }
+}
 
-        // Back buffer starts in PRESENT state for MSAA
-        auto barrier1 = CD3DX12_RESOURCE_BARRIER::Transition(
-            g_engine.pipeline_dx12.m_renderTargets[g_engine.sync_state.m_frameIndex],
-            D3D12_RESOURCE_STATE_PRESENT,
-            D3D12_RESOURCE_STATE_RESOLVE_DEST);
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ResourceBarrier(1, &barrier1);
+void StartRecordWorkers()
+{
+    int workers = SDL_GetNumLogicalCPUCores() - 1;
+    workers = workers < 0 ? 0 : (workers > MAX_RECORD_CHUNKS - 1 ? MAX_RECORD_CHUNKS - 1 : workers);
+    g_record_workers.done = SDL_CreateSemaphore(0);
+    if (!g_record_workers.done)
+        workers = 0;
+    for (int w = 0; w < workers; ++w)
+    {
+        g_record_workers.start[w] = SDL_CreateSemaphore(0);
+        if (g_record_workers.start[w])
+            g_record_workers.threads[w] = SDL_CreateThread(RecordWorkerThread, "record worker", (void *)(intptr_t)w);
+        if (!g_record_workers.threads[w])
+        {
+            log_sdl_error("Couldn't start a command recording worker");
+            SDL_DestroySemaphore(g_record_workers.start[w]);
+            g_record_workers.start[w] = nullptr;
+            break;
+        }
+        g_record_workers.workerCount++;
+    }
+    SDL_Log("Command recording: %d workers", g_record_workers.workerCount);
+}
+
+void StopRecordWorkers()
+{
+    g_record_workers.quit = true;
+    for (int w = 0; w < g_record_workers.workerCount; ++w)
+    {
+        SDL_SignalSemaphore(g_record_workers.start[w]);
+        SDL_WaitThread(g_record_workers.threads[w], nullptr);
+        SDL_DestroySemaphore(g_record_workers.start[w]);
     }
+    g_record_workers.workerCount = 0;
+    SDL_DestroySemaphore(g_record_workers.done);
+}
+
+bool PopulateCommandList()
+{
+    g_engine.pipeline_dx12.ResetCommandObjects(g_engine.sync_state, g_engine.msaa_state);
+    RetireBindlessTextures();
+    UploadRetire();
+
+    // the scene pass goes through the command stream (see render_commands.h), this is the D3D12 backend playing it back
+    Uint64 recordStart = SDL_GetPerformanceCounter();
+    RecordSceneCommands(g_frame_commands.stream, g_engine.msaa_state.m_enabled, g_draw_submit.indirect);
+    Uint64 executeStart = SDL_GetPerformanceCounter();
+
+    // every draw's world matrix, into the upload ring
+    const IndirectDrawList &indirect = g_frame_commands.stream.indirect;
+    uint64_t worldBytes = g_draw_instances.frameCount * sizeof(DirectX::XMFLOAT4X4);
+    bool uploaded = ReserveUploadRing(worldBytes + indirect.records.size() * sizeof(IndirectDrawRecord));
+    uploaded &= UploadFrameData(g_draw_instances.world.data(), worldBytes, g_upload_frame.worldOffset);
+    if (!indirect.records.empty())
+        uploaded &= UploadFrameData(indirect.records.data(), indirect.records.size() * sizeof(IndirectDrawRecord), g_upload_frame.indirectOffset);
+
+    int chunkCount = 1;
+    if (g_record_workers.enabled)
+        chunkCount = RenderCommandsPlanChunks(g_frame_commands.stream, g_record_workers.workerCount + 1,
+                                              g_record_workers.minDrawsPerChunk, g_record_workers.chunks);
     else
+        RenderCommandsPlanChunks(g_frame_commands.stream, 1, 0, g_record_workers.chunks);
+
+    UINT frameIndex = g_engine.sync_state.m_frameIndex;
+    g_record_workers.stream = &g_frame_commands.stream;
+    g_record_workers.chunkCount = chunkCount;
+    g_record_workers.lists[0] = g_engine.pipeline_dx12.m_commandList[frameIndex];
+    for (int c = 1; c < chunkCount; ++c)
+    {
+        UINT chunkIndex = frameIndex * MAX_RECORD_CHUNKS + c;
+        HRAssert(g_engine.pipeline_dx12.m_chunkCommandAllocators[chunkIndex]->Reset());
+        HRAssert(g_engine.pipeline_dx12.m_chunkCommandLists[chunkIndex]->Reset(g_engine.pipeline_dx12.m_chunkCommandAllocators[chunkIndex], nullptr));
+        g_record_workers.lists[c] = g_engine.pipeline_dx12.m_chunkCommandLists[chunkIndex];
+    }
+
+    for (int c = 0; c + 1 < chunkCount; ++c)
+        SDL_SignalSemaphore(g_record_workers.start[c]);
+    RecordChunk(chunkCount - 1);
+    for (int c = 0; c + 1 < chunkCount; ++c)
+        SDL_WaitSemaphore(g_record_workers.done);
+
+    g_frame_commands.recordMs = CountsToMs(executeStart - recordStart);
+    g_frame_commands.executeMs = CountsToMs(SDL_GetPerformanceCounter() - executeStart);
+    g_record_workers.playbackMs = g_frame_commands.executeMs;
+
+    for (int c = 0; c < chunkCount; ++c)
+    {
+        if (!g_record_workers.closed[c])
+            return false;
+    }
+    return uploaded;
+}
+
+void Render(bool vsync = true)
+{
+    if (!PopulateCommandList())
+        log_error("A command failed to be populated");
+
+    ID3D12CommandList *ppCommandLists[MAX_RECORD_CHUNKS];
+    for (int c = 0; c < g_record_workers.chunkCount; ++c)
+        ppCommandLists[c] = g_record_workers.lists[c];
+    UploadFlush();
+    g_engine.pipeline_dx12.m_commandQueue->ExecuteCommandLists((UINT)g_record_workers.chunkCount, ppCommandLists);
+    UploadRingCloseFrame(g_upload_ring, g_engine.sync_state.m_fenceValues[g_engine.sync_state.m_frameIndex]); // MoveToNextFrame signals it
+
+    UINT syncInterval = (vsync) ? 1 : 0;
+    UINT syncFlags = (vsync) ? 0 : DXGI_PRESENT_ALLOW_TEARING;
+    HRAssert(g_engine.pipeline_dx12.m_swapChain->Present(syncInterval, syncFlags));
+}
+
+// writes the draw list entry for static scene object i into slot
+void WriteStaticDrawEntry(int slot, int i)
+{
+    const ScenePrefab &prefab = SceneObjectPrefab(g_scene, i);
+    ObjectType objectType = prefab.objectType;
+
+    g_draw_list.world[slot] = g_scene_transforms.gpuWorld[i]; // already transposed for the shader
+
+    g_draw_list.objectTypes[slot] = objectType;
+    g_draw_list.instanceCount[slot] = 0;
+
+    if (objectType == OBJECT_PRIMITIVE)
+    {
+        g_draw_list.primitiveTypes[slot] = prefab.primitiveType;
+        g_draw_list.textureArrayIndices[slot] = 0; // not read by the primitive pipelines, fixed so it doesn't split sort buckets
+    }
+    else if (objectType == OBJECT_HEIGHTFIELD)
     {
-        // Non-MSAA path
-        rtvHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
-            g_engine.pipeline_dx12.m_rtvHeap->GetCPUDescriptorHandleForHeapStart(),
-            (INT)g_engine.sync_state.m_frameIndex,
-            g_engine.pipeline_dx12.m_rtvDescriptorSize);
-        dsvHandle = CD3DX12_CPU_DESCRIPTOR_HANDLE(
-            g_engine.pipeline_dx12.m_dsvHeap->GetCPUDescriptorHandleForHeapStart()); // Non-MSAA depth at index 0
-        renderTarget = g_engine.pipeline_dx12.m_renderTargets[g_engine.sync_state.m_frameIndex];
+        g_draw_list.textureArrayIndices[slot] = prefab.textureIndex;
+    }
+    else if (objectType == OBJECT_SKY_SPHERE)
+    {
+        g_draw_list.primitiveTypes[slot] = PRIMITIVE_INVERTED_SPHERE;
+        g_draw_list.textureArrayIndices[slot] = prefab.textureIndex;
+    }
+    else if (objectType == OBJECT_LOADED_MODEL)
+    {
+        const std::vector<ModelResources> &models = g_engine.graphics_resources.m_models;
+        g_draw_list.loadedModelIndex[slot] = prefab.modelIndex;
+        g_draw_list.textureArrayIndices[slot] = prefab.modelIndex < models.size() ? models[prefab.modelIndex].textureIndex : 0;
+    }
+
+    g_draw_list.pipelines[slot] = prefab.pipeline;
+    FinishDrawEntry(slot);
+}
+
+// object space bounds of each primitive mesh, filled on first use
+static AABB g_primitiveLocalBounds[PRIMITIVE_COUNT];
+static bool g_primitiveLocalBoundsReady = false;
+
+void ComputePrimitiveLocalBounds()
+{
+    for (int p = 0; p < PRIMITIVE_COUNT; ++p)
+    {
+        AABB b = AABBEmpty();
+        for (UINT v = 0; v < kPrimitiveMeshData[p].vertexCount; ++v)
+        {
+            const DirectX::XMFLOAT3 &pos = kPrimitiveMeshData[p].vertices[v].position;
+            AABBGrow(b, {pos, pos});
+        }
+        g_primitiveLocalBounds[p] = b;
+    }
+    g_primitiveLocalBoundsReady = true;
+}
+
+// world space bounds of a cullable scene object (primitives and loaded models)
+AABB SceneObjectWorldBounds(int i)
+{
+    if (!g_primitiveLocalBoundsReady)
+        ComputePrimitiveLocalBounds();
+
+    const ScenePrefab &prefab = SceneObjectPrefab(g_scene, i);
+    AABB local = g_primitiveLocalBounds[prefab.primitiveType];
+    if (prefab.objectType == OBJECT_LOADED_MODEL && prefab.modelIndex < g_engine.graphics_resources.m_models.size())
+    {
+        const ModelResources &model = g_engine.graphics_resources.m_models[prefab.modelIndex];
+        local = {model.boundsMin, model.boundsMax};
+    }
+    return AABBTransform(local, g_scene_transforms.world[i]);
+}
+
+// TODO: update this function to group objects by rendering pipeline
+// regroups the cullable static entries by state key, a radix sort of the keys then one batch per run of equal keys
+void RebuildStaticBatches()
+{
+    int count = g_static_draw.cullableCount;
+    g_static_batches.keys.resize(count);
+    g_static_batches.slots.resize(count);
+    g_static_batches.tmpKeys.resize(count);
+    g_static_batches.tmpSlots.resize(count);
+    g_static_batches.batchOf.resize(g_static_draw.staticCount);
+    for (int c = 0; c < count; ++c)
+    {
+        // the BVH's item list, visibleIds only holds all of them until the first cull after a structure rebuild.
+        // grouped by their LOD 0 mesh, the level is split off per frame
+        uint32_t slot = (uint32_t)g_static_draw.drawSlot[g_static_draw.bvh.itemIds[c]];
+        g_static_batches.keys[c] = DrawKeyWithMesh(g_draw_list.sortKeys[slot], g_draw_list.meshIds[slot] % DRAW_MESH_LOD_STRIDE);
+        g_static_batches.slots[c] = slot;
+    }
+    DrawSortRadix(g_static_batches.keys.data(), g_static_batches.slots.data(), g_static_batches.tmpKeys.data(),
+                  g_static_batches.tmpSlots.data(), count);
+
+    int batchCount = 0;
+    int sharedCount = 0;
+    for (int c = 0; c < count; ++c)
+    {
+        if (c == 0 || g_static_batches.keys[c] != g_static_batches.keys[c - 1])
+            batchCount++;
+        else if (c == 1 || g_static_batches.keys[c - 1] != g_static_batches.keys[c - 2])
+            sharedCount++; // second member
+        g_static_batches.batchOf[g_static_batches.slots[c]] = batchCount - 1;
+    }
+
+    g_static_batches.batchCount = batchCount;
+    g_static_batches.sharedCount = sharedCount;
+    g_static_batches.visibleCount.assign(batchCount * DRAW_LOD_MAX_LEVELS, 0);
+    g_static_batches.firstSlot.resize(batchCount * DRAW_LOD_MAX_LEVELS);
+    g_static_batches.cursor.resize(batchCount * DRAW_LOD_MAX_LEVELS);
+    g_static_batches.touched.reserve(batchCount * DRAW_LOD_MAX_LEVELS);
+    g_static_batches.dirty = false;
+    g_static_batches.rebuilds++;
+}
+
+// submits the visible static entries (the cull output) as instanced draws, batches with a single visible member are
+// submitted as they are. the batch entries are appended to the
+// draw list from drawCount on, returns the new draw count
+int SubmitStaticInstanced(int visibleCount, int drawCount, int &submitCount)
+{
+    g_static_batches.touched.clear();
+    for (int v = 0; v < visibleCount; ++v)
+    {
+        uint32_t slot = (uint32_t)g_static_draw.drawSlot[g_static_draw.visibleIds[v]];
+        uint32_t batch = g_static_batches.batchOf[slot] * DRAW_LOD_MAX_LEVELS + g_draw_list.lods[slot];
+        if (g_static_batches.visibleCount[batch]++ == 0)
+        {
+            g_static_batches.touched.push_back(batch);
+            g_static_batches.firstSlot[batch] = slot;
+        }
+    }
+
+    int instanced = 0;
+    int instances = 0;
+    uint32_t instanceCount = (uint32_t)g_draw_instances.count;
+    if (g_draw_instances.world.size() < instanceCount + (size_t)visibleCount)
+        g_draw_instances.world.resize(instanceCount + (size_t)visibleCount);
+    for (uint32_t batch : g_static_batches.touched)
+    {
+        uint32_t n = g_static_batches.visibleCount[batch];
+        g_static_batches.cursor[batch] = UINT32_MAX;
+        if (n < 2)
+            continue;
+
+        // the batch entry shares the state of its members, only the instance range differs
+        uint32_t src = g_static_batches.firstSlot[batch];
+        g_draw_list.objectTypes[drawCount] = g_draw_list.objectTypes[src];
+        g_draw_list.primitiveTypes[drawCount] = g_draw_list.primitiveTypes[src];
+        g_draw_list.loadedModelIndex[drawCount] = g_draw_list.loadedModelIndex[src];
+        g_draw_list.pipelines[drawCount] = g_draw_list.pipelines[src];
+        g_draw_list.textureArrayIndices[drawCount] = g_draw_list.textureArrayIndices[src];
+        g_draw_list.world[drawCount] = g_draw_list.world[src]; // only the sort reads it
+        g_draw_list.instanceCount[drawCount] = n;
+        g_draw_list.instanceFirst[drawCount] = instanceCount;
+        g_draw_list.lods[drawCount] = g_draw_list.lods[src];
+        g_draw_list.meshIds[drawCount] = g_draw_list.meshIds[src];
+        g_draw_list.blendModes[drawCount] = g_draw_list.blendModes[src];
+        g_draw_list.pipelineIds[drawCount] = g_draw_list.pipelineIds[src];
+        g_draw_list.sortKeys[drawCount] = g_draw_list.sortKeys[src];
+        drawCount++;
+
+        g_static_batches.cursor[batch] = instanceCount;
+        instanceCount += n;
+        instanced++;
+        instances += n;
+    }
 
-        // Transition back buffer to RENDER_TARGET
-        auto barrier1 = CD3DX12_RESOURCE_BARRIER::Transition(
-            renderTarget,
-            D3D12_RESOURCE_STATE_PRESENT,
-            D3D12_RESOURCE_STATE_RENDER_TARGET);
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ResourceBarrier(1, &barrier1);
+    int single = 0;
+    for (int v = 0; v < visibleCount; ++v)
+    {
+        uint32_t slot = (uint32_t)g_static_draw.drawSlot[g_static_draw.visibleIds[v]];
+        uint32_t batch = g_static_batches.batchOf[slot] * DRAW_LOD_MAX_LEVELS + g_draw_list.lods[slot];
+        if (g_static_batches.cursor[batch] == UINT32_MAX)
+        {
+            g_draw_list.submitSlots[submitCount++] = slot;
+            single++;
+        }
+        else
+            g_draw_instances.world[g_static_batches.cursor[batch]++] = g_draw_list.world[slot];
     }
+    for (uint32_t batch : g_static_batches.touched)
+        g_static_batches.visibleCount[batch] = 0;
+
+    g_draw_instances.count = (int)instanceCount;
+    g_static_batches.instancedDraws = instanced;
+    g_static_batches.instances = instances;
+    g_static_batches.singleDraws = single;
+    return drawCount;
+}
 
-    // Common rendering operations
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ClearRenderTargetView(rtvHandle, g_rtClearValue.Color, 0, nullptr);
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ClearDepthStencilView(dsvHandle, D3D12_CLEAR_FLAG_DEPTH, 0.0f, 0, 0, nullptr);
+// occlusion culling of the frustum cull's output against a coarse software depth buffer (see occlusion_raster.h),
+// before the static batching. occluders are picked per frame: the cubes and cylinders that look biggest from the
+// camera, and the heightfield. the bands and the tests are spread over a few workers plus the main thread
+#define OCCLUSION_MAX_WORKERS (OCCLUSION_BANDS - 1)
+#define OCCLUSION_MAX_OCCLUDERS 128
+#define OCCLUSION_TEST_GROUP 256 // boxes per test job item
+#define OCCLUSION_TERRAIN_CELLS 32 // heightfield proxy grid, per side
 
-    // Draw geometry (same for both MSAA)
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+static struct
+{
+    bool enabled = true;
+    bool heightfield = true;
+    int maxOccluders = 32;
+    float minOccluderSize = 0.1f; // bounding radius over distance, smaller things don't hide enough to pay for themselves
+
+    OcclusionBuffer buffer;
+    uint32_t occluderSlots[OCCLUSION_MAX_OCCLUDERS]; // positions in visibleIds, biggest first
+    float occluderSizes[OCCLUSION_MAX_OCCLUDERS];
+    std::vector<uint8_t> visible; // by position in visibleIds, written by the tests
+
+    // heightfield proxy in object space, every vertex at or below the terrain around it so it never covers more than
+    // the terrain does. rebuilt when the heightmap changes
+    std::vector<DirectX::XMFLOAT3> terrainPositions;
+    std::vector<uint32_t> terrainIndices;
+    const UINT8 *terrainSource = nullptr;
+
+    // the current job goes to every worker and the main thread, which take items from next until jobCount is reached
+    int workerCount = 0;
+    SDL_Thread *threads[OCCLUSION_MAX_WORKERS] = {};
+    SDL_Semaphore *start[OCCLUSION_MAX_WORKERS] = {};
+    SDL_Semaphore *done = nullptr;
+    bool quit = false;
+    void (*job)(int item) = nullptr;
+    int jobCount = 0;
+    SDL_AtomicInt next = {};
+
+    // stats (shown in Debug Controls)
+    int occluders = 0;
+    int triangles = 0;
+    int tested = 0;
+    int culled = 0;
+    double rasterMs = 0.0;
+    double testMs = 0.0;
+} g_occlusion;
+
+static void OcclusionRunJobItems()
+{
+    for (int item = SDL_AddAtomicInt(&g_occlusion.next, 1); item < g_occlusion.jobCount; item = SDL_AddAtomicInt(&g_occlusion.next, 1))
+        g_occlusion.job(item);
+}
 
-    PerDrawRootConstants currentDrawConstants = {};
-    for (int i = 0; i < g_draw_list.drawAmount; ++i)
+static int OcclusionWorkerThread(void *data)
+{
+    int worker = (int)(intptr_t)data;
+    for (;;)
     {
-        ObjectType objectType = g_draw_list.objectTypes[i];
-        PrimitiveType currentPrimitiveToDraw = g_draw_list.primitiveTypes[i];
-        UINT loadedModelIndex = g_draw_list.loadedModelIndex[i];
-        RenderPipeline pl = g_draw_list.pipelines[i];
+        SDL_WaitSemaphore(g_occlusion.start[worker]);
+        if (g_occlusion.quit)
+            return 0;
+        OcclusionRunJobItems();
+        SDL_SignalSemaphore(g_occlusion.done);
+    }
+}
 
-        UINT psoIndex = g_engine.msaa_state.m_enabled ? g_engine.msaa_state.m_currentSampleIndex : 0;
-        bool enableAlphaForSky = true; // TODO: make this per object
-        UINT activeBlendMode = (objectType == ObjectType::OBJECT_SKY_SPHERE && enableAlphaForSky) ? BLEND_ALPHA : BLEND_OPAQUE;
-        ID3D12PipelineState *currentPSO = g_engine.pipeline_dx12.m_pipelineStates[pl][activeBlendMode][psoIndex];
-        if (!currentPSO)
-            SDL_Log("ERROR: PSO null for pipeline %d, msaa %d", pl, psoIndex);
+// runs job for items 0..count-1 on the workers and the main thread, returns when all of them are done
+static void OcclusionRunJob(void (*job)(int item), int count)
+{
+    g_occlusion.job = job;
+    g_occlusion.jobCount = count;
+    SDL_SetAtomicInt(&g_occlusion.next, 0);
+    int helpers = g_occlusion.workerCount < count - 1 ? g_occlusion.workerCount : count - 1;
+    for (int w = 0; w < helpers; ++w)
+        SDL_SignalSemaphore(g_occlusion.start[w]);
+    OcclusionRunJobItems();
+    for (int w = 0; w < helpers; ++w)
+        SDL_WaitSemaphore(g_occlusion.done);
+}
 
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetPipelineState(currentPSO);
+void StartOcclusionWorkers()
+{
+    int workers = SDL_GetNumLogicalCPUCores() - 1;
+    workers = workers < 0 ? 0 : (workers > OCCLUSION_MAX_WORKERS ? OCCLUSION_MAX_WORKERS : workers);
+    g_occlusion.done = SDL_CreateSemaphore(0);
+    if (!g_occlusion.done)
+        workers = 0;
+    for (int w = 0; w < workers; ++w)
+    {
+        g_occlusion.start[w] = SDL_CreateSemaphore(0);
+        if (g_occlusion.start[w])
+            g_occlusion.threads[w] = SDL_CreateThread(OcclusionWorkerThread, "occlusion worker", (void *)(intptr_t)w);
+        if (!g_occlusion.threads[w])
+        {
+            log_sdl_error("Couldn't start an occlusion culling worker");
+            SDL_DestroySemaphore(g_occlusion.start[w]);
+            g_occlusion.start[w] = nullptr;
+            break;
+        }
+        g_occlusion.workerCount++;
+    }
+    SDL_Log("Occlusion culling: %d workers", g_occlusion.workerCount);
+}
 
-        // Translation parameters
-        DirectX::XMVECTOR position = DirectX::XMLoadFloat3(&g_draw_list.transforms.pos[i]);
-        DirectX::XMVECTOR rotationQuat = DirectX::XMLoadFloat4(&g_draw_list.transforms.rot[i]);
-        DirectX::XMVECTOR scale = DirectX::XMLoadFloat3(&g_draw_list.transforms.scale[i]);
+void StopOcclusionWorkers()
+{
+    g_occlusion.quit = true;
+    for (int w = 0; w < g_occlusion.workerCount; ++w)
+    {
+        SDL_SignalSemaphore(g_occlusion.start[w]);
+        SDL_WaitThread(g_occlusion.threads[w], nullptr);
+        SDL_DestroySemaphore(g_occlusion.start[w]);
+    }
+    g_occlusion.workerCount = 0;
+    SDL_DestroySemaphore(g_occlusion.done);
+}
+
+// grid over the heightfield's [-0.5, 0.5] footprint, each vertex at the lowest texel of the cells around it (a texel
+// of margin for the GPU's bilinear filtering), so the proxy stays under the rendered surface everywhere
+void BuildTerrainOccluder(const HeightmapDataCPU &heightmap)
+{
+    const int n = OCCLUSION_TERRAIN_CELLS;
+    g_occlusion.terrainPositions.resize((n + 1) * (n + 1));
+    for (int j = 0; j <= n; ++j)
+    {
+        for (int i = 0; i <= n; ++i)
+        {
+            int tx0 = (int)floorf((float)(i - 1) / n * (heightmap.width - 1)) - 1;
+            int tx1 = (int)ceilf((float)(i + 1) / n * (heightmap.width - 1)) + 1;
+            int ty0 = (int)floorf((float)(j - 1) / n * (heightmap.height - 1)) - 1;
+            int ty1 = (int)ceilf((float)(j + 1) / n * (heightmap.height - 1)) + 1;
+            tx0 = tx0 < 0 ? 0 : tx0;
+            ty0 = ty0 < 0 ? 0 : ty0;
+            tx1 = tx1 > (int)heightmap.width - 1 ? (int)heightmap.width - 1 : tx1;
+            ty1 = ty1 > (int)heightmap.height - 1 ? (int)heightmap.height - 1 : ty1;
+            UINT8 lowest = 255;
+            for (int ty = ty0; ty <= ty1; ++ty)
+            {
+                for (int tx = tx0; tx <= tx1; ++tx)
+                    lowest = heightmap.data[ty * heightmap.width + tx] < lowest ? heightmap.data[ty * heightmap.width + tx] : lowest;
+            }
+            g_occlusion.terrainPositions[j * (n + 1) + i] = {-0.5f + (float)i / n, lowest / 255.0f, -0.5f + (float)j / n};
+        }
+    }
 
-        // Build transform: SCALE * ROTATION * TRANSLATION (for row-major/left-multiply in HLSL)
-        DirectX::XMMATRIX worldMatrix =
-            DirectX::XMMatrixScalingFromVector(scale) *
-            DirectX::XMMatrixRotationQuaternion(rotationQuat) * // rotation
-            DirectX::XMMatrixTranslationFromVector(position);   // translation
+    // same winding as CreateHeightfieldMesh, front faces up
+    g_occlusion.terrainIndices.clear();
+    for (int j = 0; j < n; ++j)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            uint32_t bl = j * (n + 1) + i, br = bl + 1, tl = bl + n + 1, tr = tl + 1;
+            for (uint32_t index : {bl, tl, br, br, tl, tr})
+                g_occlusion.terrainIndices.push_back(index);
+        }
+    }
+    g_occlusion.terrainSource = heightmap.data;
+}
+
+static void OcclusionRasterizeJob(int band)
+{
+    OcclusionRasterizeBand(g_occlusion.buffer, band);
+}
+
+static void OcclusionErodeJob(int band)
+{
+    OcclusionErodeBand(g_occlusion.buffer, band);
+}
 
-        DirectX::XMStoreFloat4x4(
-            &currentDrawConstants.world,
-            DirectX::XMMatrixTranspose(worldMatrix));
+static void OcclusionTestJob(int group)
+{
+    int end = (group + 1) * OCCLUSION_TEST_GROUP;
+    end = end < (int)g_occlusion.visible.size() ? end : (int)g_occlusion.visible.size();
+    for (int v = group * OCCLUSION_TEST_GROUP; v < end; ++v)
+    {
+        if (!g_occlusion.visible[v]) // occluders are already marked visible
+            g_occlusion.visible[v] = OcclusionTestAABB(g_occlusion.buffer, g_static_draw.worldBounds[g_static_draw.visibleIds[v]]);
+    }
+}
 
-        currentDrawConstants.textureArrayIndex = g_draw_list.textureArrayIndices[i];
+// drops the hidden ones from the first visibleCount entries of visibleIds (keeping their order), returns how many are left
+int OcclusionCull(int visibleCount)
+{
+    g_occlusion.occluders = 0;
+    g_occlusion.triangles = 0;
+    g_occlusion.tested = 0;
+    g_occlusion.culled = 0;
+    g_occlusion.rasterMs = 0.0;
+    g_occlusion.testMs = 0.0;
+    if (!g_occlusion.enabled || visibleCount == 0)
+        return visibleCount;
+
+    Uint64 rasterStart = SDL_GetPerformanceCounter();
+    OcclusionBegin(g_occlusion.buffer, DirectX::XMMatrixMultiply(g_camera.viewMatrix, g_camera.projectionMatrix));
+    DirectX::XMFLOAT3 eye;
+    DirectX::XMStoreFloat3(&eye, g_camera.eye);
+
+    // the biggest looking cubes and cylinders, kept sorted in a short list
+    int maxOccluders = g_occlusion.maxOccluders < OCCLUSION_MAX_OCCLUDERS ? g_occlusion.maxOccluders : OCCLUSION_MAX_OCCLUDERS;
+    int occluderCount = 0;
+    for (int v = 0; v < visibleCount && maxOccluders > 0; ++v)
+    {
+        uint32_t i = g_static_draw.visibleIds[v];
+        const ScenePrefab &prefab = SceneObjectPrefab(g_scene, i);
+        if (prefab.objectType != OBJECT_PRIMITIVE || (prefab.primitiveType != PRIMITIVE_CUBE && prefab.primitiveType != PRIMITIVE_CYLINDER))
+            continue;
 
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetGraphicsRoot32BitConstants(RootParameters::PER_DRAW_CONSTANTS, sizeof(PerDrawRootConstants) / 4, &currentDrawConstants, 0);
+        const AABB &b = g_static_draw.worldBounds[i];
+        float ex = b.max.x - b.min.x, ey = b.max.y - b.min.y, ez = b.max.z - b.min.z;
+        float dx = (b.min.x + b.max.x) * 0.5f - eye.x, dy = (b.min.y + b.max.y) * 0.5f - eye.y, dz = (b.min.z + b.max.z) * 0.5f - eye.z;
+        float distanceSq = dx * dx + dy * dy + dz * dz;
+        float sizeSq = (ex * ex + ey * ey + ez * ez) * 0.25f / (distanceSq > 1e-4f ? distanceSq : 1e-4f);
+        if (sizeSq < g_occlusion.minOccluderSize * g_occlusion.minOccluderSize)
+            continue;
+        if (occluderCount == maxOccluders && sizeSq <= g_occlusion.occluderSizes[occluderCount - 1])
+            continue;
 
-        if (objectType == OBJECT_PRIMITIVE || objectType == OBJECT_SKY_SPHERE)
-        {
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetVertexBuffers(0, 1, &g_engine.graphics_resources.m_vertexBufferView[currentPrimitiveToDraw]);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetIndexBuffer(&g_engine.graphics_resources.m_indexBufferView[currentPrimitiveToDraw]);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->DrawIndexedInstanced(g_engine.graphics_resources.m_indexCount[currentPrimitiveToDraw], 1, 0, 0, 0);
-        }
-        else if (objectType == OBJECT_HEIGHTFIELD)
+        int k = occluderCount < maxOccluders ? occluderCount++ : occluderCount - 1;
+        for (; k > 0 && g_occlusion.occluderSizes[k - 1] < sizeSq; --k)
         {
-            // Use shared heightfield mesh
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetVertexBuffers(0, 1, &g_engine.graphics_resources.m_heightfieldVertexView);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetIndexBuffer(&g_engine.graphics_resources.m_heightfieldIndexView);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->DrawIndexedInstanced(g_engine.graphics_resources.m_heightfieldIndexCount, 1, 0, 0, 0);
-        }
-        else if (objectType == OBJECT_LOADED_MODEL)
-        {
-            // todo unify outside this if statement
-            currentDrawConstants.textureArrayIndex = g_engine.graphics_resources.m_models[loadedModelIndex].textureIndex;
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetGraphicsRoot32BitConstants(RootParameters::PER_DRAW_CONSTANTS, sizeof(PerDrawRootConstants) / 4, &currentDrawConstants, 0);
-
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetVertexBuffers(0, 1, &g_engine.graphics_resources.m_models[loadedModelIndex].vertexView);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetIndexBuffer(&g_engine.graphics_resources.m_models[loadedModelIndex].indexView);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->DrawIndexedInstanced(g_engine.graphics_resources.m_models[loadedModelIndex].indexCount, 1, 0, 0, 0);
+            g_occlusion.occluderSlots[k] = g_occlusion.occluderSlots[k - 1];
+            g_occlusion.occluderSizes[k] = g_occlusion.occluderSizes[k - 1];
         }
+        g_occlusion.occluderSlots[k] = (uint32_t)v;
+        g_occlusion.occluderSizes[k] = sizeSq;
     }
 
-    // Debug: draw player collision cylinder (wireframe)
-    if (g_show_player_wireframe)
+    int triangles = 0;
+    for (int o = 0; o < occluderCount; ++o)
     {
-        UINT psoIndex = g_engine.msaa_state.m_enabled ? g_engine.msaa_state.m_currentSampleIndex : 0;
-        ID3D12PipelineState *wirePSO = g_engine.pipeline_dx12.m_wireframePSO[psoIndex];
-        if (wirePSO)
+        uint32_t i = g_static_draw.visibleIds[g_occlusion.occluderSlots[o]];
+        AABB local = g_primitiveLocalBounds[SceneObjectPrefab(g_scene, i).primitiveType];
+        if (SceneObjectPrefab(g_scene, i).primitiveType == PRIMITIVE_CYLINDER)
         {
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetPipelineState(wirePSO);
-
-            // Compute cylinder centre from current camera position
-            float yCentre = g_camera.position.y - g_player_bounds.eyeHeight + g_player_bounds.height * 0.5f;
-
-            // Unit cylinder (radius 0.5, height 1) → scale to match player
-            float scaleX = g_player_bounds.radius / 0.5f;
-            float scaleY = g_player_bounds.height / 1.0f;
-            float scaleZ = g_player_bounds.radius / 0.5f;
-
-            DirectX::XMMATRIX world = DirectX::XMMatrixScaling(scaleX, scaleY, scaleZ) *
-                                      DirectX::XMMatrixTranslation(g_camera.position.x, yCentre, g_camera.position.z);
-
-            PerDrawRootConstants cylConstants;
-            DirectX::XMStoreFloat4x4(&cylConstants.world, DirectX::XMMatrixTranspose(world));
-            cylConstants.textureArrayIndex = 0; // unused
-
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetGraphicsRoot32BitConstants(
-                RootParameters::PER_DRAW_CONSTANTS, sizeof(PerDrawRootConstants) / 4, &cylConstants, 0);
-
-            // Use the existing cylinder mesh
-            PrimitiveType cylType = PRIMITIVE_CYLINDER;
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetVertexBuffers(
-                0, 1, &g_engine.graphics_resources.m_vertexBufferView[cylType]);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->IASetIndexBuffer(
-                &g_engine.graphics_resources.m_indexBufferView[cylType]);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->DrawIndexedInstanced(
-                g_engine.graphics_resources.m_indexCount[cylType], 1, 0, 0, 0);
+            // a box inside the cylinder: inside the inscribed circle of the (at least 8 sided) cross section
+            float hx = (local.max.x - local.min.x) * 0.5f * 0.65f, hz = (local.max.z - local.min.z) * 0.5f * 0.65f;
+            float cx = (local.max.x + local.min.x) * 0.5f, cz = (local.max.z + local.min.z) * 0.5f;
+            local.min.x = cx - hx;
+            local.max.x = cx + hx;
+            local.min.z = cz - hz;
+            local.max.z = cz + hz;
         }
+        triangles += OcclusionAddBox(g_occlusion.buffer, g_scene_transforms.world[i], local);
     }
 
-    // Post-draw operations
-    if (g_engine.msaa_state.m_enabled)
+    int heightfieldIndex = SceneResolve(g_scene, g_heightfield);
+    if (g_occlusion.heightfield && heightfieldIndex >= 0 && g_heightmapDataCPU.data)
     {
-        // MSAA: Resolve to back buffer
-        auto barrier2 = CD3DX12_RESOURCE_BARRIER::Transition(g_engine.pipeline_dx12.m_msaaRenderTargets[g_engine.sync_state.m_frameIndex], D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_RESOLVE_SOURCE);
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ResourceBarrier(1, &barrier2);
+        if (g_occlusion.terrainSource != g_heightmapDataCPU.data)
+            BuildTerrainOccluder(g_heightmapDataCPU);
+        triangles += OcclusionAddMesh(g_occlusion.buffer, g_scene_transforms.world[heightfieldIndex], g_occlusion.terrainPositions.data(),
+                                      (int)g_occlusion.terrainPositions.size(), g_occlusion.terrainIndices.data(), (int)g_occlusion.terrainIndices.size());
+    }
 
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ResolveSubresource(g_engine.pipeline_dx12.m_renderTargets[g_engine.sync_state.m_frameIndex], 0, g_engine.pipeline_dx12.m_msaaRenderTargets[g_engine.sync_state.m_frameIndex], 0, DXGI_FORMAT_R8G8B8A8_UNORM);
+    OcclusionRunJob(OcclusionRasterizeJob, OCCLUSION_BANDS);
+    OcclusionRunJob(OcclusionErodeJob, OCCLUSION_BANDS);
+    Uint64 testStart = SDL_GetPerformanceCounter();
+    g_occlusion.rasterMs = CountsToMs(testStart - rasterStart);
 
-        auto barrier3 = CD3DX12_RESOURCE_BARRIER::Transition(g_engine.pipeline_dx12.m_renderTargets[g_engine.sync_state.m_frameIndex], D3D12_RESOURCE_STATE_RESOLVE_DEST, D3D12_RESOURCE_STATE_RENDER_TARGET);
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ResourceBarrier(1, &barrier3);
+    // occluders are never tested, they would mostly just find themselves
+    g_occlusion.visible.assign(visibleCount, 0);
+    for (int o = 0; o < occluderCount; ++o)
+        g_occlusion.visible[g_occlusion.occluderSlots[o]] = 1;
+    OcclusionRunJob(OcclusionTestJob, (visibleCount + OCCLUSION_TEST_GROUP - 1) / OCCLUSION_TEST_GROUP);
 
-        auto barrier4 = CD3DX12_RESOURCE_BARRIER::Transition(g_engine.pipeline_dx12.m_msaaRenderTargets[g_engine.sync_state.m_frameIndex], D3D12_RESOURCE_STATE_RESOLVE_SOURCE, D3D12_RESOURCE_STATE_RENDER_TARGET);
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ResourceBarrier(1, &barrier4);
+    int kept = 0;
+    for (int v = 0; v < visibleCount; ++v)
+    {
+        if (g_occlusion.visible[v])
+            g_static_draw.visibleIds[kept++] = g_static_draw.visibleIds[v];
     }
+    g_occlusion.testMs = CountsToMs(SDL_GetPerformanceCounter() - testStart);
 
-    if (g_view_editor)
-    {
-        // ImGui rendering (always to back buffer)
-        CD3DX12_CPU_DESCRIPTOR_HANDLE backBufferRtvHandle(
-            g_engine.pipeline_dx12.m_rtvHeap->GetCPUDescriptorHandleForHeapStart(),
-            (INT)g_engine.sync_state.m_frameIndex,
-            g_engine.pipeline_dx12.m_rtvDescriptorSize);
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->OMSetRenderTargets(1, &backBufferRtvHandle, FALSE, nullptr);
+    g_occlusion.occluders = occluderCount;
+    g_occlusion.triangles = triangles;
+    g_occlusion.tested = visibleCount - occluderCount;
+    g_occlusion.culled = visibleCount - kept;
+    return kept;
+}
 
-        ImGui::Render();
-        ID3D12DescriptorHeap *imguiHeaps[] = {g_imguiHeap.Heap};
-        g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->SetDescriptorHeaps(_countof(imguiHeaps), imguiHeaps);
-        ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]);
-    }
-    else
+// level of detail of a bounding sphere seen from the camera, previous is the level it had last frame
+int SelectLod(const DirectX::XMFLOAT3 &center, float radius, int previous, int levels)
+{
+    if (!g_draw_lod.enabled || levels < 2)
+        return 0;
+    DirectX::XMFLOAT3 eye;
+    DirectX::XMStoreFloat3(&eye, g_camera.eye);
+    float dx = center.x - eye.x, dy = center.y - eye.y, dz = center.z - eye.z;
+    float size = DrawLodScreenSize(radius, sqrtf(dx * dx + dy * dy + dz * dz), DrawLodTanHalfFov(g_camera.fov_deg));
+    return DrawLodSelect(size, previous, g_draw_lod.thresholds, levels, g_draw_lod.hysteresis);
+}
+
+// picks the levels of the visible static entries from their world bounds, an entry whose level changes gets its mesh
+// and sort key rederived (the static batches split by level on their own, see SubmitStaticInstanced)
+void SelectStaticLods(int visibleCount)
+{
+    for (int v = 0; v < visibleCount; ++v)
     {
-        // Draw reticle to back buffer (single-sampled)
-        if (g_reticlePSO && g_reticleRootSig)
+        uint32_t i = g_static_draw.visibleIds[v];
+        int slot = g_static_draw.drawSlot[i];
+        const AABB &bounds = g_static_draw.worldBounds[i];
+        DirectX::XMFLOAT3 center = {(bounds.min.x + bounds.max.x) * 0.5f, (bounds.min.y + bounds.max.y) * 0.5f, (bounds.min.z + bounds.max.z) * 0.5f};
+        DirectX::XMFLOAT3 half = {bounds.max.x - center.x, bounds.max.y - center.y, bounds.max.z - center.z};
+        float radius = sqrtf(half.x * half.x + half.y * half.y + half.z * half.z);
+        int levels = (int)DrawMeshLodCount(g_draw_list.meshIds[slot] % DRAW_MESH_LOD_STRIDE);
+        int lod = SelectLod(center, radius, g_draw_list.lods[slot], levels);
+        if (lod != g_draw_list.lods[slot])
         {
-            // Set back buffer as render target
-            CD3DX12_CPU_DESCRIPTOR_HANDLE backBufferRtvHandle(
-                g_engine.pipeline_dx12.m_rtvHeap->GetCPUDescriptorHandleForHeapStart(),
-                (INT)g_engine.sync_state.m_frameIndex,
-                g_engine.pipeline_dx12.m_rtvDescriptorSize);
-            g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->OMSetRenderTargets(1, &backBufferRtvHandle, FALSE, nullptr);
-
-            auto cmdList = g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex];
-            cmdList->SetPipelineState(g_reticlePSO);
-            cmdList->SetGraphicsRootSignature(g_reticleRootSig);
-            cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-            cmdList->DrawInstanced(3, 1, 0, 0);
+            g_draw_list.lods[slot] = (uint8_t)lod;
+            FinishDrawEntry(slot);
+            g_draw_lod.changes++;
         }
+        g_draw_lod.perLevel[lod]++;
     }
-
-    // Final transition to PRESENT
-    auto finalBarrier = CD3DX12_RESOURCE_BARRIER::Transition(
-        g_engine.pipeline_dx12.m_renderTargets[g_engine.sync_state.m_frameIndex],
-        D3D12_RESOURCE_STATE_RENDER_TARGET,
-        D3D12_RESOURCE_STATE_PRESENT);
-    g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->ResourceBarrier(1, &finalBarrier);
-
-    if (!HRAssert(g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]->Close()))
-        return false;
-    return true;
 }
 
-void Render(bool vsync = true)
+// bots by model and level for InstanceBatchPack, the model's bounds around the bot's position (drawn unscaled).
+// bots whose model didn't load are left out of the batches
+void SelectBotLods()
 {
-    if (!PopulateCommandList())
-        log_error("A command failed to be populated");
-
-    ID3D12CommandList *ppCommandLists[] = {g_engine.pipeline_dx12.m_commandList[g_engine.sync_state.m_frameIndex]};
-    g_engine.pipeline_dx12.m_commandQueue->ExecuteCommandLists(_countof(ppCommandLists), ppCommandLists);
-
-    UINT syncInterval = (vsync) ? 1 : 0;
-    UINT syncFlags = (vsync) ? 0 : DXGI_PRESENT_ALLOW_TEARING;
-    HRAssert(g_engine.pipeline_dx12.m_swapChain->Present(syncInterval, syncFlags));
+    g_draw_lod.botLods.resize(MAX_BOT_OBJECTS);
+    for (int i = 0; i < MAX_BOT_OBJECTS; ++i)
+    {
+        const BotObject &bot = g_bot_objects[i];
+        const std::vector<ModelResources> &models = g_engine.graphics_resources.m_models;
+        if (bot.modelIndex >= models.size() || models[bot.modelIndex].lodCount == 0)
+        {
+            g_draw_lod.botLods[i] = 0;
+            g_draw_instances.botModel[i] = INSTANCE_BATCH_SKIP;
+            continue;
+        }
+        const ModelResources &model = models[bot.modelIndex];
+        DirectX::XMFLOAT3 half = {(model.boundsMax.x - model.boundsMin.x) * 0.5f, (model.boundsMax.y - model.boundsMin.y) * 0.5f,
+                                  (model.boundsMax.z - model.boundsMin.z) * 0.5f};
+        float radius = sqrtf(half.x * half.x + half.y * half.y + half.z * half.z);
+        int lod = SelectLod(bot.pos, radius, g_draw_lod.botLods[i], (int)model.lodCount);
+        g_draw_lod.changes += lod != g_draw_lod.botLods[i];
+        g_draw_lod.botLods[i] = (uint8_t)lod;
+        g_draw_lod.perLevel[lod]++;
+        g_draw_instances.botModel[i] = bot.modelIndex * DRAW_LOD_MAX_LEVELS + lod;
+    }
 }
 
-// this functions exists for a future where we will do more than just render the whole scene, this will include culling here
-// TODO: update this function to group objects by rendering pipeline, and make sky objects be rendered last
 void FillDrawList()
 {
-    // TODO (optimisation): this part is the static objects so make spatial structure and only fill when needed, not every frame
-    int drawCount = 0;
-    for (int i = 0; i < g_scene.objectCount && drawCount < g_draw_list_element_total; ++i)
-    {
-        const SceneObject &obj = g_scene.objects[i];
-        if (obj.objectType != OBJECT_PRIMITIVE && obj.objectType != OBJECT_HEIGHTFIELD && obj.objectType != OBJECT_SKY_SPHERE && obj.objectType != OBJECT_LOADED_MODEL)
-            continue;
-
-        g_draw_list.transforms.pos[drawCount] = obj.pos;
-        g_draw_list.transforms.rot[drawCount] = obj.rot;
-        g_draw_list.transforms.scale[drawCount] = obj.scale;
+    SyncSceneTransforms();
 
-        g_draw_list.objectTypes[drawCount] = obj.objectType;
-
-        if (obj.objectType == OBJECT_PRIMITIVE)
-        {
-            g_draw_list.primitiveTypes[drawCount] = obj.data.primitive.primitiveType;
-        }
-        else if (obj.objectType == OBJECT_HEIGHTFIELD)
-        {
-            g_draw_list.textureArrayIndices[drawCount] = g_engine.graphics_resources.m_sceneObjectIndices[i];
-        }
-        else if (obj.objectType == OBJECT_SKY_SPHERE)
+    // static segment: only touched when something was edited (see MarkSceneObjectDirty / MarkSceneStructureDirty)
+    int staticRewritten = 0;
+    if (g_static_draw.structureDirty)
+    {
+        ReserveDrawList(g_scene.objectCount * 2 + MAX_BOT_OBJECTS + MAX_SKY_LAYER_OBJECTS); // second objectCount: static batch entries
+        g_static_draw.objectDirty.assign(g_scene.objectCount, false);
+        g_static_draw.dirtyList.clear();
+        g_static_draw.drawSlot.resize(g_scene.objectCount);
+        g_static_draw.worldBounds.resize(g_scene.objectCount);
+        g_static_draw.visibleIds.resize(g_scene.objectCount);
+        g_static_draw.groundSlots.clear();
+        g_static_draw.skySlots.clear();
+        g_static_draw.cullableCount = 0;
+
+        int drawCount = 0;
+        for (int i = 0; i < g_scene.objectCount; ++i)
         {
-            g_draw_list.primitiveTypes[drawCount] = PRIMITIVE_INVERTED_SPHERE;
-            g_draw_list.textureArrayIndices[drawCount] = g_engine.graphics_resources.m_sceneObjectIndices[i];
+            ObjectType objectType = SceneObjectPrefab(g_scene, i).objectType;
+            bool drawable = (objectType == OBJECT_PRIMITIVE || objectType == OBJECT_HEIGHTFIELD || objectType == OBJECT_SKY_SPHERE || objectType == OBJECT_LOADED_MODEL);
+            if (!drawable)
+            {
+                g_static_draw.drawSlot[i] = -1;
+                continue;
+            }
+            g_static_draw.drawSlot[i] = drawCount;
+            g_draw_list.lods[drawCount] = 0; // kept across edits, SelectStaticLods moves it
+            WriteStaticDrawEntry(drawCount, i);
+
+            // the heightfield spans the whole level and the sky surrounds the camera, culling them would only ever cost time
+            if (objectType == OBJECT_HEIGHTFIELD)
+                g_static_draw.groundSlots.push_back(drawCount);
+            else if (objectType == OBJECT_SKY_SPHERE)
+                g_static_draw.skySlots.push_back(drawCount);
+            else
+            {
+                g_static_draw.worldBounds[i] = SceneObjectWorldBounds(i);
+                g_static_draw.visibleIds[g_static_draw.cullableCount++] = (uint32_t)i;
+            }
+            drawCount++;
         }
-        else if (obj.objectType == OBJECT_LOADED_MODEL)
+        BVHBuild(g_static_draw.bvh, g_static_draw.worldBounds.data(), g_static_draw.visibleIds.data(), (uint32_t)g_static_draw.cullableCount);
+
+        g_static_draw.staticCount = drawCount;
+        g_static_draw.structureDirty = false;
+        g_static_draw.fullRebuilds++;
+        g_static_batches.dirty = true;
+        staticRewritten = drawCount;
+    }
+    else
+    {
+        bool boundsMoved = false;
+        for (int i : g_static_draw.dirtyList)
         {
-            g_draw_list.loadedModelIndex[drawCount] = g_scene.objects[i].data.loaded_model.model_index;
-            // g_draw_list.textureArrayIndices[drawCount] = g_scene.objects[i].data.loaded_model.model_index;
+            if (i < g_scene.objectCount && g_static_draw.drawSlot[i] >= 0)
+            {
+                uint64_t stateKey = g_draw_list.sortKeys[g_static_draw.drawSlot[i]];
+                WriteStaticDrawEntry(g_static_draw.drawSlot[i], i);
+                staticRewritten++;
+                if (g_draw_list.sortKeys[g_static_draw.drawSlot[i]] != stateKey)
+                    g_static_batches.dirty = true; // moved to another batch
+
+                ObjectType objectType = SceneObjectPrefab(g_scene, i).objectType;
+                if (objectType == OBJECT_PRIMITIVE || objectType == OBJECT_LOADED_MODEL)
+                {
+                    g_static_draw.worldBounds[i] = SceneObjectWorldBounds(i);
+                    boundsMoved = true;
+                }
+            }
         }
-
-        g_draw_list.pipelines[drawCount] = obj.pipeline;
-        drawCount++;
+        if (boundsMoved)
+            BVHRefit(g_static_draw.bvh, g_static_draw.worldBounds.data());
     }
+    for (int i : g_static_draw.dirtyList)
+        g_static_draw.objectDirty[i] = false;
+    g_static_draw.dirtyList.clear();
 
-    // TODO (optimisation): fill this part of the list every frame when enemies are active
+    int drawCount = g_static_draw.staticCount;
+
+    // bot segment: refilled every frame
     //  this part will be a flat array and all objects will be drawn regardless of position or overdraw because they are likely to be updated pretty much every frame (unless no bots are being simulated)
+    // their matrices are built in one batch pass below instead of one at a time, then packed per model so each model
+    // is a single instanced draw whatever the bot count
+    static TransformSoA botTransforms;
+    TransformSoAResize(botTransforms, MAX_BOT_OBJECTS);
+    g_draw_instances.botWorld.resize(MAX_BOT_OBJECTS);
+    g_draw_instances.botModel.resize(MAX_BOT_OBJECTS);
+    if (g_draw_instances.world.size() < DRAW_INSTANCES_INITIAL)
+        g_draw_instances.world.resize(DRAW_INSTANCES_INITIAL); // only ever grows, see SceneRecordDraws
+    static_assert(MAX_BOT_OBJECTS <= DRAW_INSTANCES_INITIAL, "bots don't fit the instance buffer");
     for (int i = 0; i < MAX_BOT_OBJECTS; ++i)
     {
         const BotObject &bot = g_bot_objects[i];
@@ -1064,21 +2379,190 @@ void FillDrawList()
         scaleOverride.y = 1;
         scaleOverride.z = 1;
 
-        g_draw_list.transforms.pos[drawCount] = bot.pos;
-        g_draw_list.transforms.rot[drawCount] = bot.rot;
-        // g_draw_list.transforms.scale[drawCount] = bot.scale;        //TODO: have this setup on load
-        g_draw_list.transforms.scale[drawCount] = scaleOverride;
-
+        // TransformSoASet(botTransforms, i, bot.pos, bot.rot, bot.scale);        //TODO: have this setup on load
+        TransformSoASet(botTransforms, i, bot.pos, bot.rot, scaleOverride);
+    }
+    TransformBuildBatch(botTransforms, MAX_BOT_OBJECTS, g_draw_instances.botWorld.data(), nullptr, true);
+    Uint64 lodStart = SDL_GetPerformanceCounter();
+    for (int l = 0; l < DRAW_LOD_MAX_LEVELS; ++l)
+        g_draw_lod.perLevel[l] = 0;
+    g_draw_lod.changes = 0;
+    SelectBotLods();
+    uint32_t keyCount = (uint32_t)g_engine.graphics_resources.m_models.size() * DRAW_LOD_MAX_LEVELS;
+    g_draw_instances.modelCounts.resize(keyCount);
+    g_draw_instances.batches.resize(keyCount);
+    g_draw_instances.batchCount = InstanceBatchPack(g_draw_instances.botModel.data(), g_draw_instances.botWorld.data(), MAX_BOT_OBJECTS,
+                                                    keyCount, g_draw_instances.modelCounts.data(),
+                                                    g_draw_instances.world.data(), g_draw_instances.batches.data());
+    g_draw_lod.selectMs = CountsToMs(SDL_GetPerformanceCounter() - lodStart);
+    g_draw_instances.count = MAX_BOT_OBJECTS;
+
+    for (int b = 0; b < g_draw_instances.batchCount; ++b)
+    {
+        const InstanceBatch &batch = g_draw_instances.batches[b];
         g_draw_list.objectTypes[drawCount] = ObjectType::OBJECT_LOADED_MODEL;
-        g_draw_list.loadedModelIndex[drawCount] = bot.modelIndex;
+        g_draw_list.loadedModelIndex[drawCount] = batch.key / DRAW_LOD_MAX_LEVELS;
+        g_draw_list.lods[drawCount] = (uint8_t)(batch.key % DRAW_LOD_MAX_LEVELS);
         g_draw_list.pipelines[drawCount] = RENDER_LOADED_MODEL;
-        // g_draw_list.primitiveTypes[drawCount] = PrimitiveType::PRIMITIVE_SPHERE;
-
-        g_draw_list.textureArrayIndices[drawCount] = g_engine.graphics_resources.m_models[bot.modelIndex].textureIndex;
+        g_draw_list.textureArrayIndices[drawCount] = g_engine.graphics_resources.m_models[batch.key / DRAW_LOD_MAX_LEVELS].textureIndex;
+        g_draw_list.world[drawCount] = g_draw_instances.world[batch.first]; // only the sort reads it, it gets the batch's first bot's depth
+        g_draw_list.instanceCount[drawCount] = batch.count;
+        g_draw_list.instanceFirst[drawCount] = batch.first;
+        FinishDrawEntry(drawCount);
 
         drawCount++;
     }
+
+    // submission order: heightfields, static objects inside the frustum (instanced where they share state), bots, skies last
+    Frustum frustum = FrustumFromViewProj(DirectX::XMMatrixMultiply(g_camera.viewMatrix, g_camera.projectionMatrix));
+    int nodesVisited = 0;
+    int visibleCount = BVHCullFrustum(g_static_draw.bvh, frustum, g_static_draw.worldBounds.data(),
+                                      g_static_draw.visibleIds.data(), (int)g_static_draw.visibleIds.size(), &nodesVisited);
+    visibleCount = OcclusionCull(visibleCount);
+    lodStart = SDL_GetPerformanceCounter();
+    SelectStaticLods(visibleCount);
+    g_draw_lod.selectMs += CountsToMs(SDL_GetPerformanceCounter() - lodStart);
+
+    int botDrawCount = drawCount - g_static_draw.staticCount;
+    int submitCount = 0;
+    for (int slot : g_static_draw.groundSlots)
+        g_draw_list.submitSlots[submitCount++] = slot;
+    Uint64 gatherStart = SDL_GetPerformanceCounter();
+    if (g_static_batches.enabled)
+    {
+        if (g_static_batches.dirty)
+            RebuildStaticBatches();
+        drawCount = SubmitStaticInstanced(visibleCount, drawCount, submitCount);
+    }
+    else
+    {
+        for (int v = 0; v < visibleCount; ++v)
+            g_draw_list.submitSlots[submitCount++] = g_static_draw.drawSlot[g_static_draw.visibleIds[v]];
+        g_static_batches.instancedDraws = 0;
+        g_static_batches.instances = 0;
+        g_static_batches.singleDraws = visibleCount;
+    }
+    g_static_batches.gatherMs = CountsToMs(SDL_GetPerformanceCounter() - gatherStart);
     g_draw_list.drawAmount = drawCount;
+    for (int b = g_static_draw.staticCount; b < drawCount; ++b) // bot batches, then the static batch entries
+        g_draw_list.submitSlots[submitCount++] = b;
+    for (int slot : g_static_draw.skySlots)
+        g_draw_list.submitSlots[submitCount++] = slot;
+    g_draw_list.submitCount = submitCount;
+
+    // state first then depth, see draw_sort.h. opaque front to back, the alpha skies last and back to front
+    Uint64 sortStart = SDL_GetPerformanceCounter();
+    if (g_draw_submit.sortEnabled)
+    {
+        DirectX::XMFLOAT3 eye;
+        DirectX::XMStoreFloat3(&eye, g_camera.eye);
+        for (int s = 0; s < submitCount; ++s)
+        {
+            uint32_t slot = g_draw_list.submitSlots[s];
+            const DirectX::XMFLOAT4X4 &world = g_draw_list.world[slot]; // transposed, translation is the last column
+            float dx = world._14 - eye.x;
+            float dy = world._24 - eye.y;
+            float dz = world._34 - eye.z;
+            g_draw_submit.keys[s] = DrawKeyWithDepth(g_draw_list.sortKeys[slot], dx * dx + dy * dy + dz * dz);
+        }
+        DrawSortRadix(g_draw_submit.keys.data(), g_draw_list.submitSlots.data(), g_draw_submit.tmpKeys.data(),
+                      g_draw_submit.tmpSlots.data(), submitCount);
+    }
+    g_draw_submit.sortMs = CountsToMs(SDL_GetPerformanceCounter() - sortStart);
+
+    g_static_draw.staticRewrittenLastFrame = staticRewritten;
+    g_static_draw.botRewrittenLastFrame = botDrawCount;
+    g_static_draw.culledLastFrame = g_static_draw.cullableCount - visibleCount;
+    g_static_draw.submittedLastFrame = submitCount;
+    g_static_draw.nodesVisitedLastFrame = nodesVisited;
+}
+
+// null backend check of the indirect path: records the current draw list directly and as ExecuteIndirect records, the
+// records have to match the mesh table and resolve to the same draws as the direct stream, also when split into chunks
+bool ValidateIndirectDraws()
+{
+    RenderCommandStream direct, indirect;
+    RecordSceneCommands(direct, g_engine.msaa_state.m_enabled, false);
+    RecordSceneCommands(indirect, g_engine.msaa_state.m_enabled, true);
+    bool valid = IndirectDrawsValidate(indirect.indirect, g_draw_submit.indirectMeshes.data(), (uint32_t)g_draw_submit.indirectMeshes.size());
+    if (!valid)
+        SDL_Log("Indirect records don't match the mesh table");
+
+    RenderCommandChunk wholeDirect = {0, (uint32_t)direct.commands.size(), {}, 0};
+    RenderCommandChunk wholeIndirect = {0, (uint32_t)indirect.commands.size(), {}, 0};
+    std::vector<RenderResolvedDraw> expected, actual;
+    RenderCommandsResolveDraws(direct, &wholeDirect, 1, expected);
+    RenderCommandsResolveDraws(indirect, &wholeIndirect, 1, actual);
+    if (expected.size() != actual.size() ||
+        (!expected.empty() && memcmp(expected.data(), actual.data(), expected.size() * sizeof(RenderResolvedDraw)) != 0))
+    {
+        SDL_Log("Indirect draws differ from the direct stream (%zu vs %zu draws)", actual.size(), expected.size());
+        valid = false;
+    }
+
+    RenderCommandChunk chunks[MAX_RECORD_CHUNKS];
+    for (int maxChunks = 2; maxChunks <= MAX_RECORD_CHUNKS; ++maxChunks)
+    {
+        int chunkCount = RenderCommandsPlanChunks(indirect, maxChunks, 1, chunks);
+        if (!RenderCommandsChunksMatch(indirect, chunks, chunkCount))
+        {
+            SDL_Log("Chunked indirect playback mismatch with %d chunks", chunkCount);
+            valid = false;
+        }
+    }
+    SDL_Log("Indirect validation: %d records in %d buckets for %zu draws, %s", (int)indirect.indirect.records.size(),
+            (int)indirect.indirect.buckets.size(), expected.size(), valid ? "ok" : "FAILED");
+    return valid;
+}
+
+// the scene's textures in the bindless table: the slots the last LoadAllTextures filled, given back when it runs again,
+// and a reload asked for in Debug Controls, done between frames
+static struct
+{
+    std::vector<UINT> slots;
+    bool reloadRequested = false;
+} g_scene_textures;
+
+void LogGpuHeapReport()
+{
+    for (int pool = 0; pool < GPU_POOL_COUNT; ++pool)
+    {
+        GpuHeapReport report = GpuHeapPoolReport(g_gpu_heaps.pools[pool]);
+        SDL_Log("GPU heaps, %s: %u heap(s) of %.0f MB (%u empty, %u if compacted), %.1f MB used for %.1f MB asked (%.0f%% rounding), "
+                "%.1f MB free in %u blocks (largest %.1f MB, %.0f%% fragmented), %d committed instead",
+                g_gpuPoolNames[pool], report.heaps, g_gpu_heaps.pools[pool].heapSize / 1048576.0, report.emptyHeaps,
+                report.heapsIfCompacted, report.used / 1048576.0, report.requested / 1048576.0, report.rounding * 100.0f,
+                report.free / 1048576.0, report.freeBlocks, report.largestFree / 1048576.0, report.fragmentation * 100.0f,
+                g_gpu_heaps.committed[pool]);
+    }
+}
+
+// null backend benchmark: the CPU side of frames (bot simulation at a fixed step, the draw list, the recording)
+// without submitting anything, so it measures the same thing with or without a GPU. bots move on by frames steps
+void BenchmarkNullBackend(int frames)
+{
+    RenderCommandStream stream;
+    Uint64 updateCounts = 0, fillCounts = 0, recordCounts = 0;
+    for (int f = 0; f < frames; ++f)
+    {
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        UpdateBots(1.0f / 60.0f);
+        Uint64 t1 = SDL_GetPerformanceCounter();
+        FillDrawList();
+        Uint64 t2 = SDL_GetPerformanceCounter();
+        RecordSceneCommands(stream, g_engine.msaa_state.m_enabled, g_draw_submit.indirect);
+        Uint64 t3 = SDL_GetPerformanceCounter();
+        updateCounts += t1 - t0;
+        fillCounts += t2 - t1;
+        recordCounts += t3 - t2;
+    }
+    g_frame_commands.benchUpdateMs = CountsToMs(updateCounts) / frames;
+    g_frame_commands.benchFillMs = CountsToMs(fillCounts) / frames;
+    g_frame_commands.benchRecordMs = CountsToMs(recordCounts) / frames;
+    g_frame_commands.benchHash = RenderCommandsHash(stream);
+    SDL_Log("Null backend: %d frames, bots %.3f ms, draw list %.3f ms, recording %.3f ms per frame, %zu commands (hash %08x)",
+            frames, g_frame_commands.benchUpdateMs, g_frame_commands.benchFillMs, g_frame_commands.benchRecordMs,
+            stream.commands.size(), g_frame_commands.benchHash);
 }
 
 // Convert pitch (X), yaw (Y), roll (Z) in radians to a quaternion.
@@ -1260,6 +2744,9 @@ void Update()
     centre.y = newEye.y - eyeHeight + playerHeight * 0.5f;
     centre.z = newEye.z;
 
+    Uint64 collisionStart = SDL_GetPerformanceCounter();
+    SyncSceneTransforms(); // the ground probe reads the inverse world matrices
+
     // Iterative wall resolution (cubes only)
     const float WALKABLE_THRESHOLD = 0.1f;
     const int MAX_CONTACTS = 128;
@@ -1276,36 +2763,34 @@ void Update()
         // Collect contacts at current centre
         for (int i = 0; i < g_scene.objectCount && contactCount < MAX_CONTACTS; ++i)
         {
-            const SceneObject &obj = g_scene.objects[i];
-            if (obj.objectType != OBJECT_PRIMITIVE || (obj.data.primitive.primitiveType != PRIMITIVE_CUBE && obj.data.primitive.primitiveType != PRIMITIVE_SPHERE && obj.data.primitive.primitiveType != PRIMITIVE_CYLINDER))
+            const ScenePrefab &prefab = SceneObjectPrefab(g_scene, i);
+            PrimitiveType pt = prefab.primitiveType;
+            if (prefab.objectType != OBJECT_PRIMITIVE || (pt != PRIMITIVE_CUBE && pt != PRIMITIVE_SPHERE && pt != PRIMITIVE_CYLINDER))
                 continue;
 
-            if (obj.objectType == OBJECT_PRIMITIVE)
-            {
-                // TODO: Separate out this into a struct which could be the "environment specific player bounds" or something like that
-                DirectX::XMFLOAT3 fakeCentre = centre;
-                fakeCentre.y += g_stepHeight * 0.5f;
-                float fakePlayerHeight = playerHeight - g_stepHeight;
-                DirectX::XMFLOAT3 normal = {};
-                float penetration = 0.0f;
-                bool overlap = false;
-                PrimitiveType pt = obj.data.primitive.primitiveType;
-                if (pt == PRIMITIVE_CUBE)
-                    overlap = OverlapCylinderCubeContact(fakeCentre, radius, fakePlayerHeight, obj, normal, penetration);
-                else if (pt == PRIMITIVE_SPHERE)
-                    overlap = OverlapCylinderSphereContact(fakeCentre, radius, fakePlayerHeight, obj, normal, penetration);
-                else if (pt == PRIMITIVE_CYLINDER)
-                    overlap = OverlapCylinderCylinderUpright(fakeCentre, radius, fakePlayerHeight, obj.pos, obj.scale.x * 0.5f, obj.scale.y, normal, penetration);
-                else
-                    overlap = false; // no collision for unimplemented shapes
+            ObjectTransform obj = SceneGetTransform(g_scene, i);
+            // TODO: Separate out this into a struct which could be the "environment specific player bounds" or something like that
+            DirectX::XMFLOAT3 fakeCentre = centre;
+            fakeCentre.y += g_stepHeight * 0.5f;
+            float fakePlayerHeight = playerHeight - g_stepHeight;
+            DirectX::XMFLOAT3 normal = {};
+            float penetration = 0.0f;
+            bool overlap = false;
+            if (pt == PRIMITIVE_CUBE)
+                overlap = OverlapCylinderCubeContact(fakeCentre, radius, fakePlayerHeight, obj, normal, penetration);
+            else if (pt == PRIMITIVE_SPHERE)
+                overlap = OverlapCylinderSphereContact(fakeCentre, radius, fakePlayerHeight, obj, normal, penetration);
+            else if (pt == PRIMITIVE_CYLINDER)
+                overlap = OverlapCylinderCylinderUpright(fakeCentre, radius, fakePlayerHeight, obj.pos, obj.scale.x * 0.5f, obj.scale.y, normal, penetration);
+            else
+                overlap = false; // no collision for unimplemented shapes
 
-                if (overlap)
-                {
-                    contacts[contactCount].normal = normal;
-                    contacts[contactCount].penetration = penetration;
-                    contacts[contactCount].isGround = (normal.y > WALKABLE_THRESHOLD);
-                    contactCount++;
-                }
+            if (overlap)
+            {
+                contacts[contactCount].normal = normal;
+                contacts[contactCount].penetration = penetration;
+                contacts[contactCount].isGround = (normal.y > WALKABLE_THRESHOLD);
+                contactCount++;
             }
         }
 
@@ -1349,34 +2834,36 @@ void Update()
 
     for (int i = 0; i < g_scene.objectCount; ++i)
     {
-        const SceneObject &obj = g_scene.objects[i];
+        const ScenePrefab &prefab = SceneObjectPrefab(g_scene, i);
+        ObjectType objectType = prefab.objectType;
 
-        if (obj.objectType == OBJECT_HEIGHTFIELD)
+        if (objectType == OBJECT_HEIGHTFIELD)
         {
-            float groundY = SampleHeightmapWorldY(obj, {centre.x, 0, centre.z});
+            float groundY = SampleHeightmapWorldY(SceneGetTransform(g_scene, i), {centre.x, 0, centre.z});
             if (groundY > bestGroundY)
                 bestGroundY = groundY;
         }
-        else if (obj.objectType == OBJECT_PRIMITIVE)
+        else if (objectType == OBJECT_PRIMITIVE)
         {
             DirectX::XMFLOAT3 rayOrigin = {centre.x, feetY + g_stepHeight, centre.z};
             DirectX::XMFLOAT3 rayDir = {0, -1, 0};
+            const DirectX::XMFLOAT4X4 &invWorld = g_scene_transforms.invWorld[i];
 
             float tMin, tMax;
             bool intersection = false;
-            switch (obj.data.primitive.primitiveType)
+            switch (prefab.primitiveType)
             {
             case PRIMITIVE_CUBE:
-                intersection = IntersectRayCube(rayOrigin, rayDir, obj, tMin, tMax);
+                intersection = IntersectRayCube(rayOrigin, rayDir, invWorld, tMin, tMax);
                 break;
             case PRIMITIVE_CYLINDER:
-                intersection = IntersectRayCylinder(rayOrigin, rayDir, obj, tMin, tMax);
+                intersection = IntersectRayCylinder(rayOrigin, rayDir, invWorld, tMin, tMax);
                 break;
             case PRIMITIVE_SPHERE:
-                intersection = IntersectRaySphere(rayOrigin, rayDir, obj, tMin, tMax);
+                intersection = IntersectRaySphere(rayOrigin, rayDir, invWorld, tMin, tMax);
                 break;
             case PRIMITIVE_PRISM:
-                intersection = IntersectRayPrism(rayOrigin, rayDir, obj, tMin, tMax);
+                intersection = IntersectRayPrism(rayOrigin, rayDir, invWorld, tMin, tMax);
                 break;
             default:
                 continue;
@@ -1399,6 +2886,8 @@ void Update()
     if (bestGroundY == -FLT_MAX)
         bestGroundY = feetY;
 
+    g_scene_timings.collisionMs = CountsToMs(SDL_GetPerformanceCounter() - collisionStart);
+
     g_camera.position.y = bestGroundY + eyeHeight; // set final Y, TODO: this should probably be better, like player position rather than camera
 
     // Update view/projection matrices
@@ -1414,7 +2903,73 @@ void Update()
            &g_engine.graphics_resources.m_PerFrameConstantBufferData[g_engine.sync_state.m_frameIndex],
            sizeof(PerFrameConstantBuffer));
 
+    Uint64 fillStart = SDL_GetPerformanceCounter();
     FillDrawList();
+    g_scene_timings.fillDrawListMs = CountsToMs(SDL_GetPerformanceCounter() - fillStart);
+}
+
+// benchmark helper: adds count random primitives so the per-frame scans can be timed on big scenes.
+// not saved unless the scene is edited afterwards
+static int g_benchmarkFillCount = 10000;
+
+void FillSceneForBenchmark(int count)
+{
+    // one shared prefab per shape, cube, cylinder, prism and sphere
+    uint32_t prefabs[PRIMITIVE_INVERTED_SPHERE];
+    for (int p = 0; p < PRIMITIVE_INVERTED_SPHERE; ++p)
+    {
+        ScenePrefab prefab = ScenePrefabDefault();
+        prefab.primitiveType = (PrimitiveType)p;
+        prefabs[p] = SceneFindOrAddPrefab(g_scene, prefab);
+    }
+
+    SceneReserve(g_scene, g_scene.objectCount + count);
+    for (int n = 0; n < count; ++n)
+    {
+        SceneAddObject(g_scene, prefabs[rand() % PRIMITIVE_INVERTED_SPHERE]);
+        int i = g_scene.objectCount - 1;
+        char name[32];
+        snprintf(name, sizeof(name), "bench_%d", i);
+        g_scene.info[i].nametag = StringIntern(name);
+        g_scene.pos[i] = {(float)(rand() % 512) - 256.0f, (float)(rand() % 40), (float)(rand() % 512) - 256.0f};
+    }
+    MarkSceneStructureDirty();
+}
+
+// parse time of the cJSON reader vs the streaming reader vs the baked path on the same synthetic scene,
+// files are read before the timers start. make them with: python meta_scene_bin.py --synthetic 50000
+// (tests/test_scene_load.cpp times the streaming and baked loaders on the same kind of scene without the editor)
+static struct
+{
+    double jsonMs = -1.0; // -1: file missing or failed to load
+    double streamMs = -1.0;
+    double binMs = -1.0;
+    int objectCount = 0;
+} g_scene_load_bench;
+
+void BenchmarkSceneLoad()
+{
+    static Scene benchScene; // throwaway, g_scene is left alone
+
+    size_t jsonSize = 0, binSize = 0;
+    void *json = SDL_LoadFile("bench_scene.json", &jsonSize);
+    void *bin = SDL_LoadFile("bench_scene.bin", &binSize);
+
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    bool jsonOk = json && scene_from_json((const char *)json, &benchScene);
+    Uint64 t1 = SDL_GetPerformanceCounter();
+    bool streamOk = json && scene_from_json_stream((const char *)json, &benchScene);
+    Uint64 t2 = SDL_GetPerformanceCounter();
+    bool binOk = bin && scene_from_bin(bin, binSize, &benchScene);
+    Uint64 t3 = SDL_GetPerformanceCounter();
+
+    g_scene_load_bench.jsonMs = jsonOk ? CountsToMs(t1 - t0) : -1.0;
+    g_scene_load_bench.streamMs = streamOk ? CountsToMs(t2 - t1) : -1.0;
+    g_scene_load_bench.binMs = binOk ? CountsToMs(t3 - t2) : -1.0;
+    g_scene_load_bench.objectCount = benchScene.objectCount;
+    SceneClear(benchScene);
+    SDL_free(json);
+    SDL_free(bin);
 }
 
 // Convert quaternion → pitch/yaw/roll (radians), order: pitch (X), yaw (Y), roll (Z)
@@ -1475,7 +3030,7 @@ inline void QuaternionToEuler(DirectX::FXMVECTOR Q, float &pitch, float &yaw, fl
 }
 
 // editor state
-static int g_selectedObjectIndex = 0;
+static SceneHandle g_selectedObject = SCENE_HANDLE_NULL;
 
 void DrawBotsEditorGUI()
 {
@@ -1574,6 +3129,77 @@ void DrawBotsEditorGUI()
     ImGui::End();
 }
 
+// editor: prefab fields go to the object's prefab (so every instance changes), or with this ticked they become overrides
+// on the edited object only
+static bool g_editorOverrideMode = false;
+
+// set when an object moved off a variant, the unused ones are reclaimed once the interaction ends (a drag over an
+// overridden field goes through a variant per value)
+static bool g_editorReclaimVariants = false;
+
+static void EditorRecordPrefabSwitch(int i, uint32_t oldPrefab, uint32_t undoKey = 0)
+{
+    UndoRecordEdit(g_undo, g_scene, i, SCENE_FIELD_PREFAB, &oldPrefab, undoKey);
+    g_editorReclaimVariants = true;
+}
+
+// drops the variants no object and no undo record points at, renumbering the prefab ids the journal holds with them
+static void EditorReclaimVariants()
+{
+    static std::vector<uint8_t> held;
+    static std::vector<uint32_t> remap;
+    held.assign(g_scene.prefabs.size(), 0);
+    UndoMarkPrefabs(g_undo, held);
+    if (ScenePrefabReclaimVariants(g_scene, held, remap) > 0)
+    {
+        UndoRemapPrefabs(g_undo, remap);
+        MarkSceneStructureDirty(); // the draw list keys on prefab ids
+    }
+    g_editorReclaimVariants = false;
+}
+
+static void EditorSetPrefabField(int i, SceneField field, const void *value, uint32_t undoKey = 0)
+{
+    if (g_editorOverrideMode && (SceneOverridableFields(SceneObjectPrefab(g_scene, i).objectType) & SceneFieldBit(field)))
+    {
+        uint32_t oldPrefab = g_scene.prefab[i];
+        SceneSetOverride(g_scene, i, field, value);
+        EditorRecordPrefabSwitch(i, oldPrefab, undoKey);
+        MarkSceneObjectDirty(i);
+        return;
+    }
+
+    uint32_t root = ScenePrefabRoot(g_scene, g_scene.prefab[i]);
+    void *dst = ScenePrefabFieldPtr(g_scene.prefabs[root], field);
+    uint8_t old[sizeof(ScenePrefab)];
+    memcpy(old, dst, g_sceneFields[field].size);
+    memcpy(dst, value, g_sceneFields[field].size);
+    ScenePrefabChanged(g_scene, root);
+    UndoRecordPrefabEdit(g_undo, g_scene, root, field, old, undoKey);
+    MarkSceneStructureDirty(); // every instance of it
+}
+
+// "Revert" next to a prefab field object i overrides, returns true if it was clicked
+static bool EditorRevertOverride(int i, SceneField field)
+{
+    if (!(SceneObjectPrefab(g_scene, i).overrideMask & SceneFieldBit(field)))
+        return false;
+    ImGui::SameLine();
+    ImGui::PushID((int)field);
+    bool revert = ImGui::SmallButton("Revert");
+    ImGui::PopID();
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Overridden on this object, click to use the prefab's value");
+    if (revert)
+    {
+        uint32_t oldPrefab = g_scene.prefab[i];
+        SceneClearOverride(g_scene, i, field);
+        EditorRecordPrefabSwitch(i, oldPrefab);
+        MarkSceneObjectDirty(i);
+    }
+    return revert;
+}
+
 void DrawEditorGUI()
 {
     ImGui::NewFrame();
@@ -1588,20 +3214,28 @@ void DrawEditorGUI()
     // ============================================
     // ImGuizmo – using stored quaternion directly
     // ============================================
+    // a drag (gizmo or widget) is one undo entry, it ends when nothing is held anymore
+    if (!ImGui::IsAnyItemActive() && !ImGuizmo::IsUsing())
+    {
+        UndoEndCoalescing(g_undo);
+        if (g_editorReclaimVariants)
+            EditorReclaimVariants();
+    }
+
     ImGuizmo::BeginFrame();
     ImGuizmo::Enable(true);
     ImGuizmo::SetRect(0, 0, (float)g_engine.viewport_state.m_width, (float)g_engine.viewport_state.m_height);
 
-    if (g_selectedObjectIndex >= 0 && g_selectedObjectIndex < g_scene.objectCount)
+    int selectedIndex = SceneResolve(g_scene, g_selectedObject);
+    if (selectedIndex >= 0)
     {
-        auto &obj = g_scene.objects[g_selectedObjectIndex];
+        DirectX::XMFLOAT3 &objPos = g_scene.pos[selectedIndex];
+        DirectX::XMFLOAT4 &objRot = g_scene.rot[selectedIndex];
+        DirectX::XMFLOAT3 &objScale = g_scene.scale[selectedIndex];
 
-        // ---- Build world matrix from pos, quaternion, scale (row‑major) ----
-        DirectX::XMMATRIX scale = DirectX::XMMatrixScaling(obj.scale.x, obj.scale.y, obj.scale.z);
-        DirectX::XMVECTOR rotQuat = DirectX::XMLoadFloat4(&obj.rot);
-        DirectX::XMMATRIX rotation = DirectX::XMMatrixRotationQuaternion(rotQuat);
-        DirectX::XMMATRIX translation = DirectX::XMMatrixTranslation(obj.pos.x, obj.pos.y, obj.pos.z);
-        DirectX::XMMATRIX world = scale * rotation * translation; // row‑major
+        // ---- World matrix from the transform cache (row‑major) ----
+        SyncSceneTransforms(); // edits earlier in this frame's GUI
+        DirectX::XMMATRIX world = DirectX::XMLoadFloat4x4(&g_scene_transforms.world[selectedIndex]);
 
         // ---- ImGuizmo expects row‑major float[4][4] – pass directly ----
         float *viewPtr = (float *)&g_camera.viewMatrix;
@@ -1617,27 +3251,200 @@ void DrawEditorGUI()
         // ---- Apply changes ----
         if (ImGuizmo::IsUsing())
         {
+            DirectX::XMFLOAT3 oldPos = objPos;
+            DirectX::XMFLOAT4 oldRot = objRot;
+            DirectX::XMFLOAT3 oldScale = objScale;
+
             // world has been modified in place (still row‑major)
             DirectX::XMVECTOR scaleVec, rotQuatNew, posVec;
             DirectX::XMMatrixDecompose(&scaleVec, &rotQuatNew, &posVec, world);
 
             // Position
-            DirectX::XMStoreFloat3(&obj.pos, posVec);
+            DirectX::XMStoreFloat3(&objPos, posVec);
 
             // Rotation – store quaternion directly (no Euler conversion!)
-            DirectX::XMStoreFloat4(&obj.rot, rotQuatNew);
+            DirectX::XMStoreFloat4(&objRot, rotQuatNew);
 
             // Scale
-            DirectX::XMStoreFloat3(&obj.scale, scaleVec);
-
-            // Persist change
-            write_scene();
+            DirectX::XMStoreFloat3(&objScale, scaleVec);
+            MarkSceneObjectDirty(selectedIndex);
+            RequestSceneSave(); // debounced, the file is written once the drag settles
+
+            uint32_t undoKey = UndoCoalesceKey("gizmo", g_selectedObject);
+            UndoRecordEdit(g_undo, g_scene, selectedIndex, SCENE_FIELD_POS, &oldPos, undoKey);
+            UndoRecordEdit(g_undo, g_scene, selectedIndex, SCENE_FIELD_ROT, &oldRot, undoKey);
+            UndoRecordEdit(g_undo, g_scene, selectedIndex, SCENE_FIELD_SCALE, &oldScale, undoKey);
         }
     }
 
     ImGui::Begin("Debug Controls");
     ImGui::Text("Camera Pos: {%.3f, %.3f, %.3f}", g_camera.position.x, g_camera.position.y, g_camera.position.z);
     ImGui::Checkbox("Show Player Cylinder", &g_show_player_wireframe);
+    ImGui::Separator();
+    ImGui::Text("Scene objects: %d (%d handle slots)", g_scene.objectCount, (int)g_scene.slotDense.size());
+    ImGui::Text("FillDrawList: %.3f ms", g_scene_timings.fillDrawListMs);
+    ImGui::Text("Collision + ground: %.3f ms", g_scene_timings.collisionMs);
+    ImGui::Checkbox("Sort draws (state, then depth)", &g_draw_submit.sortEnabled);
+    ImGui::Text("Draw submission: %d draws, %d API calls vs %d binding everything (%d saved), %d pipeline / %d mesh binds, sort %.3f ms",
+                g_draw_submit.draws, g_draw_submit.apiCalls, g_draw_submit.naiveCalls,
+                g_draw_submit.naiveCalls - g_draw_submit.apiCalls, g_draw_submit.pipelineBinds, g_draw_submit.meshBinds,
+                g_draw_submit.sortMs);
+    ImGui::Checkbox("Indirect submission (one ExecuteIndirect per pipeline)", &g_draw_submit.indirect);
+    ImGui::SameLine();
+    if (ImGui::Button("Validate indirect arguments (null backend)"))
+        ValidateIndirectDraws();
+    if (g_draw_submit.indirect)
+        ImGui::Text("Indirect: %d records in %d ExecuteIndirect calls, %.1f KB of arguments", g_draw_submit.indirectRecords,
+                    g_draw_submit.indirectBuckets, g_draw_submit.indirectRecords * sizeof(IndirectDrawRecord) / 1024.0f);
+    ImGui::Text("Bindless textures: %u / %u slots (high water %u, largest free range %u), %zu frees pending, %u / %u transient",
+                g_bindless_slots.used, g_bindless_slots.persistentCount, g_bindless_slots.highWater,
+                DescriptorLargestFree(g_bindless_slots), g_bindless_slots.pending.size(), g_bindless_slots.transientHighWater,
+                g_bindless_slots.transientPerFrame);
+    if (ImGui::Button("Reload scene textures"))
+        g_scene_textures.reloadRequested = true;
+    ImGui::Text("GPU heaps: buffers %.1f / %.0f MB, textures %.1f / %.0f MB, upload %.1f / %.0f MB, %zu placed, %d committed",
+                g_gpu_heaps.pools[GPU_POOL_BUFFERS].used / 1048576.0,
+                g_gpu_heaps.pools[GPU_POOL_BUFFERS].heaps.size() * g_gpu_heaps.pools[GPU_POOL_BUFFERS].heapSize / 1048576.0,
+                g_gpu_heaps.pools[GPU_POOL_TEXTURES].used / 1048576.0,
+                g_gpu_heaps.pools[GPU_POOL_TEXTURES].heaps.size() * g_gpu_heaps.pools[GPU_POOL_TEXTURES].heapSize / 1048576.0,
+                g_gpu_heaps.pools[GPU_POOL_UPLOAD].used / 1048576.0,
+                g_gpu_heaps.pools[GPU_POOL_UPLOAD].heaps.size() * g_gpu_heaps.pools[GPU_POOL_UPLOAD].heapSize / 1048576.0,
+                g_gpu_heaps.placed.size(),
+                g_gpu_heaps.committed[GPU_POOL_BUFFERS] + g_gpu_heaps.committed[GPU_POOL_TEXTURES] + g_gpu_heaps.committed[GPU_POOL_UPLOAD]);
+    if (ImGui::Button("Log GPU heap report"))
+        LogGpuHeapReport();
+    ImGui::Text("Transforms: %d recomputed last frame, %d full rebuilds (%s, %d wide batches)",
+                g_scene_transforms.recomputed, g_scene_transforms.fullRebuilds, g_transformPathNames[g_transformPath],
+                g_transformPathLanes[g_transformPath]);
+    g_scene_transforms.recomputed = 0;
+    ImGui::Text("Draw list rewrites: static %d / %d, bots %d (full rebuilds: %d)",
+                g_static_draw.staticRewrittenLastFrame, g_static_draw.staticCount,
+                g_static_draw.botRewrittenLastFrame, g_static_draw.fullRebuilds);
+    ImGui::Checkbox("Level of detail", &g_draw_lod.enabled);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(100);
+    ImGui::SliderFloat("hysteresis", &g_draw_lod.hysteresis, 0.0f, 0.5f);
+    ImGui::SliderFloat3("LOD screen size thresholds", g_draw_lod.thresholds, 0.001f, 0.5f, "%.3f", ImGuiSliderFlags_Logarithmic);
+    ImGui::Text("LOD: %d / %d / %d / %d at levels 0-3, %d switched, %.2fM of %.2fM triangles at LOD 0 submitted, %.3f ms",
+                g_draw_lod.perLevel[0], g_draw_lod.perLevel[1], g_draw_lod.perLevel[2], g_draw_lod.perLevel[3], g_draw_lod.changes,
+                g_draw_lod.triangles / 1e6, g_draw_lod.fullTriangles / 1e6, g_draw_lod.selectMs);
+    ImGui::Checkbox("Instance static draws", &g_static_batches.enabled);
+    ImGui::Text("Instancing: %d bots in %d instanced draws, %.1f KB of instance data per frame",
+                MAX_BOT_OBJECTS, g_draw_instances.batchCount, g_draw_instances.count * sizeof(DirectX::XMFLOAT4X4) / 1024.0f);
+    ImGui::Text("Static batches: %d groups (%d shared), %d visible in %d instanced draws + %d single, regrouped %d times, %.3f ms",
+                g_static_batches.batchCount, g_static_batches.sharedCount, g_static_batches.instances,
+                g_static_batches.instancedDraws, g_static_batches.singleDraws, g_static_batches.rebuilds, g_static_batches.gatherMs);
+    ImGui::Text("Upload ring: %.1f / %.1f MB in flight (high water %.1f MB), %.1f KB last frame, %llu wraps, grown %d times, %d stalls (%.3f ms)",
+                UploadRingInFlight(g_upload_ring) / (1024.0f * 1024.0f), g_upload_ring.capacity / (1024.0f * 1024.0f),
+                g_upload_ring.highWater / (1024.0f * 1024.0f), g_upload_ring.lastFrameBytes / 1024.0f,
+                (unsigned long long)g_upload_ring.wraps, g_upload_frame.grows, g_upload_frame.stalls, g_upload_frame.stallMs);
+    ImGui::Text("Copy queue: %u uploads (%.1f MB) in %u batches, %u past the staging ring, staging %.1f / %.1f MB (high water %.1f MB), %u stalls (%.3f ms)",
+                g_uploads.uploads, g_uploads.bytes / (1024.0f * 1024.0f), g_uploads.batches, g_uploads.dedicated,
+                UploadRingInFlight(g_staging_ring) / (1024.0f * 1024.0f), g_staging_ring.capacity / (1024.0f * 1024.0f),
+                g_staging_ring.highWater / (1024.0f * 1024.0f), g_uploads.stalls, g_uploads.stallMs);
+    ImGui::Text("Shader cache: %d loaded, %d compiled (%d replaced stale), %d rejected, %zu entries in %.1f KB, startup shaders %.1f ms",
+                g_shader_cache.hits, g_shader_cache.misses, g_shader_cache.stale, g_shader_cache.rejected,
+                g_shader_cache.entries.size(), g_shader_cache.fileBytes / 1024.0f, g_shaderCompileMs);
+    const RenderCommandStream &commands = g_frame_commands.stream;
+    ImGui::Text("Command stream: %d commands (%d draws, %d pipeline, %d mesh, %d constants), record %.3f ms, D3D12 playback %.3f ms",
+                (int)commands.commands.size(), commands.counts[RCMD_DRAW_INDEXED], commands.counts[RCMD_SET_PIPELINE],
+                commands.counts[RCMD_SET_MESH], commands.counts[RCMD_SET_CONSTANTS], g_frame_commands.recordMs, g_frame_commands.executeMs);
+    ImGui::Text("Render graph: %d passes (%d culled), %d barriers in %d ResourceBarrier calls, compile %.3f ms",
+                g_scene_graph.graph.passCount, g_scene_graph.graph.culled, (int)g_scene_graph.graph.barriers.size(),
+                g_scene_graph.graph.batches, g_scene_graph.compileMs);
+    if (ImGui::Button("Dump frame commands (frame_commands.txt)"))
+    {
+        if (!RenderCommandsDump(commands, "frame_commands.txt"))
+            log_error("Could not write frame_commands.txt");
+    }
+    ImGui::InputInt("##nullframes", &g_frame_commands.benchFrames, 10, 100);
+    ImGui::SameLine();
+    if (ImGui::Button("Benchmark null backend") && g_frame_commands.benchFrames > 0)
+        BenchmarkNullBackend(g_frame_commands.benchFrames);
+    ImGui::Text("Null backend per frame: bots %.3f ms, draw list %.3f ms, recording %.3f ms (hash %08x)",
+                g_frame_commands.benchUpdateMs, g_frame_commands.benchFillMs, g_frame_commands.benchRecordMs, g_frame_commands.benchHash);
+    ImGui::Checkbox("Parallel command recording", &g_record_workers.enabled);
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(100);
+    ImGui::InputInt("min draws per chunk", &g_record_workers.minDrawsPerChunk, 64, 256);
+    if (g_record_workers.minDrawsPerChunk < 1)
+        g_record_workers.minDrawsPerChunk = 1;
+    double slowestChunkMs = 0.0;
+    for (int c = 0; c < g_record_workers.chunkCount; ++c)
+        slowestChunkMs = g_record_workers.chunkMs[c] > slowestChunkMs ? g_record_workers.chunkMs[c] : slowestChunkMs;
+    ImGui::Text("Recording: %d chunks on %d workers + main, playback %.3f ms (slowest chunk %.3f ms)",
+                g_record_workers.chunkCount, g_record_workers.workerCount, g_record_workers.playbackMs, slowestChunkMs);
+    if (ImGui::Button("Validate chunked playback (null backend)"))
+    {
+        // every chunk count up to the maximum, one draw per chunk minimum, against the last frame's stream
+        RenderCommandChunk chunks[MAX_RECORD_CHUNKS];
+        int failures = 0;
+        for (int maxChunks = 1; maxChunks <= MAX_RECORD_CHUNKS; ++maxChunks)
+        {
+            int chunkCount = RenderCommandsPlanChunks(g_frame_commands.stream, maxChunks, 1, chunks);
+            if (!RenderCommandsChunksMatch(g_frame_commands.stream, chunks, chunkCount))
+            {
+                SDL_Log("Chunked playback mismatch with %d chunks", chunkCount);
+                failures++;
+            }
+        }
+        SDL_Log("Chunked playback validation: %d / %d chunk counts matched", MAX_RECORD_CHUNKS - failures, MAX_RECORD_CHUNKS);
+    }
+    ImGui::Text("Frustum and occlusion culling: submitted %d draws, culled %d / %d static",
+                g_static_draw.submittedLastFrame, g_static_draw.culledLastFrame, g_static_draw.cullableCount);
+    ImGui::Text("BVH nodes visited: %d / %d", g_static_draw.nodesVisitedLastFrame, (int)g_static_draw.bvh.nodes.size());
+    ImGui::Checkbox("Occlusion culling", &g_occlusion.enabled);
+    ImGui::SameLine();
+    ImGui::Checkbox("Heightfield occluder", &g_occlusion.heightfield);
+    ImGui::SliderInt("max occluders", &g_occlusion.maxOccluders, 0, OCCLUSION_MAX_OCCLUDERS);
+    ImGui::SliderFloat("min occluder size", &g_occlusion.minOccluderSize, 0.01f, 1.0f);
+    ImGui::Text("Occlusion: %d occluders (%d triangles), culled %d / %d tested, raster %.3f ms, tests %.3f ms (%d workers + main)",
+                g_occlusion.occluders, g_occlusion.triangles, g_occlusion.culled, g_occlusion.tested, g_occlusion.rasterMs,
+                g_occlusion.testMs, g_occlusion.workerCount);
+    if (ImGui::Button("Dump occlusion buffer (occlusion_depth.pgm)"))
+    {
+        if (!OcclusionDumpPGM(g_occlusion.buffer, "occlusion_depth.pgm"))
+            log_error("Could not write occlusion_depth.pgm");
+    }
+    ImGui::InputInt("##benchcount", &g_benchmarkFillCount, 1000, 10000);
+    ImGui::SameLine();
+    if (ImGui::Button("Add benchmark objects") && g_benchmarkFillCount > 0)
+        FillSceneForBenchmark(g_benchmarkFillCount);
+    ImGui::Text("Scene load: %.2f ms from %s", g_scene_timings.sceneLoadMs, g_scene_timings.sceneLoadedFrom);
+    if (ImGui::Button("Benchmark scene load (bench_scene.json vs .bin)"))
+        BenchmarkSceneLoad();
+    {
+        SDL_LockMutex(g_scene_save.mutex); // null mutex (no worker) is a no-op
+        ImGui::Text("Scene save: %d requests -> %d saves (%d failed)%s", g_scene_save.requests, g_scene_save.saves,
+                    g_scene_save.failedSaves, g_scene_save.dirty ? ", pending" : "");
+        ImGui::Text("Last save: latency %.1f ms, write %.2f ms, %.1f KB (total %.1f MB), snapshot %.2f ms",
+                    g_scene_save.lastLatencyMs, g_scene_save.lastWriteMs, g_scene_save.lastBytes / 1024.0,
+                    g_scene_save.totalBytes / (1024.0 * 1024.0), g_scene_save.snapshotMs);
+        SDL_UnlockMutex(g_scene_save.mutex);
+    }
+    {
+        // the cold table used to hold char[128] + char[256] per object, now it's ids + one copy of each string
+        StringTableStats strings = StringTableGetStats();
+        ImGui::Text("Object info: %.1f KB (%zu B each), strings: %u unique, %.1f KB used, %.1f KB reserved",
+                    g_scene.info.size() * sizeof(SceneObjectInfo) / 1024.0, sizeof(SceneObjectInfo), strings.count,
+                    strings.usedBytes / 1024.0, strings.reservedBytes / 1024.0);
+        // type, pipeline and asset data used to be repeated per object, now it's a 4 byte prefab id per object
+        int variants = 0;
+        for (const ScenePrefab &prefab : g_scene.prefabs)
+            variants += prefab.base != SCENE_PREFAB_NONE;
+        ImGui::Text("Prefabs: %d (%d override variants), %.1f KB shared, %.1f KB of prefab ids",
+                    (int)g_scene.prefabs.size(), variants, g_scene.prefabs.size() * sizeof(ScenePrefab) / 1024.0,
+                    g_scene.prefab.size() * sizeof(uint32_t) / 1024.0);
+    }
+    ImGui::Text("Undo: %u / %u records, %.1f of %u KB, %d coalesced edits, %d entries dropped",
+                g_undo.applied, g_undo.count, g_undo.bytesUsed / 1024.0, UNDO_BYTE_CAPACITY / 1024,
+                g_undo.coalescedEdits, g_undo.droppedEntries);
+    ImGui::SliderInt("Autosave delay (ms)", &g_liveConfigData.EditorSettings.autosave_delay_ms, 0, 5000);
+    if (ImGui::IsItemDeactivatedAfterEdit())
+        SaveConfig(&g_liveConfigData);
+    if (g_scene_load_bench.jsonMs >= 0.0 || g_scene_load_bench.binMs >= 0.0)
+        ImGui::Text("%d objects: cJSON %.2f ms, stream %.2f ms, bin %.2f ms", g_scene_load_bench.objectCount,
+                    g_scene_load_bench.jsonMs, g_scene_load_bench.streamMs, g_scene_load_bench.binMs);
     ImGui::End();
 
     ImGui::Begin("Settings");
@@ -1830,33 +3637,40 @@ void DrawEditorGUI()
     ImGui::Begin("Scene Objects");
     ImGui::Text("Total objects: %d", g_scene.objectCount);
 
-    if (ImGui::Button("Add Object") && g_scene.objectCount < MAX_SCENE_OBJECTS)
+    ImGui::BeginDisabled(!UndoCanUndo(g_undo));
+    if (ImGui::Button("Undo"))
+        EditorUndo(false);
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!UndoCanRedo(g_undo));
+    if (ImGui::Button("Redo"))
+        EditorUndo(true);
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::TextDisabled("(ctrl+z / ctrl+y)");
+
+    if (ImGui::Button("Add Object"))
     {
-        int idx = g_scene.objectCount;
-        SceneObject *obj = &g_scene.objects[idx];
-        strcpy_s(obj->nametag, sizeof(obj->nametag), "");
-        obj->pos = {0.0f, 0.0f, 0.0f};
-        obj->rot = {0.0f, 0.0f, 0.0f, 1.0f};
-        obj->scale = {1.0f, 1.0f, 1.0f};
-        obj->data.primitive.primitiveType = PRIMITIVE_CUBE;
-        obj->objectType = OBJECT_PRIMITIVE;
-        g_scene.objectCount++;
-        write_scene();
-        g_selectedObjectIndex = idx;
+        g_selectedObject = SceneAddObject(g_scene, SceneDefaultPrefab(g_scene)); // defaults to a unit cube at the origin
+        UndoRecordAdd(g_undo, g_scene, g_selectedObject);
+        MarkSceneStructureDirty();
+        RequestSceneSave();
     }
-    ImGui::SameLine();
-    ImGui::Text("(max %d)", MAX_SCENE_OBJECTS);
+
+    // adding/removing inside the loop would move objects (and the references below) under our feet, so it is done after
+    SceneHandle pendingDuplicate = SCENE_HANDLE_NULL;
+    SceneHandle pendingDelete = SCENE_HANDLE_NULL;
 
     for (int i = 0; i < g_scene.objectCount; ++i)
     {
-        ImGui::PushID(i);
-        auto &obj = g_scene.objects[i];
+        ImGui::PushID((int)g_scene.denseSlot[i]); // by handle slot so the tree state follows the object when others are removed
+        SceneObjectInfo &info = g_scene.info[i];
 
         // --- TreeNode with fixed label + name display ---
         ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_OpenOnArrow |
                                         ImGuiTreeNodeFlags_OpenOnDoubleClick |
                                         ImGuiTreeNodeFlags_SpanAvailWidth;
-        if (i == g_selectedObjectIndex)
+        if (i == selectedIndex)
             node_flags |= ImGuiTreeNodeFlags_Selected;
 
         // Use FIXED label "Object" - identity never changes NOTE: DONT CHANGE THIS LABEL TO ANYTHING ELSE!!!!!!!
@@ -1865,94 +3679,185 @@ void DrawEditorGUI()
         // Check for click on the tree node
         if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen())
         {
-            g_selectedObjectIndex = i;
+            g_selectedObject = SceneHandleAt(g_scene, i);
         }
 
         // Show the actual name on the same line
         ImGui::SameLine();
-        if (obj.nametag[0] != '\0' && strcmp(obj.nametag, "Unamed") != 0)
-            ImGui::TextUnformatted(obj.nametag);
+        const char *nametag = StringGet(info.nametag);
+        if (nametag[0] != '\0' && strcmp(nametag, "Unamed") != 0)
+            ImGui::TextUnformatted(nametag);
         else
             ImGui::Text("Unnamed");
 
         if (node_open)
         {
+            bool edited = false;
+
             // Editable name field (already there)
-            ImGui::InputText("Name", obj.nametag, IM_ARRAYSIZE(obj.nametag));
+            // edited in a scratch buffer, every keystroke interns a new string (they are never freed, it's an editor)
+            char nameBuf[256];
+            SDL_strlcpy(nameBuf, nametag, sizeof(nameBuf));
+            if (ImGui::InputText("Name", nameBuf, IM_ARRAYSIZE(nameBuf)))
+            {
+                StringId oldName = info.nametag;
+                info.nametag = StringIntern(nameBuf);
+                UndoRecordEdit(g_undo, g_scene, i, SCENE_FIELD_NAMETAG, &oldName, UndoCoalesceKey("name", SceneHandleAt(g_scene, i)));
+            }
+            if (ImGui::IsItemDeactivatedAfterEdit())
+                edited = true;
+
+            // --- Prefab: type, pipeline and asset data are shared with every other instance of it ---
+            // a copy, the widgets below can add variants and move the prefab array
+            ScenePrefab prefab = SceneObjectPrefab(g_scene, i);
+            uint32_t root = ScenePrefabRoot(g_scene, g_scene.prefab[i]);
+            if (ImGui::BeginCombo("Prefab", StringGet(g_scene.prefabs[root].name)))
+            {
+                for (uint32_t p = 0; p < (uint32_t)g_scene.prefabs.size(); ++p)
+                {
+                    if (g_scene.prefabs[p].base != SCENE_PREFAB_NONE)
+                        continue; // variants are made by the overrides below, not picked
+                    ImGui::PushID((int)p);
+                    if (ImGui::Selectable(StringGet(g_scene.prefabs[p].name), p == root) && p != root)
+                    {
+                        uint32_t oldPrefab = g_scene.prefab[i];
+                        g_scene.prefab[i] = ScenePrefabVariant(g_scene, p, prefab.overrideMask, prefab); // keeps this object's overrides
+                        EditorRecordPrefabSwitch(i, oldPrefab);
+                        MarkSceneStructureDirty();
+                        edited = true;
+                    }
+                    ImGui::PopID();
+                }
+                ImGui::EndCombo();
+            }
+            ImGui::SameLine();
+            ImGui::TextDisabled("%d instances", ScenePrefabInstanceCount(g_scene, root));
+
+            char prefabNameBuf[256];
+            SDL_strlcpy(prefabNameBuf, StringGet(g_scene.prefabs[root].name), sizeof(prefabNameBuf));
+            if (ImGui::InputText("Prefab name", prefabNameBuf, IM_ARRAYSIZE(prefabNameBuf)))
+            {
+                StringId name = StringIntern(prefabNameBuf);
+                EditorSetPrefabField(i, SCENE_FIELD_PREFAB_NAME, &name, UndoCoalesceKey("prefab name", UndoPrefabHandle(root)));
+            }
             if (ImGui::IsItemDeactivatedAfterEdit())
-                write_scene();
+                edited = true;
 
-            // --- Object type selector ---
-            int currentType = (int)obj.objectType;
+            if (ImGui::Button("Make unique"))
+            {
+                // own copy of the prefab, so editing it no longer changes the other instances
+                ScenePrefab copy = g_scene.prefabs[root];
+                char name[256];
+                snprintf(name, sizeof(name), "%s copy", StringGet(copy.name));
+                copy.name = StringIntern(name);
+                uint32_t unique = ScenePrefabAdd(g_scene, copy);
+
+                uint32_t oldPrefab = g_scene.prefab[i];
+                g_scene.prefab[i] = ScenePrefabVariant(g_scene, unique, prefab.overrideMask, prefab);
+                EditorRecordPrefabSwitch(i, oldPrefab);
+                MarkSceneObjectDirty(i);
+                edited = true;
+            }
+            ImGui::SameLine();
+            ImGui::Checkbox("Edit this object only", &g_editorOverrideMode);
+
+            // --- Object type selector (always on the prefab, a type can't be overridden) ---
+            int currentType = (int)prefab.objectType;
             if (ImGui::Combo("Type", &currentType, g_objectTypeNames, OBJECT_COUNT))
             {
                 ObjectType newType = (ObjectType)currentType;
-                if (newType != obj.objectType)
+                if (newType != prefab.objectType)
                 {
+                    ScenePrefab &edit = g_scene.prefabs[root];
+                    ScenePrefab old = edit;
+
                     // Clear the union before switching (important!)
-                    memset(&obj.data, 0, sizeof(obj.data));
-                    obj.objectType = newType;
+                    memset(&edit.data, 0, sizeof(edit.data));
+                    edit.objectType = newType;
+                    MarkSceneStructureDirty();
+                    edited = true;
 
                     // set defaults
                     switch (newType)
                     {
                     case OBJECT_PRIMITIVE:
                     {
-                        obj.data.primitive.primitiveType = PRIMITIVE_CUBE;
-                        obj.pipeline = RENDER_DEFAULT; // default pipeline
+                        edit.primitiveType = PRIMITIVE_CUBE;
+                        edit.pipeline = RENDER_DEFAULT; // default pipeline
                     }
                     break;
                     case OBJECT_HEIGHTFIELD:
                     {
-                        obj.data.heightfield.width = 256; // example default
+                        edit.data.heightfield.width = 256; // example default
                     }
                     break;
                     case OBJECT_LOADED_MODEL:
                     {
-                        strcpy_s(obj.data.loaded_model.pathTo, sizeof(obj.data.loaded_model.pathTo), "");
+                        edit.data.loaded_model.pathTo = STRING_ID_EMPTY;
                     }
                     break;
                     case OBJECT_SKY_SPHERE:
                     {
-                        strcpy_s(obj.data.sky_sphere.pathToTexture, sizeof(obj.data.sky_sphere.pathToTexture), "");
-                        obj.pipeline = RENDER_SKY;
+                        edit.data.sky_sphere.pathToTexture = STRING_ID_EMPTY;
+                        edit.pipeline = RENDER_SKY;
                     }
                     break;
                     case OBJECT_WATER:
                     {
-                        obj.data.water.choppiness = 1.0f;
+                        edit.data.water.choppiness = 1.0f;
                     }
                     break;
                     default:
                         break;
                     }
+                    ScenePrefabChanged(g_scene, root);
+
+                    // one entry for the whole switch
+                    uint32_t undoKey = UndoCoalesceKey("type", UndoPrefabHandle(root));
+                    UndoRecordPrefabEdit(g_undo, g_scene, root, SCENE_FIELD_OBJECT_TYPE, &old.objectType, undoKey);
+                    UndoRecordPrefabEdit(g_undo, g_scene, root, SCENE_FIELD_DATA, &old.data, undoKey);
+                    UndoRecordPrefabEdit(g_undo, g_scene, root, SCENE_FIELD_PIPELINE, &old.pipeline, undoKey);
+                    UndoRecordPrefabEdit(g_undo, g_scene, root, SCENE_FIELD_PRIMITIVE_TYPE, &old.primitiveType, undoKey);
+                    UndoEndCoalescing(g_undo);
                 }
             }
-            if (obj.objectType == OBJECT_PRIMITIVE)
+            if (prefab.objectType == OBJECT_PRIMITIVE)
             {
                 ImGui::Indent(16.0f);
-                int currentPrimitive = (int)obj.data.primitive.primitiveType;
+                int currentPrimitive = (int)prefab.primitiveType;
                 if (ImGui::Combo("Primitive", &currentPrimitive,
                                  g_primitiveNames, PRIMITIVE_COUNT))
                 {
-                    obj.data.primitive.primitiveType = (PrimitiveType)currentPrimitive;
-                    write_scene();
+                    PrimitiveType primitiveType = (PrimitiveType)currentPrimitive;
+                    EditorSetPrefabField(i, SCENE_FIELD_PRIMITIVE_TYPE, &primitiveType);
+                    edited = true;
                 }
+                edited |= EditorRevertOverride(i, SCENE_FIELD_PRIMITIVE_TYPE);
                 ImGui::Unindent(16.0f);
             }
 
             // ---- Pipeline dropdown ----
-            int currentPipeline = (int)obj.pipeline;
+            int currentPipeline = (int)prefab.pipeline;
             if (ImGui::Combo("Pipeline", &currentPipeline,
                              g_renderPipelineNames, RENDER_COUNT))
             {
-                obj.pipeline = (RenderPipeline)currentPipeline;
+                RenderPipeline pipeline = (RenderPipeline)currentPipeline;
+                EditorSetPrefabField(i, SCENE_FIELD_PIPELINE, &pipeline);
+                edited = true;
             }
+            edited |= EditorRevertOverride(i, SCENE_FIELD_PIPELINE);
+            prefab = SceneObjectPrefab(g_scene, i);
 
-            ImGui::DragFloat3("Position", &obj.pos.x, 0.1f);
+            DirectX::XMFLOAT3 oldPos = g_scene.pos[i];
+            if (ImGui::DragFloat3("Position", &g_scene.pos[i].x, 0.1f))
+            {
+                UndoRecordEdit(g_undo, g_scene, i, SCENE_FIELD_POS, &oldPos, UndoCoalesceKey("position", SceneHandleAt(g_scene, i)));
+                MarkSceneObjectDirty(i);
+                edited = true;
+            }
 
             // ---- Rotation (quaternion → Euler sliders with immediate update) ----
-            DirectX::XMFLOAT4 q = obj.rot;
+            DirectX::XMFLOAT4 q = g_scene.rot[i];
             DirectX::XMVECTOR Q = XMLoadFloat4(&q);
             float pitch, yaw, roll;
             QuaternionToEuler(Q, pitch, yaw, roll);
@@ -1962,9 +3867,9 @@ void DrawEditorGUI()
             float rollDeg = DirectX::XMConvertToDegrees(roll);
 
             bool canRotate = true;
-            if (obj.objectType == OBJECT_HEIGHTFIELD)
+            if (prefab.objectType == OBJECT_HEIGHTFIELD)
                 canRotate = false;
-            if (obj.objectType == OBJECT_PRIMITIVE && obj.data.primitive.primitiveType == PRIMITIVE_CYLINDER)
+            if (prefab.objectType == OBJECT_PRIMITIVE && prefab.primitiveType == PRIMITIVE_CYLINDER)
                 canRotate = false;
 
             bool rotationChanged = false;
@@ -1981,32 +3886,42 @@ void DrawEditorGUI()
                 float y = DirectX::XMConvertToRadians(yawDeg);
                 float r = DirectX::XMConvertToRadians(rollDeg);
                 DirectX::XMVECTOR Q_ = DirectX::XMQuaternionRotationRollPitchYaw(p, y, r);
-                XMStoreFloat4(&obj.rot, Q_);
+                XMStoreFloat4(&g_scene.rot[i], Q_);
+                UndoRecordEdit(g_undo, g_scene, i, SCENE_FIELD_ROT, &q, UndoCoalesceKey("rotation", SceneHandleAt(g_scene, i)));
+                MarkSceneObjectDirty(i);
+                edited = true;
             }
 
-            ImGui::DragFloat3("Scale", &obj.scale.x, 0.01f, 0.01f, 10.0f);
+            DirectX::XMFLOAT3 oldScale = g_scene.scale[i];
+            bool scaleChanged = ImGui::DragFloat3("Scale", &g_scene.scale[i].x, 0.01f, 0.01f, 10.0f);
+            if (scaleChanged)
+            {
+                MarkSceneObjectDirty(i);
+                edited = true;
+            }
             // If sphere or cylinder, enforce uniform scale
-            if (obj.objectType == OBJECT_PRIMITIVE)
+            if (prefab.objectType == OBJECT_PRIMITIVE)
             {
-                float uniform = obj.scale.x;
+                DirectX::XMFLOAT3 &objScale = g_scene.scale[i];
+                float uniform = objScale.x;
 
-                if (obj.data.primitive.primitiveType == PRIMITIVE_SPHERE)
-                    obj.scale.y = obj.scale.z = uniform;
-                if (obj.data.primitive.primitiveType == PRIMITIVE_CYLINDER)
-                    obj.scale.z = uniform;
+                if (prefab.primitiveType == PRIMITIVE_SPHERE)
+                    objScale.y = objScale.z = uniform;
+                if (prefab.primitiveType == PRIMITIVE_CYLINDER)
+                    objScale.z = uniform;
             }
+            if (scaleChanged) // after the uniform fixup so redo gives back what was on screen
+                UndoRecordEdit(g_undo, g_scene, i, SCENE_FIELD_SCALE, &oldScale, UndoCoalesceKey("scale", SceneHandleAt(g_scene, i)));
             ImGui::SameLine();
             if (ImGui::Button("Duplicate"))
-            {
-                if (g_scene.objectCount < MAX_SCENE_OBJECTS)
-                {
-                    g_scene.objects[g_scene.objectCount] = obj;
-                    g_scene.objectCount++;
-                }
-            }
+                pendingDuplicate = SceneHandleAt(g_scene, i);
+            ImGui::SameLine();
+            if (ImGui::Button("Delete"))
+                pendingDelete = SceneHandleAt(g_scene, i);
 
             // Persist changes
-            write_scene();
+            if (edited)
+                RequestSceneSave();
 
             ImGui::TreePop();
         }
@@ -2014,41 +3929,70 @@ void DrawEditorGUI()
         ImGui::Separator();
         ImGui::PopID();
     }
+
+    if (pendingDuplicate != SCENE_HANDLE_NULL)
+    {
+        SceneHandle copy = SceneAddObject(g_scene, g_scene.prefab[SceneResolve(g_scene, pendingDuplicate)]);
+        SceneCopyObject(g_scene, SceneResolve(g_scene, copy), SceneResolve(g_scene, pendingDuplicate));
+        UndoRecordAdd(g_undo, g_scene, copy);
+        MarkSceneStructureDirty();
+        RequestSceneSave();
+    }
+    if (pendingDelete != SCENE_HANDLE_NULL)
+        UndoRecordRemove(g_undo, g_scene, pendingDelete);
+    if (pendingDelete != SCENE_HANDLE_NULL && SceneRemoveObject(g_scene, pendingDelete))
+    {
+        MarkSceneStructureDirty();
+        RequestSceneSave();
+    }
     ImGui::End();
 
     DrawBotsEditorGUI();
 }
 
+// loads every prefab's texture into the bindless table. runs at startup and again from Debug Controls, a reload
+// frees the previous textures' slots (deferred, the GPU may still be sampling them)
+// the copies are only queued (see UploadTexture), the next frame waits for them on the GPU
 void LoadAllTextures()
 {
-    std::vector<ID3D12Resource *> localUploadHeaps;
-
-    g_engine.pipeline_dx12.m_commandAllocators[0]->Reset();
-    g_engine.pipeline_dx12.m_commandList[0]->Reset(g_engine.pipeline_dx12.m_commandAllocators[0], nullptr);
+    for (UINT slot : g_scene_textures.slots)
+        FreeBindlessTexture(slot);
+    g_scene_textures.slots.clear();
 
+    // set rotation of heightmap to zero as given in decisiona
     for (int i = 0; i < g_scene.objectCount; ++i)
     {
-        const auto &obj = g_scene.objects[i];
+        if (SceneObjectPrefab(g_scene, i).objectType == OBJECT_HEIGHTFIELD)
+            DirectX::XMStoreFloat4(&g_scene.rot[i], DirectX::XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f));
+    }
+
+    // once per prefab, not per object. variants can't override asset paths so they take their base's texture after
+    for (ScenePrefab &prefab : g_scene.prefabs)
+    {
+        if (prefab.base != SCENE_PREFAB_NONE)
+            continue;
 
-        if (obj.objectType == OBJECT_HEIGHTFIELD)
+        if (prefab.objectType == OBJECT_HEIGHTFIELD)
         {
-            const char *path = obj.data.heightfield.pathToHeightmap;
-            UINT &outIndex = g_engine.graphics_resources.m_sceneObjectIndices[i];
+            const char *path = StringGet(prefab.data.heightfield.pathToHeightmap);
+            UINT &outIndex = prefab.textureIndex;
             UINT errorIndex = g_errorHeightmapIndex;
 
-            // set rotation of heightmap to zero as given in decisiona
-            DirectX::XMStoreFloat4(&g_scene.objects[i].rot, DirectX::XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f));
             if (path[0] != '\0')
             {
                 ID3D12Resource *tex = nullptr; // not used directly
-                TextureLoadResult tl = LoadTextureFromFile(g_engine.pipeline_dx12.m_device, g_engine.pipeline_dx12.m_commandList[0], path, &tex, true);
+                TextureLoadResult tl = LoadTextureFromFile(g_engine.pipeline_dx12.m_device, path, &tex, true);
                 if (tl.success)
                 {
                     SDL_Log("Loaded heightmap: %s, index %u", path, tl.outIndex);
                     outIndex = tl.outIndex;
-                    if (tl.uploadHeap)
-                        localUploadHeaps.push_back(tl.uploadHeap);
+                    g_scene_textures.slots.push_back(tl.outIndex);
 
+                    if (g_heightmapDataCPU.data)
+                    {
+                        free(g_heightmapDataCPU.data);
+                        g_occlusion.terrainSource = nullptr; // the new copy may get the same address
+                    }
                     g_heightmapDataCPU.data = tl.cpu_copy.data;
                     g_heightmapDataCPU.width = tl.cpu_copy.width;
                     g_heightmapDataCPU.height = tl.cpu_copy.height;
@@ -2064,24 +4008,21 @@ void LoadAllTextures()
                 outIndex = errorIndex;
             }
         }
-        else if (obj.objectType == OBJECT_SKY_SPHERE)
+        else if (prefab.objectType == OBJECT_SKY_SPHERE)
         {
-            const char *path = obj.data.sky_sphere.pathToTexture;
-            UINT &outIndex = g_engine.graphics_resources.m_sceneObjectIndices[i];
-            UINT errorIndex = 0; // assuming index 0 is the error texture
+            const char *path = StringGet(prefab.data.sky_sphere.pathToTexture);
+            UINT &outIndex = prefab.textureIndex;
+            UINT errorIndex = g_fallbackAlbedoIndex;
 
             if (path[0] != '\0')
             {
                 ID3D12Resource *tex = nullptr;
-                TextureLoadResult tl = LoadSkyTextureFromFile(g_engine.pipeline_dx12.m_device,
-                                                              g_engine.pipeline_dx12.m_commandList[0],
-                                                              path, &tex);
+                TextureLoadResult tl = LoadSkyTextureFromFile(g_engine.pipeline_dx12.m_device, path, &tex);
                 if (tl.success)
                 {
                     SDL_Log("Loaded sky texture: %s, index %u", path, tl.outIndex);
                     outIndex = tl.outIndex;
-                    if (tl.uploadHeap)
-                        localUploadHeaps.push_back(tl.uploadHeap);
+                    g_scene_textures.slots.push_back(tl.outIndex);
                 }
                 else
                 {
@@ -2096,16 +4037,14 @@ void LoadAllTextures()
         }
         // TODO: Add further object types here (e.g., OBJECT_TERRAIN, OBJECT_DECAL) as needed
     }
+    for (ScenePrefab &prefab : g_scene.prefabs)
+    {
+        if (prefab.base != SCENE_PREFAB_NONE)
+            prefab.textureIndex = g_scene.prefabs[prefab.base].textureIndex;
+    }
 
-    g_engine.pipeline_dx12.m_commandList[0]->Close();
-    ID3D12CommandList *ppLists[] = {g_engine.pipeline_dx12.m_commandList[0]};
-    g_engine.pipeline_dx12.m_commandQueue->ExecuteCommandLists(1, ppLists);
-
-    WaitForAllFrames();
-
-    for (auto *heap : localUploadHeaps)
-        heap->Release();
-    localUploadHeaps.clear();
+    // texture indices are baked into the static draw entries
+    MarkSceneStructureDirty();
 }
 
 int main(void)
@@ -2184,7 +4123,11 @@ int main(void)
         ImGui_ImplDX12_Init(&init_info);
     }
 
+    UploadRingInit(g_upload_ring, UPLOAD_RING_INITIAL_SIZE);
     read_scene();
+    StartSceneSaveService();
+    StartRecordWorkers();
+    StartOcclusionWorkers();
 
     // todo: when we load everything, make a big table that keeps track of everything we have loaded, filenames, objecttypes, and where it is placed
     // todo: do not load same filename more than once
@@ -2194,6 +4137,8 @@ int main(void)
     // set up bot objects
     ModelLoadResult botModelResult = LoadModelFromFile("assets/models/Drone.glb");
 
+    int heightfieldIndex = SceneResolve(g_scene, g_heightfield);
+    DirectX::XMFLOAT3 heightfieldPos = heightfieldIndex >= 0 ? g_scene.pos[heightfieldIndex] : DirectX::XMFLOAT3{0.0f, 0.0f, 0.0f};
     for (int i = 0; i < MAX_BOT_OBJECTS; ++i)
     {
         BotObject &bot = g_bot_objects[i];
@@ -2201,8 +4146,8 @@ int main(void)
             bot.modelIndex = botModelResult.index;
 
         // Random position within heightfield bounds (approx -100 to 100 in X and Z)
-        float x = (float)(rand() % 256) - g_scene.objects[0].pos.x / 2; // heightfield position TODO: pull out into own thing
-        float z = (float)(rand() % 256) - g_scene.objects[0].pos.z / 2;
+        float x = (float)(rand() % 256) - heightfieldPos.x / 2; // heightfield position TODO: pull out into own thing
+        float z = (float)(rand() % 256) - heightfieldPos.z / 2;
         float y = 25.0f + (float)(rand() % 20); // between 25 and 45
 
         bot.pos = {x, y, z};
@@ -2236,30 +4181,42 @@ int main(void)
         bot.acceleration = 6.0f + (float)(rand() % 40) / 10.0f; // 6 to 10
     }
 
-    // load all the models after the fact
-    for (int i = 0; i < g_scene.objectCount; ++i)
+    // load all the models after the fact, per prefab (variants share their base's model)
+    for (ScenePrefab &prefab : g_scene.prefabs)
     {
-        SceneObject so = g_scene.objects[i];
-        if (so.objectType == ObjectType::OBJECT_LOADED_MODEL)
+        if (prefab.base == SCENE_PREFAB_NONE && prefab.objectType == ObjectType::OBJECT_LOADED_MODEL)
         {
+            StringId pathTo = prefab.data.loaded_model.pathTo;
             bool modelAlreadyLoaded = false;
-            for (uint32_t j = 0; j < g_engine.graphics_resources.m_numModelsLoaded; ++j)
+            for (uint32_t j = 0; j < (uint32_t)g_engine.graphics_resources.m_models.size(); ++j)
             {
-                if (strcmp(g_modelPaths[j], so.data.loaded_model.pathTo) == 0)
+                if (g_modelPathIds[j] == pathTo)
                 {
                     // we have already loaded this path
-                    g_scene.objects[i].data.loaded_model.model_index = j;
+                    prefab.modelIndex = j;
                     modelAlreadyLoaded = true;
                     break;
                 }
             }
-            if (!modelAlreadyLoaded)
+            if (!modelAlreadyLoaded && g_engine.graphics_resources.m_models.size() >= (size_t)DRAW_MESH_MAX_MODELS)
             {
-                ModelLoadResult mlr = LoadModelFromFile(so.data.loaded_model.pathTo);
-                g_scene.objects[i].data.loaded_model.model_index = mlr.index;
+                log_error("Model %s not loaded, the draw key's mesh ids run out at %d models", StringGet(pathTo), DRAW_MESH_MAX_MODELS);
+                prefab.modelIndex = 0;
+            }
+            else if (!modelAlreadyLoaded)
+            {
+                ModelLoadResult mlr = LoadModelFromFile(StringGet(pathTo));
+                prefab.modelIndex = mlr.index;
             }
         }
     }
+    for (ScenePrefab &prefab : g_scene.prefabs)
+    {
+        if (prefab.base != SCENE_PREFAB_NONE)
+            prefab.modelIndex = g_scene.prefabs[prefab.base].modelIndex;
+    }
+    DrawMeshFitModels();
+    MarkSceneStructureDirty();
 
     while (program_state.isRunning)
     {
@@ -2276,6 +4233,14 @@ int main(void)
                 {
                     g_view_editor = !g_view_editor;
                 }
+                // text fields keep ctrl+z for themselves
+                if (g_view_editor && (sdlEvent.key.mod & SDL_KMOD_CTRL) && !ImGui::GetIO().WantTextInput)
+                {
+                    if (sdlEvent.key.key == SDLK_Z)
+                        EditorUndo((sdlEvent.key.mod & SDL_KMOD_SHIFT) != 0);
+                    else if (sdlEvent.key.key == SDLK_Y)
+                        EditorUndo(true);
+                }
                 if (sdlEvent.key.scancode < 512)
                     g_input.keys[sdlEvent.key.scancode] = true;
             }
@@ -2398,12 +4363,23 @@ int main(void)
             // g_input.zoomActive = false; // TODO: put this in LMB
         }
 
+        if (g_scene_textures.reloadRequested)
+        {
+            LoadAllTextures();
+            g_scene_textures.reloadRequested = false;
+        }
+        UpdateSceneSave();
         Update();
         Render((bool)g_liveConfigData.GraphicsSettings.vsync);
         MoveToNextFrame();
     }
+    StopSceneSaveService();
+    StopRecordWorkers();
+    StopOcclusionWorkers();
     g_imguiHeap.Destroy();
+    UploadWaitIdle();
     OnDestroy();
+    ReleaseGpuHeaps();
 
     // todo: move out when abstracting 2d UI system in future
     if (g_reticlePSO)
@@ -39,35 +39,26 @@ def generate_descriptor_header(input_path, output_path, force=False):
         content = f.read()
 
     frame_count = extract_constant(content, 'g_FrameCount')
-    max_heightmaps = extract_constant(content, 'MAX_HEIGHTMAP_TEXTURES')
-    max_sky = extract_constant(content, 'MAX_SKY_TEXTURES')
-    max_models = extract_constant(content, 'MAX_LOADED_MODELS')
+    max_bindless = extract_constant(content, 'MAX_BINDLESS_TEXTURES')
 
-    if None in (frame_count, max_heightmaps, max_sky, max_models):
+    if None in (frame_count, max_bindless):
         missing = []
         if frame_count is None: missing.append('g_FrameCount')
-        if max_heightmaps is None: missing.append('MAX_HEIGHTMAP_TEXTURES')
-        if max_sky is None: missing.append('MAX_SKY_TEXTURES')
-        if max_models is None: missing.append('MAX_LOADED_MODELS')
+        if max_bindless is None: missing.append('MAX_BINDLESS_TEXTURES')
         common.log_error(f"Could not find constants: {', '.join(missing)}")
         return False
 
-    common.log_info(f"Found: g_FrameCount={frame_count}, MAX_HEIGHTMAP_TEXTURES={max_heightmaps}, "
-                    f"MAX_SKY_TEXTURES={max_sky}, MAX_LOADED_MODELS={max_models}")
+    common.log_info(f"Found: g_FrameCount={frame_count}, MAX_BINDLESS_TEXTURES={max_bindless}")
 
-    # Compute register bases
-    heightmap_reg_base = 1
-    sky_reg_base = heightmap_reg_base + max_heightmaps
-    albedo_reg_base = sky_reg_base + max_sky
+    # Compute register bases. every texture but the default one is in the bindless table, one unbounded range
+    bindless_reg_base = 1
 
     # Compute descriptor heap indices (C++ only)
     per_frame_start = 0
     per_scene_cbv = frame_count
     texture_srv = per_scene_cbv + 1
-    heightmap_srv = texture_srv + 1
-    sky_srv = heightmap_srv + max_heightmaps
-    model_albedo_srv = sky_srv + max_sky
-    num_descriptors = model_albedo_srv + max_models
+    bindless_srv = texture_srv + 1
+    num_descriptors = bindless_srv + max_bindless
 
     header = common.make_header("meta_descriptors.py", "DESCRIPTOR LAYOUT")
     content = f"""{header}
@@ -76,39 +67,29 @@ def generate_descriptor_header(input_path, output_path, force=False):
 // ----------------------------------------------------------------------------
 // Constants (shared between C++ and HLSL)
 // ----------------------------------------------------------------------------
-#define MAX_HEIGHTMAP_TEXTURES {max_heightmaps}
-#define MAX_SKY_TEXTURES        {max_sky}
-#define MAX_LOADED_MODELS       {max_models}
+#define MAX_BINDLESS_TEXTURES {max_bindless}
 
 #ifdef __cplusplus
 // ----------------------------------------------------------------------------
 // C++ specific: register bases and descriptor heap indices
 // ----------------------------------------------------------------------------
 namespace RegisterLayout {{
-    constexpr UINT HEIGHTMAP_REGISTER_BASE = {heightmap_reg_base};
-    constexpr UINT HEIGHTMAP_COUNT          = MAX_HEIGHTMAP_TEXTURES;
-    constexpr UINT SKY_REGISTER_BASE        = HEIGHTMAP_REGISTER_BASE + HEIGHTMAP_COUNT;
-    constexpr UINT SKY_COUNT                 = MAX_SKY_TEXTURES;
-    constexpr UINT ALBEDO_REGISTER_BASE      = SKY_REGISTER_BASE + SKY_COUNT;
-    constexpr UINT ALBEDO_COUNT               = MAX_LOADED_MODELS;
+    constexpr UINT BINDLESS_REGISTER_BASE = {bindless_reg_base};
+    constexpr UINT BINDLESS_COUNT         = MAX_BINDLESS_TEXTURES;
 }}
 
 namespace DescriptorIndices {{
     constexpr UINT PER_FRAME_CBV_START = {per_frame_start};
     constexpr UINT PER_SCENE_CBV       = {per_scene_cbv};
     constexpr UINT TEXTURE_SRV          = {texture_srv};
-    constexpr UINT HEIGHTMAP_SRV        = {heightmap_srv};
-    constexpr UINT SKY_SRV              = {sky_srv};
-    constexpr UINT MODEL_ALBEDO_SRV     = {model_albedo_srv};
+    constexpr UINT BINDLESS_SRV         = {bindless_srv};
     constexpr UINT NUM_DESCRIPTORS      = {num_descriptors};
 }}
 #else // HLSL
 // ----------------------------------------------------------------------------
 // HLSL specific: register bases as preprocessor macros (literal values)
 // ----------------------------------------------------------------------------
-#define HEIGHTMAP_REGISTER_BASE t{heightmap_reg_base}
-#define SKY_REGISTER_BASE       t{sky_reg_base}
-#define ALBEDO_REGISTER_BASE    t{albedo_reg_base}
+#define BINDLESS_REGISTER_BASE t{bindless_reg_base}
 #endif
 """
 
@@ -374,15 +374,30 @@ PRIMITIVES = [
     # ("heightfield", gen_heightfield_mesh, 9),
 ]
 
+# Coarser levels of detail per primitive, after the PRIMITIVES tessellation (LOD 0).
+# Primitives not listed here only have LOD 0. Each level is a full mesh of its own.
+PRIMITIVE_LODS = {
+    "cylinder":        [(16,), (8,)],
+    "sphere":          [(32, 16), (16, 8)],
+    "inverted_sphere": [(32, 16), (16, 8)],
+}
+MAX_LODS = 1 + max(len(lods) for lods in PRIMITIVE_LODS.values())
+
 # ----------------------------------------------------------------------
 # Header generator - now writes position, normal, uv
 # ----------------------------------------------------------------------
+def mesh_array_name(name, lod):
+    """kCylinderVertices for LOD 0, kCylinderLod1Vertices for the coarser levels."""
+    array_name = ''.join(p.capitalize() for p in name.split('_'))
+    return array_name if lod == 0 else f"{array_name}Lod{lod}"
+
 def generate_mesh_header(
     output_path: Path = Path("src/generated/mesh_data.h"),
     force: bool = False
 ) -> bool:
     """Generate mesh_data.h from PRIMITIVES."""
     primitives_data = []
+    lod_data = []
 
     for entry in PRIMITIVES:
         name = entry[0]
@@ -392,18 +407,33 @@ def generate_mesh_header(
         vertices, indices = func(*args)
         common.log_info(f"  {len(vertices)} vert, {len(indices)} idx")
         primitives_data.append((name, vertices, indices))
+        for lod, lod_args in enumerate(PRIMITIVE_LODS.get(name, []), start=1):
+            vertices, indices = func(*lod_args)
+            common.log_info(f"  lod {lod}: {len(vertices)} vert, {len(indices)} idx")
+            lod_data.append((name, lod, vertices, indices))
+
+    # The enum and display names on their own, so scene headers get them without the renderer
+    types = common.make_header(tool_name="meta_mesh.py", comment="GENERATED PRIMITIVE TYPES")
+    types += "#pragma once\n"
+    types += "#include <stdint.h>\n\n"
+    types += "enum PrimitiveType : uint8_t\n{\n"
+    for name, _, _ in primitives_data:
+        types += f"    PRIMITIVE_{name.upper()},\n"
+    types += "    PRIMITIVE_COUNT\n};\n\n"
+    types += "// Display names - order matches PrimitiveType\n"
+    types += 'static const char* g_primitiveNames[PRIMITIVE_COUNT] =\n{\n'
+    for name, _, _ in primitives_data:
+        display = ' '.join(p.capitalize() for p in name.split('_'))
+        types += f'    "{display}",\n'
+    types += "};\n"
+    types_written = common.write_file_if_changed(output_path.parent / "primitive_types.h", types)
 
     # Build file content
     header = common.make_header(tool_name="meta_mesh.py", comment="GENERATED MESH DATA")
     content = header
     content += "#pragma once\n"
-    content += '#include "renderer_dx12.cpp"  // for Vertex\n\n'
-
-    # Enum
-    content += "enum PrimitiveType\n{\n"
-    for name, _, _ in primitives_data:
-        content += f"    PRIMITIVE_{name.upper()},\n"
-    content += "    PRIMITIVE_COUNT\n};\n\n"
+    content += '#include "renderer_dx12.cpp"  // for Vertex\n'
+    content += '#include "primitive_types.h"\n\n'
 
     # Mesh data struct
     content += "struct PrimitiveMeshData\n{\n"
@@ -413,8 +443,9 @@ def generate_mesh_header(
     content += "    UINT indexCount;\n};\n\n"
 
     # Vertex/Index arrays - now includes normal
-    for name, verts, idxs in primitives_data:
-        array_name = ''.join(p.capitalize() for p in name.split('_'))
+    all_meshes = [(name, 0, verts, idxs) for name, verts, idxs in primitives_data] + lod_data
+    for name, lod, verts, idxs in all_meshes:
+        array_name = mesh_array_name(name, lod)
         vc = len(verts)
         ic = len(idxs)
         content += f"static const Vertex k{array_name}Vertices[{vc}] = {{\n"
@@ -440,19 +471,30 @@ def generate_mesh_header(
     content += "// Lookup table - order matches PrimitiveType\n"
     content += "static const PrimitiveMeshData kPrimitiveMeshData[PRIMITIVE_COUNT] =\n{\n"
     for name, _, _ in primitives_data:
-        array_name = ''.join(p.capitalize() for p in name.split('_'))
+        array_name = mesh_array_name(name, 0)
         content += f"    {{ k{array_name}Vertices, k{array_name}VertexCount, k{array_name}Indices, k{array_name}IndexCount }},\n"
     content += "};\n\n"
 
-    # Display names
-    content += "// Display names - order matches PrimitiveType\n"
-    content += 'static const char* g_primitiveNames[PRIMITIVE_COUNT] =\n{\n'
+    # LOD tables - level 0 is the kPrimitiveMeshData entry, unused levels are left empty
+    content += "// Levels of detail - order matches PrimitiveType, finest first\n"
+    content += f"#define PRIMITIVE_MAX_LODS {MAX_LODS}\n\n"
+    content += "static const UINT kPrimitiveLodCount[PRIMITIVE_COUNT] =\n{\n"
     for name, _, _ in primitives_data:
-        display = ' '.join(p.capitalize() for p in name.split('_'))
-        content += f'    "{display}",\n'
+        content += f"    {1 + len(PRIMITIVE_LODS.get(name, []))},\n"
+    content += "};\n\n"
+    content += "static const PrimitiveMeshData kPrimitiveLodMeshData[PRIMITIVE_COUNT][PRIMITIVE_MAX_LODS] =\n{\n"
+    for name, _, _ in primitives_data:
+        levels = []
+        for lod in range(MAX_LODS):
+            if lod <= len(PRIMITIVE_LODS.get(name, [])):
+                array_name = mesh_array_name(name, lod)
+                levels.append(f"{{ k{array_name}Vertices, k{array_name}VertexCount, k{array_name}Indices, k{array_name}IndexCount }}")
+            else:
+                levels.append("{ nullptr, 0, nullptr, 0 }")
+        content += "    { " + ", ".join(levels) + " },\n"
     content += "};\n\n"
 
-    return common.write_file_if_changed(output_path, content)
+    return common.write_file_if_changed(output_path, content) or types_written
 
 # ----------------------------------------------------------------------
 # CLI
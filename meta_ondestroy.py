@@ -97,6 +97,7 @@ def parse_dx12_resources(content: str) -> list:
 PRIORITY_MAP = {
     # Sync objects (release first)
     'm_fence': 0,
+    'm_copyFence': 0,
     # Constant buffers (need Unmap)
     'm_PerFrameConstantBuffer': 1,
     'm_PerSceneConstantBuffer': 1,
@@ -105,8 +106,7 @@ PRIORITY_MAP = {
     'm_heightmapTexture': 2,
     'm_heightfieldVertexBuffer': 2,
     'm_heightfieldIndexBuffer': 2,
-    'm_heightfieldVertexUpload': 2,
-    'm_heightfieldIndexUpload': 2,
+    'm_stagingBuffer': 2,
     'm_vertexBuffer': 2,
     'm_indexBuffer': 2,
     'm_depthStencil': 2,
@@ -114,7 +114,9 @@ PRIORITY_MAP = {
     'm_rootSignature': 3,
     'm_pipelineStates': 3,
     'm_commandList': 3,
+    'm_copyCommandList': 3,
     'm_commandAllocators': 4,
+    'm_copyCommandAllocators': 4,
     'm_renderTargets': 4,
     'm_msaaRenderTargets': 4,
     'm_msaaDepthStencil': 4,
@@ -128,12 +130,11 @@ PRIORITY_MAP = {
     'm_swapChain': 6,
     # Command queue
     'm_commandQueue': 7,
+    'm_copyQueue': 7,
     # Device (last)
     'm_device': 8,
     # Extra arrays
-    'm_heightmapResources': 2,
-    'm_skyResources': 2,
-    'm_modelAlbedoTextures': 2,
+    'm_bindlessTextures': 2,
 }
 
 def get_priority(resource: dict) -> int:
@@ -145,6 +146,7 @@ def get_category_comment(name: str) -> str:
     """Return descriptive comment for a resource category."""
     categories = {
         'm_fence': 'Release sync objects',
+        'm_copyFence': 'Release sync objects',
         'm_PerFrameConstantBuffer': 'Unmap and release constant buffers',
         'm_PerSceneConstantBuffer': 'Unmap and release constant buffers',
         'm_defaultTexture': 'Release graphics resources',
@@ -157,6 +159,9 @@ def get_category_comment(name: str) -> str:
         'm_rootSignature': 'Release pipeline objects',
         'm_pipelineStates': 'Release pipeline objects',
         'm_commandList': 'Release pipeline objects',
+        'm_copyCommandList': 'Release pipeline objects',
+        'm_copyCommandAllocators': 'Release per‑frame resources',
+        'm_stagingBuffer': 'Release graphics resources',
         'm_commandAllocators': 'Release per‑frame resources',
         'm_renderTargets': 'Release per‑frame resources',
         'm_msaaRenderTargets': 'Release MSAA resources',
@@ -168,10 +173,9 @@ def get_category_comment(name: str) -> str:
         'm_msaaRtvHeap': 'Release other resources',
         'm_swapChain': 'Release swap chain',
         'm_commandQueue': 'Release command queue',
+        'm_copyQueue': 'Release command queue',
         'm_device': 'Release device (last)',
-        'm_heightmapResources': 'Release texture arrays',
-        'm_skyResources': 'Release texture arrays',
-        'm_modelAlbedoTextures': 'Release texture arrays',
+        'm_bindlessTextures': 'Release texture arrays',
     }
     return categories.get(name, 'Release other resources')
 
@@ -194,9 +198,9 @@ def generate_cleanup_code(resources: list) -> str:
     
     # Special case: release m_models array using its Release method
     lines.append("    // Release model resources")
-    lines.append("    for (UINT i = 0; i < MAX_LOADED_MODELS; i++)")
+    lines.append("    for (ModelResources &model : g_engine.graphics_resources.m_models)")
     lines.append("    {")
-    lines.append("        g_engine.graphics_resources.m_models[i].Release();")
+    lines.append("        model.Release();")
     lines.append("    }")
     lines.append("")
     
@@ -0,0 +1,579 @@
+#!/usr/bin/env python3
+"""
+meta_scene_bin.py – baked binary scene format (scene.bin).
+
+Generates src/generated/scene_bin.cpp (format structs + loader) and bakes scene.json into scene.bin,
+both from the same layout description below so the two sides can not drift apart.
+
+Layout (little‑endian, every offset is from the start of the file, sections are 16 byte aligned):
+    SceneBinHeader      magic, version, schema hash, object count, prefab count, file size, offset table
+    pos / rot / scale   packed float3 / float4 / float3 per object
+    nametag             uint32 offset into the string pool per object
+    prefab              uint32 prefab id per object
+    prefab name         uint32 string offset per prefab
+    objectType, pipeline, primitiveType   one byte per prefab (the enums are uint8_t)
+    assetPath           uint32 string offset per prefab
+    param               uint32 per prefab: heightfield width, or the float bits of water choppiness
+    base, overrideMask  uint32 per prefab, variants (instances with overrides) are baked already resolved
+    strings             deduplicated, null terminated strings. offset 0 is always ""
+
+The baker builds the prefab table exactly like the runtime json readers do (scene_prefab.h): "prefabs" entries in
+order, objects without a prefab folded into a shared prefab per distinct content, overrides as deduplicated variants,
+so loading scene.bin gives the same Scene as loading the json it came from.
+
+The schema hash covers the section layout and the enum name lists, so reordering an enum makes the runtime
+reject an old scene.bin (it then falls back to scene.json). the loader interns the strings into the
+runtime string table (src/string_table.h), each distinct pool string once.
+"""
+import sys
+import re
+import json
+import random
+import struct
+from pathlib import Path
+import common
+
+SCENE_BIN_MAGIC = 0x424E4353  # 'SCNB'
+SCENE_BIN_VERSION = 2
+SECTION_ALIGN = 16
+
+# (enum suffix, element size in bytes, what the element count is)
+SECTIONS = [
+    ('POS', 12, 'object'),
+    ('ROT', 16, 'object'),
+    ('SCALE', 12, 'object'),
+    ('NAMETAG', 4, 'object'),
+    ('PREFAB', 4, 'object'),
+    ('PREFAB_NAME', 4, 'prefab'),
+    ('PREFAB_OBJECT_TYPE', 1, 'prefab'),
+    ('PREFAB_PIPELINE', 1, 'prefab'),
+    ('PREFAB_PRIMITIVE_TYPE', 1, 'prefab'),
+    ('PREFAB_ASSET_PATH', 4, 'prefab'),
+    ('PREFAB_PARAM', 4, 'prefab'),
+    ('PREFAB_BASE', 4, 'prefab'),
+    ('PREFAB_OVERRIDE_MASK', 4, 'prefab'),
+    ('STRINGS', 1, 'bytes'),  # variable size
+]
+
+HEADER_FORMAT = '<IIQIII' + 'II' * len(SECTIONS)
+PREFAB_NONE = 0xFFFFFFFF
+
+
+def load_schema(scene_header: Path) -> dict:
+    schema = {
+        'objectTypes': common.parse_string_array(scene_header, 'g_objectTypeNames'),
+        'pipelines': common.parse_string_array('src/render_pipeline_data.h', 'g_renderPipelineNames'),
+        'primitives': common.parse_string_array('src/generated/primitive_types.h', 'g_primitiveNames'),
+        'fields': parse_scene_fields('src/generated/scene_fields.h'),
+    }
+    return schema
+
+
+def parse_scene_fields(path) -> list:
+    """SceneField enum names in order, the override masks are bits of these (meta_scene_json.py writes the header)."""
+    try:
+        text = Path(path).read_text(encoding='utf-8')
+    except OSError as e:
+        common.log_error(f"Could not read {path}: {e}")
+        return []
+    return re.findall(r'^\s*SCENE_FIELD_(\w+),', text, flags=re.MULTILINE)
+
+
+def fnv1a64(data: bytes) -> int:
+    h = 0xcbf29ce484222325
+    for b in data:
+        h ^= b
+        h = (h * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF
+    return h
+
+
+def schema_hash(schema: dict) -> int:
+    desc = f"scene.bin v{SCENE_BIN_VERSION}|"
+    desc += ','.join(f"{name}:{size}:{count}" for name, size, count in SECTIONS) + '|'
+    desc += 'ObjectType:' + ','.join(schema['objectTypes']) + '|'
+    desc += 'RenderPipeline:' + ','.join(schema['pipelines']) + '|'
+    desc += 'PrimitiveType:' + ','.join(schema['primitives']) + '|'
+    desc += 'SceneField:' + ','.join(schema['fields']) + '|'
+    desc += 'strings:interned'
+    return fnv1a64(desc.encode('utf-8'))
+
+
+def align(n: int) -> int:
+    return (n + SECTION_ALIGN - 1) & ~(SECTION_ALIGN - 1)
+
+
+# ----------------------------------------------------------------------
+# Baker
+# ----------------------------------------------------------------------
+def bake_scene(scene_json: dict, schema: dict) -> bytes:
+    objects = scene_json.get('objects', [])
+    if not isinstance(objects, list):
+        objects = []
+    n = len(objects)
+    obj_types = schema['objectTypes']
+    fields = schema['fields']
+
+    def bit(field):
+        return 1 << fields.index(field)
+
+    # same rules as SceneOverridableFields: pipeline always, the primitive and the non asset members of the type's data
+    overridable = {'Primitive': ['PIPELINE', 'PRIMITIVE_TYPE'], 'Heightfield': ['PIPELINE', 'HEIGHTFIELD_WIDTH'],
+                   'Water': ['PIPELINE', 'WATER_CHOPPINESS']}
+
+    def read_enum(value, names, what):
+        # name or raw number like the json readers, None when the member is missing or another type
+        if isinstance(value, str):
+            if value in names:
+                return names.index(value)
+            common.log_warning(f"Unknown {what} '{value}', using '{names[0]}'")
+            return 0
+        if isinstance(value, (int, float)) and not isinstance(value, bool):
+            return int(value)
+        return None
+
+    def is_number(value):
+        return isinstance(value, (int, float)) and not isinstance(value, bool)
+
+    def read_prefab_fields(json_obj: dict, prefab: dict, with_type: bool) -> set:
+        """scene_prefab_from_json: fills prefab from json_obj, returns the SceneField names that were there."""
+        found = set()
+        if not isinstance(json_obj, dict):
+            return found
+        if with_type:
+            t = read_enum(json_obj.get('objectType'), obj_types, 'objectType')
+            if t is not None:
+                prefab['type'] = t
+                found.add('OBJECT_TYPE')
+        p = read_enum(json_obj.get('pipeline'), schema['pipelines'], 'pipeline')
+        if p is not None:
+            prefab['pipeline'] = p
+            found.add('PIPELINE')
+
+        type_name = obj_types[prefab['type']] if 0 <= prefab['type'] < len(obj_types) else ''
+        if type_name == 'Primitive':
+            data = json_obj.get('primitiveData')
+            prim = read_enum(data.get('primitiveType'), schema['primitives'], 'primitiveType') if isinstance(data, dict) else None
+            if prim is not None:
+                prefab['primitive'] = prim
+                found.add('PRIMITIVE_TYPE')
+        elif type_name == 'Heightfield':
+            data = json_obj.get('heightfieldData')
+            if isinstance(data, dict):
+                if isinstance(data.get('pathToHeightmap'), str):
+                    prefab['path'] = data['pathToHeightmap']
+                    found.add('HEIGHTFIELD_PATHTOHEIGHTMAP')
+                if is_number(data.get('width')):
+                    prefab['param'] = int(data['width']) & 0xFFFFFFFF
+                    found.add('HEIGHTFIELD_WIDTH')
+        elif type_name == 'Loaded Model':
+            data = json_obj.get('loaded_modelData')
+            if isinstance(data, dict) and isinstance(data.get('pathTo'), str):
+                prefab['path'] = data['pathTo']
+                found.add('LOADED_MODEL_PATHTO')
+        elif type_name == 'Sky':
+            data = json_obj.get('sky_sphereData')
+            if isinstance(data, dict) and isinstance(data.get('pathToTexture'), str):
+                prefab['path'] = data['pathToTexture']
+                found.add('SKY_SPHERE_PATHTOTEXTURE')
+        elif type_name == 'Water':
+            data = json_obj.get('waterData')
+            if isinstance(data, dict) and is_number(data.get('choppiness')):
+                prefab['param'] = struct.unpack('<I', struct.pack('<f', data['choppiness']))[0]
+                found.add('WATER_CHOPPINESS')
+        return found
+
+    def default_prefab() -> dict:
+        return {'name': '', 'type': 0, 'pipeline': 0, 'primitive': 0, 'path': '', 'param': 0, 'base': PREFAB_NONE, 'mask': 0}
+
+    def default_name(prefab: dict) -> str:
+        # ScenePrefabDefaultName
+        t, prim, pipe = prefab['type'], prefab['primitive'], prefab['pipeline']
+        what = '?'
+        if t == 0 and 0 <= prim < len(schema['primitives']):
+            what = schema['primitives'][prim]
+        elif t != 0 and 0 <= t < len(obj_types):
+            what = obj_types[t]
+        pipeline = schema['pipelines'][pipe] if 0 <= pipe < len(schema['pipelines']) else '?'
+        return f"{what} ({pipeline})"
+
+    def content_key(prefab: dict) -> tuple:
+        return (prefab['type'], prefab['pipeline'], prefab['primitive'], prefab['path'], prefab['param'], prefab['base'], prefab['mask'])
+
+    prefabs = []
+    by_content = {}  # first prefab with this content, like ScenePrefabFind
+
+    def add_prefab(prefab: dict) -> int:
+        prefabs.append(prefab)
+        by_content.setdefault(content_key(prefab), len(prefabs) - 1)
+        return len(prefabs) - 1
+
+    def find_or_add(prefab: dict) -> int:
+        key = content_key(prefab)
+        if key in by_content:
+            return by_content[key]
+        if not prefab['name']:
+            prefab['name'] = default_name(prefab)
+        return add_prefab(prefab)
+
+    field_keys = {'PIPELINE': 'pipeline', 'PRIMITIVE_TYPE': 'primitive', 'HEIGHTFIELD_WIDTH': 'param', 'WATER_CHOPPINESS': 'param'}
+
+    def variant(base: int, found: set, values: dict) -> int:
+        # ScenePrefabVariant
+        variant = dict(prefabs[base])
+        mask = 0
+        for field in overridable.get(obj_types[variant['type']] if 0 <= variant['type'] < len(obj_types) else '', ['PIPELINE']):
+            key = field_keys[field]
+            if field in found and values[key] != variant[key]:
+                variant[key] = values[key]
+                mask |= bit(field)
+        if mask == 0:
+            return base
+        variant['base'] = base
+        variant['mask'] = mask
+        key = content_key(variant)
+        return by_content[key] if key in by_content else add_prefab(variant)
+
+    json_prefabs = scene_json.get('prefabs', [])
+    for entry in json_prefabs if isinstance(json_prefabs, list) else []:
+        prefab = default_prefab()
+        if isinstance(entry, dict) and isinstance(entry.get('name'), str):
+            prefab['name'] = entry['name']
+        read_prefab_fields(entry, prefab, True)
+        if not prefab['name']:
+            prefab['name'] = default_name(prefab)
+        add_prefab(prefab)
+    prefab_count = len(prefabs)
+
+    strings = bytearray(b'\0')
+    string_offsets = {'': 0}
+
+    def intern(s: str) -> int:
+        if s not in string_offsets:
+            string_offsets[s] = len(strings)
+            strings.extend(s.encode('utf-8') + b'\0')
+        return string_offsets[s]
+
+    pos, rot, scale, nametag, prefab_ids = bytearray(), bytearray(), bytearray(), bytearray(), bytearray()
+    for obj in objects:
+        if not isinstance(obj, dict):
+            obj = {}
+        p = obj.get('pos', [0, 0, 0])
+        r = obj.get('rot', [0, 0, 0, 1])
+        s = obj.get('scale', [1, 1, 1])
+        pos += struct.pack('<3f', *p)
+        rot += struct.pack('<4f', *r)
+        scale += struct.pack('<3f', *s)
+        nametag += struct.pack('<I', intern(obj.get('nametag', '')))
+
+        ref = obj.get('prefab')
+        if is_number(ref) and 0 <= int(ref) < prefab_count:
+            prefab = int(ref)
+        else:
+            own = default_prefab()
+            read_prefab_fields(obj, own, True)
+            prefab = find_or_add(own)
+        overrides = obj.get('overrides')
+        if isinstance(overrides, dict):
+            values = dict(prefabs[prefab])
+            found = read_prefab_fields(overrides, values, False)
+            prefab = variant(prefab, found, values)
+        prefab_ids += struct.pack('<I', prefab)
+
+    prefab_name, prefab_type, prefab_pipeline, prefab_primitive = bytearray(), bytearray(), bytearray(), bytearray()
+    prefab_path, prefab_param, prefab_base, prefab_mask = bytearray(), bytearray(), bytearray(), bytearray()
+    for prefab in prefabs:
+        prefab_name += struct.pack('<I', intern(prefab['name']))
+        prefab_type.append(prefab['type'] & 0xFF)
+        prefab_pipeline.append(prefab['pipeline'] & 0xFF)
+        prefab_primitive.append(prefab['primitive'] & 0xFF)
+        prefab_path += struct.pack('<I', intern(prefab['path']))
+        prefab_param += struct.pack('<I', prefab['param'])
+        prefab_base += struct.pack('<I', prefab['base'])
+        prefab_mask += struct.pack('<I', prefab['mask'])
+
+    payloads = [pos, rot, scale, nametag, prefab_ids, prefab_name, prefab_type, prefab_pipeline, prefab_primitive,
+                prefab_path, prefab_param, prefab_base, prefab_mask, strings]
+
+    offset = align(struct.calcsize(HEADER_FORMAT))
+    table = []
+    body = bytearray()
+    for payload in payloads:
+        table.append((offset, len(payload)))
+        body += payload
+        padded = align(len(payload))
+        body += b'\0' * (padded - len(payload))
+        offset += padded
+    file_size = offset
+
+    header_values = [SCENE_BIN_MAGIC, SCENE_BIN_VERSION, schema_hash(schema), n, len(prefabs), file_size]
+    for off, size in table:
+        header_values += [off, size]
+    header = struct.pack(HEADER_FORMAT, *header_values)
+    header += b'\0' * (align(len(header)) - len(header))
+    return bytes(header + body)
+
+
+def make_synthetic_scene(count: int, schema: dict) -> dict:
+    """Random primitive instances plus a heightfield and a sky, for the scene load benchmark. about half the
+    instances override the pipeline, so the variant path is timed too."""
+    random.seed(1234)
+    prims = schema['primitives'][:4]  # cube, cylinder, prism, sphere
+    prefabs = [
+        {'name': 'hf base', 'objectType': 'Heightfield', 'pipeline': 'Heightfield',
+         'heightfieldData': {'pathToHeightmap': 'assets/heightmaps/clouds.dds', 'width': 256}},
+        {'name': 'sky', 'objectType': 'Sky', 'pipeline': 'Sky', 'sky_sphereData': {'pathToTexture': 'assets/sky/sky1.dds'}},
+    ]
+    for prim in prims:
+        prefabs.append({'name': prim, 'objectType': 'Primitive', 'pipeline': 'Default', 'primitiveData': {'primitiveType': prim}})
+    objects = [
+        {'nametag': 'hf base', 'pos': [0, 0, 0], 'rot': [0, 0, 0, 1], 'scale': [256, 24, 256], 'prefab': 0},
+        {'nametag': 'sky', 'pos': [0, 0, 0], 'rot': [0, 0, 0, 1], 'scale': [1024, 1024, 1024], 'prefab': 1},
+    ]
+    for i in range(len(objects), count):
+        obj = {
+            'nametag': f'bench_{i}',
+            'pos': [random.uniform(-256, 256), random.uniform(0, 40), random.uniform(-256, 256)],
+            'rot': [0, 0, 0, 1],
+            'scale': [1, 1, 1],
+            'prefab': 2 + random.randrange(len(prims)),
+        }
+        if random.random() < 0.5:
+            obj['overrides'] = {'pipeline': 'Triplanar'}
+        objects.append(obj)
+    return {'objectCount': len(objects), 'prefabs': prefabs, 'objects': objects}
+
+
+# ----------------------------------------------------------------------
+# Loader generator
+# ----------------------------------------------------------------------
+def generate_loader(output_c: Path, schema: dict) -> bool:
+    section_enum = '\n'.join(f'    SCENE_BIN_{name},' for name, _, _ in SECTIONS)
+    elem_sizes = ', '.join(str(size) for _, size, _ in SECTIONS)
+    count_kinds = {'object': 'SCENE_BIN_COUNT_OBJECTS', 'prefab': 'SCENE_BIN_COUNT_PREFABS', 'bytes': 'SCENE_BIN_COUNT_BYTES'}
+    elem_counts = ', '.join(count_kinds[count] for _, _, count in SECTIONS)
+
+    code = f'''
+#include "src/scene_data.h"
+#include "primitive_types.h"
+#include "render_pipeline_data.h"
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+
+// baked with: python meta_scene_bin.py (see the layout description at the top of that script)
+#define SCENE_BIN_MAGIC 0x{SCENE_BIN_MAGIC:08X}u
+#define SCENE_BIN_VERSION {SCENE_BIN_VERSION}u
+#define SCENE_BIN_SCHEMA_HASH 0x{schema_hash(schema):016X}ull
+
+enum SceneBinSectionId
+{{
+{section_enum}
+    SCENE_BIN_SECTION_COUNT
+}};
+
+enum SceneBinCount
+{{
+    SCENE_BIN_COUNT_OBJECTS, // one element per object
+    SCENE_BIN_COUNT_PREFABS, // one element per prefab
+    SCENE_BIN_COUNT_BYTES,   // variable size
+}};
+
+static const uint32_t g_sceneBinElementSize[SCENE_BIN_SECTION_COUNT] = {{{elem_sizes}}};
+static const SceneBinCount g_sceneBinElementCount[SCENE_BIN_SECTION_COUNT] = {{{elem_counts}}};
+
+struct SceneBinSection
+{{
+    uint32_t offset; // bytes from the start of the file
+    uint32_t size;   // bytes
+}};
+
+struct SceneBinHeader
+{{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t schemaHash;
+    uint32_t objectCount;
+    uint32_t prefabCount;
+    uint32_t fileSize;
+    SceneBinSection sections[SCENE_BIN_SECTION_COUNT];
+}};
+
+// typed pointers straight into the loaded file, no copies
+struct SceneBinView
+{{
+    uint32_t objectCount;
+    const DirectX::XMFLOAT3* pos;
+    const DirectX::XMFLOAT4* rot;
+    const DirectX::XMFLOAT3* scale;
+    const uint32_t* nametag;
+    const uint32_t* prefab;
+
+    uint32_t prefabCount;
+    const uint32_t* prefabName;
+    const uint8_t* prefabObjectType;
+    const uint8_t* prefabPipeline;
+    const uint8_t* prefabPrimitiveType;
+    const uint32_t* prefabAssetPath;
+    const uint32_t* prefabParam;
+    const uint32_t* prefabBase;
+    const uint32_t* prefabOverrideMask;
+
+    const char* strings;
+    uint32_t stringsSize;
+}};
+
+// ------------------------------------------------------------
+// Validate the header and fix up the section pointers (returns 1 on success, 0 on failure).
+// the file is little-endian, same as every platform we build for, so there is no byte swapping
+// ------------------------------------------------------------
+int scene_bin_map(const void* data, size_t size, SceneBinView* view) {{
+    if (!data || size < sizeof(SceneBinHeader)) return 0;
+    const uint8_t* base = (const uint8_t*)data;
+    const SceneBinHeader* header = (const SceneBinHeader*)base;
+    if (header->magic != SCENE_BIN_MAGIC || header->version != SCENE_BIN_VERSION) return 0;
+    if (header->schemaHash != SCENE_BIN_SCHEMA_HASH) return 0; // baked against different enums/layout, rebake
+    if (header->fileSize != size) return 0;
+
+    const void* sections[SCENE_BIN_SECTION_COUNT];
+    for (int s = 0; s < SCENE_BIN_SECTION_COUNT; ++s) {{
+        const SceneBinSection& sec = header->sections[s];
+        if ((uint64_t)sec.offset + sec.size > size || (sec.offset % 16) != 0) return 0;
+        uint64_t count = g_sceneBinElementCount[s] == SCENE_BIN_COUNT_OBJECTS ? header->objectCount : header->prefabCount;
+        if (g_sceneBinElementCount[s] != SCENE_BIN_COUNT_BYTES && (uint64_t)sec.size != count * g_sceneBinElementSize[s]) return 0;
+        sections[s] = base + sec.offset;
+    }}
+
+    const SceneBinSection& strings = header->sections[SCENE_BIN_STRINGS];
+    if (strings.size == 0 || base[strings.offset + strings.size - 1] != '\\0') return 0; // every string is terminated inside the pool
+
+    view->objectCount = header->objectCount;
+    view->pos = (const DirectX::XMFLOAT3*)sections[SCENE_BIN_POS];
+    view->rot = (const DirectX::XMFLOAT4*)sections[SCENE_BIN_ROT];
+    view->scale = (const DirectX::XMFLOAT3*)sections[SCENE_BIN_SCALE];
+    view->nametag = (const uint32_t*)sections[SCENE_BIN_NAMETAG];
+    view->prefab = (const uint32_t*)sections[SCENE_BIN_PREFAB];
+    view->prefabCount = header->prefabCount;
+    view->prefabName = (const uint32_t*)sections[SCENE_BIN_PREFAB_NAME];
+    view->prefabObjectType = (const uint8_t*)sections[SCENE_BIN_PREFAB_OBJECT_TYPE];
+    view->prefabPipeline = (const uint8_t*)sections[SCENE_BIN_PREFAB_PIPELINE];
+    view->prefabPrimitiveType = (const uint8_t*)sections[SCENE_BIN_PREFAB_PRIMITIVE_TYPE];
+    view->prefabAssetPath = (const uint32_t*)sections[SCENE_BIN_PREFAB_ASSET_PATH];
+    view->prefabParam = (const uint32_t*)sections[SCENE_BIN_PREFAB_PARAM];
+    view->prefabBase = (const uint32_t*)sections[SCENE_BIN_PREFAB_BASE];
+    view->prefabOverrideMask = (const uint32_t*)sections[SCENE_BIN_PREFAB_OVERRIDE_MASK];
+    view->strings = (const char*)sections[SCENE_BIN_STRINGS];
+    view->stringsSize = strings.size;
+    return 1;
+}}
+
+// pool offset -> StringId, each pool string is interned once however many prefabs/objects use it
+static StringId scene_bin_string(const SceneBinView& view, std::vector<StringId>& ids, uint32_t offset) {{
+    if (offset >= view.stringsSize) return STRING_ID_EMPTY;
+    if (ids[offset] == UINT32_MAX) ids[offset] = StringIntern(view.strings + offset);
+    return ids[offset];
+}}
+
+// ------------------------------------------------------------
+// scene.bin → Scene (returns 1 on success, 0 on failure).
+// hot streams are bulk copied, the prefab table is small and built element by element, per object only the nametag
+// ------------------------------------------------------------
+int scene_from_bin(const void* data, size_t size, Scene* scene) {{
+    SceneBinView view;
+    if (!scene_bin_map(data, size, &view)) return 0;
+    int n = (int)view.objectCount;
+
+    // enum bytes index straight into name tables later and ids index the prefab table, reject anything out of range up front
+    for (uint32_t p = 0; p < view.prefabCount; ++p) {{
+        if (view.prefabObjectType[p] >= OBJECT_COUNT || view.prefabPipeline[p] >= RENDER_COUNT || view.prefabPrimitiveType[p] >= PRIMITIVE_COUNT) return 0;
+        uint32_t base = view.prefabBase[p];
+        if (base != SCENE_PREFAB_NONE && (base >= view.prefabCount || view.prefabBase[base] != SCENE_PREFAB_NONE)) return 0;
+    }}
+    for (int i = 0; i < n; ++i) {{
+        if (view.prefab[i] >= view.prefabCount) return 0;
+    }}
+
+    SceneClear(*scene);
+    std::vector<StringId> ids(view.stringsSize, UINT32_MAX);
+    for (uint32_t p = 0; p < view.prefabCount; ++p) {{
+        ScenePrefab prefab = ScenePrefabDefault();
+        prefab.name = scene_bin_string(view, ids, view.prefabName[p]);
+        prefab.objectType = (ObjectType)view.prefabObjectType[p];
+        prefab.pipeline = (RenderPipeline)view.prefabPipeline[p];
+        prefab.primitiveType = (PrimitiveType)view.prefabPrimitiveType[p];
+        prefab.base = view.prefabBase[p];
+        prefab.overrideMask = view.prefabOverrideMask[p];
+        StringId path = scene_bin_string(view, ids, view.prefabAssetPath[p]);
+        switch (prefab.objectType) {{
+            case OBJECT_HEIGHTFIELD:
+                prefab.data.heightfield.pathToHeightmap = path;
+                prefab.data.heightfield.width = view.prefabParam[p];
+                break;
+            case OBJECT_LOADED_MODEL:
+                prefab.data.loaded_model.pathTo = path;
+                break;
+            case OBJECT_SKY_SPHERE:
+                prefab.data.sky_sphere.pathToTexture = path;
+                break;
+            case OBJECT_WATER:
+                memcpy(&prefab.data.water.choppiness, &view.prefabParam[p], sizeof(float));
+                break;
+            default:
+                break;
+        }}
+        ScenePrefabAdd(*scene, prefab);
+    }}
+
+    SceneReserve(*scene, n);
+    for (int i = 0; i < n; ++i)
+        SceneAddObject(*scene, view.prefab[i]);
+    if (n == 0) return 1;
+
+    memcpy(scene->pos.data(), view.pos, n * sizeof(DirectX::XMFLOAT3));
+    memcpy(scene->rot.data(), view.rot, n * sizeof(DirectX::XMFLOAT4));
+    memcpy(scene->scale.data(), view.scale, n * sizeof(DirectX::XMFLOAT3));
+    for (int i = 0; i < n; ++i)
+        scene->info[i].nametag = scene_bin_string(view, ids, view.nametag[i]);
+    return 1;
+}}
+'''
+    output_c.parent.mkdir(parents=True, exist_ok=True)
+    with open(output_c, 'w', encoding='utf-8') as f:
+        f.write(common.make_header("meta_scene_bin.py") + code)
+    common.log_success(f"Generated {output_c}")
+    return True
+
+
+def bake_file(json_path: Path, bin_path: Path, schema: dict) -> bool:
+    try:
+        scene_json = json.loads(json_path.read_text(encoding='utf-8'))
+    except (OSError, ValueError) as e:
+        common.log_error(f"Could not read {json_path}: {e}")
+        return False
+    blob = bake_scene(scene_json, schema)
+    bin_path.write_bytes(blob)
+    common.log_success(f"Baked {json_path} -> {bin_path} ({len(scene_json.get('objects', []))} objects, {len(blob)} bytes)")
+    return True
+
+
+if __name__ == '__main__':
+    import argparse
+    parser = argparse.ArgumentParser(description="Generate scene_bin.cpp and bake scene.json into scene.bin")
+    common.add_common_args(parser)
+    parser.add_argument('--input', '-i', type=Path, default=Path("scene.json"), help="Scene to bake (default: scene.json)")
+    parser.add_argument('--output', '-o', type=Path, default=Path("scene.bin"), help="Baked output (default: scene.bin)")
+    parser.add_argument('--synthetic', type=int, default=0, metavar='N',
+                        help="Also write bench_scene.json/.bin with N random objects for the load benchmark")
+    args = parser.parse_args()
+
+    schema = load_schema(Path("src/scene_data.h"))
+    if not schema['objectTypes'] or not schema['pipelines'] or not schema['primitives'] or not schema['fields']:
+        sys.exit(1)
+
+    ok = generate_loader(Path("src/generated/scene_bin.cpp"), schema)
+    ok = bake_file(args.input, args.output, schema) and ok
+    if args.synthetic > 0:
+        bench = make_synthetic_scene(args.synthetic, schema)
+        Path("bench_scene.json").write_text(json.dumps(bench, indent='\t'), encoding='utf-8')
+        common.log_success(f"Wrote bench_scene.json ({args.synthetic} objects)")
+        ok = bake_file(Path("bench_scene.json"), Path("bench_scene.bin"), schema) and ok
+    sys.exit(0 if ok else 1)
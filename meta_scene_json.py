@@ -4,59 +4,78 @@ import re
 from pathlib import Path
 import common
 
+def find_matching_brace(text: str, open_idx: int) -> int:
+    """Returns the index of the '}' matching the '{' at open_idx, or -1."""
+    level = 0
+    for i in range(open_idx, len(text)):
+        if text[i] == '{':
+            level += 1
+        elif text[i] == '}':
+            level -= 1
+            if level == 0:
+                return i
+    return -1
+
+def parse_union_variants(union_body: str) -> dict:
+    # brace aware walk over the top level "struct { ... } name;" members of the union.
+    # nested structs inside a variant (e.g. loaded_model.collision) are experimental and not serialised yet, so skip them
+    body = re.sub(r'//.*?$', '', union_body, flags=re.MULTILINE)
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.DOTALL)
+    struct_re = re.compile(r'struct\s*\{')
+    variants = {}
+    pos = 0
+    while True:
+        m = struct_re.search(body, pos)
+        if not m:
+            break
+        close = find_matching_brace(body, m.end() - 1)
+        name_m = re.match(r'\s*(\w+)\s*;', body[close + 1:]) if close != -1 else None
+        if not name_m:
+            common.log_error("Malformed variant struct in union")
+            return {}
+        variant_name = name_m.group(1)
+        inner = body[m.end():close]
+        pos = close + 1 + name_m.end()
+
+        # drop nested structs from the variant body
+        flat = ''
+        k = 0
+        while True:
+            n = struct_re.search(inner, k)
+            if not n:
+                flat += inner[k:]
+                break
+            flat += inner[k:n.start()]
+            n_close = find_matching_brace(inner, n.end() - 1)
+            n_name = re.match(r'\s*(\w+)\s*;', inner[n_close + 1:])
+            common.log_info(f"Skipping nested struct '{variant_name}.{n_name.group(1)}' (not serialised)")
+            k = n_close + 1 + n_name.end()
+
+        fields = []
+        for decl in flat.split(';'):
+            decl = decl.strip()
+            if not decl or decl.startswith('#'):
+                continue
+            fields.extend(common.parse_declaration_line(decl))
+        variants[variant_name] = fields
+    return variants
+
 def extract_union_variants(content: str) -> dict:
-    # Find "struct SceneObject"
-    idx = content.find("struct SceneObject")
+    # The type specific union is shared by every instance of a prefab, it lives in ScenePrefab::data
+    idx = content.find("union SceneObjectData")
     if idx == -1:
-        common.log_error("Could not find 'struct SceneObject'")
+        common.log_error("Could not find 'union SceneObjectData'")
         return {}
-    # Find the opening brace after that
     brace_start = content.find('{', idx)
     if brace_start == -1:
-        common.log_error("Could not find opening brace for SceneObject")
+        common.log_error("Could not find opening brace for SceneObjectData")
         return {}
-    # Count braces to find matching closing brace
-    brace_level = 1
-    i = brace_start + 1
-    while i < len(content):
-        ch = content[i]
-        if ch == '{':
-            brace_level += 1
-        elif ch == '}':
-            brace_level -= 1
-            if brace_level == 0:
-                struct_body = content[brace_start+1:i].strip()
-                break
-        i += 1
-    else:
-        common.log_error("Could not find closing brace for SceneObject")
+    brace_end = find_matching_brace(content, brace_start)
+    if brace_end == -1:
+        common.log_error("Could not find closing brace for SceneObjectData")
         return {}
 
-    # Find union inside struct_body
-    union_start = struct_body.find("union {")
-    if union_start == -1:
-        common.log_error("Could not find 'union {' in SceneObject")
-        return {}
-    # Count braces inside union
-    brace_level = 1
-    j = union_start + len("union {")
-    while j < len(struct_body):
-        ch = struct_body[j]
-        if ch == '{':
-            brace_level += 1
-        elif ch == '}':
-            brace_level -= 1
-            if brace_level == 0:
-                union_body = struct_body[union_start+len("union {"):j].strip()
-                break
-        j += 1
-    else:
-        common.log_error("Could not find closing brace for union")
-        return {}
-
-    # Parse nested structs inside union body
-    variants = common.parse_nested_structs(union_body)
-    return variants
+    return parse_union_variants(content[brace_start+1:brace_end])
 
 def generate_scene_json(input_h: Path, output_c: Path) -> bool:
     common.log_info(f"Reading input file: {input_h}")
@@ -75,80 +94,101 @@ def generate_scene_json(input_h: Path, output_c: Path) -> bool:
 
     common.log_info(f"Found variants: {list(variants.keys())}")
 
-    def write_variant_object(variant_name, fields, obj_prefix):
+    # primitive type is a ScenePrefab member, not part of the union, but it is written as "primitiveData" like a variant
+    all_variants = [('primitive', 'OBJECT_PRIMITIVE', [('PrimitiveType', 'primitiveType', False, None, False)], 'SCENE_FIELD_PRIMITIVE_TYPE')]
+    for variant_name, fields in variants.items():
+        all_variants.append((variant_name, f'OBJECT_{variant_name.upper()}', fields, None))
+
+    def field_dest(variant_name, name):
+        return 'p->primitiveType' if variant_name == 'primitive' else f'p->data.{variant_name}.{name}'
+
+    def field_bit(variant_name, name, primitive_bit):
+        return primitive_bit or f'SCENE_FIELD_{variant_name.upper()}_{name.upper()}'
+
+    def write_variant_object(variant_name, fields, primitive_bit):
         lines = []
         for typ, name, is_array, arr_sz, is_ptr in fields:
+            src = field_dest(variant_name, name)
+            lines.append(f'        if (fields & SceneFieldBit({field_bit(variant_name, name, primitive_bit)}))')
             if is_array and typ.startswith('char'):
-                lines.append(f'        cJSON_AddStringToObject({variant_name}Data, "{name}", {obj_prefix}.{name});')
+                lines.append(f'            cJSON_AddStringToObject({variant_name}Data, "{name}", {src});')
+            elif typ == 'StringId':
+                lines.append(f'            cJSON_AddStringToObject({variant_name}Data, "{name}", StringGet({src}));')
+            elif typ == 'DirectX::XMFLOAT3':
+                lines.append(f'            cJSON_AddItemToObject({variant_name}Data, "{name}", cJSON_CreateFloatArray((float*)&{src}, 3));')
+            elif typ == 'DirectX::XMFLOAT4':
+                lines.append(f'            cJSON_AddItemToObject({variant_name}Data, "{name}", cJSON_CreateFloatArray((float*)&{src}, 4));')
+            elif typ == 'PrimitiveType':
+                lines.append(f'            cJSON_AddStringToObject({variant_name}Data, "{name}", g_primitiveNames[{src}]);')
+            elif typ == 'RenderPipeline':
+                lines.append(f'            cJSON_AddStringToObject({variant_name}Data, "{name}", g_renderPipelineNames[{src}]);')
             else:
-                if typ == 'DirectX::XMFLOAT3':
-                    arr = f"{name}Arr"
-                    lines.append(f'        cJSON* {arr} = cJSON_CreateFloatArray((float*)&{obj_prefix}.{name}, 3);')
-                    lines.append(f'        cJSON_AddItemToObject({variant_name}Data, "{name}", {arr});')
-                elif typ == 'DirectX::XMFLOAT4':
-                    arr = f"{name}Arr"
-                    lines.append(f'        cJSON* {arr} = cJSON_CreateFloatArray((float*)&{obj_prefix}.{name}, 4);')
-                    lines.append(f'        cJSON_AddItemToObject({variant_name}Data, "{name}", {arr});')
-                elif typ == 'PrimitiveType':
-                    lines.append(f'        cJSON_AddStringToObject({variant_name}Data, "{name}", g_primitiveNames[{obj_prefix}.{name}]);')
-                elif typ == 'RenderPipeline':
-                    lines.append(f'        cJSON_AddStringToObject({variant_name}Data, "{name}", g_renderPipelineNames[{obj_prefix}.{name}]);')
-                else:
-                    # fallback: treat as number
-                    lines.append(f'        cJSON_AddNumberToObject({variant_name}Data, "{name}", {obj_prefix}.{name});')
+                # fallback: treat as number
+                lines.append(f'            cJSON_AddNumberToObject({variant_name}Data, "{name}", {src});')
         return lines
 
-    def parse_variant_object(variant_name, fields, obj_dest):
+    def parse_variant_object(variant_name, fields, primitive_bit):
         lines = []
-        lines.append(f'            cJSON* {variant_name}Data = cJSON_GetObjectItem(objJson, "{variant_name}Data");')
-        lines.append(f'            if ({variant_name}Data) {{')
+        lines.append(f'        cJSON* {variant_name}Data = cJSON_GetObjectItem(json, "{variant_name}Data");')
+        lines.append(f'        if ({variant_name}Data) {{')
         for typ, name, is_array, arr_sz, is_ptr in fields:
+            dest = field_dest(variant_name, name)
+            bit = f'fields |= SceneFieldBit({field_bit(variant_name, name, primitive_bit)});'
+            lines.append(f'            cJSON* {name}Item = cJSON_GetObjectItem({variant_name}Data, "{name}");')
             if is_array and typ.startswith('char'):
-                lines.append(f'                cJSON* {name}Item = cJSON_GetObjectItem({variant_name}Data, "{name}");')
-                lines.append(f'                if (cJSON_IsString({name}Item)) strncpy_s({obj_dest}.{name}, {name}Item->valuestring, sizeof({obj_dest}.{name})-1);')
+                lines.extend([
+                    f'            if (cJSON_IsString({name}Item)) {{',
+                    f'                strncpy_s({dest}, {name}Item->valuestring, sizeof({dest})-1);',
+                    f'                {bit}',
+                    f'            }}',
+                ])
+            elif typ == 'StringId':
+                lines.extend([
+                    f'            if (cJSON_IsString({name}Item)) {{',
+                    f'                {dest} = StringIntern({name}Item->valuestring);',
+                    f'                {bit}',
+                    f'            }}',
+                ])
+            elif typ in ('DirectX::XMFLOAT3', 'DirectX::XMFLOAT4'):
+                n = 3 if typ == 'DirectX::XMFLOAT3' else 4
+                lines.extend([
+                    f'            if (cJSON_IsArray({name}Item) && cJSON_GetArraySize({name}Item) == {n}) {{',
+                    f'                for (int j = 0; j < {n}; ++j)',
+                    f'                    ((float*)&{dest})[j] = (float)cJSON_GetArrayItem({name}Item, j)->valuedouble;',
+                    f'                {bit}',
+                    f'            }}',
+                ])
+            elif typ == 'PrimitiveType':
+                lines.extend([
+                    f'            if (cJSON_IsString({name}Item)) {{',
+                    f'                const char* typeName = {name}Item->valuestring;',
+                    f'                int found = -1;',
+                    f'                for (int idx = 0; idx < PRIMITIVE_COUNT; idx++) {{',
+                    f'                    if (strcmp(typeName, g_primitiveNames[idx]) == 0) {{',
+                    f'                        found = idx;',
+                    f'                        break;',
+                    f'                    }}',
+                    f'                }}',
+                    f'                if (found != -1) {dest} = (PrimitiveType)found;',
+                    f'                else {{',
+                    f'                    {dest} = PRIMITIVE_CUBE;',
+                    f'                    fprintf(stderr, "Unknown primitive type \\"%s\\", defaulting to Cube\\n", typeName);',
+                    f'                }}',
+                    f'                {bit}',
+                    f'            }} else if (cJSON_IsNumber({name}Item)) {{',
+                    f'                {dest} = (PrimitiveType){name}Item->valueint;',
+                    f'                {bit}',
+                    f'            }}'
+                ])
             else:
-                if typ == 'DirectX::XMFLOAT3':
-                    lines.append(f'                cJSON* {name}Item = cJSON_GetObjectItem({variant_name}Data, "{name}");')
-                    lines.extend([
-                        f'                if (cJSON_IsArray({name}Item) && cJSON_GetArraySize({name}Item) == 3) {{',
-                        f'                    for (int j = 0; j < 3; ++j)',
-                        f'                        ((float*)&{obj_dest}.{name})[j] = (float)cJSON_GetArrayItem({name}Item, j)->valuedouble;',
-                        f'                }}'
-                    ])
-                elif typ == 'DirectX::XMFLOAT4':
-                    lines.append(f'                cJSON* {name}Item = cJSON_GetObjectItem({variant_name}Data, "{name}");')
-                    lines.extend([
-                        f'                if (cJSON_IsArray({name}Item) && cJSON_GetArraySize({name}Item) == 4) {{',
-                        f'                    for (int j = 0; j < 4; ++j)',
-                        f'                        ((float*)&{obj_dest}.{name})[j] = (float)cJSON_GetArrayItem({name}Item, j)->valuedouble;',
-                        f'                }}'
-                    ])
-                elif typ == 'PrimitiveType':
-                    lines.append(f'                cJSON* {name}Item = cJSON_GetObjectItem({variant_name}Data, "{name}");')
-                    lines.extend([
-                        f'                if (cJSON_IsString({name}Item)) {{',
-                        f'                    const char* typeName = {name}Item->valuestring;',
-                        f'                    int found = -1;',
-                        f'                    for (int idx = 0; idx < PRIMITIVE_COUNT; idx++) {{',
-                        f'                        if (strcmp(typeName, g_primitiveNames[idx]) == 0) {{',
-                        f'                            found = idx;',
-                        f'                            break;',
-                        f'                        }}',
-                        f'                    }}',
-                        f'                    if (found != -1) {obj_dest}.{name} = (PrimitiveType)found;',
-                        f'                    else {{',
-                        f'                        {obj_dest}.{name} = PRIMITIVE_CUBE;',
-                        f'                        fprintf(stderr, "Unknown primitive type \\"%s\\", defaulting to Cube\\n", typeName);',
-                        f'                    }}',
-                        f'                }} else if (cJSON_IsNumber({name}Item)) {{',
-                        f'                    {obj_dest}.{name} = (PrimitiveType){name}Item->valueint;',
-                        f'                }}'
-                    ])
-                else:
-                    # For other numeric types, cast using the type name
-                    lines.append(f'                cJSON* {name}Item = cJSON_GetObjectItem({variant_name}Data, "{name}");')
-                    lines.append(f'                if (cJSON_IsNumber({name}Item)) {obj_dest}.{name} = ({typ}){name}Item->valuedouble;')
-        lines.append(f'            }}')
+                # For other numeric types, cast using the type name
+                lines.extend([
+                    f'            if (cJSON_IsNumber({name}Item)) {{',
+                    f'                {dest} = ({typ}){name}Item->valuedouble;',
+                    f'                {bit}',
+                    f'            }}',
+                ])
+        lines.append(f'        }}')
         return lines
 
     # Build output C code
@@ -157,10 +197,46 @@ def generate_scene_json(input_h: Path, output_c: Path) -> bool:
     lines = [
         '#include <cJSON.h>',
         '#include "src/scene_data.h"',
-        '#include "mesh_data.h"',
+        '#include "src/scene_prefab.h"',
+        '#include "primitive_types.h"',
         '#include "render_pipeline_data.h"',
         '#include <string.h>',
         '#include <stdio.h>',
+        '#include <vector>',
+        '',
+        '// file layout: "prefabs" holds the authored prefabs, every object is a transform, "prefab" (index into that array)',
+        '// and optionally "overrides", a partial prefab with only the overridden fields. objects from before prefabs',
+        '// carry objectType/pipeline/<type>Data themselves, they are folded into shared prefabs on load',
+        '',
+        '// ------------------------------------------------------------',
+        '// prefab fields → json, only the SceneField bits in fields',
+        '// ------------------------------------------------------------',
+        'static void scene_prefab_to_json(cJSON* json, const ScenePrefab* p, uint32_t fields) {',
+        '    if (fields & SceneFieldBit(SCENE_FIELD_OBJECT_TYPE))',
+        '        cJSON_AddStringToObject(json, "objectType", g_objectTypeNames[p->objectType]);',
+        '    if (fields & SceneFieldBit(SCENE_FIELD_PIPELINE))',
+        '        cJSON_AddStringToObject(json, "pipeline", g_renderPipelineNames[p->pipeline]);',
+        '',
+        '    // Type‑specific data',
+        '    switch (p->objectType) {',
+    ]
+
+    for variant_name, enum_name, fields, primitive_bit in all_variants:
+        lines.append(f'    case {enum_name}: {{')
+        lines.append(f'        cJSON* {variant_name}Data = cJSON_CreateObject();')
+        lines.extend(write_variant_object(variant_name, fields, primitive_bit))
+        lines.append(f'        if ({variant_name}Data->child)')
+        lines.append(f'            cJSON_AddItemToObject(json, "{variant_name}Data", {variant_name}Data);')
+        lines.append(f'        else')
+        lines.append(f'            cJSON_Delete({variant_name}Data);')
+        lines.append(f'        break;')
+        lines.append(f'    }}')
+
+    lines.extend([
+        '    default:',
+        '        break;',
+        '    }',
+        '}',
         '',
         '// ------------------------------------------------------------',
         '// Serialise Scene → JSON string (caller must free with cJSON_free)',
@@ -171,47 +247,46 @@ def generate_scene_json(input_h: Path, output_c: Path) -> bool:
         '    // objectCount',
         '    cJSON_AddNumberToObject(root, "objectCount", scene->objectCount);',
         '',
+        '    // authored prefabs only, variants are written as their base plus "overrides" on each instance',
+        '    std::vector<int> prefabIndex(scene->prefabs.size(), -1);',
+        '    int prefabCount = 0;',
+        '    cJSON* prefabsArray = cJSON_CreateArray();',
+        '    for (size_t p = 0; p < scene->prefabs.size(); ++p) {',
+        '        const ScenePrefab* prefab = &scene->prefabs[p];',
+        '        if (prefab->base != SCENE_PREFAB_NONE)',
+        '            continue;',
+        '        prefabIndex[p] = prefabCount++;',
+        '        cJSON* prefabJson = cJSON_CreateObject();',
+        '        cJSON_AddStringToObject(prefabJson, "name", StringGet(prefab->name));',
+        '        scene_prefab_to_json(prefabJson, prefab, ~0u);',
+        '        cJSON_AddItemToArray(prefabsArray, prefabJson);',
+        '    }',
+        '    cJSON_AddItemToObject(root, "prefabs", prefabsArray);',
+        '',
         '    // objects array',
         '    cJSON* objectsArray = cJSON_CreateArray();',
         '    for (int i = 0; i < scene->objectCount; ++i) {',
-        '        const SceneObject* obj = &scene->objects[i];',
+        '        const SceneObjectInfo* info = &scene->info[i];',
+        '        const ScenePrefab* prefab = &SceneObjectPrefab(*scene, i);',
         '        cJSON* objJson = cJSON_CreateObject();',
         '',
         '        // Common fields',
-        '        cJSON_AddStringToObject(objJson, "nametag", obj->nametag);',
+        '        cJSON_AddStringToObject(objJson, "nametag", StringGet(info->nametag));',
         '',
-        '        cJSON* posArr = cJSON_CreateFloatArray((float*)&obj->pos, 3);',
+        '        cJSON* posArr = cJSON_CreateFloatArray((float*)&scene->pos[i], 3);',
         '        cJSON_AddItemToObject(objJson, "pos", posArr);',
         '',
-        '        cJSON* rotArr = cJSON_CreateFloatArray((float*)&obj->rot, 4);',
+        '        cJSON* rotArr = cJSON_CreateFloatArray((float*)&scene->rot[i], 4);',
         '        cJSON_AddItemToObject(objJson, "rot", rotArr);',
         '',
-        '        cJSON* scaleArr = cJSON_CreateFloatArray((float*)&obj->scale, 3);',
+        '        cJSON* scaleArr = cJSON_CreateFloatArray((float*)&scene->scale[i], 3);',
         '        cJSON_AddItemToObject(objJson, "scale", scaleArr);',
         '',
-        '        cJSON_AddStringToObject(objJson, "objectType", g_objectTypeNames[obj->objectType]);',
-        '        cJSON_AddStringToObject(objJson, "pipeline", g_renderPipelineNames[obj->pipeline]);',
-        '',
-        '        // Type‑specific data',
-        '        switch (obj->objectType) {',
-    ]
-
-    # Generate cases for each variant
-    for variant_name, fields in variants.items():
-        enum_name = f"OBJECT_{variant_name.upper()}"
-        lines.append(f'            case {enum_name}: {{')
-        data_obj_name = f"{variant_name}Data"
-        lines.append(f'                cJSON* {data_obj_name} = cJSON_CreateObject();')
-        write_lines = write_variant_object(variant_name, fields, f"obj->data.{variant_name}")
-        for l in write_lines:
-            lines.append('    ' + l)
-        lines.append(f'                cJSON_AddItemToObject(objJson, "{variant_name}Data", {data_obj_name});')
-        lines.append(f'                break;')
-        lines.append(f'            }}')
-
-    lines.extend([
-        '            default:',
-        '                break;',
+        '        cJSON_AddNumberToObject(objJson, "prefab", prefabIndex[ScenePrefabRoot(*scene, scene->prefab[i])]);',
+        '        if (prefab->overrideMask != 0) {',
+        '            cJSON* overrides = cJSON_CreateObject();',
+        '            scene_prefab_to_json(overrides, prefab, prefab->overrideMask);',
+        '            cJSON_AddItemToObject(objJson, "overrides", overrides);',
         '        }',
         '',
         '        cJSON_AddItemToArray(objectsArray, objJson);',
@@ -224,6 +299,72 @@ def generate_scene_json(input_h: Path, output_c: Path) -> bool:
         '}',
         '',
         '// ------------------------------------------------------------',
+        '// json → prefab fields: a "prefabs" entry, an object written before prefabs existed, or an "overrides" block',
+        '// (withType false, an instance can not change its type). returns the SceneField bits that were read',
+        '// ------------------------------------------------------------',
+        'static uint32_t scene_prefab_from_json(cJSON* json, ScenePrefab* p, bool withType) {',
+        '    uint32_t fields = 0;',
+        '',
+        '    cJSON* objectTypeItem = withType ? cJSON_GetObjectItem(json, "objectType") : nullptr;',
+        '    if (cJSON_IsNumber(objectTypeItem)) {',
+        '        p->objectType = (ObjectType)objectTypeItem->valueint;',
+        '        fields |= SceneFieldBit(SCENE_FIELD_OBJECT_TYPE);',
+        '    } else if (cJSON_IsString(objectTypeItem)) {',
+        '        const char* typeName = objectTypeItem->valuestring;',
+        '        int found = -1;',
+        '        for (int idx = 0; idx < OBJECT_COUNT; idx++) {',
+        '            if (strcmp(typeName, g_objectTypeNames[idx]) == 0) {',
+        '                found = idx;',
+        '                break;',
+        '            }',
+        '        }',
+        '        if (found != -1) p->objectType = (ObjectType)found;',
+        '        else {',
+        '            p->objectType = OBJECT_PRIMITIVE;',
+        '            fprintf(stderr, "Unknown object type \\"%s\\", defaulting to Primitive\\n", typeName);',
+        '        }',
+        '        fields |= SceneFieldBit(SCENE_FIELD_OBJECT_TYPE);',
+        '    }',
+        '',
+        '    cJSON* pipelineItem = cJSON_GetObjectItem(json, "pipeline");',
+        '    if (cJSON_IsNumber(pipelineItem)) {',
+        '        p->pipeline = (RenderPipeline)pipelineItem->valueint;',
+        '        fields |= SceneFieldBit(SCENE_FIELD_PIPELINE);',
+        '    } else if (cJSON_IsString(pipelineItem)) {',
+        '        const char* pipeName = pipelineItem->valuestring;',
+        '        int found = -1;',
+        '        for (int idx = 0; idx < RENDER_COUNT; idx++) {',
+        '            if (strcmp(pipeName, g_renderPipelineNames[idx]) == 0) {',
+        '                found = idx;',
+        '                break;',
+        '            }',
+        '        }',
+        '        if (found != -1) p->pipeline = (RenderPipeline)found;',
+        '        else {',
+        '            p->pipeline = RENDER_DEFAULT;',
+        '            fprintf(stderr, "Unknown pipeline \\"%s\\", defaulting to Default\\n", pipeName);',
+        '        }',
+        '        fields |= SceneFieldBit(SCENE_FIELD_PIPELINE);',
+        '    }',
+        '',
+        '    // Type‑specific data',
+        '    switch (p->objectType) {',
+    ])
+
+    for variant_name, enum_name, fields, primitive_bit in all_variants:
+        lines.append(f'    case {enum_name}: {{')
+        lines.extend(parse_variant_object(variant_name, fields, primitive_bit))
+        lines.append(f'        break;')
+        lines.append(f'    }}')
+
+    lines.extend([
+        '    default:',
+        '        break;',
+        '    }',
+        '    return fields;',
+        '}',
+        '',
+        '// ------------------------------------------------------------',
         '// Parse JSON → Scene (returns 1 on success, 0 on failure)',
         '// ------------------------------------------------------------',
         'int scene_from_json(const char* json, Scene* scene) {',
@@ -231,115 +372,1006 @@ def generate_scene_json(input_h: Path, output_c: Path) -> bool:
         '    if (!root) return 0;',
         '',
         '    // Clear scene first (set defaults)',
-        '    memset(scene, 0, sizeof(Scene));',
-        '    scene->objectCount = 0;',
+        '    SceneClear(*scene);',
+        '',
+        '    // "objectCount" is written for readability only, the objects array is what counts',
         '',
-        '    // objectCount (optional)',
-        '    cJSON* countItem = cJSON_GetObjectItem(root, "objectCount");',
-        '    if (cJSON_IsNumber(countItem)) scene->objectCount = countItem->valueint;',
+        '    // prefabs array, json index k is prefab id k',
+        '    int prefabCount = 0;',
+        '    cJSON* prefabArray = cJSON_GetObjectItem(root, "prefabs");',
+        '    if (cJSON_IsArray(prefabArray)) {',
+        '        cJSON* prefabJson = nullptr;',
+        '        cJSON_ArrayForEach(prefabJson, prefabArray) {',
+        '            ScenePrefab prefab = ScenePrefabDefault();',
+        '            cJSON* nameItem = cJSON_GetObjectItem(prefabJson, "name");',
+        '            if (cJSON_IsString(nameItem)) prefab.name = StringIntern(nameItem->valuestring);',
+        '            scene_prefab_from_json(prefabJson, &prefab, true);',
+        '            if (prefab.name == STRING_ID_EMPTY) prefab.name = ScenePrefabDefaultName(prefab);',
+        '            ScenePrefabAdd(*scene, prefab);',
+        '            prefabCount++;',
+        '        }',
+        '    }',
         '',
         '    // objects array',
         '    cJSON* objArray = cJSON_GetObjectItem(root, "objects");',
         '    if (cJSON_IsArray(objArray)) {',
-        '        int arraySize = cJSON_GetArraySize(objArray);',
-        '        for (int i = 0; i < arraySize && i < MAX_SCENE_OBJECTS; ++i) {',
-        '            cJSON* objJson = cJSON_GetArrayItem(objArray, i);',
-        '            SceneObject* obj = &scene->objects[i];',
+        '        SceneReserve(*scene, cJSON_GetArraySize(objArray));',
+        '        cJSON* objJson = nullptr;',
+        '        cJSON_ArrayForEach(objJson, objArray) { // not cJSON_GetArrayItem(i), that walks the list from the start every time',
+        '            SceneAddObject(*scene, SCENE_PREFAB_NONE);',
+        '            int i = scene->objectCount - 1;',
+        '            SceneObjectInfo* info = &scene->info[i];',
         '',
         '            // Common fields',
         '            cJSON* nametagItem = cJSON_GetObjectItem(objJson, "nametag");',
-        '            if (cJSON_IsString(nametagItem)) strncpy_s(obj->nametag, nametagItem->valuestring, sizeof(obj->nametag)-1);',
+        '            if (cJSON_IsString(nametagItem)) info->nametag = StringIntern(nametagItem->valuestring);',
         '',
         '            cJSON* posItem = cJSON_GetObjectItem(objJson, "pos");',
         '            if (cJSON_IsArray(posItem) && cJSON_GetArraySize(posItem) == 3) {',
         '                for (int j = 0; j < 3; ++j)',
-        '                    ((float*)&obj->pos)[j] = (float)cJSON_GetArrayItem(posItem, j)->valuedouble;',
+        '                    ((float*)&scene->pos[i])[j] = (float)cJSON_GetArrayItem(posItem, j)->valuedouble;',
         '            }',
         '',
         '            cJSON* rotItem = cJSON_GetObjectItem(objJson, "rot");',
         '            if (cJSON_IsArray(rotItem) && cJSON_GetArraySize(rotItem) == 4) {',
         '                for (int j = 0; j < 4; ++j)',
-        '                    ((float*)&obj->rot)[j] = (float)cJSON_GetArrayItem(rotItem, j)->valuedouble;',
+        '                    ((float*)&scene->rot[i])[j] = (float)cJSON_GetArrayItem(rotItem, j)->valuedouble;',
         '            }',
         '',
         '            cJSON* scaleItem = cJSON_GetObjectItem(objJson, "scale");',
         '            if (cJSON_IsArray(scaleItem) && cJSON_GetArraySize(scaleItem) == 3) {',
         '                for (int j = 0; j < 3; ++j)',
-        '                    ((float*)&obj->scale)[j] = (float)cJSON_GetArrayItem(scaleItem, j)->valuedouble;',
+        '                    ((float*)&scene->scale[i])[j] = (float)cJSON_GetArrayItem(scaleItem, j)->valuedouble;',
         '            }',
         '',
-        '            cJSON* objectTypeItem = cJSON_GetObjectItem(objJson, "objectType");',
-        '            if (cJSON_IsNumber(objectTypeItem)) {',
-        '                obj->objectType = (ObjectType)objectTypeItem->valueint;',
-        '            } else if (cJSON_IsString(objectTypeItem)) {',
-        '                const char* typeName = objectTypeItem->valuestring;',
-        '                int found = -1;',
-        '                for (int idx = 0; idx < OBJECT_COUNT; idx++) {',
-        '                    if (strcmp(typeName, g_objectTypeNames[idx]) == 0) {',
-        '                        found = idx;',
-        '                        break;',
-        '                    }',
-        '                }',
-        '                if (found != -1) obj->objectType = (ObjectType)found;',
-        '                else {',
-        '                    obj->objectType = OBJECT_PRIMITIVE;',
-        '                    fprintf(stderr, "Unknown object type \\"%s\\", defaulting to Primitive\\n", typeName);',
-        '                }',
+        '            uint32_t prefab;',
+        '            cJSON* prefabItem = cJSON_GetObjectItem(objJson, "prefab");',
+        '            if (cJSON_IsNumber(prefabItem) && prefabItem->valueint >= 0 && prefabItem->valueint < prefabCount) {',
+        '                prefab = (uint32_t)prefabItem->valueint;',
+        '            } else {',
+        '                // no (usable) prefab: the object has its own type and data, the same data shares one prefab',
+        '                ScenePrefab own = ScenePrefabDefault();',
+        '                scene_prefab_from_json(objJson, &own, true);',
+        '                prefab = SceneFindOrAddPrefab(*scene, own);',
         '            }',
         '',
-        '            cJSON* pipelineItem = cJSON_GetObjectItem(objJson, "pipeline");',
-        '            if (cJSON_IsNumber(pipelineItem)) {',
-        '                obj->pipeline = (RenderPipeline)pipelineItem->valueint;',
-        '            } else if (cJSON_IsString(pipelineItem)) {',
-        '                const char* pipeName = pipelineItem->valuestring;',
-        '                int found = -1;',
-        '                for (int idx = 0; idx < RENDER_COUNT; idx++) {',
-        '                    if (strcmp(pipeName, g_renderPipelineNames[idx]) == 0) {',
-        '                        found = idx;',
-        '                        break;',
-        '                    }',
-        '                }',
-        '                if (found != -1) obj->pipeline = (RenderPipeline)found;',
-        '                else {',
-        '                    obj->pipeline = RENDER_DEFAULT;',
-        '                    fprintf(stderr, "Unknown pipeline \\"%s\\", defaulting to Default\\n", pipeName);',
-        '                }',
+        '            cJSON* overridesItem = cJSON_GetObjectItem(objJson, "overrides");',
+        '            if (cJSON_IsObject(overridesItem)) {',
+        '                ScenePrefab values = scene->prefabs[prefab];',
+        '                uint32_t fields = scene_prefab_from_json(overridesItem, &values, false);',
+        '                prefab = ScenePrefabVariant(*scene, prefab, fields, values);',
         '            }',
+        '            scene->prefab[i] = prefab;',
+        '        }',
+        '    }',
         '',
-        '            // Type‑specific data',
-        '            switch (obj->objectType) {',
+        '    cJSON_Delete(root);',
+        '    return 1;',
+        '}'
     ])
 
-    # Generate parsing cases for each variant
+    output_c.parent.mkdir(parents=True, exist_ok=True)
+    with open(output_c, 'w', encoding='utf-8') as f:
+        f.write(header + '\n' + '\n'.join(lines))
+
+    common.log_success(f"Generated {output_c}")
+    return True
+
+# ----------------------------------------------------------------------
+# Streaming reader: one pass over the text straight into the Scene streams, no cJSON tree.
+# Has to read every file exactly like scene_from_json above (first matching key wins, keys compare
+# case insensitively, variant data only for the object's own type) so both readers give the same Scene.
+# ----------------------------------------------------------------------
+def fnv1a32(name: str, seed: int) -> int:
+    h = seed
+    for b in name.encode('utf-8'):
+        h ^= b
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+def find_perfect_hash(names: list) -> tuple:
+    """Smallest power of two table + seed where every name lands in its own slot."""
+    bits = 1
+    while (1 << bits) < len(names):
+        bits += 1
+    while True:
+        size = 1 << bits
+        for seed in range(1, 1 << 16):
+            # top bits, the low bits of an fnv product only depend on the low bits of the seed
+            slots = [fnv1a32(n, seed) >> (32 - bits) for n in names]
+            if len(set(slots)) == len(names):
+                table = [-1] * size
+                for idx, slot in enumerate(slots):
+                    table[slot] = idx
+                return seed, bits, table
+        bits += 1
+
+STREAM_RUNTIME = r"""
+// same limit as cJSON, a hostile file can't blow the stack
+#define SJ_NESTING_LIMIT 1000
+
+struct SceneJsonCursor
+{
+    const char *p; // input has to be null terminated (SDL_LoadFile does that)
+};
+
+static void sj_skip_ws(SceneJsonCursor &c)
+{
+    while (*c.p && (unsigned char)*c.p <= 32)
+        c.p++;
+}
+
+static bool sj_consume(SceneJsonCursor &c, char ch)
+{
+    sj_skip_ws(c);
+    if (*c.p != ch)
+        return false;
+    c.p++;
+    return true;
+}
+
+static bool sj_is_number_start(char ch)
+{
+    return ch == '-' || (ch >= '0' && ch <= '9');
+}
+
+// cJSON_GetObjectItem compares keys case insensitively
+static bool sj_key(const char *key, const char *name)
+{
+    for (; *key && *name; ++key, ++name)
+    {
+        if (tolower((unsigned char)*key) != tolower((unsigned char)*name))
+            return false;
+    }
+    return *key == *name;
+}
+
+// only the first member with a given key counts, like cJSON_GetObjectItem
+static bool sj_first(uint32_t &seen, uint32_t bit)
+{
+    bool first = (seen & bit) == 0;
+    seen |= bit;
+    return first;
+}
+
+static int sj_hex4(const char *s)
+{
+    int v = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+        char h = s[k];
+        v <<= 4;
+        if (h >= '0' && h <= '9') v |= h - '0';
+        else if (h >= 'a' && h <= 'f') v |= h - 'a' + 10;
+        else if (h >= 'A' && h <= 'F') v |= h - 'A' + 10;
+        else return -1;
+    }
+    return v;
+}
+
+static void sj_put(char *dst, int dstSize, int &len, char ch)
+{
+    if (len < dstSize - 1)
+        dst[len] = ch;
+    len++;
+}
+
+// decodes the string at the cursor into dst keeping at most dstSize-1 bytes (same as the strncpy_s in the cJSON path).
+// dst may be null with dstSize 0 to just skip it. returns the full decoded length, -1 if malformed
+static int sj_string(SceneJsonCursor &c, char *dst, int dstSize)
+{
+    sj_skip_ws(c);
+    if (*c.p != '"')
+        return -1;
+    const char *s = c.p + 1;
+    int len = 0;
+    while (*s != '"')
+    {
+        if (*s == '\0')
+            return -1;
+        if (*s != '\\')
+        {
+            sj_put(dst, dstSize, len, *s++);
+            continue;
+        }
+        s++;
+        switch (*s)
+        {
+        case 'b': sj_put(dst, dstSize, len, '\b'); break;
+        case 'f': sj_put(dst, dstSize, len, '\f'); break;
+        case 'n': sj_put(dst, dstSize, len, '\n'); break;
+        case 'r': sj_put(dst, dstSize, len, '\r'); break;
+        case 't': sj_put(dst, dstSize, len, '\t'); break;
+        case '"':
+        case '\\':
+        case '/': sj_put(dst, dstSize, len, *s); break;
+        case 'u':
+        {
+            int hi = sj_hex4(s + 1);
+            if (hi < 0 || (hi >= 0xDC00 && hi <= 0xDFFF))
+                return -1;
+            s += 4;
+            uint32_t cp = (uint32_t)hi;
+            if (hi >= 0xD800 && hi <= 0xDBFF)
+            {
+                if (s[1] != '\\' || s[2] != 'u')
+                    return -1;
+                int lo = sj_hex4(s + 3);
+                if (lo < 0xDC00 || lo > 0xDFFF)
+                    return -1;
+                cp = 0x10000 + ((((uint32_t)hi & 0x3FF) << 10) | ((uint32_t)lo & 0x3FF));
+                s += 6;
+            }
+            if (cp < 0x80)
+                sj_put(dst, dstSize, len, (char)cp);
+            else if (cp < 0x800)
+            {
+                sj_put(dst, dstSize, len, (char)(0xC0 | (cp >> 6)));
+                sj_put(dst, dstSize, len, (char)(0x80 | (cp & 0x3F)));
+            }
+            else if (cp < 0x10000)
+            {
+                sj_put(dst, dstSize, len, (char)(0xE0 | (cp >> 12)));
+                sj_put(dst, dstSize, len, (char)(0x80 | ((cp >> 6) & 0x3F)));
+                sj_put(dst, dstSize, len, (char)(0x80 | (cp & 0x3F)));
+            }
+            else
+            {
+                sj_put(dst, dstSize, len, (char)(0xF0 | (cp >> 18)));
+                sj_put(dst, dstSize, len, (char)(0x80 | ((cp >> 12) & 0x3F)));
+                sj_put(dst, dstSize, len, (char)(0x80 | ((cp >> 6) & 0x3F)));
+                sj_put(dst, dstSize, len, (char)(0x80 | (cp & 0x3F)));
+            }
+            break;
+        }
+        default:
+            return -1;
+        }
+        s++;
+    }
+    c.p = s + 1;
+    if (dstSize > 0)
+        dst[len < dstSize - 1 ? len : dstSize - 1] = '\0';
+    return len;
+}
+
+// string value straight into the string table. short strings decode on the stack, longer ones go round again
+static bool sj_intern_string(SceneJsonCursor &c, StringId *out)
+{
+    char buf[512];
+    SceneJsonCursor start = c;
+    int len = sj_string(c, buf, sizeof(buf));
+    if (len < 0)
+        return false;
+    if (len < (int)sizeof(buf))
+    {
+        *out = StringIntern(buf, (size_t)len);
+        return true;
+    }
+    std::vector<char> big((size_t)len + 1);
+    sj_string(start, big.data(), len + 1);
+    *out = StringIntern(big.data(), (size_t)len);
+    return true;
+}
+
+// same as cJSON parse_number: copy the number characters out and let strtod decide where it ends
+static bool sj_number(SceneJsonCursor &c, double *out)
+{
+    sj_skip_ws(c);
+    char buf[64];
+    int n = 0;
+    for (const char *s = c.p; n < (int)sizeof(buf) - 1; ++s)
+    {
+        char ch = *s;
+        if (!((ch >= '0' && ch <= '9') || ch == '+' || ch == '-' || ch == 'e' || ch == 'E' || ch == '.'))
+            break;
+        buf[n++] = ch;
+    }
+    buf[n] = '\0';
+    char *end = nullptr;
+    double d = strtod(buf, &end);
+    if (end == buf)
+        return false;
+    c.p += end - buf;
+    *out = d;
+    return true;
+}
+
+// cJSON valueint, saturated
+static int sj_valueint(double d)
+{
+    if (d >= INT_MAX)
+        return INT_MAX;
+    if (d <= (double)INT_MIN)
+        return INT_MIN;
+    return (int)d;
+}
+
+static bool sj_skip_value(SceneJsonCursor &c, int depth = 0)
+{
+    sj_skip_ws(c);
+    char ch = *c.p;
+    if (ch == '"')
+        return sj_string(c, nullptr, 0) >= 0;
+    if (sj_is_number_start(ch))
+    {
+        double d;
+        return sj_number(c, &d);
+    }
+    if (strncmp(c.p, "null", 4) == 0 || strncmp(c.p, "true", 4) == 0)
+    {
+        c.p += 4;
+        return true;
+    }
+    if (strncmp(c.p, "false", 5) == 0)
+    {
+        c.p += 5;
+        return true;
+    }
+    if (ch != '[' && ch != '{')
+        return false;
+    if (depth >= SJ_NESTING_LIMIT)
+        return false;
+
+    char close = ch == '[' ? ']' : '}';
+    c.p++;
+    if (sj_consume(c, close))
+        return true;
+    for (;;)
+    {
+        if (ch == '{' && (sj_string(c, nullptr, 0) < 0 || !sj_consume(c, ':')))
+            return false;
+        if (!sj_skip_value(c, depth + 1))
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, close);
+    }
+}
+
+// [x, y, z] into want floats. like the cJSON path they are only written when the item count matches,
+// items that are not numbers read as 0. *assigned (if given) says whether they were
+static bool sj_float_array(SceneJsonCursor &c, float *dst, int want, bool *assigned = nullptr)
+{
+    if (assigned)
+        *assigned = false;
+    sj_skip_ws(c);
+    if (*c.p != '[')
+        return sj_skip_value(c);
+    c.p++;
+
+    double vals[4] = {};
+    int count = 0;
+    if (!sj_consume(c, ']'))
+    {
+        for (;;)
+        {
+            sj_skip_ws(c);
+            double v = 0.0;
+            if (sj_is_number_start(*c.p))
+            {
+                if (!sj_number(c, &v))
+                    return false;
+            }
+            else if (!sj_skip_value(c))
+                return false;
+            if (count < 4)
+                vals[count] = v;
+            count++;
+            if (sj_consume(c, ','))
+                continue;
+            if (sj_consume(c, ']'))
+                break;
+            return false;
+        }
+    }
+    if (count == want)
+    {
+        for (int j = 0; j < want; ++j)
+            dst[j] = (float)vals[j];
+        if (assigned)
+            *assigned = true;
+    }
+    return true;
+}
+
+// enum stored either as a name (resolved by lookup) or a raw number. anything else leaves *out alone
+static bool sj_enum(SceneJsonCursor &c, int (*lookup)(const char *), int fallback, const char *unknownFmt, int *out)
+{
+    sj_skip_ws(c);
+    if (*c.p == '"')
+    {
+        char name[128];
+        if (sj_string(c, name, sizeof(name)) < 0)
+            return false;
+        int found = lookup(name);
+        if (found < 0)
+        {
+            fprintf(stderr, unknownFmt, name);
+            found = fallback;
+        }
+        *out = found;
+        return true;
+    }
+    if (sj_is_number_start(*c.p))
+    {
+        double d;
+        if (!sj_number(c, &d))
+            return false;
+        *out = sj_valueint(d);
+        return true;
+    }
+    return sj_skip_value(c);
+}
+
+// fnv-1a with a per table seed, meta_scene_json.py searches for seeds where every name gets its own slot
+static uint32_t sj_name_hash(const char *s, uint32_t seed)
+{
+    uint32_t h = seed;
+    while (*s)
+    {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+"""
+
+def generate_scene_json_stream(input_h: Path, output_c: Path) -> bool:
+    with open(input_h, 'r', encoding='utf-8') as f:
+        content = f.read()
+    variants = extract_union_variants(content)
+    if not variants:
+        common.log_error("No union variants found")
+        return False
+
+    # lookup tables are built from the same name arrays the cJSON reader loops over
+    name_tables = [
+        ('objectType', 'g_objectTypeNames', common.parse_string_array(input_h, 'g_objectTypeNames')),
+        ('pipeline', 'g_renderPipelineNames', common.parse_string_array('src/render_pipeline_data.h', 'g_renderPipelineNames')),
+        ('primitive', 'g_primitiveNames', common.parse_string_array('src/generated/primitive_types.h', 'g_primitiveNames')),
+    ]
+
+    lines = [
+        '#include "src/scene_data.h"',
+        '#include "src/scene_prefab.h"',
+        '#include "primitive_types.h"',
+        '#include "render_pipeline_data.h"',
+        '#include <ctype.h>',
+        '#include <limits.h>',
+        '#include <stdio.h>',
+        '#include <stdlib.h>',
+        '#include <string.h>',
+        '',
+        '// ------------------------------------------------------------',
+        '// Streaming JSON → Scene, no cJSON tree. Reads the same as scene_from_json',
+        '// ------------------------------------------------------------',
+    ]
+    lines.extend(STREAM_RUNTIME.strip('\n').split('\n'))
+
+    for short, array_name, names in name_tables:
+        if not names:
+            return False
+        seed, bits, table = find_perfect_hash(names)
+        size = 1 << bits
+        common.log_info(f"{array_name}: {len(names)} names, perfect hash seed {seed} over {size} slots")
+        lines.append('')
+        lines.append(f'static const int8_t g_{short}NameSlots[{size}] = {{{", ".join(str(t) for t in table)}}};')
+        lines.append('')
+        lines.append(f'static int sj_lookup_{short}(const char *name)')
+        lines.append('{')
+        lines.append(f'    int idx = g_{short}NameSlots[sj_name_hash(name, {seed}u) >> {32 - bits}];')
+        lines.append(f'    return (idx >= 0 && strcmp(name, {array_name}[idx]) == 0) ? idx : -1;')
+        lines.append('}')
+
+    # one parser per variant block, fields follow parse_variant_object in scene_from_json
+    def variant_parser(variant_name, fields, dest, bit):
+        out = ['',
+               f'static bool sj_parse_{variant_name}Data(SceneJsonCursor &c, ScenePrefab *p, uint32_t *fields)',
+               '{',
+               '    sj_skip_ws(c);',
+               "    if (*c.p != '{')",
+               '        return sj_skip_value(c);',
+               '    c.p++;',
+               "    if (sj_consume(c, '}'))",
+               '        return true;',
+               '',
+               '    uint32_t seen = 0;',
+               '    for (;;)',
+               '    {',
+               '        char key[64];',
+               "        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))",
+               '            return false;',
+               '        sj_skip_ws(c);',
+               '        bool ok;',
+        ]
+        for n, (typ, name, is_array, arr_sz, is_ptr) in enumerate(fields):
+            target = dest(name)
+            set_bit = f'*fields |= SceneFieldBit({bit(name)});'
+            cond = 'if' if n == 0 else 'else if'
+            out.append(f'        {cond} (sj_key(key, "{name}") && sj_first(seen, {1 << n}u))')
+            if is_array and typ.startswith('char'):
+                out.extend([
+                    '        {',
+                    "            bool isString = *c.p == '\"';",
+                    f'            ok = isString ? sj_string(c, {target}, sizeof({target})) >= 0 : sj_skip_value(c);',
+                    '            if (isString)',
+                    f'                {set_bit}',
+                    '        }',
+                ])
+            elif typ == 'StringId':
+                out.extend([
+                    '        {',
+                    "            bool isString = *c.p == '\"';",
+                    f'            ok = isString ? sj_intern_string(c, &{target}) : sj_skip_value(c);',
+                    '            if (isString)',
+                    f'                {set_bit}',
+                    '        }',
+                ])
+            elif typ in ('DirectX::XMFLOAT3', 'DirectX::XMFLOAT4'):
+                count = 3 if typ == 'DirectX::XMFLOAT3' else 4
+                out.extend([
+                    '        {',
+                    '            bool assigned;',
+                    f'            ok = sj_float_array(c, (float *)&{target}, {count}, &assigned);',
+                    '            if (assigned)',
+                    f'                {set_bit}',
+                    '        }',
+                ])
+            elif typ == 'PrimitiveType':
+                out.extend([
+                    '        {',
+                    "            bool assigned = *c.p == '\"' || sj_is_number_start(*c.p);",
+                    f'            int value = (int){target};',
+                    f'            ok = sj_enum(c, sj_lookup_primitive, PRIMITIVE_CUBE, "Unknown primitive type \\"%s\\", defaulting to Cube\\n", &value);',
+                    f'            {target} = (PrimitiveType)value;',
+                    '            if (assigned)',
+                    f'                {set_bit}',
+                    '        }',
+                ])
+            else:
+                out.extend([
+                    '        {',
+                    '            double d;',
+                    '            if (sj_is_number_start(*c.p))',
+                    '            {',
+                    '                ok = sj_number(c, &d);',
+                    '                if (ok)',
+                    '                {',
+                    f'                    {target} = ({typ})d;',
+                    f'                    {set_bit}',
+                    '                }',
+                    '            }',
+                    '            else',
+                    '                ok = sj_skip_value(c);',
+                    '        }',
+                ])
+        out.extend([
+            '        else',
+            '            ok = sj_skip_value(c);',
+            '        if (!ok)',
+            '            return false;',
+            "        if (sj_consume(c, ','))",
+            '            continue;',
+            "        return sj_consume(c, '}');",
+            '    }',
+            '}',
+        ])
+        return out
+
+    lines.extend(variant_parser('primitive', [('PrimitiveType', 'primitiveType', False, None, False)],
+                                lambda name: 'p->primitiveType', lambda name: 'SCENE_FIELD_PRIMITIVE_TYPE'))
     for variant_name, fields in variants.items():
-        enum_name = f"OBJECT_{variant_name.upper()}"
-        lines.append(f'                case {enum_name}: {{')
-        parse_lines = parse_variant_object(variant_name, fields, f"obj->data.{variant_name}")
-        for l in parse_lines:
-            lines.append('    ' + l)
-        lines.append(f'                    break;')
-        lines.append(f'                }}')
+        lines.extend(variant_parser(variant_name, fields, lambda name, v=variant_name: f'p->data.{v}.{name}',
+                                    lambda name, v=variant_name: f'SCENE_FIELD_{v.upper()}_{name.upper()}'))
 
+    # members of one json object. the prefab part (type, pipeline, type specific block) goes to p for all three kinds,
+    # the instance part only exists on objects. variant blocks, "overrides" and the prefab id are remembered on the way
+    # through and dealt with once the members they depend on are known
+    variant_enums = [('primitive', 'OBJECT_PRIMITIVE')] + [(v, f'OBJECT_{v.upper()}') for v in variants]
+    lines.extend([
+        '',
+        'enum SjMembers',
+        '{',
+        '    SJ_MEMBERS_PREFAB,    // a "prefabs" entry',
+        '    SJ_MEMBERS_OBJECT,    // an "objects" entry, old files keep the prefab part inline',
+        '    SJ_MEMBERS_OVERRIDES, // an "overrides" block, the type can not be overridden',
+        '};',
+        '',
+        'struct SjInstanceMembers',
+        '{',
+        '    bool hasPrefab;',
+        '    int prefab;',
+        '    const char *overrides;',
+        '};',
+        '',
+        'static bool sj_parse_members(SceneJsonCursor &c, SjMembers kind, ScenePrefab *p, uint32_t *fields, Scene *scene, int i, SjInstanceMembers *inst)',
+        '{',
+        '    c.p++; // {',
+        '',
+        '    // the type specific block can come before "objectType", so only its position is kept on the way through',
+        '    const char *variantValue[OBJECT_COUNT] = {};',
+        '    uint32_t seen = 0;',
+        "    if (!sj_consume(c, '}'))",
+        '    {',
+        '        for (;;)',
+        '        {',
+        '            char key[64];',
+        "            if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))",
+        '                return false;',
+        '            sj_skip_ws(c);',
+        '            bool ok;',
+        '            if (kind == SJ_MEMBERS_PREFAB && sj_key(key, "name") && sj_first(seen, 1u << 0))',
+        '                ok = *c.p == \'"\' ? sj_intern_string(c, &p->name) : sj_skip_value(c);',
+        '            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "nametag") && sj_first(seen, 1u << 1))',
+        '                ok = *c.p == \'"\' ? sj_intern_string(c, &scene->info[i].nametag) : sj_skip_value(c);',
+        '            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "pos") && sj_first(seen, 1u << 2))',
+        '                ok = sj_float_array(c, (float *)&scene->pos[i], 3);',
+        '            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "rot") && sj_first(seen, 1u << 3))',
+        '                ok = sj_float_array(c, (float *)&scene->rot[i], 4);',
+        '            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "scale") && sj_first(seen, 1u << 4))',
+        '                ok = sj_float_array(c, (float *)&scene->scale[i], 3);',
+        '            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "prefab") && sj_first(seen, 1u << 5))',
+        '            {',
+        '                double d;',
+        '                inst->hasPrefab = sj_is_number_start(*c.p);',
+        '                ok = inst->hasPrefab ? sj_number(c, &d) : sj_skip_value(c);',
+        '                if (ok && inst->hasPrefab)',
+        '                    inst->prefab = sj_valueint(d);',
+        '            }',
+        '            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "overrides") && sj_first(seen, 1u << 6))',
+        '            {',
+        "                if (*c.p == '{')",
+        '                    inst->overrides = c.p;',
+        '                ok = sj_skip_value(c);',
+        '            }',
+        '            else if (kind != SJ_MEMBERS_OVERRIDES && sj_key(key, "objectType") && sj_first(seen, 1u << 7))',
+        '            {',
+        "                bool assigned = *c.p == '\"' || sj_is_number_start(*c.p);",
+        '                int value = p->objectType;',
+        '                ok = sj_enum(c, sj_lookup_objectType, OBJECT_PRIMITIVE, "Unknown object type \\"%s\\", defaulting to Primitive\\n", &value);',
+        '                p->objectType = (ObjectType)value;',
+        '                if (assigned)',
+        '                    *fields |= SceneFieldBit(SCENE_FIELD_OBJECT_TYPE);',
+        '            }',
+        '            else if (sj_key(key, "pipeline") && sj_first(seen, 1u << 8))',
+        '            {',
+        "                bool assigned = *c.p == '\"' || sj_is_number_start(*c.p);",
+        '                int value = p->pipeline;',
+        '                ok = sj_enum(c, sj_lookup_pipeline, RENDER_DEFAULT, "Unknown pipeline \\"%s\\", defaulting to Default\\n", &value);',
+        '                p->pipeline = (RenderPipeline)value;',
+        '                if (assigned)',
+        '                    *fields |= SceneFieldBit(SCENE_FIELD_PIPELINE);',
+        '            }',
+    ])
+    for variant_name, enum_name in variant_enums:
+        lines.extend([
+            f'            else if (sj_key(key, "{variant_name}Data"))',
+            '            {',
+            f'                if (!variantValue[{enum_name}])',
+            f'                    variantValue[{enum_name}] = c.p;',
+            '                ok = sj_skip_value(c);',
+            '            }',
+        ])
     lines.extend([
-        '                default:',
-        '                    break;',
+        '            else',
+        '                ok = sj_skip_value(c);',
+        '            if (!ok)',
+        '                return false;',
+        "            if (sj_consume(c, ','))",
+        '                continue;',
+        "            if (sj_consume(c, '}'))",
+        '                break;',
+        '            return false;',
+        '        }',
+        '    }',
+        '',
+        '    int type = p->objectType;',
+        '    if (type < 0 || type >= OBJECT_COUNT || !variantValue[type])',
+        '        return true;',
+        '    SceneJsonCursor block = {variantValue[type]};',
+        '    switch (type)',
+        '    {',
+    ])
+    for variant_name, enum_name in variant_enums:
+        lines.extend([
+            f'    case {enum_name}:',
+            f'        return sj_parse_{variant_name}Data(block, p, fields);',
+        ])
+    lines.extend([
+        '    default:',
+        '        return true;',
+        '    }',
+        '}',
+        '',
+        'static bool sj_parse_prefabs(SceneJsonCursor &c, Scene *scene)',
+        '{',
+        '    c.p++; // [',
+        "    if (sj_consume(c, ']'))",
+        '        return true;',
+        '    for (;;)',
+        '    {',
+        '        sj_skip_ws(c);',
+        '        ScenePrefab prefab = ScenePrefabDefault(); // non object items still make a default prefab, same as cJSON_ArrayForEach',
+        '        uint32_t fields = 0;',
+        "        bool ok = *c.p == '{' ? sj_parse_members(c, SJ_MEMBERS_PREFAB, &prefab, &fields, nullptr, 0, nullptr) : sj_skip_value(c);",
+        '        if (!ok)',
+        '            return false;',
+        '        if (prefab.name == STRING_ID_EMPTY)',
+        '            prefab.name = ScenePrefabDefaultName(prefab);',
+        '        ScenePrefabAdd(*scene, prefab);',
+        "        if (sj_consume(c, ','))",
+        '            continue;',
+        "        return sj_consume(c, ']');",
+        '    }',
+        '}',
+        '',
+        'static bool sj_parse_scene_object(SceneJsonCursor &c, Scene *scene, int i, int prefabCount)',
+        '{',
+        '    ScenePrefab own = ScenePrefabDefault();',
+        '    uint32_t fields = 0;',
+        '    SjInstanceMembers inst = {};',
+        "    bool ok = *c.p == '{' ? sj_parse_members(c, SJ_MEMBERS_OBJECT, &own, &fields, scene, i, &inst) : sj_skip_value(c);",
+        '    if (!ok)',
+        '        return false;',
+        '',
+        '    // no (usable) prefab: the object has its own type and data, the same data shares one prefab',
+        '    uint32_t prefab;',
+        '    if (inst.hasPrefab && inst.prefab >= 0 && inst.prefab < prefabCount)',
+        '        prefab = (uint32_t)inst.prefab;',
+        '    else',
+        '        prefab = SceneFindOrAddPrefab(*scene, own);',
+        '',
+        '    if (inst.overrides)',
+        '    {',
+        '        SceneJsonCursor block = {inst.overrides};',
+        '        ScenePrefab values = scene->prefabs[prefab];',
+        '        uint32_t overridden = 0;',
+        '        if (!sj_parse_members(block, SJ_MEMBERS_OVERRIDES, &values, &overridden, nullptr, 0, nullptr))',
+        '            return false;',
+        '        prefab = ScenePrefabVariant(*scene, prefab, overridden, values);',
+        '    }',
+        '    scene->prefab[i] = prefab;',
+        '    return true;',
+        '}',
+        '',
+        'static bool sj_parse_objects(SceneJsonCursor &c, Scene *scene, int prefabCount)',
+        '{',
+        '    c.p++; // [',
+        "    if (sj_consume(c, ']'))",
+        '        return true;',
+        '    for (;;)',
+        '    {',
+        '        sj_skip_ws(c);',
+        '        SceneAddObject(*scene, SCENE_PREFAB_NONE); // non object items still make a default object, same as cJSON_ArrayForEach',
+        '        if (!sj_parse_scene_object(c, scene, scene->objectCount - 1, prefabCount))',
+        '            return false;',
+        "        if (sj_consume(c, ','))",
+        '            continue;',
+        "        return sj_consume(c, ']');",
+        '    }',
+        '}',
+        '',
+        'static bool sj_parse_root(SceneJsonCursor &c, Scene *scene)',
+        '{',
+        '    sj_skip_ws(c);',
+        "    if (*c.p != '{')",
+        '        return sj_skip_value(c); // valid json without an "objects" member is an empty scene',
+        '    c.p++;',
+        "    if (sj_consume(c, '}'))",
+        '        return true;',
+        '',
+        '    // objects refer to prefabs by index, if "objects" comes first (old files, no prefabs at all) it is read at the end',
+        '    const char *objects = nullptr;',
+        '    uint32_t seen = 0;',
+        '    for (;;)',
+        '    {',
+        '        char key[64];',
+        "        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))",
+        '            return false;',
+        '        sj_skip_ws(c);',
+        '        bool ok;',
+        "        if (sj_key(key, \"objects\") && sj_first(seen, 1u << 0))",
+        '        {',
+        "            if (*c.p == '[' && (seen & (1u << 2)))",
+        '                ok = sj_parse_objects(c, scene, (int)scene->prefabs.size());',
+        '            else',
+        '            {',
+        "                if (*c.p == '[')",
+        '                    objects = c.p;',
+        '                ok = sj_skip_value(c);',
         '            }',
         '        }',
-        '        // Update objectCount if array was present',
-        '        if (arraySize > 0) scene->objectCount = arraySize;',
+        '        else if (sj_key(key, "objectCount") && sj_first(seen, 1u << 1) && sj_is_number_start(*c.p))',
+        '        {',
+        '            // scene_to_json writes the count before the array, good enough as a reserve hint',
+        '            double d;',
+        '            ok = sj_number(c, &d);',
+        '            if (ok && d > 0.0 && d < 16.0 * 1024 * 1024 && scene->objectCount == 0)',
+        '                SceneReserve(*scene, (int)d);',
+        '        }',
+        "        else if (sj_key(key, \"prefabs\") && sj_first(seen, 1u << 2))",
+        "            ok = *c.p == '[' ? sj_parse_prefabs(c, scene) : sj_skip_value(c);",
+        '        else',
+        '            ok = sj_skip_value(c);',
+        '        if (!ok)',
+        '            return false;',
+        "        if (sj_consume(c, ','))",
+        '            continue;',
+        "        if (!sj_consume(c, '}'))",
+        '            return false;',
+        '        break;',
         '    }',
         '',
-        '    cJSON_Delete(root);',
+        '    if (!objects)',
+        '        return true;',
+        '    SceneJsonCursor block = {objects};',
+        '    return sj_parse_objects(block, scene, (int)scene->prefabs.size());',
+        '}',
+        '',
+        '// returns 1 on success, 0 on failure. unlike scene_from_json a malformed file leaves the scene empty,',
+        '// the text is not validated up front',
+        'int scene_from_json_stream(const char *json, Scene *scene)',
+        '{',
+        '    if (!json)',
+        '        return 0;',
+        '    SceneJsonCursor c = {json};',
+        "    if ((unsigned char)c.p[0] == 0xEF && (unsigned char)c.p[1] == 0xBB && (unsigned char)c.p[2] == 0xBF)",
+        '        c.p += 3; // utf-8 bom, cJSON_Parse skips it too',
+        '',
+        '    SceneClear(*scene);',
+        '    if (!sj_parse_root(c, scene))',
+        '    {',
+        '        SceneClear(*scene);',
+        '        return 0;',
+        '    }',
         '    return 1;',
-        '}'
+        '}',
     ])
 
     output_c.parent.mkdir(parents=True, exist_ok=True)
     with open(output_c, 'w', encoding='utf-8') as f:
-        f.write(header + '\n' + '\n'.join(lines))
+        f.write(common.make_header("meta_scene_json.py") + '\n' + '\n'.join(lines) + '\n')
 
     common.log_success(f"Generated {output_c}")
     return True
 
+# ----------------------------------------------------------------------
+# Field reflection: one id per serialised field, used by the editor undo journal
+# ----------------------------------------------------------------------
+def generate_scene_fields(input_h: Path, output_h: Path) -> bool:
+    with open(input_h, 'r', encoding='utf-8') as f:
+        content = f.read()
+    variants = extract_union_variants(content)
+    if not variants:
+        common.log_error("No union variants found")
+        return False
+
+    # (enum suffix, json name, sizeof expression, address). instance fields first, then the ones that live in the prefab.
+    # same names as scene_to_json
+    instance_fields = [
+        ('POS', 'pos', 'sizeof(DirectX::XMFLOAT3)', 'scene.pos[i]'),
+        ('ROT', 'rot', 'sizeof(DirectX::XMFLOAT4)', 'scene.rot[i]'),
+        ('SCALE', 'scale', 'sizeof(DirectX::XMFLOAT3)', 'scene.scale[i]'),
+        ('PREFAB', 'prefab', 'sizeof(uint32_t)', 'scene.prefab[i]'),
+        ('NAMETAG', 'nametag', 'sizeof(StringId)', 'scene.info[i].nametag'),
+    ]
+    prefab_fields = [
+        ('PREFAB_NAME', 'name', 'sizeof(StringId)', 'prefab.name'),
+        ('OBJECT_TYPE', 'objectType', 'sizeof(ObjectType)', 'prefab.objectType'),
+        ('PIPELINE', 'pipeline', 'sizeof(RenderPipeline)', 'prefab.pipeline'),
+        ('PRIMITIVE_TYPE', 'primitiveData.primitiveType', 'sizeof(PrimitiveType)', 'prefab.primitiveType'),
+        ('DATA', 'data', 'sizeof(SceneObjectData)', 'prefab.data'),
+    ]
+    # what an instance may override, per object type. asset ids stay with the prefab (another asset is another prefab)
+    # and the type can't change under a single instance
+    overridable = {'': ['PIPELINE'], 'PRIMITIVE': ['PRIMITIVE_TYPE']}
+    for variant_name, vfields in variants.items():
+        for typ, name, is_array, arr_sz, is_ptr in vfields:
+            suffix = f'{variant_name.upper()}_{name.upper()}'
+            prefab_fields.append((suffix, f'{variant_name}Data.{name}',
+                                  f'sizeof(((SceneObjectData *)0)->{variant_name}.{name})',
+                                  f'prefab.data.{variant_name}.{name}'))
+            if typ != 'StringId':
+                overridable.setdefault(variant_name.upper(), []).append(suffix)
+    fields = instance_fields + prefab_fields
+    if len(fields) > 32:
+        common.log_error("More than 32 scene fields, override masks are 32 bit")
+        return False
+
+    lines = [
+        '#pragma once',
+        '#include "src/scene_data.h"',
+        '',
+        '// instance fields first, SCENE_FIELD_PREFAB_NAME and everything after it live in the prefab.',
+        '// SCENE_FIELD_DATA is the whole type specific union, the ones after it are single members of it',
+        'enum SceneField : uint16_t',
+        '{',
+    ]
+    for suffix, _, _, _ in fields:
+        lines.append(f'    SCENE_FIELD_{suffix},')
+    lines.extend([
+        '    SCENE_FIELD_COUNT',
+        '};',
+        '',
+        f'#define SCENE_FIELD_FIRST_PREFAB SCENE_FIELD_{prefab_fields[0][0]}',
+        '',
+        'struct SceneFieldInfo',
+        '{',
+        '    const char *name; // json key, variant members as "heightfieldData.width"',
+        '    uint32_t size;',
+        '};',
+        '',
+        'static const SceneFieldInfo g_sceneFields[SCENE_FIELD_COUNT] = {',
+    ])
+    for _, name, size_of, _ in fields:
+        lines.append(f'    {{"{name}", {size_of}}},')
+    lines.extend([
+        '};',
+        '',
+        '// bit of a field in ScenePrefab::overrideMask',
+        'inline uint32_t SceneFieldBit(SceneField field)',
+        '{',
+        '    return 1u << field;',
+        '}',
+        '',
+        '// fields an instance of this type may override',
+        'inline uint32_t SceneOverridableFields(ObjectType type)',
+        '{',
+        '    uint32_t bits = ' + ' | '.join(f'SceneFieldBit(SCENE_FIELD_{f})' for f in overridable['']) + ';',
+        '    switch (type)',
+        '    {',
+    ])
+    for type_suffix, suffixes in overridable.items():
+        if not type_suffix:
+            continue
+        lines.append(f'    case OBJECT_{type_suffix}:')
+        lines.append('        return bits | ' + ' | '.join(f'SceneFieldBit(SCENE_FIELD_{f})' for f in suffixes) + ';')
+    lines.extend([
+        '    default:',
+        '        return bits;',
+        '    }',
+        '}',
+        '',
+        '// address of an instance field of the object at dense index i, nullptr for prefab fields',
+        'inline void *SceneFieldPtr(Scene &scene, int i, SceneField field)',
+        '{',
+        '    switch (field)',
+        '    {',
+    ])
+    for suffix, _, _, addr in instance_fields:
+        lines.append(f'    case SCENE_FIELD_{suffix}:')
+        lines.append(f'        return &{addr};')
+    lines.extend([
+        '    default:',
+        '        return nullptr;',
+        '    }',
+        '}',
+        '',
+        '// address of a prefab field, nullptr for instance fields',
+        'inline void *ScenePrefabFieldPtr(ScenePrefab &prefab, SceneField field)',
+        '{',
+        '    switch (field)',
+        '    {',
+    ])
+    for suffix, _, _, addr in prefab_fields:
+        lines.append(f'    case SCENE_FIELD_{suffix}:')
+        lines.append(f'        return &{addr};')
+    lines.extend([
+        '    default:',
+        '        return nullptr;',
+        '    }',
+        '}',
+    ])
+
+    output_h.parent.mkdir(parents=True, exist_ok=True)
+    with open(output_h, 'w', encoding='utf-8') as f:
+        f.write(common.make_header("meta_scene_json.py") + '\n' + '\n'.join(lines) + '\n')
+
+    common.log_success(f"Generated {output_h}")
+    return True
+
 if __name__ == '__main__':
-    generate_scene_json(Path("src/scene_data.h"), Path("src/generated/scene_json.cpp"))
\ No newline at end of file
+    generate_scene_json(Path("src/scene_data.h"), Path("src/generated/scene_json.cpp"))
+    generate_scene_json_stream(Path("src/scene_data.h"), Path("src/generated/scene_json_stream.cpp"))
+    generate_scene_fields(Path("src/scene_data.h"), Path("src/generated/scene_fields.h"))
\ No newline at end of file
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+run_tests.py – Build and run the headless tests in tests/.
+
+Every tests/test_*.cpp is a standalone program over the portable headers in src/
+(no D3D12, no SDL, no window), so they build with cl.exe on Windows and with
+g++/clang++ anywhere else. Off Windows tests/shim stands in for DirectXMath.
+
+Usage:
+    python run_tests.py                   # build and run all of them
+    python run_tests.py render_graph      # only tests/test_render_graph.cpp
+    python run_tests.py --update          # rewrite tests/golden/ from the current output
+    python run_tests.py --sanitize        # g++/clang++ only: address + undefined behaviour sanitizers
+"""
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+import common
+
+TEST_DIR = Path("tests")
+OUTPUT_DIR = Path("_tests")
+
+CL_FLAGS = ["/O2", "/EHsc", "/MD", "/std:c++17", "/W3", "/nologo", "/I", ".", "/I", "src", "/I", "src/generated", "/I", "tests"]
+GCC_FLAGS = ["-O2", "-std=c++17", "-Wall", "-Wextra", "-I.", "-Isrc", "-Isrc/generated", "-Itests", "-Itests/shim"]
+SANITIZE_FLAGS = ["-g", "-fsanitize=address,undefined", "-fno-sanitize-recover=undefined"]
+
+
+def find_compiler():
+    if os.name == "nt" and shutil.which("cl.exe"):
+        return "cl.exe"
+    for name in [os.environ.get("CXX"), "g++", "clang++"]:
+        if name and shutil.which(name):
+            return name
+    return None
+
+
+def build_test(compiler, source, exe, sanitize):
+    if compiler == "cl.exe":
+        cmd = [compiler] + CL_FLAGS + ["/Fe" + str(exe), "/Fo" + str(OUTPUT_DIR) + "\\", str(source)]
+    else:
+        cmd = [compiler] + GCC_FLAGS + (SANITIZE_FLAGS if sanitize else []) + ["-o", str(exe), str(source)]
+    return subprocess.run(cmd).returncode == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build and run the headless tests")
+    parser.add_argument("names", nargs="*", help="tests to run (test_<name>.cpp), all if none")
+    parser.add_argument("--update", action="store_true", help="rewrite the golden files instead of comparing")
+    parser.add_argument("--sanitize", action="store_true", help="build with address and undefined behaviour sanitizers")
+    args = parser.parse_args()
+
+    compiler = find_compiler()
+    if not compiler:
+        common.log_error("no C++ compiler found (cl.exe, $CXX, g++ or clang++)")
+        return 1
+
+    sources = sorted(TEST_DIR.glob("test_*.cpp"))
+    if args.names:
+        sources = [s for s in sources if s.stem[len("test_"):] in args.names]
+        if not sources:
+            common.log_error("no tests match " + " ".join(args.names))
+            return 1
+
+    common.ensure_dir(OUTPUT_DIR)
+    failed = []
+    for source in sources:
+        exe = OUTPUT_DIR / (source.stem + (".exe" if os.name == "nt" else ""))
+        common.log_info(f"{source.stem}: building with {compiler}")
+        if not build_test(compiler, source, exe, args.sanitize):
+            common.log_error(f"{source.stem}: build failed")
+            failed.append(source.stem)
+            continue
+        result = subprocess.run([str(exe)] + (["--update"] if args.update else []))
+        if result.returncode != 0:
+            common.log_error(f"{source.stem}: failed")
+            failed.append(source.stem)
+        else:
+            common.log_success(source.stem)
+
+    if failed:
+        common.log_error(f"{len(failed)} of {len(sources)} tests failed: " + ", ".join(failed))
+        return 1
+    common.log_success(f"all {len(sources)} tests passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
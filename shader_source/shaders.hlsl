@@ -7,11 +7,13 @@
 // ----------------------------------------------------------------------------
 cbuffer PerDrawRootConstants : register(b0)
 {
-    float4x4 world;
-    uint textureArrayIndex; // TODO: rename this because in practice it is just an abstract index into albedo, heightmap or sky texture arrays
-    float per_draw_padding[3];
+    uint textureArrayIndex; // bindless table slot of the draw's albedo, heightmap or sky texture
+    uint instanceBase;      // first of the draw's matrices in g_instanceWorlds
 };
 
+// world matrices of every draw this frame, plain draws have one, instanced draws one per instance
+StructuredBuffer<float4x4> g_instanceWorlds : register(t0, space1);
+
 cbuffer PerFrameConstantBuffer : register(b1)
 {
     float4x4 view;
@@ -29,16 +31,10 @@ cbuffer PerSceneConstantBuffer : register(b2)
     float per_scene_padding[52];
 };
 
-#define HEIGHTMAP_REGISTER_BASE t1
-#define SKY_REGISTER_BASE t257
-#define ALBEDO_REGISTER_BASE t273
+#define BINDLESS_REGISTER_BASE t1 // RegisterLayout::BINDLESS_REGISTER_BASE in generated/descriptor_layout.h
 
 Texture2D g_defaultTexture : register(t0);
-Texture2D g_heightmaps[] : register(HEIGHTMAP_REGISTER_BASE);
-Texture2D g_skyTextures[] : register(SKY_REGISTER_BASE);
-Texture2D g_albedoTextures[] : register(ALBEDO_REGISTER_BASE);
-
-// TODO: METAPROGRAM all these register positions, or calculate with macros? doesn't matter just get rid of magic numbers
+Texture2D g_textures[] : register(BINDLESS_REGISTER_BASE); // the bindless table, every loaded texture
 
 SamplerState g_sampler : register(s0);
 // add a separate sampler for sampling heightfield?
@@ -83,34 +79,40 @@ float4 SampleTriplanar(Texture2D tex, SamplerState sam,
 }
 #endif
 
+float4x4 DrawWorld(uint instanceID)
+{
+    return g_instanceWorlds[instanceBase + instanceID];
+}
+
 // TODO: factor in non-uniform scale on normals
-PSInput VSMain(VSInput input)
+PSInput VSMain(VSInput input, uint instanceID : SV_InstanceID)
 {
     PSInput result;
+    float4x4 drawWorld = DrawWorld(instanceID);
 
 #ifdef HEIGHTFIELD
-    float h = g_heightmaps[textureArrayIndex].SampleLevel(g_sampler, input.uv, 0).r;
-    float3 worldNormal = normalize(mul(input.norm, (float3x3)world));
+    float h = g_textures[textureArrayIndex].SampleLevel(g_sampler, input.uv, 0).r;
+    float3 worldNormal = normalize(mul(input.norm, (float3x3)drawWorld));
     float3 displacedPos = input.position.xyz + worldNormal * h;
 
-    float4 finalWorldPos = mul(float4(displacedPos, 1.0f), world);
+    float4 finalWorldPos = mul(float4(displacedPos, 1.0f), drawWorld);
     result.position = mul(mul(finalWorldPos, view), projection);
     result.worldPos = finalWorldPos.xyz;
     result.normal = worldNormal;
     // result.uv = input.uv;
     result.uv = float2(h, h);
 #elif defined(TRIPLANAR)
-    float4 worldPosition = mul(input.position, world);
+    float4 worldPosition = mul(input.position, drawWorld);
     result.position = mul(mul(worldPosition, view), projection);
     result.worldPos = worldPosition.xyz;
-    result.normal = normalize(mul(input.norm, (float3x3)world));
+    result.normal = normalize(mul(input.norm, (float3x3)drawWorld));
     result.uv = input.uv;
 
 #else
-    float4 pos = mul(input.position, world);
+    float4 pos = mul(input.position, drawWorld);
     result.position = mul(mul(pos, view), projection);
     result.worldPos = 0.0; // unused
-    result.normal = normalize(mul(input.norm, (float3x3)world));
+    result.normal = normalize(mul(input.norm, (float3x3)drawWorld));
     result.uv = input.uv;
 #endif
 
@@ -120,10 +122,10 @@ PSInput VSMain(VSInput input)
 float4 PSMain(PSInput input) : SV_TARGET
 {
 #ifdef SKY
-    float4 texColor = g_skyTextures[textureArrayIndex].Sample(g_sampler, input.uv);
+    float4 texColor = g_textures[textureArrayIndex].Sample(g_sampler, input.uv);
     return texColor;
 #elif defined(LOADED_MODEL)
-    float4 texColor = g_albedoTextures[textureArrayIndex].Sample(g_sampler, input.uv);
+    float4 texColor = g_textures[textureArrayIndex].Sample(g_sampler, input.uv);
 #elif defined(HEIGHTFIELD)
     float4 texColor = float4(input.uv, input.uv.x, 1.0f);
 #elif defined(TRIPLANAR)
@@ -0,0 +1,377 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <float.h>
+#include <stdint.h>
+#include <vector>
+
+// SAH bounding volume hierarchy over world space AABBs, used to frustum cull the static scene.
+// items are referenced by a caller side uint32 id (the scene object index), the tree itself knows nothing about g_scene
+
+#define BVH_MAX_LEAF_ITEMS 4
+#define BVH_MAX_DEPTH 48 // deeper nodes are forced into leaves, this also bounds the traversal stack
+#define BVH_SAH_BINS 12
+
+struct AABB
+{
+    DirectX::XMFLOAT3 min;
+    DirectX::XMFLOAT3 max;
+};
+
+struct BVHNode
+{
+    AABB bounds;
+    uint32_t first; // leaf: first entry in BVH::itemIds, inner: index of the left child (the right child is first + 1)
+    uint32_t count; // items in a leaf, 0 for inner nodes
+};
+static_assert(sizeof(BVHNode) == 32, "keep BVHNode at 32 bytes (two per cache line)");
+
+struct BVH
+{
+    std::vector<BVHNode> nodes;    // nodes[0] is the root, children always come after their parent
+    std::vector<uint32_t> itemIds; // every subtree references a contiguous range of this
+};
+
+// inward facing planes, dot(n, p) + w >= 0 is inside
+struct Frustum
+{
+    DirectX::XMFLOAT4 planes[6];
+};
+
+inline float AABBAxisMin(const AABB &b, int axis) { return (&b.min.x)[axis]; }
+inline float AABBAxisMax(const AABB &b, int axis) { return (&b.max.x)[axis]; }
+inline float AABBCentroid(const AABB &b, int axis) { return (AABBAxisMin(b, axis) + AABBAxisMax(b, axis)) * 0.5f; }
+
+inline AABB AABBEmpty()
+{
+    return {{FLT_MAX, FLT_MAX, FLT_MAX}, {-FLT_MAX, -FLT_MAX, -FLT_MAX}};
+}
+
+inline void AABBGrow(AABB &b, const AABB &other)
+{
+    b.min.x = fminf(b.min.x, other.min.x);
+    b.min.y = fminf(b.min.y, other.min.y);
+    b.min.z = fminf(b.min.z, other.min.z);
+    b.max.x = fmaxf(b.max.x, other.max.x);
+    b.max.y = fmaxf(b.max.y, other.max.y);
+    b.max.z = fmaxf(b.max.z, other.max.z);
+}
+
+inline float AABBSurfaceArea(const AABB &b)
+{
+    float dx = b.max.x - b.min.x;
+    float dy = b.max.y - b.min.y;
+    float dz = b.max.z - b.min.z;
+    if (dx < 0.0f || dy < 0.0f || dz < 0.0f)
+        return 0.0f; // empty
+    return 2.0f * (dx * dy + dy * dz + dz * dx);
+}
+
+// bounds of a local space box after a row major world matrix (scale * rotation * translation, see transform_cache.h)
+AABB AABBTransform(const AABB &local, const DirectX::XMFLOAT4X4 &m)
+{
+    float c[3], e[3];
+    for (int a = 0; a < 3; ++a)
+    {
+        c[a] = AABBCentroid(local, a);
+        e[a] = (AABBAxisMax(local, a) - AABBAxisMin(local, a)) * 0.5f;
+    }
+
+    // row vectors (v * M): centre goes through the full matrix, extents through |M| of the 3x3 part
+    AABB result;
+    for (int j = 0; j < 3; ++j)
+    {
+        float wc = m.m[3][j];
+        float we = 0.0f;
+        for (int i = 0; i < 3; ++i)
+        {
+            wc += c[i] * m.m[i][j];
+            we += e[i] * fabsf(m.m[i][j]);
+        }
+        (&result.min.x)[j] = wc - we;
+        (&result.max.x)[j] = wc + we;
+    }
+    return result;
+}
+
+Frustum FrustumFromViewProj(DirectX::FXMMATRIX viewProj)
+{
+    using namespace DirectX;
+
+    // Gribb/Hartmann: with row vectors (clip = v * M) the planes are sums of the matrix columns.
+    // d3d clip space z is 0..w, reverse-Z only swaps which of those is near and far so both planes are kept as is
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, viewProj);
+    XMVECTOR col[4];
+    for (int j = 0; j < 4; ++j)
+        col[j] = XMVectorSet(m.m[0][j], m.m[1][j], m.m[2][j], m.m[3][j]);
+
+    XMVECTOR planes[6] = {
+        XMVectorAdd(col[3], col[0]),      // left
+        XMVectorSubtract(col[3], col[0]), // right
+        XMVectorAdd(col[3], col[1]),      // bottom
+        XMVectorSubtract(col[3], col[1]), // top
+        col[2],                           // z >= 0 (far with reverse-Z)
+        XMVectorSubtract(col[3], col[2]), // z <= w (near with reverse-Z)
+    };
+
+    Frustum frustum;
+    for (int p = 0; p < 6; ++p)
+        XMStoreFloat4(&frustum.planes[p], XMPlaneNormalize(planes[p]));
+    return frustum;
+}
+
+enum FrustumTest
+{
+    FRUSTUM_OUTSIDE,
+    FRUSTUM_INTERSECTS,
+    FRUSTUM_INSIDE,
+};
+
+// only tests the planes set in planeMask, planes the box is fully inside of are cleared from it
+inline FrustumTest FrustumTestAABB(const Frustum &frustum, const AABB &b, uint32_t &planeMask)
+{
+    for (int p = 0; p < 6; ++p)
+    {
+        if (!(planeMask & (1u << p)))
+            continue;
+        const DirectX::XMFLOAT4 &pl = frustum.planes[p];
+
+        // corner furthest along the plane normal, if that is outside the whole box is
+        float px = pl.x > 0.0f ? b.max.x : b.min.x;
+        float py = pl.y > 0.0f ? b.max.y : b.min.y;
+        float pz = pl.z > 0.0f ? b.max.z : b.min.z;
+        if (pl.x * px + pl.y * py + pl.z * pz + pl.w < 0.0f)
+            return FRUSTUM_OUTSIDE;
+
+        // nearest corner inside as well: children can skip this plane
+        float nx = pl.x > 0.0f ? b.min.x : b.max.x;
+        float ny = pl.y > 0.0f ? b.min.y : b.max.y;
+        float nz = pl.z > 0.0f ? b.min.z : b.max.z;
+        if (pl.x * nx + pl.y * ny + pl.z * nz + pl.w >= 0.0f)
+            planeMask &= ~(1u << p);
+    }
+    return planeMask ? FRUSTUM_INTERSECTS : FRUSTUM_INSIDE;
+}
+
+static void BVHUpdateNodeBounds(BVH &bvh, const AABB *boundsById, uint32_t nodeIndex)
+{
+    BVHNode &node = bvh.nodes[nodeIndex];
+    node.bounds = AABBEmpty();
+    for (uint32_t k = 0; k < node.count; ++k)
+        AABBGrow(node.bounds, boundsById[bvh.itemIds[node.first + k]]);
+}
+
+static void BVHSubdivide(BVH &bvh, const AABB *boundsById, uint32_t nodeIndex, int depth)
+{
+    // copy out, push_back below can move the nodes
+    uint32_t first = bvh.nodes[nodeIndex].first;
+    uint32_t count = bvh.nodes[nodeIndex].count;
+    if (count <= BVH_MAX_LEAF_ITEMS || depth >= BVH_MAX_DEPTH)
+        return;
+
+    // bin on the centroids, the item bounds can overlap a lot
+    AABB centroidBounds = AABBEmpty();
+    for (uint32_t k = 0; k < count; ++k)
+    {
+        const AABB &b = boundsById[bvh.itemIds[first + k]];
+        AABB c = {{AABBCentroid(b, 0), AABBCentroid(b, 1), AABBCentroid(b, 2)},
+                  {AABBCentroid(b, 0), AABBCentroid(b, 1), AABBCentroid(b, 2)}};
+        AABBGrow(centroidBounds, c);
+    }
+
+    int bestAxis = -1;
+    int bestSplit = 0;
+    float bestCost = FLT_MAX;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float cmin = AABBAxisMin(centroidBounds, axis);
+        float extent = AABBAxisMax(centroidBounds, axis) - cmin;
+        if (extent <= 0.0f)
+            continue;
+        float binScale = (float)BVH_SAH_BINS / extent;
+
+        AABB binBounds[BVH_SAH_BINS];
+        uint32_t binCount[BVH_SAH_BINS] = {};
+        for (int b = 0; b < BVH_SAH_BINS; ++b)
+            binBounds[b] = AABBEmpty();
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            const AABB &b = boundsById[bvh.itemIds[first + k]];
+            int bin = (int)((AABBCentroid(b, axis) - cmin) * binScale);
+            if (bin >= BVH_SAH_BINS)
+                bin = BVH_SAH_BINS - 1;
+            binCount[bin]++;
+            AABBGrow(binBounds[bin], b);
+        }
+
+        // sweep from both ends, split s puts bins [0, s) on the left
+        float leftArea[BVH_SAH_BINS - 1], rightArea[BVH_SAH_BINS - 1];
+        uint32_t leftCount[BVH_SAH_BINS - 1], rightCount[BVH_SAH_BINS - 1];
+        AABB leftBox = AABBEmpty(), rightBox = AABBEmpty();
+        uint32_t leftSum = 0, rightSum = 0;
+        for (int s = 0; s < BVH_SAH_BINS - 1; ++s)
+        {
+            leftSum += binCount[s];
+            AABBGrow(leftBox, binBounds[s]);
+            leftCount[s] = leftSum;
+            leftArea[s] = AABBSurfaceArea(leftBox);
+
+            rightSum += binCount[BVH_SAH_BINS - 1 - s];
+            AABBGrow(rightBox, binBounds[BVH_SAH_BINS - 1 - s]);
+            rightCount[BVH_SAH_BINS - 2 - s] = rightSum;
+            rightArea[BVH_SAH_BINS - 2 - s] = AABBSurfaceArea(rightBox);
+        }
+        for (int s = 0; s < BVH_SAH_BINS - 1; ++s)
+        {
+            if (leftCount[s] == 0 || rightCount[s] == 0)
+                continue;
+            float cost = (float)leftCount[s] * leftArea[s] + (float)rightCount[s] * rightArea[s];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = s + 1;
+            }
+        }
+    }
+
+    float leafCost = (float)count * AABBSurfaceArea(bvh.nodes[nodeIndex].bounds);
+    uint32_t leftItems = 0;
+    if (bestAxis >= 0 && bestCost < leafCost)
+    {
+        // partition the item range in place around the chosen bin boundary
+        float cmin = AABBAxisMin(centroidBounds, bestAxis);
+        float binScale = (float)BVH_SAH_BINS / (AABBAxisMax(centroidBounds, bestAxis) - cmin);
+        uint32_t i = first;
+        uint32_t j = first + count;
+        while (i < j)
+        {
+            int bin = (int)((AABBCentroid(boundsById[bvh.itemIds[i]], bestAxis) - cmin) * binScale);
+            if (bin >= BVH_SAH_BINS)
+                bin = BVH_SAH_BINS - 1;
+            if (bin < bestSplit)
+                i++;
+            else
+            {
+                j--;
+                uint32_t tmp = bvh.itemIds[i];
+                bvh.itemIds[i] = bvh.itemIds[j];
+                bvh.itemIds[j] = tmp;
+            }
+        }
+        leftItems = i - first;
+    }
+    else if (count > BVH_MAX_LEAF_ITEMS * 4)
+    {
+        // SAH says a leaf is cheaper (heavily overlapping or stacked objects) but that many items would make culling too coarse,
+        //  split down the middle of the range, which items go where does not matter much here
+        leftItems = count / 2;
+    }
+    if (leftItems == 0 || leftItems == count)
+        return; // stays a leaf
+
+    uint32_t leftIndex = (uint32_t)bvh.nodes.size();
+    BVHNode left = {}, right = {};
+    left.first = first;
+    left.count = leftItems;
+    right.first = first + leftItems;
+    right.count = count - leftItems;
+    bvh.nodes.push_back(left);
+    bvh.nodes.push_back(right);
+    BVHUpdateNodeBounds(bvh, boundsById, leftIndex);
+    BVHUpdateNodeBounds(bvh, boundsById, leftIndex + 1);
+
+    bvh.nodes[nodeIndex].first = leftIndex;
+    bvh.nodes[nodeIndex].count = 0;
+
+    BVHSubdivide(bvh, boundsById, leftIndex, depth + 1);
+    BVHSubdivide(bvh, boundsById, leftIndex + 1, depth + 1);
+}
+
+// boundsById is indexed by item id, ids lists the items to put in the tree
+void BVHBuild(BVH &bvh, const AABB *boundsById, const uint32_t *ids, uint32_t count)
+{
+    bvh.nodes.clear();
+    bvh.itemIds.assign(ids, ids + count);
+    if (count == 0)
+        return;
+
+    bvh.nodes.reserve(2 * (size_t)count);
+    BVHNode root = {};
+    root.first = 0;
+    root.count = count;
+    bvh.nodes.push_back(root);
+    BVHUpdateNodeBounds(bvh, boundsById, 0);
+    BVHSubdivide(bvh, boundsById, 0, 0);
+}
+
+// recomputes every node's bounds bottom up after item bounds moved, keeps the topology.
+// much cheaper than a rebuild but the tree gets worse the further things move from where they were at build time
+void BVHRefit(BVH &bvh, const AABB *boundsById)
+{
+    for (int n = (int)bvh.nodes.size() - 1; n >= 0; --n)
+    {
+        BVHNode &node = bvh.nodes[n];
+        if (node.count > 0)
+        {
+            BVHUpdateNodeBounds(bvh, boundsById, (uint32_t)n);
+        }
+        else
+        {
+            node.bounds = bvh.nodes[node.first].bounds;
+            AABBGrow(node.bounds, bvh.nodes[node.first + 1].bounds);
+        }
+    }
+}
+
+// writes the ids of items whose bounds touch the frustum to outIds, returns how many.
+// nodesVisited (optional) is the traversal cost, compare against bvh.nodes.size()
+int BVHCullFrustum(const BVH &bvh, const Frustum &frustum, const AABB *boundsById, uint32_t *outIds, int maxOut, int *nodesVisited)
+{
+    int visibleCount = 0;
+    int visited = 0;
+    if (!bvh.nodes.empty())
+    {
+        struct StackEntry
+        {
+            uint32_t node;
+            uint32_t planeMask;
+        };
+        StackEntry stack[BVH_MAX_DEPTH + 2];
+        int stackSize = 0;
+        stack[stackSize++] = {0, 0x3F};
+
+        while (stackSize > 0)
+        {
+            StackEntry entry = stack[--stackSize];
+            const BVHNode &node = bvh.nodes[entry.node];
+            visited++;
+
+            uint32_t planeMask = entry.planeMask;
+            if (planeMask && FrustumTestAABB(frustum, node.bounds, planeMask) == FRUSTUM_OUTSIDE)
+                continue;
+
+            if (node.count > 0)
+            {
+                for (uint32_t k = 0; k < node.count && visibleCount < maxOut; ++k)
+                {
+                    uint32_t id = bvh.itemIds[node.first + k];
+                    uint32_t itemMask = planeMask;
+                    if (itemMask && FrustumTestAABB(frustum, boundsById[id], itemMask) == FRUSTUM_OUTSIDE)
+                        continue;
+                    outIds[visibleCount++] = id;
+                }
+            }
+            else
+            {
+                // planeMask == 0 means fully inside, the children are still walked but without any plane tests
+                stack[stackSize++] = {node.first + 1, planeMask};
+                stack[stackSize++] = {node.first, planeMask};
+            }
+        }
+    }
+    if (nodesVisited)
+        *nodesVisited = visited;
+    return visibleCount;
+}
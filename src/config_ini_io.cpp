@@ -14,6 +14,10 @@ typedef struct
         int msaa_level;
         int vsync;        
     } GraphicsSettings;
+    struct
+    {
+        int autosave_delay_ms; // scene.json is written once the editor has been quiet this long
+    } EditorSettings;
 } ConfigData;
 
 #pragma warning(push, 0)
@@ -45,6 +49,7 @@ ConfigData LoadConfig()
         config.DisplaySettings.window_mode = (int)1;
         config.GraphicsSettings.msaa_level = 1;
         config.GraphicsSettings.vsync = 0;
+        config.EditorSettings.autosave_delay_ms = 500;
         SaveConfig(&config);
         return config;
     }
@@ -55,6 +60,7 @@ ConfigData LoadConfig()
     data[size] = 0;
     SDL_CloseIO(file);
 
+    config.EditorSettings.autosave_delay_ms = 500; // older config.ini files don't have the section
     Generated_LoadConfigFromString(&config, data);
 
     SDL_free(data);
@@ -8,10 +8,8 @@ bool OverlapCylinderCube(
     const DirectX::XMFLOAT3& cylCenter,   // world‑space center of cylinder (midpoint of height)
     float cylRadius,
     float cylHeight,
-    const SceneObject& cube)               // the cube (must have objectType == OBJECT_PRIMITIVE with primitiveType == PRIMITIVE_CUBE)
+    const ObjectTransform& cube)           // the cube transform (caller checks objectType == OBJECT_PRIMITIVE with primitiveType == PRIMITIVE_CUBE)
 {
-    if (cube.objectType != OBJECT_PRIMITIVE || cube.data.primitive.primitiveType != PrimitiveType::PRIMITIVE_CUBE)
-        return false;
     using namespace DirectX;
 
     // Load cube transform
@@ -101,13 +99,10 @@ bool OverlapCylinderCubeContact(
     const DirectX::XMFLOAT3& cylCenter,
     float cylRadius,
     float cylHeight,
-    const SceneObject& cube,
+    const ObjectTransform& cube,          // caller checks this is a PRIMITIVE_CUBE
     DirectX::XMFLOAT3& outNormal,
     float& outPenetration)
 {
-    if (cube.objectType != OBJECT_PRIMITIVE || cube.data.primitive.primitiveType != PrimitiveType::PRIMITIVE_CUBE)
-        return false;
-
     using namespace DirectX;
 
     XMVECTOR cubePos   = XMLoadFloat3(&cube.pos);
@@ -202,13 +197,10 @@ bool OverlapCylinderSphereContact(
     const DirectX::XMFLOAT3& cylCenter,   // world‑space centre of cylinder (midpoint of height)
     float cylRadius,
     float cylHeight,
-    const SceneObject& sphere,            // must be OBJECT_PRIMITIVE with PRIMITIVE_SPHERE (assumed uniform scale)
+    const ObjectTransform& sphere,        // caller checks this is a PRIMITIVE_SPHERE (assumed uniform scale)
     DirectX::XMFLOAT3& outNormal,
     float& outPenetration)
 {
-    if (sphere.objectType != OBJECT_PRIMITIVE || sphere.data.primitive.primitiveType != PrimitiveType::PRIMITIVE_SPHERE)
-        return false;
-
     using namespace DirectX;
 
     // Sphere centre and radius (assume uniform scale)
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// slots of the bindless texture table (the main heap's SRVs after the default texture, indexed straight from the
+// shaders). the front of the table is persistent: ranges come from a free list, first fit, and merge with their
+// neighbours when freed. a range the GPU may still read is freed deferred, it waits with the fence value of the frame
+// that freed it and only goes back on the free list once the fence has passed. the back of the table is transient:
+// one slice per frame in flight, handed out linearly and reset when that frame index comes round again (by then its
+// fence has been waited on). no D3D in here, slots are table indices and the caller owns the views and resources
+
+#define DESCRIPTOR_INVALID UINT32_MAX
+
+struct DescriptorRange
+{
+    uint32_t first, count;
+};
+
+struct DescriptorPendingFree
+{
+    DescriptorRange range;
+    uint64_t fenceValue;
+};
+
+struct DescriptorAllocator
+{
+    uint32_t persistentCount = 0;   // slots [0, persistentCount) come from the free list
+    uint32_t transientPerFrame = 0; // then frameCount slices of this many
+    uint32_t frameCount = 0;
+    std::vector<DescriptorRange> freeRanges; // sorted by first, never touching
+    std::vector<DescriptorPendingFree> pending;
+    uint32_t transientFrame = 0;
+    uint32_t transientUsed = 0;
+
+    // stats (shown in Debug Controls)
+    uint32_t used = 0; // persistent slots allocated, pending frees included
+    uint32_t highWater = 0;
+    uint32_t transientHighWater = 0;
+    int failed = 0; // allocations that didn't fit
+};
+
+inline void DescriptorAllocatorInit(DescriptorAllocator &a, uint32_t persistentCount, uint32_t transientPerFrame, uint32_t frameCount)
+{
+    a = DescriptorAllocator();
+    a.persistentCount = persistentCount;
+    a.transientPerFrame = transientPerFrame;
+    a.frameCount = frameCount;
+    if (persistentCount > 0)
+        a.freeRanges.push_back({0, persistentCount});
+}
+
+// first fit. returns the first slot of count consecutive ones, DESCRIPTOR_INVALID when no free range is big enough
+uint32_t DescriptorAlloc(DescriptorAllocator &a, uint32_t count)
+{
+    for (size_t r = 0; r < a.freeRanges.size() && count > 0; ++r)
+    {
+        DescriptorRange &range = a.freeRanges[r];
+        if (range.count < count)
+            continue;
+        uint32_t first = range.first;
+        range.first += count;
+        range.count -= count;
+        if (range.count == 0)
+            a.freeRanges.erase(a.freeRanges.begin() + r);
+        a.used += count;
+        a.highWater = a.used > a.highWater ? a.used : a.highWater;
+        return first;
+    }
+    a.failed++;
+    return DESCRIPTOR_INVALID;
+}
+
+// back to the free list right away, merged with the ranges either side. false (and nothing freed) when the range is
+// out of bounds or overlaps a free one, i.e. a double free
+bool DescriptorFree(DescriptorAllocator &a, uint32_t first, uint32_t count)
+{
+    if (count == 0 || first >= a.persistentCount || count > a.persistentCount - first)
+        return false;
+
+    size_t r = 0;
+    while (r < a.freeRanges.size() && a.freeRanges[r].first < first)
+        r++;
+    bool mergePrevious = r > 0 && a.freeRanges[r - 1].first + a.freeRanges[r - 1].count >= first;
+    bool mergeNext = r < a.freeRanges.size() && first + count >= a.freeRanges[r].first;
+    if ((mergePrevious && a.freeRanges[r - 1].first + a.freeRanges[r - 1].count > first) ||
+        (mergeNext && first + count > a.freeRanges[r].first))
+        return false;
+
+    if (mergePrevious && mergeNext)
+    {
+        a.freeRanges[r - 1].count += count + a.freeRanges[r].count;
+        a.freeRanges.erase(a.freeRanges.begin() + r);
+    }
+    else if (mergePrevious)
+        a.freeRanges[r - 1].count += count;
+    else if (mergeNext)
+    {
+        a.freeRanges[r].first = first;
+        a.freeRanges[r].count += count;
+    }
+    else
+        a.freeRanges.insert(a.freeRanges.begin() + r, {first, count});
+    a.used -= count;
+    return true;
+}
+
+// freed once the fence reaches fenceValue (the frame that stops using the range), see DescriptorRetire
+inline void DescriptorFreeDeferred(DescriptorAllocator &a, uint32_t first, uint32_t count, uint64_t fenceValue)
+{
+    a.pending.push_back({{first, count}, fenceValue});
+}
+
+// frees the pending ranges whose fence has completed, appending them to retired (if given) so the caller can release
+// what they pointed at. returns how many ranges were freed
+int DescriptorRetire(DescriptorAllocator &a, uint64_t completedFenceValue, std::vector<DescriptorRange> *retired = nullptr)
+{
+    int freed = 0;
+    size_t kept = 0;
+    for (size_t p = 0; p < a.pending.size(); ++p)
+    {
+        const DescriptorPendingFree &entry = a.pending[p];
+        if (entry.fenceValue > completedFenceValue)
+        {
+            a.pending[kept++] = entry;
+            continue;
+        }
+        if (DescriptorFree(a, entry.range.first, entry.range.count))
+        {
+            freed++;
+            if (retired)
+                retired->push_back(entry.range);
+        }
+    }
+    a.pending.resize(kept);
+    return freed;
+}
+
+// starts frameIndex's transient slice over, call once the frame's fence has been waited on
+inline void DescriptorBeginFrame(DescriptorAllocator &a, uint32_t frameIndex)
+{
+    a.transientFrame = frameIndex;
+    a.transientUsed = 0;
+}
+
+// count slots valid until this frame index comes round again, DESCRIPTOR_INVALID when the slice is full
+inline uint32_t DescriptorAllocTransient(DescriptorAllocator &a, uint32_t count)
+{
+    if (a.frameCount == 0 || count > a.transientPerFrame - a.transientUsed)
+    {
+        a.failed++;
+        return DESCRIPTOR_INVALID;
+    }
+    uint32_t first = a.persistentCount + a.transientFrame * a.transientPerFrame + a.transientUsed;
+    a.transientUsed += count;
+    a.transientHighWater = a.transientUsed > a.transientHighWater ? a.transientUsed : a.transientHighWater;
+    return first;
+}
+
+inline uint32_t DescriptorLargestFree(const DescriptorAllocator &a)
+{
+    uint32_t largest = 0;
+    for (const DescriptorRange &range : a.freeRanges)
+        largest = range.count > largest ? range.count : largest;
+    return largest;
+}
+
+// true if the free list is sorted, inside the persistent slots, has no touching or overlapping ranges and accounts
+// for every slot together with used
+bool DescriptorAllocatorValidate(const DescriptorAllocator &a)
+{
+    uint64_t freeCount = 0;
+    for (size_t r = 0; r < a.freeRanges.size(); ++r)
+    {
+        const DescriptorRange &range = a.freeRanges[r];
+        if (range.count == 0 || (uint64_t)range.first + range.count > a.persistentCount)
+            return false;
+        if (r > 0 && a.freeRanges[r - 1].first + a.freeRanges[r - 1].count >= range.first)
+            return false;
+        freeCount += range.count;
+    }
+    return freeCount + a.used == a.persistentCount && a.transientUsed <= a.transientPerFrame;
+}
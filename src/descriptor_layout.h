@@ -7,4 +7,5 @@ namespace RootParameters {
     constexpr UINT PER_FRAME_CBV = 1;
     constexpr UINT PER_SCENE_DESC_TABLE = 2;
     constexpr UINT SRV_DESC_TABLE = 3;
+    constexpr UINT INSTANCE_SRV = 4;
 }
\ No newline at end of file
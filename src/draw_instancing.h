@@ -0,0 +1,52 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <stdint.h>
+#include <string.h>
+
+// instanced draws: one draw list entry per batch, the per instance world matrices live in a per frame structured
+// buffer the vertex shader indexes with instanceBase + SV_InstanceID (see DrawWorld in shaders.hlsl). this file is
+// the CPU side packing, no D3D in here
+
+struct InstanceBatch
+{
+    uint32_t key;   // what the batch shares (the model index for bots)
+    uint32_t first; // into the packed matrices
+    uint32_t count;
+};
+
+#define INSTANCE_BATCH_SKIP UINT32_MAX // key of an item left out of every batch (a bot whose model didn't load)
+
+// groups count items by key and packs their matrices so each batch is contiguous, batches in key order and items in
+// their original order inside a batch (a counting sort). items with a key >= keyCount (INSTANCE_BATCH_SKIP) are left
+// out. keyCounts is scratch of keyCount entries, batches needs room for min(count, keyCount). returns the number of
+// batches
+int InstanceBatchPack(const uint32_t *keys, const DirectX::XMFLOAT4X4 *worlds, int count, uint32_t keyCount,
+                      uint32_t *keyCounts, DirectX::XMFLOAT4X4 *packed, InstanceBatch *batches)
+{
+    memset(keyCounts, 0, keyCount * sizeof(uint32_t));
+    for (int i = 0; i < count; ++i)
+    {
+        if (keys[i] < keyCount)
+            keyCounts[keys[i]]++;
+    }
+
+    int batchCount = 0;
+    uint32_t offset = 0;
+    for (uint32_t k = 0; k < keyCount; ++k)
+    {
+        uint32_t n = keyCounts[k];
+        if (n == 0)
+            continue;
+        batches[batchCount++] = {k, offset, n};
+        keyCounts[k] = offset; // becomes the write cursor
+        offset += n;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (keys[i] < keyCount)
+            packed[keyCounts[keys[i]]++] = worlds[i];
+    }
+    return batchCount;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+// level of detail selection from projected screen size. level 0 is the full mesh, each level after it coarser. the
+// size measure is the bounding sphere's radius over the half height of the view at its distance, so about the
+// fraction of the screen height the object covers; it shrinks with distance and grows when the fov narrows (zoom).
+// thresholds are descending, a size below thresholds[k] asks for level k + 1 or coarser.
+// no D3D in here, the meshes are picked by id in main.cpp (DRAW_MESH_LOD_STRIDE)
+
+#define DRAW_LOD_MAX_LEVELS 4
+
+// radius / (distance * tan(fov / 2)), huge when the camera is inside the sphere so that always gets level 0
+inline float DrawLodScreenSize(float radius, float distance, float tanHalfFov)
+{
+    if (distance <= radius || tanHalfFov <= 0.0f)
+        return 1e30f;
+    return radius / (distance * tanHalfFov);
+}
+
+inline float DrawLodTanHalfFov(float fovDegrees)
+{
+    return tanf(fovDegrees * (3.14159265f / 360.0f));
+}
+
+// the level size asks for without any history, clamped to levels - 1
+inline int DrawLodLevelFor(float size, const float *thresholds, int levels)
+{
+    int level = 0;
+    while (level < levels - 1 && size < thresholds[level])
+        level++;
+    return level;
+}
+
+// keeps previous while size is within hysteresis (a fraction, 0.15 = 15%) of the thresholds around it, so an object
+// sitting on a threshold doesn't swap meshes every frame. previous may be anything (levels it doesn't have included),
+// the result is always a level below levels
+inline int DrawLodSelect(float size, int previous, const float *thresholds, int levels, float hysteresis)
+{
+    int finest = DrawLodLevelFor(size * (1.0f + hysteresis), thresholds, levels);
+    int coarsest = DrawLodLevelFor(size * (1.0f - hysteresis), thresholds, levels);
+    return previous < finest ? finest : (previous > coarsest ? coarsest : previous);
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// 64-bit draw sort keys, most significant field first, so sorting the keys orders the draws by pass, then by state
+// (pipeline, blend, mesh, texture) so equal state ends up adjacent and the replay can skip rebinding it, then by depth:
+//
+//   63..62 pass | 61..58 pipeline | 57..56 blend | 55..40 mesh | 39..24 texture | 23..0 depth
+//
+// the depth field is front to back for opaque passes and back to front for DRAW_PASS_ALPHA
+
+#define DRAW_KEY_PASS_SHIFT 62
+#define DRAW_KEY_PIPELINE_SHIFT 58
+#define DRAW_KEY_BLEND_SHIFT 56
+#define DRAW_KEY_MESH_SHIFT 40
+#define DRAW_KEY_TEXTURE_SHIFT 24
+#define DRAW_KEY_DEPTH_BITS 24
+#define DRAW_KEY_DEPTH_MASK ((1ull << DRAW_KEY_DEPTH_BITS) - 1)
+
+enum DrawPass : uint32_t
+{
+    DRAW_PASS_OPAQUE = 0,
+    DRAW_PASS_ALPHA, // blended, drawn after everything opaque
+    DRAW_PASS_COUNT
+};
+
+// everything but the depth, stays the same while the draw list entry does
+inline uint64_t DrawKeyState(DrawPass pass, uint32_t pipeline, uint32_t blend, uint32_t mesh, uint32_t texture)
+{
+    return ((uint64_t)(pass & 0x3) << DRAW_KEY_PASS_SHIFT) |
+           ((uint64_t)(pipeline & 0xF) << DRAW_KEY_PIPELINE_SHIFT) |
+           ((uint64_t)(blend & 0x3) << DRAW_KEY_BLEND_SHIFT) |
+           ((uint64_t)(mesh & 0xFFFF) << DRAW_KEY_MESH_SHIFT) |
+           ((uint64_t)(texture & 0xFFFF) << DRAW_KEY_TEXTURE_SHIFT);
+}
+
+// the same key with another mesh field
+inline uint64_t DrawKeyWithMesh(uint64_t key, uint32_t mesh)
+{
+    return (key & ~(0xFFFFull << DRAW_KEY_MESH_SHIFT)) | ((uint64_t)(mesh & 0xFFFF) << DRAW_KEY_MESH_SHIFT);
+}
+
+inline DrawPass DrawKeyPass(uint64_t key)
+{
+    return (DrawPass)(key >> DRAW_KEY_PASS_SHIFT);
+}
+
+// squared view distance to the top 24 bits of its float representation. non negative floats order the same as their
+// bits, so this needs no near/far range and keeps relative precision at every distance
+inline uint64_t DrawKeyWithDepth(uint64_t stateKey, float distanceSq)
+{
+    uint32_t bits;
+    memcpy(&bits, &distanceSq, sizeof(bits));
+    uint64_t depth = (distanceSq > 0.0f ? bits : 0u) >> (32 - DRAW_KEY_DEPTH_BITS);
+    if (DrawKeyPass(stateKey) == DRAW_PASS_ALPHA)
+        depth = DRAW_KEY_DEPTH_MASK - depth; // far first
+    return stateKey | depth;
+}
+
+// LSD radix sort of keys (and the values riding along), 8 bits per pass. passes where every key has the same byte are
+// skipped, which is most of the state bytes in a typical frame. tmpKeys/tmpValues are scratch of count entries, the
+// result ends up back in keys/values
+void DrawSortRadix(uint64_t *keys, uint32_t *values, uint64_t *tmpKeys, uint32_t *tmpValues, int count)
+{
+    if (count < 2)
+        return;
+
+    uint32_t histograms[8][256] = {};
+    for (int i = 0; i < count; ++i)
+    {
+        uint64_t key = keys[i];
+        for (int b = 0; b < 8; ++b)
+            histograms[b][(key >> (b * 8)) & 0xFF]++;
+    }
+
+    uint64_t *srcKeys = keys, *dstKeys = tmpKeys;
+    uint32_t *srcValues = values, *dstValues = tmpValues;
+    for (int b = 0; b < 8; ++b)
+    {
+        uint32_t *histogram = histograms[b];
+        if (histogram[(srcKeys[0] >> (b * 8)) & 0xFF] == (uint32_t)count)
+            continue; // every key has the same byte here
+
+        uint32_t offset = 0;
+        for (int d = 0; d < 256; ++d)
+        {
+            uint32_t n = histogram[d];
+            histogram[d] = offset;
+            offset += n;
+        }
+        for (int i = 0; i < count; ++i)
+        {
+            uint32_t dst = histogram[(srcKeys[i] >> (b * 8)) & 0xFF]++;
+            dstKeys[dst] = srcKeys[i];
+            dstValues[dst] = srcValues[i];
+        }
+
+        uint64_t *k = srcKeys;
+        srcKeys = dstKeys;
+        dstKeys = k;
+        uint32_t *v = srcValues;
+        srcValues = dstValues;
+        dstValues = v;
+    }
+
+    if (srcKeys != keys)
+    {
+        memcpy(keys, srcKeys, count * sizeof(uint64_t));
+        memcpy(values, srcValues, count * sizeof(uint32_t));
+    }
+}
@@ -2,7 +2,7 @@
 // GENERATED ONDESTROY – DO NOT EDIT
 //   This file was automatically generated.
 //   by meta_ondestroy.py
-//   Generated: 2026-04-03 17:52:37
+//   Generated: 2026-10-17 02:15:54
 //------------------------------------------------------------------------
 
 #pragma once
@@ -17,9 +17,9 @@ void OnDestroy()
     WaitForAllFrames();
 
     // Release model resources
-    for (UINT i = 0; i < MAX_LOADED_MODELS; i++)
+    for (ModelResources &model : g_engine.graphics_resources.m_models)
     {
-        g_engine.graphics_resources.m_models[i].Release();
+        model.Release();
     }
 
     // Unmap and release constant buffers
@@ -42,12 +42,27 @@ void OnDestroy()
     }
 
     // Release sync objects
+    if (g_engine.sync_state.m_copyFence)
+    {
+        g_engine.sync_state.m_copyFence->Release();
+        g_engine.sync_state.m_copyFence = nullptr;
+    }
     if (g_engine.sync_state.m_fence)
     {
         g_engine.sync_state.m_fence->Release();
         g_engine.sync_state.m_fence = nullptr;
     }
 
+    // Release texture arrays
+    for (UINT i = 0; i < MAX_BINDLESS_TEXTURES; i++)
+    {
+        if (g_engine.graphics_resources.m_bindlessTextures[i])
+        {
+            g_engine.graphics_resources.m_bindlessTextures[i]->Release();
+            g_engine.graphics_resources.m_bindlessTextures[i] = nullptr;
+        }
+    }
+
     // Release graphics resources
     if (g_engine.graphics_resources.m_defaultTexture)
     {
@@ -64,45 +79,17 @@ void OnDestroy()
         g_engine.graphics_resources.m_heightfieldIndexBuffer->Release();
         g_engine.graphics_resources.m_heightfieldIndexBuffer = nullptr;
     }
-
-    // Release other resources
-    if (g_engine.graphics_resources.m_heightfieldIndexUpload)
-    {
-        g_engine.graphics_resources.m_heightfieldIndexUpload->Release();
-        g_engine.graphics_resources.m_heightfieldIndexUpload = nullptr;
-    }
-
-    // Release graphics resources
     if (g_engine.graphics_resources.m_heightfieldVertexBuffer)
     {
         g_engine.graphics_resources.m_heightfieldVertexBuffer->Release();
         g_engine.graphics_resources.m_heightfieldVertexBuffer = nullptr;
     }
-
-    // Release other resources
-    if (g_engine.graphics_resources.m_heightfieldVertexUpload)
-    {
-        g_engine.graphics_resources.m_heightfieldVertexUpload->Release();
-        g_engine.graphics_resources.m_heightfieldVertexUpload = nullptr;
-    }
-
-    // Release texture arrays
-    for (UINT i = 0; i < MAX_HEIGHTMAP_TEXTURES; i++)
-    {
-        if (g_engine.graphics_resources.m_heightmapResources[i])
-        {
-            g_engine.graphics_resources.m_heightmapResources[i]->Release();
-            g_engine.graphics_resources.m_heightmapResources[i] = nullptr;
-        }
-    }
-
-    // Release graphics resources
     if (g_engine.graphics_resources.m_heightmapTexture)
     {
         g_engine.graphics_resources.m_heightmapTexture->Release();
         g_engine.graphics_resources.m_heightmapTexture = nullptr;
     }
-    for (UINT i = 0; i < PrimitiveType::PRIMITIVE_COUNT; i++)
+    for (UINT i = 0; i < PRIMITIVE_LOD_SLOTS; i++)
     {
         if (g_engine.graphics_resources.m_indexBuffer[i])
         {
@@ -110,27 +97,12 @@ void OnDestroy()
             g_engine.graphics_resources.m_indexBuffer[i] = nullptr;
         }
     }
-
-    // Release texture arrays
-    for (UINT i = 0; i < MAX_LOADED_MODELS; i++)
-    {
-        if (g_engine.graphics_resources.m_modelAlbedoTextures[i])
-        {
-            g_engine.graphics_resources.m_modelAlbedoTextures[i]->Release();
-            g_engine.graphics_resources.m_modelAlbedoTextures[i] = nullptr;
-        }
-    }
-    for (UINT i = 0; i < MAX_SKY_TEXTURES; i++)
+    if (g_engine.graphics_resources.m_stagingBuffer)
     {
-        if (g_engine.graphics_resources.m_skyResources[i])
-        {
-            g_engine.graphics_resources.m_skyResources[i]->Release();
-            g_engine.graphics_resources.m_skyResources[i] = nullptr;
-        }
+        g_engine.graphics_resources.m_stagingBuffer->Release();
+        g_engine.graphics_resources.m_stagingBuffer = nullptr;
     }
-
-    // Release graphics resources
-    for (UINT i = 0; i < PrimitiveType::PRIMITIVE_COUNT; i++)
+    for (UINT i = 0; i < PRIMITIVE_LOD_SLOTS; i++)
     {
         if (g_engine.graphics_resources.m_vertexBuffer[i])
         {
@@ -148,6 +120,11 @@ void OnDestroy()
             g_engine.pipeline_dx12.m_commandList[i] = nullptr;
         }
     }
+    if (g_engine.pipeline_dx12.m_copyCommandList)
+    {
+        g_engine.pipeline_dx12.m_copyCommandList->Release();
+        g_engine.pipeline_dx12.m_copyCommandList = nullptr;
+    }
     // Release pipeline state objects
     for (UINT tech = 0; tech < RENDER_COUNT; ++tech)
     {
@@ -178,6 +155,14 @@ void OnDestroy()
             g_engine.pipeline_dx12.m_commandAllocators[i] = nullptr;
         }
     }
+    for (UINT i = 0; i < UPLOAD_BATCH_ALLOCATORS; i++)
+    {
+        if (g_engine.pipeline_dx12.m_copyCommandAllocators[i])
+        {
+            g_engine.pipeline_dx12.m_copyCommandAllocators[i]->Release();
+            g_engine.pipeline_dx12.m_copyCommandAllocators[i] = nullptr;
+        }
+    }
 
     // Release MSAA resources
     if (g_engine.pipeline_dx12.m_msaaDepthStencil)
@@ -252,6 +237,11 @@ void OnDestroy()
         g_engine.pipeline_dx12.m_commandQueue->Release();
         g_engine.pipeline_dx12.m_commandQueue = nullptr;
     }
+    if (g_engine.pipeline_dx12.m_copyQueue)
+    {
+        g_engine.pipeline_dx12.m_copyQueue->Release();
+        g_engine.pipeline_dx12.m_copyQueue = nullptr;
+    }
 
     // Release device (last)
     if (g_engine.pipeline_dx12.m_device)
@@ -261,6 +251,32 @@ void OnDestroy()
     }
 
     // Release other resources
+    for (UINT i = 0; i < g_FrameCount * MAX_RECORD_CHUNKS; i++)
+    {
+        if (g_engine.pipeline_dx12.m_chunkCommandAllocators[i])
+        {
+            g_engine.pipeline_dx12.m_chunkCommandAllocators[i]->Release();
+            g_engine.pipeline_dx12.m_chunkCommandAllocators[i] = nullptr;
+        }
+    }
+    for (UINT i = 0; i < g_FrameCount * MAX_RECORD_CHUNKS; i++)
+    {
+        if (g_engine.pipeline_dx12.m_chunkCommandLists[i])
+        {
+            g_engine.pipeline_dx12.m_chunkCommandLists[i]->Release();
+            g_engine.pipeline_dx12.m_chunkCommandLists[i] = nullptr;
+        }
+    }
+    if (g_engine.pipeline_dx12.m_drawCommandSignature)
+    {
+        g_engine.pipeline_dx12.m_drawCommandSignature->Release();
+        g_engine.pipeline_dx12.m_drawCommandSignature = nullptr;
+    }
+    if (g_engine.graphics_resources.m_uploadRingBuffer)
+    {
+        g_engine.graphics_resources.m_uploadRingBuffer->Release();
+        g_engine.graphics_resources.m_uploadRingBuffer = nullptr;
+    }
     for (UINT i = 0; i < 4; i++)
     {
         if (g_engine.pipeline_dx12.m_wireframePSO[i])
@@ -2,7 +2,7 @@
 // GENERATED CONFIG FUNCTIONS – DO NOT EDIT
 //   This file was automatically generated.
 //   by meta_config.py
-//   Generated: 2026-02-20 12:23:55
+//   Generated: 2026-10-17 01:02:54
 //------------------------------------------------------------------------
 
 #pragma once
@@ -11,12 +11,13 @@
 /* Inline function to generate the config string with sections */
 static inline void Generated_SaveConfigToString(ConfigData* config, char* buffer, size_t buffer_size) {
     SDL_snprintf(buffer, buffer_size, 
-                 "[DisplaySettings]\nwindow_width=%d\nwindow_height=%d\nwindow_mode=%d\n\n[GraphicsSettings]\nmsaa_level=%d\nvsync=%d\n", 
+                 "[DisplaySettings]\nwindow_width=%d\nwindow_height=%d\nwindow_mode=%d\n\n[GraphicsSettings]\nmsaa_level=%d\nvsync=%d\n\n[EditorSettings]\nautosave_delay_ms=%d\n", 
                  config->DisplaySettings.window_width,
                  config->DisplaySettings.window_height,
                  config->DisplaySettings.window_mode,
                  config->GraphicsSettings.msaa_level,
-                 config->GraphicsSettings.vsync);
+                 config->GraphicsSettings.vsync,
+                 config->EditorSettings.autosave_delay_ms);
 }
 
 /* Inline function to parse config from string data with sections */
@@ -56,6 +57,11 @@ static inline void Generated_LoadConfigFromString(ConfigData* config, char* data
                     config->GraphicsSettings.vsync = SDL_atoi(line + 6);
                 }
             }
+            if (SDL_strcmp(current_section, "EditorSettings") == 0) {
+                if (SDL_strncmp(line, "autosave_delay_ms=", 18) == 0) {
+                    config->EditorSettings.autosave_delay_ms = SDL_atoi(line + 18);
+                }
+            }
 
             // Skip to next line
             while (*line && *line != '\n') line++;
@@ -2,21 +2,12 @@
 // GENERATED MESH DATA – DO NOT EDIT
 //   This file was automatically generated.
 //   by meta_mesh.py
-//   Generated: 2026-02-20 08:58:29
+//   Generated: 2026-10-17 03:10:09
 //------------------------------------------------------------------------
 
 #pragma once
 #include "renderer_dx12.cpp"  // for Vertex
-
-enum PrimitiveType
-{
-    PRIMITIVE_CUBE,
-    PRIMITIVE_CYLINDER,
-    PRIMITIVE_PRISM,
-    PRIMITIVE_SPHERE,
-    PRIMITIVE_INVERTED_SPHERE,
-    PRIMITIVE_COUNT
-};
+#include "primitive_types.h"
 
 struct PrimitiveMeshData
 {
@@ -6627,23 +6618,2294 @@ static const uint32_t kInvertedSphereIndices[12288] = {
 
 static const UINT kInvertedSphereIndexCount = 12288;
 
-// Lookup table - order matches PrimitiveType
-static const PrimitiveMeshData kPrimitiveMeshData[PRIMITIVE_COUNT] =
-{
-    { kCubeVertices, kCubeVertexCount, kCubeIndices, kCubeIndexCount },
-    { kCylinderVertices, kCylinderVertexCount, kCylinderIndices, kCylinderIndexCount },
-    { kPrismVertices, kPrismVertexCount, kPrismIndices, kPrismIndexCount },
-    { kSphereVertices, kSphereVertexCount, kSphereIndices, kSphereIndexCount },
-    { kInvertedSphereVertices, kInvertedSphereVertexCount, kInvertedSphereIndices, kInvertedSphereIndexCount },
+static const Vertex kCylinderLod1Vertices[70] = {
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 0.500000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 0.500000f }},
+    {{ 0.500000f, -0.500000f, 0.000000f }, { 1.000000f, 0.000000f, 0.000000f }, { 0.000000f, 0.000000f }},
+    {{ 0.500000f, 0.500000f, 0.000000f }, { 1.000000f, 0.000000f, 0.000000f }, { 0.000000f, 1.000000f }},
+    {{ 0.461940f, -0.500000f, 0.191342f }, { 0.923880f, 0.000000f, 0.382683f }, { 0.062500f, 0.000000f }},
+    {{ 0.461940f, 0.500000f, 0.191342f }, { 0.923880f, 0.000000f, 0.382683f }, { 0.062500f, 1.000000f }},
+    {{ 0.353553f, -0.500000f, 0.353553f }, { 0.707107f, 0.000000f, 0.707107f }, { 0.125000f, 0.000000f }},
+    {{ 0.353553f, 0.500000f, 0.353553f }, { 0.707107f, 0.000000f, 0.707107f }, { 0.125000f, 1.000000f }},
+    {{ 0.191342f, -0.500000f, 0.461940f }, { 0.382683f, 0.000000f, 0.923880f }, { 0.187500f, 0.000000f }},
+    {{ 0.191342f, 0.500000f, 0.461940f }, { 0.382683f, 0.000000f, 0.923880f }, { 0.187500f, 1.000000f }},
+    {{ 0.000000f, -0.500000f, 0.500000f }, { 0.000000f, 0.000000f, 1.000000f }, { 0.250000f, 0.000000f }},
+    {{ 0.000000f, 0.500000f, 0.500000f }, { 0.000000f, 0.000000f, 1.000000f }, { 0.250000f, 1.000000f }},
+    {{ -0.191342f, -0.500000f, 0.461940f }, { -0.382683f, 0.000000f, 0.923880f }, { 0.312500f, 0.000000f }},
+    {{ -0.191342f, 0.500000f, 0.461940f }, { -0.382683f, 0.000000f, 0.923880f }, { 0.312500f, 1.000000f }},
+    {{ -0.353553f, -0.500000f, 0.353553f }, { -0.707107f, 0.000000f, 0.707107f }, { 0.375000f, 0.000000f }},
+    {{ -0.353553f, 0.500000f, 0.353553f }, { -0.707107f, 0.000000f, 0.707107f }, { 0.375000f, 1.000000f }},
+    {{ -0.461940f, -0.500000f, 0.191342f }, { -0.923880f, 0.000000f, 0.382683f }, { 0.437500f, 0.000000f }},
+    {{ -0.461940f, 0.500000f, 0.191342f }, { -0.923880f, 0.000000f, 0.382683f }, { 0.437500f, 1.000000f }},
+    {{ -0.500000f, -0.500000f, 0.000000f }, { -1.000000f, 0.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ -0.500000f, 0.500000f, 0.000000f }, { -1.000000f, 0.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.461940f, -0.500000f, -0.191342f }, { -0.923880f, 0.000000f, -0.382683f }, { 0.562500f, 0.000000f }},
+    {{ -0.461940f, 0.500000f, -0.191342f }, { -0.923880f, 0.000000f, -0.382683f }, { 0.562500f, 1.000000f }},
+    {{ -0.353553f, -0.500000f, -0.353553f }, { -0.707107f, 0.000000f, -0.707107f }, { 0.625000f, 0.000000f }},
+    {{ -0.353553f, 0.500000f, -0.353553f }, { -0.707107f, 0.000000f, -0.707107f }, { 0.625000f, 1.000000f }},
+    {{ -0.191342f, -0.500000f, -0.461940f }, { -0.382683f, 0.000000f, -0.923880f }, { 0.687500f, 0.000000f }},
+    {{ -0.191342f, 0.500000f, -0.461940f }, { -0.382683f, 0.000000f, -0.923880f }, { 0.687500f, 1.000000f }},
+    {{ -0.000000f, -0.500000f, -0.500000f }, { -0.000000f, 0.000000f, -1.000000f }, { 0.750000f, 0.000000f }},
+    {{ -0.000000f, 0.500000f, -0.500000f }, { -0.000000f, 0.000000f, -1.000000f }, { 0.750000f, 1.000000f }},
+    {{ 0.191342f, -0.500000f, -0.461940f }, { 0.382683f, 0.000000f, -0.923880f }, { 0.812500f, 0.000000f }},
+    {{ 0.191342f, 0.500000f, -0.461940f }, { 0.382683f, 0.000000f, -0.923880f }, { 0.812500f, 1.000000f }},
+    {{ 0.353553f, -0.500000f, -0.353553f }, { 0.707107f, 0.000000f, -0.707107f }, { 0.875000f, 0.000000f }},
+    {{ 0.353553f, 0.500000f, -0.353553f }, { 0.707107f, 0.000000f, -0.707107f }, { 0.875000f, 1.000000f }},
+    {{ 0.461940f, -0.500000f, -0.191342f }, { 0.923880f, 0.000000f, -0.382683f }, { 0.937500f, 0.000000f }},
+    {{ 0.461940f, 0.500000f, -0.191342f }, { 0.923880f, 0.000000f, -0.382683f }, { 0.937500f, 1.000000f }},
+    {{ 0.500000f, -0.500000f, -0.000000f }, { 1.000000f, 0.000000f, -0.000000f }, { 1.000000f, 0.000000f }},
+    {{ 0.500000f, 0.500000f, -0.000000f }, { 1.000000f, 0.000000f, -0.000000f }, { 1.000000f, 1.000000f }},
+    {{ 0.500000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.461940f, -0.500000f, 0.191342f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.961940f, 0.691342f }},
+    {{ 0.353553f, -0.500000f, 0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.853553f, 0.853553f }},
+    {{ 0.191342f, -0.500000f, 0.461940f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.691342f, 0.961940f }},
+    {{ 0.000000f, -0.500000f, 0.500000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.191342f, -0.500000f, 0.461940f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.308658f, 0.961940f }},
+    {{ -0.353553f, -0.500000f, 0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.146447f, 0.853553f }},
+    {{ -0.461940f, -0.500000f, 0.191342f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.038060f, 0.691342f }},
+    {{ -0.500000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.000000f, 0.500000f }},
+    {{ -0.461940f, -0.500000f, -0.191342f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.038060f, 0.308658f }},
+    {{ -0.353553f, -0.500000f, -0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.146447f, 0.146447f }},
+    {{ -0.191342f, -0.500000f, -0.461940f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.308658f, 0.038060f }},
+    {{ -0.000000f, -0.500000f, -0.500000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ 0.191342f, -0.500000f, -0.461940f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.691342f, 0.038060f }},
+    {{ 0.353553f, -0.500000f, -0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.853553f, 0.146447f }},
+    {{ 0.461940f, -0.500000f, -0.191342f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.961940f, 0.308658f }},
+    {{ 0.500000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.500000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.461940f, 0.500000f, 0.191342f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.961940f, 0.691342f }},
+    {{ 0.353553f, 0.500000f, 0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.853553f, 0.853553f }},
+    {{ 0.191342f, 0.500000f, 0.461940f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.691342f, 0.961940f }},
+    {{ 0.000000f, 0.500000f, 0.500000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.191342f, 0.500000f, 0.461940f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.308658f, 0.961940f }},
+    {{ -0.353553f, 0.500000f, 0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.146447f, 0.853553f }},
+    {{ -0.461940f, 0.500000f, 0.191342f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.038060f, 0.691342f }},
+    {{ -0.500000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.000000f, 0.500000f }},
+    {{ -0.461940f, 0.500000f, -0.191342f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.038060f, 0.308658f }},
+    {{ -0.353553f, 0.500000f, -0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.146447f, 0.146447f }},
+    {{ -0.191342f, 0.500000f, -0.461940f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.308658f, 0.038060f }},
+    {{ -0.000000f, 0.500000f, -0.500000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ 0.191342f, 0.500000f, -0.461940f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.691342f, 0.038060f }},
+    {{ 0.353553f, 0.500000f, -0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.853553f, 0.146447f }},
+    {{ 0.461940f, 0.500000f, -0.191342f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.961940f, 0.308658f }},
+    {{ 0.500000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+};
+
+static const UINT kCylinderLod1VertexCount = 70;
+
+static const uint32_t kCylinderLod1Indices[192] = {
+    2, 5, 4, 2, 3, 5, 4, 7, 6, 4, 5, 7, 
+    6, 9, 8, 6, 7, 9, 8, 11, 10, 8, 9, 11, 
+    10, 13, 12, 10, 11, 13, 12, 15, 14, 12, 13, 15, 
+    14, 17, 16, 14, 15, 17, 16, 19, 18, 16, 17, 19, 
+    18, 21, 20, 18, 19, 21, 20, 23, 22, 20, 21, 23, 
+    22, 25, 24, 22, 23, 25, 24, 27, 26, 24, 25, 27, 
+    26, 29, 28, 26, 27, 29, 28, 31, 30, 28, 29, 31, 
+    30, 33, 32, 30, 31, 33, 32, 35, 34, 32, 33, 35, 
+    0, 36, 37, 0, 37, 38, 0, 38, 39, 0, 39, 40, 
+    0, 40, 41, 0, 41, 42, 0, 42, 43, 0, 43, 44, 
+    0, 44, 45, 0, 45, 46, 0, 46, 47, 0, 47, 48, 
+    0, 48, 49, 0, 49, 50, 0, 50, 51, 0, 51, 52, 
+    1, 54, 53, 1, 55, 54, 1, 56, 55, 1, 57, 56, 
+    1, 58, 57, 1, 59, 58, 1, 60, 59, 1, 61, 60, 
+    1, 62, 61, 1, 63, 62, 1, 64, 63, 1, 65, 64, 
+    1, 66, 65, 1, 67, 66, 1, 68, 67, 1, 69, 68, 
+};
+
+static const UINT kCylinderLod1IndexCount = 192;
+
+static const Vertex kCylinderLod2Vertices[38] = {
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 0.500000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 0.500000f }},
+    {{ 0.500000f, -0.500000f, 0.000000f }, { 1.000000f, 0.000000f, 0.000000f }, { 0.000000f, 0.000000f }},
+    {{ 0.500000f, 0.500000f, 0.000000f }, { 1.000000f, 0.000000f, 0.000000f }, { 0.000000f, 1.000000f }},
+    {{ 0.353553f, -0.500000f, 0.353553f }, { 0.707107f, 0.000000f, 0.707107f }, { 0.125000f, 0.000000f }},
+    {{ 0.353553f, 0.500000f, 0.353553f }, { 0.707107f, 0.000000f, 0.707107f }, { 0.125000f, 1.000000f }},
+    {{ 0.000000f, -0.500000f, 0.500000f }, { 0.000000f, 0.000000f, 1.000000f }, { 0.250000f, 0.000000f }},
+    {{ 0.000000f, 0.500000f, 0.500000f }, { 0.000000f, 0.000000f, 1.000000f }, { 0.250000f, 1.000000f }},
+    {{ -0.353553f, -0.500000f, 0.353553f }, { -0.707107f, 0.000000f, 0.707107f }, { 0.375000f, 0.000000f }},
+    {{ -0.353553f, 0.500000f, 0.353553f }, { -0.707107f, 0.000000f, 0.707107f }, { 0.375000f, 1.000000f }},
+    {{ -0.500000f, -0.500000f, 0.000000f }, { -1.000000f, 0.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ -0.500000f, 0.500000f, 0.000000f }, { -1.000000f, 0.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.353553f, -0.500000f, -0.353553f }, { -0.707107f, 0.000000f, -0.707107f }, { 0.625000f, 0.000000f }},
+    {{ -0.353553f, 0.500000f, -0.353553f }, { -0.707107f, 0.000000f, -0.707107f }, { 0.625000f, 1.000000f }},
+    {{ -0.000000f, -0.500000f, -0.500000f }, { -0.000000f, 0.000000f, -1.000000f }, { 0.750000f, 0.000000f }},
+    {{ -0.000000f, 0.500000f, -0.500000f }, { -0.000000f, 0.000000f, -1.000000f }, { 0.750000f, 1.000000f }},
+    {{ 0.353553f, -0.500000f, -0.353553f }, { 0.707107f, 0.000000f, -0.707107f }, { 0.875000f, 0.000000f }},
+    {{ 0.353553f, 0.500000f, -0.353553f }, { 0.707107f, 0.000000f, -0.707107f }, { 0.875000f, 1.000000f }},
+    {{ 0.500000f, -0.500000f, -0.000000f }, { 1.000000f, 0.000000f, -0.000000f }, { 1.000000f, 0.000000f }},
+    {{ 0.500000f, 0.500000f, -0.000000f }, { 1.000000f, 0.000000f, -0.000000f }, { 1.000000f, 1.000000f }},
+    {{ 0.500000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.353553f, -0.500000f, 0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.853553f, 0.853553f }},
+    {{ 0.000000f, -0.500000f, 0.500000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.353553f, -0.500000f, 0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.146447f, 0.853553f }},
+    {{ -0.500000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.000000f, 0.500000f }},
+    {{ -0.353553f, -0.500000f, -0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.146447f, 0.146447f }},
+    {{ -0.000000f, -0.500000f, -0.500000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ 0.353553f, -0.500000f, -0.353553f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.853553f, 0.146447f }},
+    {{ 0.500000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.500000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.353553f, 0.500000f, 0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.853553f, 0.853553f }},
+    {{ 0.000000f, 0.500000f, 0.500000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.353553f, 0.500000f, 0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.146447f, 0.853553f }},
+    {{ -0.500000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.000000f, 0.500000f }},
+    {{ -0.353553f, 0.500000f, -0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.146447f, 0.146447f }},
+    {{ -0.000000f, 0.500000f, -0.500000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ 0.353553f, 0.500000f, -0.353553f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.853553f, 0.146447f }},
+    {{ 0.500000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+};
+
+static const UINT kCylinderLod2VertexCount = 38;
+
+static const uint32_t kCylinderLod2Indices[96] = {
+    2, 5, 4, 2, 3, 5, 4, 7, 6, 4, 5, 7, 
+    6, 9, 8, 6, 7, 9, 8, 11, 10, 8, 9, 11, 
+    10, 13, 12, 10, 11, 13, 12, 15, 14, 12, 13, 15, 
+    14, 17, 16, 14, 15, 17, 16, 19, 18, 16, 17, 19, 
+    0, 20, 21, 0, 21, 22, 0, 22, 23, 0, 23, 24, 
+    0, 24, 25, 0, 25, 26, 0, 26, 27, 0, 27, 28, 
+    1, 30, 29, 1, 31, 30, 1, 32, 31, 1, 33, 32, 
+    1, 34, 33, 1, 35, 34, 1, 36, 35, 1, 37, 36, 
+};
+
+static const UINT kCylinderLod2IndexCount = 96;
+
+static const Vertex kSphereLod1Vertices[561] = {
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.000000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.031250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.062500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.093750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.125000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.156250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.187500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.218750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.250000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.281250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.312500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.343750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.375000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.406250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.437500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.468750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.531250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.562500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.593750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.625000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.656250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.687500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.718750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.750000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.781250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.812500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.843750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.875000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.906250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.937500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.968750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 1.000000f, 0.000000f }},
+    {{ 0.097545f, -0.490393f, 0.000000f }, { 0.195090f, -0.980785f, 0.000000f }, { 0.000000f, 0.062500f }},
+    {{ 0.095671f, -0.490393f, 0.019030f }, { 0.191342f, -0.980785f, 0.038060f }, { 0.031250f, 0.062500f }},
+    {{ 0.090120f, -0.490393f, 0.037329f }, { 0.180240f, -0.980785f, 0.074658f }, { 0.062500f, 0.062500f }},
+    {{ 0.081106f, -0.490393f, 0.054193f }, { 0.162212f, -0.980785f, 0.108386f }, { 0.093750f, 0.062500f }},
+    {{ 0.068975f, -0.490393f, 0.068975f }, { 0.137950f, -0.980785f, 0.137950f }, { 0.125000f, 0.062500f }},
+    {{ 0.054193f, -0.490393f, 0.081106f }, { 0.108386f, -0.980785f, 0.162212f }, { 0.156250f, 0.062500f }},
+    {{ 0.037329f, -0.490393f, 0.090120f }, { 0.074658f, -0.980785f, 0.180240f }, { 0.187500f, 0.062500f }},
+    {{ 0.019030f, -0.490393f, 0.095671f }, { 0.038060f, -0.980785f, 0.191342f }, { 0.218750f, 0.062500f }},
+    {{ 0.000000f, -0.490393f, 0.097545f }, { 0.000000f, -0.980785f, 0.195090f }, { 0.250000f, 0.062500f }},
+    {{ -0.019030f, -0.490393f, 0.095671f }, { -0.038060f, -0.980785f, 0.191342f }, { 0.281250f, 0.062500f }},
+    {{ -0.037329f, -0.490393f, 0.090120f }, { -0.074658f, -0.980785f, 0.180240f }, { 0.312500f, 0.062500f }},
+    {{ -0.054193f, -0.490393f, 0.081106f }, { -0.108386f, -0.980785f, 0.162212f }, { 0.343750f, 0.062500f }},
+    {{ -0.068975f, -0.490393f, 0.068975f }, { -0.137950f, -0.980785f, 0.137950f }, { 0.375000f, 0.062500f }},
+    {{ -0.081106f, -0.490393f, 0.054193f }, { -0.162212f, -0.980785f, 0.108386f }, { 0.406250f, 0.062500f }},
+    {{ -0.090120f, -0.490393f, 0.037329f }, { -0.180240f, -0.980785f, 0.074658f }, { 0.437500f, 0.062500f }},
+    {{ -0.095671f, -0.490393f, 0.019030f }, { -0.191342f, -0.980785f, 0.038060f }, { 0.468750f, 0.062500f }},
+    {{ -0.097545f, -0.490393f, 0.000000f }, { -0.195090f, -0.980785f, 0.000000f }, { 0.500000f, 0.062500f }},
+    {{ -0.095671f, -0.490393f, -0.019030f }, { -0.191342f, -0.980785f, -0.038060f }, { 0.531250f, 0.062500f }},
+    {{ -0.090120f, -0.490393f, -0.037329f }, { -0.180240f, -0.980785f, -0.074658f }, { 0.562500f, 0.062500f }},
+    {{ -0.081106f, -0.490393f, -0.054193f }, { -0.162212f, -0.980785f, -0.108386f }, { 0.593750f, 0.062500f }},
+    {{ -0.068975f, -0.490393f, -0.068975f }, { -0.137950f, -0.980785f, -0.137950f }, { 0.625000f, 0.062500f }},
+    {{ -0.054193f, -0.490393f, -0.081106f }, { -0.108386f, -0.980785f, -0.162212f }, { 0.656250f, 0.062500f }},
+    {{ -0.037329f, -0.490393f, -0.090120f }, { -0.074658f, -0.980785f, -0.180240f }, { 0.687500f, 0.062500f }},
+    {{ -0.019030f, -0.490393f, -0.095671f }, { -0.038060f, -0.980785f, -0.191342f }, { 0.718750f, 0.062500f }},
+    {{ -0.000000f, -0.490393f, -0.097545f }, { -0.000000f, -0.980785f, -0.195090f }, { 0.750000f, 0.062500f }},
+    {{ 0.019030f, -0.490393f, -0.095671f }, { 0.038060f, -0.980785f, -0.191342f }, { 0.781250f, 0.062500f }},
+    {{ 0.037329f, -0.490393f, -0.090120f }, { 0.074658f, -0.980785f, -0.180240f }, { 0.812500f, 0.062500f }},
+    {{ 0.054193f, -0.490393f, -0.081106f }, { 0.108386f, -0.980785f, -0.162212f }, { 0.843750f, 0.062500f }},
+    {{ 0.068975f, -0.490393f, -0.068975f }, { 0.137950f, -0.980785f, -0.137950f }, { 0.875000f, 0.062500f }},
+    {{ 0.081106f, -0.490393f, -0.054193f }, { 0.162212f, -0.980785f, -0.108386f }, { 0.906250f, 0.062500f }},
+    {{ 0.090120f, -0.490393f, -0.037329f }, { 0.180240f, -0.980785f, -0.074658f }, { 0.937500f, 0.062500f }},
+    {{ 0.095671f, -0.490393f, -0.019030f }, { 0.191342f, -0.980785f, -0.038060f }, { 0.968750f, 0.062500f }},
+    {{ 0.097545f, -0.490393f, -0.000000f }, { 0.195090f, -0.980785f, -0.000000f }, { 1.000000f, 0.062500f }},
+    {{ 0.191342f, -0.461940f, 0.000000f }, { 0.382683f, -0.923880f, 0.000000f }, { 0.000000f, 0.125000f }},
+    {{ 0.187665f, -0.461940f, 0.037329f }, { 0.375330f, -0.923880f, 0.074658f }, { 0.031250f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, 0.073223f }, { 0.353553f, -0.923880f, 0.146447f }, { 0.062500f, 0.125000f }},
+    {{ 0.159095f, -0.461940f, 0.106304f }, { 0.318190f, -0.923880f, 0.212608f }, { 0.093750f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, 0.135299f }, { 0.270598f, -0.923880f, 0.270598f }, { 0.125000f, 0.125000f }},
+    {{ 0.106304f, -0.461940f, 0.159095f }, { 0.212608f, -0.923880f, 0.318190f }, { 0.156250f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, 0.176777f }, { 0.146447f, -0.923880f, 0.353553f }, { 0.187500f, 0.125000f }},
+    {{ 0.037329f, -0.461940f, 0.187665f }, { 0.074658f, -0.923880f, 0.375330f }, { 0.218750f, 0.125000f }},
+    {{ 0.000000f, -0.461940f, 0.191342f }, { 0.000000f, -0.923880f, 0.382683f }, { 0.250000f, 0.125000f }},
+    {{ -0.037329f, -0.461940f, 0.187665f }, { -0.074658f, -0.923880f, 0.375330f }, { 0.281250f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, 0.176777f }, { -0.146447f, -0.923880f, 0.353553f }, { 0.312500f, 0.125000f }},
+    {{ -0.106304f, -0.461940f, 0.159095f }, { -0.212608f, -0.923880f, 0.318190f }, { 0.343750f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, 0.135299f }, { -0.270598f, -0.923880f, 0.270598f }, { 0.375000f, 0.125000f }},
+    {{ -0.159095f, -0.461940f, 0.106304f }, { -0.318190f, -0.923880f, 0.212608f }, { 0.406250f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, 0.073223f }, { -0.353553f, -0.923880f, 0.146447f }, { 0.437500f, 0.125000f }},
+    {{ -0.187665f, -0.461940f, 0.037329f }, { -0.375330f, -0.923880f, 0.074658f }, { 0.468750f, 0.125000f }},
+    {{ -0.191342f, -0.461940f, 0.000000f }, { -0.382683f, -0.923880f, 0.000000f }, { 0.500000f, 0.125000f }},
+    {{ -0.187665f, -0.461940f, -0.037329f }, { -0.375330f, -0.923880f, -0.074658f }, { 0.531250f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, -0.073223f }, { -0.353553f, -0.923880f, -0.146447f }, { 0.562500f, 0.125000f }},
+    {{ -0.159095f, -0.461940f, -0.106304f }, { -0.318190f, -0.923880f, -0.212608f }, { 0.593750f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, -0.135299f }, { -0.270598f, -0.923880f, -0.270598f }, { 0.625000f, 0.125000f }},
+    {{ -0.106304f, -0.461940f, -0.159095f }, { -0.212608f, -0.923880f, -0.318190f }, { 0.656250f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, -0.176777f }, { -0.146447f, -0.923880f, -0.353553f }, { 0.687500f, 0.125000f }},
+    {{ -0.037329f, -0.461940f, -0.187665f }, { -0.074658f, -0.923880f, -0.375330f }, { 0.718750f, 0.125000f }},
+    {{ -0.000000f, -0.461940f, -0.191342f }, { -0.000000f, -0.923880f, -0.382683f }, { 0.750000f, 0.125000f }},
+    {{ 0.037329f, -0.461940f, -0.187665f }, { 0.074658f, -0.923880f, -0.375330f }, { 0.781250f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, -0.176777f }, { 0.146447f, -0.923880f, -0.353553f }, { 0.812500f, 0.125000f }},
+    {{ 0.106304f, -0.461940f, -0.159095f }, { 0.212608f, -0.923880f, -0.318190f }, { 0.843750f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, -0.135299f }, { 0.270598f, -0.923880f, -0.270598f }, { 0.875000f, 0.125000f }},
+    {{ 0.159095f, -0.461940f, -0.106304f }, { 0.318190f, -0.923880f, -0.212608f }, { 0.906250f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, -0.073223f }, { 0.353553f, -0.923880f, -0.146447f }, { 0.937500f, 0.125000f }},
+    {{ 0.187665f, -0.461940f, -0.037329f }, { 0.375330f, -0.923880f, -0.074658f }, { 0.968750f, 0.125000f }},
+    {{ 0.191342f, -0.461940f, -0.000000f }, { 0.382683f, -0.923880f, -0.000000f }, { 1.000000f, 0.125000f }},
+    {{ 0.277785f, -0.415735f, 0.000000f }, { 0.555570f, -0.831470f, 0.000000f }, { 0.000000f, 0.187500f }},
+    {{ 0.272448f, -0.415735f, 0.054193f }, { 0.544895f, -0.831470f, 0.108386f }, { 0.031250f, 0.187500f }},
+    {{ 0.256640f, -0.415735f, 0.106304f }, { 0.513280f, -0.831470f, 0.212608f }, { 0.062500f, 0.187500f }},
+    {{ 0.230970f, -0.415735f, 0.154329f }, { 0.461940f, -0.831470f, 0.308658f }, { 0.093750f, 0.187500f }},
+    {{ 0.196424f, -0.415735f, 0.196424f }, { 0.392847f, -0.831470f, 0.392847f }, { 0.125000f, 0.187500f }},
+    {{ 0.154329f, -0.415735f, 0.230970f }, { 0.308658f, -0.831470f, 0.461940f }, { 0.156250f, 0.187500f }},
+    {{ 0.106304f, -0.415735f, 0.256640f }, { 0.212608f, -0.831470f, 0.513280f }, { 0.187500f, 0.187500f }},
+    {{ 0.054193f, -0.415735f, 0.272448f }, { 0.108386f, -0.831470f, 0.544895f }, { 0.218750f, 0.187500f }},
+    {{ 0.000000f, -0.415735f, 0.277785f }, { 0.000000f, -0.831470f, 0.555570f }, { 0.250000f, 0.187500f }},
+    {{ -0.054193f, -0.415735f, 0.272448f }, { -0.108386f, -0.831470f, 0.544895f }, { 0.281250f, 0.187500f }},
+    {{ -0.106304f, -0.415735f, 0.256640f }, { -0.212608f, -0.831470f, 0.513280f }, { 0.312500f, 0.187500f }},
+    {{ -0.154329f, -0.415735f, 0.230970f }, { -0.308658f, -0.831470f, 0.461940f }, { 0.343750f, 0.187500f }},
+    {{ -0.196424f, -0.415735f, 0.196424f }, { -0.392847f, -0.831470f, 0.392847f }, { 0.375000f, 0.187500f }},
+    {{ -0.230970f, -0.415735f, 0.154329f }, { -0.461940f, -0.831470f, 0.308658f }, { 0.406250f, 0.187500f }},
+    {{ -0.256640f, -0.415735f, 0.106304f }, { -0.513280f, -0.831470f, 0.212608f }, { 0.437500f, 0.187500f }},
+    {{ -0.272448f, -0.415735f, 0.054193f }, { -0.544895f, -0.831470f, 0.108386f }, { 0.468750f, 0.187500f }},
+    {{ -0.277785f, -0.415735f, 0.000000f }, { -0.555570f, -0.831470f, 0.000000f }, { 0.500000f, 0.187500f }},
+    {{ -0.272448f, -0.415735f, -0.054193f }, { -0.544895f, -0.831470f, -0.108386f }, { 0.531250f, 0.187500f }},
+    {{ -0.256640f, -0.415735f, -0.106304f }, { -0.513280f, -0.831470f, -0.212608f }, { 0.562500f, 0.187500f }},
+    {{ -0.230970f, -0.415735f, -0.154329f }, { -0.461940f, -0.831470f, -0.308658f }, { 0.593750f, 0.187500f }},
+    {{ -0.196424f, -0.415735f, -0.196424f }, { -0.392847f, -0.831470f, -0.392847f }, { 0.625000f, 0.187500f }},
+    {{ -0.154329f, -0.415735f, -0.230970f }, { -0.308658f, -0.831470f, -0.461940f }, { 0.656250f, 0.187500f }},
+    {{ -0.106304f, -0.415735f, -0.256640f }, { -0.212608f, -0.831470f, -0.513280f }, { 0.687500f, 0.187500f }},
+    {{ -0.054193f, -0.415735f, -0.272448f }, { -0.108386f, -0.831470f, -0.544895f }, { 0.718750f, 0.187500f }},
+    {{ -0.000000f, -0.415735f, -0.277785f }, { -0.000000f, -0.831470f, -0.555570f }, { 0.750000f, 0.187500f }},
+    {{ 0.054193f, -0.415735f, -0.272448f }, { 0.108386f, -0.831470f, -0.544895f }, { 0.781250f, 0.187500f }},
+    {{ 0.106304f, -0.415735f, -0.256640f }, { 0.212608f, -0.831470f, -0.513280f }, { 0.812500f, 0.187500f }},
+    {{ 0.154329f, -0.415735f, -0.230970f }, { 0.308658f, -0.831470f, -0.461940f }, { 0.843750f, 0.187500f }},
+    {{ 0.196424f, -0.415735f, -0.196424f }, { 0.392847f, -0.831470f, -0.392847f }, { 0.875000f, 0.187500f }},
+    {{ 0.230970f, -0.415735f, -0.154329f }, { 0.461940f, -0.831470f, -0.308658f }, { 0.906250f, 0.187500f }},
+    {{ 0.256640f, -0.415735f, -0.106304f }, { 0.513280f, -0.831470f, -0.212608f }, { 0.937500f, 0.187500f }},
+    {{ 0.272448f, -0.415735f, -0.054193f }, { 0.544895f, -0.831470f, -0.108386f }, { 0.968750f, 0.187500f }},
+    {{ 0.277785f, -0.415735f, -0.000000f }, { 0.555570f, -0.831470f, -0.000000f }, { 1.000000f, 0.187500f }},
+    {{ 0.353553f, -0.353553f, 0.000000f }, { 0.707107f, -0.707107f, 0.000000f }, { 0.000000f, 0.250000f }},
+    {{ 0.346760f, -0.353553f, 0.068975f }, { 0.693520f, -0.707107f, 0.137950f }, { 0.031250f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, 0.135299f }, { 0.653281f, -0.707107f, 0.270598f }, { 0.062500f, 0.250000f }},
+    {{ 0.293969f, -0.353553f, 0.196424f }, { 0.587938f, -0.707107f, 0.392847f }, { 0.093750f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, 0.250000f }, { 0.500000f, -0.707107f, 0.500000f }, { 0.125000f, 0.250000f }},
+    {{ 0.196424f, -0.353553f, 0.293969f }, { 0.392847f, -0.707107f, 0.587938f }, { 0.156250f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, 0.326641f }, { 0.270598f, -0.707107f, 0.653281f }, { 0.187500f, 0.250000f }},
+    {{ 0.068975f, -0.353553f, 0.346760f }, { 0.137950f, -0.707107f, 0.693520f }, { 0.218750f, 0.250000f }},
+    {{ 0.000000f, -0.353553f, 0.353553f }, { 0.000000f, -0.707107f, 0.707107f }, { 0.250000f, 0.250000f }},
+    {{ -0.068975f, -0.353553f, 0.346760f }, { -0.137950f, -0.707107f, 0.693520f }, { 0.281250f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, 0.326641f }, { -0.270598f, -0.707107f, 0.653281f }, { 0.312500f, 0.250000f }},
+    {{ -0.196424f, -0.353553f, 0.293969f }, { -0.392847f, -0.707107f, 0.587938f }, { 0.343750f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, 0.250000f }, { -0.500000f, -0.707107f, 0.500000f }, { 0.375000f, 0.250000f }},
+    {{ -0.293969f, -0.353553f, 0.196424f }, { -0.587938f, -0.707107f, 0.392847f }, { 0.406250f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, 0.135299f }, { -0.653281f, -0.707107f, 0.270598f }, { 0.437500f, 0.250000f }},
+    {{ -0.346760f, -0.353553f, 0.068975f }, { -0.693520f, -0.707107f, 0.137950f }, { 0.468750f, 0.250000f }},
+    {{ -0.353553f, -0.353553f, 0.000000f }, { -0.707107f, -0.707107f, 0.000000f }, { 0.500000f, 0.250000f }},
+    {{ -0.346760f, -0.353553f, -0.068975f }, { -0.693520f, -0.707107f, -0.137950f }, { 0.531250f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, -0.135299f }, { -0.653281f, -0.707107f, -0.270598f }, { 0.562500f, 0.250000f }},
+    {{ -0.293969f, -0.353553f, -0.196424f }, { -0.587938f, -0.707107f, -0.392847f }, { 0.593750f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, -0.250000f }, { -0.500000f, -0.707107f, -0.500000f }, { 0.625000f, 0.250000f }},
+    {{ -0.196424f, -0.353553f, -0.293969f }, { -0.392847f, -0.707107f, -0.587938f }, { 0.656250f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, -0.326641f }, { -0.270598f, -0.707107f, -0.653281f }, { 0.687500f, 0.250000f }},
+    {{ -0.068975f, -0.353553f, -0.346760f }, { -0.137950f, -0.707107f, -0.693520f }, { 0.718750f, 0.250000f }},
+    {{ -0.000000f, -0.353553f, -0.353553f }, { -0.000000f, -0.707107f, -0.707107f }, { 0.750000f, 0.250000f }},
+    {{ 0.068975f, -0.353553f, -0.346760f }, { 0.137950f, -0.707107f, -0.693520f }, { 0.781250f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, -0.326641f }, { 0.270598f, -0.707107f, -0.653281f }, { 0.812500f, 0.250000f }},
+    {{ 0.196424f, -0.353553f, -0.293969f }, { 0.392847f, -0.707107f, -0.587938f }, { 0.843750f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, -0.250000f }, { 0.500000f, -0.707107f, -0.500000f }, { 0.875000f, 0.250000f }},
+    {{ 0.293969f, -0.353553f, -0.196424f }, { 0.587938f, -0.707107f, -0.392847f }, { 0.906250f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, -0.135299f }, { 0.653281f, -0.707107f, -0.270598f }, { 0.937500f, 0.250000f }},
+    {{ 0.346760f, -0.353553f, -0.068975f }, { 0.693520f, -0.707107f, -0.137950f }, { 0.968750f, 0.250000f }},
+    {{ 0.353553f, -0.353553f, -0.000000f }, { 0.707107f, -0.707107f, -0.000000f }, { 1.000000f, 0.250000f }},
+    {{ 0.415735f, -0.277785f, 0.000000f }, { 0.831470f, -0.555570f, 0.000000f }, { 0.000000f, 0.312500f }},
+    {{ 0.407747f, -0.277785f, 0.081106f }, { 0.815493f, -0.555570f, 0.162212f }, { 0.031250f, 0.312500f }},
+    {{ 0.384089f, -0.277785f, 0.159095f }, { 0.768178f, -0.555570f, 0.318190f }, { 0.062500f, 0.312500f }},
+    {{ 0.345671f, -0.277785f, 0.230970f }, { 0.691342f, -0.555570f, 0.461940f }, { 0.093750f, 0.312500f }},
+    {{ 0.293969f, -0.277785f, 0.293969f }, { 0.587938f, -0.555570f, 0.587938f }, { 0.125000f, 0.312500f }},
+    {{ 0.230970f, -0.277785f, 0.345671f }, { 0.461940f, -0.555570f, 0.691342f }, { 0.156250f, 0.312500f }},
+    {{ 0.159095f, -0.277785f, 0.384089f }, { 0.318190f, -0.555570f, 0.768178f }, { 0.187500f, 0.312500f }},
+    {{ 0.081106f, -0.277785f, 0.407747f }, { 0.162212f, -0.555570f, 0.815493f }, { 0.218750f, 0.312500f }},
+    {{ 0.000000f, -0.277785f, 0.415735f }, { 0.000000f, -0.555570f, 0.831470f }, { 0.250000f, 0.312500f }},
+    {{ -0.081106f, -0.277785f, 0.407747f }, { -0.162212f, -0.555570f, 0.815493f }, { 0.281250f, 0.312500f }},
+    {{ -0.159095f, -0.277785f, 0.384089f }, { -0.318190f, -0.555570f, 0.768178f }, { 0.312500f, 0.312500f }},
+    {{ -0.230970f, -0.277785f, 0.345671f }, { -0.461940f, -0.555570f, 0.691342f }, { 0.343750f, 0.312500f }},
+    {{ -0.293969f, -0.277785f, 0.293969f }, { -0.587938f, -0.555570f, 0.587938f }, { 0.375000f, 0.312500f }},
+    {{ -0.345671f, -0.277785f, 0.230970f }, { -0.691342f, -0.555570f, 0.461940f }, { 0.406250f, 0.312500f }},
+    {{ -0.384089f, -0.277785f, 0.159095f }, { -0.768178f, -0.555570f, 0.318190f }, { 0.437500f, 0.312500f }},
+    {{ -0.407747f, -0.277785f, 0.081106f }, { -0.815493f, -0.555570f, 0.162212f }, { 0.468750f, 0.312500f }},
+    {{ -0.415735f, -0.277785f, 0.000000f }, { -0.831470f, -0.555570f, 0.000000f }, { 0.500000f, 0.312500f }},
+    {{ -0.407747f, -0.277785f, -0.081106f }, { -0.815493f, -0.555570f, -0.162212f }, { 0.531250f, 0.312500f }},
+    {{ -0.384089f, -0.277785f, -0.159095f }, { -0.768178f, -0.555570f, -0.318190f }, { 0.562500f, 0.312500f }},
+    {{ -0.345671f, -0.277785f, -0.230970f }, { -0.691342f, -0.555570f, -0.461940f }, { 0.593750f, 0.312500f }},
+    {{ -0.293969f, -0.277785f, -0.293969f }, { -0.587938f, -0.555570f, -0.587938f }, { 0.625000f, 0.312500f }},
+    {{ -0.230970f, -0.277785f, -0.345671f }, { -0.461940f, -0.555570f, -0.691342f }, { 0.656250f, 0.312500f }},
+    {{ -0.159095f, -0.277785f, -0.384089f }, { -0.318190f, -0.555570f, -0.768178f }, { 0.687500f, 0.312500f }},
+    {{ -0.081106f, -0.277785f, -0.407747f }, { -0.162212f, -0.555570f, -0.815493f }, { 0.718750f, 0.312500f }},
+    {{ -0.000000f, -0.277785f, -0.415735f }, { -0.000000f, -0.555570f, -0.831470f }, { 0.750000f, 0.312500f }},
+    {{ 0.081106f, -0.277785f, -0.407747f }, { 0.162212f, -0.555570f, -0.815493f }, { 0.781250f, 0.312500f }},
+    {{ 0.159095f, -0.277785f, -0.384089f }, { 0.318190f, -0.555570f, -0.768178f }, { 0.812500f, 0.312500f }},
+    {{ 0.230970f, -0.277785f, -0.345671f }, { 0.461940f, -0.555570f, -0.691342f }, { 0.843750f, 0.312500f }},
+    {{ 0.293969f, -0.277785f, -0.293969f }, { 0.587938f, -0.555570f, -0.587938f }, { 0.875000f, 0.312500f }},
+    {{ 0.345671f, -0.277785f, -0.230970f }, { 0.691342f, -0.555570f, -0.461940f }, { 0.906250f, 0.312500f }},
+    {{ 0.384089f, -0.277785f, -0.159095f }, { 0.768178f, -0.555570f, -0.318190f }, { 0.937500f, 0.312500f }},
+    {{ 0.407747f, -0.277785f, -0.081106f }, { 0.815493f, -0.555570f, -0.162212f }, { 0.968750f, 0.312500f }},
+    {{ 0.415735f, -0.277785f, -0.000000f }, { 0.831470f, -0.555570f, -0.000000f }, { 1.000000f, 0.312500f }},
+    {{ 0.461940f, -0.191342f, 0.000000f }, { 0.923880f, -0.382683f, 0.000000f }, { 0.000000f, 0.375000f }},
+    {{ 0.453064f, -0.191342f, 0.090120f }, { 0.906127f, -0.382683f, 0.180240f }, { 0.031250f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, 0.176777f }, { 0.853553f, -0.382683f, 0.353553f }, { 0.062500f, 0.375000f }},
+    {{ 0.384089f, -0.191342f, 0.256640f }, { 0.768178f, -0.382683f, 0.513280f }, { 0.093750f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, 0.326641f }, { 0.653281f, -0.382683f, 0.653281f }, { 0.125000f, 0.375000f }},
+    {{ 0.256640f, -0.191342f, 0.384089f }, { 0.513280f, -0.382683f, 0.768178f }, { 0.156250f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, 0.426777f }, { 0.353553f, -0.382683f, 0.853553f }, { 0.187500f, 0.375000f }},
+    {{ 0.090120f, -0.191342f, 0.453064f }, { 0.180240f, -0.382683f, 0.906127f }, { 0.218750f, 0.375000f }},
+    {{ 0.000000f, -0.191342f, 0.461940f }, { 0.000000f, -0.382683f, 0.923880f }, { 0.250000f, 0.375000f }},
+    {{ -0.090120f, -0.191342f, 0.453064f }, { -0.180240f, -0.382683f, 0.906127f }, { 0.281250f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, 0.426777f }, { -0.353553f, -0.382683f, 0.853553f }, { 0.312500f, 0.375000f }},
+    {{ -0.256640f, -0.191342f, 0.384089f }, { -0.513280f, -0.382683f, 0.768178f }, { 0.343750f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, 0.326641f }, { -0.653281f, -0.382683f, 0.653281f }, { 0.375000f, 0.375000f }},
+    {{ -0.384089f, -0.191342f, 0.256640f }, { -0.768178f, -0.382683f, 0.513280f }, { 0.406250f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, 0.176777f }, { -0.853553f, -0.382683f, 0.353553f }, { 0.437500f, 0.375000f }},
+    {{ -0.453064f, -0.191342f, 0.090120f }, { -0.906127f, -0.382683f, 0.180240f }, { 0.468750f, 0.375000f }},
+    {{ -0.461940f, -0.191342f, 0.000000f }, { -0.923880f, -0.382683f, 0.000000f }, { 0.500000f, 0.375000f }},
+    {{ -0.453064f, -0.191342f, -0.090120f }, { -0.906127f, -0.382683f, -0.180240f }, { 0.531250f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, -0.176777f }, { -0.853553f, -0.382683f, -0.353553f }, { 0.562500f, 0.375000f }},
+    {{ -0.384089f, -0.191342f, -0.256640f }, { -0.768178f, -0.382683f, -0.513280f }, { 0.593750f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, -0.326641f }, { -0.653281f, -0.382683f, -0.653281f }, { 0.625000f, 0.375000f }},
+    {{ -0.256640f, -0.191342f, -0.384089f }, { -0.513280f, -0.382683f, -0.768178f }, { 0.656250f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, -0.426777f }, { -0.353553f, -0.382683f, -0.853553f }, { 0.687500f, 0.375000f }},
+    {{ -0.090120f, -0.191342f, -0.453064f }, { -0.180240f, -0.382683f, -0.906127f }, { 0.718750f, 0.375000f }},
+    {{ -0.000000f, -0.191342f, -0.461940f }, { -0.000000f, -0.382683f, -0.923880f }, { 0.750000f, 0.375000f }},
+    {{ 0.090120f, -0.191342f, -0.453064f }, { 0.180240f, -0.382683f, -0.906127f }, { 0.781250f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, -0.426777f }, { 0.353553f, -0.382683f, -0.853553f }, { 0.812500f, 0.375000f }},
+    {{ 0.256640f, -0.191342f, -0.384089f }, { 0.513280f, -0.382683f, -0.768178f }, { 0.843750f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, -0.326641f }, { 0.653281f, -0.382683f, -0.653281f }, { 0.875000f, 0.375000f }},
+    {{ 0.384089f, -0.191342f, -0.256640f }, { 0.768178f, -0.382683f, -0.513280f }, { 0.906250f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, -0.176777f }, { 0.853553f, -0.382683f, -0.353553f }, { 0.937500f, 0.375000f }},
+    {{ 0.453064f, -0.191342f, -0.090120f }, { 0.906127f, -0.382683f, -0.180240f }, { 0.968750f, 0.375000f }},
+    {{ 0.461940f, -0.191342f, -0.000000f }, { 0.923880f, -0.382683f, -0.000000f }, { 1.000000f, 0.375000f }},
+    {{ 0.490393f, -0.097545f, 0.000000f }, { 0.980785f, -0.195090f, 0.000000f }, { 0.000000f, 0.437500f }},
+    {{ 0.480970f, -0.097545f, 0.095671f }, { 0.961940f, -0.195090f, 0.191342f }, { 0.031250f, 0.437500f }},
+    {{ 0.453064f, -0.097545f, 0.187665f }, { 0.906127f, -0.195090f, 0.375330f }, { 0.062500f, 0.437500f }},
+    {{ 0.407747f, -0.097545f, 0.272448f }, { 0.815493f, -0.195090f, 0.544895f }, { 0.093750f, 0.437500f }},
+    {{ 0.346760f, -0.097545f, 0.346760f }, { 0.693520f, -0.195090f, 0.693520f }, { 0.125000f, 0.437500f }},
+    {{ 0.272448f, -0.097545f, 0.407747f }, { 0.544895f, -0.195090f, 0.815493f }, { 0.156250f, 0.437500f }},
+    {{ 0.187665f, -0.097545f, 0.453064f }, { 0.375330f, -0.195090f, 0.906127f }, { 0.187500f, 0.437500f }},
+    {{ 0.095671f, -0.097545f, 0.480970f }, { 0.191342f, -0.195090f, 0.961940f }, { 0.218750f, 0.437500f }},
+    {{ 0.000000f, -0.097545f, 0.490393f }, { 0.000000f, -0.195090f, 0.980785f }, { 0.250000f, 0.437500f }},
+    {{ -0.095671f, -0.097545f, 0.480970f }, { -0.191342f, -0.195090f, 0.961940f }, { 0.281250f, 0.437500f }},
+    {{ -0.187665f, -0.097545f, 0.453064f }, { -0.375330f, -0.195090f, 0.906127f }, { 0.312500f, 0.437500f }},
+    {{ -0.272448f, -0.097545f, 0.407747f }, { -0.544895f, -0.195090f, 0.815493f }, { 0.343750f, 0.437500f }},
+    {{ -0.346760f, -0.097545f, 0.346760f }, { -0.693520f, -0.195090f, 0.693520f }, { 0.375000f, 0.437500f }},
+    {{ -0.407747f, -0.097545f, 0.272448f }, { -0.815493f, -0.195090f, 0.544895f }, { 0.406250f, 0.437500f }},
+    {{ -0.453064f, -0.097545f, 0.187665f }, { -0.906127f, -0.195090f, 0.375330f }, { 0.437500f, 0.437500f }},
+    {{ -0.480970f, -0.097545f, 0.095671f }, { -0.961940f, -0.195090f, 0.191342f }, { 0.468750f, 0.437500f }},
+    {{ -0.490393f, -0.097545f, 0.000000f }, { -0.980785f, -0.195090f, 0.000000f }, { 0.500000f, 0.437500f }},
+    {{ -0.480970f, -0.097545f, -0.095671f }, { -0.961940f, -0.195090f, -0.191342f }, { 0.531250f, 0.437500f }},
+    {{ -0.453064f, -0.097545f, -0.187665f }, { -0.906127f, -0.195090f, -0.375330f }, { 0.562500f, 0.437500f }},
+    {{ -0.407747f, -0.097545f, -0.272448f }, { -0.815493f, -0.195090f, -0.544895f }, { 0.593750f, 0.437500f }},
+    {{ -0.346760f, -0.097545f, -0.346760f }, { -0.693520f, -0.195090f, -0.693520f }, { 0.625000f, 0.437500f }},
+    {{ -0.272448f, -0.097545f, -0.407747f }, { -0.544895f, -0.195090f, -0.815493f }, { 0.656250f, 0.437500f }},
+    {{ -0.187665f, -0.097545f, -0.453064f }, { -0.375330f, -0.195090f, -0.906127f }, { 0.687500f, 0.437500f }},
+    {{ -0.095671f, -0.097545f, -0.480970f }, { -0.191342f, -0.195090f, -0.961940f }, { 0.718750f, 0.437500f }},
+    {{ -0.000000f, -0.097545f, -0.490393f }, { -0.000000f, -0.195090f, -0.980785f }, { 0.750000f, 0.437500f }},
+    {{ 0.095671f, -0.097545f, -0.480970f }, { 0.191342f, -0.195090f, -0.961940f }, { 0.781250f, 0.437500f }},
+    {{ 0.187665f, -0.097545f, -0.453064f }, { 0.375330f, -0.195090f, -0.906127f }, { 0.812500f, 0.437500f }},
+    {{ 0.272448f, -0.097545f, -0.407747f }, { 0.544895f, -0.195090f, -0.815493f }, { 0.843750f, 0.437500f }},
+    {{ 0.346760f, -0.097545f, -0.346760f }, { 0.693520f, -0.195090f, -0.693520f }, { 0.875000f, 0.437500f }},
+    {{ 0.407747f, -0.097545f, -0.272448f }, { 0.815493f, -0.195090f, -0.544895f }, { 0.906250f, 0.437500f }},
+    {{ 0.453064f, -0.097545f, -0.187665f }, { 0.906127f, -0.195090f, -0.375330f }, { 0.937500f, 0.437500f }},
+    {{ 0.480970f, -0.097545f, -0.095671f }, { 0.961940f, -0.195090f, -0.191342f }, { 0.968750f, 0.437500f }},
+    {{ 0.490393f, -0.097545f, -0.000000f }, { 0.980785f, -0.195090f, -0.000000f }, { 1.000000f, 0.437500f }},
+    {{ 0.500000f, 0.000000f, 0.000000f }, { 1.000000f, 0.000000f, 0.000000f }, { 0.000000f, 0.500000f }},
+    {{ 0.490393f, 0.000000f, 0.097545f }, { 0.980785f, 0.000000f, 0.195090f }, { 0.031250f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, 0.191342f }, { 0.923880f, 0.000000f, 0.382683f }, { 0.062500f, 0.500000f }},
+    {{ 0.415735f, 0.000000f, 0.277785f }, { 0.831470f, 0.000000f, 0.555570f }, { 0.093750f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, 0.353553f }, { 0.707107f, 0.000000f, 0.707107f }, { 0.125000f, 0.500000f }},
+    {{ 0.277785f, 0.000000f, 0.415735f }, { 0.555570f, 0.000000f, 0.831470f }, { 0.156250f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, 0.461940f }, { 0.382683f, 0.000000f, 0.923880f }, { 0.187500f, 0.500000f }},
+    {{ 0.097545f, 0.000000f, 0.490393f }, { 0.195090f, 0.000000f, 0.980785f }, { 0.218750f, 0.500000f }},
+    {{ 0.000000f, 0.000000f, 0.500000f }, { 0.000000f, 0.000000f, 1.000000f }, { 0.250000f, 0.500000f }},
+    {{ -0.097545f, 0.000000f, 0.490393f }, { -0.195090f, 0.000000f, 0.980785f }, { 0.281250f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, 0.461940f }, { -0.382683f, 0.000000f, 0.923880f }, { 0.312500f, 0.500000f }},
+    {{ -0.277785f, 0.000000f, 0.415735f }, { -0.555570f, 0.000000f, 0.831470f }, { 0.343750f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, 0.353553f }, { -0.707107f, 0.000000f, 0.707107f }, { 0.375000f, 0.500000f }},
+    {{ -0.415735f, 0.000000f, 0.277785f }, { -0.831470f, 0.000000f, 0.555570f }, { 0.406250f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, 0.191342f }, { -0.923880f, 0.000000f, 0.382683f }, { 0.437500f, 0.500000f }},
+    {{ -0.490393f, 0.000000f, 0.097545f }, { -0.980785f, 0.000000f, 0.195090f }, { 0.468750f, 0.500000f }},
+    {{ -0.500000f, 0.000000f, 0.000000f }, { -1.000000f, 0.000000f, 0.000000f }, { 0.500000f, 0.500000f }},
+    {{ -0.490393f, 0.000000f, -0.097545f }, { -0.980785f, 0.000000f, -0.195090f }, { 0.531250f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, -0.191342f }, { -0.923880f, 0.000000f, -0.382683f }, { 0.562500f, 0.500000f }},
+    {{ -0.415735f, 0.000000f, -0.277785f }, { -0.831470f, 0.000000f, -0.555570f }, { 0.593750f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, -0.353553f }, { -0.707107f, 0.000000f, -0.707107f }, { 0.625000f, 0.500000f }},
+    {{ -0.277785f, 0.000000f, -0.415735f }, { -0.555570f, 0.000000f, -0.831470f }, { 0.656250f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, -0.461940f }, { -0.382683f, 0.000000f, -0.923880f }, { 0.687500f, 0.500000f }},
+    {{ -0.097545f, 0.000000f, -0.490393f }, { -0.195090f, 0.000000f, -0.980785f }, { 0.718750f, 0.500000f }},
+    {{ -0.000000f, 0.000000f, -0.500000f }, { -0.000000f, 0.000000f, -1.000000f }, { 0.750000f, 0.500000f }},
+    {{ 0.097545f, 0.000000f, -0.490393f }, { 0.195090f, 0.000000f, -0.980785f }, { 0.781250f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, -0.461940f }, { 0.382683f, 0.000000f, -0.923880f }, { 0.812500f, 0.500000f }},
+    {{ 0.277785f, 0.000000f, -0.415735f }, { 0.555570f, 0.000000f, -0.831470f }, { 0.843750f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, -0.353553f }, { 0.707107f, 0.000000f, -0.707107f }, { 0.875000f, 0.500000f }},
+    {{ 0.415735f, 0.000000f, -0.277785f }, { 0.831470f, 0.000000f, -0.555570f }, { 0.906250f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, -0.191342f }, { 0.923880f, 0.000000f, -0.382683f }, { 0.937500f, 0.500000f }},
+    {{ 0.490393f, 0.000000f, -0.097545f }, { 0.980785f, 0.000000f, -0.195090f }, { 0.968750f, 0.500000f }},
+    {{ 0.500000f, 0.000000f, -0.000000f }, { 1.000000f, 0.000000f, -0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.490393f, 0.097545f, 0.000000f }, { 0.980785f, 0.195090f, 0.000000f }, { 0.000000f, 0.562500f }},
+    {{ 0.480970f, 0.097545f, 0.095671f }, { 0.961940f, 0.195090f, 0.191342f }, { 0.031250f, 0.562500f }},
+    {{ 0.453064f, 0.097545f, 0.187665f }, { 0.906127f, 0.195090f, 0.375330f }, { 0.062500f, 0.562500f }},
+    {{ 0.407747f, 0.097545f, 0.272448f }, { 0.815493f, 0.195090f, 0.544895f }, { 0.093750f, 0.562500f }},
+    {{ 0.346760f, 0.097545f, 0.346760f }, { 0.693520f, 0.195090f, 0.693520f }, { 0.125000f, 0.562500f }},
+    {{ 0.272448f, 0.097545f, 0.407747f }, { 0.544895f, 0.195090f, 0.815493f }, { 0.156250f, 0.562500f }},
+    {{ 0.187665f, 0.097545f, 0.453064f }, { 0.375330f, 0.195090f, 0.906127f }, { 0.187500f, 0.562500f }},
+    {{ 0.095671f, 0.097545f, 0.480970f }, { 0.191342f, 0.195090f, 0.961940f }, { 0.218750f, 0.562500f }},
+    {{ 0.000000f, 0.097545f, 0.490393f }, { 0.000000f, 0.195090f, 0.980785f }, { 0.250000f, 0.562500f }},
+    {{ -0.095671f, 0.097545f, 0.480970f }, { -0.191342f, 0.195090f, 0.961940f }, { 0.281250f, 0.562500f }},
+    {{ -0.187665f, 0.097545f, 0.453064f }, { -0.375330f, 0.195090f, 0.906127f }, { 0.312500f, 0.562500f }},
+    {{ -0.272448f, 0.097545f, 0.407747f }, { -0.544895f, 0.195090f, 0.815493f }, { 0.343750f, 0.562500f }},
+    {{ -0.346760f, 0.097545f, 0.346760f }, { -0.693520f, 0.195090f, 0.693520f }, { 0.375000f, 0.562500f }},
+    {{ -0.407747f, 0.097545f, 0.272448f }, { -0.815493f, 0.195090f, 0.544895f }, { 0.406250f, 0.562500f }},
+    {{ -0.453064f, 0.097545f, 0.187665f }, { -0.906127f, 0.195090f, 0.375330f }, { 0.437500f, 0.562500f }},
+    {{ -0.480970f, 0.097545f, 0.095671f }, { -0.961940f, 0.195090f, 0.191342f }, { 0.468750f, 0.562500f }},
+    {{ -0.490393f, 0.097545f, 0.000000f }, { -0.980785f, 0.195090f, 0.000000f }, { 0.500000f, 0.562500f }},
+    {{ -0.480970f, 0.097545f, -0.095671f }, { -0.961940f, 0.195090f, -0.191342f }, { 0.531250f, 0.562500f }},
+    {{ -0.453064f, 0.097545f, -0.187665f }, { -0.906127f, 0.195090f, -0.375330f }, { 0.562500f, 0.562500f }},
+    {{ -0.407747f, 0.097545f, -0.272448f }, { -0.815493f, 0.195090f, -0.544895f }, { 0.593750f, 0.562500f }},
+    {{ -0.346760f, 0.097545f, -0.346760f }, { -0.693520f, 0.195090f, -0.693520f }, { 0.625000f, 0.562500f }},
+    {{ -0.272448f, 0.097545f, -0.407747f }, { -0.544895f, 0.195090f, -0.815493f }, { 0.656250f, 0.562500f }},
+    {{ -0.187665f, 0.097545f, -0.453064f }, { -0.375330f, 0.195090f, -0.906127f }, { 0.687500f, 0.562500f }},
+    {{ -0.095671f, 0.097545f, -0.480970f }, { -0.191342f, 0.195090f, -0.961940f }, { 0.718750f, 0.562500f }},
+    {{ -0.000000f, 0.097545f, -0.490393f }, { -0.000000f, 0.195090f, -0.980785f }, { 0.750000f, 0.562500f }},
+    {{ 0.095671f, 0.097545f, -0.480970f }, { 0.191342f, 0.195090f, -0.961940f }, { 0.781250f, 0.562500f }},
+    {{ 0.187665f, 0.097545f, -0.453064f }, { 0.375330f, 0.195090f, -0.906127f }, { 0.812500f, 0.562500f }},
+    {{ 0.272448f, 0.097545f, -0.407747f }, { 0.544895f, 0.195090f, -0.815493f }, { 0.843750f, 0.562500f }},
+    {{ 0.346760f, 0.097545f, -0.346760f }, { 0.693520f, 0.195090f, -0.693520f }, { 0.875000f, 0.562500f }},
+    {{ 0.407747f, 0.097545f, -0.272448f }, { 0.815493f, 0.195090f, -0.544895f }, { 0.906250f, 0.562500f }},
+    {{ 0.453064f, 0.097545f, -0.187665f }, { 0.906127f, 0.195090f, -0.375330f }, { 0.937500f, 0.562500f }},
+    {{ 0.480970f, 0.097545f, -0.095671f }, { 0.961940f, 0.195090f, -0.191342f }, { 0.968750f, 0.562500f }},
+    {{ 0.490393f, 0.097545f, -0.000000f }, { 0.980785f, 0.195090f, -0.000000f }, { 1.000000f, 0.562500f }},
+    {{ 0.461940f, 0.191342f, 0.000000f }, { 0.923880f, 0.382683f, 0.000000f }, { 0.000000f, 0.625000f }},
+    {{ 0.453064f, 0.191342f, 0.090120f }, { 0.906127f, 0.382683f, 0.180240f }, { 0.031250f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, 0.176777f }, { 0.853553f, 0.382683f, 0.353553f }, { 0.062500f, 0.625000f }},
+    {{ 0.384089f, 0.191342f, 0.256640f }, { 0.768178f, 0.382683f, 0.513280f }, { 0.093750f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, 0.326641f }, { 0.653281f, 0.382683f, 0.653281f }, { 0.125000f, 0.625000f }},
+    {{ 0.256640f, 0.191342f, 0.384089f }, { 0.513280f, 0.382683f, 0.768178f }, { 0.156250f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, 0.426777f }, { 0.353553f, 0.382683f, 0.853553f }, { 0.187500f, 0.625000f }},
+    {{ 0.090120f, 0.191342f, 0.453064f }, { 0.180240f, 0.382683f, 0.906127f }, { 0.218750f, 0.625000f }},
+    {{ 0.000000f, 0.191342f, 0.461940f }, { 0.000000f, 0.382683f, 0.923880f }, { 0.250000f, 0.625000f }},
+    {{ -0.090120f, 0.191342f, 0.453064f }, { -0.180240f, 0.382683f, 0.906127f }, { 0.281250f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, 0.426777f }, { -0.353553f, 0.382683f, 0.853553f }, { 0.312500f, 0.625000f }},
+    {{ -0.256640f, 0.191342f, 0.384089f }, { -0.513280f, 0.382683f, 0.768178f }, { 0.343750f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, 0.326641f }, { -0.653281f, 0.382683f, 0.653281f }, { 0.375000f, 0.625000f }},
+    {{ -0.384089f, 0.191342f, 0.256640f }, { -0.768178f, 0.382683f, 0.513280f }, { 0.406250f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, 0.176777f }, { -0.853553f, 0.382683f, 0.353553f }, { 0.437500f, 0.625000f }},
+    {{ -0.453064f, 0.191342f, 0.090120f }, { -0.906127f, 0.382683f, 0.180240f }, { 0.468750f, 0.625000f }},
+    {{ -0.461940f, 0.191342f, 0.000000f }, { -0.923880f, 0.382683f, 0.000000f }, { 0.500000f, 0.625000f }},
+    {{ -0.453064f, 0.191342f, -0.090120f }, { -0.906127f, 0.382683f, -0.180240f }, { 0.531250f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, -0.176777f }, { -0.853553f, 0.382683f, -0.353553f }, { 0.562500f, 0.625000f }},
+    {{ -0.384089f, 0.191342f, -0.256640f }, { -0.768178f, 0.382683f, -0.513280f }, { 0.593750f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, -0.326641f }, { -0.653281f, 0.382683f, -0.653281f }, { 0.625000f, 0.625000f }},
+    {{ -0.256640f, 0.191342f, -0.384089f }, { -0.513280f, 0.382683f, -0.768178f }, { 0.656250f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, -0.426777f }, { -0.353553f, 0.382683f, -0.853553f }, { 0.687500f, 0.625000f }},
+    {{ -0.090120f, 0.191342f, -0.453064f }, { -0.180240f, 0.382683f, -0.906127f }, { 0.718750f, 0.625000f }},
+    {{ -0.000000f, 0.191342f, -0.461940f }, { -0.000000f, 0.382683f, -0.923880f }, { 0.750000f, 0.625000f }},
+    {{ 0.090120f, 0.191342f, -0.453064f }, { 0.180240f, 0.382683f, -0.906127f }, { 0.781250f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, -0.426777f }, { 0.353553f, 0.382683f, -0.853553f }, { 0.812500f, 0.625000f }},
+    {{ 0.256640f, 0.191342f, -0.384089f }, { 0.513280f, 0.382683f, -0.768178f }, { 0.843750f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, -0.326641f }, { 0.653281f, 0.382683f, -0.653281f }, { 0.875000f, 0.625000f }},
+    {{ 0.384089f, 0.191342f, -0.256640f }, { 0.768178f, 0.382683f, -0.513280f }, { 0.906250f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, -0.176777f }, { 0.853553f, 0.382683f, -0.353553f }, { 0.937500f, 0.625000f }},
+    {{ 0.453064f, 0.191342f, -0.090120f }, { 0.906127f, 0.382683f, -0.180240f }, { 0.968750f, 0.625000f }},
+    {{ 0.461940f, 0.191342f, -0.000000f }, { 0.923880f, 0.382683f, -0.000000f }, { 1.000000f, 0.625000f }},
+    {{ 0.415735f, 0.277785f, 0.000000f }, { 0.831470f, 0.555570f, 0.000000f }, { 0.000000f, 0.687500f }},
+    {{ 0.407747f, 0.277785f, 0.081106f }, { 0.815493f, 0.555570f, 0.162212f }, { 0.031250f, 0.687500f }},
+    {{ 0.384089f, 0.277785f, 0.159095f }, { 0.768178f, 0.555570f, 0.318190f }, { 0.062500f, 0.687500f }},
+    {{ 0.345671f, 0.277785f, 0.230970f }, { 0.691342f, 0.555570f, 0.461940f }, { 0.093750f, 0.687500f }},
+    {{ 0.293969f, 0.277785f, 0.293969f }, { 0.587938f, 0.555570f, 0.587938f }, { 0.125000f, 0.687500f }},
+    {{ 0.230970f, 0.277785f, 0.345671f }, { 0.461940f, 0.555570f, 0.691342f }, { 0.156250f, 0.687500f }},
+    {{ 0.159095f, 0.277785f, 0.384089f }, { 0.318190f, 0.555570f, 0.768178f }, { 0.187500f, 0.687500f }},
+    {{ 0.081106f, 0.277785f, 0.407747f }, { 0.162212f, 0.555570f, 0.815493f }, { 0.218750f, 0.687500f }},
+    {{ 0.000000f, 0.277785f, 0.415735f }, { 0.000000f, 0.555570f, 0.831470f }, { 0.250000f, 0.687500f }},
+    {{ -0.081106f, 0.277785f, 0.407747f }, { -0.162212f, 0.555570f, 0.815493f }, { 0.281250f, 0.687500f }},
+    {{ -0.159095f, 0.277785f, 0.384089f }, { -0.318190f, 0.555570f, 0.768178f }, { 0.312500f, 0.687500f }},
+    {{ -0.230970f, 0.277785f, 0.345671f }, { -0.461940f, 0.555570f, 0.691342f }, { 0.343750f, 0.687500f }},
+    {{ -0.293969f, 0.277785f, 0.293969f }, { -0.587938f, 0.555570f, 0.587938f }, { 0.375000f, 0.687500f }},
+    {{ -0.345671f, 0.277785f, 0.230970f }, { -0.691342f, 0.555570f, 0.461940f }, { 0.406250f, 0.687500f }},
+    {{ -0.384089f, 0.277785f, 0.159095f }, { -0.768178f, 0.555570f, 0.318190f }, { 0.437500f, 0.687500f }},
+    {{ -0.407747f, 0.277785f, 0.081106f }, { -0.815493f, 0.555570f, 0.162212f }, { 0.468750f, 0.687500f }},
+    {{ -0.415735f, 0.277785f, 0.000000f }, { -0.831470f, 0.555570f, 0.000000f }, { 0.500000f, 0.687500f }},
+    {{ -0.407747f, 0.277785f, -0.081106f }, { -0.815493f, 0.555570f, -0.162212f }, { 0.531250f, 0.687500f }},
+    {{ -0.384089f, 0.277785f, -0.159095f }, { -0.768178f, 0.555570f, -0.318190f }, { 0.562500f, 0.687500f }},
+    {{ -0.345671f, 0.277785f, -0.230970f }, { -0.691342f, 0.555570f, -0.461940f }, { 0.593750f, 0.687500f }},
+    {{ -0.293969f, 0.277785f, -0.293969f }, { -0.587938f, 0.555570f, -0.587938f }, { 0.625000f, 0.687500f }},
+    {{ -0.230970f, 0.277785f, -0.345671f }, { -0.461940f, 0.555570f, -0.691342f }, { 0.656250f, 0.687500f }},
+    {{ -0.159095f, 0.277785f, -0.384089f }, { -0.318190f, 0.555570f, -0.768178f }, { 0.687500f, 0.687500f }},
+    {{ -0.081106f, 0.277785f, -0.407747f }, { -0.162212f, 0.555570f, -0.815493f }, { 0.718750f, 0.687500f }},
+    {{ -0.000000f, 0.277785f, -0.415735f }, { -0.000000f, 0.555570f, -0.831470f }, { 0.750000f, 0.687500f }},
+    {{ 0.081106f, 0.277785f, -0.407747f }, { 0.162212f, 0.555570f, -0.815493f }, { 0.781250f, 0.687500f }},
+    {{ 0.159095f, 0.277785f, -0.384089f }, { 0.318190f, 0.555570f, -0.768178f }, { 0.812500f, 0.687500f }},
+    {{ 0.230970f, 0.277785f, -0.345671f }, { 0.461940f, 0.555570f, -0.691342f }, { 0.843750f, 0.687500f }},
+    {{ 0.293969f, 0.277785f, -0.293969f }, { 0.587938f, 0.555570f, -0.587938f }, { 0.875000f, 0.687500f }},
+    {{ 0.345671f, 0.277785f, -0.230970f }, { 0.691342f, 0.555570f, -0.461940f }, { 0.906250f, 0.687500f }},
+    {{ 0.384089f, 0.277785f, -0.159095f }, { 0.768178f, 0.555570f, -0.318190f }, { 0.937500f, 0.687500f }},
+    {{ 0.407747f, 0.277785f, -0.081106f }, { 0.815493f, 0.555570f, -0.162212f }, { 0.968750f, 0.687500f }},
+    {{ 0.415735f, 0.277785f, -0.000000f }, { 0.831470f, 0.555570f, -0.000000f }, { 1.000000f, 0.687500f }},
+    {{ 0.353553f, 0.353553f, 0.000000f }, { 0.707107f, 0.707107f, 0.000000f }, { 0.000000f, 0.750000f }},
+    {{ 0.346760f, 0.353553f, 0.068975f }, { 0.693520f, 0.707107f, 0.137950f }, { 0.031250f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, 0.135299f }, { 0.653281f, 0.707107f, 0.270598f }, { 0.062500f, 0.750000f }},
+    {{ 0.293969f, 0.353553f, 0.196424f }, { 0.587938f, 0.707107f, 0.392847f }, { 0.093750f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, 0.250000f }, { 0.500000f, 0.707107f, 0.500000f }, { 0.125000f, 0.750000f }},
+    {{ 0.196424f, 0.353553f, 0.293969f }, { 0.392847f, 0.707107f, 0.587938f }, { 0.156250f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, 0.326641f }, { 0.270598f, 0.707107f, 0.653281f }, { 0.187500f, 0.750000f }},
+    {{ 0.068975f, 0.353553f, 0.346760f }, { 0.137950f, 0.707107f, 0.693520f }, { 0.218750f, 0.750000f }},
+    {{ 0.000000f, 0.353553f, 0.353553f }, { 0.000000f, 0.707107f, 0.707107f }, { 0.250000f, 0.750000f }},
+    {{ -0.068975f, 0.353553f, 0.346760f }, { -0.137950f, 0.707107f, 0.693520f }, { 0.281250f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, 0.326641f }, { -0.270598f, 0.707107f, 0.653281f }, { 0.312500f, 0.750000f }},
+    {{ -0.196424f, 0.353553f, 0.293969f }, { -0.392847f, 0.707107f, 0.587938f }, { 0.343750f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, 0.250000f }, { -0.500000f, 0.707107f, 0.500000f }, { 0.375000f, 0.750000f }},
+    {{ -0.293969f, 0.353553f, 0.196424f }, { -0.587938f, 0.707107f, 0.392847f }, { 0.406250f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, 0.135299f }, { -0.653281f, 0.707107f, 0.270598f }, { 0.437500f, 0.750000f }},
+    {{ -0.346760f, 0.353553f, 0.068975f }, { -0.693520f, 0.707107f, 0.137950f }, { 0.468750f, 0.750000f }},
+    {{ -0.353553f, 0.353553f, 0.000000f }, { -0.707107f, 0.707107f, 0.000000f }, { 0.500000f, 0.750000f }},
+    {{ -0.346760f, 0.353553f, -0.068975f }, { -0.693520f, 0.707107f, -0.137950f }, { 0.531250f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, -0.135299f }, { -0.653281f, 0.707107f, -0.270598f }, { 0.562500f, 0.750000f }},
+    {{ -0.293969f, 0.353553f, -0.196424f }, { -0.587938f, 0.707107f, -0.392847f }, { 0.593750f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, -0.250000f }, { -0.500000f, 0.707107f, -0.500000f }, { 0.625000f, 0.750000f }},
+    {{ -0.196424f, 0.353553f, -0.293969f }, { -0.392847f, 0.707107f, -0.587938f }, { 0.656250f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, -0.326641f }, { -0.270598f, 0.707107f, -0.653281f }, { 0.687500f, 0.750000f }},
+    {{ -0.068975f, 0.353553f, -0.346760f }, { -0.137950f, 0.707107f, -0.693520f }, { 0.718750f, 0.750000f }},
+    {{ -0.000000f, 0.353553f, -0.353553f }, { -0.000000f, 0.707107f, -0.707107f }, { 0.750000f, 0.750000f }},
+    {{ 0.068975f, 0.353553f, -0.346760f }, { 0.137950f, 0.707107f, -0.693520f }, { 0.781250f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, -0.326641f }, { 0.270598f, 0.707107f, -0.653281f }, { 0.812500f, 0.750000f }},
+    {{ 0.196424f, 0.353553f, -0.293969f }, { 0.392847f, 0.707107f, -0.587938f }, { 0.843750f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, -0.250000f }, { 0.500000f, 0.707107f, -0.500000f }, { 0.875000f, 0.750000f }},
+    {{ 0.293969f, 0.353553f, -0.196424f }, { 0.587938f, 0.707107f, -0.392847f }, { 0.906250f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, -0.135299f }, { 0.653281f, 0.707107f, -0.270598f }, { 0.937500f, 0.750000f }},
+    {{ 0.346760f, 0.353553f, -0.068975f }, { 0.693520f, 0.707107f, -0.137950f }, { 0.968750f, 0.750000f }},
+    {{ 0.353553f, 0.353553f, -0.000000f }, { 0.707107f, 0.707107f, -0.000000f }, { 1.000000f, 0.750000f }},
+    {{ 0.277785f, 0.415735f, 0.000000f }, { 0.555570f, 0.831470f, 0.000000f }, { 0.000000f, 0.812500f }},
+    {{ 0.272448f, 0.415735f, 0.054193f }, { 0.544895f, 0.831470f, 0.108386f }, { 0.031250f, 0.812500f }},
+    {{ 0.256640f, 0.415735f, 0.106304f }, { 0.513280f, 0.831470f, 0.212608f }, { 0.062500f, 0.812500f }},
+    {{ 0.230970f, 0.415735f, 0.154329f }, { 0.461940f, 0.831470f, 0.308658f }, { 0.093750f, 0.812500f }},
+    {{ 0.196424f, 0.415735f, 0.196424f }, { 0.392847f, 0.831470f, 0.392847f }, { 0.125000f, 0.812500f }},
+    {{ 0.154329f, 0.415735f, 0.230970f }, { 0.308658f, 0.831470f, 0.461940f }, { 0.156250f, 0.812500f }},
+    {{ 0.106304f, 0.415735f, 0.256640f }, { 0.212608f, 0.831470f, 0.513280f }, { 0.187500f, 0.812500f }},
+    {{ 0.054193f, 0.415735f, 0.272448f }, { 0.108386f, 0.831470f, 0.544895f }, { 0.218750f, 0.812500f }},
+    {{ 0.000000f, 0.415735f, 0.277785f }, { 0.000000f, 0.831470f, 0.555570f }, { 0.250000f, 0.812500f }},
+    {{ -0.054193f, 0.415735f, 0.272448f }, { -0.108386f, 0.831470f, 0.544895f }, { 0.281250f, 0.812500f }},
+    {{ -0.106304f, 0.415735f, 0.256640f }, { -0.212608f, 0.831470f, 0.513280f }, { 0.312500f, 0.812500f }},
+    {{ -0.154329f, 0.415735f, 0.230970f }, { -0.308658f, 0.831470f, 0.461940f }, { 0.343750f, 0.812500f }},
+    {{ -0.196424f, 0.415735f, 0.196424f }, { -0.392847f, 0.831470f, 0.392847f }, { 0.375000f, 0.812500f }},
+    {{ -0.230970f, 0.415735f, 0.154329f }, { -0.461940f, 0.831470f, 0.308658f }, { 0.406250f, 0.812500f }},
+    {{ -0.256640f, 0.415735f, 0.106304f }, { -0.513280f, 0.831470f, 0.212608f }, { 0.437500f, 0.812500f }},
+    {{ -0.272448f, 0.415735f, 0.054193f }, { -0.544895f, 0.831470f, 0.108386f }, { 0.468750f, 0.812500f }},
+    {{ -0.277785f, 0.415735f, 0.000000f }, { -0.555570f, 0.831470f, 0.000000f }, { 0.500000f, 0.812500f }},
+    {{ -0.272448f, 0.415735f, -0.054193f }, { -0.544895f, 0.831470f, -0.108386f }, { 0.531250f, 0.812500f }},
+    {{ -0.256640f, 0.415735f, -0.106304f }, { -0.513280f, 0.831470f, -0.212608f }, { 0.562500f, 0.812500f }},
+    {{ -0.230970f, 0.415735f, -0.154329f }, { -0.461940f, 0.831470f, -0.308658f }, { 0.593750f, 0.812500f }},
+    {{ -0.196424f, 0.415735f, -0.196424f }, { -0.392847f, 0.831470f, -0.392847f }, { 0.625000f, 0.812500f }},
+    {{ -0.154329f, 0.415735f, -0.230970f }, { -0.308658f, 0.831470f, -0.461940f }, { 0.656250f, 0.812500f }},
+    {{ -0.106304f, 0.415735f, -0.256640f }, { -0.212608f, 0.831470f, -0.513280f }, { 0.687500f, 0.812500f }},
+    {{ -0.054193f, 0.415735f, -0.272448f }, { -0.108386f, 0.831470f, -0.544895f }, { 0.718750f, 0.812500f }},
+    {{ -0.000000f, 0.415735f, -0.277785f }, { -0.000000f, 0.831470f, -0.555570f }, { 0.750000f, 0.812500f }},
+    {{ 0.054193f, 0.415735f, -0.272448f }, { 0.108386f, 0.831470f, -0.544895f }, { 0.781250f, 0.812500f }},
+    {{ 0.106304f, 0.415735f, -0.256640f }, { 0.212608f, 0.831470f, -0.513280f }, { 0.812500f, 0.812500f }},
+    {{ 0.154329f, 0.415735f, -0.230970f }, { 0.308658f, 0.831470f, -0.461940f }, { 0.843750f, 0.812500f }},
+    {{ 0.196424f, 0.415735f, -0.196424f }, { 0.392847f, 0.831470f, -0.392847f }, { 0.875000f, 0.812500f }},
+    {{ 0.230970f, 0.415735f, -0.154329f }, { 0.461940f, 0.831470f, -0.308658f }, { 0.906250f, 0.812500f }},
+    {{ 0.256640f, 0.415735f, -0.106304f }, { 0.513280f, 0.831470f, -0.212608f }, { 0.937500f, 0.812500f }},
+    {{ 0.272448f, 0.415735f, -0.054193f }, { 0.544895f, 0.831470f, -0.108386f }, { 0.968750f, 0.812500f }},
+    {{ 0.277785f, 0.415735f, -0.000000f }, { 0.555570f, 0.831470f, -0.000000f }, { 1.000000f, 0.812500f }},
+    {{ 0.191342f, 0.461940f, 0.000000f }, { 0.382683f, 0.923880f, 0.000000f }, { 0.000000f, 0.875000f }},
+    {{ 0.187665f, 0.461940f, 0.037329f }, { 0.375330f, 0.923880f, 0.074658f }, { 0.031250f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, 0.073223f }, { 0.353553f, 0.923880f, 0.146447f }, { 0.062500f, 0.875000f }},
+    {{ 0.159095f, 0.461940f, 0.106304f }, { 0.318190f, 0.923880f, 0.212608f }, { 0.093750f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, 0.135299f }, { 0.270598f, 0.923880f, 0.270598f }, { 0.125000f, 0.875000f }},
+    {{ 0.106304f, 0.461940f, 0.159095f }, { 0.212608f, 0.923880f, 0.318190f }, { 0.156250f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, 0.176777f }, { 0.146447f, 0.923880f, 0.353553f }, { 0.187500f, 0.875000f }},
+    {{ 0.037329f, 0.461940f, 0.187665f }, { 0.074658f, 0.923880f, 0.375330f }, { 0.218750f, 0.875000f }},
+    {{ 0.000000f, 0.461940f, 0.191342f }, { 0.000000f, 0.923880f, 0.382683f }, { 0.250000f, 0.875000f }},
+    {{ -0.037329f, 0.461940f, 0.187665f }, { -0.074658f, 0.923880f, 0.375330f }, { 0.281250f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, 0.176777f }, { -0.146447f, 0.923880f, 0.353553f }, { 0.312500f, 0.875000f }},
+    {{ -0.106304f, 0.461940f, 0.159095f }, { -0.212608f, 0.923880f, 0.318190f }, { 0.343750f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, 0.135299f }, { -0.270598f, 0.923880f, 0.270598f }, { 0.375000f, 0.875000f }},
+    {{ -0.159095f, 0.461940f, 0.106304f }, { -0.318190f, 0.923880f, 0.212608f }, { 0.406250f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, 0.073223f }, { -0.353553f, 0.923880f, 0.146447f }, { 0.437500f, 0.875000f }},
+    {{ -0.187665f, 0.461940f, 0.037329f }, { -0.375330f, 0.923880f, 0.074658f }, { 0.468750f, 0.875000f }},
+    {{ -0.191342f, 0.461940f, 0.000000f }, { -0.382683f, 0.923880f, 0.000000f }, { 0.500000f, 0.875000f }},
+    {{ -0.187665f, 0.461940f, -0.037329f }, { -0.375330f, 0.923880f, -0.074658f }, { 0.531250f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, -0.073223f }, { -0.353553f, 0.923880f, -0.146447f }, { 0.562500f, 0.875000f }},
+    {{ -0.159095f, 0.461940f, -0.106304f }, { -0.318190f, 0.923880f, -0.212608f }, { 0.593750f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, -0.135299f }, { -0.270598f, 0.923880f, -0.270598f }, { 0.625000f, 0.875000f }},
+    {{ -0.106304f, 0.461940f, -0.159095f }, { -0.212608f, 0.923880f, -0.318190f }, { 0.656250f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, -0.176777f }, { -0.146447f, 0.923880f, -0.353553f }, { 0.687500f, 0.875000f }},
+    {{ -0.037329f, 0.461940f, -0.187665f }, { -0.074658f, 0.923880f, -0.375330f }, { 0.718750f, 0.875000f }},
+    {{ -0.000000f, 0.461940f, -0.191342f }, { -0.000000f, 0.923880f, -0.382683f }, { 0.750000f, 0.875000f }},
+    {{ 0.037329f, 0.461940f, -0.187665f }, { 0.074658f, 0.923880f, -0.375330f }, { 0.781250f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, -0.176777f }, { 0.146447f, 0.923880f, -0.353553f }, { 0.812500f, 0.875000f }},
+    {{ 0.106304f, 0.461940f, -0.159095f }, { 0.212608f, 0.923880f, -0.318190f }, { 0.843750f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, -0.135299f }, { 0.270598f, 0.923880f, -0.270598f }, { 0.875000f, 0.875000f }},
+    {{ 0.159095f, 0.461940f, -0.106304f }, { 0.318190f, 0.923880f, -0.212608f }, { 0.906250f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, -0.073223f }, { 0.353553f, 0.923880f, -0.146447f }, { 0.937500f, 0.875000f }},
+    {{ 0.187665f, 0.461940f, -0.037329f }, { 0.375330f, 0.923880f, -0.074658f }, { 0.968750f, 0.875000f }},
+    {{ 0.191342f, 0.461940f, -0.000000f }, { 0.382683f, 0.923880f, -0.000000f }, { 1.000000f, 0.875000f }},
+    {{ 0.097545f, 0.490393f, 0.000000f }, { 0.195090f, 0.980785f, 0.000000f }, { 0.000000f, 0.937500f }},
+    {{ 0.095671f, 0.490393f, 0.019030f }, { 0.191342f, 0.980785f, 0.038060f }, { 0.031250f, 0.937500f }},
+    {{ 0.090120f, 0.490393f, 0.037329f }, { 0.180240f, 0.980785f, 0.074658f }, { 0.062500f, 0.937500f }},
+    {{ 0.081106f, 0.490393f, 0.054193f }, { 0.162212f, 0.980785f, 0.108386f }, { 0.093750f, 0.937500f }},
+    {{ 0.068975f, 0.490393f, 0.068975f }, { 0.137950f, 0.980785f, 0.137950f }, { 0.125000f, 0.937500f }},
+    {{ 0.054193f, 0.490393f, 0.081106f }, { 0.108386f, 0.980785f, 0.162212f }, { 0.156250f, 0.937500f }},
+    {{ 0.037329f, 0.490393f, 0.090120f }, { 0.074658f, 0.980785f, 0.180240f }, { 0.187500f, 0.937500f }},
+    {{ 0.019030f, 0.490393f, 0.095671f }, { 0.038060f, 0.980785f, 0.191342f }, { 0.218750f, 0.937500f }},
+    {{ 0.000000f, 0.490393f, 0.097545f }, { 0.000000f, 0.980785f, 0.195090f }, { 0.250000f, 0.937500f }},
+    {{ -0.019030f, 0.490393f, 0.095671f }, { -0.038060f, 0.980785f, 0.191342f }, { 0.281250f, 0.937500f }},
+    {{ -0.037329f, 0.490393f, 0.090120f }, { -0.074658f, 0.980785f, 0.180240f }, { 0.312500f, 0.937500f }},
+    {{ -0.054193f, 0.490393f, 0.081106f }, { -0.108386f, 0.980785f, 0.162212f }, { 0.343750f, 0.937500f }},
+    {{ -0.068975f, 0.490393f, 0.068975f }, { -0.137950f, 0.980785f, 0.137950f }, { 0.375000f, 0.937500f }},
+    {{ -0.081106f, 0.490393f, 0.054193f }, { -0.162212f, 0.980785f, 0.108386f }, { 0.406250f, 0.937500f }},
+    {{ -0.090120f, 0.490393f, 0.037329f }, { -0.180240f, 0.980785f, 0.074658f }, { 0.437500f, 0.937500f }},
+    {{ -0.095671f, 0.490393f, 0.019030f }, { -0.191342f, 0.980785f, 0.038060f }, { 0.468750f, 0.937500f }},
+    {{ -0.097545f, 0.490393f, 0.000000f }, { -0.195090f, 0.980785f, 0.000000f }, { 0.500000f, 0.937500f }},
+    {{ -0.095671f, 0.490393f, -0.019030f }, { -0.191342f, 0.980785f, -0.038060f }, { 0.531250f, 0.937500f }},
+    {{ -0.090120f, 0.490393f, -0.037329f }, { -0.180240f, 0.980785f, -0.074658f }, { 0.562500f, 0.937500f }},
+    {{ -0.081106f, 0.490393f, -0.054193f }, { -0.162212f, 0.980785f, -0.108386f }, { 0.593750f, 0.937500f }},
+    {{ -0.068975f, 0.490393f, -0.068975f }, { -0.137950f, 0.980785f, -0.137950f }, { 0.625000f, 0.937500f }},
+    {{ -0.054193f, 0.490393f, -0.081106f }, { -0.108386f, 0.980785f, -0.162212f }, { 0.656250f, 0.937500f }},
+    {{ -0.037329f, 0.490393f, -0.090120f }, { -0.074658f, 0.980785f, -0.180240f }, { 0.687500f, 0.937500f }},
+    {{ -0.019030f, 0.490393f, -0.095671f }, { -0.038060f, 0.980785f, -0.191342f }, { 0.718750f, 0.937500f }},
+    {{ -0.000000f, 0.490393f, -0.097545f }, { -0.000000f, 0.980785f, -0.195090f }, { 0.750000f, 0.937500f }},
+    {{ 0.019030f, 0.490393f, -0.095671f }, { 0.038060f, 0.980785f, -0.191342f }, { 0.781250f, 0.937500f }},
+    {{ 0.037329f, 0.490393f, -0.090120f }, { 0.074658f, 0.980785f, -0.180240f }, { 0.812500f, 0.937500f }},
+    {{ 0.054193f, 0.490393f, -0.081106f }, { 0.108386f, 0.980785f, -0.162212f }, { 0.843750f, 0.937500f }},
+    {{ 0.068975f, 0.490393f, -0.068975f }, { 0.137950f, 0.980785f, -0.137950f }, { 0.875000f, 0.937500f }},
+    {{ 0.081106f, 0.490393f, -0.054193f }, { 0.162212f, 0.980785f, -0.108386f }, { 0.906250f, 0.937500f }},
+    {{ 0.090120f, 0.490393f, -0.037329f }, { 0.180240f, 0.980785f, -0.074658f }, { 0.937500f, 0.937500f }},
+    {{ 0.095671f, 0.490393f, -0.019030f }, { 0.191342f, 0.980785f, -0.038060f }, { 0.968750f, 0.937500f }},
+    {{ 0.097545f, 0.490393f, -0.000000f }, { 0.195090f, 0.980785f, -0.000000f }, { 1.000000f, 0.937500f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.000000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.031250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.062500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.093750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.125000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.156250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.187500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.218750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.250000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.281250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.312500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.343750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.375000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.406250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.437500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.468750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.531250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.562500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.593750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.625000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.656250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.687500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.718750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.750000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.781250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.812500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.843750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.875000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.906250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.937500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.968750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 1.000000f, 1.000000f }},
+};
+
+static const UINT kSphereLod1VertexCount = 561;
+
+static const uint32_t kSphereLod1Indices[3072] = {
+    0, 34, 1, 0, 33, 34, 1, 35, 2, 1, 34, 35, 
+    2, 36, 3, 2, 35, 36, 3, 37, 4, 3, 36, 37, 
+    4, 38, 5, 4, 37, 38, 5, 39, 6, 5, 38, 39, 
+    6, 40, 7, 6, 39, 40, 7, 41, 8, 7, 40, 41, 
+    8, 42, 9, 8, 41, 42, 9, 43, 10, 9, 42, 43, 
+    10, 44, 11, 10, 43, 44, 11, 45, 12, 11, 44, 45, 
+    12, 46, 13, 12, 45, 46, 13, 47, 14, 13, 46, 47, 
+    14, 48, 15, 14, 47, 48, 15, 49, 16, 15, 48, 49, 
+    16, 50, 17, 16, 49, 50, 17, 51, 18, 17, 50, 51, 
+    18, 52, 19, 18, 51, 52, 19, 53, 20, 19, 52, 53, 
+    20, 54, 21, 20, 53, 54, 21, 55, 22, 21, 54, 55, 
+    22, 56, 23, 22, 55, 56, 23, 57, 24, 23, 56, 57, 
+    24, 58, 25, 24, 57, 58, 25, 59, 26, 25, 58, 59, 
+    26, 60, 27, 26, 59, 60, 27, 61, 28, 27, 60, 61, 
+    28, 62, 29, 28, 61, 62, 29, 63, 30, 29, 62, 63, 
+    30, 64, 31, 30, 63, 64, 31, 65, 32, 31, 64, 65, 
+    33, 67, 34, 33, 66, 67, 34, 68, 35, 34, 67, 68, 
+    35, 69, 36, 35, 68, 69, 36, 70, 37, 36, 69, 70, 
+    37, 71, 38, 37, 70, 71, 38, 72, 39, 38, 71, 72, 
+    39, 73, 40, 39, 72, 73, 40, 74, 41, 40, 73, 74, 
+    41, 75, 42, 41, 74, 75, 42, 76, 43, 42, 75, 76, 
+    43, 77, 44, 43, 76, 77, 44, 78, 45, 44, 77, 78, 
+    45, 79, 46, 45, 78, 79, 46, 80, 47, 46, 79, 80, 
+    47, 81, 48, 47, 80, 81, 48, 82, 49, 48, 81, 82, 
+    49, 83, 50, 49, 82, 83, 50, 84, 51, 50, 83, 84, 
+    51, 85, 52, 51, 84, 85, 52, 86, 53, 52, 85, 86, 
+    53, 87, 54, 53, 86, 87, 54, 88, 55, 54, 87, 88, 
+    55, 89, 56, 55, 88, 89, 56, 90, 57, 56, 89, 90, 
+    57, 91, 58, 57, 90, 91, 58, 92, 59, 58, 91, 92, 
+    59, 93, 60, 59, 92, 93, 60, 94, 61, 60, 93, 94, 
+    61, 95, 62, 61, 94, 95, 62, 96, 63, 62, 95, 96, 
+    63, 97, 64, 63, 96, 97, 64, 98, 65, 64, 97, 98, 
+    66, 100, 67, 66, 99, 100, 67, 101, 68, 67, 100, 101, 
+    68, 102, 69, 68, 101, 102, 69, 103, 70, 69, 102, 103, 
+    70, 104, 71, 70, 103, 104, 71, 105, 72, 71, 104, 105, 
+    72, 106, 73, 72, 105, 106, 73, 107, 74, 73, 106, 107, 
+    74, 108, 75, 74, 107, 108, 75, 109, 76, 75, 108, 109, 
+    76, 110, 77, 76, 109, 110, 77, 111, 78, 77, 110, 111, 
+    78, 112, 79, 78, 111, 112, 79, 113, 80, 79, 112, 113, 
+    80, 114, 81, 80, 113, 114, 81, 115, 82, 81, 114, 115, 
+    82, 116, 83, 82, 115, 116, 83, 117, 84, 83, 116, 117, 
+    84, 118, 85, 84, 117, 118, 85, 119, 86, 85, 118, 119, 
+    86, 120, 87, 86, 119, 120, 87, 121, 88, 87, 120, 121, 
+    88, 122, 89, 88, 121, 122, 89, 123, 90, 89, 122, 123, 
+    90, 124, 91, 90, 123, 124, 91, 125, 92, 91, 124, 125, 
+    92, 126, 93, 92, 125, 126, 93, 127, 94, 93, 126, 127, 
+    94, 128, 95, 94, 127, 128, 95, 129, 96, 95, 128, 129, 
+    96, 130, 97, 96, 129, 130, 97, 131, 98, 97, 130, 131, 
+    99, 133, 100, 99, 132, 133, 100, 134, 101, 100, 133, 134, 
+    101, 135, 102, 101, 134, 135, 102, 136, 103, 102, 135, 136, 
+    103, 137, 104, 103, 136, 137, 104, 138, 105, 104, 137, 138, 
+    105, 139, 106, 105, 138, 139, 106, 140, 107, 106, 139, 140, 
+    107, 141, 108, 107, 140, 141, 108, 142, 109, 108, 141, 142, 
+    109, 143, 110, 109, 142, 143, 110, 144, 111, 110, 143, 144, 
+    111, 145, 112, 111, 144, 145, 112, 146, 113, 112, 145, 146, 
+    113, 147, 114, 113, 146, 147, 114, 148, 115, 114, 147, 148, 
+    115, 149, 116, 115, 148, 149, 116, 150, 117, 116, 149, 150, 
+    117, 151, 118, 117, 150, 151, 118, 152, 119, 118, 151, 152, 
+    119, 153, 120, 119, 152, 153, 120, 154, 121, 120, 153, 154, 
+    121, 155, 122, 121, 154, 155, 122, 156, 123, 122, 155, 156, 
+    123, 157, 124, 123, 156, 157, 124, 158, 125, 124, 157, 158, 
+    125, 159, 126, 125, 158, 159, 126, 160, 127, 126, 159, 160, 
+    127, 161, 128, 127, 160, 161, 128, 162, 129, 128, 161, 162, 
+    129, 163, 130, 129, 162, 163, 130, 164, 131, 130, 163, 164, 
+    132, 166, 133, 132, 165, 166, 133, 167, 134, 133, 166, 167, 
+    134, 168, 135, 134, 167, 168, 135, 169, 136, 135, 168, 169, 
+    136, 170, 137, 136, 169, 170, 137, 171, 138, 137, 170, 171, 
+    138, 172, 139, 138, 171, 172, 139, 173, 140, 139, 172, 173, 
+    140, 174, 141, 140, 173, 174, 141, 175, 142, 141, 174, 175, 
+    142, 176, 143, 142, 175, 176, 143, 177, 144, 143, 176, 177, 
+    144, 178, 145, 144, 177, 178, 145, 179, 146, 145, 178, 179, 
+    146, 180, 147, 146, 179, 180, 147, 181, 148, 147, 180, 181, 
+    148, 182, 149, 148, 181, 182, 149, 183, 150, 149, 182, 183, 
+    150, 184, 151, 150, 183, 184, 151, 185, 152, 151, 184, 185, 
+    152, 186, 153, 152, 185, 186, 153, 187, 154, 153, 186, 187, 
+    154, 188, 155, 154, 187, 188, 155, 189, 156, 155, 188, 189, 
+    156, 190, 157, 156, 189, 190, 157, 191, 158, 157, 190, 191, 
+    158, 192, 159, 158, 191, 192, 159, 193, 160, 159, 192, 193, 
+    160, 194, 161, 160, 193, 194, 161, 195, 162, 161, 194, 195, 
+    162, 196, 163, 162, 195, 196, 163, 197, 164, 163, 196, 197, 
+    165, 199, 166, 165, 198, 199, 166, 200, 167, 166, 199, 200, 
+    167, 201, 168, 167, 200, 201, 168, 202, 169, 168, 201, 202, 
+    169, 203, 170, 169, 202, 203, 170, 204, 171, 170, 203, 204, 
+    171, 205, 172, 171, 204, 205, 172, 206, 173, 172, 205, 206, 
+    173, 207, 174, 173, 206, 207, 174, 208, 175, 174, 207, 208, 
+    175, 209, 176, 175, 208, 209, 176, 210, 177, 176, 209, 210, 
+    177, 211, 178, 177, 210, 211, 178, 212, 179, 178, 211, 212, 
+    179, 213, 180, 179, 212, 213, 180, 214, 181, 180, 213, 214, 
+    181, 215, 182, 181, 214, 215, 182, 216, 183, 182, 215, 216, 
+    183, 217, 184, 183, 216, 217, 184, 218, 185, 184, 217, 218, 
+    185, 219, 186, 185, 218, 219, 186, 220, 187, 186, 219, 220, 
+    187, 221, 188, 187, 220, 221, 188, 222, 189, 188, 221, 222, 
+    189, 223, 190, 189, 222, 223, 190, 224, 191, 190, 223, 224, 
+    191, 225, 192, 191, 224, 225, 192, 226, 193, 192, 225, 226, 
+    193, 227, 194, 193, 226, 227, 194, 228, 195, 194, 227, 228, 
+    195, 229, 196, 195, 228, 229, 196, 230, 197, 196, 229, 230, 
+    198, 232, 199, 198, 231, 232, 199, 233, 200, 199, 232, 233, 
+    200, 234, 201, 200, 233, 234, 201, 235, 202, 201, 234, 235, 
+    202, 236, 203, 202, 235, 236, 203, 237, 204, 203, 236, 237, 
+    204, 238, 205, 204, 237, 238, 205, 239, 206, 205, 238, 239, 
+    206, 240, 207, 206, 239, 240, 207, 241, 208, 207, 240, 241, 
+    208, 242, 209, 208, 241, 242, 209, 243, 210, 209, 242, 243, 
+    210, 244, 211, 210, 243, 244, 211, 245, 212, 211, 244, 245, 
+    212, 246, 213, 212, 245, 246, 213, 247, 214, 213, 246, 247, 
+    214, 248, 215, 214, 247, 248, 215, 249, 216, 215, 248, 249, 
+    216, 250, 217, 216, 249, 250, 217, 251, 218, 217, 250, 251, 
+    218, 252, 219, 218, 251, 252, 219, 253, 220, 219, 252, 253, 
+    220, 254, 221, 220, 253, 254, 221, 255, 222, 221, 254, 255, 
+    222, 256, 223, 222, 255, 256, 223, 257, 224, 223, 256, 257, 
+    224, 258, 225, 224, 257, 258, 225, 259, 226, 225, 258, 259, 
+    226, 260, 227, 226, 259, 260, 227, 261, 228, 227, 260, 261, 
+    228, 262, 229, 228, 261, 262, 229, 263, 230, 229, 262, 263, 
+    231, 265, 232, 231, 264, 265, 232, 266, 233, 232, 265, 266, 
+    233, 267, 234, 233, 266, 267, 234, 268, 235, 234, 267, 268, 
+    235, 269, 236, 235, 268, 269, 236, 270, 237, 236, 269, 270, 
+    237, 271, 238, 237, 270, 271, 238, 272, 239, 238, 271, 272, 
+    239, 273, 240, 239, 272, 273, 240, 274, 241, 240, 273, 274, 
+    241, 275, 242, 241, 274, 275, 242, 276, 243, 242, 275, 276, 
+    243, 277, 244, 243, 276, 277, 244, 278, 245, 244, 277, 278, 
+    245, 279, 246, 245, 278, 279, 246, 280, 247, 246, 279, 280, 
+    247, 281, 248, 247, 280, 281, 248, 282, 249, 248, 281, 282, 
+    249, 283, 250, 249, 282, 283, 250, 284, 251, 250, 283, 284, 
+    251, 285, 252, 251, 284, 285, 252, 286, 253, 252, 285, 286, 
+    253, 287, 254, 253, 286, 287, 254, 288, 255, 254, 287, 288, 
+    255, 289, 256, 255, 288, 289, 256, 290, 257, 256, 289, 290, 
+    257, 291, 258, 257, 290, 291, 258, 292, 259, 258, 291, 292, 
+    259, 293, 260, 259, 292, 293, 260, 294, 261, 260, 293, 294, 
+    261, 295, 262, 261, 294, 295, 262, 296, 263, 262, 295, 296, 
+    264, 298, 265, 264, 297, 298, 265, 299, 266, 265, 298, 299, 
+    266, 300, 267, 266, 299, 300, 267, 301, 268, 267, 300, 301, 
+    268, 302, 269, 268, 301, 302, 269, 303, 270, 269, 302, 303, 
+    270, 304, 271, 270, 303, 304, 271, 305, 272, 271, 304, 305, 
+    272, 306, 273, 272, 305, 306, 273, 307, 274, 273, 306, 307, 
+    274, 308, 275, 274, 307, 308, 275, 309, 276, 275, 308, 309, 
+    276, 310, 277, 276, 309, 310, 277, 311, 278, 277, 310, 311, 
+    278, 312, 279, 278, 311, 312, 279, 313, 280, 279, 312, 313, 
+    280, 314, 281, 280, 313, 314, 281, 315, 282, 281, 314, 315, 
+    282, 316, 283, 282, 315, 316, 283, 317, 284, 283, 316, 317, 
+    284, 318, 285, 284, 317, 318, 285, 319, 286, 285, 318, 319, 
+    286, 320, 287, 286, 319, 320, 287, 321, 288, 287, 320, 321, 
+    288, 322, 289, 288, 321, 322, 289, 323, 290, 289, 322, 323, 
+    290, 324, 291, 290, 323, 324, 291, 325, 292, 291, 324, 325, 
+    292, 326, 293, 292, 325, 326, 293, 327, 294, 293, 326, 327, 
+    294, 328, 295, 294, 327, 328, 295, 329, 296, 295, 328, 329, 
+    297, 331, 298, 297, 330, 331, 298, 332, 299, 298, 331, 332, 
+    299, 333, 300, 299, 332, 333, 300, 334, 301, 300, 333, 334, 
+    301, 335, 302, 301, 334, 335, 302, 336, 303, 302, 335, 336, 
+    303, 337, 304, 303, 336, 337, 304, 338, 305, 304, 337, 338, 
+    305, 339, 306, 305, 338, 339, 306, 340, 307, 306, 339, 340, 
+    307, 341, 308, 307, 340, 341, 308, 342, 309, 308, 341, 342, 
+    309, 343, 310, 309, 342, 343, 310, 344, 311, 310, 343, 344, 
+    311, 345, 312, 311, 344, 345, 312, 346, 313, 312, 345, 346, 
+    313, 347, 314, 313, 346, 347, 314, 348, 315, 314, 347, 348, 
+    315, 349, 316, 315, 348, 349, 316, 350, 317, 316, 349, 350, 
+    317, 351, 318, 317, 350, 351, 318, 352, 319, 318, 351, 352, 
+    319, 353, 320, 319, 352, 353, 320, 354, 321, 320, 353, 354, 
+    321, 355, 322, 321, 354, 355, 322, 356, 323, 322, 355, 356, 
+    323, 357, 324, 323, 356, 357, 324, 358, 325, 324, 357, 358, 
+    325, 359, 326, 325, 358, 359, 326, 360, 327, 326, 359, 360, 
+    327, 361, 328, 327, 360, 361, 328, 362, 329, 328, 361, 362, 
+    330, 364, 331, 330, 363, 364, 331, 365, 332, 331, 364, 365, 
+    332, 366, 333, 332, 365, 366, 333, 367, 334, 333, 366, 367, 
+    334, 368, 335, 334, 367, 368, 335, 369, 336, 335, 368, 369, 
+    336, 370, 337, 336, 369, 370, 337, 371, 338, 337, 370, 371, 
+    338, 372, 339, 338, 371, 372, 339, 373, 340, 339, 372, 373, 
+    340, 374, 341, 340, 373, 374, 341, 375, 342, 341, 374, 375, 
+    342, 376, 343, 342, 375, 376, 343, 377, 344, 343, 376, 377, 
+    344, 378, 345, 344, 377, 378, 345, 379, 346, 345, 378, 379, 
+    346, 380, 347, 346, 379, 380, 347, 381, 348, 347, 380, 381, 
+    348, 382, 349, 348, 381, 382, 349, 383, 350, 349, 382, 383, 
+    350, 384, 351, 350, 383, 384, 351, 385, 352, 351, 384, 385, 
+    352, 386, 353, 352, 385, 386, 353, 387, 354, 353, 386, 387, 
+    354, 388, 355, 354, 387, 388, 355, 389, 356, 355, 388, 389, 
+    356, 390, 357, 356, 389, 390, 357, 391, 358, 357, 390, 391, 
+    358, 392, 359, 358, 391, 392, 359, 393, 360, 359, 392, 393, 
+    360, 394, 361, 360, 393, 394, 361, 395, 362, 361, 394, 395, 
+    363, 397, 364, 363, 396, 397, 364, 398, 365, 364, 397, 398, 
+    365, 399, 366, 365, 398, 399, 366, 400, 367, 366, 399, 400, 
+    367, 401, 368, 367, 400, 401, 368, 402, 369, 368, 401, 402, 
+    369, 403, 370, 369, 402, 403, 370, 404, 371, 370, 403, 404, 
+    371, 405, 372, 371, 404, 405, 372, 406, 373, 372, 405, 406, 
+    373, 407, 374, 373, 406, 407, 374, 408, 375, 374, 407, 408, 
+    375, 409, 376, 375, 408, 409, 376, 410, 377, 376, 409, 410, 
+    377, 411, 378, 377, 410, 411, 378, 412, 379, 378, 411, 412, 
+    379, 413, 380, 379, 412, 413, 380, 414, 381, 380, 413, 414, 
+    381, 415, 382, 381, 414, 415, 382, 416, 383, 382, 415, 416, 
+    383, 417, 384, 383, 416, 417, 384, 418, 385, 384, 417, 418, 
+    385, 419, 386, 385, 418, 419, 386, 420, 387, 386, 419, 420, 
+    387, 421, 388, 387, 420, 421, 388, 422, 389, 388, 421, 422, 
+    389, 423, 390, 389, 422, 423, 390, 424, 391, 390, 423, 424, 
+    391, 425, 392, 391, 424, 425, 392, 426, 393, 392, 425, 426, 
+    393, 427, 394, 393, 426, 427, 394, 428, 395, 394, 427, 428, 
+    396, 430, 397, 396, 429, 430, 397, 431, 398, 397, 430, 431, 
+    398, 432, 399, 398, 431, 432, 399, 433, 400, 399, 432, 433, 
+    400, 434, 401, 400, 433, 434, 401, 435, 402, 401, 434, 435, 
+    402, 436, 403, 402, 435, 436, 403, 437, 404, 403, 436, 437, 
+    404, 438, 405, 404, 437, 438, 405, 439, 406, 405, 438, 439, 
+    406, 440, 407, 406, 439, 440, 407, 441, 408, 407, 440, 441, 
+    408, 442, 409, 408, 441, 442, 409, 443, 410, 409, 442, 443, 
+    410, 444, 411, 410, 443, 444, 411, 445, 412, 411, 444, 445, 
+    412, 446, 413, 412, 445, 446, 413, 447, 414, 413, 446, 447, 
+    414, 448, 415, 414, 447, 448, 415, 449, 416, 415, 448, 449, 
+    416, 450, 417, 416, 449, 450, 417, 451, 418, 417, 450, 451, 
+    418, 452, 419, 418, 451, 452, 419, 453, 420, 419, 452, 453, 
+    420, 454, 421, 420, 453, 454, 421, 455, 422, 421, 454, 455, 
+    422, 456, 423, 422, 455, 456, 423, 457, 424, 423, 456, 457, 
+    424, 458, 425, 424, 457, 458, 425, 459, 426, 425, 458, 459, 
+    426, 460, 427, 426, 459, 460, 427, 461, 428, 427, 460, 461, 
+    429, 463, 430, 429, 462, 463, 430, 464, 431, 430, 463, 464, 
+    431, 465, 432, 431, 464, 465, 432, 466, 433, 432, 465, 466, 
+    433, 467, 434, 433, 466, 467, 434, 468, 435, 434, 467, 468, 
+    435, 469, 436, 435, 468, 469, 436, 470, 437, 436, 469, 470, 
+    437, 471, 438, 437, 470, 471, 438, 472, 439, 438, 471, 472, 
+    439, 473, 440, 439, 472, 473, 440, 474, 441, 440, 473, 474, 
+    441, 475, 442, 441, 474, 475, 442, 476, 443, 442, 475, 476, 
+    443, 477, 444, 443, 476, 477, 444, 478, 445, 444, 477, 478, 
+    445, 479, 446, 445, 478, 479, 446, 480, 447, 446, 479, 480, 
+    447, 481, 448, 447, 480, 481, 448, 482, 449, 448, 481, 482, 
+    449, 483, 450, 449, 482, 483, 450, 484, 451, 450, 483, 484, 
+    451, 485, 452, 451, 484, 485, 452, 486, 453, 452, 485, 486, 
+    453, 487, 454, 453, 486, 487, 454, 488, 455, 454, 487, 488, 
+    455, 489, 456, 455, 488, 489, 456, 490, 457, 456, 489, 490, 
+    457, 491, 458, 457, 490, 491, 458, 492, 459, 458, 491, 492, 
+    459, 493, 460, 459, 492, 493, 460, 494, 461, 460, 493, 494, 
+    462, 496, 463, 462, 495, 496, 463, 497, 464, 463, 496, 497, 
+    464, 498, 465, 464, 497, 498, 465, 499, 466, 465, 498, 499, 
+    466, 500, 467, 466, 499, 500, 467, 501, 468, 467, 500, 501, 
+    468, 502, 469, 468, 501, 502, 469, 503, 470, 469, 502, 503, 
+    470, 504, 471, 470, 503, 504, 471, 505, 472, 471, 504, 505, 
+    472, 506, 473, 472, 505, 506, 473, 507, 474, 473, 506, 507, 
+    474, 508, 475, 474, 507, 508, 475, 509, 476, 475, 508, 509, 
+    476, 510, 477, 476, 509, 510, 477, 511, 478, 477, 510, 511, 
+    478, 512, 479, 478, 511, 512, 479, 513, 480, 479, 512, 513, 
+    480, 514, 481, 480, 513, 514, 481, 515, 482, 481, 514, 515, 
+    482, 516, 483, 482, 515, 516, 483, 517, 484, 483, 516, 517, 
+    484, 518, 485, 484, 517, 518, 485, 519, 486, 485, 518, 519, 
+    486, 520, 487, 486, 519, 520, 487, 521, 488, 487, 520, 521, 
+    488, 522, 489, 488, 521, 522, 489, 523, 490, 489, 522, 523, 
+    490, 524, 491, 490, 523, 524, 491, 525, 492, 491, 524, 525, 
+    492, 526, 493, 492, 525, 526, 493, 527, 494, 493, 526, 527, 
+    495, 529, 496, 495, 528, 529, 496, 530, 497, 496, 529, 530, 
+    497, 531, 498, 497, 530, 531, 498, 532, 499, 498, 531, 532, 
+    499, 533, 500, 499, 532, 533, 500, 534, 501, 500, 533, 534, 
+    501, 535, 502, 501, 534, 535, 502, 536, 503, 502, 535, 536, 
+    503, 537, 504, 503, 536, 537, 504, 538, 505, 504, 537, 538, 
+    505, 539, 506, 505, 538, 539, 506, 540, 507, 506, 539, 540, 
+    507, 541, 508, 507, 540, 541, 508, 542, 509, 508, 541, 542, 
+    509, 543, 510, 509, 542, 543, 510, 544, 511, 510, 543, 544, 
+    511, 545, 512, 511, 544, 545, 512, 546, 513, 512, 545, 546, 
+    513, 547, 514, 513, 546, 547, 514, 548, 515, 514, 547, 548, 
+    515, 549, 516, 515, 548, 549, 516, 550, 517, 516, 549, 550, 
+    517, 551, 518, 517, 550, 551, 518, 552, 519, 518, 551, 552, 
+    519, 553, 520, 519, 552, 553, 520, 554, 521, 520, 553, 554, 
+    521, 555, 522, 521, 554, 555, 522, 556, 523, 522, 555, 556, 
+    523, 557, 524, 523, 556, 557, 524, 558, 525, 524, 557, 558, 
+    525, 559, 526, 525, 558, 559, 526, 560, 527, 526, 559, 560, 
+};
+
+static const UINT kSphereLod1IndexCount = 3072;
+
+static const Vertex kSphereLod2Vertices[153] = {
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.000000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.062500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.125000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.187500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.250000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.312500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.375000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.437500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.500000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.562500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.625000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.687500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.750000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.812500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.875000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.937500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 1.000000f, 0.000000f }},
+    {{ 0.191342f, -0.461940f, 0.000000f }, { 0.382683f, -0.923880f, 0.000000f }, { 0.000000f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, 0.073223f }, { 0.353553f, -0.923880f, 0.146447f }, { 0.062500f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, 0.135299f }, { 0.270598f, -0.923880f, 0.270598f }, { 0.125000f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, 0.176777f }, { 0.146447f, -0.923880f, 0.353553f }, { 0.187500f, 0.125000f }},
+    {{ 0.000000f, -0.461940f, 0.191342f }, { 0.000000f, -0.923880f, 0.382683f }, { 0.250000f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, 0.176777f }, { -0.146447f, -0.923880f, 0.353553f }, { 0.312500f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, 0.135299f }, { -0.270598f, -0.923880f, 0.270598f }, { 0.375000f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, 0.073223f }, { -0.353553f, -0.923880f, 0.146447f }, { 0.437500f, 0.125000f }},
+    {{ -0.191342f, -0.461940f, 0.000000f }, { -0.382683f, -0.923880f, 0.000000f }, { 0.500000f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, -0.073223f }, { -0.353553f, -0.923880f, -0.146447f }, { 0.562500f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, -0.135299f }, { -0.270598f, -0.923880f, -0.270598f }, { 0.625000f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, -0.176777f }, { -0.146447f, -0.923880f, -0.353553f }, { 0.687500f, 0.125000f }},
+    {{ -0.000000f, -0.461940f, -0.191342f }, { -0.000000f, -0.923880f, -0.382683f }, { 0.750000f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, -0.176777f }, { 0.146447f, -0.923880f, -0.353553f }, { 0.812500f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, -0.135299f }, { 0.270598f, -0.923880f, -0.270598f }, { 0.875000f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, -0.073223f }, { 0.353553f, -0.923880f, -0.146447f }, { 0.937500f, 0.125000f }},
+    {{ 0.191342f, -0.461940f, -0.000000f }, { 0.382683f, -0.923880f, -0.000000f }, { 1.000000f, 0.125000f }},
+    {{ 0.353553f, -0.353553f, 0.000000f }, { 0.707107f, -0.707107f, 0.000000f }, { 0.000000f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, 0.135299f }, { 0.653281f, -0.707107f, 0.270598f }, { 0.062500f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, 0.250000f }, { 0.500000f, -0.707107f, 0.500000f }, { 0.125000f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, 0.326641f }, { 0.270598f, -0.707107f, 0.653281f }, { 0.187500f, 0.250000f }},
+    {{ 0.000000f, -0.353553f, 0.353553f }, { 0.000000f, -0.707107f, 0.707107f }, { 0.250000f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, 0.326641f }, { -0.270598f, -0.707107f, 0.653281f }, { 0.312500f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, 0.250000f }, { -0.500000f, -0.707107f, 0.500000f }, { 0.375000f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, 0.135299f }, { -0.653281f, -0.707107f, 0.270598f }, { 0.437500f, 0.250000f }},
+    {{ -0.353553f, -0.353553f, 0.000000f }, { -0.707107f, -0.707107f, 0.000000f }, { 0.500000f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, -0.135299f }, { -0.653281f, -0.707107f, -0.270598f }, { 0.562500f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, -0.250000f }, { -0.500000f, -0.707107f, -0.500000f }, { 0.625000f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, -0.326641f }, { -0.270598f, -0.707107f, -0.653281f }, { 0.687500f, 0.250000f }},
+    {{ -0.000000f, -0.353553f, -0.353553f }, { -0.000000f, -0.707107f, -0.707107f }, { 0.750000f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, -0.326641f }, { 0.270598f, -0.707107f, -0.653281f }, { 0.812500f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, -0.250000f }, { 0.500000f, -0.707107f, -0.500000f }, { 0.875000f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, -0.135299f }, { 0.653281f, -0.707107f, -0.270598f }, { 0.937500f, 0.250000f }},
+    {{ 0.353553f, -0.353553f, -0.000000f }, { 0.707107f, -0.707107f, -0.000000f }, { 1.000000f, 0.250000f }},
+    {{ 0.461940f, -0.191342f, 0.000000f }, { 0.923880f, -0.382683f, 0.000000f }, { 0.000000f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, 0.176777f }, { 0.853553f, -0.382683f, 0.353553f }, { 0.062500f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, 0.326641f }, { 0.653281f, -0.382683f, 0.653281f }, { 0.125000f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, 0.426777f }, { 0.353553f, -0.382683f, 0.853553f }, { 0.187500f, 0.375000f }},
+    {{ 0.000000f, -0.191342f, 0.461940f }, { 0.000000f, -0.382683f, 0.923880f }, { 0.250000f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, 0.426777f }, { -0.353553f, -0.382683f, 0.853553f }, { 0.312500f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, 0.326641f }, { -0.653281f, -0.382683f, 0.653281f }, { 0.375000f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, 0.176777f }, { -0.853553f, -0.382683f, 0.353553f }, { 0.437500f, 0.375000f }},
+    {{ -0.461940f, -0.191342f, 0.000000f }, { -0.923880f, -0.382683f, 0.000000f }, { 0.500000f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, -0.176777f }, { -0.853553f, -0.382683f, -0.353553f }, { 0.562500f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, -0.326641f }, { -0.653281f, -0.382683f, -0.653281f }, { 0.625000f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, -0.426777f }, { -0.353553f, -0.382683f, -0.853553f }, { 0.687500f, 0.375000f }},
+    {{ -0.000000f, -0.191342f, -0.461940f }, { -0.000000f, -0.382683f, -0.923880f }, { 0.750000f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, -0.426777f }, { 0.353553f, -0.382683f, -0.853553f }, { 0.812500f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, -0.326641f }, { 0.653281f, -0.382683f, -0.653281f }, { 0.875000f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, -0.176777f }, { 0.853553f, -0.382683f, -0.353553f }, { 0.937500f, 0.375000f }},
+    {{ 0.461940f, -0.191342f, -0.000000f }, { 0.923880f, -0.382683f, -0.000000f }, { 1.000000f, 0.375000f }},
+    {{ 0.500000f, 0.000000f, 0.000000f }, { 1.000000f, 0.000000f, 0.000000f }, { 0.000000f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, 0.191342f }, { 0.923880f, 0.000000f, 0.382683f }, { 0.062500f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, 0.353553f }, { 0.707107f, 0.000000f, 0.707107f }, { 0.125000f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, 0.461940f }, { 0.382683f, 0.000000f, 0.923880f }, { 0.187500f, 0.500000f }},
+    {{ 0.000000f, 0.000000f, 0.500000f }, { 0.000000f, 0.000000f, 1.000000f }, { 0.250000f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, 0.461940f }, { -0.382683f, 0.000000f, 0.923880f }, { 0.312500f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, 0.353553f }, { -0.707107f, 0.000000f, 0.707107f }, { 0.375000f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, 0.191342f }, { -0.923880f, 0.000000f, 0.382683f }, { 0.437500f, 0.500000f }},
+    {{ -0.500000f, 0.000000f, 0.000000f }, { -1.000000f, 0.000000f, 0.000000f }, { 0.500000f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, -0.191342f }, { -0.923880f, 0.000000f, -0.382683f }, { 0.562500f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, -0.353553f }, { -0.707107f, 0.000000f, -0.707107f }, { 0.625000f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, -0.461940f }, { -0.382683f, 0.000000f, -0.923880f }, { 0.687500f, 0.500000f }},
+    {{ -0.000000f, 0.000000f, -0.500000f }, { -0.000000f, 0.000000f, -1.000000f }, { 0.750000f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, -0.461940f }, { 0.382683f, 0.000000f, -0.923880f }, { 0.812500f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, -0.353553f }, { 0.707107f, 0.000000f, -0.707107f }, { 0.875000f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, -0.191342f }, { 0.923880f, 0.000000f, -0.382683f }, { 0.937500f, 0.500000f }},
+    {{ 0.500000f, 0.000000f, -0.000000f }, { 1.000000f, 0.000000f, -0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.461940f, 0.191342f, 0.000000f }, { 0.923880f, 0.382683f, 0.000000f }, { 0.000000f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, 0.176777f }, { 0.853553f, 0.382683f, 0.353553f }, { 0.062500f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, 0.326641f }, { 0.653281f, 0.382683f, 0.653281f }, { 0.125000f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, 0.426777f }, { 0.353553f, 0.382683f, 0.853553f }, { 0.187500f, 0.625000f }},
+    {{ 0.000000f, 0.191342f, 0.461940f }, { 0.000000f, 0.382683f, 0.923880f }, { 0.250000f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, 0.426777f }, { -0.353553f, 0.382683f, 0.853553f }, { 0.312500f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, 0.326641f }, { -0.653281f, 0.382683f, 0.653281f }, { 0.375000f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, 0.176777f }, { -0.853553f, 0.382683f, 0.353553f }, { 0.437500f, 0.625000f }},
+    {{ -0.461940f, 0.191342f, 0.000000f }, { -0.923880f, 0.382683f, 0.000000f }, { 0.500000f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, -0.176777f }, { -0.853553f, 0.382683f, -0.353553f }, { 0.562500f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, -0.326641f }, { -0.653281f, 0.382683f, -0.653281f }, { 0.625000f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, -0.426777f }, { -0.353553f, 0.382683f, -0.853553f }, { 0.687500f, 0.625000f }},
+    {{ -0.000000f, 0.191342f, -0.461940f }, { -0.000000f, 0.382683f, -0.923880f }, { 0.750000f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, -0.426777f }, { 0.353553f, 0.382683f, -0.853553f }, { 0.812500f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, -0.326641f }, { 0.653281f, 0.382683f, -0.653281f }, { 0.875000f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, -0.176777f }, { 0.853553f, 0.382683f, -0.353553f }, { 0.937500f, 0.625000f }},
+    {{ 0.461940f, 0.191342f, -0.000000f }, { 0.923880f, 0.382683f, -0.000000f }, { 1.000000f, 0.625000f }},
+    {{ 0.353553f, 0.353553f, 0.000000f }, { 0.707107f, 0.707107f, 0.000000f }, { 0.000000f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, 0.135299f }, { 0.653281f, 0.707107f, 0.270598f }, { 0.062500f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, 0.250000f }, { 0.500000f, 0.707107f, 0.500000f }, { 0.125000f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, 0.326641f }, { 0.270598f, 0.707107f, 0.653281f }, { 0.187500f, 0.750000f }},
+    {{ 0.000000f, 0.353553f, 0.353553f }, { 0.000000f, 0.707107f, 0.707107f }, { 0.250000f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, 0.326641f }, { -0.270598f, 0.707107f, 0.653281f }, { 0.312500f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, 0.250000f }, { -0.500000f, 0.707107f, 0.500000f }, { 0.375000f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, 0.135299f }, { -0.653281f, 0.707107f, 0.270598f }, { 0.437500f, 0.750000f }},
+    {{ -0.353553f, 0.353553f, 0.000000f }, { -0.707107f, 0.707107f, 0.000000f }, { 0.500000f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, -0.135299f }, { -0.653281f, 0.707107f, -0.270598f }, { 0.562500f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, -0.250000f }, { -0.500000f, 0.707107f, -0.500000f }, { 0.625000f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, -0.326641f }, { -0.270598f, 0.707107f, -0.653281f }, { 0.687500f, 0.750000f }},
+    {{ -0.000000f, 0.353553f, -0.353553f }, { -0.000000f, 0.707107f, -0.707107f }, { 0.750000f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, -0.326641f }, { 0.270598f, 0.707107f, -0.653281f }, { 0.812500f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, -0.250000f }, { 0.500000f, 0.707107f, -0.500000f }, { 0.875000f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, -0.135299f }, { 0.653281f, 0.707107f, -0.270598f }, { 0.937500f, 0.750000f }},
+    {{ 0.353553f, 0.353553f, -0.000000f }, { 0.707107f, 0.707107f, -0.000000f }, { 1.000000f, 0.750000f }},
+    {{ 0.191342f, 0.461940f, 0.000000f }, { 0.382683f, 0.923880f, 0.000000f }, { 0.000000f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, 0.073223f }, { 0.353553f, 0.923880f, 0.146447f }, { 0.062500f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, 0.135299f }, { 0.270598f, 0.923880f, 0.270598f }, { 0.125000f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, 0.176777f }, { 0.146447f, 0.923880f, 0.353553f }, { 0.187500f, 0.875000f }},
+    {{ 0.000000f, 0.461940f, 0.191342f }, { 0.000000f, 0.923880f, 0.382683f }, { 0.250000f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, 0.176777f }, { -0.146447f, 0.923880f, 0.353553f }, { 0.312500f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, 0.135299f }, { -0.270598f, 0.923880f, 0.270598f }, { 0.375000f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, 0.073223f }, { -0.353553f, 0.923880f, 0.146447f }, { 0.437500f, 0.875000f }},
+    {{ -0.191342f, 0.461940f, 0.000000f }, { -0.382683f, 0.923880f, 0.000000f }, { 0.500000f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, -0.073223f }, { -0.353553f, 0.923880f, -0.146447f }, { 0.562500f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, -0.135299f }, { -0.270598f, 0.923880f, -0.270598f }, { 0.625000f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, -0.176777f }, { -0.146447f, 0.923880f, -0.353553f }, { 0.687500f, 0.875000f }},
+    {{ -0.000000f, 0.461940f, -0.191342f }, { -0.000000f, 0.923880f, -0.382683f }, { 0.750000f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, -0.176777f }, { 0.146447f, 0.923880f, -0.353553f }, { 0.812500f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, -0.135299f }, { 0.270598f, 0.923880f, -0.270598f }, { 0.875000f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, -0.073223f }, { 0.353553f, 0.923880f, -0.146447f }, { 0.937500f, 0.875000f }},
+    {{ 0.191342f, 0.461940f, -0.000000f }, { 0.382683f, 0.923880f, -0.000000f }, { 1.000000f, 0.875000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.000000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.062500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.125000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.187500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.250000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.312500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.375000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.437500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.562500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.625000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.687500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.750000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.812500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.875000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.937500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 1.000000f, 1.000000f }},
+};
+
+static const UINT kSphereLod2VertexCount = 153;
+
+static const uint32_t kSphereLod2Indices[768] = {
+    0, 18, 1, 0, 17, 18, 1, 19, 2, 1, 18, 19, 
+    2, 20, 3, 2, 19, 20, 3, 21, 4, 3, 20, 21, 
+    4, 22, 5, 4, 21, 22, 5, 23, 6, 5, 22, 23, 
+    6, 24, 7, 6, 23, 24, 7, 25, 8, 7, 24, 25, 
+    8, 26, 9, 8, 25, 26, 9, 27, 10, 9, 26, 27, 
+    10, 28, 11, 10, 27, 28, 11, 29, 12, 11, 28, 29, 
+    12, 30, 13, 12, 29, 30, 13, 31, 14, 13, 30, 31, 
+    14, 32, 15, 14, 31, 32, 15, 33, 16, 15, 32, 33, 
+    17, 35, 18, 17, 34, 35, 18, 36, 19, 18, 35, 36, 
+    19, 37, 20, 19, 36, 37, 20, 38, 21, 20, 37, 38, 
+    21, 39, 22, 21, 38, 39, 22, 40, 23, 22, 39, 40, 
+    23, 41, 24, 23, 40, 41, 24, 42, 25, 24, 41, 42, 
+    25, 43, 26, 25, 42, 43, 26, 44, 27, 26, 43, 44, 
+    27, 45, 28, 27, 44, 45, 28, 46, 29, 28, 45, 46, 
+    29, 47, 30, 29, 46, 47, 30, 48, 31, 30, 47, 48, 
+    31, 49, 32, 31, 48, 49, 32, 50, 33, 32, 49, 50, 
+    34, 52, 35, 34, 51, 52, 35, 53, 36, 35, 52, 53, 
+    36, 54, 37, 36, 53, 54, 37, 55, 38, 37, 54, 55, 
+    38, 56, 39, 38, 55, 56, 39, 57, 40, 39, 56, 57, 
+    40, 58, 41, 40, 57, 58, 41, 59, 42, 41, 58, 59, 
+    42, 60, 43, 42, 59, 60, 43, 61, 44, 43, 60, 61, 
+    44, 62, 45, 44, 61, 62, 45, 63, 46, 45, 62, 63, 
+    46, 64, 47, 46, 63, 64, 47, 65, 48, 47, 64, 65, 
+    48, 66, 49, 48, 65, 66, 49, 67, 50, 49, 66, 67, 
+    51, 69, 52, 51, 68, 69, 52, 70, 53, 52, 69, 70, 
+    53, 71, 54, 53, 70, 71, 54, 72, 55, 54, 71, 72, 
+    55, 73, 56, 55, 72, 73, 56, 74, 57, 56, 73, 74, 
+    57, 75, 58, 57, 74, 75, 58, 76, 59, 58, 75, 76, 
+    59, 77, 60, 59, 76, 77, 60, 78, 61, 60, 77, 78, 
+    61, 79, 62, 61, 78, 79, 62, 80, 63, 62, 79, 80, 
+    63, 81, 64, 63, 80, 81, 64, 82, 65, 64, 81, 82, 
+    65, 83, 66, 65, 82, 83, 66, 84, 67, 66, 83, 84, 
+    68, 86, 69, 68, 85, 86, 69, 87, 70, 69, 86, 87, 
+    70, 88, 71, 70, 87, 88, 71, 89, 72, 71, 88, 89, 
+    72, 90, 73, 72, 89, 90, 73, 91, 74, 73, 90, 91, 
+    74, 92, 75, 74, 91, 92, 75, 93, 76, 75, 92, 93, 
+    76, 94, 77, 76, 93, 94, 77, 95, 78, 77, 94, 95, 
+    78, 96, 79, 78, 95, 96, 79, 97, 80, 79, 96, 97, 
+    80, 98, 81, 80, 97, 98, 81, 99, 82, 81, 98, 99, 
+    82, 100, 83, 82, 99, 100, 83, 101, 84, 83, 100, 101, 
+    85, 103, 86, 85, 102, 103, 86, 104, 87, 86, 103, 104, 
+    87, 105, 88, 87, 104, 105, 88, 106, 89, 88, 105, 106, 
+    89, 107, 90, 89, 106, 107, 90, 108, 91, 90, 107, 108, 
+    91, 109, 92, 91, 108, 109, 92, 110, 93, 92, 109, 110, 
+    93, 111, 94, 93, 110, 111, 94, 112, 95, 94, 111, 112, 
+    95, 113, 96, 95, 112, 113, 96, 114, 97, 96, 113, 114, 
+    97, 115, 98, 97, 114, 115, 98, 116, 99, 98, 115, 116, 
+    99, 117, 100, 99, 116, 117, 100, 118, 101, 100, 117, 118, 
+    102, 120, 103, 102, 119, 120, 103, 121, 104, 103, 120, 121, 
+    104, 122, 105, 104, 121, 122, 105, 123, 106, 105, 122, 123, 
+    106, 124, 107, 106, 123, 124, 107, 125, 108, 107, 124, 125, 
+    108, 126, 109, 108, 125, 126, 109, 127, 110, 109, 126, 127, 
+    110, 128, 111, 110, 127, 128, 111, 129, 112, 111, 128, 129, 
+    112, 130, 113, 112, 129, 130, 113, 131, 114, 113, 130, 131, 
+    114, 132, 115, 114, 131, 132, 115, 133, 116, 115, 132, 133, 
+    116, 134, 117, 116, 133, 134, 117, 135, 118, 117, 134, 135, 
+    119, 137, 120, 119, 136, 137, 120, 138, 121, 120, 137, 138, 
+    121, 139, 122, 121, 138, 139, 122, 140, 123, 122, 139, 140, 
+    123, 141, 124, 123, 140, 141, 124, 142, 125, 124, 141, 142, 
+    125, 143, 126, 125, 142, 143, 126, 144, 127, 126, 143, 144, 
+    127, 145, 128, 127, 144, 145, 128, 146, 129, 128, 145, 146, 
+    129, 147, 130, 129, 146, 147, 130, 148, 131, 130, 147, 148, 
+    131, 149, 132, 131, 148, 149, 132, 150, 133, 132, 149, 150, 
+    133, 151, 134, 133, 150, 151, 134, 152, 135, 134, 151, 152, 
+};
+
+static const UINT kSphereLod2IndexCount = 768;
+
+static const Vertex kInvertedSphereLod1Vertices[561] = {
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.000000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.031250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.062500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.093750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.125000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.156250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.187500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.218750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.250000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.281250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.312500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.343750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.375000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.406250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.437500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.468750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.500000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.531250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.562500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.593750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.625000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.656250f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.687500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.718750f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.750000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.781250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.812500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.843750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.875000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.906250f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.937500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.968750f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 1.000000f, 0.000000f }},
+    {{ 0.097545f, -0.490393f, 0.000000f }, { -0.195090f, 0.980785f, -0.000000f }, { 0.000000f, 0.062500f }},
+    {{ 0.095671f, -0.490393f, 0.019030f }, { -0.191342f, 0.980785f, -0.038060f }, { 0.031250f, 0.062500f }},
+    {{ 0.090120f, -0.490393f, 0.037329f }, { -0.180240f, 0.980785f, -0.074658f }, { 0.062500f, 0.062500f }},
+    {{ 0.081106f, -0.490393f, 0.054193f }, { -0.162212f, 0.980785f, -0.108386f }, { 0.093750f, 0.062500f }},
+    {{ 0.068975f, -0.490393f, 0.068975f }, { -0.137950f, 0.980785f, -0.137950f }, { 0.125000f, 0.062500f }},
+    {{ 0.054193f, -0.490393f, 0.081106f }, { -0.108386f, 0.980785f, -0.162212f }, { 0.156250f, 0.062500f }},
+    {{ 0.037329f, -0.490393f, 0.090120f }, { -0.074658f, 0.980785f, -0.180240f }, { 0.187500f, 0.062500f }},
+    {{ 0.019030f, -0.490393f, 0.095671f }, { -0.038060f, 0.980785f, -0.191342f }, { 0.218750f, 0.062500f }},
+    {{ 0.000000f, -0.490393f, 0.097545f }, { -0.000000f, 0.980785f, -0.195090f }, { 0.250000f, 0.062500f }},
+    {{ -0.019030f, -0.490393f, 0.095671f }, { 0.038060f, 0.980785f, -0.191342f }, { 0.281250f, 0.062500f }},
+    {{ -0.037329f, -0.490393f, 0.090120f }, { 0.074658f, 0.980785f, -0.180240f }, { 0.312500f, 0.062500f }},
+    {{ -0.054193f, -0.490393f, 0.081106f }, { 0.108386f, 0.980785f, -0.162212f }, { 0.343750f, 0.062500f }},
+    {{ -0.068975f, -0.490393f, 0.068975f }, { 0.137950f, 0.980785f, -0.137950f }, { 0.375000f, 0.062500f }},
+    {{ -0.081106f, -0.490393f, 0.054193f }, { 0.162212f, 0.980785f, -0.108386f }, { 0.406250f, 0.062500f }},
+    {{ -0.090120f, -0.490393f, 0.037329f }, { 0.180240f, 0.980785f, -0.074658f }, { 0.437500f, 0.062500f }},
+    {{ -0.095671f, -0.490393f, 0.019030f }, { 0.191342f, 0.980785f, -0.038060f }, { 0.468750f, 0.062500f }},
+    {{ -0.097545f, -0.490393f, 0.000000f }, { 0.195090f, 0.980785f, -0.000000f }, { 0.500000f, 0.062500f }},
+    {{ -0.095671f, -0.490393f, -0.019030f }, { 0.191342f, 0.980785f, 0.038060f }, { 0.531250f, 0.062500f }},
+    {{ -0.090120f, -0.490393f, -0.037329f }, { 0.180240f, 0.980785f, 0.074658f }, { 0.562500f, 0.062500f }},
+    {{ -0.081106f, -0.490393f, -0.054193f }, { 0.162212f, 0.980785f, 0.108386f }, { 0.593750f, 0.062500f }},
+    {{ -0.068975f, -0.490393f, -0.068975f }, { 0.137950f, 0.980785f, 0.137950f }, { 0.625000f, 0.062500f }},
+    {{ -0.054193f, -0.490393f, -0.081106f }, { 0.108386f, 0.980785f, 0.162212f }, { 0.656250f, 0.062500f }},
+    {{ -0.037329f, -0.490393f, -0.090120f }, { 0.074658f, 0.980785f, 0.180240f }, { 0.687500f, 0.062500f }},
+    {{ -0.019030f, -0.490393f, -0.095671f }, { 0.038060f, 0.980785f, 0.191342f }, { 0.718750f, 0.062500f }},
+    {{ -0.000000f, -0.490393f, -0.097545f }, { 0.000000f, 0.980785f, 0.195090f }, { 0.750000f, 0.062500f }},
+    {{ 0.019030f, -0.490393f, -0.095671f }, { -0.038060f, 0.980785f, 0.191342f }, { 0.781250f, 0.062500f }},
+    {{ 0.037329f, -0.490393f, -0.090120f }, { -0.074658f, 0.980785f, 0.180240f }, { 0.812500f, 0.062500f }},
+    {{ 0.054193f, -0.490393f, -0.081106f }, { -0.108386f, 0.980785f, 0.162212f }, { 0.843750f, 0.062500f }},
+    {{ 0.068975f, -0.490393f, -0.068975f }, { -0.137950f, 0.980785f, 0.137950f }, { 0.875000f, 0.062500f }},
+    {{ 0.081106f, -0.490393f, -0.054193f }, { -0.162212f, 0.980785f, 0.108386f }, { 0.906250f, 0.062500f }},
+    {{ 0.090120f, -0.490393f, -0.037329f }, { -0.180240f, 0.980785f, 0.074658f }, { 0.937500f, 0.062500f }},
+    {{ 0.095671f, -0.490393f, -0.019030f }, { -0.191342f, 0.980785f, 0.038060f }, { 0.968750f, 0.062500f }},
+    {{ 0.097545f, -0.490393f, -0.000000f }, { -0.195090f, 0.980785f, 0.000000f }, { 1.000000f, 0.062500f }},
+    {{ 0.191342f, -0.461940f, 0.000000f }, { -0.382683f, 0.923880f, -0.000000f }, { 0.000000f, 0.125000f }},
+    {{ 0.187665f, -0.461940f, 0.037329f }, { -0.375330f, 0.923880f, -0.074658f }, { 0.031250f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, 0.073223f }, { -0.353553f, 0.923880f, -0.146447f }, { 0.062500f, 0.125000f }},
+    {{ 0.159095f, -0.461940f, 0.106304f }, { -0.318190f, 0.923880f, -0.212608f }, { 0.093750f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, 0.135299f }, { -0.270598f, 0.923880f, -0.270598f }, { 0.125000f, 0.125000f }},
+    {{ 0.106304f, -0.461940f, 0.159095f }, { -0.212608f, 0.923880f, -0.318190f }, { 0.156250f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, 0.176777f }, { -0.146447f, 0.923880f, -0.353553f }, { 0.187500f, 0.125000f }},
+    {{ 0.037329f, -0.461940f, 0.187665f }, { -0.074658f, 0.923880f, -0.375330f }, { 0.218750f, 0.125000f }},
+    {{ 0.000000f, -0.461940f, 0.191342f }, { -0.000000f, 0.923880f, -0.382683f }, { 0.250000f, 0.125000f }},
+    {{ -0.037329f, -0.461940f, 0.187665f }, { 0.074658f, 0.923880f, -0.375330f }, { 0.281250f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, 0.176777f }, { 0.146447f, 0.923880f, -0.353553f }, { 0.312500f, 0.125000f }},
+    {{ -0.106304f, -0.461940f, 0.159095f }, { 0.212608f, 0.923880f, -0.318190f }, { 0.343750f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, 0.135299f }, { 0.270598f, 0.923880f, -0.270598f }, { 0.375000f, 0.125000f }},
+    {{ -0.159095f, -0.461940f, 0.106304f }, { 0.318190f, 0.923880f, -0.212608f }, { 0.406250f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, 0.073223f }, { 0.353553f, 0.923880f, -0.146447f }, { 0.437500f, 0.125000f }},
+    {{ -0.187665f, -0.461940f, 0.037329f }, { 0.375330f, 0.923880f, -0.074658f }, { 0.468750f, 0.125000f }},
+    {{ -0.191342f, -0.461940f, 0.000000f }, { 0.382683f, 0.923880f, -0.000000f }, { 0.500000f, 0.125000f }},
+    {{ -0.187665f, -0.461940f, -0.037329f }, { 0.375330f, 0.923880f, 0.074658f }, { 0.531250f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, -0.073223f }, { 0.353553f, 0.923880f, 0.146447f }, { 0.562500f, 0.125000f }},
+    {{ -0.159095f, -0.461940f, -0.106304f }, { 0.318190f, 0.923880f, 0.212608f }, { 0.593750f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, -0.135299f }, { 0.270598f, 0.923880f, 0.270598f }, { 0.625000f, 0.125000f }},
+    {{ -0.106304f, -0.461940f, -0.159095f }, { 0.212608f, 0.923880f, 0.318190f }, { 0.656250f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, -0.176777f }, { 0.146447f, 0.923880f, 0.353553f }, { 0.687500f, 0.125000f }},
+    {{ -0.037329f, -0.461940f, -0.187665f }, { 0.074658f, 0.923880f, 0.375330f }, { 0.718750f, 0.125000f }},
+    {{ -0.000000f, -0.461940f, -0.191342f }, { 0.000000f, 0.923880f, 0.382683f }, { 0.750000f, 0.125000f }},
+    {{ 0.037329f, -0.461940f, -0.187665f }, { -0.074658f, 0.923880f, 0.375330f }, { 0.781250f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, -0.176777f }, { -0.146447f, 0.923880f, 0.353553f }, { 0.812500f, 0.125000f }},
+    {{ 0.106304f, -0.461940f, -0.159095f }, { -0.212608f, 0.923880f, 0.318190f }, { 0.843750f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, -0.135299f }, { -0.270598f, 0.923880f, 0.270598f }, { 0.875000f, 0.125000f }},
+    {{ 0.159095f, -0.461940f, -0.106304f }, { -0.318190f, 0.923880f, 0.212608f }, { 0.906250f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, -0.073223f }, { -0.353553f, 0.923880f, 0.146447f }, { 0.937500f, 0.125000f }},
+    {{ 0.187665f, -0.461940f, -0.037329f }, { -0.375330f, 0.923880f, 0.074658f }, { 0.968750f, 0.125000f }},
+    {{ 0.191342f, -0.461940f, -0.000000f }, { -0.382683f, 0.923880f, 0.000000f }, { 1.000000f, 0.125000f }},
+    {{ 0.277785f, -0.415735f, 0.000000f }, { -0.555570f, 0.831470f, -0.000000f }, { 0.000000f, 0.187500f }},
+    {{ 0.272448f, -0.415735f, 0.054193f }, { -0.544895f, 0.831470f, -0.108386f }, { 0.031250f, 0.187500f }},
+    {{ 0.256640f, -0.415735f, 0.106304f }, { -0.513280f, 0.831470f, -0.212608f }, { 0.062500f, 0.187500f }},
+    {{ 0.230970f, -0.415735f, 0.154329f }, { -0.461940f, 0.831470f, -0.308658f }, { 0.093750f, 0.187500f }},
+    {{ 0.196424f, -0.415735f, 0.196424f }, { -0.392847f, 0.831470f, -0.392847f }, { 0.125000f, 0.187500f }},
+    {{ 0.154329f, -0.415735f, 0.230970f }, { -0.308658f, 0.831470f, -0.461940f }, { 0.156250f, 0.187500f }},
+    {{ 0.106304f, -0.415735f, 0.256640f }, { -0.212608f, 0.831470f, -0.513280f }, { 0.187500f, 0.187500f }},
+    {{ 0.054193f, -0.415735f, 0.272448f }, { -0.108386f, 0.831470f, -0.544895f }, { 0.218750f, 0.187500f }},
+    {{ 0.000000f, -0.415735f, 0.277785f }, { -0.000000f, 0.831470f, -0.555570f }, { 0.250000f, 0.187500f }},
+    {{ -0.054193f, -0.415735f, 0.272448f }, { 0.108386f, 0.831470f, -0.544895f }, { 0.281250f, 0.187500f }},
+    {{ -0.106304f, -0.415735f, 0.256640f }, { 0.212608f, 0.831470f, -0.513280f }, { 0.312500f, 0.187500f }},
+    {{ -0.154329f, -0.415735f, 0.230970f }, { 0.308658f, 0.831470f, -0.461940f }, { 0.343750f, 0.187500f }},
+    {{ -0.196424f, -0.415735f, 0.196424f }, { 0.392847f, 0.831470f, -0.392847f }, { 0.375000f, 0.187500f }},
+    {{ -0.230970f, -0.415735f, 0.154329f }, { 0.461940f, 0.831470f, -0.308658f }, { 0.406250f, 0.187500f }},
+    {{ -0.256640f, -0.415735f, 0.106304f }, { 0.513280f, 0.831470f, -0.212608f }, { 0.437500f, 0.187500f }},
+    {{ -0.272448f, -0.415735f, 0.054193f }, { 0.544895f, 0.831470f, -0.108386f }, { 0.468750f, 0.187500f }},
+    {{ -0.277785f, -0.415735f, 0.000000f }, { 0.555570f, 0.831470f, -0.000000f }, { 0.500000f, 0.187500f }},
+    {{ -0.272448f, -0.415735f, -0.054193f }, { 0.544895f, 0.831470f, 0.108386f }, { 0.531250f, 0.187500f }},
+    {{ -0.256640f, -0.415735f, -0.106304f }, { 0.513280f, 0.831470f, 0.212608f }, { 0.562500f, 0.187500f }},
+    {{ -0.230970f, -0.415735f, -0.154329f }, { 0.461940f, 0.831470f, 0.308658f }, { 0.593750f, 0.187500f }},
+    {{ -0.196424f, -0.415735f, -0.196424f }, { 0.392847f, 0.831470f, 0.392847f }, { 0.625000f, 0.187500f }},
+    {{ -0.154329f, -0.415735f, -0.230970f }, { 0.308658f, 0.831470f, 0.461940f }, { 0.656250f, 0.187500f }},
+    {{ -0.106304f, -0.415735f, -0.256640f }, { 0.212608f, 0.831470f, 0.513280f }, { 0.687500f, 0.187500f }},
+    {{ -0.054193f, -0.415735f, -0.272448f }, { 0.108386f, 0.831470f, 0.544895f }, { 0.718750f, 0.187500f }},
+    {{ -0.000000f, -0.415735f, -0.277785f }, { 0.000000f, 0.831470f, 0.555570f }, { 0.750000f, 0.187500f }},
+    {{ 0.054193f, -0.415735f, -0.272448f }, { -0.108386f, 0.831470f, 0.544895f }, { 0.781250f, 0.187500f }},
+    {{ 0.106304f, -0.415735f, -0.256640f }, { -0.212608f, 0.831470f, 0.513280f }, { 0.812500f, 0.187500f }},
+    {{ 0.154329f, -0.415735f, -0.230970f }, { -0.308658f, 0.831470f, 0.461940f }, { 0.843750f, 0.187500f }},
+    {{ 0.196424f, -0.415735f, -0.196424f }, { -0.392847f, 0.831470f, 0.392847f }, { 0.875000f, 0.187500f }},
+    {{ 0.230970f, -0.415735f, -0.154329f }, { -0.461940f, 0.831470f, 0.308658f }, { 0.906250f, 0.187500f }},
+    {{ 0.256640f, -0.415735f, -0.106304f }, { -0.513280f, 0.831470f, 0.212608f }, { 0.937500f, 0.187500f }},
+    {{ 0.272448f, -0.415735f, -0.054193f }, { -0.544895f, 0.831470f, 0.108386f }, { 0.968750f, 0.187500f }},
+    {{ 0.277785f, -0.415735f, -0.000000f }, { -0.555570f, 0.831470f, 0.000000f }, { 1.000000f, 0.187500f }},
+    {{ 0.353553f, -0.353553f, 0.000000f }, { -0.707107f, 0.707107f, -0.000000f }, { 0.000000f, 0.250000f }},
+    {{ 0.346760f, -0.353553f, 0.068975f }, { -0.693520f, 0.707107f, -0.137950f }, { 0.031250f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, 0.135299f }, { -0.653281f, 0.707107f, -0.270598f }, { 0.062500f, 0.250000f }},
+    {{ 0.293969f, -0.353553f, 0.196424f }, { -0.587938f, 0.707107f, -0.392847f }, { 0.093750f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, 0.250000f }, { -0.500000f, 0.707107f, -0.500000f }, { 0.125000f, 0.250000f }},
+    {{ 0.196424f, -0.353553f, 0.293969f }, { -0.392847f, 0.707107f, -0.587938f }, { 0.156250f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, 0.326641f }, { -0.270598f, 0.707107f, -0.653281f }, { 0.187500f, 0.250000f }},
+    {{ 0.068975f, -0.353553f, 0.346760f }, { -0.137950f, 0.707107f, -0.693520f }, { 0.218750f, 0.250000f }},
+    {{ 0.000000f, -0.353553f, 0.353553f }, { -0.000000f, 0.707107f, -0.707107f }, { 0.250000f, 0.250000f }},
+    {{ -0.068975f, -0.353553f, 0.346760f }, { 0.137950f, 0.707107f, -0.693520f }, { 0.281250f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, 0.326641f }, { 0.270598f, 0.707107f, -0.653281f }, { 0.312500f, 0.250000f }},
+    {{ -0.196424f, -0.353553f, 0.293969f }, { 0.392847f, 0.707107f, -0.587938f }, { 0.343750f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, 0.250000f }, { 0.500000f, 0.707107f, -0.500000f }, { 0.375000f, 0.250000f }},
+    {{ -0.293969f, -0.353553f, 0.196424f }, { 0.587938f, 0.707107f, -0.392847f }, { 0.406250f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, 0.135299f }, { 0.653281f, 0.707107f, -0.270598f }, { 0.437500f, 0.250000f }},
+    {{ -0.346760f, -0.353553f, 0.068975f }, { 0.693520f, 0.707107f, -0.137950f }, { 0.468750f, 0.250000f }},
+    {{ -0.353553f, -0.353553f, 0.000000f }, { 0.707107f, 0.707107f, -0.000000f }, { 0.500000f, 0.250000f }},
+    {{ -0.346760f, -0.353553f, -0.068975f }, { 0.693520f, 0.707107f, 0.137950f }, { 0.531250f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, -0.135299f }, { 0.653281f, 0.707107f, 0.270598f }, { 0.562500f, 0.250000f }},
+    {{ -0.293969f, -0.353553f, -0.196424f }, { 0.587938f, 0.707107f, 0.392847f }, { 0.593750f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, -0.250000f }, { 0.500000f, 0.707107f, 0.500000f }, { 0.625000f, 0.250000f }},
+    {{ -0.196424f, -0.353553f, -0.293969f }, { 0.392847f, 0.707107f, 0.587938f }, { 0.656250f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, -0.326641f }, { 0.270598f, 0.707107f, 0.653281f }, { 0.687500f, 0.250000f }},
+    {{ -0.068975f, -0.353553f, -0.346760f }, { 0.137950f, 0.707107f, 0.693520f }, { 0.718750f, 0.250000f }},
+    {{ -0.000000f, -0.353553f, -0.353553f }, { 0.000000f, 0.707107f, 0.707107f }, { 0.750000f, 0.250000f }},
+    {{ 0.068975f, -0.353553f, -0.346760f }, { -0.137950f, 0.707107f, 0.693520f }, { 0.781250f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, -0.326641f }, { -0.270598f, 0.707107f, 0.653281f }, { 0.812500f, 0.250000f }},
+    {{ 0.196424f, -0.353553f, -0.293969f }, { -0.392847f, 0.707107f, 0.587938f }, { 0.843750f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, -0.250000f }, { -0.500000f, 0.707107f, 0.500000f }, { 0.875000f, 0.250000f }},
+    {{ 0.293969f, -0.353553f, -0.196424f }, { -0.587938f, 0.707107f, 0.392847f }, { 0.906250f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, -0.135299f }, { -0.653281f, 0.707107f, 0.270598f }, { 0.937500f, 0.250000f }},
+    {{ 0.346760f, -0.353553f, -0.068975f }, { -0.693520f, 0.707107f, 0.137950f }, { 0.968750f, 0.250000f }},
+    {{ 0.353553f, -0.353553f, -0.000000f }, { -0.707107f, 0.707107f, 0.000000f }, { 1.000000f, 0.250000f }},
+    {{ 0.415735f, -0.277785f, 0.000000f }, { -0.831470f, 0.555570f, -0.000000f }, { 0.000000f, 0.312500f }},
+    {{ 0.407747f, -0.277785f, 0.081106f }, { -0.815493f, 0.555570f, -0.162212f }, { 0.031250f, 0.312500f }},
+    {{ 0.384089f, -0.277785f, 0.159095f }, { -0.768178f, 0.555570f, -0.318190f }, { 0.062500f, 0.312500f }},
+    {{ 0.345671f, -0.277785f, 0.230970f }, { -0.691342f, 0.555570f, -0.461940f }, { 0.093750f, 0.312500f }},
+    {{ 0.293969f, -0.277785f, 0.293969f }, { -0.587938f, 0.555570f, -0.587938f }, { 0.125000f, 0.312500f }},
+    {{ 0.230970f, -0.277785f, 0.345671f }, { -0.461940f, 0.555570f, -0.691342f }, { 0.156250f, 0.312500f }},
+    {{ 0.159095f, -0.277785f, 0.384089f }, { -0.318190f, 0.555570f, -0.768178f }, { 0.187500f, 0.312500f }},
+    {{ 0.081106f, -0.277785f, 0.407747f }, { -0.162212f, 0.555570f, -0.815493f }, { 0.218750f, 0.312500f }},
+    {{ 0.000000f, -0.277785f, 0.415735f }, { -0.000000f, 0.555570f, -0.831470f }, { 0.250000f, 0.312500f }},
+    {{ -0.081106f, -0.277785f, 0.407747f }, { 0.162212f, 0.555570f, -0.815493f }, { 0.281250f, 0.312500f }},
+    {{ -0.159095f, -0.277785f, 0.384089f }, { 0.318190f, 0.555570f, -0.768178f }, { 0.312500f, 0.312500f }},
+    {{ -0.230970f, -0.277785f, 0.345671f }, { 0.461940f, 0.555570f, -0.691342f }, { 0.343750f, 0.312500f }},
+    {{ -0.293969f, -0.277785f, 0.293969f }, { 0.587938f, 0.555570f, -0.587938f }, { 0.375000f, 0.312500f }},
+    {{ -0.345671f, -0.277785f, 0.230970f }, { 0.691342f, 0.555570f, -0.461940f }, { 0.406250f, 0.312500f }},
+    {{ -0.384089f, -0.277785f, 0.159095f }, { 0.768178f, 0.555570f, -0.318190f }, { 0.437500f, 0.312500f }},
+    {{ -0.407747f, -0.277785f, 0.081106f }, { 0.815493f, 0.555570f, -0.162212f }, { 0.468750f, 0.312500f }},
+    {{ -0.415735f, -0.277785f, 0.000000f }, { 0.831470f, 0.555570f, -0.000000f }, { 0.500000f, 0.312500f }},
+    {{ -0.407747f, -0.277785f, -0.081106f }, { 0.815493f, 0.555570f, 0.162212f }, { 0.531250f, 0.312500f }},
+    {{ -0.384089f, -0.277785f, -0.159095f }, { 0.768178f, 0.555570f, 0.318190f }, { 0.562500f, 0.312500f }},
+    {{ -0.345671f, -0.277785f, -0.230970f }, { 0.691342f, 0.555570f, 0.461940f }, { 0.593750f, 0.312500f }},
+    {{ -0.293969f, -0.277785f, -0.293969f }, { 0.587938f, 0.555570f, 0.587938f }, { 0.625000f, 0.312500f }},
+    {{ -0.230970f, -0.277785f, -0.345671f }, { 0.461940f, 0.555570f, 0.691342f }, { 0.656250f, 0.312500f }},
+    {{ -0.159095f, -0.277785f, -0.384089f }, { 0.318190f, 0.555570f, 0.768178f }, { 0.687500f, 0.312500f }},
+    {{ -0.081106f, -0.277785f, -0.407747f }, { 0.162212f, 0.555570f, 0.815493f }, { 0.718750f, 0.312500f }},
+    {{ -0.000000f, -0.277785f, -0.415735f }, { 0.000000f, 0.555570f, 0.831470f }, { 0.750000f, 0.312500f }},
+    {{ 0.081106f, -0.277785f, -0.407747f }, { -0.162212f, 0.555570f, 0.815493f }, { 0.781250f, 0.312500f }},
+    {{ 0.159095f, -0.277785f, -0.384089f }, { -0.318190f, 0.555570f, 0.768178f }, { 0.812500f, 0.312500f }},
+    {{ 0.230970f, -0.277785f, -0.345671f }, { -0.461940f, 0.555570f, 0.691342f }, { 0.843750f, 0.312500f }},
+    {{ 0.293969f, -0.277785f, -0.293969f }, { -0.587938f, 0.555570f, 0.587938f }, { 0.875000f, 0.312500f }},
+    {{ 0.345671f, -0.277785f, -0.230970f }, { -0.691342f, 0.555570f, 0.461940f }, { 0.906250f, 0.312500f }},
+    {{ 0.384089f, -0.277785f, -0.159095f }, { -0.768178f, 0.555570f, 0.318190f }, { 0.937500f, 0.312500f }},
+    {{ 0.407747f, -0.277785f, -0.081106f }, { -0.815493f, 0.555570f, 0.162212f }, { 0.968750f, 0.312500f }},
+    {{ 0.415735f, -0.277785f, -0.000000f }, { -0.831470f, 0.555570f, 0.000000f }, { 1.000000f, 0.312500f }},
+    {{ 0.461940f, -0.191342f, 0.000000f }, { -0.923880f, 0.382683f, -0.000000f }, { 0.000000f, 0.375000f }},
+    {{ 0.453064f, -0.191342f, 0.090120f }, { -0.906127f, 0.382683f, -0.180240f }, { 0.031250f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, 0.176777f }, { -0.853553f, 0.382683f, -0.353553f }, { 0.062500f, 0.375000f }},
+    {{ 0.384089f, -0.191342f, 0.256640f }, { -0.768178f, 0.382683f, -0.513280f }, { 0.093750f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, 0.326641f }, { -0.653281f, 0.382683f, -0.653281f }, { 0.125000f, 0.375000f }},
+    {{ 0.256640f, -0.191342f, 0.384089f }, { -0.513280f, 0.382683f, -0.768178f }, { 0.156250f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, 0.426777f }, { -0.353553f, 0.382683f, -0.853553f }, { 0.187500f, 0.375000f }},
+    {{ 0.090120f, -0.191342f, 0.453064f }, { -0.180240f, 0.382683f, -0.906127f }, { 0.218750f, 0.375000f }},
+    {{ 0.000000f, -0.191342f, 0.461940f }, { -0.000000f, 0.382683f, -0.923880f }, { 0.250000f, 0.375000f }},
+    {{ -0.090120f, -0.191342f, 0.453064f }, { 0.180240f, 0.382683f, -0.906127f }, { 0.281250f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, 0.426777f }, { 0.353553f, 0.382683f, -0.853553f }, { 0.312500f, 0.375000f }},
+    {{ -0.256640f, -0.191342f, 0.384089f }, { 0.513280f, 0.382683f, -0.768178f }, { 0.343750f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, 0.326641f }, { 0.653281f, 0.382683f, -0.653281f }, { 0.375000f, 0.375000f }},
+    {{ -0.384089f, -0.191342f, 0.256640f }, { 0.768178f, 0.382683f, -0.513280f }, { 0.406250f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, 0.176777f }, { 0.853553f, 0.382683f, -0.353553f }, { 0.437500f, 0.375000f }},
+    {{ -0.453064f, -0.191342f, 0.090120f }, { 0.906127f, 0.382683f, -0.180240f }, { 0.468750f, 0.375000f }},
+    {{ -0.461940f, -0.191342f, 0.000000f }, { 0.923880f, 0.382683f, -0.000000f }, { 0.500000f, 0.375000f }},
+    {{ -0.453064f, -0.191342f, -0.090120f }, { 0.906127f, 0.382683f, 0.180240f }, { 0.531250f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, -0.176777f }, { 0.853553f, 0.382683f, 0.353553f }, { 0.562500f, 0.375000f }},
+    {{ -0.384089f, -0.191342f, -0.256640f }, { 0.768178f, 0.382683f, 0.513280f }, { 0.593750f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, -0.326641f }, { 0.653281f, 0.382683f, 0.653281f }, { 0.625000f, 0.375000f }},
+    {{ -0.256640f, -0.191342f, -0.384089f }, { 0.513280f, 0.382683f, 0.768178f }, { 0.656250f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, -0.426777f }, { 0.353553f, 0.382683f, 0.853553f }, { 0.687500f, 0.375000f }},
+    {{ -0.090120f, -0.191342f, -0.453064f }, { 0.180240f, 0.382683f, 0.906127f }, { 0.718750f, 0.375000f }},
+    {{ -0.000000f, -0.191342f, -0.461940f }, { 0.000000f, 0.382683f, 0.923880f }, { 0.750000f, 0.375000f }},
+    {{ 0.090120f, -0.191342f, -0.453064f }, { -0.180240f, 0.382683f, 0.906127f }, { 0.781250f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, -0.426777f }, { -0.353553f, 0.382683f, 0.853553f }, { 0.812500f, 0.375000f }},
+    {{ 0.256640f, -0.191342f, -0.384089f }, { -0.513280f, 0.382683f, 0.768178f }, { 0.843750f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, -0.326641f }, { -0.653281f, 0.382683f, 0.653281f }, { 0.875000f, 0.375000f }},
+    {{ 0.384089f, -0.191342f, -0.256640f }, { -0.768178f, 0.382683f, 0.513280f }, { 0.906250f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, -0.176777f }, { -0.853553f, 0.382683f, 0.353553f }, { 0.937500f, 0.375000f }},
+    {{ 0.453064f, -0.191342f, -0.090120f }, { -0.906127f, 0.382683f, 0.180240f }, { 0.968750f, 0.375000f }},
+    {{ 0.461940f, -0.191342f, -0.000000f }, { -0.923880f, 0.382683f, 0.000000f }, { 1.000000f, 0.375000f }},
+    {{ 0.490393f, -0.097545f, 0.000000f }, { -0.980785f, 0.195090f, -0.000000f }, { 0.000000f, 0.437500f }},
+    {{ 0.480970f, -0.097545f, 0.095671f }, { -0.961940f, 0.195090f, -0.191342f }, { 0.031250f, 0.437500f }},
+    {{ 0.453064f, -0.097545f, 0.187665f }, { -0.906127f, 0.195090f, -0.375330f }, { 0.062500f, 0.437500f }},
+    {{ 0.407747f, -0.097545f, 0.272448f }, { -0.815493f, 0.195090f, -0.544895f }, { 0.093750f, 0.437500f }},
+    {{ 0.346760f, -0.097545f, 0.346760f }, { -0.693520f, 0.195090f, -0.693520f }, { 0.125000f, 0.437500f }},
+    {{ 0.272448f, -0.097545f, 0.407747f }, { -0.544895f, 0.195090f, -0.815493f }, { 0.156250f, 0.437500f }},
+    {{ 0.187665f, -0.097545f, 0.453064f }, { -0.375330f, 0.195090f, -0.906127f }, { 0.187500f, 0.437500f }},
+    {{ 0.095671f, -0.097545f, 0.480970f }, { -0.191342f, 0.195090f, -0.961940f }, { 0.218750f, 0.437500f }},
+    {{ 0.000000f, -0.097545f, 0.490393f }, { -0.000000f, 0.195090f, -0.980785f }, { 0.250000f, 0.437500f }},
+    {{ -0.095671f, -0.097545f, 0.480970f }, { 0.191342f, 0.195090f, -0.961940f }, { 0.281250f, 0.437500f }},
+    {{ -0.187665f, -0.097545f, 0.453064f }, { 0.375330f, 0.195090f, -0.906127f }, { 0.312500f, 0.437500f }},
+    {{ -0.272448f, -0.097545f, 0.407747f }, { 0.544895f, 0.195090f, -0.815493f }, { 0.343750f, 0.437500f }},
+    {{ -0.346760f, -0.097545f, 0.346760f }, { 0.693520f, 0.195090f, -0.693520f }, { 0.375000f, 0.437500f }},
+    {{ -0.407747f, -0.097545f, 0.272448f }, { 0.815493f, 0.195090f, -0.544895f }, { 0.406250f, 0.437500f }},
+    {{ -0.453064f, -0.097545f, 0.187665f }, { 0.906127f, 0.195090f, -0.375330f }, { 0.437500f, 0.437500f }},
+    {{ -0.480970f, -0.097545f, 0.095671f }, { 0.961940f, 0.195090f, -0.191342f }, { 0.468750f, 0.437500f }},
+    {{ -0.490393f, -0.097545f, 0.000000f }, { 0.980785f, 0.195090f, -0.000000f }, { 0.500000f, 0.437500f }},
+    {{ -0.480970f, -0.097545f, -0.095671f }, { 0.961940f, 0.195090f, 0.191342f }, { 0.531250f, 0.437500f }},
+    {{ -0.453064f, -0.097545f, -0.187665f }, { 0.906127f, 0.195090f, 0.375330f }, { 0.562500f, 0.437500f }},
+    {{ -0.407747f, -0.097545f, -0.272448f }, { 0.815493f, 0.195090f, 0.544895f }, { 0.593750f, 0.437500f }},
+    {{ -0.346760f, -0.097545f, -0.346760f }, { 0.693520f, 0.195090f, 0.693520f }, { 0.625000f, 0.437500f }},
+    {{ -0.272448f, -0.097545f, -0.407747f }, { 0.544895f, 0.195090f, 0.815493f }, { 0.656250f, 0.437500f }},
+    {{ -0.187665f, -0.097545f, -0.453064f }, { 0.375330f, 0.195090f, 0.906127f }, { 0.687500f, 0.437500f }},
+    {{ -0.095671f, -0.097545f, -0.480970f }, { 0.191342f, 0.195090f, 0.961940f }, { 0.718750f, 0.437500f }},
+    {{ -0.000000f, -0.097545f, -0.490393f }, { 0.000000f, 0.195090f, 0.980785f }, { 0.750000f, 0.437500f }},
+    {{ 0.095671f, -0.097545f, -0.480970f }, { -0.191342f, 0.195090f, 0.961940f }, { 0.781250f, 0.437500f }},
+    {{ 0.187665f, -0.097545f, -0.453064f }, { -0.375330f, 0.195090f, 0.906127f }, { 0.812500f, 0.437500f }},
+    {{ 0.272448f, -0.097545f, -0.407747f }, { -0.544895f, 0.195090f, 0.815493f }, { 0.843750f, 0.437500f }},
+    {{ 0.346760f, -0.097545f, -0.346760f }, { -0.693520f, 0.195090f, 0.693520f }, { 0.875000f, 0.437500f }},
+    {{ 0.407747f, -0.097545f, -0.272448f }, { -0.815493f, 0.195090f, 0.544895f }, { 0.906250f, 0.437500f }},
+    {{ 0.453064f, -0.097545f, -0.187665f }, { -0.906127f, 0.195090f, 0.375330f }, { 0.937500f, 0.437500f }},
+    {{ 0.480970f, -0.097545f, -0.095671f }, { -0.961940f, 0.195090f, 0.191342f }, { 0.968750f, 0.437500f }},
+    {{ 0.490393f, -0.097545f, -0.000000f }, { -0.980785f, 0.195090f, 0.000000f }, { 1.000000f, 0.437500f }},
+    {{ 0.500000f, 0.000000f, 0.000000f }, { -1.000000f, -0.000000f, -0.000000f }, { 0.000000f, 0.500000f }},
+    {{ 0.490393f, 0.000000f, 0.097545f }, { -0.980785f, -0.000000f, -0.195090f }, { 0.031250f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, 0.191342f }, { -0.923880f, -0.000000f, -0.382683f }, { 0.062500f, 0.500000f }},
+    {{ 0.415735f, 0.000000f, 0.277785f }, { -0.831470f, -0.000000f, -0.555570f }, { 0.093750f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, 0.353553f }, { -0.707107f, -0.000000f, -0.707107f }, { 0.125000f, 0.500000f }},
+    {{ 0.277785f, 0.000000f, 0.415735f }, { -0.555570f, -0.000000f, -0.831470f }, { 0.156250f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, 0.461940f }, { -0.382683f, -0.000000f, -0.923880f }, { 0.187500f, 0.500000f }},
+    {{ 0.097545f, 0.000000f, 0.490393f }, { -0.195090f, -0.000000f, -0.980785f }, { 0.218750f, 0.500000f }},
+    {{ 0.000000f, 0.000000f, 0.500000f }, { -0.000000f, -0.000000f, -1.000000f }, { 0.250000f, 0.500000f }},
+    {{ -0.097545f, 0.000000f, 0.490393f }, { 0.195090f, -0.000000f, -0.980785f }, { 0.281250f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, 0.461940f }, { 0.382683f, -0.000000f, -0.923880f }, { 0.312500f, 0.500000f }},
+    {{ -0.277785f, 0.000000f, 0.415735f }, { 0.555570f, -0.000000f, -0.831470f }, { 0.343750f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, 0.353553f }, { 0.707107f, -0.000000f, -0.707107f }, { 0.375000f, 0.500000f }},
+    {{ -0.415735f, 0.000000f, 0.277785f }, { 0.831470f, -0.000000f, -0.555570f }, { 0.406250f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, 0.191342f }, { 0.923880f, -0.000000f, -0.382683f }, { 0.437500f, 0.500000f }},
+    {{ -0.490393f, 0.000000f, 0.097545f }, { 0.980785f, -0.000000f, -0.195090f }, { 0.468750f, 0.500000f }},
+    {{ -0.500000f, 0.000000f, 0.000000f }, { 1.000000f, -0.000000f, -0.000000f }, { 0.500000f, 0.500000f }},
+    {{ -0.490393f, 0.000000f, -0.097545f }, { 0.980785f, -0.000000f, 0.195090f }, { 0.531250f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, -0.191342f }, { 0.923880f, -0.000000f, 0.382683f }, { 0.562500f, 0.500000f }},
+    {{ -0.415735f, 0.000000f, -0.277785f }, { 0.831470f, -0.000000f, 0.555570f }, { 0.593750f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, -0.353553f }, { 0.707107f, -0.000000f, 0.707107f }, { 0.625000f, 0.500000f }},
+    {{ -0.277785f, 0.000000f, -0.415735f }, { 0.555570f, -0.000000f, 0.831470f }, { 0.656250f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, -0.461940f }, { 0.382683f, -0.000000f, 0.923880f }, { 0.687500f, 0.500000f }},
+    {{ -0.097545f, 0.000000f, -0.490393f }, { 0.195090f, -0.000000f, 0.980785f }, { 0.718750f, 0.500000f }},
+    {{ -0.000000f, 0.000000f, -0.500000f }, { 0.000000f, -0.000000f, 1.000000f }, { 0.750000f, 0.500000f }},
+    {{ 0.097545f, 0.000000f, -0.490393f }, { -0.195090f, -0.000000f, 0.980785f }, { 0.781250f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, -0.461940f }, { -0.382683f, -0.000000f, 0.923880f }, { 0.812500f, 0.500000f }},
+    {{ 0.277785f, 0.000000f, -0.415735f }, { -0.555570f, -0.000000f, 0.831470f }, { 0.843750f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, -0.353553f }, { -0.707107f, -0.000000f, 0.707107f }, { 0.875000f, 0.500000f }},
+    {{ 0.415735f, 0.000000f, -0.277785f }, { -0.831470f, -0.000000f, 0.555570f }, { 0.906250f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, -0.191342f }, { -0.923880f, -0.000000f, 0.382683f }, { 0.937500f, 0.500000f }},
+    {{ 0.490393f, 0.000000f, -0.097545f }, { -0.980785f, -0.000000f, 0.195090f }, { 0.968750f, 0.500000f }},
+    {{ 0.500000f, 0.000000f, -0.000000f }, { -1.000000f, -0.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.490393f, 0.097545f, 0.000000f }, { -0.980785f, -0.195090f, -0.000000f }, { 0.000000f, 0.562500f }},
+    {{ 0.480970f, 0.097545f, 0.095671f }, { -0.961940f, -0.195090f, -0.191342f }, { 0.031250f, 0.562500f }},
+    {{ 0.453064f, 0.097545f, 0.187665f }, { -0.906127f, -0.195090f, -0.375330f }, { 0.062500f, 0.562500f }},
+    {{ 0.407747f, 0.097545f, 0.272448f }, { -0.815493f, -0.195090f, -0.544895f }, { 0.093750f, 0.562500f }},
+    {{ 0.346760f, 0.097545f, 0.346760f }, { -0.693520f, -0.195090f, -0.693520f }, { 0.125000f, 0.562500f }},
+    {{ 0.272448f, 0.097545f, 0.407747f }, { -0.544895f, -0.195090f, -0.815493f }, { 0.156250f, 0.562500f }},
+    {{ 0.187665f, 0.097545f, 0.453064f }, { -0.375330f, -0.195090f, -0.906127f }, { 0.187500f, 0.562500f }},
+    {{ 0.095671f, 0.097545f, 0.480970f }, { -0.191342f, -0.195090f, -0.961940f }, { 0.218750f, 0.562500f }},
+    {{ 0.000000f, 0.097545f, 0.490393f }, { -0.000000f, -0.195090f, -0.980785f }, { 0.250000f, 0.562500f }},
+    {{ -0.095671f, 0.097545f, 0.480970f }, { 0.191342f, -0.195090f, -0.961940f }, { 0.281250f, 0.562500f }},
+    {{ -0.187665f, 0.097545f, 0.453064f }, { 0.375330f, -0.195090f, -0.906127f }, { 0.312500f, 0.562500f }},
+    {{ -0.272448f, 0.097545f, 0.407747f }, { 0.544895f, -0.195090f, -0.815493f }, { 0.343750f, 0.562500f }},
+    {{ -0.346760f, 0.097545f, 0.346760f }, { 0.693520f, -0.195090f, -0.693520f }, { 0.375000f, 0.562500f }},
+    {{ -0.407747f, 0.097545f, 0.272448f }, { 0.815493f, -0.195090f, -0.544895f }, { 0.406250f, 0.562500f }},
+    {{ -0.453064f, 0.097545f, 0.187665f }, { 0.906127f, -0.195090f, -0.375330f }, { 0.437500f, 0.562500f }},
+    {{ -0.480970f, 0.097545f, 0.095671f }, { 0.961940f, -0.195090f, -0.191342f }, { 0.468750f, 0.562500f }},
+    {{ -0.490393f, 0.097545f, 0.000000f }, { 0.980785f, -0.195090f, -0.000000f }, { 0.500000f, 0.562500f }},
+    {{ -0.480970f, 0.097545f, -0.095671f }, { 0.961940f, -0.195090f, 0.191342f }, { 0.531250f, 0.562500f }},
+    {{ -0.453064f, 0.097545f, -0.187665f }, { 0.906127f, -0.195090f, 0.375330f }, { 0.562500f, 0.562500f }},
+    {{ -0.407747f, 0.097545f, -0.272448f }, { 0.815493f, -0.195090f, 0.544895f }, { 0.593750f, 0.562500f }},
+    {{ -0.346760f, 0.097545f, -0.346760f }, { 0.693520f, -0.195090f, 0.693520f }, { 0.625000f, 0.562500f }},
+    {{ -0.272448f, 0.097545f, -0.407747f }, { 0.544895f, -0.195090f, 0.815493f }, { 0.656250f, 0.562500f }},
+    {{ -0.187665f, 0.097545f, -0.453064f }, { 0.375330f, -0.195090f, 0.906127f }, { 0.687500f, 0.562500f }},
+    {{ -0.095671f, 0.097545f, -0.480970f }, { 0.191342f, -0.195090f, 0.961940f }, { 0.718750f, 0.562500f }},
+    {{ -0.000000f, 0.097545f, -0.490393f }, { 0.000000f, -0.195090f, 0.980785f }, { 0.750000f, 0.562500f }},
+    {{ 0.095671f, 0.097545f, -0.480970f }, { -0.191342f, -0.195090f, 0.961940f }, { 0.781250f, 0.562500f }},
+    {{ 0.187665f, 0.097545f, -0.453064f }, { -0.375330f, -0.195090f, 0.906127f }, { 0.812500f, 0.562500f }},
+    {{ 0.272448f, 0.097545f, -0.407747f }, { -0.544895f, -0.195090f, 0.815493f }, { 0.843750f, 0.562500f }},
+    {{ 0.346760f, 0.097545f, -0.346760f }, { -0.693520f, -0.195090f, 0.693520f }, { 0.875000f, 0.562500f }},
+    {{ 0.407747f, 0.097545f, -0.272448f }, { -0.815493f, -0.195090f, 0.544895f }, { 0.906250f, 0.562500f }},
+    {{ 0.453064f, 0.097545f, -0.187665f }, { -0.906127f, -0.195090f, 0.375330f }, { 0.937500f, 0.562500f }},
+    {{ 0.480970f, 0.097545f, -0.095671f }, { -0.961940f, -0.195090f, 0.191342f }, { 0.968750f, 0.562500f }},
+    {{ 0.490393f, 0.097545f, -0.000000f }, { -0.980785f, -0.195090f, 0.000000f }, { 1.000000f, 0.562500f }},
+    {{ 0.461940f, 0.191342f, 0.000000f }, { -0.923880f, -0.382683f, -0.000000f }, { 0.000000f, 0.625000f }},
+    {{ 0.453064f, 0.191342f, 0.090120f }, { -0.906127f, -0.382683f, -0.180240f }, { 0.031250f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, 0.176777f }, { -0.853553f, -0.382683f, -0.353553f }, { 0.062500f, 0.625000f }},
+    {{ 0.384089f, 0.191342f, 0.256640f }, { -0.768178f, -0.382683f, -0.513280f }, { 0.093750f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, 0.326641f }, { -0.653281f, -0.382683f, -0.653281f }, { 0.125000f, 0.625000f }},
+    {{ 0.256640f, 0.191342f, 0.384089f }, { -0.513280f, -0.382683f, -0.768178f }, { 0.156250f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, 0.426777f }, { -0.353553f, -0.382683f, -0.853553f }, { 0.187500f, 0.625000f }},
+    {{ 0.090120f, 0.191342f, 0.453064f }, { -0.180240f, -0.382683f, -0.906127f }, { 0.218750f, 0.625000f }},
+    {{ 0.000000f, 0.191342f, 0.461940f }, { -0.000000f, -0.382683f, -0.923880f }, { 0.250000f, 0.625000f }},
+    {{ -0.090120f, 0.191342f, 0.453064f }, { 0.180240f, -0.382683f, -0.906127f }, { 0.281250f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, 0.426777f }, { 0.353553f, -0.382683f, -0.853553f }, { 0.312500f, 0.625000f }},
+    {{ -0.256640f, 0.191342f, 0.384089f }, { 0.513280f, -0.382683f, -0.768178f }, { 0.343750f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, 0.326641f }, { 0.653281f, -0.382683f, -0.653281f }, { 0.375000f, 0.625000f }},
+    {{ -0.384089f, 0.191342f, 0.256640f }, { 0.768178f, -0.382683f, -0.513280f }, { 0.406250f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, 0.176777f }, { 0.853553f, -0.382683f, -0.353553f }, { 0.437500f, 0.625000f }},
+    {{ -0.453064f, 0.191342f, 0.090120f }, { 0.906127f, -0.382683f, -0.180240f }, { 0.468750f, 0.625000f }},
+    {{ -0.461940f, 0.191342f, 0.000000f }, { 0.923880f, -0.382683f, -0.000000f }, { 0.500000f, 0.625000f }},
+    {{ -0.453064f, 0.191342f, -0.090120f }, { 0.906127f, -0.382683f, 0.180240f }, { 0.531250f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, -0.176777f }, { 0.853553f, -0.382683f, 0.353553f }, { 0.562500f, 0.625000f }},
+    {{ -0.384089f, 0.191342f, -0.256640f }, { 0.768178f, -0.382683f, 0.513280f }, { 0.593750f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, -0.326641f }, { 0.653281f, -0.382683f, 0.653281f }, { 0.625000f, 0.625000f }},
+    {{ -0.256640f, 0.191342f, -0.384089f }, { 0.513280f, -0.382683f, 0.768178f }, { 0.656250f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, -0.426777f }, { 0.353553f, -0.382683f, 0.853553f }, { 0.687500f, 0.625000f }},
+    {{ -0.090120f, 0.191342f, -0.453064f }, { 0.180240f, -0.382683f, 0.906127f }, { 0.718750f, 0.625000f }},
+    {{ -0.000000f, 0.191342f, -0.461940f }, { 0.000000f, -0.382683f, 0.923880f }, { 0.750000f, 0.625000f }},
+    {{ 0.090120f, 0.191342f, -0.453064f }, { -0.180240f, -0.382683f, 0.906127f }, { 0.781250f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, -0.426777f }, { -0.353553f, -0.382683f, 0.853553f }, { 0.812500f, 0.625000f }},
+    {{ 0.256640f, 0.191342f, -0.384089f }, { -0.513280f, -0.382683f, 0.768178f }, { 0.843750f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, -0.326641f }, { -0.653281f, -0.382683f, 0.653281f }, { 0.875000f, 0.625000f }},
+    {{ 0.384089f, 0.191342f, -0.256640f }, { -0.768178f, -0.382683f, 0.513280f }, { 0.906250f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, -0.176777f }, { -0.853553f, -0.382683f, 0.353553f }, { 0.937500f, 0.625000f }},
+    {{ 0.453064f, 0.191342f, -0.090120f }, { -0.906127f, -0.382683f, 0.180240f }, { 0.968750f, 0.625000f }},
+    {{ 0.461940f, 0.191342f, -0.000000f }, { -0.923880f, -0.382683f, 0.000000f }, { 1.000000f, 0.625000f }},
+    {{ 0.415735f, 0.277785f, 0.000000f }, { -0.831470f, -0.555570f, -0.000000f }, { 0.000000f, 0.687500f }},
+    {{ 0.407747f, 0.277785f, 0.081106f }, { -0.815493f, -0.555570f, -0.162212f }, { 0.031250f, 0.687500f }},
+    {{ 0.384089f, 0.277785f, 0.159095f }, { -0.768178f, -0.555570f, -0.318190f }, { 0.062500f, 0.687500f }},
+    {{ 0.345671f, 0.277785f, 0.230970f }, { -0.691342f, -0.555570f, -0.461940f }, { 0.093750f, 0.687500f }},
+    {{ 0.293969f, 0.277785f, 0.293969f }, { -0.587938f, -0.555570f, -0.587938f }, { 0.125000f, 0.687500f }},
+    {{ 0.230970f, 0.277785f, 0.345671f }, { -0.461940f, -0.555570f, -0.691342f }, { 0.156250f, 0.687500f }},
+    {{ 0.159095f, 0.277785f, 0.384089f }, { -0.318190f, -0.555570f, -0.768178f }, { 0.187500f, 0.687500f }},
+    {{ 0.081106f, 0.277785f, 0.407747f }, { -0.162212f, -0.555570f, -0.815493f }, { 0.218750f, 0.687500f }},
+    {{ 0.000000f, 0.277785f, 0.415735f }, { -0.000000f, -0.555570f, -0.831470f }, { 0.250000f, 0.687500f }},
+    {{ -0.081106f, 0.277785f, 0.407747f }, { 0.162212f, -0.555570f, -0.815493f }, { 0.281250f, 0.687500f }},
+    {{ -0.159095f, 0.277785f, 0.384089f }, { 0.318190f, -0.555570f, -0.768178f }, { 0.312500f, 0.687500f }},
+    {{ -0.230970f, 0.277785f, 0.345671f }, { 0.461940f, -0.555570f, -0.691342f }, { 0.343750f, 0.687500f }},
+    {{ -0.293969f, 0.277785f, 0.293969f }, { 0.587938f, -0.555570f, -0.587938f }, { 0.375000f, 0.687500f }},
+    {{ -0.345671f, 0.277785f, 0.230970f }, { 0.691342f, -0.555570f, -0.461940f }, { 0.406250f, 0.687500f }},
+    {{ -0.384089f, 0.277785f, 0.159095f }, { 0.768178f, -0.555570f, -0.318190f }, { 0.437500f, 0.687500f }},
+    {{ -0.407747f, 0.277785f, 0.081106f }, { 0.815493f, -0.555570f, -0.162212f }, { 0.468750f, 0.687500f }},
+    {{ -0.415735f, 0.277785f, 0.000000f }, { 0.831470f, -0.555570f, -0.000000f }, { 0.500000f, 0.687500f }},
+    {{ -0.407747f, 0.277785f, -0.081106f }, { 0.815493f, -0.555570f, 0.162212f }, { 0.531250f, 0.687500f }},
+    {{ -0.384089f, 0.277785f, -0.159095f }, { 0.768178f, -0.555570f, 0.318190f }, { 0.562500f, 0.687500f }},
+    {{ -0.345671f, 0.277785f, -0.230970f }, { 0.691342f, -0.555570f, 0.461940f }, { 0.593750f, 0.687500f }},
+    {{ -0.293969f, 0.277785f, -0.293969f }, { 0.587938f, -0.555570f, 0.587938f }, { 0.625000f, 0.687500f }},
+    {{ -0.230970f, 0.277785f, -0.345671f }, { 0.461940f, -0.555570f, 0.691342f }, { 0.656250f, 0.687500f }},
+    {{ -0.159095f, 0.277785f, -0.384089f }, { 0.318190f, -0.555570f, 0.768178f }, { 0.687500f, 0.687500f }},
+    {{ -0.081106f, 0.277785f, -0.407747f }, { 0.162212f, -0.555570f, 0.815493f }, { 0.718750f, 0.687500f }},
+    {{ -0.000000f, 0.277785f, -0.415735f }, { 0.000000f, -0.555570f, 0.831470f }, { 0.750000f, 0.687500f }},
+    {{ 0.081106f, 0.277785f, -0.407747f }, { -0.162212f, -0.555570f, 0.815493f }, { 0.781250f, 0.687500f }},
+    {{ 0.159095f, 0.277785f, -0.384089f }, { -0.318190f, -0.555570f, 0.768178f }, { 0.812500f, 0.687500f }},
+    {{ 0.230970f, 0.277785f, -0.345671f }, { -0.461940f, -0.555570f, 0.691342f }, { 0.843750f, 0.687500f }},
+    {{ 0.293969f, 0.277785f, -0.293969f }, { -0.587938f, -0.555570f, 0.587938f }, { 0.875000f, 0.687500f }},
+    {{ 0.345671f, 0.277785f, -0.230970f }, { -0.691342f, -0.555570f, 0.461940f }, { 0.906250f, 0.687500f }},
+    {{ 0.384089f, 0.277785f, -0.159095f }, { -0.768178f, -0.555570f, 0.318190f }, { 0.937500f, 0.687500f }},
+    {{ 0.407747f, 0.277785f, -0.081106f }, { -0.815493f, -0.555570f, 0.162212f }, { 0.968750f, 0.687500f }},
+    {{ 0.415735f, 0.277785f, -0.000000f }, { -0.831470f, -0.555570f, 0.000000f }, { 1.000000f, 0.687500f }},
+    {{ 0.353553f, 0.353553f, 0.000000f }, { -0.707107f, -0.707107f, -0.000000f }, { 0.000000f, 0.750000f }},
+    {{ 0.346760f, 0.353553f, 0.068975f }, { -0.693520f, -0.707107f, -0.137950f }, { 0.031250f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, 0.135299f }, { -0.653281f, -0.707107f, -0.270598f }, { 0.062500f, 0.750000f }},
+    {{ 0.293969f, 0.353553f, 0.196424f }, { -0.587938f, -0.707107f, -0.392847f }, { 0.093750f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, 0.250000f }, { -0.500000f, -0.707107f, -0.500000f }, { 0.125000f, 0.750000f }},
+    {{ 0.196424f, 0.353553f, 0.293969f }, { -0.392847f, -0.707107f, -0.587938f }, { 0.156250f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, 0.326641f }, { -0.270598f, -0.707107f, -0.653281f }, { 0.187500f, 0.750000f }},
+    {{ 0.068975f, 0.353553f, 0.346760f }, { -0.137950f, -0.707107f, -0.693520f }, { 0.218750f, 0.750000f }},
+    {{ 0.000000f, 0.353553f, 0.353553f }, { -0.000000f, -0.707107f, -0.707107f }, { 0.250000f, 0.750000f }},
+    {{ -0.068975f, 0.353553f, 0.346760f }, { 0.137950f, -0.707107f, -0.693520f }, { 0.281250f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, 0.326641f }, { 0.270598f, -0.707107f, -0.653281f }, { 0.312500f, 0.750000f }},
+    {{ -0.196424f, 0.353553f, 0.293969f }, { 0.392847f, -0.707107f, -0.587938f }, { 0.343750f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, 0.250000f }, { 0.500000f, -0.707107f, -0.500000f }, { 0.375000f, 0.750000f }},
+    {{ -0.293969f, 0.353553f, 0.196424f }, { 0.587938f, -0.707107f, -0.392847f }, { 0.406250f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, 0.135299f }, { 0.653281f, -0.707107f, -0.270598f }, { 0.437500f, 0.750000f }},
+    {{ -0.346760f, 0.353553f, 0.068975f }, { 0.693520f, -0.707107f, -0.137950f }, { 0.468750f, 0.750000f }},
+    {{ -0.353553f, 0.353553f, 0.000000f }, { 0.707107f, -0.707107f, -0.000000f }, { 0.500000f, 0.750000f }},
+    {{ -0.346760f, 0.353553f, -0.068975f }, { 0.693520f, -0.707107f, 0.137950f }, { 0.531250f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, -0.135299f }, { 0.653281f, -0.707107f, 0.270598f }, { 0.562500f, 0.750000f }},
+    {{ -0.293969f, 0.353553f, -0.196424f }, { 0.587938f, -0.707107f, 0.392847f }, { 0.593750f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, -0.250000f }, { 0.500000f, -0.707107f, 0.500000f }, { 0.625000f, 0.750000f }},
+    {{ -0.196424f, 0.353553f, -0.293969f }, { 0.392847f, -0.707107f, 0.587938f }, { 0.656250f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, -0.326641f }, { 0.270598f, -0.707107f, 0.653281f }, { 0.687500f, 0.750000f }},
+    {{ -0.068975f, 0.353553f, -0.346760f }, { 0.137950f, -0.707107f, 0.693520f }, { 0.718750f, 0.750000f }},
+    {{ -0.000000f, 0.353553f, -0.353553f }, { 0.000000f, -0.707107f, 0.707107f }, { 0.750000f, 0.750000f }},
+    {{ 0.068975f, 0.353553f, -0.346760f }, { -0.137950f, -0.707107f, 0.693520f }, { 0.781250f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, -0.326641f }, { -0.270598f, -0.707107f, 0.653281f }, { 0.812500f, 0.750000f }},
+    {{ 0.196424f, 0.353553f, -0.293969f }, { -0.392847f, -0.707107f, 0.587938f }, { 0.843750f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, -0.250000f }, { -0.500000f, -0.707107f, 0.500000f }, { 0.875000f, 0.750000f }},
+    {{ 0.293969f, 0.353553f, -0.196424f }, { -0.587938f, -0.707107f, 0.392847f }, { 0.906250f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, -0.135299f }, { -0.653281f, -0.707107f, 0.270598f }, { 0.937500f, 0.750000f }},
+    {{ 0.346760f, 0.353553f, -0.068975f }, { -0.693520f, -0.707107f, 0.137950f }, { 0.968750f, 0.750000f }},
+    {{ 0.353553f, 0.353553f, -0.000000f }, { -0.707107f, -0.707107f, 0.000000f }, { 1.000000f, 0.750000f }},
+    {{ 0.277785f, 0.415735f, 0.000000f }, { -0.555570f, -0.831470f, -0.000000f }, { 0.000000f, 0.812500f }},
+    {{ 0.272448f, 0.415735f, 0.054193f }, { -0.544895f, -0.831470f, -0.108386f }, { 0.031250f, 0.812500f }},
+    {{ 0.256640f, 0.415735f, 0.106304f }, { -0.513280f, -0.831470f, -0.212608f }, { 0.062500f, 0.812500f }},
+    {{ 0.230970f, 0.415735f, 0.154329f }, { -0.461940f, -0.831470f, -0.308658f }, { 0.093750f, 0.812500f }},
+    {{ 0.196424f, 0.415735f, 0.196424f }, { -0.392847f, -0.831470f, -0.392847f }, { 0.125000f, 0.812500f }},
+    {{ 0.154329f, 0.415735f, 0.230970f }, { -0.308658f, -0.831470f, -0.461940f }, { 0.156250f, 0.812500f }},
+    {{ 0.106304f, 0.415735f, 0.256640f }, { -0.212608f, -0.831470f, -0.513280f }, { 0.187500f, 0.812500f }},
+    {{ 0.054193f, 0.415735f, 0.272448f }, { -0.108386f, -0.831470f, -0.544895f }, { 0.218750f, 0.812500f }},
+    {{ 0.000000f, 0.415735f, 0.277785f }, { -0.000000f, -0.831470f, -0.555570f }, { 0.250000f, 0.812500f }},
+    {{ -0.054193f, 0.415735f, 0.272448f }, { 0.108386f, -0.831470f, -0.544895f }, { 0.281250f, 0.812500f }},
+    {{ -0.106304f, 0.415735f, 0.256640f }, { 0.212608f, -0.831470f, -0.513280f }, { 0.312500f, 0.812500f }},
+    {{ -0.154329f, 0.415735f, 0.230970f }, { 0.308658f, -0.831470f, -0.461940f }, { 0.343750f, 0.812500f }},
+    {{ -0.196424f, 0.415735f, 0.196424f }, { 0.392847f, -0.831470f, -0.392847f }, { 0.375000f, 0.812500f }},
+    {{ -0.230970f, 0.415735f, 0.154329f }, { 0.461940f, -0.831470f, -0.308658f }, { 0.406250f, 0.812500f }},
+    {{ -0.256640f, 0.415735f, 0.106304f }, { 0.513280f, -0.831470f, -0.212608f }, { 0.437500f, 0.812500f }},
+    {{ -0.272448f, 0.415735f, 0.054193f }, { 0.544895f, -0.831470f, -0.108386f }, { 0.468750f, 0.812500f }},
+    {{ -0.277785f, 0.415735f, 0.000000f }, { 0.555570f, -0.831470f, -0.000000f }, { 0.500000f, 0.812500f }},
+    {{ -0.272448f, 0.415735f, -0.054193f }, { 0.544895f, -0.831470f, 0.108386f }, { 0.531250f, 0.812500f }},
+    {{ -0.256640f, 0.415735f, -0.106304f }, { 0.513280f, -0.831470f, 0.212608f }, { 0.562500f, 0.812500f }},
+    {{ -0.230970f, 0.415735f, -0.154329f }, { 0.461940f, -0.831470f, 0.308658f }, { 0.593750f, 0.812500f }},
+    {{ -0.196424f, 0.415735f, -0.196424f }, { 0.392847f, -0.831470f, 0.392847f }, { 0.625000f, 0.812500f }},
+    {{ -0.154329f, 0.415735f, -0.230970f }, { 0.308658f, -0.831470f, 0.461940f }, { 0.656250f, 0.812500f }},
+    {{ -0.106304f, 0.415735f, -0.256640f }, { 0.212608f, -0.831470f, 0.513280f }, { 0.687500f, 0.812500f }},
+    {{ -0.054193f, 0.415735f, -0.272448f }, { 0.108386f, -0.831470f, 0.544895f }, { 0.718750f, 0.812500f }},
+    {{ -0.000000f, 0.415735f, -0.277785f }, { 0.000000f, -0.831470f, 0.555570f }, { 0.750000f, 0.812500f }},
+    {{ 0.054193f, 0.415735f, -0.272448f }, { -0.108386f, -0.831470f, 0.544895f }, { 0.781250f, 0.812500f }},
+    {{ 0.106304f, 0.415735f, -0.256640f }, { -0.212608f, -0.831470f, 0.513280f }, { 0.812500f, 0.812500f }},
+    {{ 0.154329f, 0.415735f, -0.230970f }, { -0.308658f, -0.831470f, 0.461940f }, { 0.843750f, 0.812500f }},
+    {{ 0.196424f, 0.415735f, -0.196424f }, { -0.392847f, -0.831470f, 0.392847f }, { 0.875000f, 0.812500f }},
+    {{ 0.230970f, 0.415735f, -0.154329f }, { -0.461940f, -0.831470f, 0.308658f }, { 0.906250f, 0.812500f }},
+    {{ 0.256640f, 0.415735f, -0.106304f }, { -0.513280f, -0.831470f, 0.212608f }, { 0.937500f, 0.812500f }},
+    {{ 0.272448f, 0.415735f, -0.054193f }, { -0.544895f, -0.831470f, 0.108386f }, { 0.968750f, 0.812500f }},
+    {{ 0.277785f, 0.415735f, -0.000000f }, { -0.555570f, -0.831470f, 0.000000f }, { 1.000000f, 0.812500f }},
+    {{ 0.191342f, 0.461940f, 0.000000f }, { -0.382683f, -0.923880f, -0.000000f }, { 0.000000f, 0.875000f }},
+    {{ 0.187665f, 0.461940f, 0.037329f }, { -0.375330f, -0.923880f, -0.074658f }, { 0.031250f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, 0.073223f }, { -0.353553f, -0.923880f, -0.146447f }, { 0.062500f, 0.875000f }},
+    {{ 0.159095f, 0.461940f, 0.106304f }, { -0.318190f, -0.923880f, -0.212608f }, { 0.093750f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, 0.135299f }, { -0.270598f, -0.923880f, -0.270598f }, { 0.125000f, 0.875000f }},
+    {{ 0.106304f, 0.461940f, 0.159095f }, { -0.212608f, -0.923880f, -0.318190f }, { 0.156250f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, 0.176777f }, { -0.146447f, -0.923880f, -0.353553f }, { 0.187500f, 0.875000f }},
+    {{ 0.037329f, 0.461940f, 0.187665f }, { -0.074658f, -0.923880f, -0.375330f }, { 0.218750f, 0.875000f }},
+    {{ 0.000000f, 0.461940f, 0.191342f }, { -0.000000f, -0.923880f, -0.382683f }, { 0.250000f, 0.875000f }},
+    {{ -0.037329f, 0.461940f, 0.187665f }, { 0.074658f, -0.923880f, -0.375330f }, { 0.281250f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, 0.176777f }, { 0.146447f, -0.923880f, -0.353553f }, { 0.312500f, 0.875000f }},
+    {{ -0.106304f, 0.461940f, 0.159095f }, { 0.212608f, -0.923880f, -0.318190f }, { 0.343750f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, 0.135299f }, { 0.270598f, -0.923880f, -0.270598f }, { 0.375000f, 0.875000f }},
+    {{ -0.159095f, 0.461940f, 0.106304f }, { 0.318190f, -0.923880f, -0.212608f }, { 0.406250f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, 0.073223f }, { 0.353553f, -0.923880f, -0.146447f }, { 0.437500f, 0.875000f }},
+    {{ -0.187665f, 0.461940f, 0.037329f }, { 0.375330f, -0.923880f, -0.074658f }, { 0.468750f, 0.875000f }},
+    {{ -0.191342f, 0.461940f, 0.000000f }, { 0.382683f, -0.923880f, -0.000000f }, { 0.500000f, 0.875000f }},
+    {{ -0.187665f, 0.461940f, -0.037329f }, { 0.375330f, -0.923880f, 0.074658f }, { 0.531250f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, -0.073223f }, { 0.353553f, -0.923880f, 0.146447f }, { 0.562500f, 0.875000f }},
+    {{ -0.159095f, 0.461940f, -0.106304f }, { 0.318190f, -0.923880f, 0.212608f }, { 0.593750f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, -0.135299f }, { 0.270598f, -0.923880f, 0.270598f }, { 0.625000f, 0.875000f }},
+    {{ -0.106304f, 0.461940f, -0.159095f }, { 0.212608f, -0.923880f, 0.318190f }, { 0.656250f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, -0.176777f }, { 0.146447f, -0.923880f, 0.353553f }, { 0.687500f, 0.875000f }},
+    {{ -0.037329f, 0.461940f, -0.187665f }, { 0.074658f, -0.923880f, 0.375330f }, { 0.718750f, 0.875000f }},
+    {{ -0.000000f, 0.461940f, -0.191342f }, { 0.000000f, -0.923880f, 0.382683f }, { 0.750000f, 0.875000f }},
+    {{ 0.037329f, 0.461940f, -0.187665f }, { -0.074658f, -0.923880f, 0.375330f }, { 0.781250f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, -0.176777f }, { -0.146447f, -0.923880f, 0.353553f }, { 0.812500f, 0.875000f }},
+    {{ 0.106304f, 0.461940f, -0.159095f }, { -0.212608f, -0.923880f, 0.318190f }, { 0.843750f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, -0.135299f }, { -0.270598f, -0.923880f, 0.270598f }, { 0.875000f, 0.875000f }},
+    {{ 0.159095f, 0.461940f, -0.106304f }, { -0.318190f, -0.923880f, 0.212608f }, { 0.906250f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, -0.073223f }, { -0.353553f, -0.923880f, 0.146447f }, { 0.937500f, 0.875000f }},
+    {{ 0.187665f, 0.461940f, -0.037329f }, { -0.375330f, -0.923880f, 0.074658f }, { 0.968750f, 0.875000f }},
+    {{ 0.191342f, 0.461940f, -0.000000f }, { -0.382683f, -0.923880f, 0.000000f }, { 1.000000f, 0.875000f }},
+    {{ 0.097545f, 0.490393f, 0.000000f }, { -0.195090f, -0.980785f, -0.000000f }, { 0.000000f, 0.937500f }},
+    {{ 0.095671f, 0.490393f, 0.019030f }, { -0.191342f, -0.980785f, -0.038060f }, { 0.031250f, 0.937500f }},
+    {{ 0.090120f, 0.490393f, 0.037329f }, { -0.180240f, -0.980785f, -0.074658f }, { 0.062500f, 0.937500f }},
+    {{ 0.081106f, 0.490393f, 0.054193f }, { -0.162212f, -0.980785f, -0.108386f }, { 0.093750f, 0.937500f }},
+    {{ 0.068975f, 0.490393f, 0.068975f }, { -0.137950f, -0.980785f, -0.137950f }, { 0.125000f, 0.937500f }},
+    {{ 0.054193f, 0.490393f, 0.081106f }, { -0.108386f, -0.980785f, -0.162212f }, { 0.156250f, 0.937500f }},
+    {{ 0.037329f, 0.490393f, 0.090120f }, { -0.074658f, -0.980785f, -0.180240f }, { 0.187500f, 0.937500f }},
+    {{ 0.019030f, 0.490393f, 0.095671f }, { -0.038060f, -0.980785f, -0.191342f }, { 0.218750f, 0.937500f }},
+    {{ 0.000000f, 0.490393f, 0.097545f }, { -0.000000f, -0.980785f, -0.195090f }, { 0.250000f, 0.937500f }},
+    {{ -0.019030f, 0.490393f, 0.095671f }, { 0.038060f, -0.980785f, -0.191342f }, { 0.281250f, 0.937500f }},
+    {{ -0.037329f, 0.490393f, 0.090120f }, { 0.074658f, -0.980785f, -0.180240f }, { 0.312500f, 0.937500f }},
+    {{ -0.054193f, 0.490393f, 0.081106f }, { 0.108386f, -0.980785f, -0.162212f }, { 0.343750f, 0.937500f }},
+    {{ -0.068975f, 0.490393f, 0.068975f }, { 0.137950f, -0.980785f, -0.137950f }, { 0.375000f, 0.937500f }},
+    {{ -0.081106f, 0.490393f, 0.054193f }, { 0.162212f, -0.980785f, -0.108386f }, { 0.406250f, 0.937500f }},
+    {{ -0.090120f, 0.490393f, 0.037329f }, { 0.180240f, -0.980785f, -0.074658f }, { 0.437500f, 0.937500f }},
+    {{ -0.095671f, 0.490393f, 0.019030f }, { 0.191342f, -0.980785f, -0.038060f }, { 0.468750f, 0.937500f }},
+    {{ -0.097545f, 0.490393f, 0.000000f }, { 0.195090f, -0.980785f, -0.000000f }, { 0.500000f, 0.937500f }},
+    {{ -0.095671f, 0.490393f, -0.019030f }, { 0.191342f, -0.980785f, 0.038060f }, { 0.531250f, 0.937500f }},
+    {{ -0.090120f, 0.490393f, -0.037329f }, { 0.180240f, -0.980785f, 0.074658f }, { 0.562500f, 0.937500f }},
+    {{ -0.081106f, 0.490393f, -0.054193f }, { 0.162212f, -0.980785f, 0.108386f }, { 0.593750f, 0.937500f }},
+    {{ -0.068975f, 0.490393f, -0.068975f }, { 0.137950f, -0.980785f, 0.137950f }, { 0.625000f, 0.937500f }},
+    {{ -0.054193f, 0.490393f, -0.081106f }, { 0.108386f, -0.980785f, 0.162212f }, { 0.656250f, 0.937500f }},
+    {{ -0.037329f, 0.490393f, -0.090120f }, { 0.074658f, -0.980785f, 0.180240f }, { 0.687500f, 0.937500f }},
+    {{ -0.019030f, 0.490393f, -0.095671f }, { 0.038060f, -0.980785f, 0.191342f }, { 0.718750f, 0.937500f }},
+    {{ -0.000000f, 0.490393f, -0.097545f }, { 0.000000f, -0.980785f, 0.195090f }, { 0.750000f, 0.937500f }},
+    {{ 0.019030f, 0.490393f, -0.095671f }, { -0.038060f, -0.980785f, 0.191342f }, { 0.781250f, 0.937500f }},
+    {{ 0.037329f, 0.490393f, -0.090120f }, { -0.074658f, -0.980785f, 0.180240f }, { 0.812500f, 0.937500f }},
+    {{ 0.054193f, 0.490393f, -0.081106f }, { -0.108386f, -0.980785f, 0.162212f }, { 0.843750f, 0.937500f }},
+    {{ 0.068975f, 0.490393f, -0.068975f }, { -0.137950f, -0.980785f, 0.137950f }, { 0.875000f, 0.937500f }},
+    {{ 0.081106f, 0.490393f, -0.054193f }, { -0.162212f, -0.980785f, 0.108386f }, { 0.906250f, 0.937500f }},
+    {{ 0.090120f, 0.490393f, -0.037329f }, { -0.180240f, -0.980785f, 0.074658f }, { 0.937500f, 0.937500f }},
+    {{ 0.095671f, 0.490393f, -0.019030f }, { -0.191342f, -0.980785f, 0.038060f }, { 0.968750f, 0.937500f }},
+    {{ 0.097545f, 0.490393f, -0.000000f }, { -0.195090f, -0.980785f, 0.000000f }, { 1.000000f, 0.937500f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.000000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.031250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.062500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.093750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.125000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.156250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.187500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.218750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.250000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.281250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.312500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.343750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.375000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.406250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.437500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.468750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.531250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.562500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.593750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.625000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.656250f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.687500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.718750f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.750000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.781250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.812500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.843750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.875000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.906250f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.937500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.968750f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 1.000000f, 1.000000f }},
+};
+
+static const UINT kInvertedSphereLod1VertexCount = 561;
+
+static const uint32_t kInvertedSphereLod1Indices[3072] = {
+    0, 1, 34, 0, 34, 33, 1, 2, 35, 1, 35, 34, 
+    2, 3, 36, 2, 36, 35, 3, 4, 37, 3, 37, 36, 
+    4, 5, 38, 4, 38, 37, 5, 6, 39, 5, 39, 38, 
+    6, 7, 40, 6, 40, 39, 7, 8, 41, 7, 41, 40, 
+    8, 9, 42, 8, 42, 41, 9, 10, 43, 9, 43, 42, 
+    10, 11, 44, 10, 44, 43, 11, 12, 45, 11, 45, 44, 
+    12, 13, 46, 12, 46, 45, 13, 14, 47, 13, 47, 46, 
+    14, 15, 48, 14, 48, 47, 15, 16, 49, 15, 49, 48, 
+    16, 17, 50, 16, 50, 49, 17, 18, 51, 17, 51, 50, 
+    18, 19, 52, 18, 52, 51, 19, 20, 53, 19, 53, 52, 
+    20, 21, 54, 20, 54, 53, 21, 22, 55, 21, 55, 54, 
+    22, 23, 56, 22, 56, 55, 23, 24, 57, 23, 57, 56, 
+    24, 25, 58, 24, 58, 57, 25, 26, 59, 25, 59, 58, 
+    26, 27, 60, 26, 60, 59, 27, 28, 61, 27, 61, 60, 
+    28, 29, 62, 28, 62, 61, 29, 30, 63, 29, 63, 62, 
+    30, 31, 64, 30, 64, 63, 31, 32, 65, 31, 65, 64, 
+    33, 34, 67, 33, 67, 66, 34, 35, 68, 34, 68, 67, 
+    35, 36, 69, 35, 69, 68, 36, 37, 70, 36, 70, 69, 
+    37, 38, 71, 37, 71, 70, 38, 39, 72, 38, 72, 71, 
+    39, 40, 73, 39, 73, 72, 40, 41, 74, 40, 74, 73, 
+    41, 42, 75, 41, 75, 74, 42, 43, 76, 42, 76, 75, 
+    43, 44, 77, 43, 77, 76, 44, 45, 78, 44, 78, 77, 
+    45, 46, 79, 45, 79, 78, 46, 47, 80, 46, 80, 79, 
+    47, 48, 81, 47, 81, 80, 48, 49, 82, 48, 82, 81, 
+    49, 50, 83, 49, 83, 82, 50, 51, 84, 50, 84, 83, 
+    51, 52, 85, 51, 85, 84, 52, 53, 86, 52, 86, 85, 
+    53, 54, 87, 53, 87, 86, 54, 55, 88, 54, 88, 87, 
+    55, 56, 89, 55, 89, 88, 56, 57, 90, 56, 90, 89, 
+    57, 58, 91, 57, 91, 90, 58, 59, 92, 58, 92, 91, 
+    59, 60, 93, 59, 93, 92, 60, 61, 94, 60, 94, 93, 
+    61, 62, 95, 61, 95, 94, 62, 63, 96, 62, 96, 95, 
+    63, 64, 97, 63, 97, 96, 64, 65, 98, 64, 98, 97, 
+    66, 67, 100, 66, 100, 99, 67, 68, 101, 67, 101, 100, 
+    68, 69, 102, 68, 102, 101, 69, 70, 103, 69, 103, 102, 
+    70, 71, 104, 70, 104, 103, 71, 72, 105, 71, 105, 104, 
+    72, 73, 106, 72, 106, 105, 73, 74, 107, 73, 107, 106, 
+    74, 75, 108, 74, 108, 107, 75, 76, 109, 75, 109, 108, 
+    76, 77, 110, 76, 110, 109, 77, 78, 111, 77, 111, 110, 
+    78, 79, 112, 78, 112, 111, 79, 80, 113, 79, 113, 112, 
+    80, 81, 114, 80, 114, 113, 81, 82, 115, 81, 115, 114, 
+    82, 83, 116, 82, 116, 115, 83, 84, 117, 83, 117, 116, 
+    84, 85, 118, 84, 118, 117, 85, 86, 119, 85, 119, 118, 
+    86, 87, 120, 86, 120, 119, 87, 88, 121, 87, 121, 120, 
+    88, 89, 122, 88, 122, 121, 89, 90, 123, 89, 123, 122, 
+    90, 91, 124, 90, 124, 123, 91, 92, 125, 91, 125, 124, 
+    92, 93, 126, 92, 126, 125, 93, 94, 127, 93, 127, 126, 
+    94, 95, 128, 94, 128, 127, 95, 96, 129, 95, 129, 128, 
+    96, 97, 130, 96, 130, 129, 97, 98, 131, 97, 131, 130, 
+    99, 100, 133, 99, 133, 132, 100, 101, 134, 100, 134, 133, 
+    101, 102, 135, 101, 135, 134, 102, 103, 136, 102, 136, 135, 
+    103, 104, 137, 103, 137, 136, 104, 105, 138, 104, 138, 137, 
+    105, 106, 139, 105, 139, 138, 106, 107, 140, 106, 140, 139, 
+    107, 108, 141, 107, 141, 140, 108, 109, 142, 108, 142, 141, 
+    109, 110, 143, 109, 143, 142, 110, 111, 144, 110, 144, 143, 
+    111, 112, 145, 111, 145, 144, 112, 113, 146, 112, 146, 145, 
+    113, 114, 147, 113, 147, 146, 114, 115, 148, 114, 148, 147, 
+    115, 116, 149, 115, 149, 148, 116, 117, 150, 116, 150, 149, 
+    117, 118, 151, 117, 151, 150, 118, 119, 152, 118, 152, 151, 
+    119, 120, 153, 119, 153, 152, 120, 121, 154, 120, 154, 153, 
+    121, 122, 155, 121, 155, 154, 122, 123, 156, 122, 156, 155, 
+    123, 124, 157, 123, 157, 156, 124, 125, 158, 124, 158, 157, 
+    125, 126, 159, 125, 159, 158, 126, 127, 160, 126, 160, 159, 
+    127, 128, 161, 127, 161, 160, 128, 129, 162, 128, 162, 161, 
+    129, 130, 163, 129, 163, 162, 130, 131, 164, 130, 164, 163, 
+    132, 133, 166, 132, 166, 165, 133, 134, 167, 133, 167, 166, 
+    134, 135, 168, 134, 168, 167, 135, 136, 169, 135, 169, 168, 
+    136, 137, 170, 136, 170, 169, 137, 138, 171, 137, 171, 170, 
+    138, 139, 172, 138, 172, 171, 139, 140, 173, 139, 173, 172, 
+    140, 141, 174, 140, 174, 173, 141, 142, 175, 141, 175, 174, 
+    142, 143, 176, 142, 176, 175, 143, 144, 177, 143, 177, 176, 
+    144, 145, 178, 144, 178, 177, 145, 146, 179, 145, 179, 178, 
+    146, 147, 180, 146, 180, 179, 147, 148, 181, 147, 181, 180, 
+    148, 149, 182, 148, 182, 181, 149, 150, 183, 149, 183, 182, 
+    150, 151, 184, 150, 184, 183, 151, 152, 185, 151, 185, 184, 
+    152, 153, 186, 152, 186, 185, 153, 154, 187, 153, 187, 186, 
+    154, 155, 188, 154, 188, 187, 155, 156, 189, 155, 189, 188, 
+    156, 157, 190, 156, 190, 189, 157, 158, 191, 157, 191, 190, 
+    158, 159, 192, 158, 192, 191, 159, 160, 193, 159, 193, 192, 
+    160, 161, 194, 160, 194, 193, 161, 162, 195, 161, 195, 194, 
+    162, 163, 196, 162, 196, 195, 163, 164, 197, 163, 197, 196, 
+    165, 166, 199, 165, 199, 198, 166, 167, 200, 166, 200, 199, 
+    167, 168, 201, 167, 201, 200, 168, 169, 202, 168, 202, 201, 
+    169, 170, 203, 169, 203, 202, 170, 171, 204, 170, 204, 203, 
+    171, 172, 205, 171, 205, 204, 172, 173, 206, 172, 206, 205, 
+    173, 174, 207, 173, 207, 206, 174, 175, 208, 174, 208, 207, 
+    175, 176, 209, 175, 209, 208, 176, 177, 210, 176, 210, 209, 
+    177, 178, 211, 177, 211, 210, 178, 179, 212, 178, 212, 211, 
+    179, 180, 213, 179, 213, 212, 180, 181, 214, 180, 214, 213, 
+    181, 182, 215, 181, 215, 214, 182, 183, 216, 182, 216, 215, 
+    183, 184, 217, 183, 217, 216, 184, 185, 218, 184, 218, 217, 
+    185, 186, 219, 185, 219, 218, 186, 187, 220, 186, 220, 219, 
+    187, 188, 221, 187, 221, 220, 188, 189, 222, 188, 222, 221, 
+    189, 190, 223, 189, 223, 222, 190, 191, 224, 190, 224, 223, 
+    191, 192, 225, 191, 225, 224, 192, 193, 226, 192, 226, 225, 
+    193, 194, 227, 193, 227, 226, 194, 195, 228, 194, 228, 227, 
+    195, 196, 229, 195, 229, 228, 196, 197, 230, 196, 230, 229, 
+    198, 199, 232, 198, 232, 231, 199, 200, 233, 199, 233, 232, 
+    200, 201, 234, 200, 234, 233, 201, 202, 235, 201, 235, 234, 
+    202, 203, 236, 202, 236, 235, 203, 204, 237, 203, 237, 236, 
+    204, 205, 238, 204, 238, 237, 205, 206, 239, 205, 239, 238, 
+    206, 207, 240, 206, 240, 239, 207, 208, 241, 207, 241, 240, 
+    208, 209, 242, 208, 242, 241, 209, 210, 243, 209, 243, 242, 
+    210, 211, 244, 210, 244, 243, 211, 212, 245, 211, 245, 244, 
+    212, 213, 246, 212, 246, 245, 213, 214, 247, 213, 247, 246, 
+    214, 215, 248, 214, 248, 247, 215, 216, 249, 215, 249, 248, 
+    216, 217, 250, 216, 250, 249, 217, 218, 251, 217, 251, 250, 
+    218, 219, 252, 218, 252, 251, 219, 220, 253, 219, 253, 252, 
+    220, 221, 254, 220, 254, 253, 221, 222, 255, 221, 255, 254, 
+    222, 223, 256, 222, 256, 255, 223, 224, 257, 223, 257, 256, 
+    224, 225, 258, 224, 258, 257, 225, 226, 259, 225, 259, 258, 
+    226, 227, 260, 226, 260, 259, 227, 228, 261, 227, 261, 260, 
+    228, 229, 262, 228, 262, 261, 229, 230, 263, 229, 263, 262, 
+    231, 232, 265, 231, 265, 264, 232, 233, 266, 232, 266, 265, 
+    233, 234, 267, 233, 267, 266, 234, 235, 268, 234, 268, 267, 
+    235, 236, 269, 235, 269, 268, 236, 237, 270, 236, 270, 269, 
+    237, 238, 271, 237, 271, 270, 238, 239, 272, 238, 272, 271, 
+    239, 240, 273, 239, 273, 272, 240, 241, 274, 240, 274, 273, 
+    241, 242, 275, 241, 275, 274, 242, 243, 276, 242, 276, 275, 
+    243, 244, 277, 243, 277, 276, 244, 245, 278, 244, 278, 277, 
+    245, 246, 279, 245, 279, 278, 246, 247, 280, 246, 280, 279, 
+    247, 248, 281, 247, 281, 280, 248, 249, 282, 248, 282, 281, 
+    249, 250, 283, 249, 283, 282, 250, 251, 284, 250, 284, 283, 
+    251, 252, 285, 251, 285, 284, 252, 253, 286, 252, 286, 285, 
+    253, 254, 287, 253, 287, 286, 254, 255, 288, 254, 288, 287, 
+    255, 256, 289, 255, 289, 288, 256, 257, 290, 256, 290, 289, 
+    257, 258, 291, 257, 291, 290, 258, 259, 292, 258, 292, 291, 
+    259, 260, 293, 259, 293, 292, 260, 261, 294, 260, 294, 293, 
+    261, 262, 295, 261, 295, 294, 262, 263, 296, 262, 296, 295, 
+    264, 265, 298, 264, 298, 297, 265, 266, 299, 265, 299, 298, 
+    266, 267, 300, 266, 300, 299, 267, 268, 301, 267, 301, 300, 
+    268, 269, 302, 268, 302, 301, 269, 270, 303, 269, 303, 302, 
+    270, 271, 304, 270, 304, 303, 271, 272, 305, 271, 305, 304, 
+    272, 273, 306, 272, 306, 305, 273, 274, 307, 273, 307, 306, 
+    274, 275, 308, 274, 308, 307, 275, 276, 309, 275, 309, 308, 
+    276, 277, 310, 276, 310, 309, 277, 278, 311, 277, 311, 310, 
+    278, 279, 312, 278, 312, 311, 279, 280, 313, 279, 313, 312, 
+    280, 281, 314, 280, 314, 313, 281, 282, 315, 281, 315, 314, 
+    282, 283, 316, 282, 316, 315, 283, 284, 317, 283, 317, 316, 
+    284, 285, 318, 284, 318, 317, 285, 286, 319, 285, 319, 318, 
+    286, 287, 320, 286, 320, 319, 287, 288, 321, 287, 321, 320, 
+    288, 289, 322, 288, 322, 321, 289, 290, 323, 289, 323, 322, 
+    290, 291, 324, 290, 324, 323, 291, 292, 325, 291, 325, 324, 
+    292, 293, 326, 292, 326, 325, 293, 294, 327, 293, 327, 326, 
+    294, 295, 328, 294, 328, 327, 295, 296, 329, 295, 329, 328, 
+    297, 298, 331, 297, 331, 330, 298, 299, 332, 298, 332, 331, 
+    299, 300, 333, 299, 333, 332, 300, 301, 334, 300, 334, 333, 
+    301, 302, 335, 301, 335, 334, 302, 303, 336, 302, 336, 335, 
+    303, 304, 337, 303, 337, 336, 304, 305, 338, 304, 338, 337, 
+    305, 306, 339, 305, 339, 338, 306, 307, 340, 306, 340, 339, 
+    307, 308, 341, 307, 341, 340, 308, 309, 342, 308, 342, 341, 
+    309, 310, 343, 309, 343, 342, 310, 311, 344, 310, 344, 343, 
+    311, 312, 345, 311, 345, 344, 312, 313, 346, 312, 346, 345, 
+    313, 314, 347, 313, 347, 346, 314, 315, 348, 314, 348, 347, 
+    315, 316, 349, 315, 349, 348, 316, 317, 350, 316, 350, 349, 
+    317, 318, 351, 317, 351, 350, 318, 319, 352, 318, 352, 351, 
+    319, 320, 353, 319, 353, 352, 320, 321, 354, 320, 354, 353, 
+    321, 322, 355, 321, 355, 354, 322, 323, 356, 322, 356, 355, 
+    323, 324, 357, 323, 357, 356, 324, 325, 358, 324, 358, 357, 
+    325, 326, 359, 325, 359, 358, 326, 327, 360, 326, 360, 359, 
+    327, 328, 361, 327, 361, 360, 328, 329, 362, 328, 362, 361, 
+    330, 331, 364, 330, 364, 363, 331, 332, 365, 331, 365, 364, 
+    332, 333, 366, 332, 366, 365, 333, 334, 367, 333, 367, 366, 
+    334, 335, 368, 334, 368, 367, 335, 336, 369, 335, 369, 368, 
+    336, 337, 370, 336, 370, 369, 337, 338, 371, 337, 371, 370, 
+    338, 339, 372, 338, 372, 371, 339, 340, 373, 339, 373, 372, 
+    340, 341, 374, 340, 374, 373, 341, 342, 375, 341, 375, 374, 
+    342, 343, 376, 342, 376, 375, 343, 344, 377, 343, 377, 376, 
+    344, 345, 378, 344, 378, 377, 345, 346, 379, 345, 379, 378, 
+    346, 347, 380, 346, 380, 379, 347, 348, 381, 347, 381, 380, 
+    348, 349, 382, 348, 382, 381, 349, 350, 383, 349, 383, 382, 
+    350, 351, 384, 350, 384, 383, 351, 352, 385, 351, 385, 384, 
+    352, 353, 386, 352, 386, 385, 353, 354, 387, 353, 387, 386, 
+    354, 355, 388, 354, 388, 387, 355, 356, 389, 355, 389, 388, 
+    356, 357, 390, 356, 390, 389, 357, 358, 391, 357, 391, 390, 
+    358, 359, 392, 358, 392, 391, 359, 360, 393, 359, 393, 392, 
+    360, 361, 394, 360, 394, 393, 361, 362, 395, 361, 395, 394, 
+    363, 364, 397, 363, 397, 396, 364, 365, 398, 364, 398, 397, 
+    365, 366, 399, 365, 399, 398, 366, 367, 400, 366, 400, 399, 
+    367, 368, 401, 367, 401, 400, 368, 369, 402, 368, 402, 401, 
+    369, 370, 403, 369, 403, 402, 370, 371, 404, 370, 404, 403, 
+    371, 372, 405, 371, 405, 404, 372, 373, 406, 372, 406, 405, 
+    373, 374, 407, 373, 407, 406, 374, 375, 408, 374, 408, 407, 
+    375, 376, 409, 375, 409, 408, 376, 377, 410, 376, 410, 409, 
+    377, 378, 411, 377, 411, 410, 378, 379, 412, 378, 412, 411, 
+    379, 380, 413, 379, 413, 412, 380, 381, 414, 380, 414, 413, 
+    381, 382, 415, 381, 415, 414, 382, 383, 416, 382, 416, 415, 
+    383, 384, 417, 383, 417, 416, 384, 385, 418, 384, 418, 417, 
+    385, 386, 419, 385, 419, 418, 386, 387, 420, 386, 420, 419, 
+    387, 388, 421, 387, 421, 420, 388, 389, 422, 388, 422, 421, 
+    389, 390, 423, 389, 423, 422, 390, 391, 424, 390, 424, 423, 
+    391, 392, 425, 391, 425, 424, 392, 393, 426, 392, 426, 425, 
+    393, 394, 427, 393, 427, 426, 394, 395, 428, 394, 428, 427, 
+    396, 397, 430, 396, 430, 429, 397, 398, 431, 397, 431, 430, 
+    398, 399, 432, 398, 432, 431, 399, 400, 433, 399, 433, 432, 
+    400, 401, 434, 400, 434, 433, 401, 402, 435, 401, 435, 434, 
+    402, 403, 436, 402, 436, 435, 403, 404, 437, 403, 437, 436, 
+    404, 405, 438, 404, 438, 437, 405, 406, 439, 405, 439, 438, 
+    406, 407, 440, 406, 440, 439, 407, 408, 441, 407, 441, 440, 
+    408, 409, 442, 408, 442, 441, 409, 410, 443, 409, 443, 442, 
+    410, 411, 444, 410, 444, 443, 411, 412, 445, 411, 445, 444, 
+    412, 413, 446, 412, 446, 445, 413, 414, 447, 413, 447, 446, 
+    414, 415, 448, 414, 448, 447, 415, 416, 449, 415, 449, 448, 
+    416, 417, 450, 416, 450, 449, 417, 418, 451, 417, 451, 450, 
+    418, 419, 452, 418, 452, 451, 419, 420, 453, 419, 453, 452, 
+    420, 421, 454, 420, 454, 453, 421, 422, 455, 421, 455, 454, 
+    422, 423, 456, 422, 456, 455, 423, 424, 457, 423, 457, 456, 
+    424, 425, 458, 424, 458, 457, 425, 426, 459, 425, 459, 458, 
+    426, 427, 460, 426, 460, 459, 427, 428, 461, 427, 461, 460, 
+    429, 430, 463, 429, 463, 462, 430, 431, 464, 430, 464, 463, 
+    431, 432, 465, 431, 465, 464, 432, 433, 466, 432, 466, 465, 
+    433, 434, 467, 433, 467, 466, 434, 435, 468, 434, 468, 467, 
+    435, 436, 469, 435, 469, 468, 436, 437, 470, 436, 470, 469, 
+    437, 438, 471, 437, 471, 470, 438, 439, 472, 438, 472, 471, 
+    439, 440, 473, 439, 473, 472, 440, 441, 474, 440, 474, 473, 
+    441, 442, 475, 441, 475, 474, 442, 443, 476, 442, 476, 475, 
+    443, 444, 477, 443, 477, 476, 444, 445, 478, 444, 478, 477, 
+    445, 446, 479, 445, 479, 478, 446, 447, 480, 446, 480, 479, 
+    447, 448, 481, 447, 481, 480, 448, 449, 482, 448, 482, 481, 
+    449, 450, 483, 449, 483, 482, 450, 451, 484, 450, 484, 483, 
+    451, 452, 485, 451, 485, 484, 452, 453, 486, 452, 486, 485, 
+    453, 454, 487, 453, 487, 486, 454, 455, 488, 454, 488, 487, 
+    455, 456, 489, 455, 489, 488, 456, 457, 490, 456, 490, 489, 
+    457, 458, 491, 457, 491, 490, 458, 459, 492, 458, 492, 491, 
+    459, 460, 493, 459, 493, 492, 460, 461, 494, 460, 494, 493, 
+    462, 463, 496, 462, 496, 495, 463, 464, 497, 463, 497, 496, 
+    464, 465, 498, 464, 498, 497, 465, 466, 499, 465, 499, 498, 
+    466, 467, 500, 466, 500, 499, 467, 468, 501, 467, 501, 500, 
+    468, 469, 502, 468, 502, 501, 469, 470, 503, 469, 503, 502, 
+    470, 471, 504, 470, 504, 503, 471, 472, 505, 471, 505, 504, 
+    472, 473, 506, 472, 506, 505, 473, 474, 507, 473, 507, 506, 
+    474, 475, 508, 474, 508, 507, 475, 476, 509, 475, 509, 508, 
+    476, 477, 510, 476, 510, 509, 477, 478, 511, 477, 511, 510, 
+    478, 479, 512, 478, 512, 511, 479, 480, 513, 479, 513, 512, 
+    480, 481, 514, 480, 514, 513, 481, 482, 515, 481, 515, 514, 
+    482, 483, 516, 482, 516, 515, 483, 484, 517, 483, 517, 516, 
+    484, 485, 518, 484, 518, 517, 485, 486, 519, 485, 519, 518, 
+    486, 487, 520, 486, 520, 519, 487, 488, 521, 487, 521, 520, 
+    488, 489, 522, 488, 522, 521, 489, 490, 523, 489, 523, 522, 
+    490, 491, 524, 490, 524, 523, 491, 492, 525, 491, 525, 524, 
+    492, 493, 526, 492, 526, 525, 493, 494, 527, 493, 527, 526, 
+    495, 496, 529, 495, 529, 528, 496, 497, 530, 496, 530, 529, 
+    497, 498, 531, 497, 531, 530, 498, 499, 532, 498, 532, 531, 
+    499, 500, 533, 499, 533, 532, 500, 501, 534, 500, 534, 533, 
+    501, 502, 535, 501, 535, 534, 502, 503, 536, 502, 536, 535, 
+    503, 504, 537, 503, 537, 536, 504, 505, 538, 504, 538, 537, 
+    505, 506, 539, 505, 539, 538, 506, 507, 540, 506, 540, 539, 
+    507, 508, 541, 507, 541, 540, 508, 509, 542, 508, 542, 541, 
+    509, 510, 543, 509, 543, 542, 510, 511, 544, 510, 544, 543, 
+    511, 512, 545, 511, 545, 544, 512, 513, 546, 512, 546, 545, 
+    513, 514, 547, 513, 547, 546, 514, 515, 548, 514, 548, 547, 
+    515, 516, 549, 515, 549, 548, 516, 517, 550, 516, 550, 549, 
+    517, 518, 551, 517, 551, 550, 518, 519, 552, 518, 552, 551, 
+    519, 520, 553, 519, 553, 552, 520, 521, 554, 520, 554, 553, 
+    521, 522, 555, 521, 555, 554, 522, 523, 556, 522, 556, 555, 
+    523, 524, 557, 523, 557, 556, 524, 525, 558, 524, 558, 557, 
+    525, 526, 559, 525, 559, 558, 526, 527, 560, 526, 560, 559, 
+};
+
+static const UINT kInvertedSphereLod1IndexCount = 3072;
+
+static const Vertex kInvertedSphereLod2Vertices[153] = {
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.000000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.062500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.125000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.187500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, 0.000000f }, { -0.000000f, 1.000000f, -0.000000f }, { 0.250000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.312500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.375000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.437500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, 0.000000f }, { 0.000000f, 1.000000f, -0.000000f }, { 0.500000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.562500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.625000f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.687500f, 0.000000f }},
+    {{ -0.000000f, -0.500000f, -0.000000f }, { 0.000000f, 1.000000f, 0.000000f }, { 0.750000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.812500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.875000f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 0.937500f, 0.000000f }},
+    {{ 0.000000f, -0.500000f, -0.000000f }, { -0.000000f, 1.000000f, 0.000000f }, { 1.000000f, 0.000000f }},
+    {{ 0.191342f, -0.461940f, 0.000000f }, { -0.382683f, 0.923880f, -0.000000f }, { 0.000000f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, 0.073223f }, { -0.353553f, 0.923880f, -0.146447f }, { 0.062500f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, 0.135299f }, { -0.270598f, 0.923880f, -0.270598f }, { 0.125000f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, 0.176777f }, { -0.146447f, 0.923880f, -0.353553f }, { 0.187500f, 0.125000f }},
+    {{ 0.000000f, -0.461940f, 0.191342f }, { -0.000000f, 0.923880f, -0.382683f }, { 0.250000f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, 0.176777f }, { 0.146447f, 0.923880f, -0.353553f }, { 0.312500f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, 0.135299f }, { 0.270598f, 0.923880f, -0.270598f }, { 0.375000f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, 0.073223f }, { 0.353553f, 0.923880f, -0.146447f }, { 0.437500f, 0.125000f }},
+    {{ -0.191342f, -0.461940f, 0.000000f }, { 0.382683f, 0.923880f, -0.000000f }, { 0.500000f, 0.125000f }},
+    {{ -0.176777f, -0.461940f, -0.073223f }, { 0.353553f, 0.923880f, 0.146447f }, { 0.562500f, 0.125000f }},
+    {{ -0.135299f, -0.461940f, -0.135299f }, { 0.270598f, 0.923880f, 0.270598f }, { 0.625000f, 0.125000f }},
+    {{ -0.073223f, -0.461940f, -0.176777f }, { 0.146447f, 0.923880f, 0.353553f }, { 0.687500f, 0.125000f }},
+    {{ -0.000000f, -0.461940f, -0.191342f }, { 0.000000f, 0.923880f, 0.382683f }, { 0.750000f, 0.125000f }},
+    {{ 0.073223f, -0.461940f, -0.176777f }, { -0.146447f, 0.923880f, 0.353553f }, { 0.812500f, 0.125000f }},
+    {{ 0.135299f, -0.461940f, -0.135299f }, { -0.270598f, 0.923880f, 0.270598f }, { 0.875000f, 0.125000f }},
+    {{ 0.176777f, -0.461940f, -0.073223f }, { -0.353553f, 0.923880f, 0.146447f }, { 0.937500f, 0.125000f }},
+    {{ 0.191342f, -0.461940f, -0.000000f }, { -0.382683f, 0.923880f, 0.000000f }, { 1.000000f, 0.125000f }},
+    {{ 0.353553f, -0.353553f, 0.000000f }, { -0.707107f, 0.707107f, -0.000000f }, { 0.000000f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, 0.135299f }, { -0.653281f, 0.707107f, -0.270598f }, { 0.062500f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, 0.250000f }, { -0.500000f, 0.707107f, -0.500000f }, { 0.125000f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, 0.326641f }, { -0.270598f, 0.707107f, -0.653281f }, { 0.187500f, 0.250000f }},
+    {{ 0.000000f, -0.353553f, 0.353553f }, { -0.000000f, 0.707107f, -0.707107f }, { 0.250000f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, 0.326641f }, { 0.270598f, 0.707107f, -0.653281f }, { 0.312500f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, 0.250000f }, { 0.500000f, 0.707107f, -0.500000f }, { 0.375000f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, 0.135299f }, { 0.653281f, 0.707107f, -0.270598f }, { 0.437500f, 0.250000f }},
+    {{ -0.353553f, -0.353553f, 0.000000f }, { 0.707107f, 0.707107f, -0.000000f }, { 0.500000f, 0.250000f }},
+    {{ -0.326641f, -0.353553f, -0.135299f }, { 0.653281f, 0.707107f, 0.270598f }, { 0.562500f, 0.250000f }},
+    {{ -0.250000f, -0.353553f, -0.250000f }, { 0.500000f, 0.707107f, 0.500000f }, { 0.625000f, 0.250000f }},
+    {{ -0.135299f, -0.353553f, -0.326641f }, { 0.270598f, 0.707107f, 0.653281f }, { 0.687500f, 0.250000f }},
+    {{ -0.000000f, -0.353553f, -0.353553f }, { 0.000000f, 0.707107f, 0.707107f }, { 0.750000f, 0.250000f }},
+    {{ 0.135299f, -0.353553f, -0.326641f }, { -0.270598f, 0.707107f, 0.653281f }, { 0.812500f, 0.250000f }},
+    {{ 0.250000f, -0.353553f, -0.250000f }, { -0.500000f, 0.707107f, 0.500000f }, { 0.875000f, 0.250000f }},
+    {{ 0.326641f, -0.353553f, -0.135299f }, { -0.653281f, 0.707107f, 0.270598f }, { 0.937500f, 0.250000f }},
+    {{ 0.353553f, -0.353553f, -0.000000f }, { -0.707107f, 0.707107f, 0.000000f }, { 1.000000f, 0.250000f }},
+    {{ 0.461940f, -0.191342f, 0.000000f }, { -0.923880f, 0.382683f, -0.000000f }, { 0.000000f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, 0.176777f }, { -0.853553f, 0.382683f, -0.353553f }, { 0.062500f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, 0.326641f }, { -0.653281f, 0.382683f, -0.653281f }, { 0.125000f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, 0.426777f }, { -0.353553f, 0.382683f, -0.853553f }, { 0.187500f, 0.375000f }},
+    {{ 0.000000f, -0.191342f, 0.461940f }, { -0.000000f, 0.382683f, -0.923880f }, { 0.250000f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, 0.426777f }, { 0.353553f, 0.382683f, -0.853553f }, { 0.312500f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, 0.326641f }, { 0.653281f, 0.382683f, -0.653281f }, { 0.375000f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, 0.176777f }, { 0.853553f, 0.382683f, -0.353553f }, { 0.437500f, 0.375000f }},
+    {{ -0.461940f, -0.191342f, 0.000000f }, { 0.923880f, 0.382683f, -0.000000f }, { 0.500000f, 0.375000f }},
+    {{ -0.426777f, -0.191342f, -0.176777f }, { 0.853553f, 0.382683f, 0.353553f }, { 0.562500f, 0.375000f }},
+    {{ -0.326641f, -0.191342f, -0.326641f }, { 0.653281f, 0.382683f, 0.653281f }, { 0.625000f, 0.375000f }},
+    {{ -0.176777f, -0.191342f, -0.426777f }, { 0.353553f, 0.382683f, 0.853553f }, { 0.687500f, 0.375000f }},
+    {{ -0.000000f, -0.191342f, -0.461940f }, { 0.000000f, 0.382683f, 0.923880f }, { 0.750000f, 0.375000f }},
+    {{ 0.176777f, -0.191342f, -0.426777f }, { -0.353553f, 0.382683f, 0.853553f }, { 0.812500f, 0.375000f }},
+    {{ 0.326641f, -0.191342f, -0.326641f }, { -0.653281f, 0.382683f, 0.653281f }, { 0.875000f, 0.375000f }},
+    {{ 0.426777f, -0.191342f, -0.176777f }, { -0.853553f, 0.382683f, 0.353553f }, { 0.937500f, 0.375000f }},
+    {{ 0.461940f, -0.191342f, -0.000000f }, { -0.923880f, 0.382683f, 0.000000f }, { 1.000000f, 0.375000f }},
+    {{ 0.500000f, 0.000000f, 0.000000f }, { -1.000000f, -0.000000f, -0.000000f }, { 0.000000f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, 0.191342f }, { -0.923880f, -0.000000f, -0.382683f }, { 0.062500f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, 0.353553f }, { -0.707107f, -0.000000f, -0.707107f }, { 0.125000f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, 0.461940f }, { -0.382683f, -0.000000f, -0.923880f }, { 0.187500f, 0.500000f }},
+    {{ 0.000000f, 0.000000f, 0.500000f }, { -0.000000f, -0.000000f, -1.000000f }, { 0.250000f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, 0.461940f }, { 0.382683f, -0.000000f, -0.923880f }, { 0.312500f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, 0.353553f }, { 0.707107f, -0.000000f, -0.707107f }, { 0.375000f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, 0.191342f }, { 0.923880f, -0.000000f, -0.382683f }, { 0.437500f, 0.500000f }},
+    {{ -0.500000f, 0.000000f, 0.000000f }, { 1.000000f, -0.000000f, -0.000000f }, { 0.500000f, 0.500000f }},
+    {{ -0.461940f, 0.000000f, -0.191342f }, { 0.923880f, -0.000000f, 0.382683f }, { 0.562500f, 0.500000f }},
+    {{ -0.353553f, 0.000000f, -0.353553f }, { 0.707107f, -0.000000f, 0.707107f }, { 0.625000f, 0.500000f }},
+    {{ -0.191342f, 0.000000f, -0.461940f }, { 0.382683f, -0.000000f, 0.923880f }, { 0.687500f, 0.500000f }},
+    {{ -0.000000f, 0.000000f, -0.500000f }, { 0.000000f, -0.000000f, 1.000000f }, { 0.750000f, 0.500000f }},
+    {{ 0.191342f, 0.000000f, -0.461940f }, { -0.382683f, -0.000000f, 0.923880f }, { 0.812500f, 0.500000f }},
+    {{ 0.353553f, 0.000000f, -0.353553f }, { -0.707107f, -0.000000f, 0.707107f }, { 0.875000f, 0.500000f }},
+    {{ 0.461940f, 0.000000f, -0.191342f }, { -0.923880f, -0.000000f, 0.382683f }, { 0.937500f, 0.500000f }},
+    {{ 0.500000f, 0.000000f, -0.000000f }, { -1.000000f, -0.000000f, 0.000000f }, { 1.000000f, 0.500000f }},
+    {{ 0.461940f, 0.191342f, 0.000000f }, { -0.923880f, -0.382683f, -0.000000f }, { 0.000000f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, 0.176777f }, { -0.853553f, -0.382683f, -0.353553f }, { 0.062500f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, 0.326641f }, { -0.653281f, -0.382683f, -0.653281f }, { 0.125000f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, 0.426777f }, { -0.353553f, -0.382683f, -0.853553f }, { 0.187500f, 0.625000f }},
+    {{ 0.000000f, 0.191342f, 0.461940f }, { -0.000000f, -0.382683f, -0.923880f }, { 0.250000f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, 0.426777f }, { 0.353553f, -0.382683f, -0.853553f }, { 0.312500f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, 0.326641f }, { 0.653281f, -0.382683f, -0.653281f }, { 0.375000f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, 0.176777f }, { 0.853553f, -0.382683f, -0.353553f }, { 0.437500f, 0.625000f }},
+    {{ -0.461940f, 0.191342f, 0.000000f }, { 0.923880f, -0.382683f, -0.000000f }, { 0.500000f, 0.625000f }},
+    {{ -0.426777f, 0.191342f, -0.176777f }, { 0.853553f, -0.382683f, 0.353553f }, { 0.562500f, 0.625000f }},
+    {{ -0.326641f, 0.191342f, -0.326641f }, { 0.653281f, -0.382683f, 0.653281f }, { 0.625000f, 0.625000f }},
+    {{ -0.176777f, 0.191342f, -0.426777f }, { 0.353553f, -0.382683f, 0.853553f }, { 0.687500f, 0.625000f }},
+    {{ -0.000000f, 0.191342f, -0.461940f }, { 0.000000f, -0.382683f, 0.923880f }, { 0.750000f, 0.625000f }},
+    {{ 0.176777f, 0.191342f, -0.426777f }, { -0.353553f, -0.382683f, 0.853553f }, { 0.812500f, 0.625000f }},
+    {{ 0.326641f, 0.191342f, -0.326641f }, { -0.653281f, -0.382683f, 0.653281f }, { 0.875000f, 0.625000f }},
+    {{ 0.426777f, 0.191342f, -0.176777f }, { -0.853553f, -0.382683f, 0.353553f }, { 0.937500f, 0.625000f }},
+    {{ 0.461940f, 0.191342f, -0.000000f }, { -0.923880f, -0.382683f, 0.000000f }, { 1.000000f, 0.625000f }},
+    {{ 0.353553f, 0.353553f, 0.000000f }, { -0.707107f, -0.707107f, -0.000000f }, { 0.000000f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, 0.135299f }, { -0.653281f, -0.707107f, -0.270598f }, { 0.062500f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, 0.250000f }, { -0.500000f, -0.707107f, -0.500000f }, { 0.125000f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, 0.326641f }, { -0.270598f, -0.707107f, -0.653281f }, { 0.187500f, 0.750000f }},
+    {{ 0.000000f, 0.353553f, 0.353553f }, { -0.000000f, -0.707107f, -0.707107f }, { 0.250000f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, 0.326641f }, { 0.270598f, -0.707107f, -0.653281f }, { 0.312500f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, 0.250000f }, { 0.500000f, -0.707107f, -0.500000f }, { 0.375000f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, 0.135299f }, { 0.653281f, -0.707107f, -0.270598f }, { 0.437500f, 0.750000f }},
+    {{ -0.353553f, 0.353553f, 0.000000f }, { 0.707107f, -0.707107f, -0.000000f }, { 0.500000f, 0.750000f }},
+    {{ -0.326641f, 0.353553f, -0.135299f }, { 0.653281f, -0.707107f, 0.270598f }, { 0.562500f, 0.750000f }},
+    {{ -0.250000f, 0.353553f, -0.250000f }, { 0.500000f, -0.707107f, 0.500000f }, { 0.625000f, 0.750000f }},
+    {{ -0.135299f, 0.353553f, -0.326641f }, { 0.270598f, -0.707107f, 0.653281f }, { 0.687500f, 0.750000f }},
+    {{ -0.000000f, 0.353553f, -0.353553f }, { 0.000000f, -0.707107f, 0.707107f }, { 0.750000f, 0.750000f }},
+    {{ 0.135299f, 0.353553f, -0.326641f }, { -0.270598f, -0.707107f, 0.653281f }, { 0.812500f, 0.750000f }},
+    {{ 0.250000f, 0.353553f, -0.250000f }, { -0.500000f, -0.707107f, 0.500000f }, { 0.875000f, 0.750000f }},
+    {{ 0.326641f, 0.353553f, -0.135299f }, { -0.653281f, -0.707107f, 0.270598f }, { 0.937500f, 0.750000f }},
+    {{ 0.353553f, 0.353553f, -0.000000f }, { -0.707107f, -0.707107f, 0.000000f }, { 1.000000f, 0.750000f }},
+    {{ 0.191342f, 0.461940f, 0.000000f }, { -0.382683f, -0.923880f, -0.000000f }, { 0.000000f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, 0.073223f }, { -0.353553f, -0.923880f, -0.146447f }, { 0.062500f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, 0.135299f }, { -0.270598f, -0.923880f, -0.270598f }, { 0.125000f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, 0.176777f }, { -0.146447f, -0.923880f, -0.353553f }, { 0.187500f, 0.875000f }},
+    {{ 0.000000f, 0.461940f, 0.191342f }, { -0.000000f, -0.923880f, -0.382683f }, { 0.250000f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, 0.176777f }, { 0.146447f, -0.923880f, -0.353553f }, { 0.312500f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, 0.135299f }, { 0.270598f, -0.923880f, -0.270598f }, { 0.375000f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, 0.073223f }, { 0.353553f, -0.923880f, -0.146447f }, { 0.437500f, 0.875000f }},
+    {{ -0.191342f, 0.461940f, 0.000000f }, { 0.382683f, -0.923880f, -0.000000f }, { 0.500000f, 0.875000f }},
+    {{ -0.176777f, 0.461940f, -0.073223f }, { 0.353553f, -0.923880f, 0.146447f }, { 0.562500f, 0.875000f }},
+    {{ -0.135299f, 0.461940f, -0.135299f }, { 0.270598f, -0.923880f, 0.270598f }, { 0.625000f, 0.875000f }},
+    {{ -0.073223f, 0.461940f, -0.176777f }, { 0.146447f, -0.923880f, 0.353553f }, { 0.687500f, 0.875000f }},
+    {{ -0.000000f, 0.461940f, -0.191342f }, { 0.000000f, -0.923880f, 0.382683f }, { 0.750000f, 0.875000f }},
+    {{ 0.073223f, 0.461940f, -0.176777f }, { -0.146447f, -0.923880f, 0.353553f }, { 0.812500f, 0.875000f }},
+    {{ 0.135299f, 0.461940f, -0.135299f }, { -0.270598f, -0.923880f, 0.270598f }, { 0.875000f, 0.875000f }},
+    {{ 0.176777f, 0.461940f, -0.073223f }, { -0.353553f, -0.923880f, 0.146447f }, { 0.937500f, 0.875000f }},
+    {{ 0.191342f, 0.461940f, -0.000000f }, { -0.382683f, -0.923880f, 0.000000f }, { 1.000000f, 0.875000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.000000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.062500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.125000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.187500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, 0.000000f }, { -0.000000f, -1.000000f, -0.000000f }, { 0.250000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.312500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.375000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.437500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, 0.000000f }, { 0.000000f, -1.000000f, -0.000000f }, { 0.500000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.562500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.625000f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.687500f, 1.000000f }},
+    {{ -0.000000f, 0.500000f, -0.000000f }, { 0.000000f, -1.000000f, 0.000000f }, { 0.750000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.812500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.875000f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 0.937500f, 1.000000f }},
+    {{ 0.000000f, 0.500000f, -0.000000f }, { -0.000000f, -1.000000f, 0.000000f }, { 1.000000f, 1.000000f }},
+};
+
+static const UINT kInvertedSphereLod2VertexCount = 153;
+
+static const uint32_t kInvertedSphereLod2Indices[768] = {
+    0, 1, 18, 0, 18, 17, 1, 2, 19, 1, 19, 18, 
+    2, 3, 20, 2, 20, 19, 3, 4, 21, 3, 21, 20, 
+    4, 5, 22, 4, 22, 21, 5, 6, 23, 5, 23, 22, 
+    6, 7, 24, 6, 24, 23, 7, 8, 25, 7, 25, 24, 
+    8, 9, 26, 8, 26, 25, 9, 10, 27, 9, 27, 26, 
+    10, 11, 28, 10, 28, 27, 11, 12, 29, 11, 29, 28, 
+    12, 13, 30, 12, 30, 29, 13, 14, 31, 13, 31, 30, 
+    14, 15, 32, 14, 32, 31, 15, 16, 33, 15, 33, 32, 
+    17, 18, 35, 17, 35, 34, 18, 19, 36, 18, 36, 35, 
+    19, 20, 37, 19, 37, 36, 20, 21, 38, 20, 38, 37, 
+    21, 22, 39, 21, 39, 38, 22, 23, 40, 22, 40, 39, 
+    23, 24, 41, 23, 41, 40, 24, 25, 42, 24, 42, 41, 
+    25, 26, 43, 25, 43, 42, 26, 27, 44, 26, 44, 43, 
+    27, 28, 45, 27, 45, 44, 28, 29, 46, 28, 46, 45, 
+    29, 30, 47, 29, 47, 46, 30, 31, 48, 30, 48, 47, 
+    31, 32, 49, 31, 49, 48, 32, 33, 50, 32, 50, 49, 
+    34, 35, 52, 34, 52, 51, 35, 36, 53, 35, 53, 52, 
+    36, 37, 54, 36, 54, 53, 37, 38, 55, 37, 55, 54, 
+    38, 39, 56, 38, 56, 55, 39, 40, 57, 39, 57, 56, 
+    40, 41, 58, 40, 58, 57, 41, 42, 59, 41, 59, 58, 
+    42, 43, 60, 42, 60, 59, 43, 44, 61, 43, 61, 60, 
+    44, 45, 62, 44, 62, 61, 45, 46, 63, 45, 63, 62, 
+    46, 47, 64, 46, 64, 63, 47, 48, 65, 47, 65, 64, 
+    48, 49, 66, 48, 66, 65, 49, 50, 67, 49, 67, 66, 
+    51, 52, 69, 51, 69, 68, 52, 53, 70, 52, 70, 69, 
+    53, 54, 71, 53, 71, 70, 54, 55, 72, 54, 72, 71, 
+    55, 56, 73, 55, 73, 72, 56, 57, 74, 56, 74, 73, 
+    57, 58, 75, 57, 75, 74, 58, 59, 76, 58, 76, 75, 
+    59, 60, 77, 59, 77, 76, 60, 61, 78, 60, 78, 77, 
+    61, 62, 79, 61, 79, 78, 62, 63, 80, 62, 80, 79, 
+    63, 64, 81, 63, 81, 80, 64, 65, 82, 64, 82, 81, 
+    65, 66, 83, 65, 83, 82, 66, 67, 84, 66, 84, 83, 
+    68, 69, 86, 68, 86, 85, 69, 70, 87, 69, 87, 86, 
+    70, 71, 88, 70, 88, 87, 71, 72, 89, 71, 89, 88, 
+    72, 73, 90, 72, 90, 89, 73, 74, 91, 73, 91, 90, 
+    74, 75, 92, 74, 92, 91, 75, 76, 93, 75, 93, 92, 
+    76, 77, 94, 76, 94, 93, 77, 78, 95, 77, 95, 94, 
+    78, 79, 96, 78, 96, 95, 79, 80, 97, 79, 97, 96, 
+    80, 81, 98, 80, 98, 97, 81, 82, 99, 81, 99, 98, 
+    82, 83, 100, 82, 100, 99, 83, 84, 101, 83, 101, 100, 
+    85, 86, 103, 85, 103, 102, 86, 87, 104, 86, 104, 103, 
+    87, 88, 105, 87, 105, 104, 88, 89, 106, 88, 106, 105, 
+    89, 90, 107, 89, 107, 106, 90, 91, 108, 90, 108, 107, 
+    91, 92, 109, 91, 109, 108, 92, 93, 110, 92, 110, 109, 
+    93, 94, 111, 93, 111, 110, 94, 95, 112, 94, 112, 111, 
+    95, 96, 113, 95, 113, 112, 96, 97, 114, 96, 114, 113, 
+    97, 98, 115, 97, 115, 114, 98, 99, 116, 98, 116, 115, 
+    99, 100, 117, 99, 117, 116, 100, 101, 118, 100, 118, 117, 
+    102, 103, 120, 102, 120, 119, 103, 104, 121, 103, 121, 120, 
+    104, 105, 122, 104, 122, 121, 105, 106, 123, 105, 123, 122, 
+    106, 107, 124, 106, 124, 123, 107, 108, 125, 107, 125, 124, 
+    108, 109, 126, 108, 126, 125, 109, 110, 127, 109, 127, 126, 
+    110, 111, 128, 110, 128, 127, 111, 112, 129, 111, 129, 128, 
+    112, 113, 130, 112, 130, 129, 113, 114, 131, 113, 131, 130, 
+    114, 115, 132, 114, 132, 131, 115, 116, 133, 115, 133, 132, 
+    116, 117, 134, 116, 134, 133, 117, 118, 135, 117, 135, 134, 
+    119, 120, 137, 119, 137, 136, 120, 121, 138, 120, 138, 137, 
+    121, 122, 139, 121, 139, 138, 122, 123, 140, 122, 140, 139, 
+    123, 124, 141, 123, 141, 140, 124, 125, 142, 124, 142, 141, 
+    125, 126, 143, 125, 143, 142, 126, 127, 144, 126, 144, 143, 
+    127, 128, 145, 127, 145, 144, 128, 129, 146, 128, 146, 145, 
+    129, 130, 147, 129, 147, 146, 130, 131, 148, 130, 148, 147, 
+    131, 132, 149, 131, 149, 148, 132, 133, 150, 132, 150, 149, 
+    133, 134, 151, 133, 151, 150, 134, 135, 152, 134, 152, 151, 
+};
+
+static const UINT kInvertedSphereLod2IndexCount = 768;
+
+// Lookup table - order matches PrimitiveType
+static const PrimitiveMeshData kPrimitiveMeshData[PRIMITIVE_COUNT] =
+{
+    { kCubeVertices, kCubeVertexCount, kCubeIndices, kCubeIndexCount },
+    { kCylinderVertices, kCylinderVertexCount, kCylinderIndices, kCylinderIndexCount },
+    { kPrismVertices, kPrismVertexCount, kPrismIndices, kPrismIndexCount },
+    { kSphereVertices, kSphereVertexCount, kSphereIndices, kSphereIndexCount },
+    { kInvertedSphereVertices, kInvertedSphereVertexCount, kInvertedSphereIndices, kInvertedSphereIndexCount },
+};
+
+// Levels of detail - order matches PrimitiveType, finest first
+#define PRIMITIVE_MAX_LODS 3
+
+static const UINT kPrimitiveLodCount[PRIMITIVE_COUNT] =
+{
+    1,
+    3,
+    1,
+    3,
+    3,
 };
 
-// Display names - order matches PrimitiveType
-static const char* g_primitiveNames[PRIMITIVE_COUNT] =
+static const PrimitiveMeshData kPrimitiveLodMeshData[PRIMITIVE_COUNT][PRIMITIVE_MAX_LODS] =
 {
-    "Cube",
-    "Cylinder",
-    "Prism",
-    "Sphere",
-    "Inverted Sphere",
+    { { kCubeVertices, kCubeVertexCount, kCubeIndices, kCubeIndexCount }, { nullptr, 0, nullptr, 0 }, { nullptr, 0, nullptr, 0 } },
+    { { kCylinderVertices, kCylinderVertexCount, kCylinderIndices, kCylinderIndexCount }, { kCylinderLod1Vertices, kCylinderLod1VertexCount, kCylinderLod1Indices, kCylinderLod1IndexCount }, { kCylinderLod2Vertices, kCylinderLod2VertexCount, kCylinderLod2Indices, kCylinderLod2IndexCount } },
+    { { kPrismVertices, kPrismVertexCount, kPrismIndices, kPrismIndexCount }, { nullptr, 0, nullptr, 0 }, { nullptr, 0, nullptr, 0 } },
+    { { kSphereVertices, kSphereVertexCount, kSphereIndices, kSphereIndexCount }, { kSphereLod1Vertices, kSphereLod1VertexCount, kSphereLod1Indices, kSphereLod1IndexCount }, { kSphereLod2Vertices, kSphereLod2VertexCount, kSphereLod2Indices, kSphereLod2IndexCount } },
+    { { kInvertedSphereVertices, kInvertedSphereVertexCount, kInvertedSphereIndices, kInvertedSphereIndexCount }, { kInvertedSphereLod1Vertices, kInvertedSphereLod1VertexCount, kInvertedSphereLod1Indices, kInvertedSphereLod1IndexCount }, { kInvertedSphereLod2Vertices, kInvertedSphereLod2VertexCount, kInvertedSphereLod2Indices, kInvertedSphereLod2IndexCount } },
 };
 
@@ -0,0 +1,29 @@
+//------------------------------------------------------------------------
+// GENERATED PRIMITIVE TYPES – DO NOT EDIT
+//   This file was automatically generated.
+//   by meta_mesh.py
+//   Generated: 2026-10-17 03:10:09
+//------------------------------------------------------------------------
+
+#pragma once
+#include <stdint.h>
+
+enum PrimitiveType : uint8_t
+{
+    PRIMITIVE_CUBE,
+    PRIMITIVE_CYLINDER,
+    PRIMITIVE_PRISM,
+    PRIMITIVE_SPHERE,
+    PRIMITIVE_INVERTED_SPHERE,
+    PRIMITIVE_COUNT
+};
+
+// Display names - order matches PrimitiveType
+static const char* g_primitiveNames[PRIMITIVE_COUNT] =
+{
+    "Cube",
+    "Cylinder",
+    "Prism",
+    "Sphere",
+    "Inverted Sphere",
+};
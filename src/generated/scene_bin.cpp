@@ -0,0 +1,203 @@
+//------------------------------------------------------------------------
+// GENERATED – DO NOT EDIT
+//   This file was automatically generated.
+//   by meta_scene_bin.py
+//   Generated: 2026-10-17 03:17:10
+//------------------------------------------------------------------------
+
+
+#include "src/scene_data.h"
+#include "primitive_types.h"
+#include "render_pipeline_data.h"
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+
+// baked with: python meta_scene_bin.py (see the layout description at the top of that script)
+#define SCENE_BIN_MAGIC 0x424E4353u
+#define SCENE_BIN_VERSION 2u
+#define SCENE_BIN_SCHEMA_HASH 0x88AA296CF3DB1313ull
+
+enum SceneBinSectionId
+{
+    SCENE_BIN_POS,
+    SCENE_BIN_ROT,
+    SCENE_BIN_SCALE,
+    SCENE_BIN_NAMETAG,
+    SCENE_BIN_PREFAB,
+    SCENE_BIN_PREFAB_NAME,
+    SCENE_BIN_PREFAB_OBJECT_TYPE,
+    SCENE_BIN_PREFAB_PIPELINE,
+    SCENE_BIN_PREFAB_PRIMITIVE_TYPE,
+    SCENE_BIN_PREFAB_ASSET_PATH,
+    SCENE_BIN_PREFAB_PARAM,
+    SCENE_BIN_PREFAB_BASE,
+    SCENE_BIN_PREFAB_OVERRIDE_MASK,
+    SCENE_BIN_STRINGS,
+    SCENE_BIN_SECTION_COUNT
+};
+
+enum SceneBinCount
+{
+    SCENE_BIN_COUNT_OBJECTS, // one element per object
+    SCENE_BIN_COUNT_PREFABS, // one element per prefab
+    SCENE_BIN_COUNT_BYTES,   // variable size
+};
+
+static const uint32_t g_sceneBinElementSize[SCENE_BIN_SECTION_COUNT] = {12, 16, 12, 4, 4, 4, 1, 1, 1, 4, 4, 4, 4, 1};
+static const SceneBinCount g_sceneBinElementCount[SCENE_BIN_SECTION_COUNT] = {SCENE_BIN_COUNT_OBJECTS, SCENE_BIN_COUNT_OBJECTS, SCENE_BIN_COUNT_OBJECTS, SCENE_BIN_COUNT_OBJECTS, SCENE_BIN_COUNT_OBJECTS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_PREFABS, SCENE_BIN_COUNT_BYTES};
+
+struct SceneBinSection
+{
+    uint32_t offset; // bytes from the start of the file
+    uint32_t size;   // bytes
+};
+
+struct SceneBinHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t schemaHash;
+    uint32_t objectCount;
+    uint32_t prefabCount;
+    uint32_t fileSize;
+    SceneBinSection sections[SCENE_BIN_SECTION_COUNT];
+};
+
+// typed pointers straight into the loaded file, no copies
+struct SceneBinView
+{
+    uint32_t objectCount;
+    const DirectX::XMFLOAT3* pos;
+    const DirectX::XMFLOAT4* rot;
+    const DirectX::XMFLOAT3* scale;
+    const uint32_t* nametag;
+    const uint32_t* prefab;
+
+    uint32_t prefabCount;
+    const uint32_t* prefabName;
+    const uint8_t* prefabObjectType;
+    const uint8_t* prefabPipeline;
+    const uint8_t* prefabPrimitiveType;
+    const uint32_t* prefabAssetPath;
+    const uint32_t* prefabParam;
+    const uint32_t* prefabBase;
+    const uint32_t* prefabOverrideMask;
+
+    const char* strings;
+    uint32_t stringsSize;
+};
+
+// ------------------------------------------------------------
+// Validate the header and fix up the section pointers (returns 1 on success, 0 on failure).
+// the file is little-endian, same as every platform we build for, so there is no byte swapping
+// ------------------------------------------------------------
+int scene_bin_map(const void* data, size_t size, SceneBinView* view) {
+    if (!data || size < sizeof(SceneBinHeader)) return 0;
+    const uint8_t* base = (const uint8_t*)data;
+    const SceneBinHeader* header = (const SceneBinHeader*)base;
+    if (header->magic != SCENE_BIN_MAGIC || header->version != SCENE_BIN_VERSION) return 0;
+    if (header->schemaHash != SCENE_BIN_SCHEMA_HASH) return 0; // baked against different enums/layout, rebake
+    if (header->fileSize != size) return 0;
+
+    const void* sections[SCENE_BIN_SECTION_COUNT];
+    for (int s = 0; s < SCENE_BIN_SECTION_COUNT; ++s) {
+        const SceneBinSection& sec = header->sections[s];
+        if ((uint64_t)sec.offset + sec.size > size || (sec.offset % 16) != 0) return 0;
+        uint64_t count = g_sceneBinElementCount[s] == SCENE_BIN_COUNT_OBJECTS ? header->objectCount : header->prefabCount;
+        if (g_sceneBinElementCount[s] != SCENE_BIN_COUNT_BYTES && (uint64_t)sec.size != count * g_sceneBinElementSize[s]) return 0;
+        sections[s] = base + sec.offset;
+    }
+
+    const SceneBinSection& strings = header->sections[SCENE_BIN_STRINGS];
+    if (strings.size == 0 || base[strings.offset + strings.size - 1] != '\0') return 0; // every string is terminated inside the pool
+
+    view->objectCount = header->objectCount;
+    view->pos = (const DirectX::XMFLOAT3*)sections[SCENE_BIN_POS];
+    view->rot = (const DirectX::XMFLOAT4*)sections[SCENE_BIN_ROT];
+    view->scale = (const DirectX::XMFLOAT3*)sections[SCENE_BIN_SCALE];
+    view->nametag = (const uint32_t*)sections[SCENE_BIN_NAMETAG];
+    view->prefab = (const uint32_t*)sections[SCENE_BIN_PREFAB];
+    view->prefabCount = header->prefabCount;
+    view->prefabName = (const uint32_t*)sections[SCENE_BIN_PREFAB_NAME];
+    view->prefabObjectType = (const uint8_t*)sections[SCENE_BIN_PREFAB_OBJECT_TYPE];
+    view->prefabPipeline = (const uint8_t*)sections[SCENE_BIN_PREFAB_PIPELINE];
+    view->prefabPrimitiveType = (const uint8_t*)sections[SCENE_BIN_PREFAB_PRIMITIVE_TYPE];
+    view->prefabAssetPath = (const uint32_t*)sections[SCENE_BIN_PREFAB_ASSET_PATH];
+    view->prefabParam = (const uint32_t*)sections[SCENE_BIN_PREFAB_PARAM];
+    view->prefabBase = (const uint32_t*)sections[SCENE_BIN_PREFAB_BASE];
+    view->prefabOverrideMask = (const uint32_t*)sections[SCENE_BIN_PREFAB_OVERRIDE_MASK];
+    view->strings = (const char*)sections[SCENE_BIN_STRINGS];
+    view->stringsSize = strings.size;
+    return 1;
+}
+
+// pool offset -> StringId, each pool string is interned once however many prefabs/objects use it
+static StringId scene_bin_string(const SceneBinView& view, std::vector<StringId>& ids, uint32_t offset) {
+    if (offset >= view.stringsSize) return STRING_ID_EMPTY;
+    if (ids[offset] == UINT32_MAX) ids[offset] = StringIntern(view.strings + offset);
+    return ids[offset];
+}
+
+// ------------------------------------------------------------
+// scene.bin → Scene (returns 1 on success, 0 on failure).
+// hot streams are bulk copied, the prefab table is small and built element by element, per object only the nametag
+// ------------------------------------------------------------
+int scene_from_bin(const void* data, size_t size, Scene* scene) {
+    SceneBinView view;
+    if (!scene_bin_map(data, size, &view)) return 0;
+    int n = (int)view.objectCount;
+
+    // enum bytes index straight into name tables later and ids index the prefab table, reject anything out of range up front
+    for (uint32_t p = 0; p < view.prefabCount; ++p) {
+        if (view.prefabObjectType[p] >= OBJECT_COUNT || view.prefabPipeline[p] >= RENDER_COUNT || view.prefabPrimitiveType[p] >= PRIMITIVE_COUNT) return 0;
+        uint32_t base = view.prefabBase[p];
+        if (base != SCENE_PREFAB_NONE && (base >= view.prefabCount || view.prefabBase[base] != SCENE_PREFAB_NONE)) return 0;
+    }
+    for (int i = 0; i < n; ++i) {
+        if (view.prefab[i] >= view.prefabCount) return 0;
+    }
+
+    SceneClear(*scene);
+    std::vector<StringId> ids(view.stringsSize, UINT32_MAX);
+    for (uint32_t p = 0; p < view.prefabCount; ++p) {
+        ScenePrefab prefab = ScenePrefabDefault();
+        prefab.name = scene_bin_string(view, ids, view.prefabName[p]);
+        prefab.objectType = (ObjectType)view.prefabObjectType[p];
+        prefab.pipeline = (RenderPipeline)view.prefabPipeline[p];
+        prefab.primitiveType = (PrimitiveType)view.prefabPrimitiveType[p];
+        prefab.base = view.prefabBase[p];
+        prefab.overrideMask = view.prefabOverrideMask[p];
+        StringId path = scene_bin_string(view, ids, view.prefabAssetPath[p]);
+        switch (prefab.objectType) {
+            case OBJECT_HEIGHTFIELD:
+                prefab.data.heightfield.pathToHeightmap = path;
+                prefab.data.heightfield.width = view.prefabParam[p];
+                break;
+            case OBJECT_LOADED_MODEL:
+                prefab.data.loaded_model.pathTo = path;
+                break;
+            case OBJECT_SKY_SPHERE:
+                prefab.data.sky_sphere.pathToTexture = path;
+                break;
+            case OBJECT_WATER:
+                memcpy(&prefab.data.water.choppiness, &view.prefabParam[p], sizeof(float));
+                break;
+            default:
+                break;
+        }
+        ScenePrefabAdd(*scene, prefab);
+    }
+
+    SceneReserve(*scene, n);
+    for (int i = 0; i < n; ++i)
+        SceneAddObject(*scene, view.prefab[i]);
+    if (n == 0) return 1;
+
+    memcpy(scene->pos.data(), view.pos, n * sizeof(DirectX::XMFLOAT3));
+    memcpy(scene->rot.data(), view.rot, n * sizeof(DirectX::XMFLOAT4));
+    memcpy(scene->scale.data(), view.scale, n * sizeof(DirectX::XMFLOAT3));
+    for (int i = 0; i < n; ++i)
+        scene->info[i].nametag = scene_bin_string(view, ids, view.nametag[i]);
+    return 1;
+}
@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------
+// GENERATED – DO NOT EDIT
+//   This file was automatically generated.
+//   by meta_scene_json.py
+//   Generated: 2026-10-17 03:17:10
+//------------------------------------------------------------------------
+
+
+#pragma once
+#include "src/scene_data.h"
+
+// instance fields first, SCENE_FIELD_PREFAB_NAME and everything after it live in the prefab.
+// SCENE_FIELD_DATA is the whole type specific union, the ones after it are single members of it
+enum SceneField : uint16_t
+{
+    SCENE_FIELD_POS,
+    SCENE_FIELD_ROT,
+    SCENE_FIELD_SCALE,
+    SCENE_FIELD_PREFAB,
+    SCENE_FIELD_NAMETAG,
+    SCENE_FIELD_PREFAB_NAME,
+    SCENE_FIELD_OBJECT_TYPE,
+    SCENE_FIELD_PIPELINE,
+    SCENE_FIELD_PRIMITIVE_TYPE,
+    SCENE_FIELD_DATA,
+    SCENE_FIELD_HEIGHTFIELD_PATHTOHEIGHTMAP,
+    SCENE_FIELD_HEIGHTFIELD_WIDTH,
+    SCENE_FIELD_LOADED_MODEL_PATHTO,
+    SCENE_FIELD_SKY_SPHERE_PATHTOTEXTURE,
+    SCENE_FIELD_WATER_CHOPPINESS,
+    SCENE_FIELD_COUNT
+};
+
+#define SCENE_FIELD_FIRST_PREFAB SCENE_FIELD_PREFAB_NAME
+
+struct SceneFieldInfo
+{
+    const char *name; // json key, variant members as "heightfieldData.width"
+    uint32_t size;
+};
+
+static const SceneFieldInfo g_sceneFields[SCENE_FIELD_COUNT] = {
+    {"pos", sizeof(DirectX::XMFLOAT3)},
+    {"rot", sizeof(DirectX::XMFLOAT4)},
+    {"scale", sizeof(DirectX::XMFLOAT3)},
+    {"prefab", sizeof(uint32_t)},
+    {"nametag", sizeof(StringId)},
+    {"name", sizeof(StringId)},
+    {"objectType", sizeof(ObjectType)},
+    {"pipeline", sizeof(RenderPipeline)},
+    {"primitiveData.primitiveType", sizeof(PrimitiveType)},
+    {"data", sizeof(SceneObjectData)},
+    {"heightfieldData.pathToHeightmap", sizeof(((SceneObjectData *)0)->heightfield.pathToHeightmap)},
+    {"heightfieldData.width", sizeof(((SceneObjectData *)0)->heightfield.width)},
+    {"loaded_modelData.pathTo", sizeof(((SceneObjectData *)0)->loaded_model.pathTo)},
+    {"sky_sphereData.pathToTexture", sizeof(((SceneObjectData *)0)->sky_sphere.pathToTexture)},
+    {"waterData.choppiness", sizeof(((SceneObjectData *)0)->water.choppiness)},
+};
+
+// bit of a field in ScenePrefab::overrideMask
+inline uint32_t SceneFieldBit(SceneField field)
+{
+    return 1u << field;
+}
+
+// fields an instance of this type may override
+inline uint32_t SceneOverridableFields(ObjectType type)
+{
+    uint32_t bits = SceneFieldBit(SCENE_FIELD_PIPELINE);
+    switch (type)
+    {
+    case OBJECT_PRIMITIVE:
+        return bits | SceneFieldBit(SCENE_FIELD_PRIMITIVE_TYPE);
+    case OBJECT_HEIGHTFIELD:
+        return bits | SceneFieldBit(SCENE_FIELD_HEIGHTFIELD_WIDTH);
+    case OBJECT_WATER:
+        return bits | SceneFieldBit(SCENE_FIELD_WATER_CHOPPINESS);
+    default:
+        return bits;
+    }
+}
+
+// address of an instance field of the object at dense index i, nullptr for prefab fields
+inline void *SceneFieldPtr(Scene &scene, int i, SceneField field)
+{
+    switch (field)
+    {
+    case SCENE_FIELD_POS:
+        return &scene.pos[i];
+    case SCENE_FIELD_ROT:
+        return &scene.rot[i];
+    case SCENE_FIELD_SCALE:
+        return &scene.scale[i];
+    case SCENE_FIELD_PREFAB:
+        return &scene.prefab[i];
+    case SCENE_FIELD_NAMETAG:
+        return &scene.info[i].nametag;
+    default:
+        return nullptr;
+    }
+}
+
+// address of a prefab field, nullptr for instance fields
+inline void *ScenePrefabFieldPtr(ScenePrefab &prefab, SceneField field)
+{
+    switch (field)
+    {
+    case SCENE_FIELD_PREFAB_NAME:
+        return &prefab.name;
+    case SCENE_FIELD_OBJECT_TYPE:
+        return &prefab.objectType;
+    case SCENE_FIELD_PIPELINE:
+        return &prefab.pipeline;
+    case SCENE_FIELD_PRIMITIVE_TYPE:
+        return &prefab.primitiveType;
+    case SCENE_FIELD_DATA:
+        return &prefab.data;
+    case SCENE_FIELD_HEIGHTFIELD_PATHTOHEIGHTMAP:
+        return &prefab.data.heightfield.pathToHeightmap;
+    case SCENE_FIELD_HEIGHTFIELD_WIDTH:
+        return &prefab.data.heightfield.width;
+    case SCENE_FIELD_LOADED_MODEL_PATHTO:
+        return &prefab.data.loaded_model.pathTo;
+    case SCENE_FIELD_SKY_SPHERE_PATHTOTEXTURE:
+        return &prefab.data.sky_sphere.pathToTexture;
+    case SCENE_FIELD_WATER_CHOPPINESS:
+        return &prefab.data.water.choppiness;
+    default:
+        return nullptr;
+    }
+}
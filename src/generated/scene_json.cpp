@@ -2,16 +2,90 @@
 // GENERATED – DO NOT EDIT
 //   This file was automatically generated.
 //   by meta_scene_json.py
-//   Generated: 2026-02-21 09:18:51
+//   Generated: 2026-10-17 03:17:10
 //------------------------------------------------------------------------
 
 
 #include <cJSON.h>
 #include "src/scene_data.h"
-#include "mesh_data.h"
+#include "src/scene_prefab.h"
+#include "primitive_types.h"
 #include "render_pipeline_data.h"
 #include <string.h>
 #include <stdio.h>
+#include <vector>
+
+// file layout: "prefabs" holds the authored prefabs, every object is a transform, "prefab" (index into that array)
+// and optionally "overrides", a partial prefab with only the overridden fields. objects from before prefabs
+// carry objectType/pipeline/<type>Data themselves, they are folded into shared prefabs on load
+
+// ------------------------------------------------------------
+// prefab fields → json, only the SceneField bits in fields
+// ------------------------------------------------------------
+static void scene_prefab_to_json(cJSON* json, const ScenePrefab* p, uint32_t fields) {
+    if (fields & SceneFieldBit(SCENE_FIELD_OBJECT_TYPE))
+        cJSON_AddStringToObject(json, "objectType", g_objectTypeNames[p->objectType]);
+    if (fields & SceneFieldBit(SCENE_FIELD_PIPELINE))
+        cJSON_AddStringToObject(json, "pipeline", g_renderPipelineNames[p->pipeline]);
+
+    // Type‑specific data
+    switch (p->objectType) {
+    case OBJECT_PRIMITIVE: {
+        cJSON* primitiveData = cJSON_CreateObject();
+        if (fields & SceneFieldBit(SCENE_FIELD_PRIMITIVE_TYPE))
+            cJSON_AddStringToObject(primitiveData, "primitiveType", g_primitiveNames[p->primitiveType]);
+        if (primitiveData->child)
+            cJSON_AddItemToObject(json, "primitiveData", primitiveData);
+        else
+            cJSON_Delete(primitiveData);
+        break;
+    }
+    case OBJECT_HEIGHTFIELD: {
+        cJSON* heightfieldData = cJSON_CreateObject();
+        if (fields & SceneFieldBit(SCENE_FIELD_HEIGHTFIELD_PATHTOHEIGHTMAP))
+            cJSON_AddStringToObject(heightfieldData, "pathToHeightmap", StringGet(p->data.heightfield.pathToHeightmap));
+        if (fields & SceneFieldBit(SCENE_FIELD_HEIGHTFIELD_WIDTH))
+            cJSON_AddNumberToObject(heightfieldData, "width", p->data.heightfield.width);
+        if (heightfieldData->child)
+            cJSON_AddItemToObject(json, "heightfieldData", heightfieldData);
+        else
+            cJSON_Delete(heightfieldData);
+        break;
+    }
+    case OBJECT_LOADED_MODEL: {
+        cJSON* loaded_modelData = cJSON_CreateObject();
+        if (fields & SceneFieldBit(SCENE_FIELD_LOADED_MODEL_PATHTO))
+            cJSON_AddStringToObject(loaded_modelData, "pathTo", StringGet(p->data.loaded_model.pathTo));
+        if (loaded_modelData->child)
+            cJSON_AddItemToObject(json, "loaded_modelData", loaded_modelData);
+        else
+            cJSON_Delete(loaded_modelData);
+        break;
+    }
+    case OBJECT_SKY_SPHERE: {
+        cJSON* sky_sphereData = cJSON_CreateObject();
+        if (fields & SceneFieldBit(SCENE_FIELD_SKY_SPHERE_PATHTOTEXTURE))
+            cJSON_AddStringToObject(sky_sphereData, "pathToTexture", StringGet(p->data.sky_sphere.pathToTexture));
+        if (sky_sphereData->child)
+            cJSON_AddItemToObject(json, "sky_sphereData", sky_sphereData);
+        else
+            cJSON_Delete(sky_sphereData);
+        break;
+    }
+    case OBJECT_WATER: {
+        cJSON* waterData = cJSON_CreateObject();
+        if (fields & SceneFieldBit(SCENE_FIELD_WATER_CHOPPINESS))
+            cJSON_AddNumberToObject(waterData, "choppiness", p->data.water.choppiness);
+        if (waterData->child)
+            cJSON_AddItemToObject(json, "waterData", waterData);
+        else
+            cJSON_Delete(waterData);
+        break;
+    }
+    default:
+        break;
+    }
+}
 
 // ------------------------------------------------------------
 // Serialise Scene → JSON string (caller must free with cJSON_free)
@@ -22,71 +96,187 @@ char* scene_to_json(const Scene* scene) {
     // objectCount
     cJSON_AddNumberToObject(root, "objectCount", scene->objectCount);
 
+    // authored prefabs only, variants are written as their base plus "overrides" on each instance
+    std::vector<int> prefabIndex(scene->prefabs.size(), -1);
+    int prefabCount = 0;
+    cJSON* prefabsArray = cJSON_CreateArray();
+    for (size_t p = 0; p < scene->prefabs.size(); ++p) {
+        const ScenePrefab* prefab = &scene->prefabs[p];
+        if (prefab->base != SCENE_PREFAB_NONE)
+            continue;
+        prefabIndex[p] = prefabCount++;
+        cJSON* prefabJson = cJSON_CreateObject();
+        cJSON_AddStringToObject(prefabJson, "name", StringGet(prefab->name));
+        scene_prefab_to_json(prefabJson, prefab, ~0u);
+        cJSON_AddItemToArray(prefabsArray, prefabJson);
+    }
+    cJSON_AddItemToObject(root, "prefabs", prefabsArray);
+
     // objects array
     cJSON* objectsArray = cJSON_CreateArray();
     for (int i = 0; i < scene->objectCount; ++i) {
-        const SceneObject* obj = &scene->objects[i];
+        const SceneObjectInfo* info = &scene->info[i];
+        const ScenePrefab* prefab = &SceneObjectPrefab(*scene, i);
         cJSON* objJson = cJSON_CreateObject();
 
         // Common fields
-        cJSON_AddStringToObject(objJson, "nametag", obj->nametag);
+        cJSON_AddStringToObject(objJson, "nametag", StringGet(info->nametag));
 
-        cJSON* posArr = cJSON_CreateFloatArray((float*)&obj->pos, 3);
+        cJSON* posArr = cJSON_CreateFloatArray((float*)&scene->pos[i], 3);
         cJSON_AddItemToObject(objJson, "pos", posArr);
 
-        cJSON* rotArr = cJSON_CreateFloatArray((float*)&obj->rot, 4);
+        cJSON* rotArr = cJSON_CreateFloatArray((float*)&scene->rot[i], 4);
         cJSON_AddItemToObject(objJson, "rot", rotArr);
 
-        cJSON* scaleArr = cJSON_CreateFloatArray((float*)&obj->scale, 3);
+        cJSON* scaleArr = cJSON_CreateFloatArray((float*)&scene->scale[i], 3);
         cJSON_AddItemToObject(objJson, "scale", scaleArr);
 
-        cJSON_AddStringToObject(objJson, "objectType", g_objectTypeNames[obj->objectType]);
-        cJSON_AddStringToObject(objJson, "pipeline", g_renderPipelineNames[obj->pipeline]);
+        cJSON_AddNumberToObject(objJson, "prefab", prefabIndex[ScenePrefabRoot(*scene, scene->prefab[i])]);
+        if (prefab->overrideMask != 0) {
+            cJSON* overrides = cJSON_CreateObject();
+            scene_prefab_to_json(overrides, prefab, prefab->overrideMask);
+            cJSON_AddItemToObject(objJson, "overrides", overrides);
+        }
+
+        cJSON_AddItemToArray(objectsArray, objJson);
+    }
+    cJSON_AddItemToObject(root, "objects", objectsArray);
+
+    char* result = cJSON_Print(root);
+    cJSON_Delete(root);
+    return result;
+}
+
+// ------------------------------------------------------------
+// json → prefab fields: a "prefabs" entry, an object written before prefabs existed, or an "overrides" block
+// (withType false, an instance can not change its type). returns the SceneField bits that were read
+// ------------------------------------------------------------
+static uint32_t scene_prefab_from_json(cJSON* json, ScenePrefab* p, bool withType) {
+    uint32_t fields = 0;
 
-        // Type‑specific data
-        switch (obj->objectType) {
-            case OBJECT_PRIMITIVE: {
-                cJSON* primitiveData = cJSON_CreateObject();
-            cJSON_AddStringToObject(primitiveData, "primitiveType", g_primitiveNames[obj->data.primitive.primitiveType]);
-                cJSON_AddItemToObject(objJson, "primitiveData", primitiveData);
+    cJSON* objectTypeItem = withType ? cJSON_GetObjectItem(json, "objectType") : nullptr;
+    if (cJSON_IsNumber(objectTypeItem)) {
+        p->objectType = (ObjectType)objectTypeItem->valueint;
+        fields |= SceneFieldBit(SCENE_FIELD_OBJECT_TYPE);
+    } else if (cJSON_IsString(objectTypeItem)) {
+        const char* typeName = objectTypeItem->valuestring;
+        int found = -1;
+        for (int idx = 0; idx < OBJECT_COUNT; idx++) {
+            if (strcmp(typeName, g_objectTypeNames[idx]) == 0) {
+                found = idx;
                 break;
             }
-            case OBJECT_HEIGHTFIELD: {
-                cJSON* heightfieldData = cJSON_CreateObject();
-            cJSON_AddStringToObject(heightfieldData, "pathToHeightmap", obj->data.heightfield.pathToHeightmap);
-            cJSON_AddNumberToObject(heightfieldData, "width", obj->data.heightfield.width);
-                cJSON_AddItemToObject(objJson, "heightfieldData", heightfieldData);
+        }
+        if (found != -1) p->objectType = (ObjectType)found;
+        else {
+            p->objectType = OBJECT_PRIMITIVE;
+            fprintf(stderr, "Unknown object type \"%s\", defaulting to Primitive\n", typeName);
+        }
+        fields |= SceneFieldBit(SCENE_FIELD_OBJECT_TYPE);
+    }
+
+    cJSON* pipelineItem = cJSON_GetObjectItem(json, "pipeline");
+    if (cJSON_IsNumber(pipelineItem)) {
+        p->pipeline = (RenderPipeline)pipelineItem->valueint;
+        fields |= SceneFieldBit(SCENE_FIELD_PIPELINE);
+    } else if (cJSON_IsString(pipelineItem)) {
+        const char* pipeName = pipelineItem->valuestring;
+        int found = -1;
+        for (int idx = 0; idx < RENDER_COUNT; idx++) {
+            if (strcmp(pipeName, g_renderPipelineNames[idx]) == 0) {
+                found = idx;
                 break;
             }
-            case OBJECT_LOADED_MODEL: {
-                cJSON* loaded_modelData = cJSON_CreateObject();
-            cJSON_AddStringToObject(loaded_modelData, "pathTo", obj->data.loaded_model.pathTo);
-                cJSON_AddItemToObject(objJson, "loaded_modelData", loaded_modelData);
-                break;
+        }
+        if (found != -1) p->pipeline = (RenderPipeline)found;
+        else {
+            p->pipeline = RENDER_DEFAULT;
+            fprintf(stderr, "Unknown pipeline \"%s\", defaulting to Default\n", pipeName);
+        }
+        fields |= SceneFieldBit(SCENE_FIELD_PIPELINE);
+    }
+
+    // Type‑specific data
+    switch (p->objectType) {
+    case OBJECT_PRIMITIVE: {
+        cJSON* primitiveData = cJSON_GetObjectItem(json, "primitiveData");
+        if (primitiveData) {
+            cJSON* primitiveTypeItem = cJSON_GetObjectItem(primitiveData, "primitiveType");
+            if (cJSON_IsString(primitiveTypeItem)) {
+                const char* typeName = primitiveTypeItem->valuestring;
+                int found = -1;
+                for (int idx = 0; idx < PRIMITIVE_COUNT; idx++) {
+                    if (strcmp(typeName, g_primitiveNames[idx]) == 0) {
+                        found = idx;
+                        break;
+                    }
+                }
+                if (found != -1) p->primitiveType = (PrimitiveType)found;
+                else {
+                    p->primitiveType = PRIMITIVE_CUBE;
+                    fprintf(stderr, "Unknown primitive type \"%s\", defaulting to Cube\n", typeName);
+                }
+                fields |= SceneFieldBit(SCENE_FIELD_PRIMITIVE_TYPE);
+            } else if (cJSON_IsNumber(primitiveTypeItem)) {
+                p->primitiveType = (PrimitiveType)primitiveTypeItem->valueint;
+                fields |= SceneFieldBit(SCENE_FIELD_PRIMITIVE_TYPE);
             }
-            case OBJECT_SKY_SPHERE: {
-                cJSON* sky_sphereData = cJSON_CreateObject();
-            cJSON_AddStringToObject(sky_sphereData, "pathToTexture", obj->data.sky_sphere.pathToTexture);
-                cJSON_AddItemToObject(objJson, "sky_sphereData", sky_sphereData);
-                break;
+        }
+        break;
+    }
+    case OBJECT_HEIGHTFIELD: {
+        cJSON* heightfieldData = cJSON_GetObjectItem(json, "heightfieldData");
+        if (heightfieldData) {
+            cJSON* pathToHeightmapItem = cJSON_GetObjectItem(heightfieldData, "pathToHeightmap");
+            if (cJSON_IsString(pathToHeightmapItem)) {
+                p->data.heightfield.pathToHeightmap = StringIntern(pathToHeightmapItem->valuestring);
+                fields |= SceneFieldBit(SCENE_FIELD_HEIGHTFIELD_PATHTOHEIGHTMAP);
             }
-            case OBJECT_WATER: {
-                cJSON* waterData = cJSON_CreateObject();
-            cJSON_AddNumberToObject(waterData, "choppiness", obj->data.water.choppiness);
-                cJSON_AddItemToObject(objJson, "waterData", waterData);
-                break;
+            cJSON* widthItem = cJSON_GetObjectItem(heightfieldData, "width");
+            if (cJSON_IsNumber(widthItem)) {
+                p->data.heightfield.width = (uint32_t)widthItem->valuedouble;
+                fields |= SceneFieldBit(SCENE_FIELD_HEIGHTFIELD_WIDTH);
             }
-            default:
-                break;
         }
-
-        cJSON_AddItemToArray(objectsArray, objJson);
+        break;
     }
-    cJSON_AddItemToObject(root, "objects", objectsArray);
-
-    char* result = cJSON_Print(root);
-    cJSON_Delete(root);
-    return result;
+    case OBJECT_LOADED_MODEL: {
+        cJSON* loaded_modelData = cJSON_GetObjectItem(json, "loaded_modelData");
+        if (loaded_modelData) {
+            cJSON* pathToItem = cJSON_GetObjectItem(loaded_modelData, "pathTo");
+            if (cJSON_IsString(pathToItem)) {
+                p->data.loaded_model.pathTo = StringIntern(pathToItem->valuestring);
+                fields |= SceneFieldBit(SCENE_FIELD_LOADED_MODEL_PATHTO);
+            }
+        }
+        break;
+    }
+    case OBJECT_SKY_SPHERE: {
+        cJSON* sky_sphereData = cJSON_GetObjectItem(json, "sky_sphereData");
+        if (sky_sphereData) {
+            cJSON* pathToTextureItem = cJSON_GetObjectItem(sky_sphereData, "pathToTexture");
+            if (cJSON_IsString(pathToTextureItem)) {
+                p->data.sky_sphere.pathToTexture = StringIntern(pathToTextureItem->valuestring);
+                fields |= SceneFieldBit(SCENE_FIELD_SKY_SPHERE_PATHTOTEXTURE);
+            }
+        }
+        break;
+    }
+    case OBJECT_WATER: {
+        cJSON* waterData = cJSON_GetObjectItem(json, "waterData");
+        if (waterData) {
+            cJSON* choppinessItem = cJSON_GetObjectItem(waterData, "choppiness");
+            if (cJSON_IsNumber(choppinessItem)) {
+                p->data.water.choppiness = (float)choppinessItem->valuedouble;
+                fields |= SceneFieldBit(SCENE_FIELD_WATER_CHOPPINESS);
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return fields;
 }
 
 // ------------------------------------------------------------
@@ -97,147 +287,77 @@ int scene_from_json(const char* json, Scene* scene) {
     if (!root) return 0;
 
     // Clear scene first (set defaults)
-    memset(scene, 0, sizeof(Scene));
-    scene->objectCount = 0;
+    SceneClear(*scene);
+
+    // "objectCount" is written for readability only, the objects array is what counts
 
-    // objectCount (optional)
-    cJSON* countItem = cJSON_GetObjectItem(root, "objectCount");
-    if (cJSON_IsNumber(countItem)) scene->objectCount = countItem->valueint;
+    // prefabs array, json index k is prefab id k
+    int prefabCount = 0;
+    cJSON* prefabArray = cJSON_GetObjectItem(root, "prefabs");
+    if (cJSON_IsArray(prefabArray)) {
+        cJSON* prefabJson = nullptr;
+        cJSON_ArrayForEach(prefabJson, prefabArray) {
+            ScenePrefab prefab = ScenePrefabDefault();
+            cJSON* nameItem = cJSON_GetObjectItem(prefabJson, "name");
+            if (cJSON_IsString(nameItem)) prefab.name = StringIntern(nameItem->valuestring);
+            scene_prefab_from_json(prefabJson, &prefab, true);
+            if (prefab.name == STRING_ID_EMPTY) prefab.name = ScenePrefabDefaultName(prefab);
+            ScenePrefabAdd(*scene, prefab);
+            prefabCount++;
+        }
+    }
 
     // objects array
     cJSON* objArray = cJSON_GetObjectItem(root, "objects");
     if (cJSON_IsArray(objArray)) {
-        int arraySize = cJSON_GetArraySize(objArray);
-        for (int i = 0; i < arraySize && i < MAX_SCENE_OBJECTS; ++i) {
-            cJSON* objJson = cJSON_GetArrayItem(objArray, i);
-            SceneObject* obj = &scene->objects[i];
+        SceneReserve(*scene, cJSON_GetArraySize(objArray));
+        cJSON* objJson = nullptr;
+        cJSON_ArrayForEach(objJson, objArray) { // not cJSON_GetArrayItem(i), that walks the list from the start every time
+            SceneAddObject(*scene, SCENE_PREFAB_NONE);
+            int i = scene->objectCount - 1;
+            SceneObjectInfo* info = &scene->info[i];
 
             // Common fields
             cJSON* nametagItem = cJSON_GetObjectItem(objJson, "nametag");
-            if (cJSON_IsString(nametagItem)) strncpy_s(obj->nametag, nametagItem->valuestring, sizeof(obj->nametag)-1);
+            if (cJSON_IsString(nametagItem)) info->nametag = StringIntern(nametagItem->valuestring);
 
             cJSON* posItem = cJSON_GetObjectItem(objJson, "pos");
             if (cJSON_IsArray(posItem) && cJSON_GetArraySize(posItem) == 3) {
                 for (int j = 0; j < 3; ++j)
-                    ((float*)&obj->pos)[j] = (float)cJSON_GetArrayItem(posItem, j)->valuedouble;
+                    ((float*)&scene->pos[i])[j] = (float)cJSON_GetArrayItem(posItem, j)->valuedouble;
             }
 
             cJSON* rotItem = cJSON_GetObjectItem(objJson, "rot");
             if (cJSON_IsArray(rotItem) && cJSON_GetArraySize(rotItem) == 4) {
                 for (int j = 0; j < 4; ++j)
-                    ((float*)&obj->rot)[j] = (float)cJSON_GetArrayItem(rotItem, j)->valuedouble;
+                    ((float*)&scene->rot[i])[j] = (float)cJSON_GetArrayItem(rotItem, j)->valuedouble;
             }
 
             cJSON* scaleItem = cJSON_GetObjectItem(objJson, "scale");
             if (cJSON_IsArray(scaleItem) && cJSON_GetArraySize(scaleItem) == 3) {
                 for (int j = 0; j < 3; ++j)
-                    ((float*)&obj->scale)[j] = (float)cJSON_GetArrayItem(scaleItem, j)->valuedouble;
+                    ((float*)&scene->scale[i])[j] = (float)cJSON_GetArrayItem(scaleItem, j)->valuedouble;
             }
 
-            cJSON* objectTypeItem = cJSON_GetObjectItem(objJson, "objectType");
-            if (cJSON_IsNumber(objectTypeItem)) {
-                obj->objectType = (ObjectType)objectTypeItem->valueint;
-            } else if (cJSON_IsString(objectTypeItem)) {
-                const char* typeName = objectTypeItem->valuestring;
-                int found = -1;
-                for (int idx = 0; idx < OBJECT_COUNT; idx++) {
-                    if (strcmp(typeName, g_objectTypeNames[idx]) == 0) {
-                        found = idx;
-                        break;
-                    }
-                }
-                if (found != -1) obj->objectType = (ObjectType)found;
-                else {
-                    obj->objectType = OBJECT_PRIMITIVE;
-                    fprintf(stderr, "Unknown object type \"%s\", defaulting to Primitive\n", typeName);
-                }
-            }
-
-            cJSON* pipelineItem = cJSON_GetObjectItem(objJson, "pipeline");
-            if (cJSON_IsNumber(pipelineItem)) {
-                obj->pipeline = (RenderPipeline)pipelineItem->valueint;
-            } else if (cJSON_IsString(pipelineItem)) {
-                const char* pipeName = pipelineItem->valuestring;
-                int found = -1;
-                for (int idx = 0; idx < RENDER_COUNT; idx++) {
-                    if (strcmp(pipeName, g_renderPipelineNames[idx]) == 0) {
-                        found = idx;
-                        break;
-                    }
-                }
-                if (found != -1) obj->pipeline = (RenderPipeline)found;
-                else {
-                    obj->pipeline = RENDER_DEFAULT;
-                    fprintf(stderr, "Unknown pipeline \"%s\", defaulting to Default\n", pipeName);
-                }
+            uint32_t prefab;
+            cJSON* prefabItem = cJSON_GetObjectItem(objJson, "prefab");
+            if (cJSON_IsNumber(prefabItem) && prefabItem->valueint >= 0 && prefabItem->valueint < prefabCount) {
+                prefab = (uint32_t)prefabItem->valueint;
+            } else {
+                // no (usable) prefab: the object has its own type and data, the same data shares one prefab
+                ScenePrefab own = ScenePrefabDefault();
+                scene_prefab_from_json(objJson, &own, true);
+                prefab = SceneFindOrAddPrefab(*scene, own);
             }
 
-            // Type‑specific data
-            switch (obj->objectType) {
-                case OBJECT_PRIMITIVE: {
-                cJSON* primitiveData = cJSON_GetObjectItem(objJson, "primitiveData");
-                if (primitiveData) {
-                    cJSON* primitiveTypeItem = cJSON_GetObjectItem(primitiveData, "primitiveType");
-                    if (cJSON_IsString(primitiveTypeItem)) {
-                        const char* typeName = primitiveTypeItem->valuestring;
-                        int found = -1;
-                        for (int idx = 0; idx < PRIMITIVE_COUNT; idx++) {
-                            if (strcmp(typeName, g_primitiveNames[idx]) == 0) {
-                                found = idx;
-                                break;
-                            }
-                        }
-                        if (found != -1) obj->data.primitive.primitiveType = (PrimitiveType)found;
-                        else {
-                            obj->data.primitive.primitiveType = PRIMITIVE_CUBE;
-                            fprintf(stderr, "Unknown primitive type \"%s\", defaulting to Cube\n", typeName);
-                        }
-                    } else if (cJSON_IsNumber(primitiveTypeItem)) {
-                        obj->data.primitive.primitiveType = (PrimitiveType)primitiveTypeItem->valueint;
-                    }
-                }
-                    break;
-                }
-                case OBJECT_HEIGHTFIELD: {
-                cJSON* heightfieldData = cJSON_GetObjectItem(objJson, "heightfieldData");
-                if (heightfieldData) {
-                    cJSON* pathToHeightmapItem = cJSON_GetObjectItem(heightfieldData, "pathToHeightmap");
-                    if (cJSON_IsString(pathToHeightmapItem)) strncpy_s(obj->data.heightfield.pathToHeightmap, pathToHeightmapItem->valuestring, sizeof(obj->data.heightfield.pathToHeightmap)-1);
-                    cJSON* widthItem = cJSON_GetObjectItem(heightfieldData, "width");
-                    if (cJSON_IsNumber(widthItem)) obj->data.heightfield.width = (uint32_t)widthItem->valuedouble;
-                }
-                    break;
-                }
-                case OBJECT_LOADED_MODEL: {
-                cJSON* loaded_modelData = cJSON_GetObjectItem(objJson, "loaded_modelData");
-                if (loaded_modelData) {
-                    cJSON* pathToItem = cJSON_GetObjectItem(loaded_modelData, "pathTo");
-                    if (cJSON_IsString(pathToItem)) strncpy_s(obj->data.loaded_model.pathTo, pathToItem->valuestring, sizeof(obj->data.loaded_model.pathTo)-1);
-                }
-                    break;
-                }
-                case OBJECT_SKY_SPHERE: {
-                cJSON* sky_sphereData = cJSON_GetObjectItem(objJson, "sky_sphereData");
-                if (sky_sphereData) {
-                    cJSON* pathToTextureItem = cJSON_GetObjectItem(sky_sphereData, "pathToTexture");
-                    if (cJSON_IsString(pathToTextureItem)) strncpy_s(obj->data.sky_sphere.pathToTexture, pathToTextureItem->valuestring, sizeof(obj->data.sky_sphere.pathToTexture)-1);
-                }
-                    break;
-                }
-                case OBJECT_WATER: {
-                cJSON* waterData = cJSON_GetObjectItem(objJson, "waterData");
-                if (waterData) {
-                    cJSON* choppinessItem = cJSON_GetObjectItem(waterData, "choppiness");
-                    if (cJSON_IsNumber(choppinessItem)) obj->data.water.choppiness = (float)choppinessItem->valuedouble;
-                }
-                    break;
-                }
-                default:
-                    break;
+            cJSON* overridesItem = cJSON_GetObjectItem(objJson, "overrides");
+            if (cJSON_IsObject(overridesItem)) {
+                ScenePrefab values = scene->prefabs[prefab];
+                uint32_t fields = scene_prefab_from_json(overridesItem, &values, false);
+                prefab = ScenePrefabVariant(*scene, prefab, fields, values);
             }
+            scene->prefab[i] = prefab;
         }
-        // Update objectCount if array was present
-        if (arraySize > 0) scene->objectCount = arraySize;
     }
 
     cJSON_Delete(root);
@@ -0,0 +1,847 @@
+//------------------------------------------------------------------------
+// GENERATED – DO NOT EDIT
+//   This file was automatically generated.
+//   by meta_scene_json.py
+//   Generated: 2026-10-17 03:17:10
+//------------------------------------------------------------------------
+
+
+#include "src/scene_data.h"
+#include "src/scene_prefab.h"
+#include "primitive_types.h"
+#include "render_pipeline_data.h"
+#include <ctype.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ------------------------------------------------------------
+// Streaming JSON → Scene, no cJSON tree. Reads the same as scene_from_json
+// ------------------------------------------------------------
+// same limit as cJSON, a hostile file can't blow the stack
+#define SJ_NESTING_LIMIT 1000
+
+struct SceneJsonCursor
+{
+    const char *p; // input has to be null terminated (SDL_LoadFile does that)
+};
+
+static void sj_skip_ws(SceneJsonCursor &c)
+{
+    while (*c.p && (unsigned char)*c.p <= 32)
+        c.p++;
+}
+
+static bool sj_consume(SceneJsonCursor &c, char ch)
+{
+    sj_skip_ws(c);
+    if (*c.p != ch)
+        return false;
+    c.p++;
+    return true;
+}
+
+static bool sj_is_number_start(char ch)
+{
+    return ch == '-' || (ch >= '0' && ch <= '9');
+}
+
+// cJSON_GetObjectItem compares keys case insensitively
+static bool sj_key(const char *key, const char *name)
+{
+    for (; *key && *name; ++key, ++name)
+    {
+        if (tolower((unsigned char)*key) != tolower((unsigned char)*name))
+            return false;
+    }
+    return *key == *name;
+}
+
+// only the first member with a given key counts, like cJSON_GetObjectItem
+static bool sj_first(uint32_t &seen, uint32_t bit)
+{
+    bool first = (seen & bit) == 0;
+    seen |= bit;
+    return first;
+}
+
+static int sj_hex4(const char *s)
+{
+    int v = 0;
+    for (int k = 0; k < 4; ++k)
+    {
+        char h = s[k];
+        v <<= 4;
+        if (h >= '0' && h <= '9') v |= h - '0';
+        else if (h >= 'a' && h <= 'f') v |= h - 'a' + 10;
+        else if (h >= 'A' && h <= 'F') v |= h - 'A' + 10;
+        else return -1;
+    }
+    return v;
+}
+
+static void sj_put(char *dst, int dstSize, int &len, char ch)
+{
+    if (len < dstSize - 1)
+        dst[len] = ch;
+    len++;
+}
+
+// decodes the string at the cursor into dst keeping at most dstSize-1 bytes (same as the strncpy_s in the cJSON path).
+// dst may be null with dstSize 0 to just skip it. returns the full decoded length, -1 if malformed
+static int sj_string(SceneJsonCursor &c, char *dst, int dstSize)
+{
+    sj_skip_ws(c);
+    if (*c.p != '"')
+        return -1;
+    const char *s = c.p + 1;
+    int len = 0;
+    while (*s != '"')
+    {
+        if (*s == '\0')
+            return -1;
+        if (*s != '\\')
+        {
+            sj_put(dst, dstSize, len, *s++);
+            continue;
+        }
+        s++;
+        switch (*s)
+        {
+        case 'b': sj_put(dst, dstSize, len, '\b'); break;
+        case 'f': sj_put(dst, dstSize, len, '\f'); break;
+        case 'n': sj_put(dst, dstSize, len, '\n'); break;
+        case 'r': sj_put(dst, dstSize, len, '\r'); break;
+        case 't': sj_put(dst, dstSize, len, '\t'); break;
+        case '"':
+        case '\\':
+        case '/': sj_put(dst, dstSize, len, *s); break;
+        case 'u':
+        {
+            int hi = sj_hex4(s + 1);
+            if (hi < 0 || (hi >= 0xDC00 && hi <= 0xDFFF))
+                return -1;
+            s += 4;
+            uint32_t cp = (uint32_t)hi;
+            if (hi >= 0xD800 && hi <= 0xDBFF)
+            {
+                if (s[1] != '\\' || s[2] != 'u')
+                    return -1;
+                int lo = sj_hex4(s + 3);
+                if (lo < 0xDC00 || lo > 0xDFFF)
+                    return -1;
+                cp = 0x10000 + ((((uint32_t)hi & 0x3FF) << 10) | ((uint32_t)lo & 0x3FF));
+                s += 6;
+            }
+            if (cp < 0x80)
+                sj_put(dst, dstSize, len, (char)cp);
+            else if (cp < 0x800)
+            {
+                sj_put(dst, dstSize, len, (char)(0xC0 | (cp >> 6)));
+                sj_put(dst, dstSize, len, (char)(0x80 | (cp & 0x3F)));
+            }
+            else if (cp < 0x10000)
+            {
+                sj_put(dst, dstSize, len, (char)(0xE0 | (cp >> 12)));
+                sj_put(dst, dstSize, len, (char)(0x80 | ((cp >> 6) & 0x3F)));
+                sj_put(dst, dstSize, len, (char)(0x80 | (cp & 0x3F)));
+            }
+            else
+            {
+                sj_put(dst, dstSize, len, (char)(0xF0 | (cp >> 18)));
+                sj_put(dst, dstSize, len, (char)(0x80 | ((cp >> 12) & 0x3F)));
+                sj_put(dst, dstSize, len, (char)(0x80 | ((cp >> 6) & 0x3F)));
+                sj_put(dst, dstSize, len, (char)(0x80 | (cp & 0x3F)));
+            }
+            break;
+        }
+        default:
+            return -1;
+        }
+        s++;
+    }
+    c.p = s + 1;
+    if (dstSize > 0)
+        dst[len < dstSize - 1 ? len : dstSize - 1] = '\0';
+    return len;
+}
+
+// string value straight into the string table. short strings decode on the stack, longer ones go round again
+static bool sj_intern_string(SceneJsonCursor &c, StringId *out)
+{
+    char buf[512];
+    SceneJsonCursor start = c;
+    int len = sj_string(c, buf, sizeof(buf));
+    if (len < 0)
+        return false;
+    if (len < (int)sizeof(buf))
+    {
+        *out = StringIntern(buf, (size_t)len);
+        return true;
+    }
+    std::vector<char> big((size_t)len + 1);
+    sj_string(start, big.data(), len + 1);
+    *out = StringIntern(big.data(), (size_t)len);
+    return true;
+}
+
+// same as cJSON parse_number: copy the number characters out and let strtod decide where it ends
+static bool sj_number(SceneJsonCursor &c, double *out)
+{
+    sj_skip_ws(c);
+    char buf[64];
+    int n = 0;
+    for (const char *s = c.p; n < (int)sizeof(buf) - 1; ++s)
+    {
+        char ch = *s;
+        if (!((ch >= '0' && ch <= '9') || ch == '+' || ch == '-' || ch == 'e' || ch == 'E' || ch == '.'))
+            break;
+        buf[n++] = ch;
+    }
+    buf[n] = '\0';
+    char *end = nullptr;
+    double d = strtod(buf, &end);
+    if (end == buf)
+        return false;
+    c.p += end - buf;
+    *out = d;
+    return true;
+}
+
+// cJSON valueint, saturated
+static int sj_valueint(double d)
+{
+    if (d >= INT_MAX)
+        return INT_MAX;
+    if (d <= (double)INT_MIN)
+        return INT_MIN;
+    return (int)d;
+}
+
+static bool sj_skip_value(SceneJsonCursor &c, int depth = 0)
+{
+    sj_skip_ws(c);
+    char ch = *c.p;
+    if (ch == '"')
+        return sj_string(c, nullptr, 0) >= 0;
+    if (sj_is_number_start(ch))
+    {
+        double d;
+        return sj_number(c, &d);
+    }
+    if (strncmp(c.p, "null", 4) == 0 || strncmp(c.p, "true", 4) == 0)
+    {
+        c.p += 4;
+        return true;
+    }
+    if (strncmp(c.p, "false", 5) == 0)
+    {
+        c.p += 5;
+        return true;
+    }
+    if (ch != '[' && ch != '{')
+        return false;
+    if (depth >= SJ_NESTING_LIMIT)
+        return false;
+
+    char close = ch == '[' ? ']' : '}';
+    c.p++;
+    if (sj_consume(c, close))
+        return true;
+    for (;;)
+    {
+        if (ch == '{' && (sj_string(c, nullptr, 0) < 0 || !sj_consume(c, ':')))
+            return false;
+        if (!sj_skip_value(c, depth + 1))
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, close);
+    }
+}
+
+// [x, y, z] into want floats. like the cJSON path they are only written when the item count matches,
+// items that are not numbers read as 0. *assigned (if given) says whether they were
+static bool sj_float_array(SceneJsonCursor &c, float *dst, int want, bool *assigned = nullptr)
+{
+    if (assigned)
+        *assigned = false;
+    sj_skip_ws(c);
+    if (*c.p != '[')
+        return sj_skip_value(c);
+    c.p++;
+
+    double vals[4] = {};
+    int count = 0;
+    if (!sj_consume(c, ']'))
+    {
+        for (;;)
+        {
+            sj_skip_ws(c);
+            double v = 0.0;
+            if (sj_is_number_start(*c.p))
+            {
+                if (!sj_number(c, &v))
+                    return false;
+            }
+            else if (!sj_skip_value(c))
+                return false;
+            if (count < 4)
+                vals[count] = v;
+            count++;
+            if (sj_consume(c, ','))
+                continue;
+            if (sj_consume(c, ']'))
+                break;
+            return false;
+        }
+    }
+    if (count == want)
+    {
+        for (int j = 0; j < want; ++j)
+            dst[j] = (float)vals[j];
+        if (assigned)
+            *assigned = true;
+    }
+    return true;
+}
+
+// enum stored either as a name (resolved by lookup) or a raw number. anything else leaves *out alone
+static bool sj_enum(SceneJsonCursor &c, int (*lookup)(const char *), int fallback, const char *unknownFmt, int *out)
+{
+    sj_skip_ws(c);
+    if (*c.p == '"')
+    {
+        char name[128];
+        if (sj_string(c, name, sizeof(name)) < 0)
+            return false;
+        int found = lookup(name);
+        if (found < 0)
+        {
+            fprintf(stderr, unknownFmt, name);
+            found = fallback;
+        }
+        *out = found;
+        return true;
+    }
+    if (sj_is_number_start(*c.p))
+    {
+        double d;
+        if (!sj_number(c, &d))
+            return false;
+        *out = sj_valueint(d);
+        return true;
+    }
+    return sj_skip_value(c);
+}
+
+// fnv-1a with a per table seed, meta_scene_json.py searches for seeds where every name gets its own slot
+static uint32_t sj_name_hash(const char *s, uint32_t seed)
+{
+    uint32_t h = seed;
+    while (*s)
+    {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static const int8_t g_objectTypeNameSlots[8] = {1, -1, 2, 4, -1, 0, -1, 3};
+
+static int sj_lookup_objectType(const char *name)
+{
+    int idx = g_objectTypeNameSlots[sj_name_hash(name, 2u) >> 29];
+    return (idx >= 0 && strcmp(name, g_objectTypeNames[idx]) == 0) ? idx : -1;
+}
+
+static const int8_t g_pipelineNameSlots[8] = {4, -1, 3, 1, -1, 2, 0, -1};
+
+static int sj_lookup_pipeline(const char *name)
+{
+    int idx = g_pipelineNameSlots[sj_name_hash(name, 10u) >> 29];
+    return (idx >= 0 && strcmp(name, g_renderPipelineNames[idx]) == 0) ? idx : -1;
+}
+
+static const int8_t g_primitiveNameSlots[8] = {2, -1, -1, 1, -1, 0, 4, 3};
+
+static int sj_lookup_primitive(const char *name)
+{
+    int idx = g_primitiveNameSlots[sj_name_hash(name, 2u) >> 29];
+    return (idx >= 0 && strcmp(name, g_primitiveNames[idx]) == 0) ? idx : -1;
+}
+
+static bool sj_parse_primitiveData(SceneJsonCursor &c, ScenePrefab *p, uint32_t *fields)
+{
+    sj_skip_ws(c);
+    if (*c.p != '{')
+        return sj_skip_value(c);
+    c.p++;
+    if (sj_consume(c, '}'))
+        return true;
+
+    uint32_t seen = 0;
+    for (;;)
+    {
+        char key[64];
+        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))
+            return false;
+        sj_skip_ws(c);
+        bool ok;
+        if (sj_key(key, "primitiveType") && sj_first(seen, 1u))
+        {
+            bool assigned = *c.p == '"' || sj_is_number_start(*c.p);
+            int value = (int)p->primitiveType;
+            ok = sj_enum(c, sj_lookup_primitive, PRIMITIVE_CUBE, "Unknown primitive type \"%s\", defaulting to Cube\n", &value);
+            p->primitiveType = (PrimitiveType)value;
+            if (assigned)
+                *fields |= SceneFieldBit(SCENE_FIELD_PRIMITIVE_TYPE);
+        }
+        else
+            ok = sj_skip_value(c);
+        if (!ok)
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, '}');
+    }
+}
+
+static bool sj_parse_heightfieldData(SceneJsonCursor &c, ScenePrefab *p, uint32_t *fields)
+{
+    sj_skip_ws(c);
+    if (*c.p != '{')
+        return sj_skip_value(c);
+    c.p++;
+    if (sj_consume(c, '}'))
+        return true;
+
+    uint32_t seen = 0;
+    for (;;)
+    {
+        char key[64];
+        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))
+            return false;
+        sj_skip_ws(c);
+        bool ok;
+        if (sj_key(key, "pathToHeightmap") && sj_first(seen, 1u))
+        {
+            bool isString = *c.p == '"';
+            ok = isString ? sj_intern_string(c, &p->data.heightfield.pathToHeightmap) : sj_skip_value(c);
+            if (isString)
+                *fields |= SceneFieldBit(SCENE_FIELD_HEIGHTFIELD_PATHTOHEIGHTMAP);
+        }
+        else if (sj_key(key, "width") && sj_first(seen, 2u))
+        {
+            double d;
+            if (sj_is_number_start(*c.p))
+            {
+                ok = sj_number(c, &d);
+                if (ok)
+                {
+                    p->data.heightfield.width = (uint32_t)d;
+                    *fields |= SceneFieldBit(SCENE_FIELD_HEIGHTFIELD_WIDTH);
+                }
+            }
+            else
+                ok = sj_skip_value(c);
+        }
+        else
+            ok = sj_skip_value(c);
+        if (!ok)
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, '}');
+    }
+}
+
+static bool sj_parse_loaded_modelData(SceneJsonCursor &c, ScenePrefab *p, uint32_t *fields)
+{
+    sj_skip_ws(c);
+    if (*c.p != '{')
+        return sj_skip_value(c);
+    c.p++;
+    if (sj_consume(c, '}'))
+        return true;
+
+    uint32_t seen = 0;
+    for (;;)
+    {
+        char key[64];
+        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))
+            return false;
+        sj_skip_ws(c);
+        bool ok;
+        if (sj_key(key, "pathTo") && sj_first(seen, 1u))
+        {
+            bool isString = *c.p == '"';
+            ok = isString ? sj_intern_string(c, &p->data.loaded_model.pathTo) : sj_skip_value(c);
+            if (isString)
+                *fields |= SceneFieldBit(SCENE_FIELD_LOADED_MODEL_PATHTO);
+        }
+        else
+            ok = sj_skip_value(c);
+        if (!ok)
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, '}');
+    }
+}
+
+static bool sj_parse_sky_sphereData(SceneJsonCursor &c, ScenePrefab *p, uint32_t *fields)
+{
+    sj_skip_ws(c);
+    if (*c.p != '{')
+        return sj_skip_value(c);
+    c.p++;
+    if (sj_consume(c, '}'))
+        return true;
+
+    uint32_t seen = 0;
+    for (;;)
+    {
+        char key[64];
+        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))
+            return false;
+        sj_skip_ws(c);
+        bool ok;
+        if (sj_key(key, "pathToTexture") && sj_first(seen, 1u))
+        {
+            bool isString = *c.p == '"';
+            ok = isString ? sj_intern_string(c, &p->data.sky_sphere.pathToTexture) : sj_skip_value(c);
+            if (isString)
+                *fields |= SceneFieldBit(SCENE_FIELD_SKY_SPHERE_PATHTOTEXTURE);
+        }
+        else
+            ok = sj_skip_value(c);
+        if (!ok)
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, '}');
+    }
+}
+
+static bool sj_parse_waterData(SceneJsonCursor &c, ScenePrefab *p, uint32_t *fields)
+{
+    sj_skip_ws(c);
+    if (*c.p != '{')
+        return sj_skip_value(c);
+    c.p++;
+    if (sj_consume(c, '}'))
+        return true;
+
+    uint32_t seen = 0;
+    for (;;)
+    {
+        char key[64];
+        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))
+            return false;
+        sj_skip_ws(c);
+        bool ok;
+        if (sj_key(key, "choppiness") && sj_first(seen, 1u))
+        {
+            double d;
+            if (sj_is_number_start(*c.p))
+            {
+                ok = sj_number(c, &d);
+                if (ok)
+                {
+                    p->data.water.choppiness = (float)d;
+                    *fields |= SceneFieldBit(SCENE_FIELD_WATER_CHOPPINESS);
+                }
+            }
+            else
+                ok = sj_skip_value(c);
+        }
+        else
+            ok = sj_skip_value(c);
+        if (!ok)
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, '}');
+    }
+}
+
+enum SjMembers
+{
+    SJ_MEMBERS_PREFAB,    // a "prefabs" entry
+    SJ_MEMBERS_OBJECT,    // an "objects" entry, old files keep the prefab part inline
+    SJ_MEMBERS_OVERRIDES, // an "overrides" block, the type can not be overridden
+};
+
+struct SjInstanceMembers
+{
+    bool hasPrefab;
+    int prefab;
+    const char *overrides;
+};
+
+static bool sj_parse_members(SceneJsonCursor &c, SjMembers kind, ScenePrefab *p, uint32_t *fields, Scene *scene, int i, SjInstanceMembers *inst)
+{
+    c.p++; // {
+
+    // the type specific block can come before "objectType", so only its position is kept on the way through
+    const char *variantValue[OBJECT_COUNT] = {};
+    uint32_t seen = 0;
+    if (!sj_consume(c, '}'))
+    {
+        for (;;)
+        {
+            char key[64];
+            if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))
+                return false;
+            sj_skip_ws(c);
+            bool ok;
+            if (kind == SJ_MEMBERS_PREFAB && sj_key(key, "name") && sj_first(seen, 1u << 0))
+                ok = *c.p == '"' ? sj_intern_string(c, &p->name) : sj_skip_value(c);
+            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "nametag") && sj_first(seen, 1u << 1))
+                ok = *c.p == '"' ? sj_intern_string(c, &scene->info[i].nametag) : sj_skip_value(c);
+            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "pos") && sj_first(seen, 1u << 2))
+                ok = sj_float_array(c, (float *)&scene->pos[i], 3);
+            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "rot") && sj_first(seen, 1u << 3))
+                ok = sj_float_array(c, (float *)&scene->rot[i], 4);
+            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "scale") && sj_first(seen, 1u << 4))
+                ok = sj_float_array(c, (float *)&scene->scale[i], 3);
+            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "prefab") && sj_first(seen, 1u << 5))
+            {
+                double d;
+                inst->hasPrefab = sj_is_number_start(*c.p);
+                ok = inst->hasPrefab ? sj_number(c, &d) : sj_skip_value(c);
+                if (ok && inst->hasPrefab)
+                    inst->prefab = sj_valueint(d);
+            }
+            else if (kind == SJ_MEMBERS_OBJECT && sj_key(key, "overrides") && sj_first(seen, 1u << 6))
+            {
+                if (*c.p == '{')
+                    inst->overrides = c.p;
+                ok = sj_skip_value(c);
+            }
+            else if (kind != SJ_MEMBERS_OVERRIDES && sj_key(key, "objectType") && sj_first(seen, 1u << 7))
+            {
+                bool assigned = *c.p == '"' || sj_is_number_start(*c.p);
+                int value = p->objectType;
+                ok = sj_enum(c, sj_lookup_objectType, OBJECT_PRIMITIVE, "Unknown object type \"%s\", defaulting to Primitive\n", &value);
+                p->objectType = (ObjectType)value;
+                if (assigned)
+                    *fields |= SceneFieldBit(SCENE_FIELD_OBJECT_TYPE);
+            }
+            else if (sj_key(key, "pipeline") && sj_first(seen, 1u << 8))
+            {
+                bool assigned = *c.p == '"' || sj_is_number_start(*c.p);
+                int value = p->pipeline;
+                ok = sj_enum(c, sj_lookup_pipeline, RENDER_DEFAULT, "Unknown pipeline \"%s\", defaulting to Default\n", &value);
+                p->pipeline = (RenderPipeline)value;
+                if (assigned)
+                    *fields |= SceneFieldBit(SCENE_FIELD_PIPELINE);
+            }
+            else if (sj_key(key, "primitiveData"))
+            {
+                if (!variantValue[OBJECT_PRIMITIVE])
+                    variantValue[OBJECT_PRIMITIVE] = c.p;
+                ok = sj_skip_value(c);
+            }
+            else if (sj_key(key, "heightfieldData"))
+            {
+                if (!variantValue[OBJECT_HEIGHTFIELD])
+                    variantValue[OBJECT_HEIGHTFIELD] = c.p;
+                ok = sj_skip_value(c);
+            }
+            else if (sj_key(key, "loaded_modelData"))
+            {
+                if (!variantValue[OBJECT_LOADED_MODEL])
+                    variantValue[OBJECT_LOADED_MODEL] = c.p;
+                ok = sj_skip_value(c);
+            }
+            else if (sj_key(key, "sky_sphereData"))
+            {
+                if (!variantValue[OBJECT_SKY_SPHERE])
+                    variantValue[OBJECT_SKY_SPHERE] = c.p;
+                ok = sj_skip_value(c);
+            }
+            else if (sj_key(key, "waterData"))
+            {
+                if (!variantValue[OBJECT_WATER])
+                    variantValue[OBJECT_WATER] = c.p;
+                ok = sj_skip_value(c);
+            }
+            else
+                ok = sj_skip_value(c);
+            if (!ok)
+                return false;
+            if (sj_consume(c, ','))
+                continue;
+            if (sj_consume(c, '}'))
+                break;
+            return false;
+        }
+    }
+
+    int type = p->objectType;
+    if (type < 0 || type >= OBJECT_COUNT || !variantValue[type])
+        return true;
+    SceneJsonCursor block = {variantValue[type]};
+    switch (type)
+    {
+    case OBJECT_PRIMITIVE:
+        return sj_parse_primitiveData(block, p, fields);
+    case OBJECT_HEIGHTFIELD:
+        return sj_parse_heightfieldData(block, p, fields);
+    case OBJECT_LOADED_MODEL:
+        return sj_parse_loaded_modelData(block, p, fields);
+    case OBJECT_SKY_SPHERE:
+        return sj_parse_sky_sphereData(block, p, fields);
+    case OBJECT_WATER:
+        return sj_parse_waterData(block, p, fields);
+    default:
+        return true;
+    }
+}
+
+static bool sj_parse_prefabs(SceneJsonCursor &c, Scene *scene)
+{
+    c.p++; // [
+    if (sj_consume(c, ']'))
+        return true;
+    for (;;)
+    {
+        sj_skip_ws(c);
+        ScenePrefab prefab = ScenePrefabDefault(); // non object items still make a default prefab, same as cJSON_ArrayForEach
+        uint32_t fields = 0;
+        bool ok = *c.p == '{' ? sj_parse_members(c, SJ_MEMBERS_PREFAB, &prefab, &fields, nullptr, 0, nullptr) : sj_skip_value(c);
+        if (!ok)
+            return false;
+        if (prefab.name == STRING_ID_EMPTY)
+            prefab.name = ScenePrefabDefaultName(prefab);
+        ScenePrefabAdd(*scene, prefab);
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, ']');
+    }
+}
+
+static bool sj_parse_scene_object(SceneJsonCursor &c, Scene *scene, int i, int prefabCount)
+{
+    ScenePrefab own = ScenePrefabDefault();
+    uint32_t fields = 0;
+    SjInstanceMembers inst = {};
+    bool ok = *c.p == '{' ? sj_parse_members(c, SJ_MEMBERS_OBJECT, &own, &fields, scene, i, &inst) : sj_skip_value(c);
+    if (!ok)
+        return false;
+
+    // no (usable) prefab: the object has its own type and data, the same data shares one prefab
+    uint32_t prefab;
+    if (inst.hasPrefab && inst.prefab >= 0 && inst.prefab < prefabCount)
+        prefab = (uint32_t)inst.prefab;
+    else
+        prefab = SceneFindOrAddPrefab(*scene, own);
+
+    if (inst.overrides)
+    {
+        SceneJsonCursor block = {inst.overrides};
+        ScenePrefab values = scene->prefabs[prefab];
+        uint32_t overridden = 0;
+        if (!sj_parse_members(block, SJ_MEMBERS_OVERRIDES, &values, &overridden, nullptr, 0, nullptr))
+            return false;
+        prefab = ScenePrefabVariant(*scene, prefab, overridden, values);
+    }
+    scene->prefab[i] = prefab;
+    return true;
+}
+
+static bool sj_parse_objects(SceneJsonCursor &c, Scene *scene, int prefabCount)
+{
+    c.p++; // [
+    if (sj_consume(c, ']'))
+        return true;
+    for (;;)
+    {
+        sj_skip_ws(c);
+        SceneAddObject(*scene, SCENE_PREFAB_NONE); // non object items still make a default object, same as cJSON_ArrayForEach
+        if (!sj_parse_scene_object(c, scene, scene->objectCount - 1, prefabCount))
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        return sj_consume(c, ']');
+    }
+}
+
+static bool sj_parse_root(SceneJsonCursor &c, Scene *scene)
+{
+    sj_skip_ws(c);
+    if (*c.p != '{')
+        return sj_skip_value(c); // valid json without an "objects" member is an empty scene
+    c.p++;
+    if (sj_consume(c, '}'))
+        return true;
+
+    // objects refer to prefabs by index, if "objects" comes first (old files, no prefabs at all) it is read at the end
+    const char *objects = nullptr;
+    uint32_t seen = 0;
+    for (;;)
+    {
+        char key[64];
+        if (sj_string(c, key, sizeof(key)) < 0 || !sj_consume(c, ':'))
+            return false;
+        sj_skip_ws(c);
+        bool ok;
+        if (sj_key(key, "objects") && sj_first(seen, 1u << 0))
+        {
+            if (*c.p == '[' && (seen & (1u << 2)))
+                ok = sj_parse_objects(c, scene, (int)scene->prefabs.size());
+            else
+            {
+                if (*c.p == '[')
+                    objects = c.p;
+                ok = sj_skip_value(c);
+            }
+        }
+        else if (sj_key(key, "objectCount") && sj_first(seen, 1u << 1) && sj_is_number_start(*c.p))
+        {
+            // scene_to_json writes the count before the array, good enough as a reserve hint
+            double d;
+            ok = sj_number(c, &d);
+            if (ok && d > 0.0 && d < 16.0 * 1024 * 1024 && scene->objectCount == 0)
+                SceneReserve(*scene, (int)d);
+        }
+        else if (sj_key(key, "prefabs") && sj_first(seen, 1u << 2))
+            ok = *c.p == '[' ? sj_parse_prefabs(c, scene) : sj_skip_value(c);
+        else
+            ok = sj_skip_value(c);
+        if (!ok)
+            return false;
+        if (sj_consume(c, ','))
+            continue;
+        if (!sj_consume(c, '}'))
+            return false;
+        break;
+    }
+
+    if (!objects)
+        return true;
+    SceneJsonCursor block = {objects};
+    return sj_parse_objects(block, scene, (int)scene->prefabs.size());
+}
+
+// returns 1 on success, 0 on failure. unlike scene_from_json a malformed file leaves the scene empty,
+// the text is not validated up front
+int scene_from_json_stream(const char *json, Scene *scene)
+{
+    if (!json)
+        return 0;
+    SceneJsonCursor c = {json};
+    if ((unsigned char)c.p[0] == 0xEF && (unsigned char)c.p[1] == 0xBB && (unsigned char)c.p[2] == 0xBF)
+        c.p += 3; // utf-8 bom, cJSON_Parse skips it too
+
+    SceneClear(*scene);
+    if (!sj_parse_root(c, scene))
+    {
+        SceneClear(*scene);
+        return 0;
+    }
+    return 1;
+}
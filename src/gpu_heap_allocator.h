@@ -0,0 +1,271 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// placement of resources in a pool of equally sized heaps, buddy style: a heap is split in halves down to minBlock,
+// an allocation takes the smallest block that holds it and a freed block merges with its buddy whenever that is free
+// too. blocks of size s sit at multiples of s, so any alignment up to the block size comes for free (a larger one just
+// asks for a bigger block). the price is the rounding up to a power of two, GpuHeapReport shows it. heaps are added
+// by the caller when nothing fits and are never dropped. no D3D in here, a heap is an index and offsets are bytes
+
+#define GPU_HEAP_MAX_ORDERS 16      // heapSize is at most minBlock << (GPU_HEAP_MAX_ORDERS - 1)
+#define GPU_HEAP_DEFAULT_BLOCK 65536 // D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT
+#define GPU_HEAP_NONE UINT32_MAX
+
+struct GpuHeapAllocation
+{
+    uint32_t heap = GPU_HEAP_NONE;
+    uint64_t offset = 0;
+    uint64_t size = 0;      // the block's, a power of two times minBlock
+    uint64_t requested = 0; // what was asked for
+};
+
+struct GpuBuddyHeap
+{
+    std::vector<uint32_t> freeBlocks[GPU_HEAP_MAX_ORDERS]; // first block (in minBlocks) of the free ones, by order
+    std::vector<uint8_t> allocatedOrder; // per minBlock: order + 1 of the allocation starting there, 0 for none
+    uint64_t used = 0;
+};
+
+struct GpuHeapPool
+{
+    uint64_t heapSize = 0;
+    uint64_t minBlock = 0;
+    int orders = 0; // heapSize == minBlock << (orders - 1)
+    std::vector<GpuBuddyHeap> heaps;
+
+    // stats (shown in Debug Controls)
+    uint64_t used = 0;      // block bytes
+    uint64_t requested = 0; // of those, asked for
+    uint64_t highWater = 0;
+    uint32_t allocations = 0; // live ones
+    int failed = 0;           // allocations that didn't fit any heap
+};
+
+struct GpuHeapReport
+{
+    uint32_t heaps;
+    uint32_t emptyHeaps;
+    uint64_t capacity;
+    uint64_t used;
+    uint64_t requested;
+    uint64_t free;
+    uint64_t largestFree;
+    uint32_t freeBlocks;
+    uint32_t heapsIfCompacted; // what the live blocks would need packed tightly, biggest first
+    float rounding;            // of the used bytes, the share lost to rounding up to a block
+    float fragmentation;       // of the free bytes, the share not in the largest free block
+};
+
+// false when heapSize isn't minBlock times a power of two (within GPU_HEAP_MAX_ORDERS) or minBlock isn't a power of two
+inline bool GpuHeapPoolInit(GpuHeapPool &pool, uint64_t heapSize, uint64_t minBlock = GPU_HEAP_DEFAULT_BLOCK)
+{
+    pool = GpuHeapPool();
+    if (minBlock == 0 || (minBlock & (minBlock - 1)) != 0)
+        return false;
+    for (int orders = 1; orders <= GPU_HEAP_MAX_ORDERS; ++orders)
+    {
+        if ((minBlock << (orders - 1)) == heapSize)
+        {
+            pool.heapSize = heapSize;
+            pool.minBlock = minBlock;
+            pool.orders = orders;
+            return true;
+        }
+    }
+    return false;
+}
+
+// a new, entirely free heap. returns its index, the caller creates the heap it stands for under the same one
+inline uint32_t GpuHeapPoolAddHeap(GpuHeapPool &pool)
+{
+    pool.heaps.emplace_back();
+    GpuBuddyHeap &heap = pool.heaps.back();
+    heap.allocatedOrder.assign((size_t)(pool.heapSize / pool.minBlock), 0);
+    heap.freeBlocks[pool.orders - 1].push_back(0);
+    return (uint32_t)pool.heaps.size() - 1;
+}
+
+// the order of the smallest block holding size bytes aligned to alignment, -1 when even a whole heap is too small
+inline int GpuHeapOrderFor(const GpuHeapPool &pool, uint64_t size, uint64_t alignment)
+{
+    uint64_t need = size > alignment ? size : alignment;
+    int order = 0;
+    while (order < pool.orders && (pool.minBlock << order) < need)
+        order++;
+    return order < pool.orders ? order : -1;
+}
+
+// first heap with a block of order or bigger, lowest block of the smallest such order (keeps the early heaps and the
+// low offsets busy, so the rest stays in big pieces). split down to order, the upper halves go on the free lists
+uint64_t GpuBuddyAlloc(const GpuHeapPool &pool, GpuBuddyHeap &heap, int order)
+{
+    int from = order;
+    while (from < pool.orders && heap.freeBlocks[from].empty())
+        from++;
+    if (from == pool.orders)
+        return UINT64_MAX;
+
+    std::vector<uint32_t> &list = heap.freeBlocks[from];
+    size_t lowest = 0;
+    for (size_t i = 1; i < list.size(); ++i)
+        lowest = list[i] < list[lowest] ? i : lowest;
+    uint32_t block = list[lowest];
+    list[lowest] = list.back();
+    list.pop_back();
+
+    while (from > order)
+    {
+        from--;
+        heap.freeBlocks[from].push_back(block + (1u << from));
+    }
+    heap.allocatedOrder[block] = (uint8_t)(order + 1);
+    heap.used += pool.minBlock << order;
+    return (uint64_t)block * pool.minBlock;
+}
+
+// heap == GPU_HEAP_NONE when nothing fits: the caller may add a heap and try again (if size fits one at all)
+GpuHeapAllocation GpuHeapAlloc(GpuHeapPool &pool, uint64_t size, uint64_t alignment)
+{
+    GpuHeapAllocation allocation;
+    int order = size > 0 ? GpuHeapOrderFor(pool, size, alignment) : -1;
+    for (uint32_t h = 0; order >= 0 && h < pool.heaps.size(); ++h)
+    {
+        uint64_t offset = GpuBuddyAlloc(pool, pool.heaps[h], order);
+        if (offset == UINT64_MAX)
+            continue;
+        allocation.heap = h;
+        allocation.offset = offset;
+        allocation.size = pool.minBlock << order;
+        allocation.requested = size;
+        pool.used += allocation.size;
+        pool.requested += size;
+        pool.highWater = pool.used > pool.highWater ? pool.used : pool.highWater;
+        pool.allocations++;
+        return allocation;
+    }
+    pool.failed++;
+    return allocation;
+}
+
+// merges with the buddy for as long as it's free. false (and nothing freed) when allocation isn't a live one
+bool GpuHeapFree(GpuHeapPool &pool, const GpuHeapAllocation &allocation)
+{
+    if (allocation.heap >= pool.heaps.size() || allocation.offset % pool.minBlock != 0 || allocation.offset >= pool.heapSize)
+        return false;
+    GpuBuddyHeap &heap = pool.heaps[allocation.heap];
+    uint32_t block = (uint32_t)(allocation.offset / pool.minBlock);
+    int order = (int)heap.allocatedOrder[block] - 1;
+    if (order < 0 || (pool.minBlock << order) != allocation.size)
+        return false;
+
+    heap.allocatedOrder[block] = 0;
+    heap.used -= allocation.size;
+    pool.used -= allocation.size;
+    pool.requested -= allocation.requested;
+    pool.allocations--;
+    while (order < pool.orders - 1)
+    {
+        uint32_t buddy = block ^ (1u << order);
+        std::vector<uint32_t> &list = heap.freeBlocks[order];
+        size_t i = 0;
+        while (i < list.size() && list[i] != buddy)
+            i++;
+        if (i == list.size())
+            break;
+        list[i] = list.back();
+        list.pop_back();
+        block = block < buddy ? block : buddy;
+        order++;
+    }
+    heap.freeBlocks[order].push_back(block);
+    return true;
+}
+
+// what a defragmentation would buy: heapsIfCompacted against heaps, and how scattered the free space is
+GpuHeapReport GpuHeapPoolReport(const GpuHeapPool &pool)
+{
+    GpuHeapReport report = {};
+    report.heaps = (uint32_t)pool.heaps.size();
+    report.capacity = pool.heapSize * report.heaps;
+    report.used = pool.used;
+    report.requested = pool.requested;
+    report.free = report.capacity - pool.used;
+    for (const GpuBuddyHeap &heap : pool.heaps)
+    {
+        report.emptyHeaps += heap.used == 0;
+        for (int order = 0; order < pool.orders; ++order)
+        {
+            report.freeBlocks += (uint32_t)heap.freeBlocks[order].size();
+            if (!heap.freeBlocks[order].empty() && (pool.minBlock << order) > report.largestFree)
+                report.largestFree = pool.minBlock << order;
+        }
+    }
+    // power of two blocks sorted biggest first pack a power of two heap without gaps
+    report.heapsIfCompacted = pool.heapSize ? (uint32_t)((pool.used + pool.heapSize - 1) / pool.heapSize) : 0;
+    report.rounding = pool.used ? 1.0f - (float)pool.requested / (float)pool.used : 0.0f;
+    report.fragmentation = report.free ? 1.0f - (float)report.largestFree / (float)report.free : 0.0f;
+    return report;
+}
+
+// true if every heap is covered exactly once by its free and allocated blocks, every block sits at a multiple of its
+// size and no two free buddies were left unmerged
+bool GpuHeapPoolValidate(const GpuHeapPool &pool)
+{
+    uint64_t used = 0;
+    uint32_t allocations = 0;
+    uint32_t blocks = pool.heapSize && pool.minBlock ? (uint32_t)(pool.heapSize / pool.minBlock) : 0;
+    std::vector<uint8_t> covered;
+    std::vector<uint8_t> freeOrder;
+    for (const GpuBuddyHeap &heap : pool.heaps)
+    {
+        covered.assign(blocks, 0);
+        freeOrder.assign(blocks, 0);
+        uint64_t heapUsed = 0;
+        auto cover = [&](uint32_t block, int order)
+        {
+            uint32_t count = 1u << order;
+            if (block % count != 0 || block + count > blocks)
+                return false;
+            for (uint32_t k = block; k < block + count; ++k)
+            {
+                if (covered[k]++)
+                    return false;
+            }
+            return true;
+        };
+        for (int order = 0; order < pool.orders; ++order)
+        {
+            for (uint32_t block : heap.freeBlocks[order])
+            {
+                if (!cover(block, order))
+                    return false;
+                freeOrder[block] = (uint8_t)(order + 1);
+            }
+        }
+        for (uint32_t block = 0; block < blocks; ++block)
+        {
+            int order = (int)heap.allocatedOrder[block] - 1;
+            if (order < 0)
+                continue;
+            if (order >= pool.orders || !cover(block, order))
+                return false;
+            heapUsed += pool.minBlock << order;
+            allocations++;
+        }
+        for (uint32_t block = 0; block < blocks; ++block)
+        {
+            if (!covered[block])
+                return false;
+            int order = (int)freeOrder[block] - 1;
+            if (order >= 0 && order < pool.orders - 1 && freeOrder[block ^ (1u << order)] == order + 1)
+                return false;
+        }
+        if (heapUsed != heap.used)
+            return false;
+        used += heapUsed;
+    }
+    return used == pool.used && allocations == pool.allocations && pool.requested <= pool.used;
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// ExecuteIndirect argument building: the draws of a frame compacted into one array of fixed size records, each one a
+// full draw for the command signature in renderer_dx12.cpp (m_drawCommandSignature): bind the vertex and index
+// buffers, set the per draw root constants, draw indexed. consecutive records with the same pipeline form a bucket,
+// submitted with one ExecuteIndirect. the record fields mirror the D3D12 argument structs byte for byte (checked by
+// static_asserts in main.cpp) but no D3D in here, so the layout can be built and checked by the null backend
+
+#define INDIRECT_DRAW_CONSTANTS 2 // dwords of PerDrawRootConstants set per record
+
+struct IndirectVertexBufferView // D3D12_VERTEX_BUFFER_VIEW
+{
+    uint64_t location;
+    uint32_t sizeInBytes;
+    uint32_t strideInBytes;
+};
+
+struct IndirectIndexBufferView // D3D12_INDEX_BUFFER_VIEW
+{
+    uint64_t location;
+    uint32_t sizeInBytes;
+    uint32_t format;
+};
+
+struct IndirectDrawIndexedArgs // D3D12_DRAW_INDEXED_ARGUMENTS
+{
+    uint32_t indexCountPerInstance;
+    uint32_t instanceCount;
+    uint32_t startIndexLocation;
+    int32_t baseVertexLocation;
+    uint32_t startInstanceLocation;
+};
+
+// one command signature stride. the signature reads the first 60 bytes, mesh rides along for checks and dumps
+struct IndirectDrawRecord
+{
+    IndirectVertexBufferView vertexView;
+    IndirectIndexBufferView indexView;
+    uint32_t constants[INDIRECT_DRAW_CONSTANTS];
+    IndirectDrawIndexedArgs draw;
+    uint32_t mesh;
+};
+static_assert(sizeof(IndirectDrawRecord) == 64, "IndirectDrawRecord is the command signature's byte stride");
+#define INDIRECT_DRAW_SIGNATURE_BYTES 60 // what the GPU reads of a record
+
+// the buffers and index count of a mesh id, a table of these is the builder's only view of the meshes
+struct IndirectMeshViews
+{
+    IndirectVertexBufferView vertexView;
+    IndirectIndexBufferView indexView;
+    uint32_t indexCount;
+};
+
+// a draw to compact, in submission order
+struct IndirectDrawInput
+{
+    uint32_t pipeline; // bucket key, records only share an ExecuteIndirect when it is equal
+    uint32_t mesh;     // into the mesh table
+    uint32_t constants[INDIRECT_DRAW_CONSTANTS];
+    uint32_t instanceCount;
+};
+
+struct IndirectBucket
+{
+    uint32_t pipeline;
+    uint32_t first; // record range
+    uint32_t count;
+};
+
+struct IndirectDrawList
+{
+    std::vector<IndirectDrawRecord> records;
+    std::vector<IndirectBucket> buckets;
+    int skipped = 0; // inputs dropped by the last build: unknown or empty mesh, no instances
+};
+
+inline void IndirectDrawsReset(IndirectDrawList &list)
+{
+    list.records.clear();
+    list.buckets.clear();
+    list.skipped = 0;
+}
+
+// compacts the visible inputs (visible == nullptr: all of them) into list's records, keeping their order. a bucket
+// starts wherever the pipeline differs from the previous record's, so sorted input gives one bucket per pipeline.
+// returns the record count
+int IndirectDrawsBuild(const IndirectDrawInput *draws, int count, const uint8_t *visible, const IndirectMeshViews *meshes,
+                       uint32_t meshCount, IndirectDrawList &list)
+{
+    IndirectDrawsReset(list);
+    list.records.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        if (visible && !visible[i])
+            continue;
+        const IndirectDrawInput &input = draws[i];
+        if (input.mesh >= meshCount || meshes[input.mesh].indexCount == 0 || input.instanceCount == 0)
+        {
+            list.skipped++;
+            continue;
+        }
+
+        const IndirectMeshViews &mesh = meshes[input.mesh];
+        IndirectDrawRecord record;
+        record.vertexView = mesh.vertexView;
+        record.indexView = mesh.indexView;
+        memcpy(record.constants, input.constants, sizeof(record.constants));
+        record.draw = {mesh.indexCount, input.instanceCount, 0, 0, 0};
+        record.mesh = input.mesh;
+
+        uint32_t index = (uint32_t)list.records.size();
+        if (list.buckets.empty() || list.buckets.back().pipeline != input.pipeline)
+            list.buckets.push_back({input.pipeline, index, 0});
+        list.buckets.back().count++;
+        list.records.push_back(record);
+    }
+    return (int)list.records.size();
+}
+
+// true if every record matches the mesh table and the buckets cover the records in order with their pipelines
+// changing from one bucket to the next
+bool IndirectDrawsValidate(const IndirectDrawList &list, const IndirectMeshViews *meshes, uint32_t meshCount)
+{
+    uint32_t next = 0;
+    for (size_t b = 0; b < list.buckets.size(); ++b)
+    {
+        const IndirectBucket &bucket = list.buckets[b];
+        if (bucket.first != next || bucket.count == 0 || (b > 0 && list.buckets[b - 1].pipeline == bucket.pipeline))
+            return false;
+        next += bucket.count;
+    }
+    if (next != list.records.size())
+        return false;
+
+    for (const IndirectDrawRecord &record : list.records)
+    {
+        if (record.mesh >= meshCount)
+            return false;
+        const IndirectMeshViews &mesh = meshes[record.mesh];
+        if (memcmp(&record.vertexView, &mesh.vertexView, sizeof(mesh.vertexView)) != 0 ||
+            memcmp(&record.indexView, &mesh.indexView, sizeof(mesh.indexView)) != 0 ||
+            record.draw.indexCountPerInstance != mesh.indexCount || record.draw.instanceCount == 0 ||
+            record.draw.startIndexLocation != 0 || record.draw.baseVertexLocation != 0 || record.draw.startInstanceLocation != 0)
+            return false;
+    }
+    return true;
+}
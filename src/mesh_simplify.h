@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <math.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+// load time simplification for model LODs by vertex clustering: vertices are snapped to a grid of cells, every cell
+// keeps one of its own vertices (the one nearest the cell's average) and triangles are remapped to those, dropping
+// the ones that collapse. no new vertices, so a coarser level is only another index list over the same vertex buffer.
+// vertices facing different ways (by the dominant axis of the normal) don't merge, so thin shells keep both sides.
+// no D3D in here, positions and normals are read as floats with a stride
+
+// one bucket per grid cell and normal direction. 20 bits per axis is plenty for the grids used here
+inline uint64_t MeshClusterKey(const float *position, const float *normal, const float origin[3], float invCellSize)
+{
+    uint64_t key = 0;
+    for (int a = 0; a < 3; ++a)
+    {
+        int64_t cell = (int64_t)floorf((position[a] - origin[a]) * invCellSize);
+        key = (key << 20) | (uint64_t)(cell < 0 ? 0 : (cell > 0xFFFFF ? 0xFFFFF : cell));
+    }
+    int axis = 0;
+    for (int a = 1; a < 3; ++a)
+    {
+        if (fabsf(normal[a]) > fabsf(normal[axis]))
+            axis = a;
+    }
+    return (key << 3) | (uint64_t)(axis * 2 + (normal[axis] < 0.0f));
+}
+
+// writes the clustered triangles of indices into out (replacing it). cellSize <= 0 copies indices unchanged.
+// stride is in floats between consecutive vertices. returns the triangle count of out
+uint32_t MeshSimplifyCluster(const float *positions, const float *normals, uint32_t stride, uint32_t vertexCount,
+                             const uint32_t *indices, uint32_t indexCount, float cellSize, std::vector<uint32_t> &out)
+{
+    out.clear();
+    if (cellSize <= 0.0f)
+    {
+        out.assign(indices, indices + indexCount);
+        return indexCount / 3;
+    }
+
+    float origin[3] = {INFINITY, INFINITY, INFINITY};
+    for (uint32_t v = 0; v < vertexCount; ++v)
+    {
+        for (int a = 0; a < 3; ++a)
+            origin[a] = fminf(origin[a], positions[v * stride + a]);
+    }
+    float invCellSize = 1.0f / cellSize;
+
+    // cell averages, then the vertex nearest each one
+    struct Cluster
+    {
+        float sum[3];
+        uint32_t count;
+        uint32_t representative;
+        float bestDistanceSq;
+    };
+    std::unordered_map<uint64_t, uint32_t> clusterOf;
+    std::vector<Cluster> clusters;
+    std::vector<uint32_t> vertexCluster(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; ++v)
+    {
+        const float *p = &positions[v * stride];
+        auto inserted = clusterOf.emplace(MeshClusterKey(p, &normals[v * stride], origin, invCellSize), (uint32_t)clusters.size());
+        if (inserted.second)
+            clusters.push_back({{0.0f, 0.0f, 0.0f}, 0, v, INFINITY});
+        Cluster &cluster = clusters[inserted.first->second];
+        for (int a = 0; a < 3; ++a)
+            cluster.sum[a] += p[a];
+        cluster.count++;
+        vertexCluster[v] = inserted.first->second;
+    }
+    for (uint32_t v = 0; v < vertexCount; ++v)
+    {
+        Cluster &cluster = clusters[vertexCluster[v]];
+        const float *p = &positions[v * stride];
+        float distanceSq = 0.0f;
+        for (int a = 0; a < 3; ++a)
+        {
+            float d = p[a] - cluster.sum[a] / (float)cluster.count;
+            distanceSq += d * d;
+        }
+        if (distanceSq < cluster.bestDistanceSq)
+        {
+            cluster.bestDistanceSq = distanceSq;
+            cluster.representative = v;
+        }
+    }
+
+    // remap, drop degenerate triangles, then duplicates (rotated so the smallest index leads, winding kept)
+    struct Triangle
+    {
+        uint32_t v[3];
+        bool operator<(const Triangle &o) const
+        {
+            return v[0] != o.v[0] ? v[0] < o.v[0] : (v[1] != o.v[1] ? v[1] < o.v[1] : v[2] < o.v[2]);
+        }
+        bool operator==(const Triangle &o) const { return v[0] == o.v[0] && v[1] == o.v[1] && v[2] == o.v[2]; }
+    };
+    std::vector<Triangle> triangles;
+    triangles.reserve(indexCount / 3);
+    for (uint32_t t = 0; t + 2 < indexCount; t += 3)
+    {
+        uint32_t a = clusters[vertexCluster[indices[t]]].representative;
+        uint32_t b = clusters[vertexCluster[indices[t + 1]]].representative;
+        uint32_t c = clusters[vertexCluster[indices[t + 2]]].representative;
+        if (a == b || b == c || a == c)
+            continue;
+        if (b < a && b < c)
+            triangles.push_back({{b, c, a}});
+        else if (c < a && c < b)
+            triangles.push_back({{c, a, b}});
+        else
+            triangles.push_back({{a, b, c}});
+    }
+    std::sort(triangles.begin(), triangles.end());
+    triangles.erase(std::unique(triangles.begin(), triangles.end()), triangles.end());
+
+    out.reserve(triangles.size() * 3);
+    for (const Triangle &triangle : triangles)
+        out.insert(out.end(), triangle.v, triangle.v + 3);
+    return (uint32_t)triangles.size();
+}
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+#include <xmmintrin.h>
+
+#include "bvh.h"
+
+// coarse software depth buffer for occlusion culling, CPU only. depth is reverse-Z like the real depth buffer (1 at
+// the near plane, 0 at the far plane and where nothing was drawn), so bigger is closer and each pixel keeps the max.
+//
+// occluders are proxy triangle meshes that lie inside opaque geometry (a cube's own box, a box inside a cylinder, a
+// heightfield grid under the terrain). they are rasterized at pixel centres with back faces dropped (d3d convention,
+// clockwise is front), triangles touching the near plane are dropped too. a pixel whose centre is covered may still
+// be partly open, so the result is eroded: every pixel takes the farthest depth of its 3x3 neighbourhood. a box is
+// hidden when every pixel of its screen rectangle, grown by one pixel for the same reason, has an occluder nearer
+// than the nearest point of the box. slits between two occluders thinner than a pixel still count as closed.
+//
+// the rows are split in bands that rasterize (every band walks all the triangles, clipped to its own rows) and then
+// erode independently, so the bands and the tests can run on different threads. rows go 4 pixels at a time with SSE
+
+#define OCCLUSION_WIDTH 256
+#define OCCLUSION_HEIGHT 128
+#define OCCLUSION_BAND_ROWS 16
+#define OCCLUSION_BANDS (OCCLUSION_HEIGHT / OCCLUSION_BAND_ROWS)
+#define OCCLUSION_MIN_W 1e-3f // clip space w below this counts as touching the near plane
+static_assert(OCCLUSION_WIDTH % 4 == 0 && OCCLUSION_HEIGHT % OCCLUSION_BAND_ROWS == 0, "rows go 4 pixels at a time, bands split the rows evenly");
+
+struct OcclusionTriangle
+{
+    float x[3], y[3], z[3]; // pixels (y down) and depth
+    int minX, maxX, minY, maxY; // pixel centres it can cover, inclusive and on screen
+};
+
+struct OcclusionBuffer
+{
+    DirectX::XMFLOAT4X4 viewProj;
+    std::vector<float> rasterized; // OCCLUSION_WIDTH * OCCLUSION_HEIGHT, straight from the triangles
+    std::vector<float> depth;      // eroded, what the tests read
+    std::vector<OcclusionTriangle> triangles;
+    std::vector<DirectX::XMFLOAT4> projected; // scratch, one mesh's vertices (pixel x, pixel y, depth, 0 when too near)
+};
+
+// starts a frame: drops last frame's triangles. the depth is cleared band by band by OcclusionRasterizeBand
+void OcclusionBegin(OcclusionBuffer &ob, DirectX::FXMMATRIX viewProj)
+{
+    DirectX::XMStoreFloat4x4(&ob.viewProj, viewProj);
+    ob.rasterized.resize(OCCLUSION_WIDTH * OCCLUSION_HEIGHT);
+    ob.depth.resize(OCCLUSION_WIDTH * OCCLUSION_HEIGHT);
+    ob.triangles.clear();
+}
+
+// world space point to pixels and depth through m (world * viewProj). false when it is at or behind the near plane
+inline bool OcclusionProject(const DirectX::XMFLOAT4X4 &m, float x, float y, float z, DirectX::XMFLOAT4 &out)
+{
+    float cx = x * m.m[0][0] + y * m.m[1][0] + z * m.m[2][0] + m.m[3][0];
+    float cy = x * m.m[0][1] + y * m.m[1][1] + z * m.m[2][1] + m.m[3][1];
+    float cz = x * m.m[0][2] + y * m.m[1][2] + z * m.m[2][2] + m.m[3][2];
+    float cw = x * m.m[0][3] + y * m.m[1][3] + z * m.m[2][3] + m.m[3][3];
+    if (cw < OCCLUSION_MIN_W)
+        return false;
+    float invW = 1.0f / cw;
+    out = {(cx * invW * 0.5f + 0.5f) * OCCLUSION_WIDTH, (0.5f - cy * invW * 0.5f) * OCCLUSION_HEIGHT, cz * invW, 1.0f};
+    return true;
+}
+
+// adds an occluder mesh, positions in object space and world row major (v * M). returns the triangles kept
+int OcclusionAddMesh(OcclusionBuffer &ob, const DirectX::XMFLOAT4X4 &world, const DirectX::XMFLOAT3 *positions, int vertexCount,
+                     const uint32_t *indices, int indexCount)
+{
+    DirectX::XMFLOAT4X4 m;
+    DirectX::XMStoreFloat4x4(&m, DirectX::XMMatrixMultiply(DirectX::XMLoadFloat4x4(&world), DirectX::XMLoadFloat4x4(&ob.viewProj)));
+
+    ob.projected.resize(vertexCount);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        if (!OcclusionProject(m, positions[v].x, positions[v].y, positions[v].z, ob.projected[v]))
+            ob.projected[v].w = 0.0f;
+    }
+
+    int kept = 0;
+    for (int t = 0; t + 2 < indexCount; t += 3)
+    {
+        const DirectX::XMFLOAT4 &a = ob.projected[indices[t]];
+        const DirectX::XMFLOAT4 &b = ob.projected[indices[t + 1]];
+        const DirectX::XMFLOAT4 &c = ob.projected[indices[t + 2]];
+        if (a.w == 0.0f || b.w == 0.0f || c.w == 0.0f)
+            continue;
+
+        // y points down, so clockwise on screen (the front) is a positive area here
+        float area = (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+        if (area <= 0.0f)
+            continue;
+
+        OcclusionTriangle tri = {{a.x, b.x, c.x}, {a.y, b.y, c.y}, {a.z, b.z, c.z}, 0, 0, 0, 0};
+        tri.minX = (int)ceilf(fminf(a.x, fminf(b.x, c.x)) - 0.5f);
+        tri.maxX = (int)floorf(fmaxf(a.x, fmaxf(b.x, c.x)) - 0.5f);
+        tri.minY = (int)ceilf(fminf(a.y, fminf(b.y, c.y)) - 0.5f);
+        tri.maxY = (int)floorf(fmaxf(a.y, fmaxf(b.y, c.y)) - 0.5f);
+        tri.minX = tri.minX < 0 ? 0 : tri.minX;
+        tri.minY = tri.minY < 0 ? 0 : tri.minY;
+        tri.maxX = tri.maxX > OCCLUSION_WIDTH - 1 ? OCCLUSION_WIDTH - 1 : tri.maxX;
+        tri.maxY = tri.maxY > OCCLUSION_HEIGHT - 1 ? OCCLUSION_HEIGHT - 1 : tri.maxY;
+        if (tri.minX > tri.maxX || tri.minY > tri.maxY)
+            continue; // off screen or between pixel centres
+        ob.triangles.push_back(tri);
+        kept++;
+    }
+    return kept;
+}
+
+// a solid box occluder, local is the box in object space
+int OcclusionAddBox(OcclusionBuffer &ob, const DirectX::XMFLOAT4X4 &world, const AABB &local)
+{
+    // corner k has x from bit 0, y from bit 1, z from bit 2. faces wound clockwise seen from outside (left handed)
+    static const uint32_t boxIndices[36] = {
+        0, 2, 3, 0, 3, 1, // -z
+        4, 5, 7, 4, 7, 6, // +z
+        0, 4, 6, 0, 6, 2, // -x
+        1, 3, 7, 1, 7, 5, // +x
+        0, 1, 5, 0, 5, 4, // -y
+        2, 6, 7, 2, 7, 3, // +y
+    };
+    DirectX::XMFLOAT3 corners[8];
+    for (int k = 0; k < 8; ++k)
+        corners[k] = {k & 1 ? local.max.x : local.min.x, k & 2 ? local.max.y : local.min.y, k & 4 ? local.max.z : local.min.z};
+    return OcclusionAddMesh(ob, world, corners, 8, boxIndices, 36);
+}
+
+// clears band's rows and rasterizes every triangle into them
+void OcclusionRasterizeBand(OcclusionBuffer &ob, int band)
+{
+    int rowBegin = band * OCCLUSION_BAND_ROWS;
+    int rowEnd = rowBegin + OCCLUSION_BAND_ROWS;
+    float *depth = ob.rasterized.data();
+    for (int i = rowBegin * OCCLUSION_WIDTH; i < rowEnd * OCCLUSION_WIDTH; i += 4)
+        _mm_storeu_ps(depth + i, _mm_setzero_ps());
+
+    const __m128 laneOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f); // pixel centres
+    for (const OcclusionTriangle &tri : ob.triangles)
+    {
+        int y0 = tri.minY > rowBegin ? tri.minY : rowBegin;
+        int y1 = tri.maxY < rowEnd - 1 ? tri.maxY : rowEnd - 1;
+        if (y0 > y1)
+            continue;
+
+        // edge i runs from vertex i to the next, its function is >= 0 inside. depth is a plane in pixel space. the
+        // constant is taken at the same end of the edge whichever way it runs, so the triangle on the other side of a
+        // shared edge gets exactly the negated function and a pixel centre on the edge can't fall out of both
+        float ea[3], eb[3], ec[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            int j = (i + 1) % 3;
+            int k = tri.x[i] < tri.x[j] || (tri.x[i] == tri.x[j] && tri.y[i] < tri.y[j]) ? i : j;
+            ea[i] = -(tri.y[j] - tri.y[i]);
+            eb[i] = tri.x[j] - tri.x[i];
+            ec[i] = -(ea[i] * tri.x[k] + eb[i] * tri.y[k]);
+        }
+        float dx1 = tri.x[1] - tri.x[0], dy1 = tri.y[1] - tri.y[0], dz1 = tri.z[1] - tri.z[0];
+        float dx2 = tri.x[2] - tri.x[0], dy2 = tri.y[2] - tri.y[0], dz2 = tri.z[2] - tri.z[0];
+        float invArea = 1.0f / (dx1 * dy2 - dx2 * dy1);
+        float za = (dz1 * dy2 - dz2 * dy1) * invArea;
+        float zb = (dx1 * dz2 - dx2 * dz1) * invArea;
+        float zc = tri.z[0] - za * tri.x[0] - zb * tri.y[0];
+
+        int xStart = tri.minX & ~3;
+        for (int y = y0; y <= y1; ++y)
+        {
+            float py = (float)y + 0.5f;
+            __m128 e0Row = _mm_set1_ps(eb[0] * py + ec[0]);
+            __m128 e1Row = _mm_set1_ps(eb[1] * py + ec[1]);
+            __m128 e2Row = _mm_set1_ps(eb[2] * py + ec[2]);
+            __m128 zRow = _mm_set1_ps(zb * py + zc);
+            float *row = depth + y * OCCLUSION_WIDTH;
+            for (int x = xStart; x <= tri.maxX; x += 4)
+            {
+                __m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneOffsets);
+                __m128 e0 = _mm_add_ps(e0Row, _mm_mul_ps(_mm_set1_ps(ea[0]), px));
+                __m128 e1 = _mm_add_ps(e1Row, _mm_mul_ps(_mm_set1_ps(ea[1]), px));
+                __m128 e2 = _mm_add_ps(e2Row, _mm_mul_ps(_mm_set1_ps(ea[2]), px));
+                __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, _mm_setzero_ps()), _mm_cmpge_ps(e1, _mm_setzero_ps())),
+                                           _mm_cmpge_ps(e2, _mm_setzero_ps()));
+                if (_mm_movemask_ps(inside) == 0)
+                    continue;
+                __m128 z = _mm_add_ps(zRow, _mm_mul_ps(_mm_set1_ps(za), px));
+                __m128 old = _mm_loadu_ps(row + x);
+                __m128 nearest = _mm_max_ps(old, z);
+                _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, old)));
+            }
+        }
+    }
+}
+
+// writes band's rows of depth from rasterized, once every band is rasterized (it reads a row above and below)
+void OcclusionErodeBand(OcclusionBuffer &ob, int band)
+{
+    float farthest[OCCLUSION_WIDTH + 8]; // the column minimum of three rows, an edge pixel repeated on both sides
+    for (int y = band * OCCLUSION_BAND_ROWS; y < (band + 1) * OCCLUSION_BAND_ROWS; ++y)
+    {
+        const float *above = ob.rasterized.data() + (y > 0 ? y - 1 : y) * OCCLUSION_WIDTH;
+        const float *row = ob.rasterized.data() + y * OCCLUSION_WIDTH;
+        const float *below = ob.rasterized.data() + (y < OCCLUSION_HEIGHT - 1 ? y + 1 : y) * OCCLUSION_WIDTH;
+        for (int x = 0; x < OCCLUSION_WIDTH; x += 4)
+            _mm_storeu_ps(farthest + 1 + x, _mm_min_ps(_mm_min_ps(_mm_loadu_ps(above + x), _mm_loadu_ps(row + x)), _mm_loadu_ps(below + x)));
+        farthest[0] = farthest[1];
+        farthest[OCCLUSION_WIDTH + 1] = farthest[OCCLUSION_WIDTH];
+
+        float *out = ob.depth.data() + y * OCCLUSION_WIDTH;
+        for (int x = 0; x < OCCLUSION_WIDTH; x += 4)
+            _mm_storeu_ps(out + x, _mm_min_ps(_mm_min_ps(_mm_loadu_ps(farthest + x), _mm_loadu_ps(farthest + x + 1)), _mm_loadu_ps(farthest + x + 2)));
+    }
+}
+
+// false when the world space box is hidden behind the occluders. boxes reaching the near plane or off screen count
+// as visible, culling those is the frustum's job
+bool OcclusionTestAABB(const OcclusionBuffer &ob, const AABB &box)
+{
+    float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX, nearestZ = -FLT_MAX;
+    for (int k = 0; k < 8; ++k)
+    {
+        DirectX::XMFLOAT4 p;
+        if (!OcclusionProject(ob.viewProj, k & 1 ? box.max.x : box.min.x, k & 2 ? box.max.y : box.min.y, k & 4 ? box.max.z : box.min.z, p))
+            return true;
+        minX = fminf(minX, p.x);
+        maxX = fmaxf(maxX, p.x);
+        minY = fminf(minY, p.y);
+        maxY = fmaxf(maxY, p.y);
+        nearestZ = fmaxf(nearestZ, p.z);
+    }
+
+    // pixel centres inside the rectangle, plus one pixel all around
+    int x0 = (int)ceilf(minX - 0.5f) - 1, x1 = (int)floorf(maxX - 0.5f) + 1;
+    int y0 = (int)ceilf(minY - 0.5f) - 1, y1 = (int)floorf(maxY - 0.5f) + 1;
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > OCCLUSION_WIDTH - 1 ? OCCLUSION_WIDTH - 1 : x1;
+    y1 = y1 > OCCLUSION_HEIGHT - 1 ? OCCLUSION_HEIGHT - 1 : y1;
+    if (x0 > x1 || y0 > y1)
+        return true;
+
+    const __m128 laneIndex = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    __m128 boxZ = _mm_set1_ps(nearestZ);
+    __m128 first = _mm_set1_ps((float)x0), last = _mm_set1_ps((float)x1);
+    for (int y = y0; y <= y1; ++y)
+    {
+        const float *row = ob.depth.data() + y * OCCLUSION_WIDTH;
+        for (int x = x0 & ~3; x <= x1; x += 4)
+        {
+            __m128 px = _mm_add_ps(_mm_set1_ps((float)x), laneIndex);
+            __m128 inRange = _mm_and_ps(_mm_cmpge_ps(px, first), _mm_cmple_ps(px, last));
+            __m128 open = _mm_cmple_ps(_mm_loadu_ps(row + x), boxZ); // nothing nearer than the box here
+            if (_mm_movemask_ps(_mm_and_ps(inRange, open)) != 0)
+                return true;
+        }
+    }
+    return false;
+}
+
+// the eroded depth as a binary PGM, nearest white, for looking at what the occluders cover
+bool OcclusionDumpPGM(const OcclusionBuffer &ob, const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return false;
+    fprintf(file, "P5\n%d %d\n255\n", OCCLUSION_WIDTH, OCCLUSION_HEIGHT);
+    for (float d : ob.depth)
+    {
+        // reverse-Z puts most of the range right next to 0, a square root spreads it out a bit
+        float v = sqrtf(d < 0.0f ? 0.0f : (d > 1.0f ? 1.0f : d));
+        fputc((int)(v * 255.0f + 0.5f), file);
+    }
+    fclose(file);
+    return true;
+}
@@ -8,30 +8,24 @@
 #pragma warning(pop)
 #include "scene_data.h"
 
-bool IntersectRayCube(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const SceneObject &cube, float &tMin, float &tMax)
+// the intersections below work on unit shapes centred at the origin, the ray is taken into the object's local space
+// with its cached inverse world matrix (see transform_cache.h). false for a zero scale (all zero matrix)
+static bool RayToLocal(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const DirectX::XMFLOAT4X4 &invWorld, float o[3], float d[3])
 {
-    DirectX::XMVECTOR O = DirectX::XMLoadFloat3(&rayOrigin);
-    DirectX::XMVECTOR D = DirectX::XMLoadFloat3(&rayDir);
-    DirectX::XMVECTOR P = DirectX::XMLoadFloat3(&cube.pos);
-    DirectX::XMVECTOR Q = DirectX::XMLoadFloat4(&cube.rot);
-    DirectX::XMVECTOR S = DirectX::XMLoadFloat3(&cube.scale);
-
-    // Avoid division by zero
-    DirectX::XMVECTOR zero = DirectX::XMVectorZero();
-    if (DirectX::XMVector3Equal(S, zero))
+    if (invWorld._44 == 0.0f)
         return false;
+    DirectX::XMMATRIX inv = DirectX::XMLoadFloat4x4(&invWorld);
+    DirectX::XMStoreFloat3((DirectX::XMFLOAT3 *)o, DirectX::XMVector3Transform(DirectX::XMLoadFloat3(&rayOrigin), inv));
+    DirectX::XMStoreFloat3((DirectX::XMFLOAT3 *)d, DirectX::XMVector3TransformNormal(DirectX::XMLoadFloat3(&rayDir), inv));
+    return true;
+}
 
-    DirectX::XMMATRIX R = DirectX::XMMatrixRotationQuaternion(Q);
-    DirectX::XMMATRIX R_T = DirectX::XMMatrixTranspose(R); // inverse rotation
-
-    // Transform ray to cube's local space (unit cube centered at origin)
-    DirectX::XMVECTOR O_rel = DirectX::XMVectorSubtract(O, P);
-    DirectX::XMVECTOR O_local = DirectX::XMVectorDivide(XMVector3Transform(O_rel, R_T), S);
-    DirectX::XMVECTOR D_local = DirectX::XMVectorDivide(XMVector3Transform(D, R_T), S);
-
+bool IntersectRayCube(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const DirectX::XMFLOAT4X4 &invWorld, float &tMin, float &tMax)
+{
+    // ray in the cube's local space (unit cube centered at origin)
     float o[3], d[3];
-    DirectX::XMStoreFloat3((DirectX::XMFLOAT3 *)o, O_local);
-    DirectX::XMStoreFloat3((DirectX::XMFLOAT3 *)d, D_local);
+    if (!RayToLocal(rayOrigin, rayDir, invWorld, o, d))
+        return false;
 
     const float half = 0.5f;
     const float epsilon = 1e-6f;
@@ -69,32 +63,14 @@ bool IntersectRayCube(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT
     return true;
 }
 
-bool IntersectRayCylinder(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const SceneObject &cylinder, float &tMin, float &tMax)
+bool IntersectRayCylinder(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const DirectX::XMFLOAT4X4 &invWorld, float &tMin, float &tMax)
 {
     using namespace DirectX;
 
-    XMVECTOR O = XMLoadFloat3(&rayOrigin);
-    XMVECTOR D = XMLoadFloat3(&rayDir);
-    XMVECTOR P = XMLoadFloat3(&cylinder.pos);
-    XMVECTOR Q = XMLoadFloat4(&cylinder.rot);
-    XMVECTOR S = XMLoadFloat3(&cylinder.scale);
-
-    // Reject degenerate scale
-    XMVECTOR zero = XMVectorZero();
-    if (XMVector3Equal(S, zero))
-        return false;
-
-    XMMATRIX R = XMMatrixRotationQuaternion(Q);
-    XMMATRIX R_T = XMMatrixTranspose(R); // inverse rotation
-
-    // Transform ray to local space (unit cylinder: radius 0.5, height 1)
-    XMVECTOR O_rel = XMVectorSubtract(O, P);
-    XMVECTOR O_local = XMVectorDivide(XMVector3Transform(O_rel, R_T), S);
-    XMVECTOR D_local = XMVectorDivide(XMVector3Transform(D, R_T), S);
-
+    // ray in local space (unit cylinder: radius 0.5, height 1)
     float o[3], d[3];
-    XMStoreFloat3((XMFLOAT3 *)o, O_local);
-    XMStoreFloat3((XMFLOAT3 *)d, D_local);
+    if (!RayToLocal(rayOrigin, rayDir, invWorld, o, d))
+        return false;
 
     const float r = 0.5f;
     const float halfH = 0.5f;
@@ -162,32 +138,14 @@ bool IntersectRayCylinder(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMF
     return true;
 }
 
-bool IntersectRaySphere(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const SceneObject &sphere, float &tMin, float &tMax)
+bool IntersectRaySphere(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const DirectX::XMFLOAT4X4 &invWorld, float &tMin, float &tMax)
 {
     using namespace DirectX;
 
-    XMVECTOR O = XMLoadFloat3(&rayOrigin);
-    XMVECTOR D = XMLoadFloat3(&rayDir);
-    XMVECTOR P = XMLoadFloat3(&sphere.pos);
-    XMVECTOR Q = XMLoadFloat4(&sphere.rot);
-    XMVECTOR S = XMLoadFloat3(&sphere.scale);
-
-    // Reject degenerate scale
-    XMVECTOR zero = XMVectorZero();
-    if (XMVector3Equal(S, zero))
-        return false;
-
-    XMMATRIX R = XMMatrixRotationQuaternion(Q);
-    XMMATRIX R_T = XMMatrixTranspose(R); // inverse rotation
-
-    // Transform ray to local space (unit sphere radius 0.5)
-    XMVECTOR O_rel = XMVectorSubtract(O, P);
-    XMVECTOR O_local = XMVectorDivide(XMVector3Transform(O_rel, R_T), S);
-    XMVECTOR D_local = XMVectorDivide(XMVector3Transform(D, R_T), S);
-
+    // ray in local space (unit sphere radius 0.5)
     float o[3], d[3];
-    XMStoreFloat3((XMFLOAT3 *)o, O_local);
-    XMStoreFloat3((XMFLOAT3 *)d, D_local);
+    if (!RayToLocal(rayOrigin, rayDir, invWorld, o, d))
+        return false;
 
     const float r = 0.5f;
     const float epsilon = 1e-6f;
@@ -226,29 +184,14 @@ bool IntersectRaySphere(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLO
     return true;
 }
 
-bool IntersectRayPrism(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const SceneObject &prism, float &tMin, float &tMax)
+bool IntersectRayPrism(const DirectX::XMFLOAT3 &rayOrigin, const DirectX::XMFLOAT3 &rayDir, const DirectX::XMFLOAT4X4 &invWorld, float &tMin, float &tMax)
 {
     using namespace DirectX;
 
-    XMVECTOR O = XMLoadFloat3(&rayOrigin);
-    XMVECTOR D = XMLoadFloat3(&rayDir);
-    XMVECTOR P = XMLoadFloat3(&prism.pos);
-    XMVECTOR Q = XMLoadFloat4(&prism.rot);
-    XMVECTOR S = XMLoadFloat3(&prism.scale);
-
-    if (XMVector3Equal(S, XMVectorZero()))
-        return false;
-
-    XMMATRIX R = XMMatrixRotationQuaternion(Q);
-    XMMATRIX R_T = XMMatrixTranspose(R); // inverse rotation
-
-    XMVECTOR O_rel = XMVectorSubtract(O, P);
-    XMVECTOR O_local = XMVectorDivide(XMVector3Transform(O_rel, R_T), S);
-    XMVECTOR D_local = XMVectorDivide(XMVector3Transform(D, R_T), S);
-
+    // ray in local space (unit prism)
     float o[3], d[3];
-    XMStoreFloat3((XMFLOAT3 *)o, O_local);
-    XMStoreFloat3((XMFLOAT3 *)d, D_local);
+    if (!RayToLocal(rayOrigin, rayDir, invWorld, o, d))
+        return false;
 
     // Unique vertices of the prism in local space (from your mesh data)
     const XMFLOAT3 v0 = {0.0f, -0.5f, 0.5f};
@@ -0,0 +1,326 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "indirect_draws.h"
+
+// the frame's scene pass recorded as a flat command stream instead of straight D3D12 calls. recording only needs the
+// draw list, so it runs (and can be timed, dumped and diffed) without a device: that is the null backend. the D3D12
+// backend is ExecuteRenderCommands in main.cpp, which plays a stream back onto the frame's command list.
+// no D3D types in here, targets and states are our own small enums
+
+enum RenderCommandType : uint8_t
+{
+    RCMD_SET_PIPELINE,     // a = pipeline, b = blend
+    RCMD_SET_MESH,         // a = draw mesh id (DRAW_MESH_*)
+    RCMD_SET_CONSTANTS,    // a = first dword in RenderCommandStream::constants, b = dword count
+    RCMD_DRAW_INDEXED,     // a = index count, b = instance count
+    RCMD_BARRIER,          // a = target, b = state before, c = state after
+    RCMD_SET_TARGET,       // a = colour target, b = 1 with the depth buffer
+    RCMD_CLEAR,            // a = colour target, depth too if bound
+    RCMD_RESOLVE,          // a = destination target, b = source target
+    RCMD_OVERLAY,          // imgui or the reticle, recorded natively by the backend at this point
+    RCMD_EXECUTE_INDIRECT, // a = first record in RenderCommandStream::indirect, b = record count (meshes and constants included)
+    RCMD_COUNT
+};
+
+enum RenderTargetId : uint32_t
+{
+    RENDER_TARGET_BACK_BUFFER = 0,
+    RENDER_TARGET_MSAA,
+    RENDER_TARGET_COUNT
+};
+
+enum RenderTargetState : uint32_t
+{
+    RENDER_STATE_PRESENT = 0,
+    RENDER_STATE_RENDER_TARGET,
+    RENDER_STATE_RESOLVE_SOURCE,
+    RENDER_STATE_RESOLVE_DEST,
+    RENDER_STATE_COUNT
+};
+
+struct RenderCommand
+{
+    RenderCommandType type;
+    uint32_t a, b, c;
+};
+
+struct RenderCommandStream
+{
+    std::vector<RenderCommand> commands;
+    std::vector<uint32_t> constants; // root constant payloads
+    IndirectDrawList indirect;       // ExecuteIndirect arguments, see indirect_draws.h
+    int counts[RCMD_COUNT] = {};
+    uint32_t drawsBegin = 0;         // command range of the draw list, the part that may be split into chunks
+    uint32_t drawsEnd = 0;
+};
+
+inline void RenderCommandsReset(RenderCommandStream &stream)
+{
+    stream.commands.clear();
+    stream.constants.clear();
+    IndirectDrawsReset(stream.indirect);
+    for (int &count : stream.counts)
+        count = 0;
+    stream.drawsBegin = 0;
+    stream.drawsEnd = 0;
+}
+
+inline void RenderCommandPush(RenderCommandStream &stream, RenderCommandType type, uint32_t a = 0, uint32_t b = 0, uint32_t c = 0)
+{
+    stream.commands.push_back({type, a, b, c});
+    stream.counts[type]++;
+}
+
+inline void CmdSetConstants(RenderCommandStream &stream, const void *data, uint32_t bytes)
+{
+    uint32_t first = (uint32_t)stream.constants.size();
+    uint32_t dwords = bytes / 4;
+    stream.constants.resize(first + dwords);
+    memcpy(&stream.constants[first], data, dwords * 4);
+    RenderCommandPush(stream, RCMD_SET_CONSTANTS, first, dwords);
+}
+
+static const char *g_renderCommandNames[RCMD_COUNT] = {
+    "set_pipeline", "set_mesh", "set_constants", "draw_indexed", "barrier", "set_target", "clear", "resolve", "overlay",
+    "execute_indirect"};
+
+inline bool RenderCommandIsDraw(RenderCommandType type)
+{
+    return type == RCMD_DRAW_INDEXED || type == RCMD_EXECUTE_INDIRECT;
+}
+
+// same stream, same hash. FNV-1a over the commands, the constants and the indirect records, for quick comparisons
+// between runs. record buffer addresses are left out, they differ from run to run
+inline uint32_t RenderCommandsHash(const RenderCommandStream &stream)
+{
+    uint32_t h = 2166136261u;
+    auto mix = [&h](uint32_t v)
+    {
+        for (int k = 0; k < 4; ++k)
+        {
+            h ^= (v >> (k * 8)) & 0xFF;
+            h *= 16777619u;
+        }
+    };
+    for (const RenderCommand &command : stream.commands)
+    {
+        mix(command.type);
+        mix(command.a);
+        mix(command.b);
+        mix(command.c);
+    }
+    for (uint32_t dword : stream.constants)
+        mix(dword);
+    for (const IndirectDrawRecord &record : stream.indirect.records)
+    {
+        mix(record.mesh);
+        for (uint32_t dword : record.constants)
+            mix(dword);
+        mix(record.draw.indexCountPerInstance);
+        mix(record.draw.instanceCount);
+    }
+    return h;
+}
+
+// one command per line, constants as hex dwords so the dump is exact and two builds can be diffed as text
+void RenderCommandsWrite(const RenderCommandStream &stream, FILE *file)
+{
+    fprintf(file, "# %zu commands, %zu constant dwords, %zu indirect records, hash %08x\n", stream.commands.size(),
+            stream.constants.size(), stream.indirect.records.size(), RenderCommandsHash(stream));
+    for (const RenderCommand &command : stream.commands)
+    {
+        fprintf(file, "%s", g_renderCommandNames[command.type]);
+        if (command.type == RCMD_SET_CONSTANTS)
+        {
+            for (uint32_t d = 0; d < command.b; ++d)
+                fprintf(file, " %08x", stream.constants[command.a + d]);
+        }
+        else
+        {
+            fprintf(file, " %u %u %u", command.a, command.b, command.c);
+        }
+        fprintf(file, "\n");
+        if (command.type == RCMD_EXECUTE_INDIRECT)
+        {
+            // mesh, constants, index count, instance count
+            for (uint32_t k = command.a; k < command.a + command.b; ++k)
+            {
+                const IndirectDrawRecord &record = stream.indirect.records[k];
+                fprintf(file, "  record %u", record.mesh);
+                for (uint32_t dword : record.constants)
+                    fprintf(file, " %08x", dword);
+                fprintf(file, " %u %u\n", record.draw.indexCountPerInstance, record.draw.instanceCount);
+            }
+        }
+    }
+}
+
+bool RenderCommandsDump(const RenderCommandStream &stream, const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (!file)
+        return false;
+    RenderCommandsWrite(stream, file);
+    fclose(file);
+    return true;
+}
+
+// a piece of a stream played back on its own command list. command lists don't inherit state, so each chunk also
+// carries the target, pipeline and mesh commands in effect where it starts, played again before its range
+struct RenderCommandChunk
+{
+    uint32_t begin, end;
+    uint32_t restore[3];
+    int restoreCount;
+};
+
+// the command at playback position r of a chunk: its restore commands first (r from -restoreCount), then its range
+inline uint32_t RenderCommandChunkAt(const RenderCommandChunk &chunk, int r)
+{
+    return r < 0 ? chunk.restore[chunk.restoreCount + r] : chunk.begin + (uint32_t)r;
+}
+
+// for submitting a run of commands of one type with a single call (barriers): true when the command after playback
+// position r has another type or r is the chunk's last
+inline bool RenderCommandsRunEnds(const RenderCommandStream &stream, const RenderCommandChunk &chunk, int r, RenderCommandType type)
+{
+    int next = r + 1;
+    return next >= (int)(chunk.end - chunk.begin) || stream.commands[RenderCommandChunkAt(chunk, next)].type != type;
+}
+
+// splits stream into at most maxChunks chunks covering every command in order, cutting only between two draws of the
+// draw list range and giving each chunk at least minDrawsPerChunk draws. the first chunk also gets what comes before
+// the draws, the last one what comes after. returns the chunk count (1 when there are too few draws to split)
+int RenderCommandsPlanChunks(const RenderCommandStream &stream, int maxChunks, int minDrawsPerChunk, RenderCommandChunk *chunks)
+{
+    int draws = 0;
+    for (uint32_t k = stream.drawsBegin; k < stream.drawsEnd; ++k)
+        draws += RenderCommandIsDraw(stream.commands[k].type);
+    int chunkCount = minDrawsPerChunk > 0 ? draws / minDrawsPerChunk : maxChunks;
+    chunkCount = chunkCount < 1 ? 1 : (chunkCount > maxChunks ? maxChunks : chunkCount);
+
+    uint32_t lastTarget = UINT32_MAX, lastPipeline = UINT32_MAX, lastMesh = UINT32_MAX;
+    int chunk = 0;
+    int drawsSeen = 0;
+    chunks[0] = {0, (uint32_t)stream.commands.size(), {}, 0};
+    for (uint32_t k = 0; k < stream.drawsEnd && chunk + 1 < chunkCount; ++k)
+    {
+        // cut where the next draw's commands start, once this chunk has its share of the draws
+        bool afterDraw = k > stream.drawsBegin && RenderCommandIsDraw(stream.commands[k - 1].type);
+        if (afterDraw && drawsSeen >= (int)((int64_t)draws * (chunk + 1) / chunkCount))
+        {
+            chunks[chunk].end = k;
+            RenderCommandChunk &next = chunks[++chunk];
+            next = {k, (uint32_t)stream.commands.size(), {}, 0};
+            for (uint32_t restore : {lastTarget, lastPipeline, lastMesh})
+            {
+                if (restore != UINT32_MAX)
+                    next.restore[next.restoreCount++] = restore;
+            }
+        }
+
+        RenderCommandType type = stream.commands[k].type;
+        if (type == RCMD_SET_TARGET)
+            lastTarget = k;
+        else if (type == RCMD_SET_PIPELINE)
+            lastPipeline = k;
+        else if (type == RCMD_SET_MESH)
+            lastMesh = k;
+        else if (RenderCommandIsDraw(type))
+            drawsSeen++;
+    }
+    return chunk + 1;
+}
+
+// what a draw ends up using, for checking chunked playback against the plain stream
+struct RenderResolvedDraw
+{
+    uint32_t target, pipeline, blend, mesh;
+    uint32_t constantsHash;
+    uint32_t indexCount, instanceCount;
+};
+
+// plays chunks back the way separate command lists would (nothing carried over between them) and lists the draws,
+// an indirect record counts as a draw with its own mesh and constants
+void RenderCommandsResolveDraws(const RenderCommandStream &stream, const RenderCommandChunk *chunks, int chunkCount,
+                                std::vector<RenderResolvedDraw> &draws)
+{
+    draws.clear();
+    for (int c = 0; c < chunkCount; ++c)
+    {
+        RenderResolvedDraw state = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, 0, 0, 0};
+        auto hashConstants = [](const uint32_t *dwords, uint32_t count)
+        {
+            uint32_t h = 2166136261u;
+            for (uint32_t d = 0; d < count; ++d)
+                h = (h ^ dwords[d]) * 16777619u;
+            return h;
+        };
+        auto apply = [&](uint32_t k)
+        {
+            const RenderCommand &command = stream.commands[k];
+            if (command.type == RCMD_SET_TARGET)
+                state.target = command.a;
+            else if (command.type == RCMD_SET_PIPELINE)
+            {
+                state.pipeline = command.a;
+                state.blend = command.b;
+            }
+            else if (command.type == RCMD_SET_MESH)
+                state.mesh = command.a;
+            else if (command.type == RCMD_SET_CONSTANTS)
+                state.constantsHash = hashConstants(&stream.constants[command.a], command.b);
+            else if (command.type == RCMD_DRAW_INDEXED)
+            {
+                state.indexCount = command.a;
+                state.instanceCount = command.b;
+                draws.push_back(state);
+            }
+            else if (command.type == RCMD_EXECUTE_INDIRECT)
+            {
+                // the signature sets these per record and leaves them undefined afterwards, later draws bind their own
+                for (uint32_t r = command.a; r < command.a + command.b; ++r)
+                {
+                    const IndirectDrawRecord &record = stream.indirect.records[r];
+                    state.mesh = record.mesh;
+                    state.constantsHash = hashConstants(record.constants, INDIRECT_DRAW_CONSTANTS);
+                    state.indexCount = record.draw.indexCountPerInstance;
+                    state.instanceCount = record.draw.instanceCount;
+                    draws.push_back(state);
+                }
+                state.mesh = UINT32_MAX;
+                state.constantsHash = 0;
+            }
+        };
+        for (int r = 0; r < chunks[c].restoreCount; ++r)
+            apply(chunks[c].restore[r]);
+        for (uint32_t k = chunks[c].begin; k < chunks[c].end; ++k)
+            apply(k);
+    }
+}
+
+// true if the chunks cover the stream in order and every draw sees the same state as in a straight playback
+bool RenderCommandsChunksMatch(const RenderCommandStream &stream, const RenderCommandChunk *chunks, int chunkCount)
+{
+    uint32_t next = 0;
+    for (int c = 0; c < chunkCount; ++c)
+    {
+        if (chunks[c].begin != next)
+            return false;
+        next = chunks[c].end;
+    }
+    if (next != stream.commands.size())
+        return false;
+
+    RenderCommandChunk whole = {0, (uint32_t)stream.commands.size(), {}, 0};
+    std::vector<RenderResolvedDraw> expected, actual;
+    RenderCommandsResolveDraws(stream, &whole, 1, expected);
+    RenderCommandsResolveDraws(stream, chunks, chunkCount, actual);
+    return expected.size() == actual.size() &&
+           (expected.empty() || memcmp(expected.data(), actual.data(), expected.size() * sizeof(RenderResolvedDraw)) == 0);
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "render_commands.h"
+
+// the frame as a short list of passes that declare the targets they use and the state they need them in. compiling
+// culls the passes nothing downstream needs and works out the transitions: only where a target's state actually
+// changes, and all of a pass's transitions in one batch in front of it (the backend submits consecutive RCMD_BARRIERs
+// with a single ResourceBarrier). targets are imported with their state at frame start and the state they have to
+// be left in, so the transitions back at the end come out as one more batch.
+// no D3D in here, targets and states are the command stream's enums
+
+#define RENDER_GRAPH_MAX_PASSES 16
+#define RENDER_GRAPH_MAX_ACCESSES 4
+
+enum RenderGraphAccessFlags : uint32_t
+{
+    RENDER_ACCESS_READ = 1,
+    RENDER_ACCESS_WRITE = 2,
+    RENDER_ACCESS_DISCARD = 4, // with write: the pass replaces all of it (clear, resolve), what was there isn't needed
+};
+
+struct RenderGraphAccess
+{
+    uint32_t target; // RenderTargetId
+    uint32_t state;  // RenderTargetState
+    uint32_t flags;
+};
+
+struct RenderGraphPass
+{
+    uint32_t id; // the caller's, to know what to record for it
+    RenderGraphAccess accesses[RENDER_GRAPH_MAX_ACCESSES];
+    int accessCount;
+    bool sideEffects; // kept even if nothing reads what it writes
+};
+
+struct RenderGraphBarrier
+{
+    uint32_t target, before, after;
+};
+
+struct RenderGraph
+{
+    RenderGraphPass passes[RENDER_GRAPH_MAX_PASSES];
+    int passCount = 0;
+    bool imported[RENDER_TARGET_COUNT] = {};
+    bool output[RENDER_TARGET_COUNT] = {}; // holds the frame's result, so the passes writing it are needed
+    uint32_t initialState[RENDER_TARGET_COUNT] = {};
+    uint32_t finalState[RENDER_TARGET_COUNT] = {};
+
+    // RenderGraphCompile's results
+    bool live[RENDER_GRAPH_MAX_PASSES] = {};
+    std::vector<RenderGraphBarrier> barriers;
+    uint32_t batchBegin[RENDER_GRAPH_MAX_PASSES + 2] = {}; // pass p's batch is [batchBegin[p], batchBegin[p + 1]), p = passCount the final one
+    int culled = 0;
+    int batches = 0; // non-empty ones
+};
+
+inline void RenderGraphReset(RenderGraph &graph)
+{
+    graph.passCount = 0;
+    for (uint32_t t = 0; t < RENDER_TARGET_COUNT; ++t)
+    {
+        graph.imported[t] = false;
+        graph.output[t] = false;
+    }
+    graph.barriers.clear();
+    graph.culled = 0;
+    graph.batches = 0;
+}
+
+inline void RenderGraphImport(RenderGraph &graph, uint32_t target, uint32_t initialState, uint32_t finalState, bool output)
+{
+    graph.imported[target] = true;
+    graph.output[target] = output;
+    graph.initialState[target] = initialState;
+    graph.finalState[target] = finalState;
+}
+
+// returns the pass index, -1 when the graph is full
+inline int RenderGraphAddPass(RenderGraph &graph, uint32_t id, bool sideEffects = false)
+{
+    if (graph.passCount == RENDER_GRAPH_MAX_PASSES)
+        return -1;
+    graph.passes[graph.passCount] = {id, {}, 0, sideEffects};
+    return graph.passCount++;
+}
+
+// false when the pass already has RENDER_GRAPH_MAX_ACCESSES targets
+inline bool RenderGraphUse(RenderGraph &graph, int pass, uint32_t target, uint32_t state, uint32_t flags)
+{
+    if (pass < 0 || graph.passes[pass].accessCount == RENDER_GRAPH_MAX_ACCESSES)
+        return false;
+    RenderGraphPass &p = graph.passes[pass];
+    p.accesses[p.accessCount++] = {target, state, flags};
+    return true;
+}
+
+// culls, then places the barriers. false (nothing live, every batch empty) when a pass uses a target that wasn't
+// imported, a state that doesn't exist or the same target twice
+bool RenderGraphCompile(RenderGraph &graph)
+{
+    // all of the last compile goes first, so a failure part way leaves none of it behind
+    graph.barriers.clear();
+    graph.culled = 0;
+    graph.batches = 0;
+    for (int p = 0; p < RENDER_GRAPH_MAX_PASSES; ++p)
+        graph.live[p] = false;
+    for (int p = 0; p < RENDER_GRAPH_MAX_PASSES + 2; ++p)
+        graph.batchBegin[p] = 0;
+
+    for (int p = 0; p < graph.passCount; ++p)
+    {
+        const RenderGraphPass &pass = graph.passes[p];
+        for (int a = 0; a < pass.accessCount; ++a)
+        {
+            const RenderGraphAccess &access = pass.accesses[a];
+            if (access.target >= RENDER_TARGET_COUNT || !graph.imported[access.target] || access.state >= RENDER_STATE_COUNT)
+                return false;
+            for (int b = 0; b < a; ++b)
+            {
+                if (pass.accesses[b].target == access.target)
+                    return false;
+            }
+        }
+    }
+
+    // backwards: a pass is live if it writes something a later live pass reads (or the output). a write that
+    // doesn't discard blends over what's there, so it needs the earlier contents just like a read
+    bool needed[RENDER_TARGET_COUNT];
+    for (uint32_t t = 0; t < RENDER_TARGET_COUNT; ++t)
+        needed[t] = graph.output[t];
+    for (int p = graph.passCount - 1; p >= 0; --p)
+    {
+        const RenderGraphPass &pass = graph.passes[p];
+        bool live = pass.sideEffects;
+        for (int a = 0; a < pass.accessCount; ++a)
+            live |= (pass.accesses[a].flags & RENDER_ACCESS_WRITE) && needed[pass.accesses[a].target];
+        graph.live[p] = live;
+        if (!live)
+        {
+            graph.culled++;
+            continue;
+        }
+        for (int a = 0; a < pass.accessCount; ++a)
+        {
+            const RenderGraphAccess &access = pass.accesses[a];
+            if (access.flags & RENDER_ACCESS_READ)
+                needed[access.target] = true;
+            else if (access.flags & RENDER_ACCESS_DISCARD)
+                needed[access.target] = false;
+        }
+    }
+
+    // forwards: transitions where the state changes, one batch per live pass and one at the end
+    uint32_t state[RENDER_TARGET_COUNT];
+    for (uint32_t t = 0; t < RENDER_TARGET_COUNT; ++t)
+        state[t] = graph.initialState[t];
+    for (int p = 0; p < graph.passCount; ++p)
+    {
+        graph.batchBegin[p] = (uint32_t)graph.barriers.size();
+        if (!graph.live[p])
+            continue;
+        const RenderGraphPass &pass = graph.passes[p];
+        for (int a = 0; a < pass.accessCount; ++a)
+        {
+            const RenderGraphAccess &access = pass.accesses[a];
+            if (state[access.target] != access.state)
+            {
+                graph.barriers.push_back({access.target, state[access.target], access.state});
+                state[access.target] = access.state;
+            }
+        }
+        graph.batches += graph.barriers.size() > graph.batchBegin[p];
+    }
+    graph.batchBegin[graph.passCount] = (uint32_t)graph.barriers.size();
+    for (uint32_t t = 0; t < RENDER_TARGET_COUNT; ++t)
+    {
+        if (graph.imported[t] && state[t] != graph.finalState[t])
+            graph.barriers.push_back({t, state[t], graph.finalState[t]});
+    }
+    graph.batches += graph.barriers.size() > graph.batchBegin[graph.passCount];
+    graph.batchBegin[graph.passCount + 1] = (uint32_t)graph.barriers.size();
+    return true;
+}
+
+// the batch in front of pass (pass == passCount: the final one) as RCMD_BARRIERs
+inline void RenderGraphPushBarriers(const RenderGraph &graph, int pass, RenderCommandStream &stream)
+{
+    for (uint32_t b = graph.batchBegin[pass]; b < graph.batchBegin[pass + 1]; ++b)
+        RenderCommandPush(stream, RCMD_BARRIER, graph.barriers[b].target, graph.barriers[b].before, graph.barriers[b].after);
+}
+
+// for checks against hand written lists: true if the batch in front of pass is exactly expected, in order
+bool RenderGraphBatchIs(const RenderGraph &graph, int pass, const RenderGraphBarrier *expected, int count)
+{
+    if ((int)(graph.batchBegin[pass + 1] - graph.batchBegin[pass]) != count)
+        return false;
+    for (int b = 0; b < count; ++b)
+    {
+        const RenderGraphBarrier &barrier = graph.barriers[graph.batchBegin[pass] + b];
+        if (barrier.target != expected[b].target || barrier.before != expected[b].before || barrier.after != expected[b].after)
+            return false;
+    }
+    return true;
+}
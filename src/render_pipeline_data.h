@@ -1,9 +1,7 @@
 #pragma once
-#pragma warning(push, 0)
-#include <windows.h>
-#pragma warning(pop)
+#include <stdint.h>
 
-enum RenderPipeline : UINT
+enum RenderPipeline : uint8_t
 {
     RENDER_DEFAULT = 0, // standard UV mapping
     RENDER_TRIPLANAR,   // triplanar mapping
@@ -13,7 +11,7 @@ enum RenderPipeline : UINT
     RENDER_COUNT
 };
 
-enum BlendMode : UINT {
+enum BlendMode : uint32_t {
     BLEND_OPAQUE = 0,
     BLEND_ALPHA,
     // dithering blend mode? TODO: what other possible blend modes could we have?
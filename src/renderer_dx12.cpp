@@ -10,6 +10,7 @@
 #include <DirectXMath.h>
 #include <DirectXTex.h>
 #include <SDL3/SDL.h>
+#include <float.h>
 #pragma warning(pop)
 
 #include "local_error.h"
@@ -26,52 +27,161 @@ struct Vertex
 #include "descriptor_layout.h"
 
 #include "generated/descriptor_layout.h"
+#include "mesh_simplify.h"
+#include "indirect_draws.h"
+#include "descriptor_allocator.h"
+#include "gpu_heap_allocator.h"
+#include "upload_ring.h"
+#include "shader_cache.h"
+
+// primitive mesh buffers per level of detail, level by level so LOD 0 of a primitive sits at its PrimitiveType
+#define PRIMITIVE_LOD_SLOTS (PRIMITIVE_COUNT * PRIMITIVE_MAX_LODS)
+#define PRIMITIVE_LOD_SLOT(type, lod) ((lod) * PRIMITIVE_COUNT + (type))
 
 void WaitForAllFrames();
 
-static ID3D12Resource *g_vertexBufferUploadPrimitives[PrimitiveType::PRIMITIVE_COUNT] = {};
-static ID3D12Resource *g_indexBufferUploadPrimitives[PrimitiveType::PRIMITIVE_COUNT] = {};
+typedef UINT64 UploadToken; // the copy fence value of the batch an upload went in, 0 when it couldn't be staged
+UploadToken UploadBuffer(ID3D12Resource *destination, const void *data, UINT64 size);
+UploadToken UploadTexture(ID3D12Resource *destination, const D3D12_SUBRESOURCE_DATA *subresources, UINT count);
+void UploadReleaseAfter(ID3D12Resource *resource);
+
 static UINT g_cbvSrvDescriptorSize = 0;
 
+// vertex/index buffers, loaded textures and their upload copies are placed in a few big heaps instead of being
+// committed one by one (see gpu_heap_allocator.h). buffers and textures get heaps of their own, which resource heap
+// tier 1 requires. a resource bigger than a heap, or one more once a pool has GPU_HEAPS_PER_POOL, is committed as before
+enum GpuHeapPoolId
+{
+    GPU_POOL_BUFFERS,
+    GPU_POOL_TEXTURES,
+    GPU_POOL_UPLOAD,
+    GPU_POOL_COUNT
+};
+#define GPU_HEAPS_PER_POOL 8
+static const UINT64 g_gpuHeapSizes[GPU_POOL_COUNT] = {32ull << 20, 64ull << 20, 64ull << 20};
+static const char *g_gpuPoolNames[GPU_POOL_COUNT] = {"buffers", "textures", "upload"};
+
+struct PlacedResource
+{
+    GpuHeapPoolId pool;
+    GpuHeapAllocation allocation;
+};
+
+static struct
+{
+    GpuHeapPool pools[GPU_POOL_COUNT];
+    ID3D12Heap *heaps[GPU_POOL_COUNT][GPU_HEAPS_PER_POOL] = {};
+    std::unordered_map<ID3D12Resource *, PlacedResource> placed; // to give the block back on release
+    int committed[GPU_POOL_COUNT] = {};                          // fallbacks
+} g_gpu_heaps;
+
+void InitGpuHeaps()
+{
+    for (int pool = 0; pool < GPU_POOL_COUNT; ++pool)
+        GpuHeapPoolInit(g_gpu_heaps.pools[pool], g_gpuHeapSizes[pool]);
+}
+
+// places the resource in pool's heaps (adding a heap when none has room), committed when that fails
+HRESULT CreatePooledResource(ID3D12Device *device, GpuHeapPoolId pool, const D3D12_RESOURCE_DESC &desc, D3D12_RESOURCE_STATES state, ID3D12Resource **outResource)
+{
+    GpuHeapPool &heapPool = g_gpu_heaps.pools[pool];
+    D3D12_HEAP_TYPE heapType = pool == GPU_POOL_UPLOAD ? D3D12_HEAP_TYPE_UPLOAD : D3D12_HEAP_TYPE_DEFAULT;
+    D3D12_RESOURCE_ALLOCATION_INFO info = device->GetResourceAllocationInfo(0, 1, &desc);
+    GpuHeapAllocation allocation = GpuHeapAlloc(heapPool, info.SizeInBytes, info.Alignment);
+    if (allocation.heap == GPU_HEAP_NONE && info.SizeInBytes <= heapPool.heapSize && heapPool.heaps.size() < GPU_HEAPS_PER_POOL)
+    {
+        CD3DX12_HEAP_DESC heapDesc(heapPool.heapSize, heapType, 0,
+                                   pool == GPU_POOL_TEXTURES ? D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES : D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS);
+        ID3D12Heap *heap = nullptr;
+        if (SUCCEEDED(device->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap))))
+        {
+            g_gpu_heaps.heaps[pool][GpuHeapPoolAddHeap(heapPool)] = heap;
+            allocation = GpuHeapAlloc(heapPool, info.SizeInBytes, info.Alignment);
+        }
+    }
+
+    HRESULT hr = E_FAIL;
+    if (allocation.heap != GPU_HEAP_NONE)
+    {
+        hr = device->CreatePlacedResource(g_gpu_heaps.heaps[pool][allocation.heap], allocation.offset, &desc, state, nullptr, IID_PPV_ARGS(outResource));
+        if (SUCCEEDED(hr))
+            g_gpu_heaps.placed[*outResource] = {pool, allocation};
+        else
+            GpuHeapFree(heapPool, allocation);
+    }
+    if (FAILED(hr))
+    {
+        g_gpu_heaps.committed[pool]++;
+        hr = device->CreateCommittedResource(&CD3DX12_HEAP_PROPERTIES(heapType), D3D12_HEAP_FLAG_NONE, &desc, state, nullptr, IID_PPV_ARGS(outResource));
+    }
+    return hr;
+}
+
+// for anything CreatePooledResource made, once the GPU is done with it: the heap block is free for the next one
+void ReleaseGpuResource(ID3D12Resource *&resource)
+{
+    if (!resource)
+        return;
+    auto placed = g_gpu_heaps.placed.find(resource);
+    if (placed != g_gpu_heaps.placed.end())
+    {
+        GpuHeapFree(g_gpu_heaps.pools[placed->second.pool], placed->second.allocation);
+        g_gpu_heaps.placed.erase(placed);
+    }
+    resource->Release();
+    resource = nullptr;
+}
+
+// after OnDestroy, the placed resources are gone by then
+void ReleaseGpuHeaps()
+{
+    for (int pool = 0; pool < GPU_POOL_COUNT; ++pool)
+    {
+        for (int h = 0; h < GPU_HEAPS_PER_POOL; ++h)
+        {
+            if (g_gpu_heaps.heaps[pool][h])
+            {
+                g_gpu_heaps.heaps[pool][h]->Release();
+                g_gpu_heaps.heaps[pool][h] = nullptr;
+            }
+        }
+    }
+    g_gpu_heaps.placed.clear();
+}
+
 // Reticle root signature (empty, no parameters), TODO: abstract this out when adding more 2d UI screenspace system
 static ID3D12RootSignature *g_reticleRootSig = nullptr;
 static ID3D12PipelineState *g_reticlePSO = nullptr;
 
-bool CreateDefaultBuffer(ID3D12Device *device, ID3D12GraphicsCommandList *cmdList, const void *data, UINT64 size, D3D12_RESOURCE_STATES targetState, ID3D12Resource **outResource, ID3D12Resource **outUploadBuffer) // caller must release after GPU work
+// the copy is queued on the copy queue (see UploadBuffer), the buffer stays in COMMON and is promoted to whatever
+// state the draw reads it in. caller must ReleaseGpuResource it (UploadReleaseAfter while the copy may be pending)
+bool CreateDefaultBuffer(ID3D12Device *device, const void *data, UINT64 size, ID3D12Resource **outResource, UploadToken *outUpload = nullptr)
 {
-    HRESULT hr = device->CreateCommittedResource(&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT), D3D12_HEAP_FLAG_NONE, &CD3DX12_RESOURCE_DESC::Buffer(size), D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(outResource));
+    HRESULT hr = CreatePooledResource(device, GPU_POOL_BUFFERS, CD3DX12_RESOURCE_DESC::Buffer(size), D3D12_RESOURCE_STATE_COMMON, outResource);
     if (FAILED(hr))
         return false;
 
-    hr = device->CreateCommittedResource(&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD), D3D12_HEAP_FLAG_NONE, &CD3DX12_RESOURCE_DESC::Buffer(size), D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(outUploadBuffer));
-    if (FAILED(hr))
-        return false;
-
-    void *mapped;
-    hr = (*outUploadBuffer)->Map(0, nullptr, &mapped);
-    if (FAILED(hr))
+    UploadToken upload = UploadBuffer(*outResource, data, size);
+    if (upload == 0)
+    {
+        ReleaseGpuResource(*outResource);
         return false;
-    memcpy(mapped, data, size);
-    (*outUploadBuffer)->Unmap(0, nullptr);
-
-    cmdList->CopyBufferRegion(*outResource, 0, *outUploadBuffer, 0, size);
-
-    auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(*outResource, D3D12_RESOURCE_STATE_COPY_DEST, targetState);
-    cmdList->ResourceBarrier(1, &barrier);
-
+    }
+    if (outUpload)
+        *outUpload = upload;
     return true;
 }
 
-bool CreatePrimitiveMeshBuffers(ID3D12Device *device, ID3D12GraphicsCommandList *cmdList, PrimitiveType type, const PrimitiveMeshData &data, ID3D12Resource *&outVertexBuffer, D3D12_VERTEX_BUFFER_VIEW &outVertexView, ID3D12Resource *&outIndexBuffer, D3D12_INDEX_BUFFER_VIEW &outIndexView, UINT &outIndexCount)
+bool CreatePrimitiveMeshBuffers(ID3D12Device *device, const PrimitiveMeshData &data, ID3D12Resource *&outVertexBuffer, D3D12_VERTEX_BUFFER_VIEW &outVertexView, ID3D12Resource *&outIndexBuffer, D3D12_INDEX_BUFFER_VIEW &outIndexView, UINT &outIndexCount)
 {
     // --- Vertex buffer ---
     const UINT vbSize = data.vertexCount * sizeof(Vertex);
-    if (!CreateDefaultBuffer(device, cmdList, data.vertices, vbSize, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, &outVertexBuffer, &g_vertexBufferUploadPrimitives[type]))
+    if (!CreateDefaultBuffer(device, data.vertices, vbSize, &outVertexBuffer))
         return false;
 
     // --- Index buffer ---
     const UINT ibSize = data.indexCount * sizeof(uint32_t);
-    if (!CreateDefaultBuffer(device, cmdList, data.indices, ibSize, D3D12_RESOURCE_STATE_INDEX_BUFFER, &outIndexBuffer, &g_indexBufferUploadPrimitives[type]))
+    if (!CreateDefaultBuffer(device, data.indices, ibSize, &outIndexBuffer))
         return false;
 
     // --- Views ---
@@ -111,18 +221,23 @@ static D3D12_CLEAR_VALUE g_depthOptimizedClearValue = {DXGI_FORMAT_D32_FLOAT, {0
 
 static constexpr UINT g_FrameCount = 3; // double, triple buffering etc...
 
-#define MAX_LOADED_MODELS 64
-#define MAX_HEIGHTMAP_TEXTURES 256
-#define MAX_SKY_TEXTURES 16
-#define MAX_ALBEDO_TEXTURES MAX_LOADED_MODELS
+#define MAX_BINDLESS_TEXTURES 4096      // the texture table the shaders index: heightmaps, skies and model albedos alike
+#define BINDLESS_TRANSIENT_PER_FRAME 64 // of those, per frame slots at the end of the table (see descriptor_allocator.h)
+#define DRAW_INSTANCES_INITIAL 65536 // world matrices per frame the instance buffer starts with (4 MB), grown when a frame has more
+#define UPLOAD_RING_INITIAL_SIZE (g_FrameCount * DRAW_INSTANCES_INITIAL * sizeof(DirectX::XMFLOAT4X4)) // a full frame per frame in flight
+#define UPLOAD_STAGING_SIZE (64ull << 20) // the copy queue's staging ring, bigger uploads get a buffer of their own
+#define UPLOAD_BATCH_ALLOCATORS 4         // copy batches in flight before a new one waits for the oldest
+#define MAX_RECORD_CHUNKS 8       // command lists the scene pass can be split into, recorded in parallel
 
 static UINT g_errorHeightmapIndex = 0;
+static UINT g_fallbackAlbedoIndex = 0; // magenta checker, for models without a texture and skies that failed to load
 
 struct SyncState
 {
     UINT64 m_fenceValues[g_FrameCount];
     ID3D12Fence *m_fence;
     HANDLE m_fenceEvent;
+    ID3D12Fence *m_copyFence; // signalled by the copy queue once per upload batch
     UINT m_frameIndex;
 };
 
@@ -157,6 +272,9 @@ struct PipelineDX12
     CD3DX12_RECT m_scissorRect;
     ID3D12Device *m_device;
     ID3D12CommandQueue *m_commandQueue;
+    ID3D12CommandQueue *m_copyQueue; // uploads, see UploadBuffer
+    ID3D12CommandAllocator *m_copyCommandAllocators[UPLOAD_BATCH_ALLOCATORS];
+    ID3D12GraphicsCommandList *m_copyCommandList;
     IDXGISwapChain3 *m_swapChain;
     ID3D12DescriptorHeap *m_rtvHeap;
     ID3D12DescriptorHeap *m_mainHeap;
@@ -164,7 +282,12 @@ struct PipelineDX12
     ID3D12Resource *m_renderTargets[g_FrameCount];
     ID3D12CommandAllocator *m_commandAllocators[g_FrameCount];
     ID3D12GraphicsCommandList *m_commandList[g_FrameCount];
+    // per frame, chunk c of the scene pass at [frame * MAX_RECORD_CHUNKS + c]. chunk 0 is recorded into m_commandList,
+    // so its slots stay null
+    ID3D12CommandAllocator *m_chunkCommandAllocators[g_FrameCount * MAX_RECORD_CHUNKS];
+    ID3D12GraphicsCommandList *m_chunkCommandLists[g_FrameCount * MAX_RECORD_CHUNKS];
     ID3D12RootSignature *m_rootSignature;
+    ID3D12CommandSignature *m_drawCommandSignature; // ExecuteIndirect of IndirectDrawRecord (see indirect_draws.h)
 
     // depth buffer
     ID3D12DescriptorHeap *m_dsvHeap;
@@ -200,37 +323,40 @@ struct PipelineDX12
     }
 };
 
+// every draw's world matrix comes from this frame's world buffer (suballocated from the upload ring) at
+// instanceBase + SV_InstanceID, plain draws are just one instance
 struct PerDrawRootConstants
 {
-    DirectX::XMFLOAT4X4 world; // NOTE: changing this to XMFLOAT3x4 screws up rendering on faster gpu for some reason??????
-    static_assert(sizeof(world) == 16 * 4, "Dont change type of world matrix, it screws up everything on test bench for some reason (faster GPU)");
-
     UINT textureArrayIndex;
-    UINT padding[3]; // ensure 16‑byte alignment
+    UINT instanceBase;
 };
+// NOTE: changing the world matrices to XMFLOAT3x4 screws up rendering on faster gpu for some reason??????
+static_assert(sizeof(DirectX::XMFLOAT4X4) == 16 * 4, "Dont change type of world matrix, it screws up everything on test bench for some reason (faster GPU)");
 static_assert((sizeof(PerDrawRootConstants) <= 256), "Root32BitConstants size must be 256-bytes or smaller (64 DWORDS)");
 
+// levels of detail per loaded model, the coarser ones are clustered at load time (see mesh_simplify.h) with
+// kModelLodGridCells cells along the longest side of the bounds. every level indexes the same vertex buffer, their
+// index lists sit one after the other in indexBuffer
+#define MODEL_MAX_LODS 3
+static const int kModelLodGridCells[MODEL_MAX_LODS] = {0, 48, 16};
+#define MODEL_LOD_MIN_REDUCTION 0.75f // a level keeping more of the previous one's triangles than this is dropped
+
 struct ModelResources
 {
     ID3D12Resource *vertexBuffer;
     ID3D12Resource *indexBuffer;
     D3D12_VERTEX_BUFFER_VIEW vertexView;
-    D3D12_INDEX_BUFFER_VIEW indexView;
-    UINT indexCount;
-    UINT textureIndex = 0; // index into m_modelAlbedoTextures
+    D3D12_INDEX_BUFFER_VIEW indexViews[MODEL_MAX_LODS];
+    UINT indexCounts[MODEL_MAX_LODS];
+    UINT lodCount = 1;
+    UINT textureIndex = 0; // bindless table slot of the albedo
+    DirectX::XMFLOAT3 boundsMin = {}; // mesh space, from the glTF position accessors (used for culling)
+    DirectX::XMFLOAT3 boundsMax = {};
 
     void Release()
     {
-        if (vertexBuffer)
-        {
-            vertexBuffer->Release();
-            vertexBuffer = nullptr;
-        }
-        if (indexBuffer)
-        {
-            indexBuffer->Release();
-            indexBuffer = nullptr;
-        }
+        ReleaseGpuResource(vertexBuffer);
+        ReleaseGpuResource(indexBuffer);
     }
 };
 
@@ -240,17 +366,22 @@ struct GraphicsResources
     PerSceneConstantBuffer m_PerSceneConstantBufferData;
 
     // todo: unify this:
-    D3D12_VERTEX_BUFFER_VIEW m_vertexBufferView[PrimitiveType::PRIMITIVE_COUNT] = {};
-    D3D12_INDEX_BUFFER_VIEW m_indexBufferView[PrimitiveType::PRIMITIVE_COUNT] = {};
-    ID3D12Resource *m_vertexBuffer[PrimitiveType::PRIMITIVE_COUNT] = {};
-    ID3D12Resource *m_indexBuffer[PrimitiveType::PRIMITIVE_COUNT] = {};
-    UINT m_indexCount[PrimitiveType::PRIMITIVE_COUNT] = {};
+    // by PRIMITIVE_LOD_SLOT, LOD 0 of each primitive is at its PrimitiveType. unused levels stay null
+    D3D12_VERTEX_BUFFER_VIEW m_vertexBufferView[PRIMITIVE_LOD_SLOTS] = {};
+    D3D12_INDEX_BUFFER_VIEW m_indexBufferView[PRIMITIVE_LOD_SLOTS] = {};
+    ID3D12Resource *m_vertexBuffer[PRIMITIVE_LOD_SLOTS] = {};
+    ID3D12Resource *m_indexBuffer[PRIMITIVE_LOD_SLOTS] = {};
+    UINT m_indexCount[PRIMITIVE_LOD_SLOTS] = {};
 
     ID3D12Resource *m_defaultTexture = nullptr;
     ID3D12Resource *m_PerSceneConstantBuffer = nullptr;
     UINT8 *m_pPerSceneCbvDataBegin = nullptr;
     ID3D12Resource *m_PerFrameConstantBuffer[g_FrameCount] = {};
     UINT8 *m_pCbvDataBegin[g_FrameCount] = {};
+    ID3D12Resource *m_uploadRingBuffer = nullptr; // per frame data, suballocated by g_upload_ring (see upload_ring.h)
+    UINT8 *m_pUploadRingBegin = nullptr;
+    ID3D12Resource *m_stagingBuffer = nullptr; // copy queue staging, suballocated by g_staging_ring
+    UINT8 *m_pStagingBegin = nullptr;
 
     ID3D12Resource *m_heightmapTexture = nullptr;
     UINT8 *m_heightmapData = nullptr; // CPU copy for editing
@@ -262,19 +393,10 @@ struct GraphicsResources
     ID3D12Resource *m_heightfieldIndexBuffer = nullptr;
     D3D12_INDEX_BUFFER_VIEW m_heightfieldIndexView;
     UINT m_heightfieldIndexCount;
-    ID3D12Resource *m_heightfieldVertexUpload = nullptr;
-    ID3D12Resource *m_heightfieldIndexUpload = nullptr;
-
-    ID3D12Resource *m_heightmapResources[MAX_HEIGHTMAP_TEXTURES] = {}; // textures by heap slot
-    ID3D12Resource *m_skyResources[MAX_SKY_TEXTURES] = {};
 
-    // TODO move to the scene struct?
-    UINT m_sceneObjectIndices[MAX_SCENE_OBJECTS] = {}; // per‑object texture index
-    UINT m_nextSceneObject = 0;                        // next free slot (starts at 0)
+    ID3D12Resource *m_bindlessTextures[MAX_BINDLESS_TEXTURES] = {}; // by bindless table slot, see g_bindless_slots
 
-    ID3D12Resource *m_modelAlbedoTextures[MAX_LOADED_MODELS] = {};
-    ModelResources m_models[MAX_LOADED_MODELS];
-    UINT m_numModelsLoaded = 0;
+    std::vector<ModelResources> m_models; // by model index, one per model file loaded
 };
 
 struct ViewportState
@@ -294,19 +416,307 @@ struct EngineContext
 };
 static EngineContext g_engine;
 
-static char g_modelPaths[MAX_LOADED_MODELS][256] = {};
+// the bindless table's slots (see descriptor_allocator.h). slot k is main heap descriptor BINDLESS_SRV + k and
+// g_textures[k] in the shaders
+static DescriptorAllocator g_bindless_slots;
+
+void InitBindlessSlots()
+{
+    DescriptorAllocatorInit(g_bindless_slots, MAX_BINDLESS_TEXTURES - g_FrameCount * BINDLESS_TRANSIENT_PER_FRAME,
+                            BINDLESS_TRANSIENT_PER_FRAME, g_FrameCount);
+}
+
+// writes the SRV of resource (desc may be null, a default view) into slot
+void WriteBindlessView(UINT slot, ID3D12Resource *resource, const D3D12_SHADER_RESOURCE_VIEW_DESC *desc)
+{
+    CD3DX12_CPU_DESCRIPTOR_HANDLE cpuHandle(
+        g_engine.pipeline_dx12.m_mainHeap->GetCPUDescriptorHandleForHeapStart(),
+        (int)(DescriptorIndices::BINDLESS_SRV + slot),
+        g_cbvSrvDescriptorSize);
+    g_engine.pipeline_dx12.m_device->CreateShaderResourceView(resource, desc, cpuHandle);
+}
+
+// a persistent slot holding resource, which the table owns from then on (released by FreeBindlessTexture or
+// OnDestroy). DESCRIPTOR_INVALID when the table is full, resource stays the caller's then
+UINT CreateBindlessTexture(ID3D12Resource *resource, const D3D12_SHADER_RESOURCE_VIEW_DESC *desc)
+{
+    UINT slot = DescriptorAlloc(g_bindless_slots, 1);
+    if (slot == DESCRIPTOR_INVALID)
+    {
+        SDL_Log("Out of bindless texture slots! (%u)", g_bindless_slots.persistentCount);
+        return slot;
+    }
+    WriteBindlessView(slot, resource, desc);
+    g_engine.graphics_resources.m_bindlessTextures[slot] = resource;
+    return slot;
+}
+
+// the slot and its texture go once the GPU is past the frame after every frame signalled so far: this frame's draw
+// list may have been filled with the slot already, and after WaitForAllFrames this frame's own fence value has been
+// reached before it is submitted
+void FreeBindlessTexture(UINT slot)
+{
+    UINT64 fenceValue = 0;
+    for (UINT i = 0; i < g_FrameCount; i++)
+        fenceValue = g_engine.sync_state.m_fenceValues[i] > fenceValue ? g_engine.sync_state.m_fenceValues[i] : fenceValue;
+    DescriptorFreeDeferred(g_bindless_slots, slot, 1, fenceValue + 1);
+}
+
+// once per frame, after the frame's fence wait: releases what the GPU is done with and starts the frame's transient slice
+void RetireBindlessTextures()
+{
+    static std::vector<DescriptorRange> retired;
+    retired.clear();
+    DescriptorRetire(g_bindless_slots, g_engine.sync_state.m_fence->GetCompletedValue(), &retired);
+    for (const DescriptorRange &range : retired)
+    {
+        for (UINT slot = range.first; slot < range.first + range.count; ++slot)
+        {
+            // through the copy queue's releases too, the texture's own copy may still be pending after a WaitForAllFrames
+            UploadReleaseAfter(g_engine.graphics_resources.m_bindlessTextures[slot]);
+            g_engine.graphics_resources.m_bindlessTextures[slot] = nullptr;
+        }
+    }
+    DescriptorBeginFrame(g_bindless_slots, g_engine.sync_state.m_frameIndex);
+}
+
+// uploads of loaded data go through the copy queue in batches. loaders call UploadBuffer / UploadTexture, which stage
+// the data in a persistently mapped ring (g_staging_ring, see upload_ring.h) and record the copy into the open batch,
+// and get back the batch's token. the batch goes to the copy queue at the next frame (UploadFlush) or when the ring
+// runs out, and its staging is recycled once the copy fence passes its token. destinations are in COMMON: the copy
+// queue promotes them to COPY_DEST, they decay back when the batch is done and the direct queue promotes them to the
+// read state it needs. the frame's submission waits for the submitted batches on the GPU, so the CPU only ever waits
+// when the ring or the batch allocators are all in flight
+static UploadRing g_staging_ring;
+
+static struct
+{
+    UINT64 nextFence = 1; // the open batch's token
+    UINT64 submittedFence = 0;
+    UINT64 queueWaitFence = 0; // the last one the direct queue was told to wait for
+    UINT64 allocatorFences[UPLOAD_BATCH_ALLOCATORS] = {};
+    UINT allocator = 0; // the open batch's
+    bool open = false;
+
+    struct PendingRelease
+    {
+        ID3D12Resource *resource;
+        UINT64 fence;
+    };
+    std::vector<PendingRelease> releases; // staging buffers of uploads bigger than the ring, destinations given up on
+
+    // stats (shown in Debug Controls)
+    UINT batches = 0;
+    UINT uploads = 0;
+    UINT dedicated = 0;
+    UINT64 bytes = 0;
+    UINT stalls = 0;
+    double stallMs = 0.0;
+} g_uploads;
+
+void WaitForCopyFence(UINT64 fenceValue)
+{
+    if (g_engine.sync_state.m_copyFence->GetCompletedValue() >= fenceValue)
+        return;
+    Uint64 start = SDL_GetPerformanceCounter();
+    HRAssert(g_engine.sync_state.m_copyFence->SetEventOnCompletion(fenceValue, g_engine.sync_state.m_fenceEvent));
+    WaitForSingleObjectEx(g_engine.sync_state.m_fenceEvent, INFINITE, FALSE);
+    g_uploads.stalls++;
+    g_uploads.stallMs += (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+// the copy queue, its batch allocators and fence, and the staging ring
+bool InitUploads()
+{
+    D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+    queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+    if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&g_engine.pipeline_dx12.m_copyQueue))))
+        return false;
+    for (UINT i = 0; i < UPLOAD_BATCH_ALLOCATORS; ++i)
+    {
+        if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY, IID_PPV_ARGS(&g_engine.pipeline_dx12.m_copyCommandAllocators[i]))))
+            return false;
+    }
+    if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, g_engine.pipeline_dx12.m_copyCommandAllocators[0], nullptr,
+                                                                     IID_PPV_ARGS(&g_engine.pipeline_dx12.m_copyCommandList))))
+        return false;
+    HRAssert(g_engine.pipeline_dx12.m_copyCommandList->Close());
+    if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&g_engine.sync_state.m_copyFence))))
+        return false;
+
+    if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommittedResource(
+            &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
+            D3D12_HEAP_FLAG_NONE,
+            &CD3DX12_RESOURCE_DESC::Buffer(UPLOAD_STAGING_SIZE),
+            D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr,
+            IID_PPV_ARGS(&g_engine.graphics_resources.m_stagingBuffer))))
+        return false;
+    CD3DX12_RANGE readRange(0, 0);
+    if (!HRAssert(g_engine.graphics_resources.m_stagingBuffer->Map(0, &readRange, reinterpret_cast<void **>(&g_engine.graphics_resources.m_pStagingBegin))))
+        return false;
+    UploadRingInit(g_staging_ring, UPLOAD_STAGING_SIZE);
+    return true;
+}
+
+// the open batch to the copy queue. returns its token, 0 when there was none open
+UploadToken UploadSubmit()
+{
+    if (!g_uploads.open)
+        return 0;
+    HRAssert(g_engine.pipeline_dx12.m_copyCommandList->Close());
+    ID3D12CommandList *ppLists[] = {g_engine.pipeline_dx12.m_copyCommandList};
+    g_engine.pipeline_dx12.m_copyQueue->ExecuteCommandLists(1, ppLists);
+    HRAssert(g_engine.pipeline_dx12.m_copyQueue->Signal(g_engine.sync_state.m_copyFence, g_uploads.nextFence));
+
+    UploadRingCloseFrame(g_staging_ring, g_uploads.nextFence);
+    g_uploads.allocatorFences[g_uploads.allocator] = g_uploads.nextFence;
+    g_uploads.allocator = (g_uploads.allocator + 1) % UPLOAD_BATCH_ALLOCATORS;
+    g_uploads.submittedFence = g_uploads.nextFence++;
+    g_uploads.open = false;
+    g_uploads.batches++;
+    return g_uploads.submittedFence;
+}
+
+// the copy list, recording into the open batch (starting one if needed)
+ID3D12GraphicsCommandList *UploadBatchList()
+{
+    if (!g_uploads.open)
+    {
+        ID3D12CommandAllocator *allocator = g_engine.pipeline_dx12.m_copyCommandAllocators[g_uploads.allocator];
+        WaitForCopyFence(g_uploads.allocatorFences[g_uploads.allocator]);
+        HRAssert(allocator->Reset());
+        HRAssert(g_engine.pipeline_dx12.m_copyCommandList->Reset(allocator, nullptr));
+        g_uploads.open = true;
+    }
+    return g_engine.pipeline_dx12.m_copyCommandList;
+}
+
+// size bytes of staging: an offset into the ring, or offset 0 of a buffer of its own (*dedicated) when the ring is
+// smaller than that. when the ring is full the open batch is submitted and the oldest one waited for.
+// UPLOAD_RING_FULL when no staging could be had
+UINT64 UploadStagingAlloc(UINT64 size, UINT64 alignment, ID3D12Resource **dedicated)
+{
+    *dedicated = nullptr;
+    if (size > g_staging_ring.capacity)
+    {
+        if (FAILED(CreatePooledResource(g_engine.pipeline_dx12.m_device, GPU_POOL_UPLOAD, CD3DX12_RESOURCE_DESC::Buffer(size),
+                                        D3D12_RESOURCE_STATE_GENERIC_READ, dedicated)))
+            return UPLOAD_RING_FULL;
+        g_uploads.releases.push_back({*dedicated, g_uploads.nextFence});
+        g_uploads.dedicated++;
+        return 0;
+    }
+
+    UploadRingRetire(g_staging_ring, g_engine.sync_state.m_copyFence->GetCompletedValue());
+    UINT64 offset = UploadRingAlloc(g_staging_ring, size, alignment);
+    while (offset == UPLOAD_RING_FULL)
+    {
+        UploadSubmit();
+        if (UploadRingOldestFence(g_staging_ring) == 0)
+            break;
+        WaitForCopyFence(UploadRingOldestFence(g_staging_ring));
+        UploadRingRetire(g_staging_ring, g_engine.sync_state.m_copyFence->GetCompletedValue());
+        offset = UploadRingAlloc(g_staging_ring, size, alignment);
+    }
+    return offset;
+}
+
+// queues the copy of size bytes of data to the start of destination (a buffer in COMMON)
+UploadToken UploadBuffer(ID3D12Resource *destination, const void *data, UINT64 size)
+{
+    ID3D12Resource *dedicated = nullptr;
+    UINT64 offset = UploadStagingAlloc(size, 4, &dedicated);
+    if (offset == UPLOAD_RING_FULL)
+        return 0;
+    if (dedicated)
+    {
+        void *mapped = nullptr;
+        if (FAILED(dedicated->Map(0, nullptr, &mapped)))
+            return 0;
+        memcpy(mapped, data, size);
+        dedicated->Unmap(0, nullptr);
+    }
+    else
+        memcpy(g_engine.graphics_resources.m_pStagingBegin + offset, data, size);
 
-struct
+    UploadBatchList()->CopyBufferRegion(destination, 0, dedicated ? dedicated : g_engine.graphics_resources.m_stagingBuffer, offset, size);
+    g_uploads.uploads++;
+    g_uploads.bytes += size;
+    return g_uploads.nextFence;
+}
+
+// queues the copy of count subresources (from 0) of destination (a texture in COMMON)
+UploadToken UploadTexture(ID3D12Resource *destination, const D3D12_SUBRESOURCE_DATA *subresources, UINT count)
 {
-    bool loaded = false;
-    UINT index = 0; // index into m_models
-    char *filename = "";
-} g_loadedModels[MAX_LOADED_MODELS];
+    UINT64 size = GetRequiredIntermediateSize(destination, 0, count);
+    ID3D12Resource *dedicated = nullptr;
+    UINT64 offset = UploadStagingAlloc(size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, &dedicated);
+    if (offset == UPLOAD_RING_FULL)
+        return 0;
+    if (UpdateSubresources(UploadBatchList(), destination, dedicated ? dedicated : g_engine.graphics_resources.m_stagingBuffer,
+                           offset, 0, count, subresources) == 0)
+        return 0;
+    g_uploads.uploads++;
+    g_uploads.bytes += size;
+    return g_uploads.nextFence;
+}
+
+// releases resource (ReleaseGpuResource) once every copy recorded so far has run, for a destination given up on
+// while its copy may still be pending. the direct queue has to be done with it already
+void UploadReleaseAfter(ID3D12Resource *resource)
+{
+    if (resource)
+        g_uploads.releases.push_back({resource, g_uploads.open ? g_uploads.nextFence : g_uploads.submittedFence});
+}
+
+inline bool UploadIsComplete(UploadToken token)
+{
+    return token != 0 && g_engine.sync_state.m_copyFence->GetCompletedValue() >= token;
+}
+
+// once per frame: staging and the resources waiting on batches the copy queue has finished go back
+void UploadRetire()
+{
+    UINT64 completed = g_engine.sync_state.m_copyFence->GetCompletedValue();
+    UploadRingRetire(g_staging_ring, completed);
+    size_t kept = 0;
+    for (size_t i = 0; i < g_uploads.releases.size(); ++i)
+    {
+        if (g_uploads.releases[i].fence > completed)
+            g_uploads.releases[kept++] = g_uploads.releases[i];
+        else
+            ReleaseGpuResource(g_uploads.releases[i].resource);
+    }
+    g_uploads.releases.resize(kept);
+}
+
+// before the frame's command lists go to the direct queue: submits the open batch and has the direct queue wait (on
+// the GPU) for everything submitted, so the frame never reads a buffer or texture whose copy hasn't landed
+void UploadFlush()
+{
+    UploadSubmit();
+    if (g_uploads.submittedFence > g_uploads.queueWaitFence)
+    {
+        HRAssert(g_engine.pipeline_dx12.m_commandQueue->Wait(g_engine.sync_state.m_copyFence, g_uploads.submittedFence));
+        g_uploads.queueWaitFence = g_uploads.submittedFence;
+    }
+}
+
+// at shutdown, before OnDestroy
+void UploadWaitIdle()
+{
+    UploadSubmit();
+    WaitForCopyFence(g_uploads.submittedFence);
+    UploadRetire();
+}
+
+static std::vector<StringId> g_modelPathIds; // interned path per loaded model (like m_models), dedupe is an int compare
 
 struct TextureLoadResult
 {
     UINT outIndex;
-    ID3D12Resource *uploadHeap = nullptr;
+    UploadToken upload = 0; // the texture's data is on the GPU once the copy fence passes this
     bool success = false;
 
     struct
@@ -318,7 +728,7 @@ struct TextureLoadResult
     } cpu_copy;
 };
 
-TextureLoadResult LoadTextureFromFile(ID3D12Device *device, ID3D12GraphicsCommandList *cmdList, const char *path, ID3D12Resource **outResource, bool makeCPUCopy)
+TextureLoadResult LoadTextureFromFile(ID3D12Device *device, const char *path, ID3D12Resource **outResource, bool makeCPUCopy)
 {
     TextureLoadResult result = {};
     // Convert narrow string to wide string
@@ -373,36 +783,13 @@ TextureLoadResult LoadTextureFromFile(ID3D12Device *device, ID3D12GraphicsComman
     texDesc.SampleDesc.Count = 1;
     texDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
-    hr = device->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
-        D3D12_HEAP_FLAG_NONE,
-        &texDesc,
-        D3D12_RESOURCE_STATE_COPY_DEST,
-        nullptr,
-        IID_PPV_ARGS(outResource));
+    hr = CreatePooledResource(device, GPU_POOL_TEXTURES, texDesc, D3D12_RESOURCE_STATE_COMMON, outResource);
     if (FAILED(hr))
     {
         result.success = false;
         return result;
     }
 
-    UINT64 uploadSize = GetRequiredIntermediateSize(*outResource, 0, (UINT)image.GetImageCount());
-
-    hr = device->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
-        D3D12_HEAP_FLAG_NONE,
-        &CD3DX12_RESOURCE_DESC::Buffer(uploadSize),
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&result.uploadHeap));
-    if (FAILED(hr))
-    {
-        (*outResource)->Release();
-        *outResource = nullptr;
-        result.success = false;
-        return result;
-    }
-
     std::vector<D3D12_SUBRESOURCE_DATA> subresources(image.GetImageCount());
     for (size_t i = 0; i < image.GetImageCount(); ++i)
     {
@@ -412,43 +799,29 @@ TextureLoadResult LoadTextureFromFile(ID3D12Device *device, ID3D12GraphicsComman
         subresources[i].SlicePitch = (LONG_PTR)subImg->slicePitch;
     }
 
-    UpdateSubresources(cmdList, *outResource, result.uploadHeap, 0, 0, (UINT)image.GetImageCount(), subresources.data());
-
-    auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-        *outResource,
-        D3D12_RESOURCE_STATE_COPY_DEST,
-        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    cmdList->ResourceBarrier(1, &barrier);
-
-    // Allocate index in the heightmap heap
-    UINT index = g_engine.graphics_resources.m_nextSceneObject;
-    if (index >= MAX_HEIGHTMAP_TEXTURES)
+    // the slot goes first: once the copy is queued the texture may only go through the deferred free
+    UINT index = CreateBindlessTexture(*outResource, nullptr);
+    if (index == DESCRIPTOR_INVALID)
     {
-        SDL_Log("Out of heightmap texture slots!");
-        (*outResource)->Release();
+        ReleaseGpuResource(*outResource);
+        result.success = false;
+        return result;
+    }
+    result.upload = UploadTexture(*outResource, subresources.data(), (UINT)image.GetImageCount());
+    if (result.upload == 0)
+    {
+        FreeBindlessTexture(index);
         *outResource = nullptr;
-        result.uploadHeap->Release();
         result.success = false;
         return result;
     }
 
-    // Create SRV in the main heap at DescriptorIndices::HEIGHTMAP_SRV + index
-    CD3DX12_CPU_DESCRIPTOR_HANDLE cpuHandle(
-        g_engine.pipeline_dx12.m_mainHeap->GetCPUDescriptorHandleForHeapStart(),
-        (int)(DescriptorIndices::HEIGHTMAP_SRV + index),
-        g_cbvSrvDescriptorSize);
-    device->CreateShaderResourceView(*outResource, nullptr, cpuHandle);
-
-    // Store the resource in the array
-    g_engine.graphics_resources.m_heightmapResources[index] = *outResource;
-    g_engine.graphics_resources.m_nextSceneObject = index + 1;
-
     result.outIndex = index;
     result.success = true;
     return result;
 }
 
-TextureLoadResult LoadSkyTextureFromFile(ID3D12Device *device, ID3D12GraphicsCommandList *cmdList, const char *path, ID3D12Resource **outResource)
+TextureLoadResult LoadSkyTextureFromFile(ID3D12Device *device, const char *path, ID3D12Resource **outResource)
 {
     TextureLoadResult result = {};
     // Convert narrow string to wide string
@@ -480,31 +853,10 @@ TextureLoadResult LoadSkyTextureFromFile(ID3D12Device *device, ID3D12GraphicsCom
     texDesc.SampleDesc.Count = 1;
     texDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
-    hr = device->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
-        D3D12_HEAP_FLAG_NONE,
-        &texDesc,
-        D3D12_RESOURCE_STATE_COPY_DEST,
-        nullptr,
-        IID_PPV_ARGS(outResource));
+    hr = CreatePooledResource(device, GPU_POOL_TEXTURES, texDesc, D3D12_RESOURCE_STATE_COMMON, outResource);
     if (FAILED(hr))
         return result;
 
-    UINT64 uploadSize = GetRequiredIntermediateSize(*outResource, 0, (UINT)image.GetImageCount());
-    hr = device->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
-        D3D12_HEAP_FLAG_NONE,
-        &CD3DX12_RESOURCE_DESC::Buffer(uploadSize),
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&result.uploadHeap));
-    if (FAILED(hr))
-    {
-        (*outResource)->Release();
-        *outResource = nullptr;
-        return result;
-    }
-
     std::vector<D3D12_SUBRESOURCE_DATA> subresources(image.GetImageCount());
     for (size_t i = 0; i < image.GetImageCount(); ++i)
     {
@@ -514,36 +866,20 @@ TextureLoadResult LoadSkyTextureFromFile(ID3D12Device *device, ID3D12GraphicsCom
         subresources[i].SlicePitch = (LONG_PTR)subImg->slicePitch;
     }
 
-    UpdateSubresources(cmdList, *outResource, result.uploadHeap, 0, 0, (UINT)image.GetImageCount(), subresources.data());
-
-    auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-        *outResource,
-        D3D12_RESOURCE_STATE_COPY_DEST,
-        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    cmdList->ResourceBarrier(1, &barrier);
-
-    // Allocate index in the sky texture array
-    UINT index = g_engine.graphics_resources.m_nextSceneObject;
-    if (index >= MAX_SKY_TEXTURES)
+    UINT index = CreateBindlessTexture(*outResource, nullptr);
+    if (index == DESCRIPTOR_INVALID)
+    {
+        ReleaseGpuResource(*outResource);
+        return result;
+    }
+    result.upload = UploadTexture(*outResource, subresources.data(), (UINT)image.GetImageCount());
+    if (result.upload == 0)
     {
-        SDL_Log("Out of sky texture slots!");
-        (*outResource)->Release();
+        FreeBindlessTexture(index);
         *outResource = nullptr;
-        result.uploadHeap->Release();
         return result;
     }
 
-    // Create SRV in the main heap at DescriptorIndices::SKY_SRV + index
-    CD3DX12_CPU_DESCRIPTOR_HANDLE cpuHandle(
-        g_engine.pipeline_dx12.m_mainHeap->GetCPUDescriptorHandleForHeapStart(),
-        (int)(DescriptorIndices::SKY_SRV + index),
-        g_cbvSrvDescriptorSize);
-    device->CreateShaderResourceView(*outResource, nullptr, cpuHandle);
-
-    // Store the resource in the array
-    g_engine.graphics_resources.m_skyResources[index] = *outResource;
-    g_engine.graphics_resources.m_nextSceneObject = index + 1;
-
     result.outIndex = index;
     result.success = true;
     return result;
@@ -551,7 +887,6 @@ TextureLoadResult LoadSkyTextureFromFile(ID3D12Device *device, ID3D12GraphicsCom
 
 bool CreateHeightfieldMesh(
     ID3D12Device *device,
-    ID3D12GraphicsCommandList *cmdList,
     UINT gridSize, // number of quads per side (power of two)
     ID3D12Resource *&outVertexBuffer,
     D3D12_VERTEX_BUFFER_VIEW &outVertexView,
@@ -603,28 +938,11 @@ bool CreateHeightfieldMesh(
         }
     }
 
-    // Create vertex buffer using CreateDefaultBuffer (upload then default)
-    ID3D12Resource *uploadVertex = nullptr;
-    if (!CreateDefaultBuffer(device, cmdList, vertices.data(), vertexCount * sizeof(Vertex),
-                             D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER,
-                             &outVertexBuffer, &uploadVertex))
-    {
+    // Create vertex and index buffers using CreateDefaultBuffer (staged on the copy queue)
+    if (!CreateDefaultBuffer(device, vertices.data(), vertexCount * sizeof(Vertex), &outVertexBuffer))
         return false;
-    }
-    // We need to keep uploadVertex until after command list execution. We'll store it similarly to primitive upload buffers.
-    // For simplicity, we can create a static array or store in g_engine.graphics_resources and release after WaitForGpu.
-    // We'll add a member to g_engine.graphics_resources to hold the upload buffer.
-    g_engine.graphics_resources.m_heightfieldVertexUpload = uploadVertex;
-
-    // Create index buffer similarly
-    ID3D12Resource *uploadIndex = nullptr;
-    if (!CreateDefaultBuffer(device, cmdList, indices.data(), indexCount * sizeof(uint32_t),
-                             D3D12_RESOURCE_STATE_INDEX_BUFFER,
-                             &outIndexBuffer, &uploadIndex))
-    {
+    if (!CreateDefaultBuffer(device, indices.data(), indexCount * sizeof(uint32_t), &outIndexBuffer))
         return false;
-    }
-    g_engine.graphics_resources.m_heightfieldIndexUpload = uploadIndex;
 
     // Set views
     outVertexView.BufferLocation = outVertexBuffer->GetGPUVirtualAddress();
@@ -643,13 +961,12 @@ struct ModelTextureLoadResult
 {
     UINT index;
     ID3D12Resource *textureResource;
-    ID3D12Resource *uploadHeap;
+    UploadToken upload;
     bool success;
 };
 
 ModelTextureLoadResult LoadTextureFromCgltfImage(
     ID3D12Device *device,
-    ID3D12GraphicsCommandList *cmdList,
     const cgltf_image *image,
     const char *modelPath) // for resolving relative paths (if needed)
 {
@@ -735,30 +1052,9 @@ ModelTextureLoadResult LoadTextureFromCgltfImage(
     D3D12_RESOURCE_DESC texDesc = CD3DX12_RESOURCE_DESC::Tex2D(
         meta.format, (UINT)meta.width, (UINT)meta.height, 1, (UINT16)meta.mipLevels);
 
-    hr = device->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
-        D3D12_HEAP_FLAG_NONE,
-        &texDesc,
-        D3D12_RESOURCE_STATE_COPY_DEST,
-        nullptr,
-        IID_PPV_ARGS(&result.textureResource));
-    if (FAILED(hr))
-        return result;
-
-    UINT64 uploadSize = GetRequiredIntermediateSize(result.textureResource, 0, (UINT)imageData.GetImageCount());
-    hr = device->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
-        D3D12_HEAP_FLAG_NONE,
-        &CD3DX12_RESOURCE_DESC::Buffer(uploadSize),
-        D3D12_RESOURCE_STATE_GENERIC_READ,
-        nullptr,
-        IID_PPV_ARGS(&result.uploadHeap));
+    hr = CreatePooledResource(device, GPU_POOL_TEXTURES, texDesc, D3D12_RESOURCE_STATE_COMMON, &result.textureResource);
     if (FAILED(hr))
-    {
-        result.textureResource->Release();
-        result.textureResource = nullptr;
         return result;
-    }
 
     std::vector<D3D12_SUBRESOURCE_DATA> subresources(imageData.GetImageCount());
     for (size_t i = 0; i < imageData.GetImageCount(); ++i)
@@ -769,36 +1065,20 @@ ModelTextureLoadResult LoadTextureFromCgltfImage(
         subresources[i].SlicePitch = (LONG)subImg->slicePitch;
     }
 
-    UpdateSubresources(cmdList, result.textureResource, result.uploadHeap, 0, 0,
-                       (UINT)imageData.GetImageCount(), subresources.data());
-
-    auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-        result.textureResource,
-        D3D12_RESOURCE_STATE_COPY_DEST,
-        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-    cmdList->ResourceBarrier(1, &barrier);
-
-    // Find free slot in model albedo array
-    UINT index = 0;
-    for (; index < MAX_LOADED_MODELS; ++index)
-        if (g_engine.graphics_resources.m_modelAlbedoTextures[index] == nullptr)
-            break;
-    if (index >= MAX_LOADED_MODELS)
+    UINT index = CreateBindlessTexture(result.textureResource, nullptr);
+    if (index == DESCRIPTOR_INVALID)
     {
-        SDL_Log("Out of model albedo texture slots!");
-        result.textureResource->Release();
-        result.uploadHeap->Release();
+        ReleaseGpuResource(result.textureResource);
+        return result;
+    }
+    result.upload = UploadTexture(result.textureResource, subresources.data(), (UINT)imageData.GetImageCount());
+    if (result.upload == 0)
+    {
+        FreeBindlessTexture(index);
+        result.textureResource = nullptr;
         return result;
     }
 
-    // Create SRV at MODEL_ALBEDO_SRV + index
-    CD3DX12_CPU_DESCRIPTOR_HANDLE cpuHandle(
-        g_engine.pipeline_dx12.m_mainHeap->GetCPUDescriptorHandleForHeapStart(),
-        (int)(DescriptorIndices::MODEL_ALBEDO_SRV + index),
-        g_cbvSrvDescriptorSize);
-    device->CreateShaderResourceView(result.textureResource, nullptr, cpuHandle);
-
-    g_engine.graphics_resources.m_modelAlbedoTextures[index] = result.textureResource;
     result.index = index;
     result.success = true;
     return result;
@@ -808,7 +1088,7 @@ ModelTextureLoadResult LoadTextureFromCgltfImage(
 struct ModelLoadResult
 {
     UINT index;
-    ID3D12Resource *uploadHeap = nullptr;
+    UploadToken upload = 0; // the buffers and texture are on the GPU once the copy fence passes this
     bool success = false;
 };
 
@@ -844,6 +1124,8 @@ ModelLoadResult LoadModelFromFile(const char *path)
     std::vector<Vertex> vertices(totalVerts);
     std::vector<uint32_t> indices(totalIndices);
     UINT vOffset = 0, iOffset = 0;
+    DirectX::XMFLOAT3 boundsMin = {FLT_MAX, FLT_MAX, FLT_MAX};
+    DirectX::XMFLOAT3 boundsMax = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
 
     for (cgltf_size i = 0; i < data->meshes_count; ++i)
     {
@@ -874,6 +1156,15 @@ ModelLoadResult LoadModelFromFile(const char *path)
             }
 
             cgltf_size vertexCount = posAttr->data->count;
+
+            // glTF requires min/max on position accessors, but fall back to the vertices if an exporter skipped them
+            bool accessorBounds = posAttr->data->has_min && posAttr->data->has_max;
+            if (accessorBounds)
+            {
+                boundsMin = {fminf(boundsMin.x, posAttr->data->min[0]), fminf(boundsMin.y, posAttr->data->min[1]), fminf(boundsMin.z, posAttr->data->min[2])};
+                boundsMax = {fmaxf(boundsMax.x, posAttr->data->max[0]), fmaxf(boundsMax.y, posAttr->data->max[1]), fmaxf(boundsMax.z, posAttr->data->max[2])};
+            }
+
             // For each vertex in this primitive
             for (cgltf_size k = 0; k < vertexCount; ++k)
             {
@@ -881,6 +1172,11 @@ ModelLoadResult LoadModelFromFile(const char *path)
 
                 // Read position (3 floats)
                 cgltf_accessor_read_float(posAttr->data, k, &v.position.x, 3);
+                if (!accessorBounds)
+                {
+                    boundsMin = {fminf(boundsMin.x, v.position.x), fminf(boundsMin.y, v.position.y), fminf(boundsMin.z, v.position.z)};
+                    boundsMax = {fmaxf(boundsMax.x, v.position.x), fmaxf(boundsMax.y, v.position.y), fmaxf(boundsMax.z, v.position.z)};
+                }
 
                 // Read normal if available, else default (0,1,0)
                 if (normAttr)
@@ -913,20 +1209,33 @@ ModelLoadResult LoadModelFromFile(const char *path)
 
     SDL_Log("Loaded Model %s: %u verts, %u indices", path, totalVerts, totalIndices);
 
+    // coarser levels of detail, appended to indices after the full mesh
+    static_assert(sizeof(Vertex) == 8 * sizeof(float), "MeshSimplifyCluster reads Vertex as 8 floats");
+    UINT lodIndexStart[MODEL_MAX_LODS] = {0};
+    UINT lodIndexCount[MODEL_MAX_LODS] = {totalIndices};
+    UINT lodCount = 1;
+    float extent = boundsMin.x <= boundsMax.x ? fmaxf(boundsMax.x - boundsMin.x, fmaxf(boundsMax.y - boundsMin.y, boundsMax.z - boundsMin.z)) : 0.0f;
+    std::vector<uint32_t> lodIndices;
+    for (int lod = 1; lod < MODEL_MAX_LODS && extent > 0.0f && totalIndices > 0; ++lod)
+    {
+        uint32_t triangles = MeshSimplifyCluster(&vertices[0].position.x, &vertices[0].normal.x, 8, totalVerts, indices.data(), totalIndices,
+                                                 extent / kModelLodGridCells[lod], lodIndices);
+        if (triangles == 0 || triangles > lodIndexCount[lodCount - 1] / 3 * MODEL_LOD_MIN_REDUCTION)
+            continue;
+        lodIndexStart[lodCount] = (UINT)indices.size();
+        lodIndexCount[lodCount] = (UINT)lodIndices.size();
+        indices.insert(indices.end(), lodIndices.begin(), lodIndices.end());
+        SDL_Log("  LOD %u: %u triangles", lodCount, triangles);
+        lodCount++;
+    }
+
     // ... after filling vertices and indices ...
 
     // --- Start of upload section ---
-    // Ensure command list is open for recording
-    HRAssert(g_engine.pipeline_dx12.m_commandAllocators[0]->Reset());
-    HRAssert(g_engine.pipeline_dx12.m_commandList[0]->Reset(
-        g_engine.pipeline_dx12.m_commandAllocators[0],
-        g_engine.pipeline_dx12.m_pipelineStates[RenderPipeline::RENDER_DEFAULT][BlendMode::BLEND_OPAQUE][0]));
-
-    // We'll collect all upload heaps here to release after WaitForAllFrames
-    std::vector<ID3D12Resource *> uploadHeaps;
+    // everything is queued on the copy queue (see UploadBuffer), the frames wait for it on the GPU, not here
 
     // --- Texture loading ---
-    UINT textureIndex = 0; // fallback to index 0
+    UINT textureIndex = g_fallbackAlbedoIndex;
     if (data->materials_count > 0)
     {
         cgltf_material *mat = &data->materials[0];
@@ -937,79 +1246,57 @@ ModelLoadResult LoadModelFromFile(const char *path)
             {
                 ModelTextureLoadResult texResult = LoadTextureFromCgltfImage(
                     g_engine.pipeline_dx12.m_device,
-                    g_engine.pipeline_dx12.m_commandList[0],
                     tex->image,
                     path);
                 if (texResult.success)
-                {
                     textureIndex = texResult.index;
-                    if (texResult.uploadHeap)
-                        uploadHeaps.push_back(texResult.uploadHeap);
-                }
             }
         }
     }
 
     // Create GPU buffers using CreateDefaultBuffer
-    ID3D12Resource *vb = nullptr, *ib = nullptr, *vbUpload = nullptr, *ibUpload = nullptr;
-    if (!CreateDefaultBuffer(g_engine.pipeline_dx12.m_device, g_engine.pipeline_dx12.m_commandList[0],
-                             vertices.data(), totalVerts * sizeof(Vertex),
-                             D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER,
-                             &vb, &vbUpload))
+    ID3D12Resource *vb = nullptr, *ib = nullptr;
+    if (!CreateDefaultBuffer(g_engine.pipeline_dx12.m_device, vertices.data(), totalVerts * sizeof(Vertex), &vb))
     {
         cgltf_free(data);
         return result;
     }
-    uploadHeaps.push_back(vbUpload);
 
-    if (!CreateDefaultBuffer(g_engine.pipeline_dx12.m_device, g_engine.pipeline_dx12.m_commandList[0],
-                             indices.data(), totalIndices * sizeof(uint32_t),
-                             D3D12_RESOURCE_STATE_INDEX_BUFFER,
-                             &ib, &ibUpload))
+    // the index buffer's copy goes in after all the others, so its token stands for the whole model
+    if (!CreateDefaultBuffer(g_engine.pipeline_dx12.m_device, indices.data(), indices.size() * sizeof(uint32_t), &ib, &result.upload))
     {
-        vb->Release();
-        vbUpload->Release();
+        UploadReleaseAfter(vb);
         cgltf_free(data);
         return result;
     }
-    uploadHeaps.push_back(ibUpload);
-
-    // Close and execute command list
-    HRAssert(g_engine.pipeline_dx12.m_commandList[0]->Close());
-    ID3D12CommandList *ppLists[] = {g_engine.pipeline_dx12.m_commandList[0]};
-    g_engine.pipeline_dx12.m_commandQueue->ExecuteCommandLists(1, ppLists);
-
-    // Wait for the GPU to finish copying
-    WaitForAllFrames();
-
-    // Release all upload heaps
-    for (auto *upload : uploadHeaps)
-        upload->Release();
 
     // Store model data (including texture index)
-    static UINT currentModelIndex = 0;
-    if (currentModelIndex >= MAX_LOADED_MODELS)
+    ModelResources model = {};
+    model.vertexBuffer = vb;
+    model.indexBuffer = ib;
+    model.vertexView.BufferLocation = vb->GetGPUVirtualAddress();
+    model.vertexView.StrideInBytes = sizeof(Vertex);
+    model.vertexView.SizeInBytes = totalVerts * sizeof(Vertex);
+    for (UINT lod = 0; lod < lodCount; ++lod)
     {
-        SDL_Log("Max models reached!");
-        return result;
+        model.indexViews[lod].BufferLocation = ib->GetGPUVirtualAddress() + lodIndexStart[lod] * sizeof(uint32_t);
+        model.indexViews[lod].SizeInBytes = lodIndexCount[lod] * sizeof(uint32_t);
+        model.indexViews[lod].Format = DXGI_FORMAT_R32_UINT;
+        model.indexCounts[lod] = lodIndexCount[lod];
     }
-    g_engine.graphics_resources.m_models[currentModelIndex].vertexBuffer = vb;
-    g_engine.graphics_resources.m_models[currentModelIndex].indexBuffer = ib;
-    g_engine.graphics_resources.m_models[currentModelIndex].vertexView.BufferLocation = vb->GetGPUVirtualAddress();
-    g_engine.graphics_resources.m_models[currentModelIndex].vertexView.StrideInBytes = sizeof(Vertex);
-    g_engine.graphics_resources.m_models[currentModelIndex].vertexView.SizeInBytes = totalVerts * sizeof(Vertex);
-    g_engine.graphics_resources.m_models[currentModelIndex].indexView.BufferLocation = ib->GetGPUVirtualAddress();
-    g_engine.graphics_resources.m_models[currentModelIndex].indexView.SizeInBytes = totalIndices * sizeof(uint32_t);
-    g_engine.graphics_resources.m_models[currentModelIndex].indexView.Format = DXGI_FORMAT_R32_UINT;
-    g_engine.graphics_resources.m_models[currentModelIndex].indexCount = totalIndices;
-    g_engine.graphics_resources.m_models[currentModelIndex].textureIndex = textureIndex; // store it!
-    strcpy_s(g_modelPaths[currentModelIndex], sizeof(g_modelPaths[currentModelIndex]), path);
-    g_engine.graphics_resources.m_numModelsLoaded++;
+    model.lodCount = lodCount;
+    model.textureIndex = textureIndex; // store it!
+    if (boundsMin.x <= boundsMax.x)
+    {
+        model.boundsMin = boundsMin;
+        model.boundsMax = boundsMax;
+    }
+    g_engine.graphics_resources.m_models.push_back(model);
+    g_modelPathIds.push_back(StringIntern(path));
 
     cgltf_free(data);
     result.success = true;
-    result.index = currentModelIndex;
-    currentModelIndex++;
+    result.index = (UINT)g_engine.graphics_resources.m_models.size() - 1;
     return result;
 }
 
@@ -1048,6 +1335,16 @@ void WaitForGpu()
     // g_engine.sync_state.m_fenceValues[g_engine.sync_state.m_frameIndex]++;
 }
 
+// Wait until the GPU has reached fenceValue, without signalling anything new.
+void WaitForFenceValue(UINT64 fenceValue)
+{
+    if (g_engine.sync_state.m_fence->GetCompletedValue() < fenceValue)
+    {
+        HRAssert(g_engine.sync_state.m_fence->SetEventOnCompletion(fenceValue, g_engine.sync_state.m_fenceEvent));
+        WaitForSingleObjectEx(g_engine.sync_state.m_fenceEvent, INFINITE, FALSE);
+    }
+}
+
 void WaitForAllFrames()
 {
     // Wait for ALL frames to complete (triple buffering)
@@ -1436,6 +1733,8 @@ bool LoadPipeline(HWND hwnd)
 
     if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&g_engine.pipeline_dx12.m_commandQueue))))
         return false;
+    if (!InitUploads())
+        return false;
 
     // Describe and create the swap chain.
     DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
@@ -1485,11 +1784,13 @@ bool LoadPipeline(HWND hwnd)
 
         // Describe and create a shader resource view (SRV) heap for the texture.
         D3D12_DESCRIPTOR_HEAP_DESC mainHeapDesc = {};
-        mainHeapDesc.NumDescriptors = DescriptorIndices::NUM_DESCRIPTORS; // Texture + per-frame CBVs + per-scene CBV
+        mainHeapDesc.NumDescriptors = DescriptorIndices::NUM_DESCRIPTORS; // per-frame CBVs + per-scene CBV + default texture + bindless table
         mainHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
         mainHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
         if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateDescriptorHeap(&mainHeapDesc, IID_PPV_ARGS(&g_engine.pipeline_dx12.m_mainHeap))))
             return false;
+        InitBindlessSlots();
+        InitGpuHeaps();
         g_engine.pipeline_dx12.m_rtvDescriptorSize = g_engine.pipeline_dx12.m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
 
         // Create ImGui's descriptor heap
@@ -1605,8 +1906,87 @@ std::vector<UINT8> GenerateTextureData()
     return data;
 }
 
+// compiled shaders survive between runs in a cache file next to the executable (shader_cache.h), loaded at the start
+// of LoadAssets and written back at its end if anything changed
+#define SHADER_CACHE_FILE_NAME "shader_cache.bin"
+static_assert(sizeof(ShaderCacheDefine) == sizeof(D3D_SHADER_MACRO) &&
+                  offsetof(ShaderCacheDefine, value) == offsetof(D3D_SHADER_MACRO, Definition),
+              "ShaderCacheDefine mirrors D3D_SHADER_MACRO");
+
+static ShaderCache g_shader_cache;
+static double g_shaderCompileMs = 0.0; // CompileShader's time this run, cache lookups included
+
+static void ShaderCachePath(char *path, size_t size, const char *suffix = "")
+{
+    const char *base = SDL_GetBasePath();
+    snprintf(path, size, "%s%s%s", base ? base : "", SHADER_CACHE_FILE_NAME, suffix);
+}
+
+// D3D_COMPILER_VERSION only changes with the SDK, the DLL can be updated under it, so its size and date count too
+static uint64_t ShaderCompilerVersion()
+{
+    uint64_t version = D3D_COMPILER_VERSION;
+    wchar_t path[MAX_PATH];
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    HMODULE module = GetModuleHandleW(D3DCOMPILER_DLL_W);
+    if (module && GetModuleFileNameW(module, path, MAX_PATH) && GetFileAttributesExW(path, GetFileExInfoStandard, &attributes))
+    {
+        version = ShaderCacheHashBytes(&attributes.ftLastWriteTime, sizeof(attributes.ftLastWriteTime), version);
+        version = ShaderCacheHashBytes(&attributes.nFileSizeLow, sizeof(attributes.nFileSizeLow), version);
+    }
+    return version;
+}
+
+void LoadShaderCache()
+{
+    ShaderCacheInit(g_shader_cache, ShaderCompilerVersion());
+    char path[MAX_PATH];
+    ShaderCachePath(path, sizeof(path));
+    size_t size = 0;
+    void *file = SDL_LoadFile(path, &size); // the whole file in one read
+    if (!file)
+        return;
+    if (!ShaderCacheParse(g_shader_cache, file, size))
+        SDL_Log("Shader cache %s is from another compiler or damaged, recompiling", path);
+    else
+        SDL_Log("Shader cache: %zu shaders (%.1f KB) in %s", g_shader_cache.entries.size(), size / 1024.0, path);
+    SDL_free(file);
+}
+
+// written to a temporary file first, a crash half way through leaves the old cache
+bool SaveShaderCache()
+{
+    ShaderCachePruneUnused(g_shader_cache);
+    if (!g_shader_cache.dirty)
+        return true;
+    std::vector<uint8_t> bytes;
+    ShaderCacheSerialize(g_shader_cache, bytes);
+    char tempPath[MAX_PATH], path[MAX_PATH];
+    ShaderCachePath(tempPath, sizeof(tempPath), ".tmp");
+    ShaderCachePath(path, sizeof(path));
+    bool ok = false;
+    SDL_IOStream *file = SDL_IOFromFile(tempPath, "wb");
+    if (file)
+    {
+        ok = SDL_WriteIO(file, bytes.data(), bytes.size()) == bytes.size();
+        ok = SDL_CloseIO(file) && ok;
+    }
+    if (ok)
+        ok = SDL_RenamePath(tempPath, path);
+    if (!ok)
+    {
+        SDL_Log("Failed to save %s: %s", path, SDL_GetError());
+        return false;
+    }
+    g_shader_cache.dirty = false;
+    g_shader_cache.fileBytes = bytes.size();
+    return true;
+}
+
 // Helper to compile a shader from file with common settings.
 // Returns true on success, false on failure. On success, outBlob contains the compiled shader.
+// The source is preprocessed first, the result keys the shader cache; only a miss compiles (the preprocessed text, so
+// what's cached is exactly what was hashed).
 bool CompileShader(
     const wchar_t *filename,
     const char *entryPoint,
@@ -1620,17 +2000,58 @@ bool CompileShader(
 #endif
     compileFlags |= D3DCOMPILE_ENABLE_UNBOUNDED_DESCRIPTOR_TABLES;
 
+    Uint64 start = SDL_GetPerformanceCounter();
+    *outBlob = nullptr;
+    char sourceName[MAX_PATH];
+    if (!WideCharToMultiByte(CP_UTF8, 0, filename, -1, sourceName, MAX_PATH, nullptr, nullptr))
+        return false;
+
+    ID3DBlob *source = nullptr;
+    ID3DBlob *preprocessed = nullptr;
     ID3DBlob *errorBlob = nullptr;
-    HRESULT hr = D3DCompileFromFile(
-        filename,
-        defines,
-        nullptr, // no include handler
-        entryPoint,
-        target,
-        compileFlags,
-        0, // no effect flags
-        outBlob,
-        &errorBlob);
+    HRESULT hr = D3DReadFileToBlob(filename, &source);
+    if (SUCCEEDED(hr))
+    {
+        hr = D3DPreprocess(source->GetBufferPointer(), source->GetBufferSize(), sourceName, defines,
+                           nullptr, // no include handler
+                           &preprocessed, &errorBlob);
+        source->Release();
+    }
+
+    const ShaderCacheEntry *cached = nullptr;
+    if (SUCCEEDED(hr))
+    {
+        ShaderCacheKey key = ShaderCacheMakeKey(preprocessed->GetBufferPointer(), preprocessed->GetBufferSize(),
+                                                (const ShaderCacheDefine *)defines, entryPoint, target, compileFlags,
+                                                g_shader_cache.compilerVersion);
+        cached = ShaderCacheFind(g_shader_cache, key);
+        if (cached)
+        {
+            hr = D3DCreateBlob(cached->size, outBlob);
+            if (SUCCEEDED(hr))
+                memcpy((*outBlob)->GetBufferPointer(), &g_shader_cache.data[cached->offset], cached->size);
+        }
+        else
+        {
+            hr = D3DCompile(
+                preprocessed->GetBufferPointer(),
+                preprocessed->GetBufferSize(),
+                sourceName,
+                nullptr, // defines are already applied
+                nullptr, // no include handler
+                entryPoint,
+                target,
+                compileFlags,
+                0, // no effect flags
+                outBlob,
+                &errorBlob);
+            if (SUCCEEDED(hr))
+                ShaderCacheInsert(g_shader_cache, key, (*outBlob)->GetBufferPointer(), (*outBlob)->GetBufferSize());
+        }
+    }
+    if (preprocessed)
+        preprocessed->Release();
+    g_shaderCompileMs += (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
 
     if (FAILED(hr))
     {
@@ -1647,8 +2068,38 @@ bool CompileShader(
     }
     else
     {
-        SDL_Log("Compiled %s (%s) - blob size %zu", entryPoint, target, (*outBlob)->GetBufferSize());
+        if (errorBlob) // warnings
+            errorBlob->Release();
+        SDL_Log("%s %s (%s) - blob size %zu", cached ? "Loaded cached" : "Compiled", entryPoint, target, (*outBlob)->GetBufferSize());
+    }
+    return true;
+}
+
+// (re)creates the upload ring's buffer with size bytes, kept mapped like the constant buffers. a previous buffer is
+// released once the new one exists (kept when creating fails), the caller makes sure the GPU is done with it
+bool CreateUploadRingBuffer(UINT64 size)
+{
+    ID3D12Resource *buffer = nullptr;
+    if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommittedResource(
+            &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
+            D3D12_HEAP_FLAG_NONE,
+            &CD3DX12_RESOURCE_DESC::Buffer(size),
+            D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr,
+            IID_PPV_ARGS(&buffer))))
+        return false;
+
+    UINT8 *mapped = nullptr;
+    CD3DX12_RANGE readRange(0, 0);
+    if (!HRAssert(buffer->Map(0, &readRange, reinterpret_cast<void **>(&mapped))))
+    {
+        buffer->Release();
+        return false;
     }
+    if (g_engine.graphics_resources.m_uploadRingBuffer)
+        g_engine.graphics_resources.m_uploadRingBuffer->Release();
+    g_engine.graphics_resources.m_uploadRingBuffer = buffer;
+    g_engine.graphics_resources.m_pUploadRingBegin = mapped;
     return true;
 }
 
@@ -1656,22 +2107,23 @@ bool CompileShader(
 // Load the startup assets. Returns true on success, false on fail.
 bool LoadAssets()
 {
+    LoadShaderCache();
+
     // Create root signature
     {
         CD3DX12_DESCRIPTOR_RANGE cbvRange;
         cbvRange.Init(D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 2); // register b2
 
-        CD3DX12_DESCRIPTOR_RANGE srvRanges[4];                    // default texture + heightmaps + sky + models
+        CD3DX12_DESCRIPTOR_RANGE srvRanges[2];                    // default texture + the bindless table
         srvRanges[0].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 1, 0); // t0: default texture
-        srvRanges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, MAX_HEIGHTMAP_TEXTURES, RegisterLayout::HEIGHTMAP_REGISTER_BASE);
-        srvRanges[2].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, MAX_SKY_TEXTURES, RegisterLayout::SKY_REGISTER_BASE);
-        srvRanges[3].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, MAX_LOADED_MODELS, RegisterLayout::ALBEDO_REGISTER_BASE);
+        srvRanges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, UINT_MAX, RegisterLayout::BINDLESS_REGISTER_BASE); // unbounded, g_textures[]
 
-        CD3DX12_ROOT_PARAMETER rootParameters[4];
+        CD3DX12_ROOT_PARAMETER rootParameters[5];
         rootParameters[RootParameters::PER_DRAW_CONSTANTS].InitAsConstants(sizeof(PerDrawRootConstants) / 4, 0, 0, D3D12_SHADER_VISIBILITY_ALL);
         rootParameters[RootParameters::PER_FRAME_CBV].InitAsConstantBufferView(1, 0, D3D12_SHADER_VISIBILITY_ALL); // register b1
         rootParameters[RootParameters::PER_SCENE_DESC_TABLE].InitAsDescriptorTable(1, &cbvRange, D3D12_SHADER_VISIBILITY_ALL);
         rootParameters[RootParameters::SRV_DESC_TABLE].InitAsDescriptorTable(_countof(srvRanges), srvRanges, D3D12_SHADER_VISIBILITY_ALL);
+        rootParameters[RootParameters::INSTANCE_SRV].InitAsShaderResourceView(0, 1, D3D12_SHADER_VISIBILITY_VERTEX); // register t0, space1
 
         D3D12_STATIC_SAMPLER_DESC sampler = {};
         sampler.Filter = D3D12_FILTER_ANISOTROPIC;
@@ -1708,6 +2160,30 @@ bool LoadAssets()
             return false;
     }
 
+    // Create the indirect draw command signature: per record the mesh, the per draw constants and the draw
+    {
+        static_assert(sizeof(IndirectDrawIndexedArgs) == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS), "indirect_draws.h args don't match D3D12");
+        static_assert(sizeof(PerDrawRootConstants) == INDIRECT_DRAW_CONSTANTS * 4, "update INDIRECT_DRAW_CONSTANTS");
+        static_assert(offsetof(IndirectDrawRecord, draw) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS) == INDIRECT_DRAW_SIGNATURE_BYTES, "record layout");
+
+        D3D12_INDIRECT_ARGUMENT_DESC arguments[4] = {};
+        arguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW;
+        arguments[0].VertexBuffer.Slot = 0;
+        arguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+        arguments[2].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+        arguments[2].Constant.RootParameterIndex = RootParameters::PER_DRAW_CONSTANTS;
+        arguments[2].Constant.DestOffsetIn32BitValues = 0;
+        arguments[2].Constant.Num32BitValuesToSet = INDIRECT_DRAW_CONSTANTS;
+        arguments[3].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+
+        D3D12_COMMAND_SIGNATURE_DESC signatureDesc = {};
+        signatureDesc.ByteStride = sizeof(IndirectDrawRecord);
+        signatureDesc.NumArgumentDescs = _countof(arguments);
+        signatureDesc.pArgumentDescs = arguments;
+        if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommandSignature(&signatureDesc, g_engine.pipeline_dx12.m_rootSignature, IID_PPV_ARGS(&g_engine.pipeline_dx12.m_drawCommandSignature))))
+            return false;
+    }
+
     // Create the pipeline states, which includes compiling and loading shaders.
     // Define the vertex input layout.
     D3D12_INPUT_ELEMENT_DESC inputElementDescs[] =
@@ -1731,6 +2207,17 @@ bool LoadAssets()
                 g_engine.pipeline_dx12.m_pipelineStates[RenderPipeline::RENDER_DEFAULT][b][0],
                 IID_PPV_ARGS(&g_engine.pipeline_dx12.m_commandList[i])));
         HRAssert(g_engine.pipeline_dx12.m_commandList[i]->Close());
+
+        for (UINT c = 1; c < MAX_RECORD_CHUNKS; ++c)
+        {
+            UINT chunkIndex = i * MAX_RECORD_CHUNKS + c;
+            if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&g_engine.pipeline_dx12.m_chunkCommandAllocators[chunkIndex]))))
+                return false;
+            if (!HRAssert(g_engine.pipeline_dx12.m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, g_engine.pipeline_dx12.m_chunkCommandAllocators[chunkIndex], nullptr,
+                                                                             IID_PPV_ARGS(&g_engine.pipeline_dx12.m_chunkCommandLists[chunkIndex]))))
+                return false;
+            HRAssert(g_engine.pipeline_dx12.m_chunkCommandLists[chunkIndex]->Close());
+        }
     }
 
     // Reset the first command list for setup recording
@@ -1740,19 +2227,20 @@ bool LoadAssets()
 
     for (UINT i = 0; i < PrimitiveType::PRIMITIVE_COUNT; ++i)
     {
-        PrimitiveType type = static_cast<PrimitiveType>(i);
-        if (!CreatePrimitiveMeshBuffers(
-                g_engine.pipeline_dx12.m_device,
-                g_engine.pipeline_dx12.m_commandList[0],
-                type,
-                kPrimitiveMeshData[i],
-                g_engine.graphics_resources.m_vertexBuffer[i],
-                g_engine.graphics_resources.m_vertexBufferView[i],
-                g_engine.graphics_resources.m_indexBuffer[i],
-                g_engine.graphics_resources.m_indexBufferView[i],
-                g_engine.graphics_resources.m_indexCount[i]))
+        for (UINT lod = 0; lod < kPrimitiveLodCount[i]; ++lod)
         {
-            return false;
+            UINT slot = PRIMITIVE_LOD_SLOT(i, lod);
+            if (!CreatePrimitiveMeshBuffers(
+                    g_engine.pipeline_dx12.m_device,
+                    kPrimitiveLodMeshData[i][lod],
+                    g_engine.graphics_resources.m_vertexBuffer[slot],
+                    g_engine.graphics_resources.m_vertexBufferView[slot],
+                    g_engine.graphics_resources.m_indexBuffer[slot],
+                    g_engine.graphics_resources.m_indexBufferView[slot],
+                    g_engine.graphics_resources.m_indexCount[slot]))
+            {
+                return false;
+            }
         }
     }
 
@@ -1799,13 +2287,14 @@ bool LoadAssets()
             SDL_Log("Device removed before texture creation: 0x%08X", removal);
         }
 
+        ID3D12Resource *errTexture = nullptr;
         HRESULT hr = g_engine.pipeline_dx12.m_device->CreateCommittedResource(
             &heapProps,
             D3D12_HEAP_FLAG_NONE,
             &errDesc,
             D3D12_RESOURCE_STATE_COPY_DEST,
             nullptr,
-            IID_PPV_ARGS(&g_engine.graphics_resources.m_heightmapResources[0]));
+            IID_PPV_ARGS(&errTexture));
 
         if (FAILED(hr))
         {
@@ -1815,7 +2304,7 @@ bool LoadAssets()
         }
 
         ID3D12Resource *errUpload = nullptr;
-        UINT64 uploadSize = GetRequiredIntermediateSize(g_engine.graphics_resources.m_heightmapResources[0], 0, 1);
+        UINT64 uploadSize = GetRequiredIntermediateSize(errTexture, 0, 1);
         HRAssert(g_engine.pipeline_dx12.m_device->CreateCommittedResource(
             &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
             D3D12_HEAP_FLAG_NONE,
@@ -1830,30 +2319,21 @@ bool LoadAssets()
         subData.SlicePitch = subData.RowPitch * errHeight;
 
         UpdateSubresources(g_engine.pipeline_dx12.m_commandList[0],
-                           g_engine.graphics_resources.m_heightmapResources[0],
+                           errTexture,
                            errUpload,
                            0, 0, 1, &subData);
 
         auto barrier = CD3DX12_RESOURCE_BARRIER::Transition(
-            g_engine.graphics_resources.m_heightmapResources[0],
+            errTexture,
             D3D12_RESOURCE_STATE_COPY_DEST,
             D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
         g_engine.pipeline_dx12.m_commandList[0]->ResourceBarrier(1, &barrier);
 
-        // After resource creation, create SRV at HEIGHTMAP_SRV + 0
-        UINT errorIndex = 0;
-        CD3DX12_CPU_DESCRIPTOR_HANDLE cpuHandle(
-            g_engine.pipeline_dx12.m_mainHeap->GetCPUDescriptorHandleForHeapStart(),
-            (int)(DescriptorIndices::HEIGHTMAP_SRV + errorIndex),
-            cbvSrvDescriptorSize);
-        g_engine.pipeline_dx12.m_device->CreateShaderResourceView(g_engine.graphics_resources.m_heightmapResources[0], nullptr, cpuHandle);
-
-        g_engine.graphics_resources.m_heightmapResources[errorIndex] = g_engine.graphics_resources.m_heightmapResources[0];
-        g_engine.graphics_resources.m_nextSceneObject = 1; // next free index is 1
-        g_errorHeightmapIndex = errorIndex;
+        // first slot of the bindless table
+        g_errorHeightmapIndex = CreateBindlessTexture(errTexture, nullptr);
     }
 
-    // Create fallback model albedo texture at index 0
+    // Create fallback model albedo texture, second slot of the bindless table
     {
         const UINT fallbackWidth = 4, fallbackHeight = 4;
         std::vector<uint32_t> fallbackData(fallbackWidth * fallbackHeight);
@@ -1896,14 +2376,7 @@ bool LoadAssets()
                                                             D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
         g_engine.pipeline_dx12.m_commandList[0]->ResourceBarrier(1, &barrier);
 
-        // Create SRV at index 0 in model albedo range
-        CD3DX12_CPU_DESCRIPTOR_HANDLE cpuHandle(
-            g_engine.pipeline_dx12.m_mainHeap->GetCPUDescriptorHandleForHeapStart(),
-            DescriptorIndices::MODEL_ALBEDO_SRV,
-            g_cbvSrvDescriptorSize);
-        g_engine.pipeline_dx12.m_device->CreateShaderResourceView(tex, nullptr, cpuHandle);
-
-        g_engine.graphics_resources.m_modelAlbedoTextures[0] = tex;
+        g_fallbackAlbedoIndex = CreateBindlessTexture(tex, nullptr);
         // Keep upload heap alive until after WaitForGpu (add to a list or just release after WaitForGpu)
         // We'll add it to a temporary list and release after the final WaitForGpu at the end of LoadAssets.
         // For simplicity, we can store it in a static variable and release at the end.
@@ -1916,7 +2389,6 @@ bool LoadAssets()
     const UINT heightfieldGridSize = 256; // 256x256 quads -> 257x257 vertices
     if (!CreateHeightfieldMesh(
             g_engine.pipeline_dx12.m_device,
-            g_engine.pipeline_dx12.m_commandList[0],
             heightfieldGridSize,
             g_engine.graphics_resources.m_heightfieldVertexBuffer,
             g_engine.graphics_resources.m_heightfieldVertexView,
@@ -1961,6 +2433,11 @@ bool LoadAssets()
         memcpy(g_engine.graphics_resources.m_pCbvDataBegin[i], &g_engine.graphics_resources.m_PerFrameConstantBufferData, sizeof(g_engine.graphics_resources.m_PerFrameConstantBufferData));
     }
 
+    // the upload ring, one buffer shared by the frames in flight. its suballocations are bound as root SRVs (no
+    // descriptors)
+    if (!CreateUploadRingBuffer(UPLOAD_RING_INITIAL_SIZE))
+        return false;
+
     // create per scene constant buffer that just sits and gets updated rarely
     {
         const UINT PerSceneConstantBufferSize = sizeof(PerSceneConstantBuffer); // CB size is required to be 256-byte aligned.
@@ -2239,18 +2716,14 @@ bool LoadAssets()
             D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
         g_engine.pipeline_dx12.m_commandList[0]->ResourceBarrier(1, &barrier);
 
-        // Create SRV in the main heap at DescriptorIndices::HEIGHTMAP_SRV
-        UINT inc = g_engine.pipeline_dx12.m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-        CD3DX12_CPU_DESCRIPTOR_HANDLE cpuSrv(cpuStart);
-        cpuSrv.Offset(DescriptorIndices::HEIGHTMAP_SRV, inc);
-
+        // shown through the error heightmap's slot, the error texture stays owned by the table
         D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
         srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
         srvDesc.Format = DXGI_FORMAT_R8_UNORM;
         srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Texture2D.MostDetailedMip = 0;
         srvDesc.Texture2D.MipLevels = 1;
-        g_engine.pipeline_dx12.m_device->CreateShaderResourceView(g_engine.graphics_resources.m_heightmapTexture, &srvDesc, cpuSrv);
+        WriteBindlessView(g_errorHeightmapIndex, g_engine.graphics_resources.m_heightmapTexture, &srvDesc);
 
         // Store CPU data for later editing
         g_engine.graphics_resources.m_heightmapData = (UINT8 *)malloc(hmWidth * hmHeight);
@@ -2292,11 +2765,6 @@ bool LoadAssets()
         // complete before continuing.
         WaitForGpu();
     }
-    for (int i = 0; i < PrimitiveType::PRIMITIVE_COUNT; ++i)
-    {
-        g_vertexBufferUploadPrimitives[i]->Release();
-        g_indexBufferUploadPrimitives[i]->Release();
-    }
     textureUploadHeap->Release();
     stagingHeap->Release();
 
@@ -2403,6 +2871,7 @@ bool LoadAssets()
 
     vsReticle->Release();
     psReticle->Release();
+    SaveShaderCache();
     return true;
 }
 
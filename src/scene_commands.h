@@ -0,0 +1,234 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#include "indirect_draws.h"
+#include "render_commands.h"
+#include "render_graph.h"
+
+// recording of the frame's scene pass into a command stream (see render_commands.h): the render graph's passes with
+// their barriers, the sorted draw list with redundant binds filtered out, the debug draw. main.cpp records the live
+// draw list with it and plays the stream back on D3D12, tests/test_scene_commands.cpp records a fixed scene with it
+// and checks the stream against a golden dump (the null backend).
+// no D3D in here, the draw list comes in as plain arrays and the meshes as the indirect mesh table
+
+// the passes of a frame, see render_graph.h. SceneRecordCommands records each live one after its barriers
+enum ScenePass : uint32_t
+{
+    SCENE_PASS_DRAWS,   // clear, the draw list and the debug cylinder, into the msaa target or the back buffer
+    SCENE_PASS_RESOLVE, // msaa target into the back buffer
+    SCENE_PASS_OVERLAY, // imgui or the reticle onto the back buffer
+};
+
+// root constants of every draw, PerDrawRootConstants in renderer_dx12.cpp
+struct SceneDrawConstants
+{
+    uint32_t textureArrayIndex;
+    uint32_t instanceBase;
+};
+
+// the draw list as the recording reads it, arrays by draw list slot (g_draw_list in main.cpp). pipeline ids are
+// pipeline * blendCount + blend mode, the pair RCMD_SET_PIPELINE carries
+struct SceneDrawList
+{
+    const uint32_t *submitSlots;
+    int submitCount;
+    const uint32_t *pipelineIds;
+    const uint32_t *meshIds;
+    const uint32_t *textureArrayIndices;
+    const uint32_t *instanceCount; // 0: a plain draw using world, otherwise instanceFirst is into the frame's matrices
+    const uint32_t *instanceFirst;
+    const DirectX::XMFLOAT4X4 *world; // transposed, of the plain draws
+    const uint8_t *objectTypes;       // ObjectType, only for the naive call count (models set their constants twice)
+    uint8_t loadedModelType;
+    uint32_t blendCount;
+
+    // index counts and buffers by draw mesh id. meshLodStride apart are the levels of a mesh, id % meshLodStride is its
+    // full detail one
+    const IndirectMeshViews *meshes;
+    uint32_t meshCount;
+    uint32_t meshLodStride;
+
+    // drawn last without depth sorting (the player's collision cylinder), when debugWorld isn't null
+    const DirectX::XMFLOAT4X4 *debugWorld; // transposed
+    uint32_t debugPipelineId;
+    uint32_t debugMesh;
+};
+
+// what recording the draws produced besides the commands
+struct SceneDrawFrame
+{
+    // every draw reads its matrices from here: the instanced ones come first (worldCount of them, filled by the
+    // caller), each plain draw appends its own. grown as needed
+    std::vector<DirectX::XMFLOAT4X4> *worlds;
+    int worldCount;
+    std::vector<IndirectDrawInput> *indirectInputs; // scratch for the indirect path
+
+    // last recording
+    int draws;
+    int apiCalls; // D3D12 calls the playback makes for the draws
+    int naiveCalls;
+    int pipelineBinds;
+    int meshBinds;
+    uint64_t triangles;
+    uint64_t fullTriangles; // had every draw used its full detail mesh
+};
+
+// the back buffer arrives in PRESENT and leaves in it, the msaa target stays a render target between frames
+void SceneBuildGraph(RenderGraph &graph, bool msaa)
+{
+    RenderGraphReset(graph);
+    RenderGraphImport(graph, RENDER_TARGET_BACK_BUFFER, RENDER_STATE_PRESENT, RENDER_STATE_PRESENT, true);
+    if (msaa)
+        RenderGraphImport(graph, RENDER_TARGET_MSAA, RENDER_STATE_RENDER_TARGET, RENDER_STATE_RENDER_TARGET, false);
+
+    int draws = RenderGraphAddPass(graph, SCENE_PASS_DRAWS);
+    RenderGraphUse(graph, draws, msaa ? RENDER_TARGET_MSAA : RENDER_TARGET_BACK_BUFFER, RENDER_STATE_RENDER_TARGET,
+                   RENDER_ACCESS_WRITE | RENDER_ACCESS_DISCARD);
+    if (msaa)
+    {
+        int resolve = RenderGraphAddPass(graph, SCENE_PASS_RESOLVE);
+        RenderGraphUse(graph, resolve, RENDER_TARGET_MSAA, RENDER_STATE_RESOLVE_SOURCE, RENDER_ACCESS_READ);
+        RenderGraphUse(graph, resolve, RENDER_TARGET_BACK_BUFFER, RENDER_STATE_RESOLVE_DEST, RENDER_ACCESS_WRITE | RENDER_ACCESS_DISCARD);
+    }
+    int overlay = RenderGraphAddPass(graph, SCENE_PASS_OVERLAY);
+    RenderGraphUse(graph, overlay, RENDER_TARGET_BACK_BUFFER, RENDER_STATE_RENDER_TARGET, RENDER_ACCESS_WRITE);
+}
+
+inline uint32_t SceneMeshIndexCount(const SceneDrawList &list, uint32_t mesh)
+{
+    return mesh < list.meshCount ? list.meshes[mesh].indexCount : 0;
+}
+
+// the draws of the scene pass: the sorted draw list with redundant state filtered out, then the debug draw. with
+// indirect the draws become ExecuteIndirect records instead, one RCMD_EXECUTE_INDIRECT per run of draws sharing a
+// pipeline (see indirect_draws.h)
+void SceneRecordDraws(RenderCommandStream &stream, const SceneDrawList &list, bool indirect, SceneDrawFrame &frame)
+{
+    // replayed in sort order, a pipeline or mesh is only bound when it differs from the previous draw's
+    uint32_t boundPipeline = UINT32_MAX;
+    uint32_t boundMesh = UINT32_MAX;
+    frame.naiveCalls = 0;
+    frame.pipelineBinds = 0;
+    frame.meshBinds = 0;
+    frame.triangles = 0;
+    frame.fullTriangles = 0;
+
+    // plain draws get their matrix appended after the instanced ones, so every draw reads the same buffer
+    size_t worldsNeeded = (size_t)frame.worldCount + list.submitCount + 1;
+    if (frame.worlds->size() < worldsNeeded)
+        frame.worlds->resize(worldsNeeded);
+    SceneDrawConstants constants = {};
+    frame.indirectInputs->clear();
+    stream.drawsBegin = (uint32_t)stream.commands.size();
+    for (int s = 0; s < list.submitCount; ++s)
+    {
+        uint32_t i = list.submitSlots[s];
+        uint32_t instanceCount = list.instanceCount[i];
+        uint32_t instances = instanceCount > 0 ? instanceCount : 1;
+        uint32_t pipeline = list.pipelineIds[i];
+        uint32_t mesh = list.meshIds[i];
+        if (!indirect && pipeline != boundPipeline)
+        {
+            RenderCommandPush(stream, RCMD_SET_PIPELINE, pipeline / list.blendCount, pipeline % list.blendCount);
+            boundPipeline = pipeline;
+            frame.pipelineBinds++;
+        }
+        if (!indirect && mesh != boundMesh)
+        {
+            RenderCommandPush(stream, RCMD_SET_MESH, mesh);
+            boundMesh = mesh;
+            frame.meshBinds++;
+        }
+
+        constants.textureArrayIndex = list.textureArrayIndices[i];
+        if (instanceCount > 0)
+        {
+            constants.instanceBase = list.instanceFirst[i];
+        }
+        else
+        {
+            // SCALE * ROTATION * TRANSLATION, built (and transposed) when the entry was written, see transform_cache.h
+            (*frame.worlds)[frame.worldCount] = list.world[i];
+            constants.instanceBase = (uint32_t)frame.worldCount++;
+        }
+        uint32_t indexCount = SceneMeshIndexCount(list, mesh);
+        if (indirect)
+        {
+            IndirectDrawInput input = {pipeline, mesh, {}, instances};
+            memcpy(input.constants, &constants, sizeof(input.constants));
+            frame.indirectInputs->push_back(input);
+        }
+        else
+        {
+            CmdSetConstants(stream, &constants, sizeof(constants));
+            RenderCommandPush(stream, RCMD_DRAW_INDEXED, indexCount, instances);
+        }
+        frame.triangles += (uint64_t)(indexCount / 3) * instances;
+        frame.fullTriangles += (uint64_t)(SceneMeshIndexCount(list, mesh % list.meshLodStride) / 3) * instances;
+        frame.naiveCalls += (list.objectTypes[i] == list.loadedModelType ? 6 : 5) * instances;
+    }
+    if (indirect)
+    {
+        IndirectDrawsBuild(frame.indirectInputs->data(), (int)frame.indirectInputs->size(), nullptr, list.meshes, list.meshCount,
+                           stream.indirect);
+        for (const IndirectBucket &bucket : stream.indirect.buckets)
+        {
+            RenderCommandPush(stream, RCMD_SET_PIPELINE, bucket.pipeline / list.blendCount, bucket.pipeline % list.blendCount);
+            RenderCommandPush(stream, RCMD_EXECUTE_INDIRECT, bucket.first, bucket.count);
+            frame.pipelineBinds++;
+        }
+    }
+    stream.drawsEnd = (uint32_t)stream.commands.size();
+    frame.draws = list.submitCount;
+    if (indirect)
+        frame.apiCalls = frame.pipelineBinds * 2; // + the ExecuteIndirect
+    else
+        frame.apiCalls = frame.pipelineBinds + frame.meshBinds * 2 + frame.draws * 2; // + constants and the draw itself
+
+    if (list.debugWorld)
+    {
+        constants.textureArrayIndex = 0; // unused
+        (*frame.worlds)[frame.worldCount] = *list.debugWorld;
+        constants.instanceBase = (uint32_t)frame.worldCount++;
+        RenderCommandPush(stream, RCMD_SET_PIPELINE, list.debugPipelineId / list.blendCount, list.debugPipelineId % list.blendCount);
+        CmdSetConstants(stream, &constants, sizeof(constants));
+        RenderCommandPush(stream, RCMD_SET_MESH, list.debugMesh);
+        RenderCommandPush(stream, RCMD_DRAW_INDEXED, SceneMeshIndexCount(list, list.debugMesh), 1);
+    }
+}
+
+// records the frame for a compiled scene graph (SceneBuildGraph): its live passes in order, each after its batch of
+// barriers, then the transitions back to the imported states
+void SceneRecordCommands(RenderCommandStream &stream, const RenderGraph &graph, bool msaa, const SceneDrawList &list,
+                         bool indirect, SceneDrawFrame &frame)
+{
+    RenderCommandsReset(stream);
+    uint32_t sceneTarget = msaa ? RENDER_TARGET_MSAA : RENDER_TARGET_BACK_BUFFER;
+    for (int p = 0; p < graph.passCount; ++p)
+    {
+        if (!graph.live[p])
+            continue;
+        RenderGraphPushBarriers(graph, p, stream);
+        switch (graph.passes[p].id)
+        {
+        case SCENE_PASS_DRAWS:
+            RenderCommandPush(stream, RCMD_SET_TARGET, sceneTarget, 1);
+            RenderCommandPush(stream, RCMD_CLEAR, sceneTarget);
+            SceneRecordDraws(stream, list, indirect, frame);
+            break;
+        case SCENE_PASS_RESOLVE:
+            RenderCommandPush(stream, RCMD_RESOLVE, RENDER_TARGET_BACK_BUFFER, RENDER_TARGET_MSAA);
+            break;
+        case SCENE_PASS_OVERLAY:
+            // always to the back buffer (single-sampled)
+            RenderCommandPush(stream, RCMD_SET_TARGET, RENDER_TARGET_BACK_BUFFER, 0);
+            RenderCommandPush(stream, RCMD_OVERLAY);
+            break;
+        }
+    }
+    RenderGraphPushBarriers(graph, graph.passCount, stream);
+}
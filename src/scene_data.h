@@ -1,10 +1,12 @@
 #pragma once
-#include "mesh_data.h" 
+#include <DirectXMath.h>
+#include <stdio.h>
+#include <vector>
+#include "primitive_types.h"
 #include "render_pipeline_data.h"
+#include "string_table.h"
 
-#define MAX_SCENE_OBJECTS 512
-
-enum ObjectType : uint32_t
+enum ObjectType : uint8_t
 {
     OBJECT_PRIMITIVE = 0,
     OBJECT_HEIGHTFIELD,
@@ -29,48 +31,383 @@ enum CollisionShapeBounds {
 };
 
 // maybe rejig this to allow for enemies?
-struct SceneObject {
-    char nametag[128]; // name tag is the name for visuals in the editor only. TODO (optimisation): maybe separate this out to somewhere else so we dont have to pull it into the cache?
+// type specific data. lives in the prefab, so every instance of a prefab shares one copy of its asset ids and collision setup.
+// names and paths are ids into the global string table (string_table.h), StringGet() for the text
+union SceneObjectData {
+    struct {
+        StringId pathToHeightmap;
+        uint32_t width;
+        // todo: index to cpu copy?
+    } heightfield;
+    struct {
+        StringId pathTo;
+        // below API experimenting: not implemented yet
+        struct {
+            bool enabled;
+            CollisionShapeBounds shape;
+            DirectX::XMFLOAT3 offset;
+        } collision;
+    } loaded_model;
+    struct {            
+        StringId pathToTexture; //example only, placeholder             
+    } sky_sphere;
+    struct {
+        float choppiness; //example only, placeholder (todo implement water)
+    } water;
+};
+
+// cold per-instance data: only the editor and the serialiser touch this
+struct SceneObjectInfo {
+    StringId nametag; // name tag is the name for visuals in the editor only
+};
+
+#define SCENE_PREFAB_NONE UINT32_MAX
+
+// shared definition of an object: what it is and how it is drawn. instances only keep a transform and a prefab id,
+// so editing a prefab changes every instance of it at once and the prefab id is the instancing key for the renderer.
+// an instance with overrides points at a variant: a resolved copy of its base prefab with the overridden fields
+// (overrideMask, one bit per SceneField) replaced. variants are deduplicated, never saved as prefabs of their own and
+// are re-derived from the base when it is edited (ScenePrefabChanged in scene_prefab.h)
+struct ScenePrefab {
+    StringId name;
+    ObjectType objectType;
+    RenderPipeline pipeline;
+    PrimitiveType primitiveType; // only valid for OBJECT_PRIMITIVE
+    SceneObjectData data;
+    uint32_t base;         // SCENE_PREFAB_NONE for an authored prefab, else the prefab this variant overrides
+    uint32_t overrideMask; // 0 for authored prefabs
+
+    // runtime only, resolved from the asset ids on load
+    uint32_t modelIndex;   // OBJECT_LOADED_MODEL
+    uint32_t textureIndex; // OBJECT_HEIGHTFIELD / OBJECT_SKY_SPHERE, index into the texture table
+};
+
+// what SceneAddObject gives you: a unit cube with the default pipeline
+inline ScenePrefab ScenePrefabDefault()
+{
+    ScenePrefab p;
+    memset(&p, 0, sizeof(p)); // zeroed padding, prefabs are compared with memcmp
+    p.objectType = OBJECT_PRIMITIVE;
+    p.pipeline = RENDER_DEFAULT;
+    p.primitiveType = PRIMITIVE_CUBE;
+    p.base = SCENE_PREFAB_NONE;
+    return p;
+}
+
+// name for prefabs made from old scene files where every object carried its own data, e.g. "Cube (Triplanar)"
+inline StringId ScenePrefabDefaultName(const ScenePrefab &p)
+{
+    const char *what = "?";
+    if (p.objectType == OBJECT_PRIMITIVE && p.primitiveType < PRIMITIVE_COUNT)
+        what = g_primitiveNames[p.primitiveType];
+    else if (p.objectType != OBJECT_PRIMITIVE && p.objectType < OBJECT_COUNT)
+        what = g_objectTypeNames[p.objectType];
+    char name[128];
+    snprintf(name, sizeof(name), "%s (%s)", what, p.pipeline < RENDER_COUNT ? g_renderPipelineNames[p.pipeline] : "?");
+    return StringIntern(name);
+}
+
+// transform of a single object gathered from the SoA streams, for the collision and ray helpers
+struct ObjectTransform {
     DirectX::XMFLOAT3 pos;
     DirectX::XMFLOAT4 rot;
     DirectX::XMFLOAT3 scale;
-    ObjectType objectType;
-    RenderPipeline pipeline;    
-    union {
-        struct {
-            PrimitiveType primitiveType;
-        } primitive;
-        struct {
-            char pathToHeightmap[256];
-            uint32_t width;
-            // todo: index to cpu copy?
-        } heightfield;
-        struct {
-            char pathTo[256];
-            // below API experimenting: not implemented yet
-            uint32_t model_index;
-            struct {
-                bool enabled;
-                CollisionShapeBounds shape;
-                DirectX::XMFLOAT3 offset;
-            } collision;
-        } loaded_model;
-        struct {            
-            char pathToTexture[256]; //example only, placeholder             
-        } sky_sphere;
-        struct {
-            float choppiness; //example only, placeholder (todo implement water)
-        } water;
-    } data;
 };
 
+// stable reference to a scene object, survives other objects being added and removed (dense indices do not).
+// the generation is bumped every time a slot is freed so handles to deleted objects stop resolving
+struct SceneHandle {
+    uint32_t slot;
+    uint32_t generation;
+};
+static const SceneHandle SCENE_HANDLE_NULL = {UINT32_MAX, 0};
+
+inline bool operator==(SceneHandle a, SceneHandle b) { return a.slot == b.slot && a.generation == b.generation; }
+inline bool operator!=(SceneHandle a, SceneHandle b) { return !(a == b); }
+
 struct Scene {
     //TODO: maybe put heightfields here example:
     // SceneObject heightfields[N * N];
     // or maybe in a spatial partition?
     // also maybe a special type of object that work together to build a larger set of fields (instead of SceneObject)
 
-    SceneObject objects[MAX_SCENE_OBJECTS]; //static environment objects
-    int objectCount;
+    // static environment objects, hot data first. FillDrawList, the collision loop and the ground probe only read these streams.
+    // all streams are dense ([0, objectCount), no holes) and grow as needed, removing an object moves the last one into its place
+    std::vector<DirectX::XMFLOAT3> pos;
+    std::vector<DirectX::XMFLOAT4> rot;
+    std::vector<DirectX::XMFLOAT3> scale;
+    std::vector<uint32_t> prefab; // index into prefabs, type/pipeline/mesh/assets come from there (SceneObjectPrefab)
+    int objectCount = 0;
+
+    // cold data, indexed the same as the hot streams
+    std::vector<SceneObjectInfo> info;
     // todo add more fields here later (ambient colour, lights etc.)
-};
\ No newline at end of file
+
+    // shared object definitions, authored prefabs and their variants. authored prefabs are never removed while the
+    // scene is loaded, variants nothing uses anymore are (ScenePrefabReclaimVariants), which renumbers the ids after them
+    std::vector<ScenePrefab> prefabs;
+    std::vector<uint32_t> prefabSlots; // open addressing index over prefab contents, prefab id + 1 (0 = empty)
+
+    // handle slots
+    std::vector<uint32_t> denseSlot;      // dense index -> handle slot
+    std::vector<uint32_t> slotDense;      // handle slot -> dense index, or the next free slot while the slot is unused
+    std::vector<uint32_t> slotGeneration;
+    uint32_t freeSlotHead = UINT32_MAX;
+};
+
+inline void SceneClear(Scene &scene)
+{
+    scene.pos.clear();
+    scene.rot.clear();
+    scene.scale.clear();
+    scene.prefab.clear();
+    scene.info.clear();
+    scene.denseSlot.clear();
+    scene.objectCount = 0;
+    scene.prefabs.clear();
+    scene.prefabSlots.clear();
+
+    // slots are kept (and their generations bumped) so handles from before the clear stay dead
+    scene.freeSlotHead = UINT32_MAX;
+    for (uint32_t slot = (uint32_t)scene.slotDense.size(); slot-- > 0;)
+    {
+        scene.slotGeneration[slot]++;
+        scene.slotDense[slot] = scene.freeSlotHead;
+        scene.freeSlotHead = slot;
+    }
+}
+
+inline void SceneReserve(Scene &scene, int capacity)
+{
+    scene.pos.reserve(capacity);
+    scene.rot.reserve(capacity);
+    scene.scale.reserve(capacity);
+    scene.prefab.reserve(capacity);
+    scene.info.reserve(capacity);
+    scene.denseSlot.reserve(capacity);
+}
+
+// dense index of the object, -1 if the handle is stale or null
+inline int SceneResolve(const Scene &scene, SceneHandle h)
+{
+    if (h.slot >= scene.slotGeneration.size() || scene.slotGeneration[h.slot] != h.generation)
+        return -1;
+    uint32_t dense = scene.slotDense[h.slot];
+    if (dense >= (uint32_t)scene.objectCount || scene.denseSlot[dense] != h.slot)
+        return -1;
+    return (int)dense;
+}
+
+inline SceneHandle SceneHandleAt(const Scene &scene, int i)
+{
+    if (i < 0 || i >= scene.objectCount)
+        return SCENE_HANDLE_NULL;
+    uint32_t slot = scene.denseSlot[i];
+    return {slot, scene.slotGeneration[slot]};
+}
+
+// content hash of a prefab, the name and the runtime asset indices are not part of what makes two prefabs the same
+inline uint32_t ScenePrefabHash(const ScenePrefab &p)
+{
+    const uint8_t *fields[] = {(const uint8_t *)&p.objectType, (const uint8_t *)&p.pipeline, (const uint8_t *)&p.primitiveType,
+                               (const uint8_t *)&p.data, (const uint8_t *)&p.base, (const uint8_t *)&p.overrideMask};
+    const size_t sizes[] = {sizeof(p.objectType), sizeof(p.pipeline), sizeof(p.primitiveType), sizeof(p.data), sizeof(p.base), sizeof(p.overrideMask)};
+    uint32_t h = 2166136261u;
+    for (int f = 0; f < 6; ++f)
+    {
+        for (size_t k = 0; k < sizes[f]; ++k)
+        {
+            h ^= fields[f][k];
+            h *= 16777619u;
+        }
+    }
+    return h;
+}
+
+inline bool ScenePrefabSame(const ScenePrefab &a, const ScenePrefab &b)
+{
+    return a.objectType == b.objectType && a.pipeline == b.pipeline && a.primitiveType == b.primitiveType &&
+           a.base == b.base && a.overrideMask == b.overrideMask && memcmp(&a.data, &b.data, sizeof(a.data)) == 0;
+}
+
+static void ScenePrefabIndexInsert(Scene &scene, uint32_t id)
+{
+    size_t mask = scene.prefabSlots.size() - 1;
+    size_t slot = ScenePrefabHash(scene.prefabs[id]) & mask;
+    while (scene.prefabSlots[slot] != 0)
+        slot = (slot + 1) & mask;
+    scene.prefabSlots[slot] = id + 1;
+}
+
+// rebuilt after a prefab is edited in place, its hash moved. ids go in in order so the oldest of equal prefabs is found first
+inline void ScenePrefabRebuildIndex(Scene &scene)
+{
+    size_t size = 64;
+    while (size < scene.prefabs.size() * 2)
+        size *= 2;
+    scene.prefabSlots.assign(size, 0);
+    for (uint32_t id = 0; id < (uint32_t)scene.prefabs.size(); ++id)
+        ScenePrefabIndexInsert(scene, id);
+}
+
+// id of a prefab with the same content, SCENE_PREFAB_NONE if there is none
+inline uint32_t ScenePrefabFind(const Scene &scene, const ScenePrefab &p)
+{
+    if (scene.prefabSlots.empty())
+        return SCENE_PREFAB_NONE;
+    size_t mask = scene.prefabSlots.size() - 1;
+    for (size_t slot = ScenePrefabHash(p) & mask; scene.prefabSlots[slot] != 0; slot = (slot + 1) & mask)
+    {
+        uint32_t id = scene.prefabSlots[slot] - 1;
+        if (ScenePrefabSame(scene.prefabs[id], p))
+            return id;
+    }
+    return SCENE_PREFAB_NONE;
+}
+
+// always appends, two authored prefabs may hold the same data under different names
+inline uint32_t ScenePrefabAdd(Scene &scene, const ScenePrefab &p)
+{
+    uint32_t id = (uint32_t)scene.prefabs.size();
+    scene.prefabs.push_back(p);
+    if (scene.prefabs.size() * 2 > scene.prefabSlots.size()) // keep the index at most half full
+        ScenePrefabRebuildIndex(scene);
+    else
+        ScenePrefabIndexInsert(scene, id);
+    return id;
+}
+
+// shared prefab for this content, made (and named after its content if it has no name) the first time it is asked for
+inline uint32_t SceneFindOrAddPrefab(Scene &scene, const ScenePrefab &p)
+{
+    uint32_t id = ScenePrefabFind(scene, p);
+    if (id != SCENE_PREFAB_NONE)
+        return id;
+    id = ScenePrefabAdd(scene, p);
+    if (scene.prefabs[id].name == STRING_ID_EMPTY)
+        scene.prefabs[id].name = ScenePrefabDefaultName(p);
+    return id;
+}
+
+inline uint32_t SceneDefaultPrefab(Scene &scene)
+{
+    return SceneFindOrAddPrefab(scene, ScenePrefabDefault());
+}
+
+inline const ScenePrefab &SceneObjectPrefab(const Scene &scene, int i)
+{
+    return scene.prefabs[scene.prefab[i]];
+}
+
+// authored prefab an instance belongs to, editing that one is what the editor means by "edit prefab"
+inline uint32_t ScenePrefabRoot(const Scene &scene, uint32_t id)
+{
+    return scene.prefabs[id].base != SCENE_PREFAB_NONE ? scene.prefabs[id].base : id;
+}
+
+// appends an instance of prefab at the origin and returns its handle, its dense index is objectCount - 1
+inline SceneHandle SceneAddObject(Scene &scene, uint32_t prefab)
+{
+    uint32_t slot;
+    if (scene.freeSlotHead != UINT32_MAX)
+    {
+        slot = scene.freeSlotHead;
+        scene.freeSlotHead = scene.slotDense[slot];
+    }
+    else
+    {
+        slot = (uint32_t)scene.slotDense.size();
+        scene.slotDense.push_back(0);
+        scene.slotGeneration.push_back(1); // generation 0 is never valid, keeps zeroed handles from resolving
+    }
+
+    uint32_t dense = (uint32_t)scene.objectCount;
+    scene.slotDense[slot] = dense;
+    scene.denseSlot.push_back(slot);
+
+    SceneObjectInfo info;
+    memset(&info, 0, sizeof(info));
+    scene.pos.push_back({0.0f, 0.0f, 0.0f});
+    scene.rot.push_back({0.0f, 0.0f, 0.0f, 1.0f});
+    scene.scale.push_back({1.0f, 1.0f, 1.0f});
+    scene.prefab.push_back(prefab);
+    scene.info.push_back(info);
+    scene.objectCount++;
+
+    return {slot, scene.slotGeneration[slot]};
+}
+
+inline ObjectTransform SceneGetTransform(const Scene &scene, int i)
+{
+    ObjectTransform t;
+    t.pos = scene.pos[i];
+    t.rot = scene.rot[i];
+    t.scale = scene.scale[i];
+    return t;
+}
+
+// copies every stream of object src into slot dst (used by the editor duplicate button)
+inline void SceneCopyObject(Scene &scene, int dst, int src)
+{
+    scene.pos[dst] = scene.pos[src];
+    scene.rot[dst] = scene.rot[src];
+    scene.scale[dst] = scene.scale[src];
+    scene.prefab[dst] = scene.prefab[src];
+    scene.info[dst] = scene.info[src];
+}
+
+// O(1): the last object is moved into the hole, so dense indices (not handles) of that one object change
+inline bool SceneRemoveObject(Scene &scene, SceneHandle h)
+{
+    int i = SceneResolve(scene, h);
+    if (i < 0)
+        return false;
+
+    int last = scene.objectCount - 1;
+    if (i != last)
+    {
+        SceneCopyObject(scene, i, last);
+        uint32_t movedSlot = scene.denseSlot[last];
+        scene.denseSlot[i] = movedSlot;
+        scene.slotDense[movedSlot] = (uint32_t)i;
+    }
+    scene.pos.pop_back();
+    scene.rot.pop_back();
+    scene.scale.pop_back();
+    scene.prefab.pop_back();
+    scene.info.pop_back();
+    scene.denseSlot.pop_back();
+    scene.objectCount--;
+
+    scene.slotGeneration[h.slot]++;
+    scene.slotDense[h.slot] = scene.freeSlotHead;
+    scene.freeSlotHead = h.slot;
+    return true;
+}
+
+// brings a removed object back under the handle it had (undo of a delete, redo of an add), appended like
+// SceneAddObject. the slot has to be free, -1 if something else took it since. walks the free list, editor use only
+inline int SceneRestoreObject(Scene &scene, SceneHandle h, uint32_t prefab)
+{
+    if (h.slot >= scene.slotDense.size() || h.generation == 0)
+        return -1;
+    uint32_t *link = &scene.freeSlotHead;
+    while (*link != UINT32_MAX && *link != h.slot)
+        link = &scene.slotDense[*link];
+    if (*link == UINT32_MAX)
+        return -1;
+    *link = scene.slotDense[h.slot]; // unlinked from the free list
+
+    scene.slotGeneration[h.slot] = h.generation;
+    scene.slotDense[h.slot] = (uint32_t)scene.objectCount;
+    scene.denseSlot.push_back(h.slot);
+
+    SceneObjectInfo info;
+    memset(&info, 0, sizeof(info));
+    scene.pos.push_back({0.0f, 0.0f, 0.0f});
+    scene.rot.push_back({0.0f, 0.0f, 0.0f, 1.0f});
+    scene.scale.push_back({1.0f, 1.0f, 1.0f});
+    scene.prefab.push_back(prefab);
+    scene.info.push_back(info);
+    return scene.objectCount++;
+}
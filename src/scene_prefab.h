@@ -0,0 +1,119 @@
+#pragma once
+#include "scene_data.h"
+#include "scene_fields.h"
+#include <string.h>
+
+// per-instance overrides on top of the shared prefabs (see ScenePrefab in scene_data.h). an instance never stores its
+// overrides itself, it points at a variant prefab that already has them applied, so FillDrawList and the collision
+// loops read one prefab per object whatever was overridden. instances with the same overrides share a variant.
+
+// variant of base with the fields in mask taken from values. overrides that match the base (or that the base's type
+// can't have) are dropped, no overrides left gives back the base itself
+uint32_t ScenePrefabVariant(Scene &scene, uint32_t base, uint32_t mask, const ScenePrefab &values)
+{
+    base = ScenePrefabRoot(scene, base);
+    ScenePrefab variant = scene.prefabs[base];
+    mask &= SceneOverridableFields(variant.objectType);
+    for (int f = SCENE_FIELD_FIRST_PREFAB; f < SCENE_FIELD_COUNT; ++f)
+    {
+        if (!(mask & SceneFieldBit((SceneField)f)))
+            continue;
+        void *dst = ScenePrefabFieldPtr(variant, (SceneField)f);
+        const void *src = ScenePrefabFieldPtr(const_cast<ScenePrefab &>(values), (SceneField)f);
+        if (memcmp(dst, src, g_sceneFields[f].size) == 0)
+            mask &= ~SceneFieldBit((SceneField)f);
+        else
+            memcpy(dst, src, g_sceneFields[f].size);
+    }
+    if (mask == 0)
+        return base;
+
+    variant.base = base;
+    variant.overrideMask = mask;
+    uint32_t id = ScenePrefabFind(scene, variant);
+    return id != SCENE_PREFAB_NONE ? id : ScenePrefabAdd(scene, variant);
+}
+
+// overrides one field of the object at dense index i (moves it to another variant)
+void SceneSetOverride(Scene &scene, int i, SceneField field, const void *value)
+{
+    ScenePrefab values = scene.prefabs[scene.prefab[i]];
+    memcpy(ScenePrefabFieldPtr(values, field), value, g_sceneFields[field].size);
+    scene.prefab[i] = ScenePrefabVariant(scene, scene.prefab[i], values.overrideMask | SceneFieldBit(field), values);
+}
+
+// back to what the prefab says for that field
+void SceneClearOverride(Scene &scene, int i, SceneField field)
+{
+    const ScenePrefab &current = scene.prefabs[scene.prefab[i]];
+    scene.prefab[i] = ScenePrefabVariant(scene, scene.prefab[i], current.overrideMask & ~SceneFieldBit(field), current);
+}
+
+// call after editing prefab id in place. its variants pick the change up (keeping their own overrides), the instances
+// are left alone, they already point at the prefab. O(prefabs), not O(objects)
+void ScenePrefabChanged(Scene &scene, uint32_t id)
+{
+    const ScenePrefab &base = scene.prefabs[id];
+    for (ScenePrefab &variant : scene.prefabs)
+    {
+        if (variant.base != id)
+            continue;
+        ScenePrefab resolved = base;
+        resolved.base = id;
+        resolved.overrideMask = variant.overrideMask & SceneOverridableFields(base.objectType); // a type change drops the other type's overrides
+        for (int f = SCENE_FIELD_FIRST_PREFAB; f < SCENE_FIELD_COUNT; ++f)
+        {
+            if (resolved.overrideMask & SceneFieldBit((SceneField)f))
+                memcpy(ScenePrefabFieldPtr(resolved, (SceneField)f), ScenePrefabFieldPtr(variant, (SceneField)f), g_sceneFields[f].size);
+        }
+        variant = resolved;
+    }
+    ScenePrefabRebuildIndex(scene); // contents moved under the hash index
+}
+
+// drops the variants nothing points at anymore, left behind when overrides are edited or reverted away. held marks
+// (by prefab id) the ones something besides an instance still refers to, the undo journal (UndoMarkPrefabs), instances
+// are counted here. later ids move down into the gaps, remap gets old id -> new id (SCENE_PREFAB_NONE for a dropped
+// one) so the caller can fix the ids it holds. authored prefabs always stay. returns how many were dropped
+uint32_t ScenePrefabReclaimVariants(Scene &scene, std::vector<uint8_t> &held, std::vector<uint32_t> &remap)
+{
+    uint32_t count = (uint32_t)scene.prefabs.size();
+    held.resize(count, 0);
+    for (int i = 0; i < scene.objectCount; ++i)
+        held[scene.prefab[i]] = 1;
+
+    remap.assign(count, SCENE_PREFAB_NONE);
+    uint32_t kept = 0;
+    for (uint32_t id = 0; id < count; ++id)
+    {
+        if (scene.prefabs[id].base != SCENE_PREFAB_NONE && !held[id])
+            continue;
+        remap[id] = kept;
+        scene.prefabs[kept++] = scene.prefabs[id];
+    }
+    if (kept == count)
+        return 0;
+
+    scene.prefabs.resize(kept);
+    for (ScenePrefab &prefab : scene.prefabs)
+    {
+        if (prefab.base != SCENE_PREFAB_NONE)
+            prefab.base = remap[prefab.base]; // bases are authored, never dropped
+    }
+    for (int i = 0; i < scene.objectCount; ++i)
+        scene.prefab[i] = remap[scene.prefab[i]];
+    ScenePrefabRebuildIndex(scene);
+    return count - kept;
+}
+
+// instances of prefab id and of its variants, for the editor
+int ScenePrefabInstanceCount(const Scene &scene, uint32_t id)
+{
+    int count = 0;
+    for (int i = 0; i < scene.objectCount; ++i)
+    {
+        if (ScenePrefabRoot(scene, scene.prefab[i]) == id)
+            count++;
+    }
+    return count;
+}
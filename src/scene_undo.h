@@ -0,0 +1,383 @@
+#pragma once
+#include "scene_data.h"
+#include "scene_fields.h"
+#include "scene_prefab.h"
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+
+// undo/redo journal for editor edits. a record is one field of one object (handle + SceneField from the generated
+// reflection) with its old and new bytes, records of one user action share an entry id and are undone together.
+// records and their bytes live in two fixed rings, when either fills up the oldest entries are dropped, so memory
+// stays bounded however long the session is. undo/redo only touch the bytes of one entry, never the whole scene.
+// prefab edits are journaled the same way, their records carry a handle with generation 0 (never a live object) and the
+// prefab id in the slot. adding or removing an object is a record of its own (UNDO_FIELD_OBJECT) holding a snapshot
+// of the object's streams, undoing a delete brings the object back under its old handle so the records before it apply
+
+#define UNDO_MAX_RECORDS 16384
+#define UNDO_BYTE_CAPACITY (1u << 20)
+#define UNDO_FIELD_OBJECT SCENE_FIELD_COUNT // record field of an add or remove, an UndoObjectSnapshot on each side
+
+// an object before and after an add or remove, present on the side where it exists
+struct UndoObjectSnapshot
+{
+    uint32_t present;
+    uint32_t prefab;
+    DirectX::XMFLOAT3 pos;
+    DirectX::XMFLOAT4 rot;
+    DirectX::XMFLOAT3 scale;
+    SceneObjectInfo info;
+};
+
+struct UndoRecord
+{
+    SceneHandle handle;
+    uint32_t entry;  // records with the same entry are one undo step
+    uint32_t offset; // old bytes at offset, new bytes right after them
+    uint16_t field;  // SceneField
+    uint16_t size;
+};
+
+struct UndoJournal
+{
+    std::vector<UndoRecord> records; // ring of UNDO_MAX_RECORDS, allocated on first use
+    std::vector<uint8_t> bytes;      // ring of UNDO_BYTE_CAPACITY
+    uint32_t first = 0;              // ring index of the oldest record
+    uint32_t count = 0;              // live records, [0, applied) can be undone, [applied, count) redone
+    uint32_t applied = 0;
+    uint32_t byteHead = 0; // where the next record's bytes go
+    uint32_t nextEntry = 1;
+    uint32_t openKey = 0; // coalescing key of the newest entry, 0 once the interaction ended
+
+    // stats
+    size_t bytesUsed = 0;
+    int droppedEntries = 0;
+    int coalescedEdits = 0;
+};
+
+inline SceneHandle UndoPrefabHandle(uint32_t prefab)
+{
+    return {prefab, 0};
+}
+
+// nonzero key for "this widget on this object", edits with the same key coalesce until UndoEndCoalescing
+inline uint32_t UndoCoalesceKey(const char *what, SceneHandle handle)
+{
+    uint32_t h = 2166136261u;
+    while (*what)
+    {
+        h ^= (uint8_t)*what++;
+        h *= 16777619u;
+    }
+    h ^= handle.slot;
+    h *= 16777619u;
+    return h | 1;
+}
+
+inline UndoRecord &UndoRecordAt(UndoJournal &journal, uint32_t k)
+{
+    return journal.records[(journal.first + k) % UNDO_MAX_RECORDS];
+}
+
+inline bool UndoCanUndo(const UndoJournal &journal) { return journal.applied > 0; }
+inline bool UndoCanRedo(const UndoJournal &journal) { return journal.applied < journal.count; }
+
+inline void UndoEndCoalescing(UndoJournal &journal)
+{
+    journal.openKey = 0;
+}
+
+static void UndoDropOldestEntry(UndoJournal &journal)
+{
+    uint32_t entry = UndoRecordAt(journal, 0).entry;
+    while (journal.count > 0 && UndoRecordAt(journal, 0).entry == entry)
+    {
+        journal.bytesUsed -= 2u * UndoRecordAt(journal, 0).size;
+        journal.first = (journal.first + 1) % UNDO_MAX_RECORDS;
+        journal.count--;
+        if (journal.applied > 0)
+            journal.applied--;
+    }
+    if (journal.count == 0)
+        journal.byteHead = 0;
+    journal.droppedEntries++;
+}
+
+// forget everything that could still be redone, a new edit replaces it
+static void UndoTruncateRedo(UndoJournal &journal)
+{
+    while (journal.count > journal.applied)
+    {
+        journal.count--;
+        journal.bytesUsed -= 2u * UndoRecordAt(journal, journal.count).size;
+    }
+    if (journal.count == 0)
+        journal.byteHead = 0;
+    else
+    {
+        const UndoRecord &last = UndoRecordAt(journal, journal.count - 1);
+        journal.byteHead = last.offset + 2u * last.size;
+    }
+}
+
+// byte ring is fifo like the records: live bytes are [oldest record offset, byteHead), a record never wraps
+static bool UndoFindBytes(UndoJournal &journal, uint32_t size, uint32_t *offset)
+{
+    if (journal.count == 0)
+    {
+        *offset = 0;
+        return size <= UNDO_BYTE_CAPACITY;
+    }
+    uint32_t head = journal.byteHead;
+    uint32_t tail = UndoRecordAt(journal, 0).offset;
+    if (head > tail)
+    {
+        if (head + size <= UNDO_BYTE_CAPACITY)
+            *offset = head;
+        else if (size <= tail)
+            *offset = 0;
+        else
+            return false;
+        return true;
+    }
+    if (head < tail && head + size <= tail)
+    {
+        *offset = head;
+        return true;
+    }
+    return false; // head == tail with live records: full
+}
+
+static void UndoPushRecord(UndoJournal &journal, SceneHandle handle, uint32_t field, const void *oldBytes,
+                           const void *newBytes, uint32_t size, uint32_t entry)
+{
+    if (journal.records.empty())
+    {
+        journal.records.resize(UNDO_MAX_RECORDS);
+        journal.bytes.resize(UNDO_BYTE_CAPACITY);
+    }
+
+    uint32_t offset = 0;
+    while (journal.count == UNDO_MAX_RECORDS || !UndoFindBytes(journal, 2u * size, &offset))
+        UndoDropOldestEntry(journal);
+
+    memcpy(&journal.bytes[offset], oldBytes, size);
+    memcpy(&journal.bytes[offset + size], newBytes, size);
+    journal.byteHead = offset + 2u * size;
+    journal.bytesUsed += 2u * size;
+
+    UndoRecord &record = UndoRecordAt(journal, journal.count);
+    record.handle = handle;
+    record.entry = entry;
+    record.offset = offset;
+    record.field = (uint16_t)field;
+    record.size = (uint16_t)size;
+    journal.count++;
+    journal.applied = journal.count;
+}
+
+static void UndoRecordBytes(UndoJournal &journal, SceneHandle handle, SceneField field, const void *current, const void *oldBytes, uint32_t key)
+{
+    uint32_t size = g_sceneFields[field].size;
+    if (!current || memcmp(current, oldBytes, size) == 0)
+        return;
+
+    UndoTruncateRedo(journal);
+    if (key != 0 && key == journal.openKey && journal.count > 0)
+    {
+        // keep the entry's old bytes, only the new bytes move
+        uint32_t entry = UndoRecordAt(journal, journal.count - 1).entry;
+        for (uint32_t k = journal.count; k > 0 && UndoRecordAt(journal, k - 1).entry == entry; --k)
+        {
+            UndoRecord &record = UndoRecordAt(journal, k - 1);
+            if (record.handle == handle && record.field == field)
+            {
+                memcpy(&journal.bytes[record.offset + size], current, size);
+                journal.coalescedEdits++;
+                return;
+            }
+        }
+        UndoPushRecord(journal, handle, field, oldBytes, current, size, entry);
+        return;
+    }
+
+    journal.openKey = key;
+    UndoPushRecord(journal, handle, field, oldBytes, current, size, journal.nextEntry++);
+}
+
+// call after changing an instance field of the object at dense index i in place, with a copy of what it was before.
+// edits with the same nonzero key as the newest entry are folded into it (the gizmo writes every frame of a drag)
+void UndoRecordEdit(UndoJournal &journal, Scene &scene, int i, SceneField field, const void *oldBytes, uint32_t key = 0)
+{
+    UndoRecordBytes(journal, SceneHandleAt(scene, i), field, SceneFieldPtr(scene, i, field), oldBytes, key);
+}
+
+// same for a field of a prefab (after ScenePrefabChanged)
+void UndoRecordPrefabEdit(UndoJournal &journal, Scene &scene, uint32_t prefab, SceneField field, const void *oldBytes, uint32_t key = 0)
+{
+    UndoRecordBytes(journal, UndoPrefabHandle(prefab), field, ScenePrefabFieldPtr(scene.prefabs[prefab], field), oldBytes, key);
+}
+
+// call after adding an object (and setting it up, e.g. copying the duplicated one), or right before removing one
+static void UndoRecordObject(UndoJournal &journal, Scene &scene, SceneHandle handle, bool added)
+{
+    int i = SceneResolve(scene, handle);
+    if (i < 0)
+        return;
+    UndoObjectSnapshot sides[2];
+    memset(sides, 0, sizeof(sides));
+    UndoObjectSnapshot &object = sides[added ? 1 : 0];
+    object.present = 1;
+    object.prefab = scene.prefab[i];
+    object.pos = scene.pos[i];
+    object.rot = scene.rot[i];
+    object.scale = scene.scale[i];
+    object.info = scene.info[i];
+
+    UndoTruncateRedo(journal);
+    journal.openKey = 0;
+    UndoPushRecord(journal, handle, UNDO_FIELD_OBJECT, &sides[0], &sides[1], sizeof(UndoObjectSnapshot), journal.nextEntry++);
+}
+
+void UndoRecordAdd(UndoJournal &journal, Scene &scene, SceneHandle handle)
+{
+    UndoRecordObject(journal, scene, handle, true);
+}
+
+void UndoRecordRemove(UndoJournal &journal, Scene &scene, SceneHandle handle)
+{
+    UndoRecordObject(journal, scene, handle, false);
+}
+
+// offset of the prefab id in side 0 or 1 of a record that holds one (a prefab switch or an add or remove), else -1
+inline int UndoPrefabIdOffset(const UndoRecord &record, uint32_t side)
+{
+    if (record.handle.generation == 0 || (record.field != SCENE_FIELD_PREFAB && record.field != UNDO_FIELD_OBJECT))
+        return -1;
+    uint32_t inSide = record.field == UNDO_FIELD_OBJECT ? (uint32_t)offsetof(UndoObjectSnapshot, prefab) : 0;
+    return (int)(record.offset + side * record.size + inSide);
+}
+
+// prefab ids the journal holds, so ScenePrefabReclaimVariants keeps them: the prefab of every prefab edit, both
+// sides of every prefab switch of an instance and the prefab of every added or removed object, undoable or
+// redoable. held is by prefab id
+void UndoMarkPrefabs(const UndoJournal &journal, std::vector<uint8_t> &held)
+{
+    for (uint32_t k = 0; k < journal.count; ++k)
+    {
+        const UndoRecord &record = journal.records[(journal.first + k) % UNDO_MAX_RECORDS];
+        if (record.handle.generation == 0)
+        {
+            if (record.handle.slot < held.size())
+                held[record.handle.slot] = 1;
+        }
+        else if (UndoPrefabIdOffset(record, 0) >= 0)
+        {
+            for (uint32_t side = 0; side < 2; ++side)
+            {
+                uint32_t id;
+                memcpy(&id, &journal.bytes[UndoPrefabIdOffset(record, side)], sizeof(id));
+                if (id < held.size())
+                    held[id] = 1;
+            }
+        }
+    }
+}
+
+// the same ids, renumbered after ScenePrefabReclaimVariants
+void UndoRemapPrefabs(UndoJournal &journal, const std::vector<uint32_t> &remap)
+{
+    for (uint32_t k = 0; k < journal.count; ++k)
+    {
+        UndoRecord &record = UndoRecordAt(journal, k);
+        if (record.handle.generation == 0)
+        {
+            if (record.handle.slot < remap.size())
+                record.handle.slot = remap[record.handle.slot];
+        }
+        else if (UndoPrefabIdOffset(record, 0) >= 0)
+        {
+            for (uint32_t side = 0; side < 2; ++side)
+            {
+                uint32_t id;
+                memcpy(&id, &journal.bytes[UndoPrefabIdOffset(record, side)], sizeof(id));
+                if (id < remap.size())
+                    id = remap[id];
+                memcpy(&journal.bytes[UndoPrefabIdOffset(record, side)], &id, sizeof(id));
+            }
+        }
+    }
+}
+
+// undo or redo of an add or remove: the object taken out, or put back under its handle with its streams
+static void UndoApplyObject(Scene &scene, SceneHandle handle, const UndoObjectSnapshot &object)
+{
+    if (!object.present)
+    {
+        SceneRemoveObject(scene, handle);
+        return;
+    }
+    if (object.prefab >= scene.prefabs.size())
+        return;
+    int i = SceneRestoreObject(scene, handle, object.prefab);
+    if (i < 0)
+        return;
+    scene.pos[i] = object.pos;
+    scene.rot[i] = object.rot;
+    scene.scale[i] = object.scale;
+    scene.info[i] = object.info;
+}
+
+// undoes (or redoes) one entry. touched is called for every field written so the caller can mark things dirty,
+// with i = -1 for prefab fields and field UNDO_FIELD_OBJECT for objects added or removed
+bool UndoStep(UndoJournal &journal, Scene &scene, bool redo, void (*touched)(int i, SceneField field))
+{
+    if (redo ? !UndoCanRedo(journal) : !UndoCanUndo(journal))
+        return false;
+
+    journal.openKey = 0;
+    uint32_t entry = UndoRecordAt(journal, redo ? journal.applied : journal.applied - 1).entry;
+    for (;;)
+    {
+        if (redo ? journal.applied == journal.count : journal.applied == 0)
+            break;
+        const UndoRecord &record = UndoRecordAt(journal, redo ? journal.applied : journal.applied - 1);
+        if (record.entry != entry)
+            break;
+
+        const uint8_t *bytes = &journal.bytes[record.offset + (redo ? record.size : 0)];
+        if (record.field == UNDO_FIELD_OBJECT)
+        {
+            UndoObjectSnapshot object;
+            memcpy(&object, bytes, sizeof(object));
+            UndoApplyObject(scene, record.handle, object);
+            if (touched)
+                touched(-1, (SceneField)record.field);
+        }
+        else if (record.handle.generation == 0)
+        {
+            if (record.handle.slot < scene.prefabs.size())
+            {
+                memcpy(ScenePrefabFieldPtr(scene.prefabs[record.handle.slot], (SceneField)record.field), bytes, record.size);
+                ScenePrefabChanged(scene, record.handle.slot);
+                if (touched)
+                    touched(-1, (SceneField)record.field);
+            }
+        }
+        else
+        {
+            int i = SceneResolve(scene, record.handle);
+            if (i >= 0)
+            {
+                memcpy(SceneFieldPtr(scene, i, (SceneField)record.field), bytes, record.size);
+                if (touched)
+                    touched(i, (SceneField)record.field);
+            }
+        }
+        if (redo)
+            journal.applied++;
+        else
+            journal.applied--;
+    }
+    return true;
+}
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+// compiled shader bytecode kept on disk between runs. an entry is keyed by a hash of everything the compiler sees:
+// the preprocessed source (so edits to an included file count too), the defines, the entry point, the target, the
+// compile flags and the compiler version. the variant (all of that but the source) says which permutation an entry
+// is, so recompiling a permutation after a source edit drops its old entry and the file doesn't grow with every edit;
+// permutations not asked for at all are pruned before saving.
+// a file from another format or compiler version is ignored as a whole, an entry whose bytes don't match its checksum
+// on its own. the file is header, entry table, then the blobs back to back, read in one go and parsed from memory.
+// no D3D in here, the caller preprocesses, compiles and does the file IO
+
+#define SHADER_CACHE_MAGIC 0x48435350u // "PSCH"
+#define SHADER_CACHE_FORMAT 1
+#define SHADER_CACHE_HASH_SEED 0xcbf29ce484222325ull // FNV-1a 64
+
+// layout of D3D_SHADER_MACRO (checked by a static_assert in renderer_dx12.cpp), a null name ends the list
+struct ShaderCacheDefine
+{
+    const char *name;
+    const char *value;
+};
+
+struct ShaderCacheKey
+{
+    uint64_t key;     // the whole input
+    uint64_t variant; // the input without the source
+};
+
+struct ShaderCacheEntry
+{
+    uint64_t key;
+    uint64_t variant;
+    uint64_t checksum; // of the blob's bytes
+    uint32_t offset;   // into data
+    uint32_t size;
+    bool used; // looked up or inserted this run
+};
+
+struct ShaderCacheFileHeader
+{
+    uint32_t magic;
+    uint32_t format;
+    uint64_t compilerVersion;
+    uint32_t entryCount;
+    uint32_t dataSize;
+};
+
+struct ShaderCacheFileEntry
+{
+    uint64_t key;
+    uint64_t variant;
+    uint64_t checksum;
+    uint32_t offset; // into the blob section
+    uint32_t size;
+};
+
+struct ShaderCache
+{
+    uint64_t compilerVersion = 0;
+    std::vector<ShaderCacheEntry> entries;
+    std::vector<uint8_t> data; // the blobs, including the ones of dropped entries until the next save
+    bool dirty = false;        // differs from the file
+
+    // stats (shown in Debug Controls)
+    int hits = 0;
+    int misses = 0;
+    int stale = 0;    // entries dropped because their permutation was recompiled
+    int rejected = 0; // entries (or whole files) thrown away on load
+    size_t fileBytes = 0;
+};
+
+inline uint64_t ShaderCacheHashBytes(const void *bytes, size_t size, uint64_t hash = SHADER_CACHE_HASH_SEED)
+{
+    const uint8_t *p = (const uint8_t *)bytes;
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ p[i]) * 0x100000001b3ull;
+    return hash;
+}
+
+// with the terminator, so "ab" then "c" hashes differently from "a" then "bc"
+inline uint64_t ShaderCacheHashString(const char *s, uint64_t hash)
+{
+    return ShaderCacheHashBytes(s ? s : "", (s ? strlen(s) : 0) + 1, hash);
+}
+
+ShaderCacheKey ShaderCacheMakeKey(const void *preprocessed, size_t size, const ShaderCacheDefine *defines, const char *entryPoint,
+                                  const char *target, uint32_t flags, uint64_t compilerVersion)
+{
+    uint64_t variant = ShaderCacheHashString(entryPoint, SHADER_CACHE_HASH_SEED);
+    variant = ShaderCacheHashString(target, variant);
+    variant = ShaderCacheHashBytes(&flags, sizeof(flags), variant);
+    variant = ShaderCacheHashBytes(&compilerVersion, sizeof(compilerVersion), variant);
+    for (const ShaderCacheDefine *define = defines; define && define->name; ++define)
+    {
+        variant = ShaderCacheHashString(define->name, variant);
+        variant = ShaderCacheHashString(define->value, variant);
+    }
+    ShaderCacheKey key;
+    key.variant = variant;
+    key.key = ShaderCacheHashBytes(preprocessed, size, ShaderCacheHashBytes(&variant, sizeof(variant)));
+    return key;
+}
+
+inline void ShaderCacheInit(ShaderCache &cache, uint64_t compilerVersion)
+{
+    cache = ShaderCache();
+    cache.compilerVersion = compilerVersion;
+}
+
+// fills cache from a file's bytes. false when they aren't a cache of this format and compiler version, the cache is
+// empty then (and dirty, so the next save replaces the file). entries out of bounds or failing their checksum are
+// skipped
+bool ShaderCacheParse(ShaderCache &cache, const void *file, size_t size)
+{
+    ShaderCacheInit(cache, cache.compilerVersion);
+    cache.fileBytes = size;
+    const uint8_t *bytes = (const uint8_t *)file;
+    ShaderCacheFileHeader header;
+    if (!bytes || size < sizeof(header))
+    {
+        cache.dirty = true;
+        return false;
+    }
+    memcpy(&header, bytes, sizeof(header));
+    size_t tableEnd = sizeof(header) + (size_t)header.entryCount * sizeof(ShaderCacheFileEntry);
+    if (header.magic != SHADER_CACHE_MAGIC || header.format != SHADER_CACHE_FORMAT ||
+        header.compilerVersion != cache.compilerVersion || header.entryCount > size / sizeof(ShaderCacheFileEntry) ||
+        tableEnd > size || header.dataSize != size - tableEnd)
+    {
+        cache.rejected++;
+        cache.dirty = true;
+        return false;
+    }
+
+    cache.data.assign(bytes + tableEnd, bytes + size);
+    cache.entries.reserve(header.entryCount);
+    for (uint32_t e = 0; e < header.entryCount; ++e)
+    {
+        ShaderCacheFileEntry entry;
+        memcpy(&entry, bytes + sizeof(header) + e * sizeof(entry), sizeof(entry));
+        if (entry.size == 0 || entry.offset > header.dataSize || entry.size > header.dataSize - entry.offset ||
+            ShaderCacheHashBytes(&cache.data[entry.offset], entry.size) != entry.checksum)
+        {
+            cache.rejected++;
+            cache.dirty = true;
+            continue;
+        }
+        cache.entries.push_back({entry.key, entry.variant, entry.checksum, entry.offset, entry.size, false});
+    }
+    return true;
+}
+
+// nullptr on a miss. the blob is entry->size bytes at &cache.data[entry->offset], valid until the next insert
+const ShaderCacheEntry *ShaderCacheFind(ShaderCache &cache, ShaderCacheKey key)
+{
+    for (ShaderCacheEntry &entry : cache.entries)
+    {
+        if (entry.key == key.key && entry.variant == key.variant)
+        {
+            entry.used = true;
+            cache.hits++;
+            return &entry;
+        }
+    }
+    cache.misses++;
+    return nullptr;
+}
+
+// adds a freshly compiled blob, replacing the entries of the same permutation (their source changed)
+void ShaderCacheInsert(ShaderCache &cache, ShaderCacheKey key, const void *blob, size_t size)
+{
+    if (size == 0 || size > UINT32_MAX || cache.data.size() + size > UINT32_MAX)
+        return;
+    size_t kept = 0;
+    for (size_t e = 0; e < cache.entries.size(); ++e)
+    {
+        if (cache.entries[e].variant == key.variant)
+        {
+            cache.stale += cache.entries[e].key != key.key;
+            continue;
+        }
+        cache.entries[kept++] = cache.entries[e];
+    }
+    cache.entries.resize(kept);
+
+    uint32_t offset = (uint32_t)cache.data.size();
+    cache.data.insert(cache.data.end(), (const uint8_t *)blob, (const uint8_t *)blob + size);
+    cache.entries.push_back({key.key, key.variant, ShaderCacheHashBytes(blob, size), offset, (uint32_t)size, true});
+    cache.dirty = true;
+}
+
+// drops the entries nobody looked up since the cache was loaded (permutations that went away, or got other defines).
+// call once everything is compiled, before saving. returns how many were dropped
+int ShaderCachePruneUnused(ShaderCache &cache)
+{
+    size_t kept = 0;
+    for (size_t e = 0; e < cache.entries.size(); ++e)
+    {
+        if (cache.entries[e].used)
+            cache.entries[kept++] = cache.entries[e];
+    }
+    int dropped = (int)(cache.entries.size() - kept);
+    cache.entries.resize(kept);
+    cache.dirty |= dropped > 0;
+    return dropped;
+}
+
+// the file's bytes, blobs packed in entry order (dropped ones left out)
+void ShaderCacheSerialize(const ShaderCache &cache, std::vector<uint8_t> &out)
+{
+    ShaderCacheFileHeader header = {SHADER_CACHE_MAGIC, SHADER_CACHE_FORMAT, cache.compilerVersion, (uint32_t)cache.entries.size(), 0};
+    for (const ShaderCacheEntry &entry : cache.entries)
+        header.dataSize += entry.size;
+
+    out.clear();
+    out.reserve(sizeof(header) + cache.entries.size() * sizeof(ShaderCacheFileEntry) + header.dataSize);
+    out.insert(out.end(), (const uint8_t *)&header, (const uint8_t *)&header + sizeof(header));
+    uint32_t offset = 0;
+    for (const ShaderCacheEntry &entry : cache.entries)
+    {
+        ShaderCacheFileEntry fileEntry = {entry.key, entry.variant, entry.checksum, offset, entry.size};
+        out.insert(out.end(), (const uint8_t *)&fileEntry, (const uint8_t *)&fileEntry + sizeof(fileEntry));
+        offset += entry.size;
+    }
+    for (const ShaderCacheEntry &entry : cache.entries)
+        out.insert(out.end(), cache.data.begin() + entry.offset, cache.data.begin() + entry.offset + entry.size);
+}
+
+// true if every entry lies inside data and matches its checksum, and no key or permutation appears twice
+bool ShaderCacheValidate(const ShaderCache &cache)
+{
+    for (size_t e = 0; e < cache.entries.size(); ++e)
+    {
+        const ShaderCacheEntry &entry = cache.entries[e];
+        if (entry.size == 0 || entry.offset > cache.data.size() || entry.size > cache.data.size() - entry.offset ||
+            ShaderCacheHashBytes(&cache.data[entry.offset], entry.size) != entry.checksum)
+            return false;
+        for (size_t other = 0; other < e; ++other)
+        {
+            if (cache.entries[other].key == entry.key || cache.entries[other].variant == entry.variant)
+                return false;
+        }
+    }
+    return true;
+}
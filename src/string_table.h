@@ -0,0 +1,134 @@
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mutex>
+#include <vector>
+
+// global string interner for asset paths and nametags. every distinct string is stored once and the scene keeps a
+// 32-bit id, so comparing two paths is comparing two ints. strings are never freed (the set of names and paths in a
+// level is small), their chars live in fixed blocks so a pointer from StringGet stays valid for the whole run.
+// locked because the autosave worker reads names while the editor interns new ones
+
+typedef uint32_t StringId;
+#define STRING_ID_EMPTY 0u // "" is always id 0, so a zeroed SceneObjectInfo has empty strings
+#define STRING_BLOCK_SIZE 4096
+
+struct StringTable
+{
+    std::mutex mutex;
+    std::vector<char *> blocks;      // chars, STRING_BLOCK_SIZE each (longer strings get their own block)
+    uint32_t blockUsed = 0;          // bytes used in blocks.back()
+    std::vector<const char *> strings; // id -> chars
+    std::vector<uint32_t> hashes;      // id -> hash, so growing the index does not rehash the chars
+    std::vector<uint32_t> slots;       // open addressing index, id + 1 (0 = empty), power of two size
+    size_t charBytes = 0;              // sum of string lengths + terminators
+};
+
+static StringTable g_strings;
+
+static uint32_t StringHash(const char *s, size_t len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t k = 0; k < len; ++k)
+    {
+        h ^= (uint8_t)s[k];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void StringTableGrowIndex(StringTable &table)
+{
+    size_t size = table.slots.empty() ? 64 : table.slots.size() * 2;
+    table.slots.assign(size, 0);
+    for (uint32_t id = 0; id < (uint32_t)table.strings.size(); ++id)
+    {
+        size_t slot = table.hashes[id] & (size - 1);
+        while (table.slots[slot] != 0)
+            slot = (slot + 1) & (size - 1);
+        table.slots[slot] = id + 1;
+    }
+}
+
+static const char *StringTableStore(StringTable &table, const char *s, size_t len)
+{
+    size_t need = len + 1;
+    if (table.blocks.empty() || table.blockUsed + need > STRING_BLOCK_SIZE)
+    {
+        size_t blockSize = need > STRING_BLOCK_SIZE ? need : STRING_BLOCK_SIZE;
+        table.blocks.push_back((char *)malloc(blockSize));
+        table.blockUsed = 0;
+    }
+    char *dst = table.blocks.back() + table.blockUsed;
+    memcpy(dst, s, len);
+    dst[len] = '\0';
+    table.blockUsed += (uint32_t)need;
+    table.charBytes += need;
+    return dst;
+}
+
+StringId StringIntern(const char *s, size_t len)
+{
+    StringTable &table = g_strings;
+    std::lock_guard<std::mutex> lock(table.mutex);
+    if (table.strings.empty())
+    {
+        table.strings.push_back(StringTableStore(table, "", 0));
+        table.hashes.push_back(StringHash("", 0));
+        StringTableGrowIndex(table);
+    }
+    if (len == 0)
+        return STRING_ID_EMPTY;
+
+    uint32_t hash = StringHash(s, len);
+    size_t mask = table.slots.size() - 1;
+    size_t slot = hash & mask;
+    while (table.slots[slot] != 0)
+    {
+        uint32_t id = table.slots[slot] - 1;
+        const char *existing = table.strings[id];
+        if (table.hashes[id] == hash && strncmp(existing, s, len) == 0 && existing[len] == '\0')
+            return id;
+        slot = (slot + 1) & mask;
+    }
+
+    StringId id = (StringId)table.strings.size();
+    table.strings.push_back(StringTableStore(table, s, len));
+    table.hashes.push_back(hash);
+    table.slots[slot] = id + 1;
+    if (table.strings.size() * 2 > table.slots.size()) // keep the index at most half full
+        StringTableGrowIndex(table);
+    return id;
+}
+
+inline StringId StringIntern(const char *s)
+{
+    return s ? StringIntern(s, strlen(s)) : STRING_ID_EMPTY;
+}
+
+// never null, unknown ids read as ""
+const char *StringGet(StringId id)
+{
+    std::lock_guard<std::mutex> lock(g_strings.mutex);
+    return id < g_strings.strings.size() ? g_strings.strings[id] : "";
+}
+
+struct StringTableStats
+{
+    uint32_t count;
+    size_t usedBytes;     // chars + id/hash arrays + index
+    size_t reservedBytes; // what is actually allocated (block slack, vector capacity)
+};
+
+StringTableStats StringTableGetStats()
+{
+    std::lock_guard<std::mutex> lock(g_strings.mutex);
+    StringTableStats stats = {};
+    stats.count = (uint32_t)g_strings.strings.size();
+    size_t perId = sizeof(const char *) + sizeof(uint32_t);
+    stats.usedBytes = g_strings.charBytes + g_strings.strings.size() * perId + g_strings.slots.size() * sizeof(uint32_t);
+    stats.reservedBytes = g_strings.blocks.size() * STRING_BLOCK_SIZE + g_strings.strings.capacity() * perId +
+                          g_strings.slots.capacity() * sizeof(uint32_t); // oversized blocks are rare enough to ignore
+    return stats;
+}
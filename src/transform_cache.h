@@ -0,0 +1,386 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include <stdint.h>
+#include <vector>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// world and inverse world matrices per object, so drawing, collision and the gizmo stop rebuilding them from
+// pos/quaternion/scale every time they look at an object. entries are recomputed when an object is flagged dirty,
+// a full rebuild (and the per-frame bot pass) goes through TransformBuildBatch which does several objects at once
+// from structure of arrays input: 8 with AVX2, 4 with the SSE2 baseline. both are compiled in, g_transformPath picks
+// one at startup from CPUID so the exe still runs on CPUs without AVX2.
+// every path and the single object one use the same formulas with the same roundings, the results are bit identical
+// (tests/test_transform_cache.cpp). that rules out contracting a * b + c into an fma, which rounds once: it is turned
+// off for gcc and clang below, MSVC doesn't contract under /fp:precise and can't emit fma without /arch:AVX2
+
+// world = scale * rotation(quaternion) * translation, row major (DirectXMath convention)
+// invWorld takes a world space point into object space, it is all zero (_44 == 0) when a scale component is 0
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi" // the AVX2 lane helpers, only ever called inside TransformBuildAVX2
+#endif
+#if defined(__clang__)
+#pragma float_control(push)
+#pragma clang fp contract(off)
+#endif
+
+// gcc and clang only emit AVX instructions in functions that ask for them, MSVC in any function
+#if defined(__GNUC__)
+#define TRANSFORM_AVX2 __attribute__((target("avx2")))
+#define TRANSFORM_AVX2_BATCH __attribute__((target("avx2"), flatten)) // pulls the shared batch body in as AVX2 code
+#else
+#define TRANSFORM_AVX2
+#define TRANSFORM_AVX2_BATCH
+#endif
+
+enum TransformPath
+{
+    TRANSFORM_PATH_SCALAR, // TransformBuild per object, for comparisons
+    TRANSFORM_PATH_SSE,
+    TRANSFORM_PATH_AVX2,
+    TRANSFORM_PATH_COUNT
+};
+
+static const char *g_transformPathNames[TRANSFORM_PATH_COUNT] = {"scalar", "SSE", "AVX2"};
+static const int g_transformPathLanes[TRANSFORM_PATH_COUNT] = {1, 4, 8};
+
+// AVX2 in the CPU and ymm state saved by the OS
+inline bool TransformCpuHasAvx2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0, avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 6) != 6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+inline bool TransformPathSupported(TransformPath path)
+{
+    return path != TRANSFORM_PATH_AVX2 || TransformCpuHasAvx2();
+}
+
+static TransformPath g_transformPath = TransformCpuHasAvx2() ? TRANSFORM_PATH_AVX2 : TRANSFORM_PATH_SSE;
+
+// batch input, one float per object in each array
+struct TransformSoA
+{
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> rotX, rotY, rotZ, rotW;
+    std::vector<float> scaleX, scaleY, scaleZ;
+};
+
+void TransformSoAResize(TransformSoA &soa, int count)
+{
+    std::vector<float> *arrays[] = {&soa.posX, &soa.posY, &soa.posZ, &soa.rotX, &soa.rotY,
+                                    &soa.rotZ, &soa.rotW, &soa.scaleX, &soa.scaleY, &soa.scaleZ};
+    for (std::vector<float> *a : arrays)
+    {
+        if ((int)a->size() < count)
+            a->resize(count);
+    }
+}
+
+inline void TransformSoASet(TransformSoA &soa, int i, const DirectX::XMFLOAT3 &pos, const DirectX::XMFLOAT4 &rot, const DirectX::XMFLOAT3 &scale)
+{
+    soa.posX[i] = pos.x;
+    soa.posY[i] = pos.y;
+    soa.posZ[i] = pos.z;
+    soa.rotX[i] = rot.x;
+    soa.rotY[i] = rot.y;
+    soa.rotZ[i] = rot.z;
+    soa.rotW[i] = rot.w;
+    soa.scaleX[i] = scale.x;
+    soa.scaleY[i] = scale.y;
+    soa.scaleZ[i] = scale.z;
+}
+
+// one object. gpuLayout stores world transposed, the way the shader constants want it
+void TransformBuild(const DirectX::XMFLOAT3 &pos, const DirectX::XMFLOAT4 &rot, const DirectX::XMFLOAT3 &scale,
+                    DirectX::XMFLOAT4X4 *world, DirectX::XMFLOAT4X4 *invWorld, bool gpuLayout = false)
+{
+    float x = rot.x, y = rot.y, z = rot.z, w = rot.w;
+    float r[3][3] = {
+        {1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w)},
+        {2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w)},
+        {2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y)},
+    };
+    float s[3] = {scale.x, scale.y, scale.z};
+    float p[3] = {pos.x, pos.y, pos.z};
+
+    if (world)
+    {
+        float m[4][4] = {};
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 3; ++col)
+                m[row][col] = s[row] * r[row][col];
+        }
+        m[3][0] = p[0];
+        m[3][1] = p[1];
+        m[3][2] = p[2];
+        m[3][3] = 1.0f;
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+                world->m[gpuLayout ? col : row][gpuLayout ? row : col] = m[row][col];
+        }
+    }
+
+    if (invWorld)
+    {
+        *invWorld = {};
+        if (s[0] == 0.0f || s[1] == 0.0f || s[2] == 0.0f)
+            return;
+        // (v - pos) * transpose(rotation) / scale
+        for (int col = 0; col < 3; ++col)
+        {
+            for (int row = 0; row < 3; ++row)
+                invWorld->m[row][col] = r[col][row] / s[col];
+            invWorld->m[3][col] = -(p[0] * r[col][0] + p[1] * r[col][1] + p[2] * r[col][2]) / s[col];
+        }
+        invWorld->m[3][3] = 1.0f;
+    }
+}
+
+// writes out[l].m[row] = (c0[l], c1[l], c2[l], c3[l]) for 4 objects, the 4x4 transpose turns lanes into rows
+inline void TransformStoreRow4(DirectX::XMFLOAT4X4 *out, int row, __m128 c0, __m128 c1, __m128 c2, __m128 c3)
+{
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(&out[0].m[row][0], c0);
+    _mm_storeu_ps(&out[1].m[row][0], c1);
+    _mm_storeu_ps(&out[2].m[row][0], c2);
+    _mm_storeu_ps(&out[3].m[row][0], c3);
+}
+
+// the lane operations TransformBuildLanes is written against, one struct per instruction set
+struct TransformLanesSSE
+{
+    typedef __m128 Lanes;
+    static const int count = 4;
+    static Lanes Load(const float *p) { return _mm_loadu_ps(p); }
+    static Lanes Set(float v) { return _mm_set1_ps(v); }
+    static Lanes Add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+    static Lanes Sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+    static Lanes Mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+    static Lanes Div(Lanes a, Lanes b) { return _mm_div_ps(a, b); }
+    static Lanes IsZero(Lanes a) { return _mm_cmpeq_ps(a, _mm_setzero_ps()); }
+    static Lanes Or(Lanes a, Lanes b) { return _mm_or_ps(a, b); }
+    static Lanes AndNot(Lanes mask, Lanes a) { return _mm_andnot_ps(mask, a); }
+    static void StoreRow(DirectX::XMFLOAT4X4 *out, int row, Lanes c0, Lanes c1, Lanes c2, Lanes c3)
+    {
+        TransformStoreRow4(out, row, c0, c1, c2, c3);
+    }
+};
+
+struct TransformLanesAVX2
+{
+    typedef __m256 Lanes;
+    static const int count = 8;
+    TRANSFORM_AVX2 static Lanes Load(const float *p) { return _mm256_loadu_ps(p); }
+    TRANSFORM_AVX2 static Lanes Set(float v) { return _mm256_set1_ps(v); }
+    TRANSFORM_AVX2 static Lanes Add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+    TRANSFORM_AVX2 static Lanes Sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+    TRANSFORM_AVX2 static Lanes Mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+    TRANSFORM_AVX2 static Lanes Div(Lanes a, Lanes b) { return _mm256_div_ps(a, b); }
+    TRANSFORM_AVX2 static Lanes IsZero(Lanes a) { return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ); }
+    TRANSFORM_AVX2 static Lanes Or(Lanes a, Lanes b) { return _mm256_or_ps(a, b); }
+    TRANSFORM_AVX2 static Lanes AndNot(Lanes mask, Lanes a) { return _mm256_andnot_ps(mask, a); }
+    TRANSFORM_AVX2 static void StoreRow(DirectX::XMFLOAT4X4 *out, int row, Lanes c0, Lanes c1, Lanes c2, Lanes c3)
+    {
+        TransformStoreRow4(out, row, _mm256_castps256_ps128(c0), _mm256_castps256_ps128(c1),
+                           _mm256_castps256_ps128(c2), _mm256_castps256_ps128(c3));
+        TransformStoreRow4(out + 4, row, _mm256_extractf128_ps(c0, 1), _mm256_extractf128_ps(c1, 1),
+                           _mm256_extractf128_ps(c2, 1), _mm256_extractf128_ps(c3, 1));
+    }
+};
+
+// the objects of count that fill whole batches of L::count, returns how many that was. same results as
+// TransformBuild per object
+template <typename L>
+inline int TransformBuildLanes(const TransformSoA &in, int count, DirectX::XMFLOAT4X4 *world, DirectX::XMFLOAT4X4 *invWorld, bool gpuLayout)
+{
+    typedef typename L::Lanes Lanes;
+    const Lanes one = L::Set(1.0f);
+    const Lanes two = L::Set(2.0f);
+    const Lanes zero = L::Set(0.0f);
+
+    int i = 0;
+    for (; i + L::count <= count; i += L::count)
+    {
+        Lanes x = L::Load(&in.rotX[i]), y = L::Load(&in.rotY[i]), z = L::Load(&in.rotZ[i]), w = L::Load(&in.rotW[i]);
+        Lanes s0 = L::Load(&in.scaleX[i]), s1 = L::Load(&in.scaleY[i]), s2 = L::Load(&in.scaleZ[i]);
+        Lanes p0 = L::Load(&in.posX[i]), p1 = L::Load(&in.posY[i]), p2 = L::Load(&in.posZ[i]);
+
+        Lanes xx = L::Mul(x, x), yy = L::Mul(y, y), zz = L::Mul(z, z);
+        Lanes xy = L::Mul(x, y), xz = L::Mul(x, z), yz = L::Mul(y, z);
+        Lanes xw = L::Mul(x, w), yw = L::Mul(y, w), zw = L::Mul(z, w);
+
+        Lanes r00 = L::Sub(one, L::Mul(two, L::Add(yy, zz)));
+        Lanes r01 = L::Mul(two, L::Add(xy, zw));
+        Lanes r02 = L::Mul(two, L::Sub(xz, yw));
+        Lanes r10 = L::Mul(two, L::Sub(xy, zw));
+        Lanes r11 = L::Sub(one, L::Mul(two, L::Add(xx, zz)));
+        Lanes r12 = L::Mul(two, L::Add(yz, xw));
+        Lanes r20 = L::Mul(two, L::Add(xz, yw));
+        Lanes r21 = L::Mul(two, L::Sub(yz, xw));
+        Lanes r22 = L::Sub(one, L::Mul(two, L::Add(xx, yy)));
+
+        if (world)
+        {
+            Lanes m00 = L::Mul(s0, r00), m01 = L::Mul(s0, r01), m02 = L::Mul(s0, r02);
+            Lanes m10 = L::Mul(s1, r10), m11 = L::Mul(s1, r11), m12 = L::Mul(s1, r12);
+            Lanes m20 = L::Mul(s2, r20), m21 = L::Mul(s2, r21), m22 = L::Mul(s2, r22);
+            if (gpuLayout)
+            {
+                L::StoreRow(world + i, 0, m00, m10, m20, p0);
+                L::StoreRow(world + i, 1, m01, m11, m21, p1);
+                L::StoreRow(world + i, 2, m02, m12, m22, p2);
+                L::StoreRow(world + i, 3, zero, zero, zero, one);
+            }
+            else
+            {
+                L::StoreRow(world + i, 0, m00, m01, m02, zero);
+                L::StoreRow(world + i, 1, m10, m11, m12, zero);
+                L::StoreRow(world + i, 2, m20, m21, m22, zero);
+                L::StoreRow(world + i, 3, p0, p1, p2, one);
+            }
+        }
+
+        if (invWorld)
+        {
+            // lanes with a zero scale get an all zero matrix, the divides there are masked out below
+            Lanes degenerate = L::Or(L::Or(L::IsZero(s0), L::IsZero(s1)), L::IsZero(s2));
+            Lanes i00 = L::Div(r00, s0), i01 = L::Div(r10, s1), i02 = L::Div(r20, s2);
+            Lanes i10 = L::Div(r01, s0), i11 = L::Div(r11, s1), i12 = L::Div(r21, s2);
+            Lanes i20 = L::Div(r02, s0), i21 = L::Div(r12, s1), i22 = L::Div(r22, s2);
+            Lanes t0 = L::Sub(zero, L::Div(L::Add(L::Add(L::Mul(p0, r00), L::Mul(p1, r01)), L::Mul(p2, r02)), s0));
+            Lanes t1 = L::Sub(zero, L::Div(L::Add(L::Add(L::Mul(p0, r10), L::Mul(p1, r11)), L::Mul(p2, r12)), s1));
+            Lanes t2 = L::Sub(zero, L::Div(L::Add(L::Add(L::Mul(p0, r20), L::Mul(p1, r21)), L::Mul(p2, r22)), s2));
+            L::StoreRow(invWorld + i, 0, L::AndNot(degenerate, i00), L::AndNot(degenerate, i01), L::AndNot(degenerate, i02), zero);
+            L::StoreRow(invWorld + i, 1, L::AndNot(degenerate, i10), L::AndNot(degenerate, i11), L::AndNot(degenerate, i12), zero);
+            L::StoreRow(invWorld + i, 2, L::AndNot(degenerate, i20), L::AndNot(degenerate, i21), L::AndNot(degenerate, i22), zero);
+            L::StoreRow(invWorld + i, 3, L::AndNot(degenerate, t0), L::AndNot(degenerate, t1), L::AndNot(degenerate, t2), L::AndNot(degenerate, one));
+        }
+    }
+    return i;
+}
+
+inline int TransformBuildSSE(const TransformSoA &in, int count, DirectX::XMFLOAT4X4 *world, DirectX::XMFLOAT4X4 *invWorld, bool gpuLayout)
+{
+    return TransformBuildLanes<TransformLanesSSE>(in, count, world, invWorld, gpuLayout);
+}
+
+TRANSFORM_AVX2_BATCH inline int TransformBuildAVX2(const TransformSoA &in, int count, DirectX::XMFLOAT4X4 *world, DirectX::XMFLOAT4X4 *invWorld, bool gpuLayout)
+{
+    int done = TransformBuildLanes<TransformLanesAVX2>(in, count, world, invWorld, gpuLayout);
+    _mm256_zeroupper(); // no AVX to SSE transition penalty in the SSE code after it
+    return done;
+}
+
+// count objects from in, world and/or invWorld may be null. path is g_transformPath unless a caller compares them,
+// it must be supported by the CPU (TransformPathSupported)
+void TransformBuildBatch(const TransformSoA &in, int count, DirectX::XMFLOAT4X4 *world, DirectX::XMFLOAT4X4 *invWorld,
+                         bool gpuLayout = false, TransformPath path = g_transformPath)
+{
+    int i = 0;
+    if (path == TRANSFORM_PATH_AVX2)
+        i = TransformBuildAVX2(in, count, world, invWorld, gpuLayout);
+    else if (path == TRANSFORM_PATH_SSE)
+        i = TransformBuildSSE(in, count, world, invWorld, gpuLayout);
+
+    for (; i < count; ++i)
+    {
+        TransformBuild({in.posX[i], in.posY[i], in.posZ[i]}, {in.rotX[i], in.rotY[i], in.rotZ[i], in.rotW[i]},
+                       {in.scaleX[i], in.scaleY[i], in.scaleZ[i]}, world ? world + i : nullptr,
+                       invWorld ? invWorld + i : nullptr, gpuLayout);
+    }
+}
+
+// per object cache, indexed like the caller's object arrays (dense scene index for g_scene)
+struct TransformCache
+{
+    std::vector<DirectX::XMFLOAT4X4> world;
+    std::vector<DirectX::XMFLOAT4X4> invWorld;
+    std::vector<DirectX::XMFLOAT4X4> gpuWorld; // world transposed (gpuLayout), what the draw list copies as is
+    std::vector<bool> dirty;
+    std::vector<int> dirtyList;
+    bool allDirty = true; // objects added/removed, rebuild everything in one batch
+    TransformSoA batchInput;
+
+    // stats
+    int recomputed = 0; // objects rebuilt since the caller last zeroed it
+    int fullRebuilds = 0;
+};
+
+void TransformCacheMarkDirty(TransformCache &cache, int i)
+{
+    // past the end means the object is newer than the last rebuild, which already flagged one
+    if (cache.allDirty || i < 0 || i >= (int)cache.dirty.size() || cache.dirty[i])
+        return;
+    cache.dirty[i] = true;
+    cache.dirtyList.push_back(i);
+}
+
+void TransformCacheMarkAllDirty(TransformCache &cache)
+{
+    cache.allDirty = true;
+}
+
+// brings the cache up to date with count objects, call before reading it (cheap when nothing changed)
+void TransformCacheSync(TransformCache &cache, int count, const DirectX::XMFLOAT3 *pos, const DirectX::XMFLOAT4 *rot, const DirectX::XMFLOAT3 *scale)
+{
+    if (cache.allDirty)
+    {
+        cache.world.resize(count);
+        cache.invWorld.resize(count);
+        cache.gpuWorld.resize(count);
+        cache.dirty.assign(count, false);
+        cache.dirtyList.clear();
+        TransformSoAResize(cache.batchInput, count);
+        for (int i = 0; i < count; ++i)
+            TransformSoASet(cache.batchInput, i, pos[i], rot[i], scale[i]);
+        TransformBuildBatch(cache.batchInput, count, cache.world.data(), cache.invWorld.data());
+        TransformBuildBatch(cache.batchInput, count, cache.gpuWorld.data(), nullptr, true);
+        cache.allDirty = false;
+        cache.fullRebuilds++;
+        cache.recomputed += count;
+        return;
+    }
+
+    for (int i : cache.dirtyList)
+    {
+        if (i < count)
+        {
+            TransformBuild(pos[i], rot[i], scale[i], &cache.world[i], &cache.invWorld[i]);
+            TransformBuild(pos[i], rot[i], scale[i], &cache.gpuWorld[i], nullptr, true);
+        }
+        cache.dirty[i] = false;
+    }
+    cache.recomputed += (int)cache.dirtyList.size();
+    cache.dirtyList.clear();
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+#if defined(__clang__)
+#pragma float_control(pop)
+#endif
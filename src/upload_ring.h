@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stdint.h>
+
+// linear allocator over one persistently mapped upload buffer, used as a ring: allocations are handed out front to
+// back and wrap around to the start, each frame's are tagged with the fence value that frame signals and only handed
+// out again once the GPU has passed it. just the bookkeeping, no D3D in here. the buffer lives in GraphicsResources,
+// the fence values are SyncState's (see PopulateCommandList)
+//
+// head and tail count bytes since the start and never wrap themselves, the buffer offset is head % capacity. the
+// bytes in flight are head - tail, so an allocation fits when that stays within the capacity
+
+#define UPLOAD_RING_ALIGNMENT 256     // constant buffer placement alignment, more than structured buffers need
+#define UPLOAD_RING_MAX_ALIGNMENT 512 // texture data placement alignment, for the staging ring of the copy queue
+#define UPLOAD_RING_MAX_FRAMES 8  // frames with allocations waiting on their fence, at least g_FrameCount
+#define UPLOAD_RING_FULL UINT64_MAX
+
+struct UploadRingFrame
+{
+    uint64_t fenceValue;
+    uint64_t end; // head when the frame was closed, everything before it is free once fenceValue completes
+};
+
+struct UploadRing
+{
+    uint64_t capacity = 0; // multiple of UPLOAD_RING_MAX_ALIGNMENT
+    uint64_t head = 0;
+    uint64_t tail = 0;
+    uint64_t frameStart = 0; // head when the current frame started allocating
+
+    UploadRingFrame frames[UPLOAD_RING_MAX_FRAMES] = {};
+    int frameFirst = 0; // oldest pending frame
+    int frameCount = 0;
+
+    // stats (shown in Debug Controls)
+    uint64_t highWater = 0;      // most bytes in flight at once
+    uint64_t lastFrameBytes = 0; // allocated by the last closed frame, padding included
+    uint64_t wraps = 0;
+    uint64_t allocations = 0;
+};
+
+inline void UploadRingInit(UploadRing &ring, uint64_t capacity)
+{
+    ring = {};
+    ring.capacity = capacity & ~(uint64_t)(UPLOAD_RING_MAX_ALIGNMENT - 1);
+}
+
+inline uint64_t UploadRingInFlight(const UploadRing &ring)
+{
+    return ring.head - ring.tail;
+}
+
+// offset of size free bytes aligned to alignment (a power of two, at most UPLOAD_RING_MAX_ALIGNMENT), never straddling
+// the end of the buffer. UPLOAD_RING_FULL when the GPU still holds too much of the ring, nothing is changed then
+inline uint64_t UploadRingAlloc(UploadRing &ring, uint64_t size, uint64_t alignment = UPLOAD_RING_ALIGNMENT)
+{
+    if (size > ring.capacity)
+        return UPLOAD_RING_FULL;
+
+    uint64_t start = (ring.head + alignment - 1) & ~(alignment - 1);
+    uint64_t offset = start % ring.capacity;
+    bool wrapped = offset + size > ring.capacity;
+    if (wrapped)
+    {
+        start += ring.capacity - offset; // skip the rest of the buffer, it's freed along with this allocation
+        offset = 0;
+    }
+    if (start + size - ring.tail > ring.capacity)
+        return UPLOAD_RING_FULL;
+
+    ring.head = start + size;
+    ring.wraps += wrapped;
+    ring.allocations++;
+    if (UploadRingInFlight(ring) > ring.highWater)
+        ring.highWater = UploadRingInFlight(ring);
+    return offset;
+}
+
+// everything allocated since the last close belongs to the frame that signals fenceValue. fence values have to grow
+// from one close to the next
+inline void UploadRingCloseFrame(UploadRing &ring, uint64_t fenceValue)
+{
+    ring.lastFrameBytes = ring.head - ring.frameStart;
+    ring.frameStart = ring.head;
+    if (ring.frameCount == UPLOAD_RING_MAX_FRAMES)
+    {
+        // too many pending, fold this one into the newest. those bytes then wait for the later fence, which is safe
+        UploadRingFrame &newest = ring.frames[(ring.frameFirst + ring.frameCount - 1) % UPLOAD_RING_MAX_FRAMES];
+        newest = {fenceValue, ring.head};
+        return;
+    }
+    ring.frames[(ring.frameFirst + ring.frameCount) % UPLOAD_RING_MAX_FRAMES] = {fenceValue, ring.head};
+    ring.frameCount++;
+}
+
+// frees the allocations of every closed frame whose fence value the GPU has reached
+inline void UploadRingRetire(UploadRing &ring, uint64_t completedFenceValue)
+{
+    while (ring.frameCount > 0 && ring.frames[ring.frameFirst].fenceValue <= completedFenceValue)
+    {
+        ring.tail = ring.frames[ring.frameFirst].end;
+        ring.frameFirst = (ring.frameFirst + 1) % UPLOAD_RING_MAX_FRAMES;
+        ring.frameCount--;
+    }
+}
+
+// the fence value to wait for before more of the ring frees up, 0 when nothing closed is pending
+inline uint64_t UploadRingOldestFence(const UploadRing &ring)
+{
+    return ring.frameCount > 0 ? ring.frames[ring.frameFirst].fenceValue : 0;
+}
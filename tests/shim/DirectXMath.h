@@ -0,0 +1,194 @@
+#pragma once
+
+#include <math.h>
+
+// the few DirectXMath types and functions the portable headers use, in plain scalar code, for building the tests
+// where the Windows SDK isn't around. run_tests.py only puts this directory on the include path off Windows, MSVC
+// builds get the real header. same conventions: row vectors, row major matrices, v * M
+
+namespace DirectX
+{
+
+struct XMFLOAT2
+{
+    float x, y;
+};
+
+struct XMFLOAT3
+{
+    float x, y, z;
+};
+
+struct XMFLOAT4
+{
+    float x, y, z, w;
+};
+
+struct XMFLOAT4X4
+{
+    float m[4][4];
+};
+
+struct XMVECTOR
+{
+    float v[4];
+};
+
+struct XMMATRIX
+{
+    XMVECTOR r[4];
+};
+
+typedef const XMVECTOR &FXMVECTOR;
+typedef const XMMATRIX &FXMMATRIX;
+
+inline XMVECTOR XMVectorSet(float x, float y, float z, float w)
+{
+    return {{x, y, z, w}};
+}
+
+inline XMVECTOR XMVectorAdd(XMVECTOR a, FXMVECTOR b)
+{
+    for (int i = 0; i < 4; ++i)
+        a.v[i] += b.v[i];
+    return a;
+}
+
+inline XMVECTOR XMVectorSubtract(XMVECTOR a, FXMVECTOR b)
+{
+    for (int i = 0; i < 4; ++i)
+        a.v[i] -= b.v[i];
+    return a;
+}
+
+inline XMVECTOR XMPlaneNormalize(XMVECTOR p)
+{
+    float length = sqrtf(p.v[0] * p.v[0] + p.v[1] * p.v[1] + p.v[2] * p.v[2]);
+    for (int i = 0; i < 4; ++i)
+        p.v[i] = length > 0.0f ? p.v[i] / length : 0.0f;
+    return p;
+}
+
+inline XMVECTOR XMLoadFloat3(const XMFLOAT3 *f)
+{
+    return {{f->x, f->y, f->z, 0.0f}};
+}
+
+inline XMVECTOR XMLoadFloat4(const XMFLOAT4 *f)
+{
+    return {{f->x, f->y, f->z, f->w}};
+}
+
+inline void XMStoreFloat3(XMFLOAT3 *f, FXMVECTOR v)
+{
+    *f = {v.v[0], v.v[1], v.v[2]};
+}
+
+inline void XMStoreFloat4(XMFLOAT4 *f, FXMVECTOR v)
+{
+    *f = {v.v[0], v.v[1], v.v[2], v.v[3]};
+}
+
+inline XMMATRIX XMLoadFloat4x4(const XMFLOAT4X4 *f)
+{
+    XMMATRIX m;
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int col = 0; col < 4; ++col)
+            m.r[row].v[col] = f->m[row][col];
+    }
+    return m;
+}
+
+inline void XMStoreFloat4x4(XMFLOAT4X4 *f, FXMMATRIX m)
+{
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int col = 0; col < 4; ++col)
+            f->m[row][col] = m.r[row].v[col];
+    }
+}
+
+inline XMMATRIX XMMatrixIdentity()
+{
+    XMMATRIX m = {};
+    for (int i = 0; i < 4; ++i)
+        m.r[i].v[i] = 1.0f;
+    return m;
+}
+
+inline XMMATRIX XMMatrixMultiply(FXMMATRIX a, FXMMATRIX b)
+{
+    XMMATRIX m;
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int col = 0; col < 4; ++col)
+        {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k)
+                sum += a.r[row].v[k] * b.r[k].v[col];
+            m.r[row].v[col] = sum;
+        }
+    }
+    return m;
+}
+
+inline XMMATRIX operator*(FXMMATRIX a, FXMMATRIX b)
+{
+    return XMMatrixMultiply(a, b);
+}
+
+inline XMMATRIX XMMatrixTranspose(FXMMATRIX a)
+{
+    XMMATRIX m;
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int col = 0; col < 4; ++col)
+            m.r[row].v[col] = a.r[col].v[row];
+    }
+    return m;
+}
+
+inline XMMATRIX XMMatrixScaling(float x, float y, float z)
+{
+    XMMATRIX m = XMMatrixIdentity();
+    m.r[0].v[0] = x;
+    m.r[1].v[1] = y;
+    m.r[2].v[2] = z;
+    return m;
+}
+
+inline XMMATRIX XMMatrixTranslation(float x, float y, float z)
+{
+    XMMATRIX m = XMMatrixIdentity();
+    m.r[3].v[0] = x;
+    m.r[3].v[1] = y;
+    m.r[3].v[2] = z;
+    return m;
+}
+
+inline XMMATRIX XMMatrixRotationY(float angle)
+{
+    XMMATRIX m = XMMatrixIdentity();
+    float s = sinf(angle), c = cosf(angle);
+    m.r[0].v[0] = c;
+    m.r[0].v[2] = -s;
+    m.r[2].v[0] = s;
+    m.r[2].v[2] = c;
+    return m;
+}
+
+inline XMMATRIX XMMatrixPerspectiveFovLH(float fovY, float aspect, float nearZ, float farZ)
+{
+    float height = 1.0f / tanf(fovY * 0.5f);
+    float range = farZ / (farZ - nearZ);
+    XMMATRIX m = {};
+    m.r[0].v[0] = height / aspect;
+    m.r[1].v[1] = height;
+    m.r[2].v[2] = range;
+    m.r[2].v[3] = 1.0f;
+    m.r[3].v[2] = -range * nearZ;
+    return m;
+}
+
+} // namespace DirectX
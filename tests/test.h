@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+// shared bits of the headless tests (see run_tests.py): checks that log and count instead of stopping, a timer for
+// the benchmark numbers and golden file comparison. every test is its own program over the portable headers in src/,
+// no D3D, no SDL, no window
+
+static int g_testChecks = 0;
+static int g_testFailures = 0;
+static bool g_testUpdateGolden = false; // --update: write the golden files instead of comparing against them
+
+#define TEST_CHECK(cond) TestCheck((cond), #cond, __FILE__, __LINE__)
+
+inline bool TestCheck(bool ok, const char *what, const char *file, int line)
+{
+    g_testChecks++;
+    if (!ok)
+    {
+        g_testFailures++;
+        printf("  FAILED %s:%d: %s\n", file, line, what);
+    }
+    return ok;
+}
+
+inline void TestInit(int argc, char **argv)
+{
+    for (int a = 1; a < argc; ++a)
+        g_testUpdateGolden |= strcmp(argv[a], "--update") == 0;
+}
+
+inline int TestFinish(const char *name)
+{
+    printf("%s: %d checks, %d failed\n", name, g_testChecks, g_testFailures);
+    return g_testFailures ? 1 : 0;
+}
+
+inline double TestNowMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// xorshift, so the random cases are the same on every compiler and standard library
+struct TestRandom
+{
+    uint32_t state;
+};
+
+inline uint32_t TestRand(TestRandom &r)
+{
+    r.state ^= r.state << 13;
+    r.state ^= r.state >> 17;
+    r.state ^= r.state << 5;
+    return r.state;
+}
+
+// text against tests/golden/<name>. a mismatch leaves the actual text next to it as <name>.actual to diff
+inline bool TestGolden(const char *name, const std::string &text)
+{
+    std::string path = std::string("tests/golden/") + name;
+    if (g_testUpdateGolden)
+    {
+        FILE *file = fopen(path.c_str(), "wb");
+        bool ok = file && fwrite(text.data(), 1, text.size(), file) == text.size();
+        if (file)
+            fclose(file);
+        printf("  wrote %s\n", path.c_str());
+        return TEST_CHECK(ok);
+    }
+
+    std::string expected;
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file)
+    {
+        char buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            expected.append(buffer, n);
+        fclose(file);
+    }
+    if (!file || expected != text)
+    {
+        std::string actualPath = path + ".actual";
+        FILE *actual = fopen(actualPath.c_str(), "wb");
+        if (actual)
+        {
+            fwrite(text.data(), 1, text.size(), actual);
+            fclose(actual);
+        }
+        printf("  %s %s, actual output in %s\n", file ? "mismatch against" : "missing", path.c_str(), actualPath.c_str());
+    }
+    return TEST_CHECK(file && expected == text);
+}
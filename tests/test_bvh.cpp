@@ -0,0 +1,278 @@
+#include "test.h"
+
+#include "bvh.h"
+
+#include <algorithm>
+
+// the SAH tree of bvh.h: every node bounding what's under it, every item in exactly one leaf, and frustum culls that
+// give the set testing every box gives, after a build, after the items moved and the tree was refit, for degenerate
+// inputs and a full output buffer. then the benchmark: build and refit of 100k boxes, culling from three views against
+// testing every box, and the cost of a narrow view as the scene grows
+
+static float Unit(TestRandom &random)
+{
+    return (float)(TestRand(random) % 20001) / 20000.0f;
+}
+
+// boxes of 0.1 to 4 units spread over 512 x 40 x 512 like the benchmark scenes, flat ones every 7th
+static std::vector<AABB> RandomBoxes(int count, uint32_t seed)
+{
+    TestRandom random = {seed};
+    std::vector<AABB> bounds(count);
+    for (int i = 0; i < count; ++i)
+    {
+        DirectX::XMFLOAT3 c = {Unit(random) * 512.0f - 256.0f, Unit(random) * 40.0f, Unit(random) * 512.0f - 256.0f};
+        DirectX::XMFLOAT3 h = {0.05f + Unit(random) * 2.0f, i % 7 ? 0.05f + Unit(random) * 2.0f : 0.0f, 0.05f + Unit(random) * 2.0f};
+        bounds[i] = {{c.x - h.x, c.y - h.y, c.z - h.z}, {c.x + h.x, c.y + h.y, c.z + h.z}};
+    }
+    return bounds;
+}
+
+static Frustum ViewFrustum(float fovY, DirectX::XMFLOAT3 eye, float yaw)
+{
+    DirectX::XMMATRIX view = DirectX::XMMatrixMultiply(DirectX::XMMatrixTranslation(-eye.x, -eye.y, -eye.z), DirectX::XMMatrixRotationY(-yaw));
+    // reverse-Z like the renderer: near and far swapped
+    return FrustumFromViewProj(DirectX::XMMatrixMultiply(view, DirectX::XMMatrixPerspectiveFovLH(fovY, 16.0f / 9.0f, 1000.0f, 0.1f)));
+}
+
+static bool Contains(const AABB &outer, const AABB &inner)
+{
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+           outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+}
+
+static bool SameBox(const AABB &a, const AABB &b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+// the tree's invariants: children after their parent, each inner node exactly the union of its children and each leaf
+// exactly the union of its items (a refit keeps them tight), leaves small unless the depth limit forced them (the SAH
+// may keep up to 4x BVH_MAX_LEAF_ITEMS in one), and the leaves' items a permutation of ids
+static bool ValidTree(const BVH &bvh, const AABB *bounds, const std::vector<uint32_t> &ids)
+{
+    if (bvh.itemIds.size() != ids.size())
+        return false;
+    if (ids.empty())
+        return bvh.nodes.empty();
+
+    bool valid = true;
+    std::vector<int> depth(bvh.nodes.size(), 0);
+    std::vector<uint32_t> seen;
+    for (uint32_t n = 0; n < bvh.nodes.size(); ++n)
+    {
+        const BVHNode &node = bvh.nodes[n];
+        AABB tight = AABBEmpty();
+        if (node.count > 0)
+        {
+            valid &= node.first + node.count <= bvh.itemIds.size();
+            valid &= node.count <= BVH_MAX_LEAF_ITEMS * 4 || depth[n] >= BVH_MAX_DEPTH;
+            for (uint32_t k = 0; k < node.count && node.first + k < bvh.itemIds.size(); ++k)
+            {
+                uint32_t id = bvh.itemIds[node.first + k];
+                AABBGrow(tight, bounds[id]);
+                seen.push_back(id);
+            }
+        }
+        else
+        {
+            valid &= node.first > n && node.first + 1 < bvh.nodes.size();
+            if (!valid)
+                return false;
+            depth[node.first] = depth[node.first + 1] = depth[n] + 1;
+            tight = bvh.nodes[node.first].bounds;
+            AABBGrow(tight, bvh.nodes[node.first + 1].bounds);
+        }
+        valid &= SameBox(node.bounds, tight) && Contains(bvh.nodes[0].bounds, node.bounds);
+    }
+    std::vector<uint32_t> expected = ids;
+    std::sort(seen.begin(), seen.end());
+    std::sort(expected.begin(), expected.end());
+    return valid && seen == expected;
+}
+
+static std::vector<uint32_t> CullEveryBox(const Frustum &frustum, const AABB *bounds, const std::vector<uint32_t> &ids)
+{
+    std::vector<uint32_t> visible;
+    for (uint32_t id : ids)
+    {
+        uint32_t planeMask = 0x3F;
+        if (FrustumTestAABB(frustum, bounds[id], planeMask) != FRUSTUM_OUTSIDE)
+            visible.push_back(id);
+    }
+    std::sort(visible.begin(), visible.end());
+    return visible;
+}
+
+static std::vector<uint32_t> CullTree(const BVH &bvh, const Frustum &frustum, const AABB *bounds, int *nodesVisited = nullptr)
+{
+    std::vector<uint32_t> visible(bvh.itemIds.size());
+    int count = BVHCullFrustum(bvh, frustum, bounds, visible.data(), (int)visible.size(), nodesVisited);
+    visible.resize(count);
+    std::sort(visible.begin(), visible.end());
+    return visible;
+}
+
+// frusta all over the scene: every direction from inside, from above and from outside, narrow and wide
+static std::vector<Frustum> TestViews()
+{
+    std::vector<Frustum> views;
+    for (int v = 0; v < 24; ++v)
+    {
+        float fov = v % 3 == 0 ? 0.17f : v % 3 == 1 ? 1.05f : 2.0f;
+        DirectX::XMFLOAT3 eye = v < 8 ? DirectX::XMFLOAT3{0.0f, 2.0f, 0.0f} : v < 16 ? DirectX::XMFLOAT3{100.0f, 60.0f, -50.0f} : DirectX::XMFLOAT3{0.0f, 20.0f, -400.0f};
+        views.push_back(ViewFrustum(fov, eye, v * 0.8f));
+    }
+    return views;
+}
+
+static double MedianMs(std::vector<double> &times)
+{
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+    std::vector<Frustum> views = TestViews();
+
+    // a build over every other box (ids don't have to be dense, main.cpp passes the cullable ones)
+    std::vector<AABB> bounds = RandomBoxes(20000, 3);
+    std::vector<uint32_t> ids;
+    for (uint32_t id = 0; id < bounds.size(); id += 2)
+        ids.push_back(id);
+    BVH bvh;
+    BVHBuild(bvh, bounds.data(), ids.data(), (uint32_t)ids.size());
+    TEST_CHECK(ValidTree(bvh, bounds.data(), ids));
+    bool same = true;
+    int seenVisible = 0;
+    for (const Frustum &frustum : views)
+    {
+        std::vector<uint32_t> expected = CullEveryBox(frustum, bounds.data(), ids);
+        same &= CullTree(bvh, frustum, bounds.data()) == expected;
+        seenVisible += !expected.empty() && expected.size() < ids.size();
+    }
+    TEST_CHECK(same);
+    TEST_CHECK(seenVisible > (int)views.size() / 2); // the views cut through the scene, not all or nothing
+
+    // items moved (most a little, some far), a refit keeps the topology and is tight and exact again
+    TestRandom random = {5};
+    for (uint32_t id : ids)
+    {
+        float far = id % 50 == 0 ? 200.0f : 3.0f;
+        DirectX::XMFLOAT3 d = {(Unit(random) - 0.5f) * far, (Unit(random) - 0.5f) * far * 0.1f, (Unit(random) - 0.5f) * far};
+        AABB &b = bounds[id];
+        b = {{b.min.x + d.x, b.min.y + d.y, b.min.z + d.z}, {b.max.x + d.x, b.max.y + d.y, b.max.z + d.z}};
+    }
+    std::vector<BVHNode> before = bvh.nodes;
+    std::vector<uint32_t> itemsBefore = bvh.itemIds;
+    BVHRefit(bvh, bounds.data());
+    bool topology = bvh.nodes.size() == before.size() && bvh.itemIds == itemsBefore;
+    for (size_t n = 0; topology && n < before.size(); ++n)
+        topology &= bvh.nodes[n].first == before[n].first && bvh.nodes[n].count == before[n].count;
+    TEST_CHECK(topology);
+    TEST_CHECK(ValidTree(bvh, bounds.data(), ids));
+    same = true;
+    for (const Frustum &frustum : views)
+        same &= CullTree(bvh, frustum, bounds.data()) == CullEveryBox(frustum, bounds.data(), ids);
+    TEST_CHECK(same);
+
+    // degenerate inputs: nothing, one box, and boxes all in the same place (no SAH split exists, the range gets halved)
+    BVH empty;
+    BVHBuild(empty, bounds.data(), nullptr, 0);
+    TEST_CHECK(empty.nodes.empty() && CullTree(empty, views[0], bounds.data()).empty());
+    uint32_t one = 10;
+    BVH single;
+    BVHBuild(single, bounds.data(), &one, 1);
+    TEST_CHECK(ValidTree(single, bounds.data(), {one}) && single.nodes.size() == 1);
+    std::vector<AABB> stacked(300, AABB{{1.0f, 1.0f, 1.0f}, {2.0f, 2.0f, 2.0f}});
+    std::vector<uint32_t> stackedIds(stacked.size());
+    for (uint32_t id = 0; id < stackedIds.size(); ++id)
+        stackedIds[id] = id;
+    BVH pile;
+    BVHBuild(pile, stacked.data(), stackedIds.data(), (uint32_t)stackedIds.size());
+    TEST_CHECK(ValidTree(pile, stacked.data(), stackedIds));
+    TEST_CHECK(CullTree(pile, ViewFrustum(1.05f, {1.5f, 1.5f, -10.0f}, 0.0f), stacked.data()).size() == stacked.size());
+
+    // a full output buffer stops the cull at maxOut, every id written is a visible one
+    std::vector<uint32_t> expected = CullEveryBox(views[1], bounds.data(), ids);
+    std::vector<uint32_t> partial(expected.size());
+    int half = (int)expected.size() / 2;
+    int written = BVHCullFrustum(bvh, views[1], bounds.data(), partial.data(), half, nullptr);
+    bool allVisible = written == half;
+    for (int k = 0; k < written; ++k)
+        allVisible &= std::binary_search(expected.begin(), expected.end(), partial[k]);
+    TEST_CHECK(half > 0 && allVisible);
+
+    // the benchmark: 100k boxes, build and refit, then culling from three views against testing every box
+    const int count = 100000;
+    bounds = RandomBoxes(count, 1);
+    ids.resize(count);
+    for (uint32_t id = 0; id < (uint32_t)count; ++id)
+        ids[id] = id;
+    double start = TestNowMs();
+    BVHBuild(bvh, bounds.data(), ids.data(), count);
+    double buildMs = TestNowMs() - start;
+    std::vector<double> refitTimes;
+    for (int run = 0; run < 20; ++run)
+    {
+        start = TestNowMs();
+        BVHRefit(bvh, bounds.data());
+        refitTimes.push_back(TestNowMs() - start);
+    }
+    printf("  %d boxes, %zu nodes, build %.1f ms, refit %.2f ms\n", count, bvh.nodes.size(), buildMs, MedianMs(refitTimes));
+
+    struct View
+    {
+        const char *name;
+        float fov;
+        DirectX::XMFLOAT3 eye;
+    } benchViews[] = {
+        {"60 deg from the middle", 1.05f, {0.0f, 2.0f, 0.0f}},
+        {"10 deg from the middle", 0.17f, {0.0f, 2.0f, 0.0f}},
+        {"60 deg from outside", 1.05f, {0.0f, 20.0f, -400.0f}},
+    };
+    printf("  view                     visible   nodes visited      BVH   every box\n");
+    same = true;
+    int narrowVisited = 0;
+    for (const View &view : benchViews)
+    {
+        Frustum frustum = ViewFrustum(view.fov, view.eye, 0.0f);
+        std::vector<uint32_t> out(count), every;
+        std::vector<double> treeTimes, everyTimes;
+        int visited = 0, visible = 0;
+        for (int run = 0; run < 50; ++run)
+        {
+            start = TestNowMs();
+            visible = BVHCullFrustum(bvh, frustum, bounds.data(), out.data(), count, &visited);
+            double culled = TestNowMs();
+            every = CullEveryBox(frustum, bounds.data(), ids);
+            treeTimes.push_back(culled - start);
+            everyTimes.push_back(TestNowMs() - culled);
+        }
+        out.resize(visible);
+        std::sort(out.begin(), out.end());
+        same &= out == every;
+        if (view.fov < 0.5f)
+            narrowVisited = visited;
+        printf("  %-24s %7d   %13d   %.2f ms   %.2f ms\n", view.name, visible, visited, MedianMs(treeTimes), MedianMs(everyTimes));
+    }
+    TEST_CHECK(same);
+    TEST_CHECK(narrowVisited * 10 < (int)bvh.nodes.size()); // a narrow view walks a small part of the tree
+
+    // the narrow view as the scene gets denser: the nodes walked follow what's visible, not the whole scene
+    printf("  10 deg view by scene size: boxes, visible, nodes visited of total\n");
+    for (int n = 12500; n <= count; n *= 2)
+    {
+        std::vector<AABB> scaled = RandomBoxes(n, 1);
+        std::vector<uint32_t> scaledIds(ids.begin(), ids.begin() + n);
+        BVH scaledTree;
+        BVHBuild(scaledTree, scaled.data(), scaledIds.data(), n);
+        int visited = 0;
+        size_t visible = CullTree(scaledTree, ViewFrustum(0.17f, {0.0f, 2.0f, 0.0f}, 0.0f), scaled.data(), &visited).size();
+        printf("  %7d %7zu %7d / %zu\n", n, visible, visited, scaledTree.nodes.size());
+    }
+
+    return TestFinish("bvh");
+}
@@ -0,0 +1,160 @@
+#include "test.h"
+
+#include "descriptor_allocator.h"
+
+// the bindless slot allocator (descriptor_allocator.h): first fit and merging on a small table, frees rejected when
+// they overlap free slots, deferred frees held until their fence, the transient slices, then random allocations and
+// frees (immediate and fenced) against a shadow map of who owns each slot with the free list checked after every step
+
+static bool FreeListIs(const DescriptorAllocator &a, std::initializer_list<DescriptorRange> expected)
+{
+    if (a.freeRanges.size() != expected.size())
+        return false;
+    size_t r = 0;
+    for (const DescriptorRange &range : expected)
+    {
+        if (a.freeRanges[r].first != range.first || a.freeRanges[r].count != range.count)
+            return false;
+        r++;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    // first fit, then frees merging with the free range before, after and on both sides
+    DescriptorAllocator a;
+    DescriptorAllocatorInit(a, 64, 8, 3);
+    TEST_CHECK(DescriptorAlloc(a, 8) == 0 && DescriptorAlloc(a, 8) == 8 && DescriptorAlloc(a, 8) == 16);
+    TEST_CHECK(FreeListIs(a, {{24, 40}}) && a.used == 24);
+    TEST_CHECK(DescriptorFree(a, 8, 8));
+    TEST_CHECK(FreeListIs(a, {{8, 8}, {24, 40}}));
+    TEST_CHECK(DescriptorAlloc(a, 4) == 8); // the first range big enough
+    TEST_CHECK(DescriptorAlloc(a, 6) == 24);
+    TEST_CHECK(FreeListIs(a, {{12, 4}, {30, 34}}));
+    TEST_CHECK(DescriptorFree(a, 8, 4)); // merges with the next
+    TEST_CHECK(FreeListIs(a, {{8, 8}, {30, 34}}));
+    TEST_CHECK(DescriptorFree(a, 24, 6)); // with the next
+    TEST_CHECK(DescriptorFree(a, 16, 8)); // with both
+    TEST_CHECK(FreeListIs(a, {{8, 56}}));
+    TEST_CHECK(DescriptorFree(a, 0, 8)); // with the next, from the front
+    TEST_CHECK(FreeListIs(a, {{0, 64}}) && a.used == 0 && a.highWater == 26);
+    TEST_CHECK(DescriptorAllocatorValidate(a));
+
+    // double frees, partly overlapping frees and ranges outside the persistent slots change nothing
+    TEST_CHECK(DescriptorAlloc(a, 16) == 0);
+    TEST_CHECK(DescriptorFree(a, 4, 4));
+    TEST_CHECK(!DescriptorFree(a, 4, 4));
+    TEST_CHECK(!DescriptorFree(a, 2, 4));   // overlaps the free one at its end
+    TEST_CHECK(!DescriptorFree(a, 6, 4));   // and at its start
+    TEST_CHECK(!DescriptorFree(a, 14, 4));  // runs into the free space after slot 16
+    TEST_CHECK(!DescriptorFree(a, 60, 8));  // past the persistent slots
+    TEST_CHECK(!DescriptorFree(a, 64, 1));  // a transient slot
+    TEST_CHECK(!DescriptorFree(a, 0, 0));
+    TEST_CHECK(FreeListIs(a, {{4, 4}, {16, 48}}) && a.used == 12 && DescriptorAllocatorValidate(a));
+    int failed = a.failed;
+    TEST_CHECK(DescriptorAlloc(a, 49) == DESCRIPTOR_INVALID && a.failed == failed + 1);
+    TEST_CHECK(DescriptorAlloc(a, 48) == 16 && DescriptorLargestFree(a) == 4);
+
+    // deferred: held until the fence passes, handed back to the caller when retired
+    DescriptorAllocatorInit(a, 64, 8, 3);
+    TEST_CHECK(DescriptorAlloc(a, 64) == 0);
+    DescriptorFreeDeferred(a, 0, 8, 5);
+    DescriptorFreeDeferred(a, 8, 8, 6);
+    std::vector<DescriptorRange> retired;
+    TEST_CHECK(DescriptorRetire(a, 4, &retired) == 0 && retired.empty() && a.used == 64);
+    TEST_CHECK(DescriptorAlloc(a, 1) == DESCRIPTOR_INVALID);
+    TEST_CHECK(DescriptorRetire(a, 5, &retired) == 1 && retired.size() == 1 && retired[0].first == 0 && a.pending.size() == 1);
+    TEST_CHECK(DescriptorRetire(a, 9, &retired) == 1 && retired.size() == 2 && retired[1].first == 8 && a.pending.empty());
+    TEST_CHECK(FreeListIs(a, {{0, 16}}) && a.used == 48);
+    // a deferred free of a range that's already free is dropped when it retires
+    DescriptorFreeDeferred(a, 0, 4, 10);
+    TEST_CHECK(DescriptorRetire(a, 10) == 0 && FreeListIs(a, {{0, 16}}) && DescriptorAllocatorValidate(a));
+
+    // transient: one slice per frame index after the persistent slots, reset when the index comes round again
+    const uint32_t persistent = 1024, perFrame = 16, frames = 3;
+    DescriptorAllocatorInit(a, persistent, perFrame, frames);
+    bool slices = true;
+    for (uint32_t frame = 0; frame < frames * 2; ++frame)
+    {
+        DescriptorBeginFrame(a, frame % frames);
+        uint32_t first = DescriptorAllocTransient(a, perFrame - 1);
+        slices &= first == persistent + (frame % frames) * perFrame;
+        slices &= DescriptorAllocTransient(a, 1) == first + perFrame - 1;
+        slices &= DescriptorAllocTransient(a, 1) == DESCRIPTOR_INVALID;
+    }
+    TEST_CHECK(slices && a.transientHighWater == perFrame && a.used == 0);
+    DescriptorAllocatorInit(a, 16, 0, 0);
+    TEST_CHECK(DescriptorAllocTransient(a, 1) == DESCRIPTOR_INVALID);
+
+    // random: 40% allocations of 1-8 slots, 20% frees, 20% deferred frees, 10% fence steps, 10% retires. owned is
+    // who the test thinks holds each slot, an allocation must never hand out one that's held or still pending
+    DescriptorAllocatorInit(a, persistent, perFrame, frames);
+    std::vector<uint8_t> owned(persistent, 0);
+    std::vector<DescriptorRange> live;
+    uint64_t fence = 1;
+    bool exclusive = true, doubleFree = false, fenced = true, consistent = true;
+    auto take = [&](const DescriptorRange &range, uint8_t value)
+    {
+        for (uint32_t k = range.first; k < range.first + range.count; ++k)
+        {
+            exclusive &= owned[k] != value;
+            owned[k] = value;
+        }
+    };
+    TestRandom random = {22};
+    for (int step = 0; step < 100000; ++step)
+    {
+        uint32_t op = TestRand(random) % 10;
+        if (op < 4)
+        {
+            DescriptorRange range = {0, 1 + TestRand(random) % 8};
+            range.first = DescriptorAlloc(a, range.count);
+            if (range.first != DESCRIPTOR_INVALID)
+            {
+                take(range, 1);
+                live.push_back(range);
+            }
+        }
+        else if (op < 8 && !live.empty())
+        {
+            size_t pick = TestRand(random) % live.size();
+            DescriptorRange range = live[pick];
+            live[pick] = live.back();
+            live.pop_back();
+            if (op < 6)
+            {
+                take(range, 0);
+                doubleFree |= !DescriptorFree(a, range.first, range.count) || DescriptorFree(a, range.first, range.count);
+            }
+            else
+            {
+                DescriptorFreeDeferred(a, range.first, range.count, fence);
+            }
+        }
+        else if (op == 8)
+        {
+            fence++;
+        }
+        else if (op == 9)
+        {
+            retired.clear();
+            DescriptorRetire(a, fence - 1, &retired);
+            for (const DescriptorRange &range : retired)
+                take(range, 0);
+            for (const DescriptorPendingFree &entry : a.pending)
+                fenced &= entry.fenceValue > fence - 1;
+        }
+        consistent &= DescriptorAllocatorValidate(a);
+    }
+    TEST_CHECK(exclusive);
+    TEST_CHECK(!doubleFree);
+    TEST_CHECK(fenced);
+    TEST_CHECK(consistent);
+    printf("  random: %u / %u slots in use at the end (high water %u), %zu free ranges (largest %u), %d allocations failed\n",
+           a.used, persistent, a.highWater, a.freeRanges.size(), DescriptorLargestFree(a), a.failed);
+
+    return TestFinish("descriptor_allocator");
+}
@@ -0,0 +1,163 @@
+#include "test.h"
+
+#include "draw_instancing.h"
+#include "draw_lod.h"
+
+#include <vector>
+
+// InstanceBatchPack as main.cpp uses it for bots: keys are model * DRAW_LOD_MAX_LEVELS + level, each item's matrix
+// carries its original index in m[0][0] so the packed order can be traced back
+
+#define TEST_MODELS 64 // models loaded, any count works
+#define TEST_KEYS (TEST_MODELS * DRAW_LOD_MAX_LEVELS)
+
+struct PackResult
+{
+    std::vector<DirectX::XMFLOAT4X4> packed;
+    std::vector<InstanceBatch> batches;
+};
+
+static PackResult Pack(const std::vector<uint32_t> &keys)
+{
+    int count = (int)keys.size();
+    std::vector<DirectX::XMFLOAT4X4> worlds(count);
+    for (int i = 0; i < count; ++i)
+    {
+        worlds[i] = {};
+        worlds[i].m[0][0] = (float)i;
+    }
+    uint32_t keyCounts[TEST_KEYS];
+    PackResult result;
+    result.packed.resize(count);
+    result.batches.resize(TEST_KEYS);
+    int batchCount = InstanceBatchPack(keys.data(), worlds.data(), count, TEST_KEYS, keyCounts, result.packed.data(), result.batches.data());
+    result.batches.resize(batchCount);
+    return result;
+}
+
+// every batch holds only its key, batches are contiguous and in key order, items keep their input order inside a
+// batch, and the batch counts are the per key (per model and level) counts of the input
+static void CheckPack(const std::vector<uint32_t> &keys, const PackResult &result)
+{
+    uint32_t expected[TEST_KEYS] = {};
+    for (uint32_t key : keys)
+        expected[key]++;
+
+    uint32_t next = 0;
+    bool grouped = true, stable = true, ordered = true;
+    for (size_t b = 0; b < result.batches.size(); ++b)
+    {
+        const InstanceBatch &batch = result.batches[b];
+        TEST_CHECK(batch.first == next);
+        TEST_CHECK(batch.count == expected[batch.key]);
+        ordered &= b == 0 || result.batches[b - 1].key < batch.key;
+        float last = -1.0f;
+        for (uint32_t p = batch.first; p < batch.first + batch.count; ++p)
+        {
+            float index = result.packed[p].m[0][0];
+            grouped &= keys[(size_t)index] == batch.key;
+            stable &= index > last;
+            last = index;
+        }
+        expected[batch.key] = 0; // seen
+        next += batch.count;
+    }
+    TEST_CHECK(grouped);
+    TEST_CHECK(stable);
+    TEST_CHECK(ordered);
+    TEST_CHECK(next == keys.size());
+    for (uint32_t k = 0; k < TEST_KEYS; ++k)
+        TEST_CHECK(expected[k] == 0); // every key present in the input has its batch
+}
+
+static uint32_t Key(uint32_t model, uint32_t level)
+{
+    return model * DRAW_LOD_MAX_LEVELS + level;
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    // empty input, no batches
+    TEST_CHECK(Pack({}).batches.empty());
+
+    // one key, one batch in input order
+    {
+        std::vector<uint32_t> keys(100, Key(5, 2));
+        PackResult result = Pack(keys);
+        TEST_CHECK(result.batches.size() == 1 && result.batches[0].key == Key(5, 2) && result.batches[0].count == 100);
+        CheckPack(keys, result);
+    }
+
+    // the same model at different levels are separate batches, next to each other
+    {
+        std::vector<uint32_t> keys = {Key(3, 1), Key(3, 0), Key(1, 3), Key(3, 1), Key(3, 0), Key(1, 3), Key(3, 3)};
+        PackResult result = Pack(keys);
+        TEST_CHECK(result.batches.size() == 4);
+        if (result.batches.size() == 4)
+        {
+            TEST_CHECK(result.batches[0].key == Key(1, 3) && result.batches[0].count == 2);
+            TEST_CHECK(result.batches[1].key == Key(3, 0) && result.batches[1].count == 2);
+            TEST_CHECK(result.batches[2].key == Key(3, 1) && result.batches[2].count == 2);
+            TEST_CHECK(result.batches[3].key == Key(3, 3) && result.batches[3].count == 1);
+            // Key(3, 1) came in at 0 and 3, in that order
+            TEST_CHECK(result.packed[4].m[0][0] == 0.0f && result.packed[5].m[0][0] == 3.0f);
+        }
+        CheckPack(keys, result);
+    }
+
+    // the first and last key, nothing in between
+    {
+        std::vector<uint32_t> keys = {TEST_KEYS - 1, 0, TEST_KEYS - 1, 0};
+        PackResult result = Pack(keys);
+        TEST_CHECK(result.batches.size() == 2);
+        CheckPack(keys, result);
+    }
+
+    // bots without a model (INSTANCE_BATCH_SKIP, or any key past the models loaded) are left out, the rest pack as usual
+    {
+        std::vector<uint32_t> keys = {INSTANCE_BATCH_SKIP, Key(2, 0), TEST_KEYS, Key(2, 0), INSTANCE_BATCH_SKIP, Key(0, 1)};
+        PackResult result = Pack(keys);
+        TEST_CHECK(result.batches.size() == 2);
+        if (result.batches.size() == 2)
+        {
+            TEST_CHECK(result.batches[0].key == Key(0, 1) && result.batches[0].first == 0 && result.batches[0].count == 1);
+            TEST_CHECK(result.batches[1].key == Key(2, 0) && result.batches[1].first == 1 && result.batches[1].count == 2);
+            TEST_CHECK(result.packed[0].m[0][0] == 5.0f && result.packed[1].m[0][0] == 1.0f && result.packed[2].m[0][0] == 3.0f);
+        }
+        // with no models loaded at all nothing is drawn
+        uint32_t keyCounts[1];
+        DirectX::XMFLOAT4X4 world = {}, packed = {};
+        InstanceBatch batch;
+        TEST_CHECK(InstanceBatchPack(keys.data(), &world, 1, 0, keyCounts, &packed, &batch) == 0);
+    }
+
+    // a bot crowd: a handful of models, levels skewed to the coarse end like a far away crowd
+    {
+        TestRandom random = {13};
+        std::vector<uint32_t> keys(20000);
+        for (uint32_t &key : keys)
+        {
+            uint32_t model = TestRand(random) % 6 * 7; // sparse model indices
+            uint32_t level = TestRand(random) % 8;
+            key = Key(model, level < DRAW_LOD_MAX_LEVELS ? level : DRAW_LOD_MAX_LEVELS - 1);
+        }
+        PackResult result = Pack(keys);
+        TEST_CHECK(result.batches.size() == 6 * DRAW_LOD_MAX_LEVELS);
+        CheckPack(keys, result);
+    }
+
+    // every key used
+    {
+        TestRandom random = {7};
+        std::vector<uint32_t> keys(TEST_KEYS * 3);
+        for (size_t i = 0; i < keys.size(); ++i)
+            keys[i] = i < TEST_KEYS ? (uint32_t)i : TestRand(random) % TEST_KEYS;
+        PackResult result = Pack(keys);
+        TEST_CHECK(result.batches.size() == TEST_KEYS);
+        CheckPack(keys, result);
+    }
+
+    return TestFinish("draw_instancing");
+}
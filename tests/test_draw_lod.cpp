@@ -0,0 +1,115 @@
+#include "test.h"
+
+#include "draw_lod.h"
+
+#include <vector>
+
+// level of detail selection (draw_lod.h) with the thresholds and hysteresis main.cpp starts with: the level for a
+// size, hysteresis holding a level on either side of a threshold, and every result clamped to the levels a mesh has
+
+static const float g_thresholds[DRAW_LOD_MAX_LEVELS - 1] = {0.15f, 0.05f, 0.02f};
+static const float g_hysteresis = 0.15f;
+
+// walks the size from start to end in steps, returns the sizes at which the level changed and the level it ended at
+static std::vector<float> Walk(float start, float end, int steps, int levels, int &level)
+{
+    std::vector<float> changes;
+    for (int s = 0; s <= steps; ++s)
+    {
+        float size = start + (end - start) * (float)s / (float)steps;
+        int next = DrawLodSelect(size, level, g_thresholds, levels, g_hysteresis);
+        if (next != level)
+            changes.push_back(size);
+        level = next;
+    }
+    return changes;
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    // without history: a size below thresholds[k] asks for level k + 1, at the threshold itself it doesn't yet
+    TEST_CHECK(DrawLodLevelFor(1.0f, g_thresholds, 4) == 0);
+    TEST_CHECK(DrawLodLevelFor(0.15f, g_thresholds, 4) == 0);
+    TEST_CHECK(DrawLodLevelFor(0.1499f, g_thresholds, 4) == 1);
+    TEST_CHECK(DrawLodLevelFor(0.05f, g_thresholds, 4) == 1);
+    TEST_CHECK(DrawLodLevelFor(0.0499f, g_thresholds, 4) == 2);
+    TEST_CHECK(DrawLodLevelFor(0.0199f, g_thresholds, 4) == 3);
+    TEST_CHECK(DrawLodLevelFor(0.0f, g_thresholds, 4) == 3);
+    for (float size : {1.0f, 0.1f, 0.03f, 0.001f})
+        TEST_CHECK(DrawLodSelect(size, 0, g_thresholds, 4, 0.0f) == DrawLodLevelFor(size, g_thresholds, 4));
+
+    // clamped to the mesh's levels, whatever the size or the level it had before (a bot can switch to a model with
+    // fewer levels, a primitive has fewer than a model)
+    for (int levels = 1; levels <= DRAW_LOD_MAX_LEVELS; ++levels)
+    {
+        bool clamped = true;
+        for (float size : {10.0f, 0.15f, 0.1f, 0.04f, 0.01f, 0.0f})
+        {
+            clamped &= DrawLodLevelFor(size, g_thresholds, levels) < levels;
+            for (int previous = 0; previous < DRAW_LOD_MAX_LEVELS + 3; ++previous)
+            {
+                int level = DrawLodSelect(size, previous, g_thresholds, levels, g_hysteresis);
+                clamped &= level >= 0 && level < levels;
+            }
+        }
+        TEST_CHECK(clamped);
+    }
+    TEST_CHECK(DrawLodSelect(0.001f, 0, g_thresholds, 1, g_hysteresis) == 0);
+    TEST_CHECK(DrawLodSelect(0.001f, 0, g_thresholds, 2, g_hysteresis) == 1);
+    TEST_CHECK(DrawLodSelect(0.001f, 3, g_thresholds, 2, g_hysteresis) == 1);
+    TEST_CHECK(DrawLodSelect(1.0f, 7, g_thresholds, 4, g_hysteresis) == 0);
+
+    // hysteresis holds the level within 15% of the threshold on either side
+    TEST_CHECK(DrawLodSelect(0.135f, 0, g_thresholds, 4, g_hysteresis) == 0); // below the threshold, still 0
+    TEST_CHECK(DrawLodSelect(0.125f, 0, g_thresholds, 4, g_hysteresis) == 1); // past 0.15 / 1.15
+    TEST_CHECK(DrawLodSelect(0.165f, 1, g_thresholds, 4, g_hysteresis) == 1); // above the threshold, still 1
+    TEST_CHECK(DrawLodSelect(0.18f, 1, g_thresholds, 4, g_hysteresis) == 0);  // past 0.15 / 0.85
+    // but never further than the size asks: a coarser previous level comes back to the finest the size allows
+    TEST_CHECK(DrawLodSelect(0.1f, 3, g_thresholds, 4, g_hysteresis) == 1);
+    TEST_CHECK(DrawLodSelect(0.1f, 0, g_thresholds, 4, g_hysteresis) == 1);
+
+    // walking away and back in steps of 0.00005: each threshold changes the level once per direction, at the first
+    // step past the hysteresis margin on its far side
+    int level = 0;
+    std::vector<float> away = Walk(0.3f, 0.005f, 5900, 4, level);
+    TEST_CHECK(level == 3 && away.size() == 3);
+    for (size_t k = 0; k < away.size() && k < 3; ++k)
+    {
+        float margin = g_thresholds[k] / (1.0f + g_hysteresis);
+        TEST_CHECK(away[k] < margin && away[k] > margin - 1e-4f);
+    }
+    std::vector<float> back = Walk(0.005f, 0.3f, 5900, 4, level);
+    TEST_CHECK(level == 0 && back.size() == 3);
+    for (size_t k = 0; k < back.size() && k < 3; ++k)
+    {
+        float margin = g_thresholds[2 - k] / (1.0f - g_hysteresis);
+        TEST_CHECK(back[k] >= margin - 1e-6f && back[k] < margin + 1e-4f);
+    }
+
+    // jitter right on a threshold doesn't swap meshes, without hysteresis it does every frame
+    for (float hysteresis : {g_hysteresis, 0.0f})
+    {
+        int changes = 0;
+        level = 1;
+        for (int frame = 0; frame < 100; ++frame)
+        {
+            float size = 0.05f * (frame % 2 ? 1.02f : 0.98f);
+            int next = DrawLodSelect(size, level, g_thresholds, 4, hysteresis);
+            changes += next != level;
+            level = next;
+        }
+        TEST_CHECK(hysteresis > 0.0f ? changes == 0 : changes >= 99);
+    }
+
+    // the size: shrinks with distance, grows as the fov narrows, always level 0 from inside the sphere
+    float wide = DrawLodTanHalfFov(60.0f), narrow = DrawLodTanHalfFov(10.0f);
+    TEST_CHECK(fabsf(wide - 0.57735f) < 1e-4f);
+    TEST_CHECK(DrawLodScreenSize(1.0f, 10.0f, wide) > DrawLodScreenSize(1.0f, 20.0f, wide));
+    TEST_CHECK(DrawLodScreenSize(1.0f, 50.0f, narrow) > DrawLodScreenSize(1.0f, 50.0f, wide));
+    TEST_CHECK(DrawLodSelect(DrawLodScreenSize(2.0f, 1.5f, wide), 3, g_thresholds, 4, g_hysteresis) == 0);
+    TEST_CHECK(DrawLodScreenSize(1.0f, 10.0f, 0.0f) > 1e20f);
+
+    return TestFinish("draw_lod");
+}
@@ -0,0 +1,167 @@
+#include "test.h"
+
+#include "gpu_heap_allocator.h"
+
+#include <math.h>
+
+// the buddy suballocator of gpu_heap_allocator.h: splits and merges on a small pool, alignment, frees rejected when
+// they aren't live, the report, then random loads and unloads of mesh and texture sized resources checked against the
+// blocks handed out. the same churn is the fragmentation benchmark: the pool's state at the end and the time per
+// operation are printed
+
+#define MB (1ull << 20)
+
+struct ChurnResult
+{
+    size_t live;
+    GpuHeapReport report;
+    int noRoom; // allocations that found no room with every heap added
+    int operations;
+    double ms;
+    bool valid;
+};
+
+// steps of random allocations (half of them) and frees of a live one, up to maxHeaps heaps of heapSize
+static ChurnResult Churn(uint64_t heapSize, uint32_t maxHeaps, int steps, uint32_t seed, bool check)
+{
+    ChurnResult result = {};
+    GpuHeapPool pool;
+    result.valid = GpuHeapPoolInit(pool, heapSize);
+    std::vector<GpuHeapAllocation> live;
+    TestRandom random = {seed};
+    double start = TestNowMs();
+    for (int step = 0; step < steps; ++step)
+    {
+        if (TestRand(random) % 2)
+        {
+            // mostly small buffers, some textures up to 16 MB, the odd 4 MB aligned one
+            uint64_t size = TestRand(random) % 4 ? 1 + TestRand(random) % (256 << 10) : 1 + TestRand(random) % (16 * MB);
+            uint64_t alignment = TestRand(random) % 16 ? GPU_HEAP_DEFAULT_BLOCK : 4 * MB;
+            GpuHeapAllocation allocation = GpuHeapAlloc(pool, size, alignment);
+            if (allocation.heap == GPU_HEAP_NONE && pool.heaps.size() < maxHeaps)
+            {
+                GpuHeapPoolAddHeap(pool);
+                allocation = GpuHeapAlloc(pool, size, alignment);
+            }
+            result.operations++;
+            if (allocation.heap == GPU_HEAP_NONE)
+            {
+                result.noRoom++;
+                continue;
+            }
+            if (check)
+            {
+                result.valid &= allocation.offset % alignment == 0 && allocation.size >= size && allocation.offset + allocation.size <= heapSize;
+                for (const GpuHeapAllocation &other : live)
+                {
+                    result.valid &= other.heap != allocation.heap || other.offset + other.size <= allocation.offset ||
+                                    allocation.offset + allocation.size <= other.offset;
+                }
+            }
+            live.push_back(allocation);
+        }
+        else if (!live.empty())
+        {
+            size_t pick = TestRand(random) % live.size();
+            GpuHeapAllocation allocation = live[pick];
+            live[pick] = live.back();
+            live.pop_back();
+            result.valid &= GpuHeapFree(pool, allocation);
+            result.operations++;
+            if (check)
+                result.valid &= !GpuHeapFree(pool, allocation);
+        }
+        if (check && step % 64 == 0)
+            result.valid &= GpuHeapPoolValidate(pool);
+    }
+    result.ms = TestNowMs() - start;
+    result.live = live.size();
+    result.report = GpuHeapPoolReport(pool);
+    result.valid &= GpuHeapPoolValidate(pool);
+
+    // everything back: every heap empty and whole again
+    for (const GpuHeapAllocation &allocation : live)
+        result.valid &= GpuHeapFree(pool, allocation);
+    GpuHeapReport empty = GpuHeapPoolReport(pool);
+    result.valid &= GpuHeapPoolValidate(pool) && empty.emptyHeaps == empty.heaps && empty.largestFree == heapSize;
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    // heap sizes: minBlock times a power of two only
+    GpuHeapPool pool;
+    TEST_CHECK(!GpuHeapPoolInit(pool, 48 * MB));
+    TEST_CHECK(!GpuHeapPoolInit(pool, 64 * MB, 3000));
+    TEST_CHECK(!GpuHeapPoolInit(pool, (uint64_t)GPU_HEAP_DEFAULT_BLOCK << GPU_HEAP_MAX_ORDERS));
+    TEST_CHECK(GpuHeapPoolInit(pool, 64 * MB) && pool.orders == 11);
+
+    // the block for a size and alignment: the larger of the two, rounded up to a power of two
+    TEST_CHECK(GpuHeapOrderFor(pool, 1, GPU_HEAP_DEFAULT_BLOCK) == 0);
+    TEST_CHECK(GpuHeapOrderFor(pool, 65537, GPU_HEAP_DEFAULT_BLOCK) == 1);
+    TEST_CHECK(GpuHeapOrderFor(pool, 1, 4 * MB) == 6);
+    TEST_CHECK(GpuHeapOrderFor(pool, 64 * MB, GPU_HEAP_DEFAULT_BLOCK) == 10);
+    TEST_CHECK(GpuHeapOrderFor(pool, 64 * MB + 1, GPU_HEAP_DEFAULT_BLOCK) == -1);
+
+    // a 1 MB heap of 64 KB blocks: splits hand out the lowest block, frees merge back up with their buddies
+    TEST_CHECK(GpuHeapPoolInit(pool, MB));
+    TEST_CHECK(GpuHeapAlloc(pool, 100, GPU_HEAP_DEFAULT_BLOCK).heap == GPU_HEAP_NONE && pool.failed == 1); // no heap yet
+    TEST_CHECK(GpuHeapPoolAddHeap(pool) == 0);
+    GpuHeapAllocation a = GpuHeapAlloc(pool, 100, GPU_HEAP_DEFAULT_BLOCK);
+    GpuHeapAllocation b = GpuHeapAlloc(pool, 200000, GPU_HEAP_DEFAULT_BLOCK); // 256 KB block
+    GpuHeapAllocation c = GpuHeapAlloc(pool, 100, GPU_HEAP_DEFAULT_BLOCK);
+    TEST_CHECK(a.heap == 0 && a.offset == 0 && a.size == 65536 && a.requested == 100);
+    TEST_CHECK(b.offset == 256 << 10 && b.size == 256 << 10);
+    TEST_CHECK(c.offset == 65536); // a's buddy
+    TEST_CHECK(pool.used == 384 << 10 && pool.requested == 200200 && pool.allocations == 3 && GpuHeapPoolValidate(pool));
+    GpuHeapAllocation d = GpuHeapAlloc(pool, 1, 512 << 10); // aligned to 512 KB: the upper half
+    TEST_CHECK(d.offset == 512 << 10 && d.size == 512 << 10);
+    TEST_CHECK(GpuHeapAlloc(pool, 1, GPU_HEAP_DEFAULT_BLOCK).offset == 128 << 10);
+    TEST_CHECK(GpuHeapAlloc(pool, 65537, GPU_HEAP_DEFAULT_BLOCK).heap == GPU_HEAP_NONE); // 64 KB left, not 128
+
+    // frees: only live allocations, exactly as handed out
+    GpuHeapAllocation wrongSize = a;
+    wrongSize.size = 128 << 10;
+    GpuHeapAllocation wrongHeap = a;
+    wrongHeap.heap = 1;
+    GpuHeapAllocation unaligned = a;
+    unaligned.offset = 4096;
+    TEST_CHECK(!GpuHeapFree(pool, wrongSize) && !GpuHeapFree(pool, wrongHeap) && !GpuHeapFree(pool, unaligned));
+    TEST_CHECK(GpuHeapFree(pool, a) && !GpuHeapFree(pool, a));
+    TEST_CHECK(GpuHeapFree(pool, c)); // merges with a into 128 KB
+    GpuHeapReport report = GpuHeapPoolReport(pool);
+    TEST_CHECK(report.free == 192 << 10 && report.largestFree == 128 << 10 && report.freeBlocks == 2);
+    TEST_CHECK(fabsf(report.fragmentation - 1.0f / 3.0f) < 1e-4f); // 64 of the 192 KB free aren't in the largest block
+    TEST_CHECK(GpuHeapPoolValidate(pool));
+
+    // a second heap takes what the first has no room for, the report counts both
+    TEST_CHECK(GpuHeapAlloc(pool, 512 << 10, GPU_HEAP_DEFAULT_BLOCK).heap == GPU_HEAP_NONE);
+    TEST_CHECK(GpuHeapPoolAddHeap(pool) == 1);
+    GpuHeapAllocation e = GpuHeapAlloc(pool, 512 << 10, GPU_HEAP_DEFAULT_BLOCK);
+    TEST_CHECK(e.heap == 1 && e.offset == 0);
+    report = GpuHeapPoolReport(pool);
+    TEST_CHECK(report.heaps == 2 && report.emptyHeaps == 0 && report.capacity == 2 * MB && report.heapsIfCompacted == 2);
+    TEST_CHECK(GpuHeapFree(pool, e));
+    report = GpuHeapPoolReport(pool);
+    TEST_CHECK(report.emptyHeaps == 1 && report.heapsIfCompacted == 1 && report.largestFree == MB);
+
+    // random churn in 64 MB heaps, every block checked against the others and the pool validated as it goes
+    ChurnResult checked = Churn(64 * MB, 8, 50000, 23, true);
+    TEST_CHECK(checked.valid);
+
+    // the benchmark: the same churn, longer and without the checks, at two heap sizes
+    for (uint64_t heapSize : {64 * MB, 256 * MB})
+    {
+        ChurnResult bench = Churn(heapSize, (uint32_t)(512 * MB / heapSize), 400000, 23, false);
+        TEST_CHECK(bench.valid);
+        printf("  %3llu MB heaps: %zu live, %u heaps (%u if compacted), %.0f%% rounding, %.0f%% of the free space fragmented, "
+               "%d allocations found no room, %.3f us per operation\n",
+               (unsigned long long)(heapSize / MB), bench.live, bench.report.heaps, bench.report.heapsIfCompacted,
+               bench.report.rounding * 100.0f, bench.report.fragmentation * 100.0f, bench.noRoom,
+               bench.ms * 1000.0 / bench.operations);
+    }
+
+    return TestFinish("gpu_heap_allocator");
+}
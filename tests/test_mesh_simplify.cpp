@@ -0,0 +1,189 @@
+#include "test.h"
+
+#include "mesh_simplify.h"
+
+// the vertex clustering of mesh_simplify.h on meshes laid out like the renderer's Vertex (position, normal, uv, 8
+// floats): every level it makes indexes the source vertices, has no degenerate or repeated triangles, keeps the
+// winding of all but a few folded triangles and has fewer triangles than the source, the coarser the fewer
+
+#define STRIDE 8
+
+struct TestMesh
+{
+    std::vector<float> vertices;
+    std::vector<uint32_t> indices;
+    uint32_t VertexCount() const { return (uint32_t)(vertices.size() / STRIDE); }
+};
+
+static void AddVertex(TestMesh &mesh, float x, float y, float z, float nx, float ny, float nz)
+{
+    float v[STRIDE] = {x, y, z, nx, ny, nz, 0.0f, 0.0f};
+    mesh.vertices.insert(mesh.vertices.end(), v, v + STRIDE);
+}
+
+// radius 0.5 around the origin, clockwise seen from outside like the renderer's meshes, one vertex per pole
+static TestMesh Sphere(int slices, int stacks)
+{
+    TestMesh mesh;
+    AddVertex(mesh, 0.0f, -0.5f, 0.0f, 0.0f, -1.0f, 0.0f);
+    for (int i = 1; i < stacks; ++i)
+    {
+        for (int j = 0; j <= slices; ++j)
+        {
+            float phi = (1.0f - (float)i / stacks) * 3.14159265f, theta = (float)j / slices * 6.2831853f;
+            float x = sinf(phi) * cosf(theta), y = cosf(phi), z = sinf(phi) * sinf(theta);
+            AddVertex(mesh, x * 0.5f, y * 0.5f, z * 0.5f, x, y, z);
+        }
+    }
+    AddVertex(mesh, 0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f);
+    uint32_t top = mesh.VertexCount() - 1;
+    for (int i = 0; i < stacks; ++i)
+    {
+        for (int j = 0; j < slices; ++j)
+        {
+            // ring i - 1 starts at 1 + (i - 1) * (slices + 1)
+            uint32_t c = 1 + i * (slices + 1) + j, d = c + 1;
+            uint32_t a = c - (slices + 1), b = a + 1;
+            if (i == 0)
+                mesh.indices.insert(mesh.indices.end(), {0, c, d});
+            else if (i == stacks - 1)
+                mesh.indices.insert(mesh.indices.end(), {a, top, b});
+            else
+                mesh.indices.insert(mesh.indices.end(), {a, d, b, a, c, d});
+        }
+    }
+    return mesh;
+}
+
+// a flat n x n grid at y = 0 facing up and the same grid 0.001 under it facing down, a leaf or a sheet of cloth
+static TestMesh Shell(int n)
+{
+    TestMesh mesh;
+    for (int side = 0; side < 2; ++side)
+    {
+        uint32_t base = mesh.VertexCount();
+        for (int j = 0; j <= n; ++j)
+        {
+            for (int i = 0; i <= n; ++i)
+                AddVertex(mesh, (float)i / n, side ? -0.001f : 0.0f, (float)j / n, 0.0f, side ? -1.0f : 1.0f, 0.0f);
+        }
+        for (int j = 0; j < n; ++j)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                uint32_t bl = base + j * (n + 1) + i, br = bl + 1, tl = bl + n + 1, tr = tl + 1;
+                uint32_t up[6] = {bl, tl, br, br, tl, tr}, down[6] = {bl, br, tl, br, tr, tl};
+                mesh.indices.insert(mesh.indices.end(), side ? down : up, (side ? down : up) + 6);
+            }
+        }
+    }
+    return mesh;
+}
+
+// cosine between the triangle's winding normal and direction, 0 for a degenerate triangle
+static float Facing(const TestMesh &mesh, const uint32_t *triangle, const float direction[3])
+{
+    const float *a = &mesh.vertices[triangle[0] * STRIDE], *b = &mesh.vertices[triangle[1] * STRIDE], *c = &mesh.vertices[triangle[2] * STRIDE];
+    float e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]}, e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    float n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+    float lengths = sqrtf((n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) *
+                          (direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]));
+    return lengths > 1e-12f ? (n[0] * direction[0] + n[1] * direction[1] + n[2] * direction[2]) / lengths : 0.0f;
+}
+
+// what every level must be. facingSign is the sign Facing has against the vertex normals on the source. clustering
+// can fold a triangle over where a cell cuts a curve at a slant, so a few may face away, but only a few
+static void CheckLevel(const TestMesh &mesh, const std::vector<uint32_t> &out, uint32_t triangles, float facingSign)
+{
+    TEST_CHECK(out.size() == (size_t)triangles * 3);
+    bool valid = true, distinct = true;
+    uint32_t away = 0;
+    std::vector<uint64_t> seen;
+    for (size_t t = 0; t + 2 < out.size(); t += 3)
+    {
+        uint32_t a = out[t], b = out[t + 1], c = out[t + 2];
+        valid &= a < mesh.VertexCount() && b < mesh.VertexCount() && c < mesh.VertexCount() && a != b && b != c && a != c;
+        if (!valid)
+            break;
+        // rotated so the smallest leads, the same triangle can't appear twice
+        uint32_t low = a < b ? (a < c ? a : c) : (b < c ? b : c);
+        uint32_t r[3] = {a, b, c};
+        int first = low == a ? 0 : (low == b ? 1 : 2);
+        seen.push_back(((uint64_t)r[first] << 42) | ((uint64_t)r[(first + 1) % 3] << 21) | r[(first + 2) % 3]);
+        float normal[3] = {0.0f, 0.0f, 0.0f};
+        for (uint32_t v : r)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+                normal[axis] += mesh.vertices[v * STRIDE + 3 + axis];
+        }
+        away += Facing(mesh, &out[t], normal) * facingSign < -0.01f;
+    }
+    std::sort(seen.begin(), seen.end());
+    distinct = std::adjacent_find(seen.begin(), seen.end()) == seen.end();
+    TEST_CHECK(valid);
+    TEST_CHECK(distinct);
+    TEST_CHECK(away * 50 <= triangles);
+}
+
+// levels with cells along the longest side, as kModelLodGridCells in renderer_dx12.cpp, each coarser than the last
+static void CheckLevels(const TestMesh &mesh, float extent, std::initializer_list<int> levelCells, const char *name)
+{
+    std::vector<uint32_t> out;
+    uint32_t source = (uint32_t)mesh.indices.size() / 3;
+    float facingSum = 0.0f;
+    for (size_t t = 0; t < mesh.indices.size(); t += 3)
+        facingSum += Facing(mesh, &mesh.indices[t], &mesh.vertices[mesh.indices[t] * STRIDE + 3]);
+    float facingSign = facingSum >= 0.0f ? 1.0f : -1.0f;
+
+    // no cell size is a copy
+    TEST_CHECK(MeshSimplifyCluster(&mesh.vertices[0], &mesh.vertices[3], STRIDE, mesh.VertexCount(), mesh.indices.data(),
+                                   (uint32_t)mesh.indices.size(), 0.0f, out) == source);
+    TEST_CHECK(out == mesh.indices);
+    CheckLevel(mesh, out, source, facingSign);
+
+    uint32_t previous = source;
+    std::string counts;
+    for (int cells : levelCells)
+    {
+        uint32_t triangles = MeshSimplifyCluster(&mesh.vertices[0], &mesh.vertices[3], STRIDE, mesh.VertexCount(), mesh.indices.data(),
+                                                 (uint32_t)mesh.indices.size(), extent / cells, out);
+        CheckLevel(mesh, out, triangles, facingSign);
+        TEST_CHECK(triangles > 0 && triangles < previous);
+        previous = triangles;
+        counts += ", " + std::to_string(cells) + " cells " + std::to_string(triangles);
+    }
+    printf("  %s: %u triangles%s\n", name, source, counts.c_str());
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    CheckLevels(Sphere(128, 64), 1.0f, {48, 16, 4}, "sphere");
+    CheckLevels(Sphere(24, 12), 1.0f, {16, 8}, "small sphere"); // 48 cells are finer than its own triangles
+
+    // a shell thinner than a cell keeps both sides: the two faces cluster apart by their normals
+    TestMesh shell = Shell(100);
+    CheckLevels(shell, 1.0f, {48, 16, 4}, "shell");
+    std::vector<uint32_t> out;
+    MeshSimplifyCluster(&shell.vertices[0], &shell.vertices[3], STRIDE, shell.VertexCount(), shell.indices.data(),
+                        (uint32_t)shell.indices.size(), 1.0f / 4, out);
+    int up = 0, down = 0;
+    for (uint32_t index : out)
+    {
+        up += shell.vertices[index * STRIDE + 4] > 0.0f;
+        down += shell.vertices[index * STRIDE + 4] < 0.0f;
+    }
+    TEST_CHECK(up > 0 && down > 0 && up + down == (int)out.size());
+
+    // the triangles of different faces never share a vertex: no cluster mixes up and down
+    bool sided = true;
+    for (size_t t = 0; t < out.size(); t += 3)
+    {
+        float ny = shell.vertices[out[t] * STRIDE + 4];
+        sided &= shell.vertices[out[t + 1] * STRIDE + 4] == ny && shell.vertices[out[t + 2] * STRIDE + 4] == ny;
+    }
+    TEST_CHECK(sided);
+
+    return TestFinish("mesh_simplify");
+}
@@ -0,0 +1,159 @@
+#include "test.h"
+
+#include "occlusion_raster.h"
+
+// the software occlusion buffer (occlusion_raster.h) on a fixed scene: a ground grid wound like the terrain proxy,
+// a wall, a pillar and two boxes with a slit between them rasterized from a fixed camera, then a grid of small boxes
+// tested against it. the per box results and a coarse map of the covered pixels are checked against
+// tests/golden/occlusion_raster.txt, a few hand picked cases spell out why
+
+using namespace DirectX;
+
+static AABB Box(float cx, float cy, float cz, float hx, float hy, float hz)
+{
+    return {{cx - hx, cy - hy, cz - hz}, {cx + hx, cy + hy, cz + hz}};
+}
+
+static XMFLOAT4X4 World(float x, float y, float z)
+{
+    XMFLOAT4X4 world;
+    XMStoreFloat4x4(&world, XMMatrixTranslation(x, y, z));
+    return world;
+}
+
+// eye at (0, 2, -5) looking down +z, reverse-Z with the planes swapped like UpdateViewProjMatrices
+static XMMATRIX TestViewProj()
+{
+    return XMMatrixMultiply(XMMatrixTranslation(0.0f, -2.0f, 5.0f), XMMatrixPerspectiveFovLH(1.0f, 2.0f, 1000.0f, 0.1f));
+}
+
+static void Rasterize(OcclusionBuffer &ob, bool reverseBands)
+{
+    for (int b = 0; b < OCCLUSION_BANDS; ++b)
+        OcclusionRasterizeBand(ob, reverseBands ? OCCLUSION_BANDS - 1 - b : b);
+    for (int b = 0; b < OCCLUSION_BANDS; ++b)
+        OcclusionErodeBand(ob, reverseBands ? OCCLUSION_BANDS - 1 - b : b);
+}
+
+// returns the triangles kept
+static int AddScene(OcclusionBuffer &ob)
+{
+    // ground at y = 0 over x [-40, 40], z [0, 80], same winding as BuildTerrainOccluder (front faces up)
+    const int n = 8;
+    std::vector<XMFLOAT3> positions;
+    std::vector<uint32_t> indices;
+    for (int j = 0; j <= n; ++j)
+    {
+        for (int i = 0; i <= n; ++i)
+            positions.push_back({-40.0f + 80.0f * i / n, 0.0f, 80.0f * j / n});
+    }
+    for (int j = 0; j < n; ++j)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            uint32_t bl = j * (n + 1) + i, br = bl + 1, tl = bl + n + 1, tr = tl + 1;
+            for (uint32_t index : {bl, tl, br, br, tl, tr})
+                indices.push_back(index);
+        }
+    }
+    int kept = OcclusionAddMesh(ob, World(0, 0, 0), positions.data(), (int)positions.size(), indices.data(), (int)indices.size());
+
+    kept += OcclusionAddBox(ob, World(0, 2, 15), Box(0, 0, 0, 6, 2, 0.5f));     // the wall
+    kept += OcclusionAddBox(ob, World(-12, 3, 25), Box(0, 0, 0, 1, 3, 1));      // the pillar
+    kept += OcclusionAddBox(ob, World(9, 2, 20), Box(0, 0, 0, 1.5f, 2, 0.5f));  // two boxes 0.1 apart, under
+    kept += OcclusionAddBox(ob, World(12.1f, 2, 20), Box(0, 0, 0, 1.5f, 2, 0.5f)); // a pixel there
+    return kept;
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    OcclusionBuffer ob;
+    OcclusionBegin(ob, TestViewProj());
+    int kept = AddScene(ob);
+    Rasterize(ob, false);
+
+    // eroding only ever moves depth farther
+    bool eroded = true;
+    for (int i = 0; i < OCCLUSION_WIDTH * OCCLUSION_HEIGHT; ++i)
+        eroded &= ob.depth[i] <= ob.rasterized[i];
+    TEST_CHECK(eroded);
+
+    // the bands are independent, any order gives the same buffer
+    OcclusionBuffer reversed;
+    OcclusionBegin(reversed, TestViewProj());
+    AddScene(reversed);
+    Rasterize(reversed, true);
+    TEST_CHECK(reversed.depth == ob.depth && reversed.rasterized == ob.rasterized);
+
+    // why, for a few of them
+    TEST_CHECK(!OcclusionTestAABB(ob, Box(0, 2, 20, 0.5f, 0.5f, 0.5f)));     // straight behind the wall
+    TEST_CHECK(!OcclusionTestAABB(ob, Box(4, 2, 40, 0.5f, 0.5f, 0.5f)));     // behind it, inside its edge
+    TEST_CHECK(OcclusionTestAABB(ob, Box(0, 2, 10, 0.5f, 0.5f, 0.5f)));      // in front of it
+    TEST_CHECK(OcclusionTestAABB(ob, Box(0, 2, 15, 0.5f, 0.5f, 0.5f)));      // inside it
+    TEST_CHECK(!OcclusionTestAABB(ob, Box(7, 2, 25, 0.5f, 0.5f, 0.5f)));     // past its edge, but farther away
+    TEST_CHECK(OcclusionTestAABB(ob, Box(-9, 2, 20, 0.5f, 0.5f, 0.5f)));     // peeking past its edge
+    TEST_CHECK(OcclusionTestAABB(ob, Box(0, 6, 30, 0.5f, 0.5f, 0.5f)));      // peeking over it
+    TEST_CHECK(OcclusionTestAABB(ob, Box(0, 2, 40, 20, 0.5f, 0.5f)));        // wider than it
+    TEST_CHECK(!OcclusionTestAABB(ob, Box(10.55f, 2, 40, 0.5f, 0.5f, 0.5f))); // behind the slit
+    TEST_CHECK(!OcclusionTestAABB(ob, Box(20, -2, 30, 0.5f, 0.5f, 0.5f)));   // under the ground
+    TEST_CHECK(OcclusionTestAABB(ob, Box(0, 2, -4.95f, 0.5f, 0.5f, 0.5f)));  // around the eye, reaches the near plane
+    TEST_CHECK(OcclusionTestAABB(ob, Box(0, 2, -20, 0.5f, 0.5f, 0.5f)));     // behind the eye
+    TEST_CHECK(OcclusionTestAABB(ob, Box(200, 2, 20, 0.5f, 0.5f, 0.5f)));    // off screen
+    TEST_CHECK(!OcclusionTestAABB(ob, Box(0, 2, 900, 30, 30, 30)));          // far and large, still behind the ground
+
+    // back faces are dropped: from inside a box nothing of it is drawn, the ground from below is nothing either
+    OcclusionBuffer other;
+    OcclusionBegin(other, TestViewProj());
+    TEST_CHECK(OcclusionAddBox(other, World(0, 2, -5), Box(0, 0, 0, 5, 5, 5)) == 0);
+    XMFLOAT3 ceiling[4] = {{-50, 4, 1}, {50, 4, 1}, {-50, 4, 100}, {50, 4, 100}};
+    uint32_t quad[6] = {0, 2, 1, 1, 2, 3};
+    TEST_CHECK(OcclusionAddMesh(other, World(0, 0, 0), ceiling, 4, quad, 6) == 0);
+    XMFLOAT3 floor[4] = {{-50, 0, 1}, {50, 0, 1}, {-50, 0, 100}, {50, 0, 100}};
+    TEST_CHECK(OcclusionAddMesh(other, World(0, 0, 0), floor, 4, quad, 6) == 2);
+    // a triangle reaching behind the eye is dropped whole
+    XMFLOAT3 nearQuad[4] = {{-50, 0, -10}, {50, 0, -10}, {-50, 0, 100}, {50, 0, 100}};
+    TEST_CHECK(OcclusionAddMesh(other, World(0, 0, 0), nearQuad, 4, quad, 6) == 0);
+
+    // the golden: the triangles kept (back facing and off screen ones dropped), every box of a grid in front of, among
+    // and behind the occluders, standing on the ground and buried under it, then the covered pixels, one character per
+    // 4x4 pixels ('#' all covered, '+' some, '.' none)
+    std::string golden;
+    char line[128];
+    snprintf(line, sizeof(line), "%d occluder triangles kept\n", kept);
+    golden += line;
+    int visible = 0, boxes = 0;
+    for (float y : {0.5f, -1.5f})
+    {
+        for (float z : {10.0f, 20.0f, 30.0f, 50.0f})
+        {
+            snprintf(line, sizeof(line), "y %4.1f z %2.0f: ", y, z);
+            golden += line;
+            for (float x = -16.0f; x <= 16.0f; x += 2.0f)
+            {
+                bool v = OcclusionTestAABB(ob, Box(x, y, z, 0.5f, 0.5f, 0.5f));
+                golden += v ? 'o' : '-';
+                visible += v;
+                boxes++;
+            }
+            golden += '\n';
+        }
+    }
+    snprintf(line, sizeof(line), "%d of %d boxes visible\n", visible, boxes);
+    golden += line;
+    for (int y = 0; y < OCCLUSION_HEIGHT; y += 4)
+    {
+        for (int x = 0; x < OCCLUSION_WIDTH; x += 4)
+        {
+            int covered = 0;
+            for (int k = 0; k < 16; ++k)
+                covered += ob.depth[(y + k / 4) * OCCLUSION_WIDTH + x + k % 4] > 0.0f;
+            golden += covered == 16 ? '#' : (covered > 0 ? '+' : '.');
+        }
+        golden += '\n';
+    }
+    TestGolden("occlusion_raster.txt", golden);
+
+    return TestFinish("occlusion_raster");
+}
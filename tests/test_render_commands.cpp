@@ -0,0 +1,192 @@
+#include "test.h"
+
+#include "render_commands.h"
+
+// the chunk planner of render_commands.h (recording workers, one command list per chunk): where it cuts, what each
+// chunk restores, barrier runs submitted whole across chunks and draws resolving in stream order
+
+// a frame like the scene pass records: barriers, target and clear, draws with a pipeline change every 16 and a mesh
+// change every 4, the resolve between two barrier batches, the overlay and the final barriers. each draw's constants
+// carry its index, so the order draws resolve in can be checked
+static void BuildStream(RenderCommandStream &stream, int draws, bool indirect)
+{
+    RenderCommandsReset(stream);
+    RenderCommandPush(stream, RCMD_BARRIER, RENDER_TARGET_BACK_BUFFER, RENDER_STATE_PRESENT, RENDER_STATE_RESOLVE_DEST);
+    RenderCommandPush(stream, RCMD_SET_TARGET, RENDER_TARGET_MSAA, 1);
+    RenderCommandPush(stream, RCMD_CLEAR, RENDER_TARGET_MSAA);
+    stream.drawsBegin = (uint32_t)stream.commands.size();
+    if (indirect)
+    {
+        for (int d = 0; d < draws; ++d)
+        {
+            IndirectDrawRecord record = {};
+            record.mesh = (uint32_t)(d / 4);
+            record.constants[0] = (uint32_t)d;
+            record.draw.indexCountPerInstance = 36;
+            record.draw.instanceCount = 1;
+            stream.indirect.records.push_back(record);
+        }
+        for (int first = 0; first < draws; first += 16)
+        {
+            RenderCommandPush(stream, RCMD_SET_PIPELINE, (uint32_t)(first / 16), 0);
+            RenderCommandPush(stream, RCMD_EXECUTE_INDIRECT, (uint32_t)first, (uint32_t)(draws - first < 16 ? draws - first : 16));
+        }
+    }
+    else
+    {
+        for (int d = 0; d < draws; ++d)
+        {
+            if (d % 16 == 0)
+                RenderCommandPush(stream, RCMD_SET_PIPELINE, (uint32_t)(d / 16), 0);
+            if (d % 4 == 0)
+                RenderCommandPush(stream, RCMD_SET_MESH, (uint32_t)(d / 4));
+            uint32_t constants[2] = {(uint32_t)d, 7};
+            CmdSetConstants(stream, constants, sizeof(constants));
+            RenderCommandPush(stream, RCMD_DRAW_INDEXED, 36, 1);
+        }
+    }
+    stream.drawsEnd = (uint32_t)stream.commands.size();
+    RenderCommandPush(stream, RCMD_BARRIER, RENDER_TARGET_MSAA, RENDER_STATE_RENDER_TARGET, RENDER_STATE_RESOLVE_SOURCE);
+    RenderCommandPush(stream, RCMD_RESOLVE, RENDER_TARGET_BACK_BUFFER, RENDER_TARGET_MSAA);
+    RenderCommandPush(stream, RCMD_BARRIER, RENDER_TARGET_BACK_BUFFER, RENDER_STATE_RESOLVE_DEST, RENDER_STATE_RENDER_TARGET);
+    RenderCommandPush(stream, RCMD_SET_TARGET, RENDER_TARGET_BACK_BUFFER, 0);
+    RenderCommandPush(stream, RCMD_OVERLAY);
+    RenderCommandPush(stream, RCMD_BARRIER, RENDER_TARGET_BACK_BUFFER, RENDER_STATE_RENDER_TARGET, RENDER_STATE_PRESENT);
+    RenderCommandPush(stream, RCMD_BARRIER, RENDER_TARGET_MSAA, RENDER_STATE_RESOLVE_SOURCE, RENDER_STATE_RENDER_TARGET);
+}
+
+// what the planner splits by: draw commands, an ExecuteIndirect counts as one whatever its record count
+static int CountDraws(const RenderCommandStream &stream, uint32_t begin, uint32_t end)
+{
+    int draws = 0;
+    for (uint32_t k = begin; k < end; ++k)
+        draws += RenderCommandIsDraw(stream.commands[k].type);
+    return draws;
+}
+
+// the barrier batches a backend submits playing the chunks back the way ExecuteRenderCommands does: the stream
+// indices of each run, one ResourceBarrier call per run
+static std::vector<std::vector<uint32_t>> PlayBarrierBatches(const RenderCommandStream &stream, const RenderCommandChunk *chunks,
+                                                             int chunkCount)
+{
+    std::vector<std::vector<uint32_t>> batches;
+    std::vector<uint32_t> pending;
+    for (int c = 0; c < chunkCount; ++c)
+    {
+        const RenderCommandChunk &chunk = chunks[c];
+        for (int r = -chunk.restoreCount; r < (int)(chunk.end - chunk.begin); ++r)
+        {
+            uint32_t k = RenderCommandChunkAt(chunk, r);
+            if (stream.commands[k].type != RCMD_BARRIER)
+                continue;
+            pending.push_back(k);
+            if (RenderCommandsRunEnds(stream, chunk, r, RCMD_BARRIER))
+            {
+                batches.push_back(pending);
+                pending.clear();
+            }
+        }
+        TEST_CHECK(pending.empty()); // nothing carried into the next command list
+    }
+    return batches;
+}
+
+static void CheckChunks(const RenderCommandStream &stream, const RenderCommandChunk *chunks, int chunkCount, int minDraws)
+{
+    int draws = CountDraws(stream, stream.drawsBegin, stream.drawsEnd);
+    TEST_CHECK(chunks[0].begin == 0 && chunks[chunkCount - 1].end == stream.commands.size());
+    for (int c = 0; c < chunkCount; ++c)
+    {
+        const RenderCommandChunk &chunk = chunks[c];
+        if (c > 0)
+        {
+            // cut right after a draw inside the draw list range, never in front of the first draw
+            TEST_CHECK(chunk.begin == chunks[c - 1].end);
+            TEST_CHECK(chunk.begin > stream.drawsBegin && chunk.begin <= stream.drawsEnd);
+            TEST_CHECK(RenderCommandIsDraw(stream.commands[chunk.begin - 1].type));
+        }
+        TEST_CHECK(CountDraws(stream, chunk.begin, chunk.end) >= minDraws);
+        // evenly split, up to a draw of rounding
+        TEST_CHECK(CountDraws(stream, chunk.begin, chunk.end) <= draws / chunkCount + 1);
+
+        // restores the last target, pipeline and mesh set before the chunk, in that order
+        uint32_t expected[3] = {UINT32_MAX, UINT32_MAX, UINT32_MAX};
+        for (uint32_t k = 0; k < chunk.begin; ++k)
+        {
+            RenderCommandType type = stream.commands[k].type;
+            int slot = type == RCMD_SET_TARGET ? 0 : (type == RCMD_SET_PIPELINE ? 1 : (type == RCMD_SET_MESH ? 2 : -1));
+            if (slot >= 0)
+                expected[slot] = k;
+        }
+        int restoreCount = 0;
+        bool restoreMatch = true;
+        for (uint32_t k : expected)
+        {
+            if (k != UINT32_MAX)
+                restoreMatch &= restoreCount < chunk.restoreCount && chunk.restore[restoreCount++] == k;
+        }
+        TEST_CHECK(c == 0 ? chunk.restoreCount == 0 : (restoreMatch && restoreCount == chunk.restoreCount));
+    }
+    TEST_CHECK(RenderCommandsChunksMatch(stream, chunks, chunkCount));
+
+    // every barrier run goes out whole, exactly as in a single command list
+    RenderCommandChunk whole = {0, (uint32_t)stream.commands.size(), {}, 0};
+    TEST_CHECK(PlayBarrierBatches(stream, chunks, chunkCount) == PlayBarrierBatches(stream, &whole, 1));
+
+    // draws resolve in stream order with the constants they were recorded with
+    std::vector<RenderResolvedDraw> resolved;
+    RenderCommandsResolveDraws(stream, chunks, chunkCount, resolved);
+    TEST_CHECK(resolved.size() == (stream.indirect.records.empty() ? (size_t)draws : stream.indirect.records.size()));
+    bool ordered = true;
+    for (size_t d = 0; d < resolved.size(); ++d)
+    {
+        ordered &= resolved[d].pipeline == d / 16 && resolved[d].mesh == d / 4 && resolved[d].target == RENDER_TARGET_MSAA;
+    }
+    TEST_CHECK(ordered);
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    RenderCommandChunk chunks[8];
+    RenderCommandStream stream;
+    for (bool indirect : {false, true})
+    {
+        // 1000 draws, or 63 ExecuteIndirects of up to 16 records
+        BuildStream(stream, 1000, indirect);
+        int unit = indirect ? 1 : 16;
+
+        // the split counts: as many chunks as the draws allow, capped by the workers
+        TEST_CHECK(RenderCommandsPlanChunks(stream, 8, 6 * unit, chunks) == 8);
+        CheckChunks(stream, chunks, 8, 6 * unit);
+        TEST_CHECK(RenderCommandsPlanChunks(stream, 8, 20 * unit, chunks) == 3);
+        CheckChunks(stream, chunks, 3, 20 * unit);
+        TEST_CHECK(RenderCommandsPlanChunks(stream, 8, 100 * unit, chunks) == 1);
+        CheckChunks(stream, chunks, 1, 0);
+        TEST_CHECK(RenderCommandsPlanChunks(stream, 1, 0, chunks) == 1);
+        TEST_CHECK(chunks[0].begin == 0 && chunks[0].end == stream.commands.size() && chunks[0].restoreCount == 0);
+        TEST_CHECK(RenderCommandsPlanChunks(stream, 5, 0, chunks) == 5);
+        CheckChunks(stream, chunks, 5, 0);
+    }
+
+    // no draws at all, one chunk for everything
+    BuildStream(stream, 0, false);
+    TEST_CHECK(RenderCommandsPlanChunks(stream, 8, 0, chunks) == 1);
+    CheckChunks(stream, chunks, 1, 0);
+
+    // a run straddling the restore commands and the range is played as the backend sees it, restores first: a barrier
+    // restored in front of a pipeline ends its run there, one at the end of the restores joins the range's first run
+    BuildStream(stream, 32, false);
+    uint32_t firstBarrier = 0, pipeline = stream.drawsBegin;
+    // (the range starts at the barrier after the resolve, two commands after another barrier)
+    RenderCommandChunk chunk = {stream.drawsEnd + 2, (uint32_t)stream.commands.size(), {firstBarrier, pipeline, firstBarrier}, 3};
+    TEST_CHECK(RenderCommandsRunEnds(stream, chunk, -3, RCMD_BARRIER));  // followed by the pipeline
+    TEST_CHECK(!RenderCommandsRunEnds(stream, chunk, -1, RCMD_BARRIER)); // followed by the range's first barrier
+    TEST_CHECK(RenderCommandsRunEnds(stream, chunk, 0, RCMD_BARRIER));   // followed by the target
+    TEST_CHECK(RenderCommandsRunEnds(stream, chunk, (int)(chunk.end - chunk.begin) - 1, RCMD_BARRIER)); // the chunk's last
+    std::vector<std::vector<uint32_t>> batches = PlayBarrierBatches(stream, &chunk, 1);
+    TEST_CHECK(batches.size() == 3 && batches[0].size() == 1 && batches[1].size() == 2 && batches[2].size() == 2);
+
+    return TestFinish("render_commands");
+}
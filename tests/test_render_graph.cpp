@@ -0,0 +1,118 @@
+#include "test.h"
+
+#include "scene_commands.h"
+
+// the render graph (render_graph.h) compiling the scene's graph (SceneBuildGraph) with and without msaa against the
+// barriers the frame needs, written out by hand, plus culling, the compile failures and what a failed compile leaves
+// behind. the recorded stream has to carry each batch as one run of barriers
+
+static const uint32_t BB = RENDER_TARGET_BACK_BUFFER, MS = RENDER_TARGET_MSAA;
+static const uint32_t PRESENT = RENDER_STATE_PRESENT, RT = RENDER_STATE_RENDER_TARGET;
+static const uint32_t SOURCE = RENDER_STATE_RESOLVE_SOURCE, DEST = RENDER_STATE_RESOLVE_DEST;
+
+// every batch of a graph that didn't compile is empty and nothing is live, whatever the compile before it left
+static bool NothingCompiled(const RenderGraph &graph)
+{
+    bool empty = graph.barriers.empty() && graph.culled == 0 && graph.batches == 0;
+    for (int p = 0; p < RENDER_GRAPH_MAX_PASSES; ++p)
+        empty &= !graph.live[p];
+    for (int p = 0; p <= graph.passCount; ++p)
+        empty &= RenderGraphBatchIs(graph, p, nullptr, 0);
+    return empty;
+}
+
+// the barrier runs a backend submits for the stream, one ResourceBarrier call each
+static int BarrierRuns(const RenderCommandStream &stream)
+{
+    int runs = 0;
+    for (size_t k = 0; k < stream.commands.size(); ++k)
+        runs += stream.commands[k].type == RCMD_BARRIER && (k == 0 || stream.commands[k - 1].type != RCMD_BARRIER);
+    return runs;
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    const RenderGraphBarrier toTarget[] = {{BB, PRESENT, RT}};
+    const RenderGraphBarrier toPresent[] = {{BB, RT, PRESENT}};
+    const RenderGraphBarrier toResolve[] = {{MS, RT, SOURCE}, {BB, PRESENT, DEST}};
+    const RenderGraphBarrier afterResolve[] = {{BB, DEST, RT}};
+    const RenderGraphBarrier msaaEnd[] = {{BB, RT, PRESENT}, {MS, SOURCE, RT}};
+
+    // draws to the back buffer, then the overlay: in and out of PRESENT only
+    RenderGraph graph;
+    SceneBuildGraph(graph, false);
+    TEST_CHECK(RenderGraphCompile(graph) && graph.culled == 0 && graph.batches == 2);
+    TEST_CHECK(RenderGraphBatchIs(graph, 0, toTarget, 1));
+    TEST_CHECK(RenderGraphBatchIs(graph, 1, nullptr, 0));
+    TEST_CHECK(RenderGraphBatchIs(graph, 2, toPresent, 1));
+
+    // draws to the msaa target, the resolve, the overlay: both resolve transitions in one batch, the msaa target back
+    // to a render target with the back buffer's PRESENT at the end
+    SceneBuildGraph(graph, true);
+    TEST_CHECK(RenderGraphCompile(graph) && graph.culled == 0 && graph.batches == 3);
+    TEST_CHECK(RenderGraphBatchIs(graph, 0, nullptr, 0));
+    TEST_CHECK(RenderGraphBatchIs(graph, 1, toResolve, 2));
+    TEST_CHECK(RenderGraphBatchIs(graph, 2, afterResolve, 1));
+    TEST_CHECK(RenderGraphBatchIs(graph, 3, msaaEnd, 2));
+
+    // a clear of the msaa target after the resolve, nothing reads it: culled, the barriers don't change
+    int unused = RenderGraphAddPass(graph, SCENE_PASS_DRAWS);
+    RenderGraphUse(graph, unused, MS, RT, RENDER_ACCESS_WRITE | RENDER_ACCESS_DISCARD);
+    TEST_CHECK(RenderGraphCompile(graph) && graph.culled == 1 && !graph.live[unused]);
+    TEST_CHECK(RenderGraphBatchIs(graph, 1, toResolve, 2) && RenderGraphBatchIs(graph, 2, afterResolve, 1));
+    TEST_CHECK(RenderGraphBatchIs(graph, unused, nullptr, 0) && RenderGraphBatchIs(graph, graph.passCount, msaaEnd, 2));
+    // unless it has side effects
+    graph.passes[unused].sideEffects = true;
+    TEST_CHECK(RenderGraphCompile(graph) && graph.culled == 0 && graph.live[unused]);
+
+    // the draws without msaa, but the overlay discards the back buffer: nothing needs the draws any more
+    SceneBuildGraph(graph, false);
+    graph.passes[1].accesses[0].flags |= RENDER_ACCESS_DISCARD;
+    TEST_CHECK(RenderGraphCompile(graph) && graph.culled == 1 && !graph.live[0] && graph.live[1]);
+    TEST_CHECK(RenderGraphBatchIs(graph, 0, nullptr, 0) && RenderGraphBatchIs(graph, 1, toTarget, 1));
+
+    // failures in the first pass: a target that wasn't imported, a state that doesn't exist, the same target twice.
+    // each after a good compile of the msaa graph, whose live passes and batches must not survive
+    for (int failure = 0; failure < 3; ++failure)
+    {
+        SceneBuildGraph(graph, true);
+        TEST_CHECK(RenderGraphCompile(graph));
+        SceneBuildGraph(graph, failure != 0);
+        if (failure == 0)
+            RenderGraphUse(graph, 0, MS, RT, RENDER_ACCESS_READ);
+        else if (failure == 1)
+            RenderGraphUse(graph, 0, BB, RENDER_STATE_COUNT, RENDER_ACCESS_READ);
+        else
+            RenderGraphUse(graph, 0, MS, SOURCE, RENDER_ACCESS_READ);
+        TEST_CHECK(!RenderGraphCompile(graph));
+        TEST_CHECK(NothingCompiled(graph));
+        RenderCommandStream stream;
+        for (int p = 0; p <= graph.passCount; ++p)
+            RenderGraphPushBarriers(graph, p, stream);
+        TEST_CHECK(stream.commands.empty());
+    }
+
+    // recorded (an empty draw list is enough for the barriers): each batch one run, nothing else
+    std::vector<DirectX::XMFLOAT4X4> worlds;
+    std::vector<IndirectDrawInput> indirectInputs;
+    SceneDrawList list = {};
+    list.blendCount = 1;
+    list.meshLodStride = 1;
+    SceneDrawFrame frame = {};
+    frame.worlds = &worlds;
+    frame.indirectInputs = &indirectInputs;
+    for (bool msaa : {false, true})
+    {
+        SceneBuildGraph(graph, msaa);
+        TEST_CHECK(RenderGraphCompile(graph));
+        RenderCommandStream stream;
+        SceneRecordCommands(stream, graph, msaa, list, false, frame);
+        TEST_CHECK(BarrierRuns(stream) == graph.batches);
+        TEST_CHECK(stream.counts[RCMD_BARRIER] == (int)graph.barriers.size());
+        TEST_CHECK(stream.commands.back().type == RCMD_BARRIER);
+    }
+
+    return TestFinish("render_graph");
+}
@@ -0,0 +1,334 @@
+#include "test.h"
+
+#include "scene_commands.h"
+
+#include "draw_sort.h"
+
+// the null backend: a fixed scene recorded by scene_commands.h (what PopulateCommandList records) without a device,
+// with and without msaa and indirect draws. the dumps of a small scene are checked against
+// tests/golden/scene_commands.txt, a large one is recorded repeatedly for the per frame recording cost
+
+// the ids main.cpp uses: RenderPipeline, BlendMode, DRAW_PIPELINE_WIREFRAME, DRAW_MESH_*, ObjectType
+enum
+{
+    PIPELINE_DEFAULT,
+    PIPELINE_TRIPLANAR,
+    PIPELINE_HEIGHTFIELD,
+    PIPELINE_SKY,
+    PIPELINE_LOADED_MODEL,
+    PIPELINE_WIREFRAME,
+};
+#define BLENDS 2 // opaque, alpha
+#define MESH_CUBE 0
+#define MESH_SPHERE 1
+#define MESH_CYLINDER 2
+#define MESH_HEIGHTFIELD 5
+#define MESH_FIRST_MODEL 6
+#define MESH_MODELS 4
+#define MESH_LOD_STRIDE (MESH_FIRST_MODEL + MESH_MODELS)
+#define MESH_LEVELS 4 // DRAW_LOD_MAX_LEVELS
+#define OBJECT_TYPE_PRIMITIVE 0
+#define OBJECT_TYPE_HEIGHTFIELD 1
+#define OBJECT_TYPE_LOADED_MODEL 2
+#define OBJECT_TYPE_SKY 3
+
+// the draw list as FillDrawList leaves it, in submission order
+struct TestScene
+{
+    std::vector<uint32_t> slots, pipelineIds, meshIds, textures, instanceCount, instanceFirst;
+    std::vector<DirectX::XMFLOAT4X4> world;
+    std::vector<uint8_t> objectTypes;
+    std::vector<DirectX::XMFLOAT4X4> instanceWorlds; // the instanced draws' matrices, what the frame starts with
+    std::vector<IndirectMeshViews> meshes;
+    DirectX::XMFLOAT4X4 cylinder;
+};
+
+static DirectX::XMFLOAT4X4 TestWorld(float x, float y, float z)
+{
+    DirectX::XMFLOAT4X4 world;
+    DirectX::XMStoreFloat4x4(&world, DirectX::XMMatrixTranspose(DirectX::XMMatrixTranslation(x, y, z)));
+    return world;
+}
+
+static void AddDraw(TestScene &scene, uint8_t objectType, uint32_t pipeline, uint32_t blend, uint32_t mesh, uint32_t texture,
+                    uint32_t instances = 0)
+{
+    uint32_t slot = (uint32_t)scene.slots.size();
+    scene.slots.push_back(slot);
+    scene.pipelineIds.push_back(pipeline * BLENDS + blend);
+    scene.meshIds.push_back(mesh);
+    scene.textures.push_back(texture);
+    scene.objectTypes.push_back(objectType);
+    scene.world.push_back(TestWorld((float)slot, 0.0f, (float)(slot % 7)));
+    scene.instanceCount.push_back(instances);
+    scene.instanceFirst.push_back((uint32_t)scene.instanceWorlds.size());
+    for (uint32_t i = 0; i < instances; ++i)
+        scene.instanceWorlds.push_back(TestWorld((float)i, 1.0f, (float)slot));
+}
+
+// primitives have 3 levels, the heightfield 1, model m has m + 1. ids past that get no mesh (index count 0), like
+// FillIndirectMeshTable leaves them
+static void FillMeshes(TestScene &scene)
+{
+    scene.meshes.assign(MESH_LOD_STRIDE * MESH_LEVELS, IndirectMeshViews{});
+    for (uint32_t id = 0; id < scene.meshes.size(); ++id)
+    {
+        uint32_t mesh = id % MESH_LOD_STRIDE, level = id / MESH_LOD_STRIDE;
+        uint32_t levels = mesh == MESH_HEIGHTFIELD ? 1 : (mesh >= MESH_FIRST_MODEL ? mesh - MESH_FIRST_MODEL + 1 : 3);
+        if (mesh == 3 || mesh == 4 || level >= levels)
+            continue;
+        IndirectMeshViews &views = scene.meshes[id];
+        views.vertexView = {0x10000ull * (mesh + 1), 32 * 1000, 32};
+        views.indexView = {0x10000ull * (mesh + 1) + 0x8000 + level * 0x1000, 4 * 1000, 42};
+        views.indexCount = (3000 + 300 * mesh) >> level;
+    }
+}
+
+// the shape of a frame in the game: heightfield first, the static objects (some instanced batches), the bots as one
+// instanced draw per model and level, the sky last and alpha blended
+static void BuildScene(TestScene &scene, int staticCount, int batchSize)
+{
+    scene = TestScene();
+    FillMeshes(scene);
+    AddDraw(scene, OBJECT_TYPE_HEIGHTFIELD, PIPELINE_HEIGHTFIELD, 0, MESH_HEIGHTFIELD, 1);
+    for (int i = 0; i < staticCount; ++i)
+    {
+        uint32_t mesh = (uint32_t)(i / 3 % 3) + (uint32_t)(i % 5 == 4) * MESH_LOD_STRIDE; // runs sharing a mesh
+        uint32_t pipeline = i < staticCount / 2 ? PIPELINE_DEFAULT : PIPELINE_TRIPLANAR;
+        bool batched = batchSize > 1 && i % 11 == 0;
+        AddDraw(scene, OBJECT_TYPE_PRIMITIVE, pipeline, 0, mesh, (uint32_t)(i % 4), batched ? (uint32_t)batchSize : 0);
+    }
+    for (uint32_t model = 0; model < MESH_MODELS; ++model)
+    {
+        for (uint32_t level = 0; level <= model; ++level)
+            AddDraw(scene, OBJECT_TYPE_LOADED_MODEL, PIPELINE_LOADED_MODEL, 0, MESH_FIRST_MODEL + model + level * MESH_LOD_STRIDE,
+                    8 + model, 3 + level);
+    }
+    AddDraw(scene, OBJECT_TYPE_SKY, PIPELINE_SKY, 1, MESH_SPHERE, 12);
+    scene.cylinder = TestWorld(0.0f, 1.0f, -5.0f);
+}
+
+// the editor's stress scene (AddBenchmarkObjects in main.cpp) in FillDrawList's order: objects random cubes, spheres
+// and cylinders over 512 x 512, a quarter of them triplanar, the level of detail by distance from a camera at the
+// centre, between the heightfield and the bots
+static void BuildStressScene(TestScene &scene, int objectCount)
+{
+    scene = TestScene();
+    FillMeshes(scene);
+    AddDraw(scene, OBJECT_TYPE_HEIGHTFIELD, PIPELINE_HEIGHTFIELD, 0, MESH_HEIGHTFIELD, 1);
+    TestRandom random = {12};
+    for (int i = 0; i < objectCount; ++i)
+    {
+        float x = (float)(TestRand(random) % 512) - 256.0f, z = (float)(TestRand(random) % 512) - 256.0f;
+        float distance = sqrtf(x * x + z * z);
+        uint32_t level = distance < 60.0f ? 0 : distance < 150.0f ? 1 : 2;
+        uint32_t mesh = TestRand(random) % 3 + level * MESH_LOD_STRIDE;
+        uint32_t pipeline = TestRand(random) % 4 ? PIPELINE_DEFAULT : PIPELINE_TRIPLANAR;
+        AddDraw(scene, OBJECT_TYPE_PRIMITIVE, pipeline, 0, mesh, 0);
+        scene.world.back() = TestWorld(x, (float)(TestRand(random) % 40), z);
+    }
+    for (uint32_t model = 0; model < MESH_MODELS; ++model)
+    {
+        for (uint32_t level = 0; level <= model; ++level)
+            AddDraw(scene, OBJECT_TYPE_LOADED_MODEL, PIPELINE_LOADED_MODEL, 0, MESH_FIRST_MODEL + model + level * MESH_LOD_STRIDE,
+                    8 + model, 1024 / MESH_MODELS / (model + 1));
+    }
+    AddDraw(scene, OBJECT_TYPE_SKY, PIPELINE_SKY, 1, MESH_SPHERE, 12);
+}
+
+// the submit order FillDrawList's sort gives: state keys with the view depth, radix sorted
+static void SortDraws(TestScene &scene)
+{
+    int count = (int)scene.slots.size();
+    std::vector<uint64_t> keys(count), tmpKeys(count);
+    std::vector<uint32_t> tmpSlots(count);
+    for (int k = 0; k < count; ++k)
+    {
+        uint32_t slot = scene.slots[k];
+        uint32_t blend = scene.pipelineIds[slot] % BLENDS;
+        uint64_t state = DrawKeyState(blend ? DRAW_PASS_ALPHA : DRAW_PASS_OPAQUE, scene.pipelineIds[slot] / BLENDS, blend,
+                                      scene.meshIds[slot], scene.textures[slot]);
+        const DirectX::XMFLOAT4X4 &world = scene.world[slot]; // transposed, the translation is the last column
+        keys[k] = DrawKeyWithDepth(state, world.m[0][3] * world.m[0][3] + world.m[1][3] * world.m[1][3] + world.m[2][3] * world.m[2][3]);
+    }
+    DrawSortRadix(keys.data(), scene.slots.data(), tmpKeys.data(), tmpSlots.data(), count);
+}
+
+static SceneDrawList SceneList(const TestScene &scene, bool debugDraw)
+{
+    SceneDrawList list = {};
+    list.submitSlots = scene.slots.data();
+    list.submitCount = (int)scene.slots.size();
+    list.pipelineIds = scene.pipelineIds.data();
+    list.meshIds = scene.meshIds.data();
+    list.textureArrayIndices = scene.textures.data();
+    list.instanceCount = scene.instanceCount.data();
+    list.instanceFirst = scene.instanceFirst.data();
+    list.world = scene.world.data();
+    list.objectTypes = scene.objectTypes.data();
+    list.loadedModelType = OBJECT_TYPE_LOADED_MODEL;
+    list.blendCount = BLENDS;
+    list.meshes = scene.meshes.data();
+    list.meshCount = (uint32_t)scene.meshes.size();
+    list.meshLodStride = MESH_LOD_STRIDE;
+    if (debugDraw)
+    {
+        list.debugWorld = &scene.cylinder;
+        list.debugPipelineId = PIPELINE_WIREFRAME * BLENDS;
+        list.debugMesh = MESH_CYLINDER;
+    }
+    return list;
+}
+
+struct Recording
+{
+    RenderGraph graph;
+    RenderCommandStream stream;
+    std::vector<DirectX::XMFLOAT4X4> worlds;
+    std::vector<IndirectDrawInput> indirectInputs;
+    SceneDrawFrame frame;
+};
+
+static void Record(Recording &recording, const TestScene &scene, bool msaa, bool indirect, bool debugDraw)
+{
+    SceneBuildGraph(recording.graph, msaa);
+    TEST_CHECK(RenderGraphCompile(recording.graph));
+    if (recording.worlds.size() < scene.instanceWorlds.size())
+        recording.worlds.resize(scene.instanceWorlds.size());
+    if (!scene.instanceWorlds.empty())
+        memcpy(recording.worlds.data(), scene.instanceWorlds.data(), scene.instanceWorlds.size() * sizeof(DirectX::XMFLOAT4X4));
+    recording.frame = {};
+    recording.frame.worlds = &recording.worlds;
+    recording.frame.worldCount = (int)scene.instanceWorlds.size();
+    recording.frame.indirectInputs = &recording.indirectInputs;
+    SceneRecordCommands(recording.stream, recording.graph, msaa, SceneList(scene, debugDraw), indirect, recording.frame);
+}
+
+static std::string StreamText(const RenderCommandStream &stream)
+{
+    std::string text;
+    FILE *file = tmpfile();
+    if (!TEST_CHECK(file != nullptr))
+        return text;
+    RenderCommandsWrite(stream, file);
+    rewind(file);
+    char buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        text.append(buffer, n);
+    fclose(file);
+    return text;
+}
+
+// what any recording has to hold whatever the golden file says: every draw list entry drawn once with its own mesh
+// and constants, binds only where they change, a matrix per plain draw after the instanced ones
+static void CheckRecording(const Recording &recording, const TestScene &scene, bool indirect, bool debugDraw)
+{
+    const RenderCommandStream &stream = recording.stream;
+    const SceneDrawFrame &frame = recording.frame;
+    int plain = 0;
+    for (uint32_t count : scene.instanceCount)
+        plain += count == 0;
+    TEST_CHECK(frame.worldCount == (int)scene.instanceWorlds.size() + plain + debugDraw);
+    TEST_CHECK(frame.draws == (int)scene.slots.size());
+
+    RenderCommandChunk whole = {0, (uint32_t)stream.commands.size(), {}, 0};
+    std::vector<RenderResolvedDraw> draws;
+    RenderCommandsResolveDraws(stream, &whole, 1, draws);
+    int skipped = 0; // entries whose mesh id has no mesh, the indirect path leaves those out
+    for (uint32_t mesh : scene.meshIds)
+        skipped += scene.meshes[mesh].indexCount == 0;
+    TEST_CHECK(draws.size() == scene.slots.size() - (indirect ? skipped : 0) + debugDraw);
+
+    uint32_t lastPipeline = UINT32_MAX, lastMesh = UINT32_MAX;
+    bool redundant = false;
+    for (uint32_t k = stream.drawsBegin; k < stream.drawsEnd; ++k)
+    {
+        const RenderCommand &command = stream.commands[k];
+        if (command.type == RCMD_SET_PIPELINE)
+        {
+            redundant |= command.a * BLENDS + command.b == lastPipeline;
+            lastPipeline = command.a * BLENDS + command.b;
+        }
+        if (command.type == RCMD_SET_MESH)
+        {
+            redundant |= command.a == lastMesh;
+            lastMesh = command.a;
+        }
+    }
+    TEST_CHECK(!redundant);
+
+    // the plain draws' matrices in submission order right after the instanced ones
+    bool worldsMatch = true;
+    int next = (int)scene.instanceWorlds.size();
+    for (uint32_t slot : scene.slots)
+    {
+        if (scene.instanceCount[slot] == 0)
+            worldsMatch &= memcmp(&(*frame.worlds)[next++], &scene.world[slot], sizeof(DirectX::XMFLOAT4X4)) == 0;
+    }
+    TEST_CHECK(worldsMatch);
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    TestScene scene;
+    BuildScene(scene, 24, 3);
+    std::string golden;
+    Recording recording;
+    for (int variant = 0; variant < 4; ++variant)
+    {
+        bool msaa = variant & 1, indirect = variant & 2;
+        Record(recording, scene, msaa, indirect, true);
+        CheckRecording(recording, scene, indirect, true);
+        char header[128];
+        snprintf(header, sizeof(header), "## msaa %d, indirect %d, %d world matrices, %d api calls (%d naive)\n", msaa, indirect,
+                 recording.frame.worldCount, recording.frame.apiCalls, recording.frame.naiveCalls);
+        golden += header + StreamText(recording.stream);
+    }
+    TestGolden("scene_commands.txt", golden);
+
+    // without the debug draw, nothing after the draw list range but the end of the frame
+    Record(recording, scene, false, false, false);
+    CheckRecording(recording, scene, false, false);
+
+    // what sorting saves on the stress scene: the same 10000 objects recorded in draw list order and in sort order,
+    // API calls against binding everything per draw
+    BuildStressScene(scene, 10000);
+    Record(recording, scene, false, false, false);
+    CheckRecording(recording, scene, false, false);
+    SceneDrawFrame unsorted = recording.frame;
+    SortDraws(scene);
+    Record(recording, scene, false, false, false);
+    CheckRecording(recording, scene, false, false);
+    SceneDrawFrame sorted = recording.frame;
+    TEST_CHECK(sorted.draws == unsorted.draws && sorted.triangles == unsorted.triangles && sorted.naiveCalls == unsorted.naiveCalls);
+    TEST_CHECK(sorted.apiCalls < unsorted.apiCalls && unsorted.apiCalls < unsorted.naiveCalls);
+    const char *orders[2] = {"unsorted", "sorted"};
+    for (int order = 0; order < 2; ++order)
+    {
+        const SceneDrawFrame &frame = order ? sorted : unsorted;
+        printf("  stress scene %s: %d draws, %d api calls (%d pipeline and %d mesh binds), %d binding everything, %.0f%% saved\n",
+               orders[order], frame.draws, frame.apiCalls, frame.pipelineBinds, frame.meshBinds,
+               frame.naiveCalls, 100.0 * (frame.naiveCalls - frame.apiCalls) / frame.naiveCalls);
+    }
+
+    // the recording cost of a big frame: 20000 static draws, every 11th an instanced batch of 8
+    BuildScene(scene, 20000, 8);
+    const int frames = 200;
+    for (int indirect = 0; indirect < 2; ++indirect)
+    {
+        Record(recording, scene, true, indirect, true); // warm up, the vectors reach their size
+        CheckRecording(recording, scene, indirect, true);
+        double start = TestNowMs();
+        for (int f = 0; f < frames; ++f)
+            Record(recording, scene, true, indirect, true);
+        double ms = (TestNowMs() - start) / frames;
+        printf("  %d draws %s: %.3f ms per frame, %zu commands, %zu indirect records, hash %08x\n", (int)scene.slots.size(),
+               indirect ? "indirect" : "direct", ms, recording.stream.commands.size(), recording.stream.indirect.records.size(),
+               RenderCommandsHash(recording.stream));
+    }
+
+    return TestFinish("scene_commands");
+}
@@ -0,0 +1,195 @@
+#include "test.h"
+
+#include "scene_bin.cpp"
+#include "scene_json_stream.cpp"
+
+#include <algorithm>
+#include <string>
+
+// the two scene formats the game loads (LoadSceneFile in main.cpp): the streaming JSON reader and the baked binary
+// file of meta_scene_bin.py. a synthetic scene like `meta_scene_bin.py --synthetic` makes (a heightfield, a sky and
+// random primitives, half of them with a pipeline override) written as JSON, loaded, baked from what loaded, loaded
+// again and checked to be the same scene. then both loads timed at 50000 objects, files already in memory like
+// BenchmarkSceneLoad does. the cJSON reader needs the cJSON library and is only timed in the editor
+
+// the JSON text of a scene of count objects, formatted like the editor saves it
+static std::string SyntheticJson(int count)
+{
+    static const char *primitives[] = {"Cube", "Cylinder", "Prism", "Sphere"};
+    std::string json = "{\n\t\"objectCount\": " + std::to_string(count) + ",\n\t\"prefabs\": [\n";
+    json += "\t\t{\"name\": \"hf base\", \"objectType\": \"Heightfield\", \"pipeline\": \"Heightfield\", "
+            "\"heightfieldData\": {\"pathToHeightmap\": \"assets/heightmaps/clouds.dds\", \"width\": 256}},\n";
+    json += "\t\t{\"name\": \"sky\", \"objectType\": \"Sky\", \"pipeline\": \"Sky\", \"sky_sphereData\": {\"pathToTexture\": "
+            "\"assets/sky/sky1.dds\"}}";
+    for (const char *primitive : primitives)
+    {
+        json += std::string(",\n\t\t{\"name\": \"") + primitive + "\", \"objectType\": \"Primitive\", \"pipeline\": \"Default\", "
+                "\"primitiveData\": {\"primitiveType\": \"" + primitive + "\"}}";
+    }
+    json += "\n\t],\n\t\"objects\": [\n";
+    json += "\t\t{\"nametag\": \"hf base\", \"pos\": [0, 0, 0], \"rot\": [0, 0, 0, 1], \"scale\": [256, 24, 256], \"prefab\": 0},\n";
+    json += "\t\t{\"nametag\": \"sky\", \"pos\": [0, 0, 0], \"rot\": [0, 0, 0, 1], \"scale\": [1024, 1024, 1024], \"prefab\": 1}";
+    TestRandom random = {1234};
+    auto uniform = [&](float low, float high) { return low + (high - low) * (float)(TestRand(random) % 1000001) / 1000000.0f; };
+    for (int i = 2; i < count; ++i)
+    {
+        char object[320];
+        float x = uniform(-256.0f, 256.0f), y = uniform(0.0f, 40.0f), z = uniform(-256.0f, 256.0f);
+        int prefab = 2 + (int)(TestRand(random) % 4);
+        snprintf(object, sizeof(object),
+                 ",\n\t\t{\"nametag\": \"bench_%d\", \"pos\": [%.9g, %.9g, %.9g], \"rot\": [0, 0, 0, 1], \"scale\": [1, 1, 1], "
+                 "\"prefab\": %d%s}",
+                 i, x, y, z, prefab, TestRand(random) % 2 ? ", \"overrides\": {\"pipeline\": \"Triplanar\"}" : "");
+        json += object;
+    }
+    json += "\n\t]\n}\n";
+    return json;
+}
+
+// the baked file of a loaded scene, the layout meta_scene_bin.py writes: the header, then every section 16 byte
+// aligned, strings as offsets into a pool that starts with ""
+static std::vector<uint8_t> Bake(const Scene &scene)
+{
+    std::vector<char> pool(1, '\0');
+    std::vector<uint32_t> poolOffset;
+    auto string = [&](StringId id) {
+        if (id >= poolOffset.size())
+            poolOffset.resize(id + 1, UINT32_MAX);
+        if (poolOffset[id] == UINT32_MAX)
+        {
+            const char *s = StringGet(id);
+            poolOffset[id] = (uint32_t)pool.size();
+            pool.insert(pool.end(), s, s + strlen(s) + 1);
+        }
+        return poolOffset[id];
+    };
+
+    int n = scene.objectCount;
+    uint32_t prefabCount = (uint32_t)scene.prefabs.size();
+    std::vector<uint32_t> nametag(n), name(prefabCount), assetPath(prefabCount), param(prefabCount), base(prefabCount), mask(prefabCount);
+    std::vector<uint8_t> objectType(prefabCount), pipeline(prefabCount), primitiveType(prefabCount);
+    for (int i = 0; i < n; ++i)
+        nametag[i] = string(scene.info[i].nametag);
+    for (uint32_t p = 0; p < prefabCount; ++p)
+    {
+        const ScenePrefab &prefab = scene.prefabs[p];
+        name[p] = string(prefab.name);
+        objectType[p] = (uint8_t)prefab.objectType;
+        pipeline[p] = (uint8_t)prefab.pipeline;
+        primitiveType[p] = (uint8_t)prefab.primitiveType;
+        base[p] = prefab.base;
+        mask[p] = prefab.overrideMask;
+        StringId path = STRING_ID_EMPTY;
+        if (prefab.objectType == OBJECT_HEIGHTFIELD)
+        {
+            path = prefab.data.heightfield.pathToHeightmap;
+            param[p] = prefab.data.heightfield.width;
+        }
+        else if (prefab.objectType == OBJECT_LOADED_MODEL)
+            path = prefab.data.loaded_model.pathTo;
+        else if (prefab.objectType == OBJECT_SKY_SPHERE)
+            path = prefab.data.sky_sphere.pathToTexture;
+        else if (prefab.objectType == OBJECT_WATER)
+            memcpy(&param[p], &prefab.data.water.choppiness, sizeof(float));
+        assetPath[p] = string(path);
+    }
+
+    const void *sections[SCENE_BIN_SECTION_COUNT] = {scene.pos.data(), scene.rot.data(), scene.scale.data(), nametag.data(),
+                                                     scene.prefab.data(), name.data(), objectType.data(), pipeline.data(),
+                                                     primitiveType.data(), assetPath.data(), param.data(), base.data(),
+                                                     mask.data(), pool.data()};
+    SceneBinHeader header = {};
+    header.magic = SCENE_BIN_MAGIC;
+    header.version = SCENE_BIN_VERSION;
+    header.schemaHash = SCENE_BIN_SCHEMA_HASH;
+    header.objectCount = (uint32_t)n;
+    header.prefabCount = prefabCount;
+    uint32_t offset = (sizeof(SceneBinHeader) + 15) & ~15u;
+    for (int s = 0; s < SCENE_BIN_SECTION_COUNT; ++s)
+    {
+        uint32_t count = g_sceneBinElementCount[s] == SCENE_BIN_COUNT_OBJECTS ? (uint32_t)n : prefabCount;
+        header.sections[s].offset = offset;
+        header.sections[s].size = g_sceneBinElementCount[s] == SCENE_BIN_COUNT_BYTES ? (uint32_t)pool.size() : count * g_sceneBinElementSize[s];
+        offset += (header.sections[s].size + 15) & ~15u;
+    }
+    header.fileSize = offset;
+
+    std::vector<uint8_t> file(offset, 0);
+    memcpy(file.data(), &header, sizeof(header));
+    for (int s = 0; s < SCENE_BIN_SECTION_COUNT; ++s)
+    {
+        if (header.sections[s].size)
+            memcpy(&file[header.sections[s].offset], sections[s], header.sections[s].size);
+    }
+    return file;
+}
+
+// same objects, prefabs and names in the same order
+static bool SameScene(const Scene &a, const Scene &b)
+{
+    if (a.objectCount != b.objectCount || a.prefabs.size() != b.prefabs.size())
+        return false;
+    for (size_t p = 0; p < a.prefabs.size(); ++p)
+    {
+        if (!ScenePrefabSame(a.prefabs[p], b.prefabs[p]) || a.prefabs[p].name != b.prefabs[p].name)
+            return false;
+    }
+    int n = a.objectCount;
+    return memcmp(a.pos.data(), b.pos.data(), n * sizeof(a.pos[0])) == 0 && memcmp(a.rot.data(), b.rot.data(), n * sizeof(a.rot[0])) == 0 &&
+           memcmp(a.scale.data(), b.scale.data(), n * sizeof(a.scale[0])) == 0 && a.prefab == b.prefab &&
+           std::equal(a.info.begin(), a.info.end(), b.info.begin(),
+                      [](const SceneObjectInfo &x, const SceneObjectInfo &y) { return x.nametag == y.nametag; });
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    // a small scene: the JSON as written, its variants and names, and the same scene again from the baked file
+    std::string json = SyntheticJson(100);
+    Scene fromJson, fromBin;
+    TEST_CHECK(scene_from_json_stream(json.c_str(), &fromJson) == 1);
+    TEST_CHECK(fromJson.objectCount == 100 && strcmp(StringGet(fromJson.info[57].nametag), "bench_57") == 0);
+    TEST_CHECK(fromJson.prefabs.size() == 10); // six authored, a triplanar variant of each primitive
+    TEST_CHECK(fromJson.prefabs[6].base != SCENE_PREFAB_NONE && fromJson.prefabs[6].pipeline == RENDER_TRIPLANAR);
+    std::vector<uint8_t> bin = Bake(fromJson);
+    TEST_CHECK(scene_from_bin(bin.data(), bin.size(), &fromBin) == 1 && SameScene(fromJson, fromBin));
+
+    // baked files that don't match this build are refused whole, the scene left alone
+    std::vector<uint8_t> damaged = bin;
+    reinterpret_cast<SceneBinHeader *>(damaged.data())->schemaHash ^= 1;
+    TEST_CHECK(scene_from_bin(damaged.data(), damaged.size(), &fromBin) == 0 && fromBin.objectCount == 100);
+    TEST_CHECK(scene_from_bin(bin.data(), bin.size() - 16, &fromBin) == 0);
+    damaged = bin;
+    damaged[reinterpret_cast<SceneBinHeader *>(damaged.data())->sections[SCENE_BIN_PREFAB].offset] = 200; // no prefab 200
+    TEST_CHECK(scene_from_bin(damaged.data(), damaged.size(), &fromBin) == 0);
+
+    // the benchmark: 50000 objects, the median of a few loads of each file
+    const int count = 50000;
+    json = SyntheticJson(count);
+    TEST_CHECK(scene_from_json_stream(json.c_str(), &fromJson) == 1 && fromJson.objectCount == count);
+    bin = Bake(fromJson);
+    std::vector<double> jsonMs, binMs;
+    bool same = true;
+    for (int run = 0; run < 7; ++run)
+    {
+        double start = TestNowMs();
+        bool jsonOk = scene_from_json_stream(json.c_str(), &fromJson) == 1;
+        double parsed = TestNowMs();
+        bool binOk = scene_from_bin(bin.data(), bin.size(), &fromBin) == 1;
+        double mapped = TestNowMs();
+        same &= jsonOk && binOk && SameScene(fromJson, fromBin);
+        jsonMs.push_back(parsed - start);
+        binMs.push_back(mapped - parsed);
+    }
+    TEST_CHECK(same);
+    std::sort(jsonMs.begin(), jsonMs.end());
+    std::sort(binMs.begin(), binMs.end());
+    printf("  %d objects, %zu prefabs: json %.1f MB in %.2f ms, baked %.1f MB in %.2f ms (%.1fx)\n", count, fromJson.prefabs.size(),
+           json.size() / 1048576.0, jsonMs[3], bin.size() / 1048576.0, binMs[3], jsonMs[3] / binMs[3]);
+
+    // the string table keeps its blocks for the whole run, handed back here so the leak checker only sees real leaks
+    for (char *block : g_strings.blocks)
+        free(block);
+    return TestFinish("scene_load");
+}
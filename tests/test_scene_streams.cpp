@@ -0,0 +1,274 @@
+#include "test.h"
+
+#include "scene_data.h"
+
+#include <algorithm>
+#include <math.h>
+
+// the scene's hot streams (scene_data.h) against the array of whole objects they replaced: FillDrawList's copy loop
+// and the wall collision filter of Update() replayed over both layouts of the same random scene, checked to give the
+// same draw list and hits, then timed from 512 to 64k objects. the scene is random primitives with 10% models, each
+// time is the median of many runs with the caches flushed every few runs
+
+// the object as it was before the split: name and asset paths inline, 456 bytes
+struct OldSceneObject
+{
+    char nametag[128];
+    DirectX::XMFLOAT3 pos;
+    DirectX::XMFLOAT4 rot;
+    DirectX::XMFLOAT3 scale;
+    uint32_t objectType;
+    uint32_t pipeline;
+    union
+    {
+        struct
+        {
+            uint32_t primitiveType;
+        } primitive;
+        struct
+        {
+            char pathToHeightmap[256];
+            uint32_t width;
+        } heightfield;
+        struct
+        {
+            char pathTo[256];
+            uint32_t modelIndex;
+            struct
+            {
+                bool enabled;
+                int shape;
+                DirectX::XMFLOAT3 offset;
+            } collision;
+        } loaded_model;
+    } data;
+};
+
+// what FillDrawList writes per drawable object
+struct DrawList
+{
+    std::vector<DirectX::XMFLOAT3> pos, scale;
+    std::vector<DirectX::XMFLOAT4> rot;
+    std::vector<uint8_t> type, primitive, pipeline;
+    std::vector<uint32_t> model;
+    int count = 0;
+
+    void Resize(int n)
+    {
+        pos.resize(n);
+        scale.resize(n);
+        rot.resize(n);
+        type.resize(n);
+        primitive.resize(n);
+        pipeline.resize(n);
+        model.resize(n);
+    }
+};
+
+static void FillOld(const std::vector<OldSceneObject> &objects, DrawList &list)
+{
+    int d = 0;
+    for (const OldSceneObject &o : objects)
+    {
+        if (o.objectType > OBJECT_LOADED_MODEL)
+            continue;
+        list.pos[d] = o.pos;
+        list.rot[d] = o.rot;
+        list.scale[d] = o.scale;
+        list.type[d] = (uint8_t)o.objectType;
+        if (o.objectType == OBJECT_PRIMITIVE)
+            list.primitive[d] = (uint8_t)o.data.primitive.primitiveType;
+        else
+            list.model[d] = o.data.loaded_model.modelIndex;
+        list.pipeline[d] = (uint8_t)o.pipeline;
+        d++;
+    }
+    list.count = d;
+}
+
+static void FillStreams(const Scene &scene, DrawList &list)
+{
+    int d = 0;
+    for (int i = 0; i < scene.objectCount; ++i)
+    {
+        const ScenePrefab &prefab = SceneObjectPrefab(scene, i);
+        if (prefab.objectType > OBJECT_LOADED_MODEL)
+            continue;
+        list.pos[d] = scene.pos[i];
+        list.rot[d] = scene.rot[i];
+        list.scale[d] = scene.scale[i];
+        list.type[d] = prefab.objectType;
+        if (prefab.objectType == OBJECT_PRIMITIVE)
+            list.primitive[d] = prefab.primitiveType;
+        else
+            list.model[d] = prefab.modelIndex;
+        list.pipeline[d] = prefab.pipeline;
+        d++;
+    }
+    list.count = d;
+}
+
+// the walls the player's cylinder at q touches: primitives other than prisms, an upright cylinder test on each
+static int CollideOld(const std::vector<OldSceneObject> &objects, DirectX::XMFLOAT3 q)
+{
+    int hits = 0;
+    for (const OldSceneObject &o : objects)
+    {
+        if (o.objectType != OBJECT_PRIMITIVE || o.data.primitive.primitiveType == PRIMITIVE_PRISM)
+            continue;
+        float dx = q.x - o.pos.x, dz = q.z - o.pos.z;
+        hits += dx * dx + dz * dz < o.scale.x * o.scale.x && fabsf(q.y - o.pos.y) < o.scale.y;
+    }
+    return hits;
+}
+
+static int CollideStreams(const Scene &scene, DirectX::XMFLOAT3 q)
+{
+    int hits = 0;
+    for (int i = 0; i < scene.objectCount; ++i)
+    {
+        const ScenePrefab &prefab = SceneObjectPrefab(scene, i);
+        if (prefab.objectType != OBJECT_PRIMITIVE || prefab.primitiveType == PRIMITIVE_PRISM)
+            continue;
+        const DirectX::XMFLOAT3 &pos = scene.pos[i], &scale = scene.scale[i];
+        float dx = q.x - pos.x, dz = q.z - pos.z;
+        hits += dx * dx + dz * dz < scale.x * scale.x && fabsf(q.y - pos.y) < scale.y;
+    }
+    return hits;
+}
+
+static bool SameDrawList(const DrawList &a, const DrawList &b)
+{
+    if (a.count != b.count)
+        return false;
+    for (int d = 0; d < a.count; ++d)
+    {
+        if (memcmp(&a.pos[d], &b.pos[d], sizeof(a.pos[d])) || memcmp(&a.rot[d], &b.rot[d], sizeof(a.rot[d])) ||
+            memcmp(&a.scale[d], &b.scale[d], sizeof(a.scale[d])) || a.type[d] != b.type[d] || a.pipeline[d] != b.pipeline[d])
+            return false;
+        if (a.type[d] == OBJECT_PRIMITIVE ? a.primitive[d] != b.primitive[d] : a.model[d] != b.model[d])
+            return false;
+    }
+    return true;
+}
+
+static volatile int g_sink;
+
+// n random objects in both layouts: a prefab per primitive type and one model, 10% models
+static void RandomScene(int n, std::vector<OldSceneObject> &old, Scene &scene)
+{
+    scene = Scene();
+    uint32_t prefabs[PRIMITIVE_COUNT + 1];
+    for (int p = 0; p <= PRIMITIVE_COUNT; ++p)
+    {
+        ScenePrefab prefab = ScenePrefabDefault();
+        prefab.pipeline = RENDER_TRIPLANAR;
+        if (p < PRIMITIVE_COUNT)
+            prefab.primitiveType = (PrimitiveType)p;
+        else
+        {
+            prefab.objectType = OBJECT_LOADED_MODEL;
+            prefab.pipeline = RENDER_LOADED_MODEL;
+            prefab.modelIndex = 3;
+        }
+        prefabs[p] = ScenePrefabAdd(scene, prefab);
+    }
+
+    old.assign(n, OldSceneObject{});
+    SceneReserve(scene, n);
+    TestRandom random = {(uint32_t)n};
+    for (int i = 0; i < n; ++i)
+    {
+        int p = TestRand(random) % 10 ? (int)(TestRand(random) % PRIMITIVE_COUNT) : PRIMITIVE_COUNT;
+        const ScenePrefab &prefab = scene.prefabs[prefabs[p]];
+        DirectX::XMFLOAT3 pos = {(float)(TestRand(random) % 512) - 256.0f, (float)(TestRand(random) % 40), (float)(TestRand(random) % 512) - 256.0f};
+        DirectX::XMFLOAT3 scale = {1.0f + (float)(TestRand(random) % 8), 1.0f + (float)(TestRand(random) % 8), 1.0f};
+
+        OldSceneObject &o = old[i];
+        snprintf(o.nametag, sizeof(o.nametag), "object %d", i);
+        o.pos = pos;
+        o.rot = {0.0f, 0.0f, 0.0f, 1.0f};
+        o.scale = scale;
+        o.objectType = prefab.objectType;
+        o.pipeline = prefab.pipeline;
+        if (prefab.objectType == OBJECT_PRIMITIVE)
+            o.data.primitive.primitiveType = prefab.primitiveType;
+        else
+            o.data.loaded_model.modelIndex = prefab.modelIndex;
+
+        int dense = SceneResolve(scene, SceneAddObject(scene, prefabs[p]));
+        scene.pos[dense] = pos;
+        scene.scale[dense] = scale;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    // a buffer walked between runs so the scene comes from memory, like a frame's other work would leave it
+    std::vector<char> flush(32 << 20, 1);
+    auto flushCaches = [&]() {
+        int sum = 0;
+        for (size_t k = 0; k < flush.size(); k += 64)
+            sum += flush[k]++;
+        g_sink = sum;
+    };
+
+    printf("  %zu byte objects before, %zu bytes of hot streams per object now\n", sizeof(OldSceneObject),
+           2 * sizeof(DirectX::XMFLOAT3) + sizeof(DirectX::XMFLOAT4) + sizeof(uint32_t));
+    printf("  objects   FillDrawList old -> streams    collision old -> streams\n");
+    const DirectX::XMFLOAT3 player = {3.0f, 1.0f, 7.0f};
+    bool same = true;
+    for (int n = 512; n <= 65536; n *= 2)
+    {
+        std::vector<OldSceneObject> old;
+        Scene scene;
+        RandomScene(n, old, scene);
+
+        // both layouts give the same draw list and the same walls
+        DrawList oldList, streamList;
+        oldList.Resize(n);
+        streamList.Resize(n);
+        FillOld(old, oldList);
+        FillStreams(scene, streamList);
+        same &= SameDrawList(oldList, streamList) && oldList.count > n / 2;
+        for (int q = 0; q < 16; ++q)
+        {
+            DirectX::XMFLOAT3 at = {player.x + q * 31.0f - 248.0f, player.y + q % 4 * 8.0f, player.z - q * 29.0f + 232.0f};
+            same &= CollideOld(old, at) == CollideStreams(scene, at);
+        }
+
+        int runs = std::max(20, 200000 / n);
+        std::vector<double> fill[2], collide[2];
+        for (int run = 0; run < runs; ++run)
+        {
+            for (int layout = 0; layout < 2; ++layout)
+            {
+                if (run % 4 == 0)
+                    flushCaches();
+                double start = TestNowMs();
+                if (layout == 0)
+                    FillOld(old, oldList);
+                else
+                    FillStreams(scene, streamList);
+                double filled = TestNowMs();
+                int hits = layout == 0 ? CollideOld(old, player) : CollideStreams(scene, player);
+                double collided = TestNowMs();
+                g_sink = hits;
+                fill[layout].push_back(filled - start);
+                collide[layout].push_back(collided - filled);
+            }
+        }
+        auto medianUs = [](std::vector<double> &times) {
+            std::sort(times.begin(), times.end());
+            return times[times.size() / 2] * 1000.0;
+        };
+        double fillOld = medianUs(fill[0]), fillStreams = medianUs(fill[1]);
+        double collideOld = medianUs(collide[0]), collideStreams = medianUs(collide[1]);
+        printf("  %7d   %9.1f us -> %7.1f us    %7.1f us -> %7.1f us\n", n, fillOld, fillStreams, collideOld, collideStreams);
+    }
+    TEST_CHECK(same);
+
+    return TestFinish("scene_streams");
+}
@@ -0,0 +1,234 @@
+#include "test.h"
+
+#include "scene_undo.h"
+
+#include <algorithm>
+
+// the editor's undo journal (scene_undo.h): field edits undone and redone, coalescing of a drag into one entry,
+// a new edit dropping what could be redone, objects added and deleted coming back under their handles, the prefab
+// ids the journal keeps from ScenePrefabReclaimVariants. then a long random session against the scene's state after
+// every step, long enough that both rings wrap and the oldest entries are dropped
+
+// the scene's objects by handle, the order of the dense streams left out (a restored object comes back at the end)
+static uint64_t SceneState(const Scene &scene)
+{
+    std::vector<int> bySlot(scene.objectCount);
+    for (int i = 0; i < scene.objectCount; ++i)
+        bySlot[i] = i;
+    std::sort(bySlot.begin(), bySlot.end(), [&](int a, int b) { return scene.denseSlot[a] < scene.denseSlot[b]; });
+    uint64_t h = 14695981039346656037ull;
+    auto mix = [&](const void *data, size_t size) {
+        for (size_t k = 0; k < size; ++k)
+        {
+            h ^= ((const uint8_t *)data)[k];
+            h *= 1099511628211ull;
+        }
+    };
+    for (int i : bySlot)
+    {
+        SceneHandle handle = SceneHandleAt(scene, i);
+        mix(&handle, sizeof(handle));
+        mix(&scene.pos[i], sizeof(scene.pos[i]));
+        mix(&scene.rot[i], sizeof(scene.rot[i]));
+        mix(&scene.scale[i], sizeof(scene.scale[i]));
+        mix(&scene.prefab[i], sizeof(scene.prefab[i]));
+        mix(&scene.info[i], sizeof(scene.info[i]));
+    }
+    for (const ScenePrefab &prefab : scene.prefabs)
+        mix(&prefab.pipeline, sizeof(prefab.pipeline));
+    return h;
+}
+
+static void MoveObject(UndoJournal &journal, Scene &scene, int i, float x, uint32_t key = 0)
+{
+    DirectX::XMFLOAT3 old = scene.pos[i];
+    scene.pos[i].x = x;
+    UndoRecordEdit(journal, scene, i, SCENE_FIELD_POS, &old, key);
+}
+
+static SceneHandle AddObject(UndoJournal &journal, Scene &scene, uint32_t prefab, float x, StringId nametag)
+{
+    SceneHandle handle = SceneAddObject(scene, prefab);
+    int i = SceneResolve(scene, handle);
+    scene.pos[i] = {x, 1.0f, 2.0f};
+    scene.info[i].nametag = nametag; // any id will do, nothing here reads the strings
+    UndoRecordAdd(journal, scene, handle);
+    return handle;
+}
+
+static void RemoveObject(UndoJournal &journal, Scene &scene, SceneHandle handle)
+{
+    UndoRecordRemove(journal, scene, handle);
+    SceneRemoveObject(scene, handle);
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    Scene scene;
+    UndoJournal journal;
+    uint32_t cube = ScenePrefabAdd(scene, ScenePrefabDefault());
+    ScenePrefab sphere = ScenePrefabDefault();
+    sphere.primitiveType = PRIMITIVE_SPHERE;
+    uint32_t sphereId = ScenePrefabAdd(scene, sphere);
+
+    // an edit, undone and redone
+    SceneHandle a = AddObject(journal, scene, cube, 0.0f, 7);
+    MoveObject(journal, scene, SceneResolve(scene, a), 5.0f);
+    TEST_CHECK(journal.count == 2 && journal.applied == 2 && UndoCanUndo(journal) && !UndoCanRedo(journal));
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && scene.pos[SceneResolve(scene, a)].x == 0.0f);
+    TEST_CHECK(UndoStep(journal, scene, true, nullptr) && scene.pos[SceneResolve(scene, a)].x == 5.0f);
+    TEST_CHECK(!UndoStep(journal, scene, true, nullptr));
+
+    // a drag: every frame under the same key is one entry keeping the first old value, a new key or the end of the
+    // interaction starts the next one
+    uint32_t drag = UndoCoalesceKey("gizmo", a);
+    for (int frame = 1; frame <= 30; ++frame)
+        MoveObject(journal, scene, SceneResolve(scene, a), 5.0f + frame, drag);
+    TEST_CHECK(journal.count == 3 && journal.coalescedEdits == 29);
+    UndoEndCoalescing(journal);
+    MoveObject(journal, scene, SceneResolve(scene, a), 100.0f, drag);
+    TEST_CHECK(journal.count == 4);
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && scene.pos[SceneResolve(scene, a)].x == 35.0f);
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && scene.pos[SceneResolve(scene, a)].x == 5.0f);
+    // an unchanged value isn't an edit
+    MoveObject(journal, scene, SceneResolve(scene, a), 5.0f);
+    TEST_CHECK(journal.count == 4 && journal.applied == 2 && UndoCanRedo(journal));
+
+    // a new edit after undoing drops the two entries that could have been redone
+    MoveObject(journal, scene, SceneResolve(scene, a), 9.0f);
+    TEST_CHECK(journal.count == 3 && journal.applied == 3 && !UndoCanRedo(journal));
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && scene.pos[SceneResolve(scene, a)].x == 5.0f);
+    TEST_CHECK(UndoStep(journal, scene, true, nullptr) && scene.pos[SceneResolve(scene, a)].x == 9.0f);
+
+    // a delete: undone, the object is back under its handle with its streams and the edits before it apply again
+    SceneHandle b = AddObject(journal, scene, sphereId, 3.0f, 8);
+    uint64_t withBoth = SceneState(scene);
+    RemoveObject(journal, scene, a);
+    TEST_CHECK(SceneResolve(scene, a) < 0 && scene.objectCount == 1);
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && SceneResolve(scene, a) >= 0 && SceneState(scene) == withBoth);
+    TEST_CHECK(scene.info[SceneResolve(scene, a)].nametag == 7 && scene.prefab[SceneResolve(scene, a)] == cube);
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && SceneResolve(scene, b) < 0); // b's add
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && scene.pos[SceneResolve(scene, a)].x == 5.0f);
+    TEST_CHECK(UndoStep(journal, scene, true, nullptr) && UndoStep(journal, scene, true, nullptr));
+    TEST_CHECK(SceneResolve(scene, b) >= 0 && SceneState(scene) == withBoth);
+    TEST_CHECK(UndoStep(journal, scene, true, nullptr) && SceneResolve(scene, a) < 0);
+    // undoing the first add takes a away for good... until it is redone
+    while (UndoStep(journal, scene, false, nullptr))
+        ;
+    TEST_CHECK(scene.objectCount == 0 && journal.applied == 0);
+    while (UndoStep(journal, scene, true, nullptr))
+        ;
+    TEST_CHECK(scene.objectCount == 1 && SceneResolve(scene, b) >= 0 && SceneResolve(scene, a) < 0);
+    // a slot taken by an object the journal doesn't know about: the delete's undo can't bring a back there, skipped
+    UndoStep(journal, scene, false, nullptr);
+    RemoveObject(journal, scene, a);
+    SceneHandle other = SceneAddObject(scene, cube);
+    TEST_CHECK(other.slot == a.slot && UndoStep(journal, scene, false, nullptr) && SceneResolve(scene, a) < 0);
+    TEST_CHECK(SceneResolve(scene, other) >= 0 && scene.objectCount == 2);
+
+    // a deleted object's variant stays through the reclaim and its id is renumbered with the others
+    scene = Scene();
+    journal = UndoJournal();
+    cube = ScenePrefabAdd(scene, ScenePrefabDefault());
+    ScenePrefab values = scene.prefabs[cube];
+    values.primitiveType = PRIMITIVE_PRISM;
+    uint32_t unused = ScenePrefabVariant(scene, cube, SceneFieldBit(SCENE_FIELD_PRIMITIVE_TYPE), values);
+    values.primitiveType = PRIMITIVE_CUBE;
+    values.pipeline = RENDER_TRIPLANAR;
+    uint32_t triplanar = ScenePrefabVariant(scene, cube, SceneFieldBit(SCENE_FIELD_PIPELINE), values);
+    TEST_CHECK(unused == 1 && triplanar == 2);
+    SceneHandle c = SceneAddObject(scene, triplanar);
+    RemoveObject(journal, scene, c);
+    std::vector<uint8_t> held(scene.prefabs.size(), 0);
+    std::vector<uint32_t> remap;
+    UndoMarkPrefabs(journal, held);
+    TEST_CHECK(held[triplanar] && !held[unused]);
+    TEST_CHECK(ScenePrefabReclaimVariants(scene, held, remap) == 1 && scene.prefabs.size() == 2);
+    UndoRemapPrefabs(journal, remap);
+    TEST_CHECK(UndoStep(journal, scene, false, nullptr) && SceneResolve(scene, c) == 0);
+    TEST_CHECK(scene.prefab[0] == 1 && SceneObjectPrefab(scene, 0).pipeline == RENDER_TRIPLANAR);
+
+    // a random session: adds, deletes, moves and prefab edits, with runs of undos and redos in between, every step
+    // checked against the scene as it was. state[p] is the scene after p entries, the oldest entry still in the
+    // journal is the droppedEntries-th
+    scene = Scene();
+    journal = UndoJournal();
+    cube = ScenePrefabAdd(scene, ScenePrefabDefault());
+    sphereId = ScenePrefabAdd(scene, sphere);
+    std::vector<SceneHandle> handles;
+    std::vector<uint64_t> state(1, SceneState(scene));
+    int position = 0, steps = 0;
+    bool same = true, bounded = true;
+    int wrapsBefore = -1;
+    TestRandom random = {21};
+    for (int op = 0; op < 40000; ++op)
+    {
+        uint32_t what = TestRand(random) % 16;
+        int live = scene.objectCount;
+        if (what < 4 || live == 0)
+            handles.push_back(AddObject(journal, scene, TestRand(random) % 2 ? cube : sphereId, (float)(TestRand(random) % 100),
+                                        TestRand(random) % 50));
+        else if (what < 8)
+            RemoveObject(journal, scene, SceneHandleAt(scene, (int)(TestRand(random) % live)));
+        else if (what < 13)
+            MoveObject(journal, scene, (int)(TestRand(random) % live), 100.0f + op);
+        else if (what < 15)
+        {
+            uint32_t prefab = TestRand(random) % 2 ? cube : sphereId;
+            ScenePrefab &edited = scene.prefabs[prefab];
+            RenderPipeline old = edited.pipeline;
+            edited.pipeline = old == RENDER_DEFAULT ? RENDER_TRIPLANAR : RENDER_DEFAULT;
+            ScenePrefabChanged(scene, prefab);
+            UndoRecordPrefabEdit(journal, scene, prefab, SCENE_FIELD_PIPELINE, &old);
+        }
+        else
+        {
+            // undo a few, then redo some of them, each step against the state it should give
+            int undos = 1 + (int)(TestRand(random) % 8), redos = (int)(TestRand(random) % (undos + 1));
+            for (int k = 0; k < undos; ++k)
+            {
+                bool undone = UndoStep(journal, scene, false, nullptr);
+                same &= undone == (position > journal.droppedEntries);
+                position -= undone;
+                same &= SceneState(scene) == state[position];
+                steps++;
+            }
+            for (int k = 0; k < redos; ++k)
+            {
+                bool redone = UndoStep(journal, scene, true, nullptr);
+                same &= redone == (position + 1 < (int)state.size());
+                position += redone;
+                same &= SceneState(scene) == state[position];
+                steps++;
+            }
+            continue;
+        }
+        state.resize(++position);
+        state.push_back(SceneState(scene));
+        bounded &= journal.bytesUsed <= UNDO_BYTE_CAPACITY && journal.count <= UNDO_MAX_RECORDS;
+        if (wrapsBefore < 0 && journal.droppedEntries > 0)
+            wrapsBefore = op;
+    }
+    // all the way back to the oldest entry kept, then forward to the end
+    int dropped = journal.droppedEntries;
+    while (UndoStep(journal, scene, false, nullptr))
+    {
+        position--;
+        same &= SceneState(scene) == state[position];
+    }
+    TEST_CHECK(position == dropped && journal.applied == 0);
+    while (UndoStep(journal, scene, true, nullptr))
+    {
+        position++;
+        same &= SceneState(scene) == state[position];
+    }
+    TEST_CHECK(position == (int)state.size() - 1);
+    TEST_CHECK(same && bounded && dropped > 0 && wrapsBefore > 0);
+    printf("  %d entries, %d undone or redone in between, the first dropped at edit %d, %d dropped, %u records and %.0f KB "
+           "kept\n",
+           (int)state.size() - 1, steps, wrapsBefore, dropped, journal.count, journal.bytesUsed / 1024.0);
+
+    return TestFinish("scene_undo");
+}
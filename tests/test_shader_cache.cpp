@@ -0,0 +1,166 @@
+#include "test.h"
+
+#include "shader_cache.h"
+
+// the on-disk shader cache (shader_cache.h) with a stub preprocessor and compiler, the source with its defines spelled
+// out and bytecode made from that text: the pipeline's permutations compiled cold, loaded warm from the saved bytes,
+// then after a source edit, a changed define, another compiler version, a damaged blob and truncated files
+
+static const ShaderCacheDefine g_permutations[][2] = {
+    {{nullptr, nullptr}},
+    {{"TRIPLANAR", "1"}, {nullptr, nullptr}},
+    {{"HEIGHTFIELD", "1"}, {nullptr, nullptr}},
+    {{"SKY", "1"}, {nullptr, nullptr}},
+    {{"LOADED_MODEL", "1"}, {nullptr, nullptr}},
+};
+static const int g_permutationCount = (int)(sizeof(g_permutations) / sizeof(g_permutations[0]));
+static const int g_shaders = g_permutationCount * 2; // a VS and a PS each
+static const uint64_t g_compilerVersion = 47;
+static const char *g_source = "float4 PSMain() { return 1; }";
+static const char *g_edited = "float4 PSMain() { return 0.5; }";
+
+static int g_compiles = 0;
+
+static std::vector<uint8_t> Preprocess(const char *source, const ShaderCacheDefine *defines)
+{
+    std::vector<uint8_t> text(source, source + strlen(source));
+    for (const ShaderCacheDefine *define = defines; define->name; ++define)
+    {
+        text.insert(text.end(), define->name, define->name + strlen(define->name));
+        text.insert(text.end(), define->value, define->value + strlen(define->value));
+    }
+    return text;
+}
+
+// bytes that differ with the text, entry point and target, of a size that differs too
+static std::vector<uint8_t> Compile(const std::vector<uint8_t> &text, const char *entryPoint, const char *target)
+{
+    std::vector<uint8_t> blob(64 + text.size() % 61);
+    uint64_t hash = ShaderCacheHashString(target, ShaderCacheHashString(entryPoint, ShaderCacheHashBytes(text.data(), text.size())));
+    for (size_t i = 0; i < blob.size(); ++i)
+        blob[i] = (uint8_t)(hash >> (i % 8 * 8)) ^ (uint8_t)i;
+    return blob;
+}
+
+// every permutation's VS and PS through the cache like CompileShader in renderer_dx12.cpp, changedDefine's permutation
+// with its define set to 2. true if every hit matches a fresh compile and the cache is consistent after
+static bool Build(ShaderCache &cache, const char *source, int changedDefine = -1)
+{
+    bool same = true;
+    for (int p = 0; p < g_permutationCount; ++p)
+    {
+        ShaderCacheDefine defines[2] = {g_permutations[p][0], g_permutations[p][1]};
+        if (p == changedDefine)
+            defines[0].value = "2";
+        std::vector<uint8_t> text = Preprocess(source, defines);
+        const char *stages[2][2] = {{"VSMain", "vs_5_1"}, {"PSMain", "ps_5_1"}};
+        for (int s = 0; s < 2; ++s)
+        {
+            ShaderCacheKey key = ShaderCacheMakeKey(text.data(), text.size(), defines, stages[s][0], stages[s][1], 0, cache.compilerVersion);
+            const ShaderCacheEntry *entry = ShaderCacheFind(cache, key);
+            std::vector<uint8_t> expected = Compile(text, stages[s][0], stages[s][1]);
+            if (entry)
+            {
+                same &= entry->size == expected.size() && memcmp(&cache.data[entry->offset], expected.data(), entry->size) == 0;
+            }
+            else
+            {
+                ShaderCacheInsert(cache, key, expected.data(), expected.size());
+                g_compiles++;
+            }
+        }
+    }
+    return same && ShaderCacheValidate(cache);
+}
+
+// the next run: from saved, to loaded with the given compiler version
+static bool Reload(const ShaderCache &from, ShaderCache &to, uint64_t compilerVersion)
+{
+    std::vector<uint8_t> file;
+    ShaderCacheSerialize(from, file);
+    ShaderCacheInit(to, compilerVersion);
+    return ShaderCacheParse(to, file.data(), file.size());
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    // cold: everything misses and is compiled once
+    ShaderCache cold;
+    ShaderCacheInit(cold, g_compilerVersion);
+    TEST_CHECK(Build(cold, g_source));
+    TEST_CHECK(g_compiles == g_shaders && cold.misses == g_shaders && cold.hits == 0 && cold.dirty);
+    TEST_CHECK(cold.entries.size() == (size_t)g_shaders);
+
+    // warm: the saved file loads whole, everything hits and nothing needs saving
+    ShaderCache warm;
+    g_compiles = 0;
+    TEST_CHECK(Reload(cold, warm, g_compilerVersion));
+    TEST_CHECK(!warm.dirty && warm.rejected == 0 && warm.entries.size() == (size_t)g_shaders);
+    TEST_CHECK(Build(warm, g_source));
+    TEST_CHECK(g_compiles == 0 && warm.hits == g_shaders && warm.misses == 0 && !warm.dirty);
+    TEST_CHECK(ShaderCachePruneUnused(warm) == 0);
+
+    // a source edit recompiles everything and replaces the old entries instead of adding to them
+    g_compiles = 0;
+    TEST_CHECK(Build(warm, g_edited));
+    TEST_CHECK(g_compiles == g_shaders && warm.stale == g_shaders && warm.entries.size() == (size_t)g_shaders);
+    std::vector<uint8_t> file, before;
+    ShaderCacheSerialize(warm, before);
+    TEST_CHECK(Reload(ShaderCache(warm), warm, g_compilerVersion)); // through a copy, Reload refills warm
+    ShaderCacheSerialize(warm, file);
+    TEST_CHECK(file == before); // the edit's file holds the new blobs only, packed
+    TEST_CHECK(file.size() < sizeof(ShaderCacheFileHeader) + g_shaders * (sizeof(ShaderCacheFileEntry) + 64 + 61));
+
+    // next run, a changed define only recompiles its permutation, the old one goes when unused ones are pruned
+    g_compiles = 0;
+    TEST_CHECK(Build(warm, g_edited, 1));
+    TEST_CHECK(g_compiles == 2 && warm.misses == 2 && warm.hits == g_shaders - 2);
+    TEST_CHECK(warm.entries.size() == (size_t)g_shaders + 2); // the define's value isn't a source edit, both stay
+    TEST_CHECK(ShaderCachePruneUnused(warm) == 2 && warm.entries.size() == (size_t)g_shaders && ShaderCacheValidate(warm));
+    g_compiles = 0;
+    TEST_CHECK(Build(warm, g_edited, 1) && g_compiles == 0);
+
+    // another compiler throws the file away as a whole, the cache starts empty and gets saved over it
+    ShaderCache other;
+    TEST_CHECK(!Reload(warm, other, g_compilerVersion + 1));
+    TEST_CHECK(other.entries.empty() && other.rejected == 1 && other.dirty && other.compilerVersion == g_compilerVersion + 1);
+    g_compiles = 0;
+    TEST_CHECK(Build(other, g_edited, 1) && g_compiles == g_shaders);
+    // and the keys differ, a file of the old compiler read as if it were current misses everywhere
+    ShaderCacheInit(other, g_compilerVersion + 1);
+    ShaderCacheSerialize(warm, file);
+    memcpy(file.data() + offsetof(ShaderCacheFileHeader, compilerVersion), &other.compilerVersion, sizeof(uint64_t));
+    TEST_CHECK(ShaderCacheParse(other, file.data(), file.size()) && other.entries.size() == (size_t)g_shaders);
+    g_compiles = 0;
+    TEST_CHECK(Build(other, g_edited, 1) && g_compiles == g_shaders && other.hits == 0);
+
+    // a damaged blob costs only its own entry
+    ShaderCacheSerialize(warm, file);
+    file[file.size() - 1] ^= 0xFF;
+    ShaderCacheInit(other, g_compilerVersion);
+    TEST_CHECK(ShaderCacheParse(other, file.data(), file.size()));
+    TEST_CHECK(other.rejected == 1 && other.entries.size() == (size_t)g_shaders - 1 && other.dirty && ShaderCacheValidate(other));
+    g_compiles = 0;
+    TEST_CHECK(Build(other, g_edited, 1) && g_compiles == 1);
+
+    // truncated anywhere (a crash while saving): rejected as a whole, never read past the end
+    ShaderCacheSerialize(warm, file);
+    bool truncated = true;
+    for (size_t size = 0; size < file.size(); ++size)
+    {
+        std::vector<uint8_t> part(file.begin(), file.begin() + size); // its own allocation, for the sanitizers
+        ShaderCacheInit(other, g_compilerVersion);
+        truncated &= !ShaderCacheParse(other, part.data(), part.size()) && other.entries.empty() && other.data.empty() && other.dirty;
+    }
+    TEST_CHECK(truncated);
+    ShaderCacheInit(other, g_compilerVersion);
+    TEST_CHECK(!ShaderCacheParse(other, nullptr, 0) && other.dirty);
+    // so is one with bytes appended
+    file.push_back(0);
+    TEST_CHECK(!ShaderCacheParse(other, file.data(), file.size()) && other.entries.empty());
+
+    printf("  %d shaders, %zu bytes cached\n", g_shaders, file.size() - 1);
+    return TestFinish("shader_cache");
+}
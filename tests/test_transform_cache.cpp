@@ -0,0 +1,167 @@
+#include "test.h"
+
+#include "transform_cache.h"
+
+// the world and inverse world matrices of transform_cache.h: TransformBuildBatch on every path this CPU runs has to
+// give TransformBuild's results bit for bit, in both layouts and for counts that leave a partial batch, including
+// zero, negative and tiny scales and quaternions that aren't normalized. then the inverse against the world matrix,
+// the cache's dirty tracking, and the time per object of each path
+
+// random object i of a run, a zero scale component every 17th, a negative one every 5th
+static void RandomObject(TestRandom &random, int i, DirectX::XMFLOAT3 &pos, DirectX::XMFLOAT4 &rot, DirectX::XMFLOAT3 &scale)
+{
+    auto unit = [&]() { return (float)(TestRand(random) % 20001) / 10000.0f - 1.0f; };
+    pos = {unit() * 1000.0f, unit() * 50.0f, unit() * 1000.0f};
+    rot = {unit(), unit(), unit(), unit()};
+    if (i % 3)
+    {
+        float length = sqrtf(rot.x * rot.x + rot.y * rot.y + rot.z * rot.z + rot.w * rot.w);
+        if (length > 0.0f)
+            rot = {rot.x / length, rot.y / length, rot.z / length, rot.w / length};
+    }
+    scale = {0.01f + fabsf(unit()) * 20.0f, 0.01f + fabsf(unit()) * 20.0f, 1e-4f + fabsf(unit())};
+    if (i % 5 == 0)
+        scale.y = -scale.y;
+    if (i % 17 == 0)
+        (&scale.x)[i % 3] = 0.0f;
+}
+
+static int Mismatches(const std::vector<DirectX::XMFLOAT4X4> &a, const std::vector<DirectX::XMFLOAT4X4> &b, int count)
+{
+    int mismatches = 0;
+    for (int i = 0; i < count; ++i)
+        mismatches += memcmp(&a[i], &b[i], sizeof(a[i])) != 0;
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+
+    const int count = 2006; // not a multiple of 4 or 8
+    TestRandom random = {11};
+    std::vector<DirectX::XMFLOAT3> pos(count), scale(count);
+    std::vector<DirectX::XMFLOAT4> rot(count);
+    TransformSoA soa;
+    TransformSoAResize(soa, count);
+    for (int i = 0; i < count; ++i)
+    {
+        RandomObject(random, i, pos[i], rot[i], scale[i]);
+        TransformSoASet(soa, i, pos[i], rot[i], scale[i]);
+    }
+
+    // what every path has to match
+    std::vector<DirectX::XMFLOAT4X4> world(count), invWorld(count), gpuWorld(count);
+    for (int i = 0; i < count; ++i)
+    {
+        TransformBuild(pos[i], rot[i], scale[i], &world[i], &invWorld[i]);
+        TransformBuild(pos[i], rot[i], scale[i], &gpuWorld[i], nullptr, true);
+    }
+
+    TEST_CHECK(TransformPathSupported(TRANSFORM_PATH_SCALAR) && TransformPathSupported(TRANSFORM_PATH_SSE));
+    TEST_CHECK(TransformPathSupported(g_transformPath) && g_transformPath != TRANSFORM_PATH_SCALAR);
+    std::string paths;
+    for (int p = 0; p < TRANSFORM_PATH_COUNT; ++p)
+    {
+        TransformPath path = (TransformPath)p;
+        if (!TransformPathSupported(path))
+        {
+            printf("  %s: not supported by this CPU, skipped\n", g_transformPathNames[p]);
+            continue;
+        }
+        paths += std::string(paths.empty() ? "" : ", ") + g_transformPathNames[p];
+
+        // the whole run, then every count up to two batches so the scalar tail covers each remainder
+        std::vector<DirectX::XMFLOAT4X4> batchWorld(count), batchInvWorld(count), batchGpuWorld(count);
+        TransformBuildBatch(soa, count, batchWorld.data(), batchInvWorld.data(), false, path);
+        TransformBuildBatch(soa, count, batchGpuWorld.data(), nullptr, true, path);
+        int mismatches = Mismatches(batchWorld, world, count) + Mismatches(batchInvWorld, invWorld, count) +
+                         Mismatches(batchGpuWorld, gpuWorld, count);
+        for (int partial = 1; partial <= 16; ++partial)
+        {
+            std::vector<DirectX::XMFLOAT4X4> partialWorld(partial), partialInvWorld(partial);
+            TransformBuildBatch(soa, partial, partialWorld.data(), partialInvWorld.data(), false, path);
+            mismatches += Mismatches(partialWorld, world, partial) + Mismatches(partialInvWorld, invWorld, partial);
+        }
+        // only the inverse: the world matrices left alone
+        std::vector<DirectX::XMFLOAT4X4> onlyInverse(count);
+        TransformBuildBatch(soa, count, nullptr, onlyInverse.data(), false, path);
+        mismatches += Mismatches(onlyInverse, invWorld, count);
+        if (mismatches)
+            printf("  %s: %d matrices differ from TransformBuild\n", g_transformPathNames[p], mismatches);
+        TEST_CHECK(mismatches == 0);
+    }
+
+    // the inverse undoes the world matrix (for a normalized quaternion, the rotation is a transpose), or is all zero
+    // for a zero scale
+    bool inverse = true;
+    for (int i = 0; i < count; ++i)
+    {
+        bool degenerate = scale[i].x == 0.0f || scale[i].y == 0.0f || scale[i].z == 0.0f;
+        DirectX::XMFLOAT4X4 zero = {};
+        if (degenerate)
+        {
+            inverse &= memcmp(&invWorld[i], &zero, sizeof(zero)) == 0;
+            continue;
+        }
+        if (i % 3 == 0)
+            continue;
+        DirectX::XMFLOAT4X4 product;
+        DirectX::XMStoreFloat4x4(&product, DirectX::XMMatrixMultiply(DirectX::XMLoadFloat4x4(&world[i]), DirectX::XMLoadFloat4x4(&invWorld[i])));
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+            {
+                // relative to the terms summed: uneven scales and far positions cancel large ones
+                float terms = 0.0f;
+                for (int k = 0; k < 4; ++k)
+                    terms += fabsf(world[i].m[row][k] * invWorld[i].m[k][col]);
+                float tolerance = 1e-5f * (1.0f + terms);
+                inverse &= fabsf(product.m[row][col] - (row == col ? 1.0f : 0.0f)) < tolerance;
+            }
+        }
+    }
+    TEST_CHECK(inverse);
+
+    // the cache: a full rebuild, then only the objects marked dirty, both ending at TransformBuild's results
+    TransformCache cache;
+    TransformCacheSync(cache, count, pos.data(), rot.data(), scale.data());
+    TEST_CHECK(cache.fullRebuilds == 1 && cache.recomputed == count);
+    TEST_CHECK(Mismatches(cache.world, world, count) == 0 && Mismatches(cache.invWorld, invWorld, count) == 0);
+    TEST_CHECK(Mismatches(cache.gpuWorld, gpuWorld, count) == 0);
+    for (int i : {0, 7, 1000, count - 1})
+    {
+        pos[i].y += 3.0f;
+        TransformBuild(pos[i], rot[i], scale[i], &world[i], &invWorld[i]);
+        TransformBuild(pos[i], rot[i], scale[i], &gpuWorld[i], nullptr, true);
+        TransformCacheMarkDirty(cache, i);
+        TransformCacheMarkDirty(cache, i); // twice is once
+    }
+    TransformCacheMarkDirty(cache, count); // newer than the cache, ignored
+    cache.recomputed = 0;
+    TransformCacheSync(cache, count, pos.data(), rot.data(), scale.data());
+    TEST_CHECK(cache.fullRebuilds == 1 && cache.recomputed == 4 && cache.dirtyList.empty());
+    TEST_CHECK(Mismatches(cache.world, world, count) == 0 && Mismatches(cache.gpuWorld, gpuWorld, count) == 0);
+    TEST_CHECK(Mismatches(cache.invWorld, invWorld, count) == 0);
+
+    // time per object, both layouts like a full rebuild of the cache
+    printf("  paths run: %s (startup picks %s)\n", paths.c_str(), g_transformPathNames[g_transformPath]);
+    for (int p = 0; p < TRANSFORM_PATH_COUNT; ++p)
+    {
+        if (!TransformPathSupported((TransformPath)p))
+            continue;
+        std::vector<DirectX::XMFLOAT4X4> outWorld(count), outInvWorld(count), outGpuWorld(count);
+        double best = 1e30;
+        for (int run = 0; run < 200; ++run)
+        {
+            double start = TestNowMs();
+            TransformBuildBatch(soa, count, outWorld.data(), outInvWorld.data(), false, (TransformPath)p);
+            TransformBuildBatch(soa, count, outGpuWorld.data(), nullptr, true, (TransformPath)p);
+            double ms = TestNowMs() - start;
+            best = ms < best ? ms : best;
+        }
+        printf("  %s: %.2f ns per object\n", g_transformPathNames[p], best * 1e6 / count);
+    }
+
+    return TestFinish("transform_cache");
+}
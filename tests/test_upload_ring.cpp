@@ -0,0 +1,155 @@
+#include "test.h"
+
+#include "upload_ring.h"
+
+#include <vector>
+
+// the upload ring's bookkeeping (upload_ring.h) against a fake GPU: a full ring, an allocation that would straddle
+// the end, fences completing out of step with the frames, fence values used twice, and a long random run checking
+// nothing handed out overlaps bytes the GPU may still read
+
+struct LiveRange
+{
+    uint64_t offset, size, fence;
+};
+
+int main(int argc, char **argv)
+{
+    TestInit(argc, argv);
+    UploadRing ring;
+
+    // full: the whole capacity in flight, nothing more fits until the frame's fence passes
+    UploadRingInit(ring, 4096);
+    TEST_CHECK(UploadRingAlloc(ring, 4096) == 0);
+    TEST_CHECK(UploadRingAlloc(ring, 1) == UPLOAD_RING_FULL);
+    TEST_CHECK(UploadRingAlloc(ring, 8192) == UPLOAD_RING_FULL); // never fits
+    UploadRingCloseFrame(ring, 1);
+    TEST_CHECK(UploadRingOldestFence(ring) == 1);
+    TEST_CHECK(UploadRingAlloc(ring, 1) == UPLOAD_RING_FULL);
+    UploadRingRetire(ring, 1);
+    TEST_CHECK(UploadRingInFlight(ring) == 0 && UploadRingOldestFence(ring) == 0);
+    TEST_CHECK(UploadRingAlloc(ring, 4096) == 0);
+    TEST_CHECK(ring.highWater == 4096);
+
+    // straddling the end: the allocation moves to the start and the skipped tail counts as in flight with it
+    UploadRingInit(ring, 4096);
+    TEST_CHECK(UploadRingAlloc(ring, 1000) == 0);
+    TEST_CHECK(UploadRingAlloc(ring, 1000) == 1024);
+    UploadRingCloseFrame(ring, 1);
+    TEST_CHECK(UploadRingAlloc(ring, 1000) == 2048);
+    TEST_CHECK(UploadRingAlloc(ring, 1100) == UPLOAD_RING_FULL); // [0, 1100) still belongs to frame 1
+    TEST_CHECK(ring.wraps == 0 && ring.head == 3048);           // the failed attempt changed nothing
+    UploadRingRetire(ring, 0);
+    TEST_CHECK(ring.tail == 0);
+    UploadRingRetire(ring, 1);
+    TEST_CHECK(ring.tail == 2024);
+    TEST_CHECK(UploadRingAlloc(ring, 1100) == 0);
+    TEST_CHECK(ring.wraps == 1 && UploadRingInFlight(ring) == 4096 + 1100 - 2024);
+    TEST_CHECK(UploadRingAlloc(ring, 2000) == UPLOAD_RING_FULL);
+
+    // alignment: texture data asks for 512, the default is 256
+    UploadRingInit(ring, 8192);
+    TEST_CHECK(UploadRingAlloc(ring, 100) == 0);
+    TEST_CHECK(UploadRingAlloc(ring, 100, UPLOAD_RING_MAX_ALIGNMENT) == 512);
+    TEST_CHECK(UploadRingAlloc(ring, 100) == 768);
+
+    // out of order: fences complete in a jump past several frames, or a stale completed value comes in after a newer
+    // one. frames are only freed oldest first and never twice
+    UploadRingInit(ring, 4096);
+    for (uint64_t fence = 10; fence <= 13; ++fence)
+    {
+        TEST_CHECK(UploadRingAlloc(ring, 512) != UPLOAD_RING_FULL);
+        UploadRingCloseFrame(ring, fence);
+    }
+    TEST_CHECK(ring.frameCount == 4 && UploadRingInFlight(ring) == 2048);
+    UploadRingRetire(ring, 12); // 10, 11 and 12 at once
+    TEST_CHECK(ring.frameCount == 1 && UploadRingInFlight(ring) == 512 && UploadRingOldestFence(ring) == 13);
+    UploadRingRetire(ring, 11); // stale, nothing happens
+    TEST_CHECK(ring.frameCount == 1 && UploadRingInFlight(ring) == 512);
+    UploadRingRetire(ring, 13);
+    TEST_CHECK(ring.frameCount == 0 && UploadRingInFlight(ring) == 0);
+
+    // fence reuse: after a full wait every frame index has the same fence value, so two frames close with it and
+    // are retired together. a frame closed without allocating anything is fine too
+    UploadRingInit(ring, 4096);
+    TEST_CHECK(UploadRingAlloc(ring, 1024) == 0);
+    UploadRingCloseFrame(ring, 20);
+    TEST_CHECK(UploadRingAlloc(ring, 1024) == 1024);
+    UploadRingCloseFrame(ring, 20);
+    UploadRingCloseFrame(ring, 21); // empty
+    TEST_CHECK(ring.frameCount == 3 && ring.lastFrameBytes == 0);
+    UploadRingRetire(ring, 20);
+    TEST_CHECK(ring.frameCount == 1 && ring.tail == 2048 && UploadRingOldestFence(ring) == 21);
+    UploadRingRetire(ring, 21);
+    TEST_CHECK(ring.frameCount == 0 && ring.tail == ring.head);
+
+    // more pending frames than UPLOAD_RING_MAX_FRAMES: the extra ones fold into the newest, freed by the later fence
+    UploadRingInit(ring, 1 << 16);
+    for (uint64_t fence = 1; fence <= UPLOAD_RING_MAX_FRAMES + 3; ++fence)
+    {
+        TEST_CHECK(UploadRingAlloc(ring, 256) != UPLOAD_RING_FULL);
+        UploadRingCloseFrame(ring, fence);
+    }
+    TEST_CHECK(ring.frameCount == UPLOAD_RING_MAX_FRAMES);
+    UploadRingRetire(ring, UPLOAD_RING_MAX_FRAMES - 1);
+    TEST_CHECK(ring.frameCount == 1 && UploadRingInFlight(ring) == 4 * 256); // the last 4 wait for the newest fence
+    UploadRingRetire(ring, UPLOAD_RING_MAX_FRAMES + 2);
+    TEST_CHECK(ring.frameCount == 1);
+    UploadRingRetire(ring, UPLOAD_RING_MAX_FRAMES + 3);
+    TEST_CHECK(ring.frameCount == 0 && UploadRingInFlight(ring) == 0);
+
+    // random frames against a GPU two frames behind: every allocation is aligned, inside the buffer and clear of the
+    // ranges of frames whose fence hasn't completed
+    TestRandom random = {17};
+    UploadRingInit(ring, 1 << 16);
+    std::vector<LiveRange> live;
+    uint64_t completed = 0;
+    bool aligned = true, inside = true, disjoint = true;
+    int full = 0;
+    for (uint64_t fence = 1; fence <= 20000; ++fence)
+    {
+        int allocations = (int)(TestRand(random) % 5);
+        for (int a = 0; a < allocations; ++a)
+        {
+            uint64_t size = 1 + TestRand(random) % 8000; // a frame needs at most half the ring
+            uint64_t offset = UploadRingAlloc(ring, size);
+            while (offset == UPLOAD_RING_FULL && UploadRingOldestFence(ring) != 0)
+            {
+                completed = UploadRingOldestFence(ring); // wait for the GPU, like UploadFrameData
+                UploadRingRetire(ring, completed);
+                offset = UploadRingAlloc(ring, size);
+            }
+            if (offset == UPLOAD_RING_FULL)
+            {
+                full++;
+                continue;
+            }
+            aligned &= offset % UPLOAD_RING_ALIGNMENT == 0;
+            inside &= offset + size <= ring.capacity;
+            for (const LiveRange &range : live)
+                disjoint &= range.fence <= completed || offset + size <= range.offset || range.offset + range.size <= offset;
+            live.push_back({offset, size, fence});
+        }
+        UploadRingCloseFrame(ring, fence);
+        if (fence > 2 && fence - 2 > completed)
+            completed = fence - 2;
+        UploadRingRetire(ring, completed);
+        size_t kept = 0;
+        for (const LiveRange &range : live)
+        {
+            if (range.fence > completed)
+                live[kept++] = range;
+        }
+        live.resize(kept);
+        inside &= UploadRingInFlight(ring) <= ring.capacity;
+    }
+    TEST_CHECK(aligned);
+    TEST_CHECK(inside);
+    TEST_CHECK(disjoint);
+    TEST_CHECK(full == 0 && ring.wraps > 0);
+    printf("  random: %llu allocations, %llu wraps, high water %llu of %llu bytes\n",
+           (unsigned long long)ring.allocations, (unsigned long long)ring.wraps, (unsigned long long)ring.highWater,
+           (unsigned long long)ring.capacity);
+
+    return TestFinish("upload_ring");
+}